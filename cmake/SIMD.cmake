@@ -35,13 +35,14 @@ if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|i686|x86")
         message(STATUS "    - SSE2 (not available)")
     endif()
 
-    # Check for AVX2
-    set(CMAKE_REQUIRED_FLAGS "-mavx2 -mfma")
+    # Check for AVX2 (with FMA and the F16C half-precision conversions)
+    set(CMAKE_REQUIRED_FLAGS "-mavx2 -mfma -mf16c")
     check_c_source_compiles("
             #include <immintrin.h>
             int main() {
                 __m256 v = _mm256_set1_ps(1.0f);
                 v = _mm256_mul_ps(v, v);
+                v = _mm256_cvtph_ps(_mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
                 return 0;
             }
         " VL_SIMD_AVX2_AVAILABLE)
@@ -54,6 +55,28 @@ if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|i686|x86")
         message(STATUS "    - AVX2 (not available)")
     endif()
 
+    # Check for AVX-512 (F, BW, VL and DQ). The AVX-512 backend reuses the AVX2
+    # backend for every operation it does not override, so it needs both.
+    set(CMAKE_REQUIRED_FLAGS "-mavx512f -mavx512bw -mavx512vl -mavx512dq")
+    check_c_source_compiles("
+            #include <immintrin.h>
+            int main() {
+                __m512i v = _mm512_set1_epi8(1);
+                __mmask64 m = _mm512_cmpeq_epi8_mask(v, v);
+                __m512 f = _mm512_maskz_loadu_ps((__mmask16)m, 0);
+                return (int)_mm512_reduce_add_ps(f);
+            }
+        " VL_SIMD_AVX512_AVAILABLE)
+    unset(CMAKE_REQUIRED_FLAGS)
+
+    if(VL_SIMD_AVX512_AVAILABLE AND VL_SIMD_AVX2_AVAILABLE)
+        list(APPEND VL_SIMD_IMPLEMENTATIONS "avx512")
+        message(STATUS "    - AVX-512 (available)")
+    else()
+        set(VL_SIMD_AVX512_AVAILABLE FALSE)
+        message(STATUS "    - AVX-512 (not available)")
+    endif()
+
     # ===== ARM/ARM64 Feature Detection =====
 elseif(CMAKE_SYSTEM_PROCESSOR MATCHES "armv7|armv8|aarch64|arm64")
     message(STATUS "  Detected ARM architecture - checking for NEON...")
@@ -102,6 +125,8 @@ function(vl_add_simd_implementation impl_name source_file)
             set(flags /arch:SSE2)
         elseif(impl_name STREQUAL "avx2")
             set(flags /arch:AVX2)
+        elseif(impl_name STREQUAL "avx512")
+            set(flags /arch:AVX512)
         elseif(impl_name STREQUAL "neon")
             set(flags /arch:ARMV7)
         else()
@@ -111,7 +136,9 @@ function(vl_add_simd_implementation impl_name source_file)
         if(impl_name STREQUAL "sse2")
             set(flags -msse2)
         elseif(impl_name STREQUAL "avx2")
-            set(flags -mavx2 -mfma)
+            set(flags -mavx2 -mfma -mf16c)
+        elseif(impl_name STREQUAL "avx512")
+            set(flags -mavx2 -mfma -mf16c -mavx512f -mavx512bw -mavx512vl -mavx512dq)
         elseif(impl_name STREQUAL "neon")
             set(flags -mfpu=neon -mfloat-abi=hard)
         elseif(impl_name STREQUAL "neon64")
@@ -0,0 +1,395 @@
+/**
+ * ██    ██ ██       █████  ███████  █████   ██████  ███    ██  █████
+ * ██    ██ ██      ██   ██ ██      ██   ██ ██       ████   ██ ██   ██
+ * ██    ██ ██      ███████ ███████ ███████ ██   ███ ██ ██  ██ ███████
+ *  ██  ██  ██      ██   ██      ██ ██   ██ ██    ██ ██  ██ ██ ██   ██
+ *   ████   ███████ ██   ██ ███████ ██   ██  ██████  ██   ████ ██   ██
+ * ====---: A Data Structure and Algorithms library for C11.  :---====
+ *
+ * Copyright 2026 Jesse Walker, released under the MIT license.
+ * Git Repository:  https://github.com/walkerje/veritable_lasagna
+ * \private
+ */
+
+#ifndef VL_BTREE_H
+#define VL_BTREE_H
+
+#include "vl_compare.h"
+#include "vl_memory.h"
+
+/**
+ * \brief Size of each tree node, in bytes, used when a B-tree is initialized with a node size of 0.
+ */
+#define VL_BTREE_DEFAULT_NODE_SIZE 512
+
+/**
+ * \brief Alignment of every B-tree node, in bytes. Nodes start on a cache line.
+ */
+#define VL_BTREE_NODE_ALIGN 64
+
+/**
+ * \brief Position of an element within a vl_btree.
+ *
+ * Iterators name a leaf and a slot within it. Unlike vl_set iterators, they
+ * are invalidated by any insertion or removal, since elements shift within
+ * and between leaves.
+ */
+typedef struct
+{
+    void* leaf; // Leaf node holding the element, or NULL for the end of the tree.
+    vl_uint_t index; // Slot of the element within the leaf.
+} vl_btree_iter;
+
+/**
+ * \brief Returns `VL_TRUE` if a B-tree iterator names an element.
+ */
+#define vlBTreeIterValid(iter) ((iter).leaf != NULL)
+
+/**
+ * \brief Number of elements in a B-tree.
+ */
+#define vlBTreeSize(tree) ((tree)->totalElements)
+
+/**
+ * Convenience macro for iterating over a B-tree in ascending order.
+ * \param tree pointer
+ * \param trackVar name of the tracking variable used as the iterator
+ */
+#define VL_BTREE_FOREACH(tree, trackVar)                                                                               \
+    for (vl_btree_iter trackVar = vlBTreeFront(tree); vlBTreeIterValid(trackVar);                                      \
+         (trackVar) = vlBTreeNext(tree, trackVar))
+
+/**
+ * \brief An ordered set stored as a B+ tree.
+ *
+ * The vl_btree holds unique elements ordered by a comparator, with the same
+ * contract as vl_set: elements are ordered by a key, and may carry
+ * supplementary data in the same block of memory.
+ *
+ * Elements live in leaf nodes, stored contiguously and in order, and leaves
+ * are linked to their neighbours so that ordered iteration and range scans
+ * walk memory sequentially. Interior nodes hold only separators and child
+ * pointers. Every node is `nodeSize` bytes and aligned to a cache line, so a
+ * lookup touches one node per level, and there are far fewer levels than in
+ * a binary tree.
+ *
+ * Compared to vl_set, a B-tree uses much less memory per element and is
+ * faster to search and to iterate, but insertion and removal move elements
+ * within nodes, so pointers and iterators into the tree do not survive them.
+ *
+ * \sa vl_set
+ */
+typedef struct
+{
+    void* root; // Root node, or NULL if the tree is empty.
+    void* first; // Leftmost leaf.
+    void* last; // Rightmost leaf.
+    vl_memsize_t elementSize; // Size of each element, in bytes.
+    vl_dsidx_t totalElements; // Total number of elements in the tree.
+    vl_dsidx_t totalNodes; // Total number of nodes, leaf and interior.
+    vl_uint_t height; // Number of levels; 0 when empty, 1 when the root is a leaf.
+    vl_uint_t nodeSize; // Size of each node, in bytes.
+    vl_uint_t leafCapacity; // Elements per leaf.
+    vl_uint_t branchCapacity; // Separators per interior node; each has one more child than separators.
+    vl_compare_function comparator; // comparator function pointer. see vl_compare.
+} vl_btree;
+
+/**
+ * \brief Initializes a B-tree holding elements of the specified size.
+ *
+ * The node size is raised if needed so that every leaf holds at least four
+ * elements and every interior node at least four separators.
+ *
+ * ## Contract
+ * - **Ownership**: The caller maintains ownership of the `tree` struct. The tree owns its nodes.
+ * - **Lifetime**: The tree is valid until `vlBTreeFree` or `vlBTreeDelete`.
+ * - **Thread Safety**: Not thread-safe. Concurrent access must be synchronized.
+ * - **Nullability**: `tree` and `comparator` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: An `elementSize` of 0. Initializing a tree twice without freeing it (leaks memory).
+ * - **Memory Allocation Expectations**: None until the first insertion.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param tree tree to initialize
+ * \param elementSize size of each element, in bytes
+ * \param nodeSize size of each node in bytes, or 0 for VL_BTREE_DEFAULT_NODE_SIZE
+ * \param comparator comparator function; 0 = same, >0 = greater, <0 = lesser.
+ * \par Complexity of O(1) constant.
+ * \sa vlBTreeFree
+ */
+VL_API void vlBTreeInit(vl_btree* tree, vl_memsize_t elementSize, vl_uint_t nodeSize, vl_compare_function comparator);
+
+/**
+ * \brief Frees every node of a B-tree initialized with vlBTreeInit.
+ *
+ * ## Contract
+ * - **Ownership**: Releases all nodes. Does NOT release the `tree` struct itself.
+ * - **Lifetime**: The tree is invalid until initialized again.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `tree` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Double free.
+ * - **Memory Allocation Expectations**: Deallocates all nodes.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param tree tree to free
+ * \par Complexity of O(n) linear.
+ * \sa vlBTreeInit
+ */
+VL_API void vlBTreeFree(vl_btree* tree);
+
+/**
+ * \brief Allocates and initializes a B-tree.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns the returned tree and must release it with vlBTreeDelete.
+ * - **Lifetime**: Valid until vlBTreeDelete.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `comparator` must not be `NULL`. Returns `NULL` if allocation fails.
+ * - **Error Conditions**: Returns `NULL` on allocation failure.
+ * - **Undefined Behavior**: As vlBTreeInit.
+ * - **Memory Allocation Expectations**: Allocates the `vl_btree` struct.
+ * - **Return-value Semantics**: Returns a pointer to the new tree, or `NULL`.
+ *
+ * \param elementSize size of each element, in bytes
+ * \param nodeSize size of each node in bytes, or 0 for VL_BTREE_DEFAULT_NODE_SIZE
+ * \param comparator comparator function; 0 = same, >0 = greater, <0 = lesser.
+ * \return pointer to the new tree
+ * \par Complexity of O(1) constant.
+ * \sa vlBTreeDelete
+ */
+VL_API vl_btree* vlBTreeNew(vl_memsize_t elementSize, vl_uint_t nodeSize, vl_compare_function comparator);
+
+/**
+ * \brief Frees a B-tree created by vlBTreeNew, along with its nodes.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the tree struct and all nodes.
+ * - **Lifetime**: The pointer is invalid afterwards.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: Safe to call with `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Double deletion, or deleting a tree that was not created by vlBTreeNew.
+ * - **Memory Allocation Expectations**: Deallocates the tree and its nodes.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param tree tree to delete
+ * \par Complexity of O(n) linear.
+ * \sa vlBTreeNew
+ */
+VL_API void vlBTreeDelete(vl_btree* tree);
+
+/**
+ * \brief Removes every element from a B-tree and frees its nodes.
+ *
+ * \param tree tree to clear
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlBTreeClear(vl_btree* tree);
+
+/**
+ * \brief Clones a B-tree.
+ *
+ * If `dest` is `NULL`, a new tree is allocated as by vlBTreeNew. Otherwise
+ * `dest` must be an initialized tree, whose contents, element size, node size
+ * and comparator are replaced. The clone is bulk-loaded, so its leaves are
+ * packed full regardless of how `src` was built.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns a newly allocated `dest`, as with vlBTreeNew.
+ * - **Lifetime**: The clone is independent of `src`.
+ * - **Thread Safety**: Not thread-safe if `src` is modified concurrently.
+ * - **Nullability**: `src` must not be `NULL`.
+ * - **Error Conditions**: Returns `NULL` if allocation fails. Cloning a tree onto itself is a no-op that returns
+ * `src`.
+ * - **Undefined Behavior**: An uninitialized, non-`NULL` `dest`.
+ * - **Memory Allocation Expectations**: Allocates nodes for the clone, and a temporary buffer of all elements.
+ * - **Return-value Semantics**: Returns `dest`, or the newly allocated tree.
+ *
+ * \param src tree to clone
+ * \param dest tree to overwrite, or `NULL`
+ * \return the clone, or `NULL` on failure
+ * \par Complexity of O(n) linear.
+ */
+VL_API vl_btree* vlBTreeClone(const vl_btree* src, vl_btree* dest);
+
+/**
+ * \brief Replaces the contents of a B-tree with a sorted array, building it bottom-up.
+ *
+ * Leaves are filled completely, level by level, which is much faster than
+ * inserting elements one at a time and yields the smallest possible tree.
+ * Runs of equal elements keep only their first element.
+ *
+ * ## Contract
+ * - **Ownership**: Elements are copied into the tree.
+ * - **Lifetime**: Previous iterators become invalid.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `tree` must not be `NULL`. `elements` may be `NULL` only if `numElements` is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the tree empty if `elements` is not sorted in ascending
+ * order under the comparator, or if allocation fails.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: Allocates nodes, and a temporary array of one pointer per leaf.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the tree holds the given elements.
+ *
+ * \param tree tree to rebuild
+ * \param elements sorted array of elements
+ * \param numElements number of elements
+ * \return VL_TRUE on success
+ * \par Complexity of O(n) linear.
+ */
+VL_API vl_bool_t vlBTreeBuildSorted(vl_btree* tree, const void* elements, vl_dsidx_t numElements);
+
+/**
+ * \brief Inserts a copy of an element into a B-tree.
+ *
+ * If an equal element already exists, the tree is left unchanged and an
+ * iterator to the existing element is returned.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged. The tree maintains its own copy.
+ * - **Lifetime**: The returned iterator is valid until the tree is next modified.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `tree` and `elem` must not be `NULL`.
+ * - **Error Conditions**: Returns an invalid iterator and leaves the tree unchanged if node allocation fails.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: May allocate nodes when full nodes split.
+ * - **Return-value Semantics**: Returns an iterator to the inserted or existing element.
+ *
+ * \param tree tree to insert into
+ * \param elem element to copy
+ * \return iterator to the element
+ * \par Complexity of O(log(n)).
+ */
+VL_API vl_btree_iter vlBTreeInsert(vl_btree* tree, const void* elem);
+
+/**
+ * \brief Removes the element equal to `elem` from a B-tree, if there is one.
+ *
+ * ## Contract
+ * - **Ownership**: The removed element is copied to `dest`, if given.
+ * - **Lifetime**: All iterators into the tree become invalid.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `tree` and `elem` must not be `NULL`. `dest` may be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: May free nodes when underfull nodes merge.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if an element was removed.
+ *
+ * \param tree tree to remove from
+ * \param elem element to find
+ * \param dest destination for the removed element, or `NULL`
+ * \return VL_TRUE if an element was removed
+ * \par Complexity of O(log(n)).
+ */
+VL_API vl_bool_t vlBTreeRemove(vl_btree* tree, const void* elem, void* dest);
+
+/**
+ * \brief Finds the element equal to `elem`.
+ *
+ * \param tree tree to search
+ * \param elem element to find
+ * \return iterator to the element, or an invalid iterator if there is none
+ * \par Complexity of O(log(n)).
+ */
+VL_API vl_btree_iter vlBTreeFind(const vl_btree* tree, const void* elem);
+
+/**
+ * \brief Finds the first element that does not order before `elem`.
+ *
+ * \param tree tree to search
+ * \param elem element to compare against
+ * \return iterator to the element, or an invalid iterator if every element orders before `elem`
+ * \par Complexity of O(log(n)).
+ */
+VL_API vl_btree_iter vlBTreeLowerBound(const vl_btree* tree, const void* elem);
+
+/**
+ * \brief Finds the first element that orders after `elem`.
+ *
+ * \param tree tree to search
+ * \param elem element to compare against
+ * \return iterator to the element, or an invalid iterator if no element orders after `elem`
+ * \par Complexity of O(log(n)).
+ */
+VL_API vl_btree_iter vlBTreeUpperBound(const vl_btree* tree, const void* elem);
+
+/**
+ * \brief Returns an iterator to the first element, or an invalid iterator if the tree is empty.
+ *
+ * \param tree tree to inspect
+ * \return iterator to the first element
+ * \par Complexity of O(1) constant.
+ */
+VL_API vl_btree_iter vlBTreeFront(const vl_btree* tree);
+
+/**
+ * \brief Returns an iterator to the last element, or an invalid iterator if the tree is empty.
+ *
+ * \param tree tree to inspect
+ * \return iterator to the last element
+ * \par Complexity of O(1) constant.
+ */
+VL_API vl_btree_iter vlBTreeBack(const vl_btree* tree);
+
+/**
+ * \brief Returns an iterator to the element after `iter`, or an invalid iterator at the end.
+ *
+ * \param tree tree being iterated
+ * \param iter valid iterator
+ * \return iterator to the next element
+ * \par Complexity of O(1) constant.
+ */
+VL_API vl_btree_iter vlBTreeNext(const vl_btree* tree, vl_btree_iter iter);
+
+/**
+ * \brief Returns an iterator to the element before `iter`, or an invalid iterator at the beginning.
+ *
+ * \param tree tree being iterated
+ * \param iter valid iterator
+ * \return iterator to the previous element
+ * \par Complexity of O(1) constant.
+ */
+VL_API vl_btree_iter vlBTreePrev(const vl_btree* tree, vl_btree_iter iter);
+
+/**
+ * \brief Returns a pointer to the element named by an iterator.
+ *
+ * As with vlSetSample, supplementary data in the element may be modified, but
+ * the key by which the tree is ordered must not be.
+ *
+ * \param tree tree being iterated
+ * \param iter valid iterator
+ * \return pointer to the element, valid until the tree is next modified
+ * \par Complexity of O(1) constant.
+ */
+VL_API void* vlBTreeSample(const vl_btree* tree, vl_btree_iter iter);
+
+/**
+ * \brief Copies the elements in the range [low, high) to `dest`, in ascending order.
+ *
+ * Elements are copied a leaf at a time along the leaf chain, so scanning a
+ * range costs one lookup plus a sequential copy.
+ *
+ * ## Contract
+ * - **Ownership**: Elements are copied; the tree is unchanged.
+ * - **Lifetime**: `dest` must hold `maxElements` elements.
+ * - **Thread Safety**: Safe for concurrent reads.
+ * - **Nullability**: `tree` must not be `NULL`. A `NULL` `low` starts at the first element, and a `NULL` `high`
+ * runs to the last. `dest` may be `NULL` only if `maxElements` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the number of elements copied, at most `maxElements`.
+ *
+ * \param tree tree to scan
+ * \param low inclusive lower bound, or `NULL`
+ * \param high exclusive upper bound, or `NULL`
+ * \param dest destination array
+ * \param maxElements capacity of `dest`, in elements
+ * \return number of elements copied
+ * \par Complexity of O(log(n) + k) for k elements copied.
+ */
+VL_API vl_dsidx_t vlBTreeCopyRange(const vl_btree* tree, const void* low, const void* high, void* dest,
+                                   vl_dsidx_t maxElements);
+
+#endif // VL_BTREE_H
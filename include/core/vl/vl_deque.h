@@ -14,30 +14,40 @@
 #ifndef VL_DEQUE_H
 #define VL_DEQUE_H
 
-#include "vl_pool.h"
+#include "vl_memory.h"
+
+/**
+ * \brief Capacity, in elements, of a deque's first allocation.
+ */
+#ifndef VL_DEQUE_DEFAULT_CAPACITY
+#define VL_DEQUE_DEFAULT_CAPACITY 16
+#endif
 
 /**
  * \brief Double-ended queue.
  *
- * The Deque data structure is a doubly-linked list.
- * It is implemented on top of a pool allocator, and thus requires all elements
- * in the queue to be the same size.
+ * The Deque data structure is a growable ring buffer. All elements must be
+ * the same size, and are stored contiguously in a single allocation whose
+ * capacity is always a power of two. When the buffer is full, its capacity
+ * doubles.
  *
- * Items may be added or removed from either end, but iteration is inherently
- * disallowed. Just like the vl_queue data structure, direct sampling is also
- * disallowed. Thus, all IO requires a copy. If you're using "weighty" (or,
- * large in byte size) elements and are worried about the efficiency of copying,
- * storing pointers, iterators, or offsets in the queue is a perfectly valid
- * approach.
+ * Items may be added or removed from either end in O(1), and any element may
+ * be sampled by its position from the front, also in O(1). Ranges of elements
+ * can be pushed to the back or popped from the front in bulk, which costs at
+ * most two memcpy calls since the stored elements wrap around the end of the
+ * buffer at most once.
+ *
+ * Element pointers obtained via vlDequeSample are invalidated by any push that
+ * grows the buffer, and by popping the element.
  * \sa vl_queue
  */
 typedef struct
 {
-    vl_pool nodes; // pool nodes
+    vl_transient* elements; // ring storage, capacity * elementSize bytes. NULL until the first push.
+    vl_dsidx_t capacity; // capacity of the ring, in elements. Zero or a power of two.
+    vl_dsidx_t head; // ring slot of the first element
     vl_dsidx_t totalElements; // total elements in the deque
     vl_uint16_t elementSize; // size of a single element, in bytes.
-    vl_pool_idx head; // first element
-    vl_pool_idx tail; // last element
 } vl_deque;
 
 /**
@@ -46,14 +56,14 @@ typedef struct
  * The deque should later be de-initialized via vlDequeFree.
  *
  * ## Contract
- * - **Ownership**: The caller maintains ownership of the `deq` struct. The function initializes the internal node pool.
+ * - **Ownership**: The caller maintains ownership of the `deq` struct.
  * - **Lifetime**: The deque is valid until `vlDequeFree` or `vlDequeDelete`.
  * - **Thread Safety**: Not thread-safe. Concurrent access must be synchronized.
  * - **Nullability**: `deq` must not be `NULL`.
  * - **Error Conditions**: None.
  * - **Undefined Behavior**: Passing an already initialized deque without first calling `vlDequeFree` (causes memory
  * leak).
- * - **Memory Allocation Expectations**: Initializes an internal `vl_pool` which allocates management structures.
+ * - **Memory Allocation Expectations**: None. The ring buffer is allocated on the first push or reservation.
  * - **Return-value Semantics**: None (void).
  *
  * \sa vlDequeFree
@@ -69,13 +79,13 @@ VL_API void vlDequeInit(vl_deque* deq, vl_uint16_t elementSize);
  * The deque should have been initialized via vlDequeInit.
  *
  * ## Contract
- * - **Ownership**: Releases ownership of the internal node pool. Does NOT release the `deq` struct itself.
+ * - **Ownership**: Releases ownership of the ring buffer. Does NOT release the `deq` struct itself.
  * - **Lifetime**: The deque becomes invalid for use.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `deq` must not be `NULL`.
  * - **Error Conditions**: None.
  * - **Undefined Behavior**: Double free.
- * - **Memory Allocation Expectations**: Deallocates internal pool structures.
+ * - **Memory Allocation Expectations**: Deallocates the ring buffer.
  * - **Return-value Semantics**: None (void).
  *
  * \sa vlDequeInit
@@ -95,7 +105,7 @@ VL_API void vlDequeFree(vl_deque* deq);
  * - **Nullability**: Returns `NULL` if heap allocation for the deque struct fails.
  * - **Error Conditions**: Returns `NULL` on allocation failure.
  * - **Undefined Behavior**: None.
- * - **Memory Allocation Expectations**: Allocates memory for the `vl_deque` struct and its internal node pool.
+ * - **Memory Allocation Expectations**: Allocates memory for the `vl_deque` struct.
  * - **Return-value Semantics**: Returns a pointer to the newly allocated and initialized deque, or `NULL`.
  *
  * \sa vlDequeDelete
@@ -111,7 +121,7 @@ VL_API vl_deque* vlDequeNew(vl_uint16_t elementSize);
  * The deque should have been initialized via vlDequeNew.
  *
  * ## Contract
- * - **Ownership**: Releases ownership of the internal node pool and the `vl_deque` struct.
+ * - **Ownership**: Releases ownership of the ring buffer and the `vl_deque` struct.
  * - **Lifetime**: The deque pointer becomes invalid.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: Safe to call if `deq` is `NULL`.
@@ -129,7 +139,7 @@ VL_API void vlDequeDelete(vl_deque* deq);
 /**
  * \brief Clears the specified deque.
  *
- * Resets the head and tail iterators and clears the internal node pool.
+ * Resets the element count. The ring buffer is kept for reuse.
  *
  * ## Contract
  * - **Ownership**: Unchanged.
@@ -157,11 +167,13 @@ VL_API void vlDequeClear(vl_deque* deq);
  * - **Nullability**: `deque` must not be `NULL`.
  * - **Error Conditions**: None checked.
  * - **Undefined Behavior**: Passing an uninitialized deque.
- * - **Memory Allocation Expectations**: Triggers expansion of the underlying node pool.
+ * - **Memory Allocation Expectations**: Grows the ring buffer to the smallest power of two holding `n` elements, if
+ * it is not already that large.
  * - **Return-value Semantics**: None (void).
  *
  * \param deque pointer
  * \param n total number of elements to reserve space for.
+ * \par Complexity O(n) linear.
  */
 VL_API void vlDequeReserve(vl_deque* deque, vl_dsidx_t n);
 
@@ -184,13 +196,15 @@ VL_API void vlDequeReserve(vl_deque* deque, vl_dsidx_t n);
  * - **Lifetime**: The cloned deque is valid until deleted or freed.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `src` must not be `NULL`. `dest` can be `NULL`.
- * - **Error Conditions**: Returns `NULL` if allocation fails.
+ * - **Error Conditions**: Returns `NULL` if allocation fails; a deque created by this call is deleted first.
+ * Cloning a deque onto itself is a no-op that returns `src`.
  * - **Undefined Behavior**: Passing an uninitialized deque.
- * - **Memory Allocation Expectations**: May allocate a new deque struct and multiple nodes.
+ * - **Memory Allocation Expectations**: May allocate a new deque struct, and a ring buffer of the source's capacity.
  * - **Return-value Semantics**: Returns the pointer to the cloned deque, or `NULL` on failure.
  *
  * \param src pointer
  * \param dest pointer
+ * \par Complexity O(n) linear.
  * \return pointer to deque that was copied to or created.
  */
 VL_API vl_deque* vlDequeClone(const vl_deque* src, vl_deque* dest);
@@ -224,12 +238,12 @@ static inline vl_dsidx_t vlDequeSize(vl_deque* deq) { return deq->totalElements;
  * - **Nullability**: `deq` must not be `NULL`. `val` should not be `NULL`.
  * - **Error Conditions**: None checked.
  * - **Undefined Behavior**: Passing an uninitialized deque.
- * - **Memory Allocation Expectations**: May trigger expansion of the underlying node pool.
+ * - **Memory Allocation Expectations**: Doubles the ring buffer when it is full.
  * - **Return-value Semantics**: None (void).
  *
  * \param deq pointer
  * \param val element data pointer
- * \par Complexity O(1) constant.
+ * \par Complexity O(1) amortized.
  */
 VL_API void vlDequePushFront(vl_deque* deq, const void* val);
 
@@ -240,8 +254,7 @@ VL_API void vlDequePushFront(vl_deque* deq, const void* val);
  * is still removed.
  *
  * ## Contract
- * - **Ownership**: Transfers ownership of the element slot back to the internal pool. The caller owns the data copied
- * into `val`.
+ * - **Ownership**: The caller owns the data copied into `val`.
  * - **Lifetime**: The popped element's storage in the deque becomes invalid.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `deq` must not be `NULL`. `val` can be `NULL`.
@@ -267,12 +280,12 @@ VL_API int vlDequePopFront(vl_deque* deq, void* val);
  * - **Nullability**: `deq` must not be `NULL`. `val` should not be `NULL`.
  * - **Error Conditions**: None checked.
  * - **Undefined Behavior**: Passing an uninitialized deque.
- * - **Memory Allocation Expectations**: May trigger expansion of the underlying node pool.
+ * - **Memory Allocation Expectations**: Doubles the ring buffer when it is full.
  * - **Return-value Semantics**: None (void).
  *
  * \param deq pointer
  * \param val element data pointer
- * \par Complexity O(1) constant.
+ * \par Complexity O(1) amortized.
  */
 VL_API void vlDequePushBack(vl_deque* deq, const void* val);
 
@@ -283,8 +296,7 @@ VL_API void vlDequePushBack(vl_deque* deq, const void* val);
  * is still removed.
  *
  * ## Contract
- * - **Ownership**: Transfers ownership of the element slot back to the internal pool. The caller owns the data copied
- * into `val`.
+ * - **Ownership**: The caller owns the data copied into `val`.
  * - **Lifetime**: The popped element's storage in the deque becomes invalid.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `deq` must not be `NULL`. `val` can be `NULL`.
@@ -299,4 +311,70 @@ VL_API void vlDequePushBack(vl_deque* deq, const void* val);
  */
 VL_API int vlDequePopBack(vl_deque* deq, void* val);
 
+/**
+ * \brief Returns a pointer to the element at the specified position from the front.
+ *
+ * ## Contract
+ * - **Ownership**: The deque retains ownership of the element.
+ * - **Lifetime**: Valid until the element is popped, or a push grows the ring buffer.
+ * - **Thread Safety**: Safe for concurrent reads.
+ * - **Nullability**: `deq` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: An `index` not less than the size of the deque.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns a pointer to the element. Index 0 is the front, size - 1 the back.
+ *
+ * \param deq pointer
+ * \param index position of the element, counted from the front
+ * \par Complexity O(1) constant.
+ * \return pointer to the element
+ */
+static inline void* vlDequeSample(vl_deque* deq, vl_dsidx_t index)
+{
+    return deq->elements + ((deq->head + index) & (deq->capacity - 1)) * deq->elementSize;
+}
+
+/**
+ * \brief Copies an array of elements to the end of the deque, in order.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged. The deque maintains its own copies.
+ * - **Lifetime**: Valid until popped.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `deq` must not be `NULL`. `vals` may be `NULL` only if `n` is 0.
+ * - **Error Conditions**: Nothing is pushed if the ring buffer cannot grow.
+ * - **Undefined Behavior**: Passing an uninitialized deque.
+ * - **Memory Allocation Expectations**: Grows the ring buffer at most once, to the next power of two that fits.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param deq pointer
+ * \param vals array of `n` elements
+ * \param n number of elements to push
+ * \par Complexity O(n) linear, with at most two memcpy calls when no growth is needed.
+ */
+VL_API void vlDequePushBackN(vl_deque* deq, const void* vals, vl_dsidx_t n);
+
+/**
+ * \brief Copies up to `n` elements from the front of the deque, in order, and removes them.
+ *
+ * If `vals` is NULL, the elements are removed without being copied.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns the data copied into `vals`.
+ * - **Lifetime**: The popped elements' storage in the deque becomes invalid.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `deq` must not be `NULL`. `vals` can be `NULL`.
+ * - **Error Conditions**: Pops fewer than `n` elements if the deque holds fewer.
+ * - **Undefined Behavior**: Passing an uninitialized deque.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the number of elements popped.
+ *
+ * \param deq pointer
+ * \param vals destination array with room for `n` elements, or NULL
+ * \param n maximum number of elements to pop
+ * \par Complexity O(n) linear, with at most two memcpy calls.
+ * \return number of elements popped
+ */
+VL_API vl_dsidx_t vlDequePopFrontN(vl_deque* deq, void* vals, vl_dsidx_t n);
+
 #endif // VL_DEQUE_H
@@ -0,0 +1,351 @@
+/**
+ * ██    ██ ██       █████  ███████  █████   ██████  ███    ██  █████
+ * ██    ██ ██      ██   ██ ██      ██   ██ ██       ████   ██ ██   ██
+ * ██    ██ ██      ███████ ███████ ███████ ██   ███ ██ ██  ██ ███████
+ *  ██  ██  ██      ██   ██      ██ ██   ██ ██    ██ ██  ██ ██ ██   ██
+ *   ████   ███████ ██   ██ ███████ ██   ██  ██████  ██   ████ ██   ██
+ * ====---: A Data Structure and Algorithms library for C11.  :---====
+ *
+ * Copyright 2026 Jesse Walker, released under the MIT license.
+ * Git Repository:  https://github.com/walkerje/veritable_lasagna
+ * \private
+ */
+
+#ifndef VL_FIBER_H
+#define VL_FIBER_H
+
+#include "vl_memory.h"
+#include "vl_numtypes.h"
+#include "vl_thread_pool.h"
+
+#ifndef VL_FIBER_DEFAULT_STACK_SIZE
+#define VL_FIBER_DEFAULT_STACK_SIZE VL_KB(64)
+#endif
+
+#ifndef VL_FIBER_MIN_STACK_SIZE
+#define VL_FIBER_MIN_STACK_SIZE VL_KB(16)
+#endif
+
+/**
+ * \brief Stackful fiber scheduler multiplexed onto thread pool workers.
+ *
+ * A fiber is a lightweight user-space execution context with its own stack.
+ * Fibers are cooperatively scheduled: a fiber runs on a pool worker until it
+ * finishes, yields, sleeps, waits on an event, or offloads a blocking call,
+ * at which point the worker is released to run other fibers or tasks.
+ *
+ * ## Architecture
+ *
+ * Every resumption of a fiber is a single task submitted to a `vl_thread_pool`.
+ * The task switches from the worker's own stack onto the fiber's stack, and
+ * control returns to the task when the fiber suspends. A fiber may therefore
+ * resume on a different worker than the one it suspended on.
+ *
+ * Suspension is made race-free by deferring the wakeup registration until the
+ * fiber has fully switched off its stack: the worker, not the fiber, publishes
+ * the fiber to timers, events and the blocking pool.
+ *
+ * ## Context Switching
+ *
+ * - **x86-64 / AArch64 Linux**: hand-written switch routines save only the
+ *   callee-saved registers of the platform ABI.
+ * - **Other POSIX targets**: `ucontext` is used as a portable fallback.
+ * - **Win32**: native Win32 fibers are used.
+ *
+ * ## Stacks
+ *
+ * Fiber descriptors are allocated from a `vl_pool` and never released until the
+ * scheduler is deleted. A finished fiber keeps its stack, and the descriptor is
+ * recycled by the next spawn, so steady-state spawning performs no allocation.
+ * On POSIX, stacks are mapped lazily, so resident memory is proportional to
+ * the stack depth actually used. Guard pages cost one extra kernel mapping per
+ * stack; disable them when running more fibers than the system's mapping limit
+ * allows (`vm.max_map_count` on Linux, 65530 by default, covers ~32k guarded
+ * stacks).
+ *
+ * ## Blocking Calls
+ *
+ * A fiber that must call a blocking function (socket or file stream I/O, for
+ * example) should do so through `vlFiberBlocking`. The call runs on a separate
+ * elastic pool of blocking threads while the fiber is parked, leaving its
+ * worker free to run other fibers.
+ *
+ * ## Thread Safety
+ *
+ * All functions are thread-safe. The in-fiber functions (`vlFiberYield`,
+ * `vlFiberSleep`, `vlFiberBlocking`, `vlFiberEventWait`) fall back to their
+ * thread-blocking equivalents when called outside of a fiber.
+ *
+ * \warning Fibers may migrate between threads at any suspension point. Thread
+ * local storage and thread-owned locks (such as `vl_mutex`) must not be held
+ * across a suspension point.
+ */
+typedef struct vl_fiber_scheduler_ vl_fiber_scheduler;
+
+/**
+ * \brief Manual-reset event that suspends waiting fibers instead of blocking
+ * their workers. Plain threads may wait on the same event.
+ */
+typedef struct vl_fiber_event_* vl_fiber_event;
+
+/**
+ * \brief Fiber entry point and blocking call signature.
+ */
+typedef void (*vl_fiber_proc)(void* user_data);
+
+/**
+ * \brief Construction parameters for a fiber scheduler.
+ *
+ * Obtain defaults with `vlFiberSchedulerConfigDefault` and override fields as
+ * needed.
+ */
+typedef struct
+{
+    vl_thread_pool* pool; /**< Pool to run fibers on, or NULL to create one. */
+    vl_uint_t workers; /**< Worker count of the created pool when `pool` is NULL. */
+    vl_thread_pool_priority priority; /**< Pool tier fiber resumptions are queued on. */
+    vl_memsize_t stack_size; /**< Usable stack bytes per fiber; rounded up to the page size. */
+    vl_bool_t guard_pages; /**< Place an inaccessible page below each POSIX stack to trap overflow. */
+    vl_uint_t blocking_workers; /**< Maximum threads servicing `vlFiberBlocking`. */
+} vl_fiber_scheduler_config;
+
+/**
+ * \brief Point-in-time scheduler statistics.
+ */
+typedef struct
+{
+    vl_ularge_t fibers_spawned; /**< Total fibers spawned. */
+    vl_ularge_t fibers_completed; /**< Total fibers that returned from their entry point. */
+    vl_ularge_t fibers_failed; /**< Fibers abandoned because the pool rejected a resumption. */
+    vl_uint_t fibers_live; /**< Fibers spawned but neither completed nor abandoned. */
+    vl_uint_t stacks_allocated; /**< Fiber descriptors (and stacks) ever created. */
+    vl_memsize_t stack_size; /**< Effective usable stack bytes per fiber, excluding guard pages. */
+} vl_fiber_scheduler_stats;
+
+/**
+ * \brief Fills a config with default values.
+ *
+ * Defaults: a private pool of 4 workers, MEDIUM priority, guarded
+ * `VL_FIBER_DEFAULT_STACK_SIZE` stacks, and up to 4 blocking threads.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns `config`.
+ * - **Lifetime**: N/A.
+ * - **Thread Safety**: Thread-safe.
+ * - **Nullability**: `config` must not be NULL.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing NULL.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param config config to initialize
+ */
+VL_API void vlFiberSchedulerConfigDefault(vl_fiber_scheduler_config* config);
+
+/**
+ * \brief Creates a fiber scheduler.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns the returned scheduler and must release it with `vlFiberSchedulerDelete`. A
+ * caller-supplied `pool` remains owned by the caller and must outlive the scheduler.
+ * - **Lifetime**: Valid until `vlFiberSchedulerDelete`.
+ * - **Thread Safety**: Thread-safe.
+ * - **Nullability**: Returns NULL on failure. `config` must not be NULL.
+ * - **Error Conditions**: Returns NULL if allocation fails, if a thread cannot be started, or if a caller-supplied
+ * pool is not running or its chosen tier is bounded (a fiber resumption must never be rejected or run inline).
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: Allocates the scheduler, its descriptor pool, a timer thread, the blocking
+ * pool and, when `pool` is NULL, a worker pool.
+ * - **Return-value Semantics**: Returns the new scheduler, or NULL.
+ *
+ * \param config scheduler parameters
+ * \return scheduler pointer, or NULL on failure
+ */
+VL_API vl_fiber_scheduler* vlFiberSchedulerNew(const vl_fiber_scheduler_config* config);
+
+/**
+ * \brief Deletes a fiber scheduler, releasing every pooled fiber stack.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the scheduler and everything it created. A caller-supplied pool is left running.
+ * - **Lifetime**: The scheduler is invalid after this call.
+ * - **Thread Safety**: Must not race with any other use of the scheduler.
+ * - **Nullability**: Safe to call with NULL.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Deleting a scheduler with live fibers, or calling from inside one of its fibers.
+ * - **Memory Allocation Expectations**: Frees all scheduler memory.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \sa vlFiberSchedulerWait
+ * \param scheduler scheduler to delete
+ */
+VL_API void vlFiberSchedulerDelete(vl_fiber_scheduler* scheduler);
+
+/**
+ * \brief Spawns a fiber that runs `proc(user_data)`.
+ *
+ * The fiber is queued immediately and begins running on the next available
+ * worker. A pooled descriptor and stack is reused when one is available.
+ *
+ * ## Contract
+ * - **Ownership**: `user_data` remains owned by the caller.
+ * - **Lifetime**: The fiber lives until `proc` returns.
+ * - **Thread Safety**: Thread-safe, including from inside a fiber.
+ * - **Nullability**: Returns VL_FALSE if `scheduler` or `proc` is NULL.
+ * - **Error Conditions**: Returns VL_FALSE if a new stack cannot be allocated or the pool rejects the fiber
+ * because it has been shut down.
+ * - **Undefined Behavior**: Spawning onto a scheduler that is being deleted.
+ * - **Memory Allocation Expectations**: Allocates a descriptor and stack only when none are pooled.
+ * - **Return-value Semantics**: VL_TRUE if the fiber was queued.
+ *
+ * \param scheduler scheduler pointer
+ * \param proc fiber entry point
+ * \param user_data argument passed to `proc`
+ * \return whether the fiber was spawned
+ */
+VL_API vl_bool_t vlFiberSpawn(vl_fiber_scheduler* scheduler, vl_fiber_proc proc, void* user_data);
+
+/**
+ * \brief Blocks the calling thread until every spawned fiber has completed.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: N/A.
+ * - **Thread Safety**: Thread-safe.
+ * - **Nullability**: Returns VL_FALSE if `scheduler` is NULL.
+ * - **Error Conditions**: Returns VL_FALSE on timeout.
+ * - **Undefined Behavior**: Calling from inside one of the scheduler's fibers.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: VL_TRUE once no fibers are live.
+ *
+ * \param scheduler scheduler pointer
+ * \param timeout_ms maximum wait in milliseconds, or 0 to wait indefinitely
+ * \return VL_TRUE if all fibers completed, VL_FALSE on timeout
+ */
+VL_API vl_bool_t vlFiberSchedulerWait(vl_fiber_scheduler* scheduler, vl_uint_t timeout_ms);
+
+/**
+ * \brief Captures a snapshot of scheduler statistics.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns `out_stats`.
+ * - **Lifetime**: N/A.
+ * - **Thread Safety**: Thread-safe; fields are read individually and may be mutually inconsistent under load.
+ * - **Nullability**: No-op if either argument is NULL.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param scheduler scheduler pointer
+ * \param out_stats receives the statistics
+ */
+VL_API void vlFiberSchedulerGetStats(vl_fiber_scheduler* scheduler, vl_fiber_scheduler_stats* out_stats);
+
+/**
+ * \brief Returns the scheduler of the calling fiber.
+ *
+ * \return scheduler pointer, or NULL when not called from a fiber
+ */
+VL_API vl_fiber_scheduler* vlFiberCurrentScheduler(void);
+
+/**
+ * \brief Suspends the calling fiber and requeues it behind other ready work.
+ *
+ * Outside of a fiber this yields the calling thread.
+ */
+VL_API void vlFiberYield(void);
+
+/**
+ * \brief Suspends the calling fiber for at least the specified duration.
+ *
+ * The worker is released while the fiber sleeps. Outside of a fiber this
+ * sleeps the calling thread.
+ *
+ * \param milliseconds minimum sleep duration
+ */
+VL_API void vlFiberSleep(vl_ularge_t milliseconds);
+
+/**
+ * \brief Runs a blocking call without holding a pool worker.
+ *
+ * The calling fiber is parked while `proc(user_data)` runs on the scheduler's
+ * blocking pool, and resumes once it returns. Outside of a fiber, `proc` is
+ * called directly.
+ *
+ * ## Contract
+ * - **Ownership**: `user_data` remains owned by the caller.
+ * - **Lifetime**: `proc` has returned when this function returns.
+ * - **Thread Safety**: Thread-safe.
+ * - **Nullability**: No-op if `proc` is NULL.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None beyond the blocking pool's queue nodes.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param proc blocking function to call
+ * \param user_data argument passed to `proc`
+ */
+VL_API void vlFiberBlocking(vl_fiber_proc proc, void* user_data);
+
+/**
+ * \brief Creates a fiber event in the unset state.
+ *
+ * \return event handle, or NULL on allocation failure
+ */
+VL_API vl_fiber_event vlFiberEventNew(void);
+
+/**
+ * \brief Deletes a fiber event.
+ *
+ * \warning Deleting an event that still has waiters results in undefined behavior.
+ * \param event event handle; NULL is a no-op
+ */
+VL_API void vlFiberEventDelete(vl_fiber_event event);
+
+/**
+ * \brief Sets the event, waking every fiber and thread waiting on it.
+ *
+ * The event stays set until `vlFiberEventReset`.
+ *
+ * \param event event handle
+ */
+VL_API void vlFiberEventSet(vl_fiber_event event);
+
+/**
+ * \brief Returns the event to the unset state.
+ *
+ * \param event event handle
+ */
+VL_API void vlFiberEventReset(vl_fiber_event event);
+
+/**
+ * \brief Returns whether the event is currently set.
+ *
+ * \param event event handle
+ * \return VL_TRUE if set
+ */
+VL_API vl_bool_t vlFiberEventIsSet(vl_fiber_event event);
+
+/**
+ * \brief Waits for the event to become set.
+ *
+ * A fiber is parked and its worker released; a plain thread blocks.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: The event must outlive the wait.
+ * - **Thread Safety**: Thread-safe.
+ * - **Nullability**: Returns VL_FALSE if `event` is NULL.
+ * - **Error Conditions**: Returns VL_FALSE on timeout.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: VL_TRUE if the event was set.
+ *
+ * \param event event handle
+ * \param timeout_ms maximum wait in milliseconds, or 0 to wait indefinitely
+ * \return VL_TRUE if the event was set, VL_FALSE on timeout
+ */
+VL_API vl_bool_t vlFiberEventWait(vl_fiber_event event, vl_uint_t timeout_ms);
+
+#endif // VL_FIBER_H
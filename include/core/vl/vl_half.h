@@ -64,35 +64,35 @@ typedef vl_uint16_t vl_half_t;
 #define VL_HALF_EXP_BIAS 15
 
 /* Signed zeros */
-#define VL_HALF_POS_ZERO ((vl_half)0x0000)
-#define VL_HALF_NEG_ZERO ((vl_half)0x8000)
+#define VL_HALF_POS_ZERO ((vl_half_t)0x0000)
+#define VL_HALF_NEG_ZERO ((vl_half_t)0x8000)
 
 /* Infinities */
-#define VL_HALF_POS_INF ((vl_half)0x7C00)
-#define VL_HALF_NEG_INF ((vl_half)0xFC00)
+#define VL_HALF_POS_INF ((vl_half_t)0x7C00)
+#define VL_HALF_NEG_INF ((vl_half_t)0xFC00)
 
 /* NaNs */
-#define VL_HALF_QNAN ((vl_half)0x7E00) /* canonical quiet NaN */
-#define VL_HALF_SNAN ((vl_half)0x7D00) /* signaling NaN (payload = 0) */
+#define VL_HALF_QNAN ((vl_half_t)0x7E00) /* canonical quiet NaN */
+#define VL_HALF_SNAN ((vl_half_t)0x7D00) /* signaling NaN (payload = 0) */
 
 /* Ones */
-#define VL_HALF_ONE ((vl_half)0x3C00) /*  1.0 */
-#define VL_HALF_NEG_ONE ((vl_half)0xBC00) /* -1.0 */
+#define VL_HALF_ONE ((vl_half_t)0x3C00) /*  1.0 */
+#define VL_HALF_NEG_ONE ((vl_half_t)0xBC00) /* -1.0 */
 
 /* Largest finite values */
-#define VL_HALF_MAX ((vl_half)0x7BFF) /* +65504 */
-#define VL_HALF_MIN ((vl_half)0xFBFF) /* -65504 */
+#define VL_HALF_MAX ((vl_half_t)0x7BFF) /* +65504 */
+#define VL_HALF_MIN ((vl_half_t)0xFBFF) /* -65504 */
 
 /* Smallest normal values */
-#define VL_HALF_MIN_POS ((vl_half)0x0400) /*  2^-14 */
-#define VL_HALF_MIN_NEG ((vl_half)0x8400)
+#define VL_HALF_MIN_POS ((vl_half_t)0x0400) /*  2^-14 */
+#define VL_HALF_MIN_NEG ((vl_half_t)0x8400)
 
 /* Smallest subnormal values */
-#define VL_HALF_TRUE_MIN_POS ((vl_half)0x0001) /* 2^-24 */
-#define VL_HALF_TRUE_MIN_NEG ((vl_half)0x8001)
+#define VL_HALF_TRUE_MIN_POS ((vl_half_t)0x0001) /* 2^-24 */
+#define VL_HALF_TRUE_MIN_NEG ((vl_half_t)0x8001)
 
 /* Difference between 1.0 and the next representable value */
-#define VL_HALF_EPSILON ((vl_half)0x1400) /* 2^-10 */
+#define VL_HALF_EPSILON ((vl_half_t)0x1400) /* 2^-10 */
 
 /*=============================================================================
  * Bit extraction helpers
@@ -173,9 +173,12 @@ static inline vl_half_t vlHalfPack(vl_uint16_t sign, vl_uint16_t exp, vl_uint16_
  * Rounding mode: round-to-nearest, ties-to-even.
  *
  * Special cases:
- *  - NaN propagates as a quiet NaN
+ *  - NaN propagates as a quiet NaN, keeping the top 9 bits of its payload
  *  - Overflow produces infinity
  *  - Underflow produces zero or a subnormal
+ *
+ * Results match the F16C `vcvtps2ph` instruction bit for bit, so scalar and
+ * vectorized conversions (vlSIMDConvertF32ToHalf) always agree.
  */
 static inline vl_half_t vlHalfFromFloat(float x)
 {
@@ -190,7 +193,7 @@ static inline vl_half_t vlHalfFromFloat(float x)
     {
         if (frac == 0)
             return vlHalfPack(sign, 31, 0);
-        return vlHalfPack(sign, 31, 1);
+        return vlHalfPack(sign, 31, (vl_uint16_t)(0x200 | (frac >> 13)));
     }
 
     vl_int32_t e = exp - 127;
@@ -200,12 +203,13 @@ static inline vl_half_t vlHalfFromFloat(float x)
 
     if (e < -14)
     {
-        if (e < -24)
+        /* Anything below 2^-25 is less than half the smallest subnormal. */
+        if (e < -25)
             return vlHalfPack(sign, 0, 0);
 
+        /* The subnormal fraction is the value in units of 2^-24: mant * 2^(e + 1). */
         vl_uint32_t mant = frac | 0x800000;
-        vl_uint32_t shift = (vl_uint32_t)(-e - 1);
-        vl_uint32_t rshift = shift + 13;
+        vl_uint32_t rshift = (vl_uint32_t)(-e - 1);
 
         vl_uint32_t frac16 = mant >> rshift;
         vl_uint32_t rem = mant & ((1u << rshift) - 1);
@@ -214,7 +218,8 @@ static inline vl_half_t vlHalfFromFloat(float x)
         if (rem > half || (rem == half && (frac16 & 1)))
             frac16++;
 
-        return vlHalfPack(sign, 0, frac16);
+        /* Rounding up to 0x400 carries into the exponent, giving the smallest normal. */
+        return (vl_half_t)((sign << 15) | frac16);
     }
 
     vl_uint32_t frac16 = frac >> 13;
@@ -240,6 +245,9 @@ static inline vl_half_t vlHalfFromFloat(float x)
 
 /**
  * \brief Converts a half-precision value to 32-bit float.
+ *
+ * The conversion is exact. Signaling NaNs are returned quiet, keeping their
+ * payload, which matches the F16C `vcvtph2ps` instruction.
  */
 static inline float vlHalfToFloat(vl_half_t h)
 {
@@ -269,7 +277,7 @@ static inline float vlHalfToFloat(vl_half_t h)
     }
     else if (exp == 31)
     {
-        value = (sign << 31) | (255 << 23) | (frac << 13);
+        value = (sign << 31) | (255 << 23) | (frac << 13) | (frac ? 0x400000u : 0u);
     }
     else
     {
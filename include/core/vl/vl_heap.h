@@ -0,0 +1,447 @@
+/**
+ * ██    ██ ██       █████  ███████  █████   ██████  ███    ██  █████
+ * ██    ██ ██      ██   ██ ██      ██   ██ ██       ████   ██ ██   ██
+ * ██    ██ ██      ███████ ███████ ███████ ██   ███ ██ ██  ██ ███████
+ *  ██  ██  ██      ██   ██      ██ ██   ██ ██    ██ ██  ██ ██ ██   ██
+ *   ████   ███████ ██   ██ ███████ ██   ██  ██████  ██   ████ ██   ██
+ * ====---: A Data Structure and Algorithms library for C11.  :---====
+ *
+ * Copyright 2026 Jesse Walker, released under the MIT license.
+ * Git Repository:  https://github.com/walkerje/veritable_lasagna
+ * \private
+ */
+
+#ifndef VL_HEAP_H
+#define VL_HEAP_H
+
+#include "vl_compare.h"
+#include "vl_memory.h"
+#include "vl_numtypes.h"
+
+/**
+ * \brief Number of children per node used when a heap is initialized with an arity of 0.
+ */
+#define VL_HEAP_DEFAULT_ARITY 4
+
+/**
+ * \brief Handle returned by a heap for an element that is not (or is no longer) in it.
+ */
+#define VL_HEAP_HANDLE_INVALID VL_STRUCTURE_INDEX_MAX
+
+/**
+ * \brief Stable name for an element stored in a vl_heap.
+ *
+ * Elements move between slots as the heap is reordered, but the handle issued
+ * when an element is pushed keeps referring to it until it is popped or
+ * removed. After that, the handle may be reissued to a later push.
+ */
+typedef vl_dsidx_t vl_heap_handle;
+
+/**
+ * \brief Contiguous d-ary heap, usable as a priority queue.
+ *
+ * Elements of a fixed size are kept in a single array in heap order, with the
+ * element that orders first under the heap's ordering at the root. Each node
+ * has `arity` children; the default of 4 halves the depth of a binary heap and
+ * keeps all children of a node within one or two cache lines, which makes
+ * pops cheaper than in a binary heap and far cheaper than removing the front
+ * of a vl_set.
+ *
+ * The ordering is either a `vl_compare_function` or a numeric key field,
+ * described by a `vl_numtype` and a byte offset within each element. Heaps
+ * initialized with vlHeapInitNumeric compare keys inline instead of calling
+ * through a function pointer.
+ *
+ * Every element has a vl_heap_handle through which it can be sampled, updated
+ * (e.g. decrease-key) or removed while it is in the heap.
+ *
+ * \sa vl_topk
+ */
+typedef struct
+{
+    vl_memory* elements;         // capacity + 1 element slots in heap order; the last slot is scratch space.
+    vl_heap_handle* handles;     // Handle of the element in each slot; slots past count hold free handles.
+    vl_dsidx_t* positions;       // Slot of the element named by each issued handle.
+    vl_memsize_t elementSize;
+    vl_dsidx_t count;
+    vl_dsidx_t capacity;
+    vl_dsidx_t handleCount;      // Number of handles issued so far; handles are reused once freed.
+    vl_dsidx_t arity;
+    vl_compare_function comparator;
+    vl_memsize_t keyOffset;
+    vl_numtype keyType;
+    vl_uint8_t keyKind;          // Private: typed comparison selected at init, or 0 to use the comparator.
+    vl_uint8_t arityShift;       // Private: log2(arity) if arity is a power of two, otherwise 0.
+} vl_heap;
+
+/**
+ * \brief Number of elements currently in a heap.
+ */
+#define vlHeapSize(heap) ((heap)->count)
+
+/**
+ * \brief Initializes a heap ordered by a comparator.
+ *
+ * The element for which `comparator` orders first is kept at the root, so an
+ * ascending comparator yields a min-heap and a descending one a max-heap.
+ *
+ * ## Contract
+ * - **Ownership**: The caller maintains ownership of the `heap` struct. The heap owns its element storage.
+ * - **Lifetime**: Valid until vlHeapFree.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` and `comparator` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: An `elementSize` of 0. Initializing a heap twice without freeing it (leaks memory).
+ * - **Memory Allocation Expectations**: None until the first push.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param heap heap to initialize
+ * \param elementSize size of each element, in bytes
+ * \param arity children per node, at least 2, or 0 for VL_HEAP_DEFAULT_ARITY
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \par Complexity of O(1) constant.
+ * \sa vlHeapFree
+ */
+VL_API void vlHeapInit(vl_heap* heap, vl_memsize_t elementSize, vl_dsidx_t arity, vl_compare_function comparator);
+
+/**
+ * \brief Initializes a min-heap ordered by a numeric key field.
+ *
+ * Keys are compared inline by their natural ordering, so the element with the
+ * smallest key is kept at the root. For a max-heap over numeric keys, use
+ * vlHeapInit with a reverse comparator such as vlCompareInt32Reverse.
+ *
+ * ## Contract
+ * - **Ownership**: As vlHeapInit.
+ * - **Lifetime**: Valid until vlHeapFree.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` without initializing the heap if `keyType` is out of range or the key
+ * does not fit within `elementSize` at `keyOffset`.
+ * - **Undefined Behavior**: Floating-point NaN keys.
+ * - **Memory Allocation Expectations**: None until the first push.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the heap is initialized.
+ *
+ * \param heap heap to initialize
+ * \param elementSize size of each element, in bytes
+ * \param arity children per node, at least 2, or 0 for VL_HEAP_DEFAULT_ARITY
+ * \param keyType numeric type of the key field
+ * \param keyOffset byte offset of the key within each element
+ * \return VL_TRUE on success
+ * \par Complexity of O(1) constant.
+ * \sa vlHeapFree
+ */
+VL_API vl_bool_t vlHeapInitNumeric(vl_heap* heap, vl_memsize_t elementSize, vl_dsidx_t arity, vl_numtype keyType,
+                                   vl_memsize_t keyOffset);
+
+/**
+ * \brief Frees the storage of a heap initialized with vlHeapInit or vlHeapInitNumeric.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the element and handle storage. Does NOT release the `heap` struct itself.
+ * - **Lifetime**: The heap is invalid until initialized again.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Double free.
+ * - **Memory Allocation Expectations**: Deallocates all storage owned by the heap.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param heap heap to free
+ * \par Complexity of O(1) constant.
+ * \sa vlHeapInit
+ */
+VL_API void vlHeapFree(vl_heap* heap);
+
+/**
+ * \brief Allocates and initializes a heap ordered by a comparator.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns the returned heap and must release it with vlHeapDelete.
+ * - **Lifetime**: Valid until vlHeapDelete.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `comparator` must not be `NULL`. Returns `NULL` if allocation fails.
+ * - **Error Conditions**: Returns `NULL` on allocation failure.
+ * - **Undefined Behavior**: As vlHeapInit.
+ * - **Memory Allocation Expectations**: Allocates the `vl_heap` struct.
+ * - **Return-value Semantics**: Returns a pointer to the new heap, or `NULL`.
+ *
+ * \param elementSize size of each element, in bytes
+ * \param arity children per node, at least 2, or 0 for VL_HEAP_DEFAULT_ARITY
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \return pointer to the new heap
+ * \par Complexity of O(1) constant.
+ * \sa vlHeapDelete
+ */
+VL_API vl_heap* vlHeapNew(vl_memsize_t elementSize, vl_dsidx_t arity, vl_compare_function comparator);
+
+/**
+ * \brief Frees a heap created by vlHeapNew, along with its storage.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the heap struct and all storage it owns.
+ * - **Lifetime**: The pointer is invalid afterwards.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: Safe to call with `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Double deletion, or deleting a heap that was not created by vlHeapNew.
+ * - **Memory Allocation Expectations**: Deallocates the heap and its storage.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param heap heap to delete
+ * \par Complexity of O(1) constant.
+ * \sa vlHeapNew
+ */
+VL_API void vlHeapDelete(vl_heap* heap);
+
+/**
+ * \brief Removes every element from a heap, keeping its storage.
+ *
+ * All handles issued so far become invalid.
+ *
+ * \param heap heap to clear
+ * \par Complexity of O(1) constant.
+ */
+VL_API void vlHeapClear(vl_heap* heap);
+
+/**
+ * \brief Ensures the heap can hold at least `numElements` elements without reallocating.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: Pointers returned by vlHeapPeek and vlHeapSample are invalidated if storage grows.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the heap unchanged if allocation fails.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: May reallocate element and handle storage.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if the heap has room for `numElements` elements.
+ *
+ * \param heap heap to reserve storage in
+ * \param numElements total number of elements to make room for
+ * \return VL_TRUE on success
+ * \par Complexity of O(n) linear if storage grows, O(1) otherwise.
+ */
+VL_API vl_bool_t vlHeapReserve(vl_heap* heap, vl_dsidx_t numElements);
+
+/**
+ * \brief Clones a heap, including its ordering and the handles of its elements.
+ *
+ * If `dest` is `NULL`, a new heap is allocated as by vlHeapNew. Otherwise
+ * `dest` must be an initialized heap, whose contents and ordering are replaced.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns a newly allocated `dest`, as with vlHeapNew.
+ * - **Lifetime**: The clone is independent of `src`.
+ * - **Thread Safety**: Not thread-safe if `src` is modified concurrently.
+ * - **Nullability**: `src` must not be `NULL`.
+ * - **Error Conditions**: Returns `NULL` if allocation fails. Cloning a heap onto itself is a no-op that returns
+ * `src`.
+ * - **Undefined Behavior**: An uninitialized, non-`NULL` `dest`.
+ * - **Memory Allocation Expectations**: Allocates storage for the clone.
+ * - **Return-value Semantics**: Returns `dest`, or the newly allocated heap.
+ *
+ * \param src heap to clone
+ * \param dest heap to overwrite, or `NULL`
+ * \return the clone, or `NULL` on failure
+ * \par Complexity of O(n) linear.
+ */
+VL_API vl_heap* vlHeapClone(const vl_heap* src, vl_heap* dest);
+
+/**
+ * \brief Inserts a copy of an element and returns its handle.
+ *
+ * ## Contract
+ * - **Ownership**: The element is copied into the heap.
+ * - **Lifetime**: The handle is valid until the element is popped or removed, or the heap is cleared or rebuilt.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` and `element` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_HEAP_HANDLE_INVALID` and leaves the heap unchanged if storage cannot grow.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: Doubles the storage when full.
+ * - **Return-value Semantics**: Returns the handle of the inserted element.
+ *
+ * \param heap heap to insert into
+ * \param element element to copy
+ * \return handle of the new element
+ * \par Complexity of O(log(n)) worst case, O(1) expected for random input.
+ */
+VL_API vl_heap_handle vlHeapPush(vl_heap* heap, const void* element);
+
+/**
+ * \brief Inserts copies of every element in an array.
+ *
+ * When the batch is at least as large as the heap, the elements are appended
+ * and the whole heap is rebuilt bottom-up, which is cheaper than pushing them
+ * one at a time.
+ *
+ * ## Contract
+ * - **Ownership**: Elements are copied into the heap.
+ * - **Lifetime**: As vlHeapPush.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`. `elements` may be `NULL` only if `numElements` is 0. `handles` may be
+ * `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the heap unchanged if storage cannot grow.
+ * - **Undefined Behavior**: A `handles` array shorter than `numElements`.
+ * - **Memory Allocation Expectations**: Grows storage once to fit the batch.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once every element is inserted. If `handles` is not `NULL`, it
+ * receives the handle of each element, in input order.
+ *
+ * \param heap heap to insert into
+ * \param elements array of elements to copy
+ * \param numElements number of elements
+ * \param handles optional array receiving the handle of each element
+ * \return VL_TRUE on success
+ * \par Complexity of O(n + k) when rebuilding, otherwise O(k log(n)) worst case, for k elements.
+ */
+VL_API vl_bool_t vlHeapPushArray(vl_heap* heap, const void* elements, vl_dsidx_t numElements,
+                                 vl_heap_handle* handles);
+
+/**
+ * \brief Replaces the contents of a heap with an array, building heap order in linear time.
+ *
+ * Previously issued handles become invalid. The element at index `i` of the
+ * array is given handle `i`.
+ *
+ * ## Contract
+ * - **Ownership**: Elements are copied into the heap.
+ * - **Lifetime**: As vlHeapPush.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`. `elements` may be `NULL` only if `numElements` is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the heap unchanged if storage cannot grow.
+ * - **Undefined Behavior**: `elements` pointing into the heap's own storage.
+ * - **Memory Allocation Expectations**: Grows storage to fit the array.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the heap holds exactly the given elements.
+ *
+ * \param heap heap to rebuild
+ * \param elements array of elements to copy
+ * \param numElements number of elements
+ * \return VL_TRUE on success
+ * \par Complexity of O(n) linear.
+ */
+VL_API vl_bool_t vlHeapBuild(vl_heap* heap, const void* elements, vl_dsidx_t numElements);
+
+/**
+ * \brief Returns a pointer to the element at the root of the heap, or `NULL` if it is empty.
+ *
+ * The element must not be modified in a way that changes its ordering unless
+ * vlHeapUpdate is called for it afterwards.
+ *
+ * \param heap heap to inspect
+ * \return pointer to the root element, or `NULL`
+ * \par Complexity of O(1) constant.
+ */
+VL_API void* vlHeapPeek(const vl_heap* heap);
+
+/**
+ * \brief Returns the handle of the element at the root of the heap, or `VL_HEAP_HANDLE_INVALID` if it is empty.
+ *
+ * \param heap heap to inspect
+ * \return handle of the root element
+ * \par Complexity of O(1) constant.
+ */
+VL_API vl_heap_handle vlHeapPeekHandle(const vl_heap* heap);
+
+/**
+ * \brief Removes the element at the root of the heap, copying it out.
+ *
+ * ## Contract
+ * - **Ownership**: The element is copied to `dest`, if given.
+ * - **Lifetime**: The handle of the popped element becomes free for reuse.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`. `dest` may be `NULL` to discard the element.
+ * - **Error Conditions**: Returns `VL_HEAP_HANDLE_INVALID` and leaves `dest` untouched if the heap is empty.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the handle the popped element had.
+ *
+ * \param heap heap to pop from
+ * \param dest destination for the element, or `NULL`
+ * \return handle of the popped element
+ * \par Complexity of O(log(n)) logarithmic.
+ */
+VL_API vl_heap_handle vlHeapPop(vl_heap* heap, void* dest);
+
+/**
+ * \brief Pops up to `numElements` elements, writing them to `dest` in order.
+ *
+ * \param heap heap to pop from
+ * \param dest array receiving the elements, or `NULL` to discard them
+ * \param numElements maximum number of elements to pop
+ * \return number of elements popped
+ * \par Complexity of O(k log(n)) for k elements.
+ * \sa vlHeapPop
+ */
+VL_API vl_dsidx_t vlHeapPopArray(vl_heap* heap, void* dest, vl_dsidx_t numElements);
+
+/**
+ * \brief Returns `VL_TRUE` if a handle names an element currently in the heap.
+ *
+ * A handle that was freed and then reissued to a later push names the new element.
+ *
+ * \param heap heap to inspect
+ * \param handle handle to test
+ * \return VL_TRUE if the handle is live
+ * \par Complexity of O(1) constant.
+ */
+VL_API vl_bool_t vlHeapContains(const vl_heap* heap, vl_heap_handle handle);
+
+/**
+ * \brief Returns a pointer to the element named by a handle.
+ *
+ * The pointer is valid until the heap is next modified.
+ *
+ * \param heap heap to sample
+ * \param handle live handle
+ * \return pointer to the element
+ * \par Complexity of O(1) constant.
+ */
+VL_API void* vlHeapSample(const vl_heap* heap, vl_heap_handle handle);
+
+/**
+ * \brief Replaces the element named by a handle and restores heap order.
+ *
+ * This covers decrease-key as well as any other change to an element's
+ * ordering. If `element` is `NULL`, the element is assumed to have been
+ * modified in place through vlHeapSample, and only its position is restored.
+ *
+ * ## Contract
+ * - **Ownership**: The element is copied into the heap.
+ * - **Lifetime**: The handle stays valid.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`. `element` may be `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the heap unchanged if the handle is not live.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the element is in place.
+ *
+ * \param heap heap containing the element
+ * \param handle live handle of the element
+ * \param element new value of the element, or `NULL`
+ * \return VL_TRUE on success
+ * \par Complexity of O(log(n)) logarithmic.
+ */
+VL_API vl_bool_t vlHeapUpdate(vl_heap* heap, vl_heap_handle handle, const void* element);
+
+/**
+ * \brief Removes the element named by a handle, copying it out.
+ *
+ * ## Contract
+ * - **Ownership**: The element is copied to `dest`, if given.
+ * - **Lifetime**: The handle becomes free for reuse.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `heap` must not be `NULL`. `dest` may be `NULL` to discard the element.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the heap unchanged if the handle is not live.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the element is removed.
+ *
+ * \param heap heap containing the element
+ * \param handle live handle of the element
+ * \param dest destination for the element, or `NULL`
+ * \return VL_TRUE on success
+ * \par Complexity of O(log(n)) logarithmic.
+ */
+VL_API vl_bool_t vlHeapRemove(vl_heap* heap, vl_heap_handle handle, void* dest);
+
+#endif // VL_HEAP_H
@@ -548,34 +548,101 @@ VL_API vl_uint_t vlMemAlignment(vl_memory* mem);
  * \brief Sorts the specified buffer in-place according to the specified element
  * and comparator function.
  *
- * This function implements an iterative Quicksort.
+ * This function implements a pattern-defeating quicksort: median-of-3 pivots
+ * (Tukey's ninther on large partitions), insertion sort for small partitions,
+ * and a heapsort fallback once too many unbalanced partitions are seen. Sorted,
+ * reversed, and few-unique inputs finish in near-linear time. Elements of 4, 8,
+ * and 16 bytes are swapped with fixed-width moves. The sort is not stable.
  *
  * ## Contract
  * - **Ownership**: Does not transfer or affect ownership of the `buffer`.
  * - **Lifetime**: The `buffer` must remain valid for the duration of the sort.
  * - **Thread Safety**: Not thread-safe if multiple threads access the same `buffer` concurrently.
  * - **Nullability**: `buffer` must not be `NULL`. `comparator` must not be `NULL`.
- * - **Error Conditions**: If internal temporary memory allocation fails, the function returns without sorting the
- * buffer.
+ * - **Error Conditions**: Elements larger than 64 bytes need heap scratch space; if that allocation fails, the
+ * function returns without sorting the buffer.
  * - **Undefined Behavior**: Passing a `NULL` `buffer` or `comparator`. Overlapping memory regions during sort
  * operations.
- * - **Memory Allocation Expectations**: Allocates temporary scratch space on the heap proportional to `numElements` and
- * `elementSize`.
+ * - **Memory Allocation Expectations**: Allocates two elements of scratch space on the heap when `elementSize`
+ * exceeds 64 bytes; otherwise none.
  * - **Return-value Semantics**: None (void).
  *
  * \param buffer
  * \param elementSize
  * \param numElements
  * \param comparator
- * \par Complexity of O(n log(n)) (space complexity of O(n)).
+ * \par Complexity of O(n log(n)) worst case (space complexity of O(log(n))).
  */
 VL_API void vlMemSort(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_compare_function comparator);
 
+/**
+ * \brief Reorders the buffer so the element at index `nth` is the one a full sort would place there.
+ *
+ * Every element before `nth` orders no later than it, and every element after
+ * no earlier; neither side is otherwise sorted. This is introselect: vlMemSort's
+ * pivots and partitions, continuing only into the side that holds `nth`, with
+ * a heapsort fallback once too many unbalanced partitions are seen. Use it for
+ * medians and percentiles without paying for a full sort.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of the `buffer`.
+ * - **Lifetime**: The `buffer` must remain valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `buffer` concurrently.
+ * - **Nullability**: `buffer` must not be `NULL`. `comparator` must not be `NULL`.
+ * - **Error Conditions**: Returns without modifying the buffer if `nth` is not less than `numElements`, or if heap
+ * scratch space is needed and cannot be allocated.
+ * - **Undefined Behavior**: A comparator that is not a strict weak ordering.
+ * - **Memory Allocation Expectations**: As vlMemSort.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param buffer array to reorder
+ * \param elementSize size of each element, in bytes
+ * \param numElements number of elements
+ * \param nth index whose element should be placed
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \par Complexity of O(n) expected, O(n log(n)) worst case (space complexity of O(1)).
+ * \sa vlMemSort, vlMemPartialSort
+ */
+VL_API void vlMemSelect(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_dsidx_t nth,
+                        vl_compare_function comparator);
+
+/**
+ * \brief Sorts the `count` smallest elements of the buffer into its first `count` slots.
+ *
+ * The remaining elements are left after them in unspecified order. The last
+ * element of the prefix is placed with vlMemSelect and the elements before it
+ * are then sorted, so the cost is that of a selection plus a sort of `count`
+ * elements. A `count` of at least `numElements` sorts the whole buffer.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of the `buffer`.
+ * - **Lifetime**: The `buffer` must remain valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `buffer` concurrently.
+ * - **Nullability**: `buffer` must not be `NULL`. `comparator` must not be `NULL`.
+ * - **Error Conditions**: As vlMemSort. A `count` of 0 leaves the buffer untouched.
+ * - **Undefined Behavior**: A comparator that is not a strict weak ordering.
+ * - **Memory Allocation Expectations**: As vlMemSort.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param buffer array to reorder
+ * \param elementSize size of each element, in bytes
+ * \param numElements number of elements
+ * \param count length of the sorted prefix
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \par Complexity of O(n + k log(k)) expected for a prefix of k elements (space complexity of O(log(k))).
+ * \sa vlMemSelect, vlTopKInit
+ */
+VL_API void vlMemPartialSort(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_dsidx_t count,
+                             vl_compare_function comparator);
+
 /**
  * \brief Copies data from one buffer to another, with a stride applied to both.
  *
  * Stride is the amount of space (in bytes) between each element.
  *
+ * Elements of 1, 2, 4, 8 and 16 bytes are copied with fixed-size loads and stores. Packed destinations of 4- and
+ * 8-byte elements are filled with the SIMD gathers (`vlSIMDGather32`, `vlSIMDGather64`).
+ *
  * ## Contract
  * - **Ownership**: Does not transfer or affect ownership of the buffers.
  * - **Lifetime**: Both `src` and `dest` buffers must remain valid for the duration of the copy.
@@ -629,6 +696,10 @@ VL_API void vlMemCopyStride(const void* src, vl_dsoffs_t srcStride, void* dest,
  * The bytes within each element are reversed, but the stride between elements
  * is respected.
  *
+ * Elements of 2, 4 and 8 bytes are swapped as whole integers. When they are also
+ * packed and aligned to their size, the SIMD byte swaps (`vlSIMDByteSwapU32` and
+ * siblings) handle the whole array.
+ *
  * ## Contract
  * - **Ownership**: Does not transfer or affect ownership of `src`.
  * - **Lifetime**: The `src` buffer must remain valid for the duration of the operation.
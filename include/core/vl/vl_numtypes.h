@@ -244,6 +244,44 @@ static inline void vlNumTypeCast(const void* src, vl_numtype srcType, void* dst,
     VL_NUMTYPE_INFO[srcType].typeConverters[dstType](src, dst);
 }
 
+/**
+ * \brief Converts an array of values from one numeric type to another.
+ *
+ * Applies the same cast as vlNumTypeCast to each of `count` elements, without
+ * an indirect call per element. Strides are measured in bytes from the start
+ * of one element to the start of the next, as in vlMemCopyStride, so this can
+ * read or write one field of an array of structures. A stride of 0 means the
+ * array is tightly packed.
+ *
+ * Packed arrays of the common pairs (I32, I16 and U8 to F32, F32 to I32, F32
+ * to and from F64, I16 to and from I32) run on the vl_simd conversion kernels.
+ * Same-type copies and same-width integer pairs, whose cast does not change
+ * the bits, are copied with vlMemCopyStride.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of either array.
+ * - **Lifetime**: Both arrays must remain valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe if another thread writes `src` or accesses `dst` concurrently.
+ * - **Nullability**: `src` and `dst` must not be `NULL` unless `count` is 0.
+ * - **Error Conditions**: None. A `count` of 0 does nothing.
+ * - **Undefined Behavior**: Overlapping arrays; elements or strides that break the alignment of their types;
+ * floating-point values outside the range of an integer destination type, as with the C cast.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param src Pointer to the first source element
+ * \param srcType Source numeric type
+ * \param srcStride Bytes between source elements, or 0 if packed
+ * \param dst Pointer to the first destination element
+ * \param dstType Destination numeric type
+ * \param dstStride Bytes between destination elements, or 0 if packed
+ * \param count Number of elements to convert
+ * \par Complexity of O(n) linear.
+ * \sa vlNumTypeCast, vlMemCopyStride
+ */
+VL_API void vlNumTypeCastArray(const void* src, vl_numtype srcType, vl_dsoffs_t srcStride, void* dst,
+                               vl_numtype dstType, vl_dsoffs_t dstStride, vl_dsidx_t count);
+
 static inline vl_uint16_t vlNumTypeSizeof(vl_numtype type) { return VL_NUMTYPE_INFO[type].size; }
 
 #endif // VL_NUMTYPES_H
@@ -14,27 +14,22 @@
 #ifndef VL_QUEUE_H
 #define VL_QUEUE_H
 
-#include "vl_pool.h"
+#include "vl_deque.h"
 
 /**
  * \brief First in, first out queue.
  *
- * The Queue data structure is a simplified forward-facing linked list.
- * It is implemented on top of a pool allocator, and thus requires all elements
- * in the queue to be the same size.
+ * The Queue data structure is a vl_deque restricted to pushing at the back and
+ * popping from the front. Elements are stored contiguously in a growable,
+ * power-of-two ring buffer, and thus must all be the same size.
  *
- * Items may be added to the end and removed from the beginning.
- * Just like the vl_deque data structure, direct sampling is also disallowed.
- * Thus, all IO requires a copy.
+ * Elements may be pushed and popped one at a time or in bulk, and any element
+ * may be sampled by its position from the front.
  * \sa vl_deque
  */
 typedef struct
 {
-    vl_pool nodes; // pool nodes
-    vl_dsidx_t totalElements; // total elements in the queue.
-    vl_uint16_t elementSize; // size of a single element, in bytes.
-    vl_pool_idx head; // first element
-    vl_pool_idx tail; // last element
+    vl_deque ring; // ring buffer holding the elements, front first.
 } vl_queue;
 
 /**
@@ -43,15 +38,14 @@ typedef struct
  * The queue should then later be de-initialized via vlQueueFree.
  *
  * ## Contract
- * - **Ownership**: The caller maintains ownership of the `queue` struct. The function initializes the internal node
- * pool.
+ * - **Ownership**: The caller maintains ownership of the `queue` struct.
  * - **Lifetime**: The queue is valid until `vlQueueFree` or `vlQueueDelete`.
  * - **Thread Safety**: Not thread-safe. Concurrent access must be synchronized.
  * - **Nullability**: `queue` must not be `NULL`.
  * - **Error Conditions**: None.
  * - **Undefined Behavior**: Passing an already initialized queue without first calling `vlQueueFree` (causes memory
  * leak).
- * - **Memory Allocation Expectations**: Initializes an internal `vl_pool` which allocates management structures.
+ * - **Memory Allocation Expectations**: None. The ring buffer is allocated on the first push or reservation.
  * - **Return-value Semantics**: None (void).
  *
  * \sa vlQueueFree
@@ -67,13 +61,13 @@ VL_API void vlQueueInit(vl_queue* queue, vl_uint16_t elementSize);
  * The queue should have been initialized via vlQueueInit.
  *
  * ## Contract
- * - **Ownership**: Releases ownership of the internal node pool. Does NOT release the `queue` struct itself.
+ * - **Ownership**: Releases ownership of the ring buffer. Does NOT release the `queue` struct itself.
  * - **Lifetime**: The queue becomes invalid for use.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `queue` must not be `NULL`.
  * - **Error Conditions**: None.
  * - **Undefined Behavior**: Double free.
- * - **Memory Allocation Expectations**: Deallocates internal pool structures.
+ * - **Memory Allocation Expectations**: Deallocates the ring buffer.
  * - **Return-value Semantics**: None (void).
  *
  * \sa vlQueueFree
@@ -94,7 +88,7 @@ VL_API void vlQueueFree(vl_queue* queue);
  * - **Nullability**: Returns `NULL` if heap allocation for the queue struct fails.
  * - **Error Conditions**: Returns `NULL` on allocation failure.
  * - **Undefined Behavior**: None.
- * - **Memory Allocation Expectations**: Allocates memory for the `vl_queue` struct and its internal node pool.
+ * - **Memory Allocation Expectations**: Allocates memory for the `vl_queue` struct.
  * - **Return-value Semantics**: Returns a pointer to the newly allocated and initialized queue, or `NULL`.
  *
  * \sa vlQueueDelete
@@ -110,7 +104,7 @@ VL_API vl_queue* vlQueueNew(vl_uint16_t elementSize);
  * The queue should have been initialized via vlQueueNew.
  *
  * ## Contract
- * - **Ownership**: Releases ownership of the internal node pool and the `vl_queue` struct.
+ * - **Ownership**: Releases ownership of the ring buffer and the `vl_queue` struct.
  * - **Lifetime**: The queue pointer becomes invalid.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: Safe to call if `queue` is `NULL`.
@@ -144,9 +138,9 @@ VL_API void vlQueueDelete(vl_queue* queue);
  * - **Lifetime**: The cloned queue is valid until deleted or freed.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `src` must not be `NULL`. `dest` can be `NULL`.
- * - **Error Conditions**: Returns `NULL` if allocation fails.
+ * - **Error Conditions**: Returns `NULL` if allocation fails; a queue created by this call is deleted first.
  * - **Undefined Behavior**: Passing an uninitialized queue.
- * - **Memory Allocation Expectations**: May allocate a new queue struct and multiple nodes.
+ * - **Memory Allocation Expectations**: May allocate a new queue struct, and a ring buffer of the source's capacity.
  * - **Return-value Semantics**: Returns the pointer to the cloned queue, or `NULL` on failure.
  *
  * \param src pointer
@@ -159,9 +153,8 @@ VL_API vl_queue* vlQueueClone(const vl_queue* src, vl_queue* dest);
  * \brief Reserves space for n-many elements in the underlying buffer of the
  * specified queue.
  *
- * This is done by doubling the size until the requested growth is met or
- * exceeded. This function will always result in the reallocation of the
- * underlying memory.
+ * This is done by doubling the capacity until the requested growth is met or
+ * exceeded. Nothing is reallocated if the capacity is already sufficient.
  *
  * ## Contract
  * - **Ownership**: Unchanged.
@@ -170,7 +163,7 @@ VL_API vl_queue* vlQueueClone(const vl_queue* src, vl_queue* dest);
  * - **Nullability**: `queue` must not be `NULL`.
  * - **Error Conditions**: None checked.
  * - **Undefined Behavior**: Passing an uninitialized queue.
- * - **Memory Allocation Expectations**: Triggers expansion of the underlying node pool.
+ * - **Memory Allocation Expectations**: May grow the ring buffer.
  * - **Return-value Semantics**: None (void).
  *
  * \param queue pointer
@@ -182,7 +175,7 @@ VL_API void vlQueueReserve(vl_queue* queue, vl_dsidx_t n);
  * \brief Clears the specified queue.
  *
  * The underlying data in the queue is untouched, but rather some book-keeping
- * variables are reset.
+ * variables are reset. The ring buffer is kept for reuse.
  *
  * ## Contract
  * - **Ownership**: Unchanged.
@@ -209,14 +202,14 @@ VL_API void vlQueueClear(vl_queue* queue);
  * - **Lifetime**: Valid until the element is popped.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `queue` must not be `NULL`. `element` must not be `NULL`.
- * - **Error Conditions**: None checked (internal node allocation failure is not currently handled).
+ * - **Error Conditions**: The element is not pushed if the ring buffer cannot grow.
  * - **Undefined Behavior**: Passing a `NULL` element or an uninitialized queue.
- * - **Memory Allocation Expectations**: May trigger expansion of the underlying node pool.
+ * - **Memory Allocation Expectations**: Doubles the ring buffer when it is full.
  * - **Return-value Semantics**: None (void).
  *
  * \param queue pointer
  * \param element data pointer
- * \par Complexity of O(1) constant.
+ * \par Complexity of O(1) amortized.
  */
 VL_API void vlQueuePushBack(vl_queue* queue, const void* element);
 
@@ -226,8 +219,7 @@ VL_API void vlQueuePushBack(vl_queue* queue, const void* element);
  * This is a no-op if the queue is empty.
  *
  * ## Contract
- * - **Ownership**: Transfers ownership of the element slot back to the internal pool. The caller owns the data copied
- * into `element`.
+ * - **Ownership**: The caller owns the data copied into `element`.
  * - **Lifetime**: The popped element's storage in the queue becomes invalid.
  * - **Thread Safety**: Not thread-safe.
  * - **Nullability**: `queue` must not be `NULL`. `element` can be `NULL` to just discard the front element.
@@ -260,6 +252,40 @@ VL_API int vlQueuePopFront(vl_queue* queue, void* element);
  * \par Complexity of O(1) constant.
  * \return size of the queue
  */
-static inline vl_dsidx_t vlQueueSize(vl_queue* queue) { return queue->totalElements; }
+static inline vl_dsidx_t vlQueueSize(vl_queue* queue) { return queue->ring.totalElements; }
+
+/**
+ * \brief Returns a pointer to the element at the specified position from the front.
+ *
+ * \param queue pointer
+ * \param index position of the element; 0 is the next element to be popped
+ * \par Complexity of O(1) constant.
+ * \return pointer to the element, valid until it is popped or a push grows the queue
+ * \sa vlDequeSample
+ */
+static inline void* vlQueueSample(vl_queue* queue, vl_dsidx_t index) { return vlDequeSample(&queue->ring, index); }
+
+/**
+ * \brief Copies an array of elements to the end of the queue, in order.
+ *
+ * \param queue pointer
+ * \param elements array of `n` elements
+ * \param n number of elements to push
+ * \par Complexity of O(n) linear, with at most two memcpy calls when no growth is needed.
+ * \sa vlDequePushBackN
+ */
+VL_API void vlQueuePushBackN(vl_queue* queue, const void* elements, vl_dsidx_t n);
+
+/**
+ * \brief Copies up to `n` elements from the front of the queue, in order, and removes them.
+ *
+ * \param queue pointer
+ * \param elements destination array with room for `n` elements, or NULL to discard them
+ * \param n maximum number of elements to pop
+ * \par Complexity of O(n) linear, with at most two memcpy calls.
+ * \return number of elements popped
+ * \sa vlDequePopFrontN
+ */
+VL_API vl_dsidx_t vlQueuePopFrontN(vl_queue* queue, void* elements, vl_dsidx_t n);
 
 #endif // VL_QUEUE_H
@@ -389,4 +389,479 @@ VL_API void vlRandFx2(vl_rand* randPtr, vl_float32_t* resultPtr);
  */
 VL_API vl_float64_t vlRandD(vl_rand* randPtr);
 
+/**
+ * \brief Generates an unbiased random integer in `[0, bound)`.
+ *
+ * Uses Lemire's multiply-and-reject method: one multiplication per value,
+ * and a division only in the rare case that a rejection check is needed.
+ * Unlike `vlRandUInt32(rand) % bound`, every value is exactly equally likely.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`.
+ * - **Error Conditions**: Returns 0 if `bound` is 0.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Integer in `[0, bound)`.
+ *
+ * \param rand pointer to random state
+ * \param bound exclusive upper bound
+ * \par Complexity of O(1) expected.
+ * \return random integer
+ */
+VL_API vl_uint32_t vlRandBoundedU32(vl_rand* rand, vl_uint32_t bound);
+
+/**
+ * \brief Generates an unbiased random 64-bit integer in `[0, bound)`.
+ *
+ * As vlRandBoundedU32, using a 64x64-bit multiplication.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`.
+ * - **Error Conditions**: Returns 0 if `bound` is 0.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Integer in `[0, bound)`.
+ *
+ * \param rand pointer to random state
+ * \param bound exclusive upper bound
+ * \par Complexity of O(1) expected.
+ * \return random integer
+ */
+VL_API vl_uint64_t vlRandBoundedU64(vl_rand* rand, vl_uint64_t bound);
+
+/**
+ * \brief Fills an array with unbiased random integers in `[0, bound)`.
+ *
+ * Draws two 32-bit candidates from each step of the generator, so it needs
+ * about half as many steps as calling vlRandBoundedU32 in a loop.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `dst` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: Writes zeros if `bound` is 0.
+ * - **Undefined Behavior**: `dst` holds fewer than `count` elements.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand pointer to random state
+ * \param dst destination array
+ * \param count number of integers
+ * \param bound exclusive upper bound
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandBoundedFillU32(vl_rand* rand, vl_uint32_t* dst, vl_dsidx_t count, vl_uint32_t bound);
+
+/**
+ * \brief Generates a standard normal (mean 0, standard deviation 1) sample.
+ *
+ * Uses a 128-layer ziggurat. About 99% of samples cost one generator step,
+ * one table lookup and one multiplication; only the rest call `exp` or `log`.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Normally distributed sample.
+ *
+ * \param rand pointer to random state
+ * \par Complexity of O(1) expected.
+ * \return random sample
+ */
+VL_API vl_float64_t vlRandNormal(vl_rand* rand);
+
+/**
+ * \brief Fills an array with normal samples of the given mean and standard deviation.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `dst` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `dst` holds fewer than `count` elements.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand pointer to random state
+ * \param dst destination array
+ * \param count number of samples
+ * \param mean mean of the distribution
+ * \param stddev standard deviation of the distribution
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandNormalFill(vl_rand* rand, vl_float64_t* dst, vl_dsidx_t count, vl_float64_t mean,
+                             vl_float64_t stddev);
+
+/**
+ * \brief Generates an exponential sample with rate 1 (mean 1).
+ *
+ * Uses a 256-layer ziggurat; see vlRandNormal.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Non-negative sample.
+ *
+ * \param rand pointer to random state
+ * \par Complexity of O(1) expected.
+ * \return random sample
+ */
+VL_API vl_float64_t vlRandExponential(vl_rand* rand);
+
+/**
+ * \brief Fills an array with exponential samples of the given rate.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `dst` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `rate` is not positive; `dst` holds fewer than `count` elements.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand pointer to random state
+ * \param dst destination array
+ * \param count number of samples
+ * \param rate rate of the distribution (the inverse of its mean)
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandExponentialFill(vl_rand* rand, vl_float64_t* dst, vl_dsidx_t count, vl_float64_t rate);
+
+/**
+ * \brief Shuffles an array in place (Fisher-Yates).
+ *
+ * Every permutation is equally likely, up to the quality of the generator.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand` or `data`.
+ * - **Nullability**: `rand` must not be `NULL`; `data` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `data` holds fewer than `count` elements.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand pointer to random state
+ * \param data array to shuffle
+ * \param elementSize size of each element in bytes
+ * \param count number of elements
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandShuffle(vl_rand* rand, void* data, vl_memsize_t elementSize, vl_dsidx_t count);
+
+/**
+ * \brief Copies a uniform random sample of `k` elements out of `count` (reservoir sampling).
+ *
+ * Uses Li's Algorithm L, which skips ahead geometrically instead of drawing
+ * a random number per element, so it costs about `k * (1 + log(count / k))`
+ * draws. Every subset of size `k` is equally likely. The order of the
+ * sample in `dst` is unspecified.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `src` and `dst` may be `NULL` only if the result is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `src` and `dst` overlap; `dst` holds fewer than `k` elements.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Number of elements written, `k` or `count` if smaller.
+ *
+ * \param rand pointer to random state
+ * \param src source array
+ * \param elementSize size of each element in bytes
+ * \param count number of source elements
+ * \param dst destination for the sample
+ * \param k number of elements to sample
+ * \par Complexity of O(k * (1 + log(count / k))) expected.
+ * \return number of elements written
+ */
+VL_API vl_dsidx_t vlRandReservoir(vl_rand* rand, const void* src, vl_memsize_t elementSize, vl_dsidx_t count,
+                                  void* dst, vl_dsidx_t k);
+
+/**
+ * \brief Alias table for sampling indices with given weights in O(1).
+ *
+ * Built once from a weight array (Vose's method); each sample then costs a
+ * bounded integer and one comparison, regardless of the number of weights.
+ *
+ * \sa vlRandAliasInit, vlRandAliasSample
+ */
+typedef struct vl_rand_alias_
+{
+    vl_dsidx_t count; /**< Number of weights. */
+    vl_uint64_t* threshold; /**< Per-column chance of keeping the column over its alias, scaled to 2^53. */
+    vl_dsidx_t* alias; /**< Per-column fallback index. */
+} vl_rand_alias;
+
+/**
+ * \brief Builds an alias table from non-negative weights.
+ *
+ * Weights need not be normalized. Indices with weight 0 are never sampled.
+ *
+ * ## Contract
+ * - **Ownership**: On success, the table owns its storage until vlRandAliasFree. `weights` is only read.
+ * - **Lifetime**: `weights` may be freed once this returns.
+ * - **Thread Safety**: Not thread-safe for the same `table`.
+ * - **Nullability**: `table` must not be `NULL`; `weights` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the table empty if `count` is 0, any weight is negative
+ * or not finite, the weights sum to 0, or allocation fails.
+ * - **Undefined Behavior**: `weights` holds fewer than `count` elements.
+ * - **Memory Allocation Expectations**: Allocates one block of `count` thresholds and aliases.
+ * - **Return-value Semantics**: `VL_TRUE` if the table can be sampled.
+ *
+ * \param table table to initialize
+ * \param weights array of weights
+ * \param count number of weights
+ * \par Complexity of O(n) linear.
+ * \return whether the table was built
+ */
+VL_API vl_bool_t vlRandAliasInit(vl_rand_alias* table, const vl_float64_t* weights, vl_dsidx_t count);
+
+/**
+ * \brief Releases the storage of an alias table.
+ *
+ * Safe to call on a table whose vlRandAliasInit failed.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the storage owned by `table`.
+ * - **Lifetime**: `table` must be initialized again before further use.
+ * - **Thread Safety**: Not thread-safe for the same `table`.
+ * - **Nullability**: `table` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Double free without re-initialization.
+ * - **Memory Allocation Expectations**: Frees the table's block.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param table table to free
+ * \par Complexity of O(1) constant.
+ */
+VL_API void vlRandAliasFree(vl_rand_alias* table);
+
+/**
+ * \brief Samples an index with probability proportional to its weight.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Safe for concurrent use of the same `table` with different `rand` states.
+ * - **Nullability**: Neither pointer may be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `table` was not successfully initialized.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Index in `[0, table->count)`.
+ *
+ * \param table alias table
+ * \param rand pointer to random state
+ * \par Complexity of O(1) expected.
+ * \return sampled index
+ */
+VL_API vl_dsidx_t vlRandAliasSample(const vl_rand_alias* table, vl_rand* rand);
+
+/**
+ * \brief Fills an array with indices sampled from an alias table.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Safe for concurrent use of the same `table` with different `rand` states.
+ * - **Nullability**: `table` and `rand` must not be `NULL`; `dst` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `table` was not successfully initialized; `dst` holds fewer than `count` elements.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param table alias table
+ * \param rand pointer to random state
+ * \param dst destination array
+ * \param count number of samples
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandAliasFill(const vl_rand_alias* table, vl_rand* rand, vl_dsidx_t* dst, vl_dsidx_t count);
+
+/**
+ * \brief Number of interleaved generators in a vl_rand_xoshiro state.
+ */
+#define VL_RAND_XOSHIRO_LANES 8
+
+/**
+ * \brief Multi-lane random state for bulk generation.
+ *
+ * Holds eight xoshiro256++ generators that step together, so the SIMD
+ * backends can produce eight 64-bit outputs per step. Lane `l` is lane 0
+ * advanced by `l * 2^128` steps, so the lanes never overlap. Outputs are
+ * interleaved, lane 0 first, and are identical on every SIMD backend.
+ *
+ * Word `w` of lane `l` lives at `state[w * VL_RAND_XOSHIRO_LANES + l]`.
+ *
+ * Unlike vl_rand, this state is meant for filling large buffers. For
+ * independent per-thread streams, see vlRandXoshiroSplit.
+ *
+ * \sa vlRandXoshiroInit, vlRandXoshiroFill
+ */
+typedef struct vl_rand_xoshiro_
+{
+    vl_uint64_t state[4 * VL_RAND_XOSHIRO_LANES];
+} vl_rand_xoshiro;
+
+/**
+ * \brief Seeds a multi-lane random state.
+ *
+ * Lane 0 takes four splitmix64 outputs of `seed`; every further lane is the
+ * previous one advanced by 2^128 steps. The same seed always produces the
+ * same sequence.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns `rand`.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand state to initialize
+ * \param seed any value, including 0
+ * \par Complexity of O(1) constant.
+ */
+VL_API void vlRandXoshiroInit(vl_rand_xoshiro* rand, vl_ularge_t seed);
+
+/**
+ * \brief Advances every lane by 2^192 steps, moving to the next independent stream.
+ *
+ * Lanes within one state span only 8 * 2^128 steps, so 2^64 streams reached
+ * this way never overlap each other or their own lanes.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `rand` was never initialized.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand state to advance
+ * \par Complexity of O(1) constant.
+ */
+VL_API void vlRandXoshiroJump(vl_rand_xoshiro* rand);
+
+/**
+ * \brief Hands out an independent stream and moves `rand` past it.
+ *
+ * Copies `rand` into `stream`, then jumps `rand`. Calling this once per
+ * worker thread on a shared parent state gives every thread its own
+ * non-overlapping sequence without further coordination.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns both states.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`; `stream` may then move to another thread.
+ * - **Nullability**: Neither pointer may be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `rand` was never initialized, or the two pointers alias.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand parent state, advanced by vlRandXoshiroJump
+ * \param stream receives the stream
+ * \par Complexity of O(1) constant.
+ */
+VL_API void vlRandXoshiroSplit(vl_rand_xoshiro* rand, vl_rand_xoshiro* stream);
+
+/**
+ * \brief Fills the specified region of memory with random bytes.
+ *
+ * Output is produced in blocks of 64 bytes (one step of every lane). A
+ * partial final block still consumes a whole step, so splitting one fill
+ * into several calls yields different bytes than a single call unless each
+ * call but the last covers whole blocks.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `mem` may be `NULL` only if `len` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `mem` holds fewer than `len` bytes.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand rand state
+ * \param mem destination; no alignment required
+ * \param len total number of bytes to fill
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandXoshiroFill(vl_rand_xoshiro* rand, void* mem, vl_ularge_t len);
+
+/**
+ * \brief Fills an array with uniform floats in [0, 1).
+ *
+ * Each float carries 23 random bits. Output is produced in blocks of 16
+ * floats; as with vlRandXoshiroFill, a partial final block consumes a whole
+ * step.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `dst` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `dst` holds fewer than `count` floats.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand rand state
+ * \param dst destination array
+ * \param count number of floats
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandXoshiroFillF(vl_rand_xoshiro* rand, vl_float32_t* dst, vl_dsidx_t count);
+
+/**
+ * \brief Fills an array with uniform doubles in [0, 1).
+ *
+ * Each double carries 52 random bits. Output is produced in blocks of 8
+ * doubles; as with vlRandXoshiroFill, a partial final block consumes a whole
+ * step.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: None.
+ * - **Thread Safety**: Not thread-safe for the same `rand`.
+ * - **Nullability**: `rand` must not be `NULL`; `dst` may be `NULL` only if `count` is 0.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: `dst` holds fewer than `count` doubles.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param rand rand state
+ * \param dst destination array
+ * \param count number of doubles
+ * \par Complexity of O(n) linear.
+ */
+VL_API void vlRandXoshiroFillD(vl_rand_xoshiro* rand, vl_float64_t* dst, vl_dsidx_t count);
+
 #endif // VL_RAND_H
@@ -0,0 +1,259 @@
+/**
+ * ██    ██ ██       █████  ███████  █████   ██████  ███    ██  █████
+ * ██    ██ ██      ██   ██ ██      ██   ██ ██       ████   ██ ██   ██
+ * ██    ██ ██      ███████ ███████ ███████ ██   ███ ██ ██  ██ ███████
+ *  ██  ██  ██      ██   ██      ██ ██   ██ ██    ██ ██  ██ ██ ██   ██
+ *   ████   ███████ ██   ██ ███████ ██   ██  ██████  ██   ████ ██   ██
+ * ====---: A Data Structure and Algorithms library for C11.  :---====
+ *
+ * Copyright 2026 Jesse Walker, released under the MIT license.
+ * Git Repository:  https://github.com/walkerje/veritable_lasagna
+ * \private
+ */
+
+#ifndef VL_SEARCH_H
+#define VL_SEARCH_H
+
+#include "vl_numtypes.h"
+
+/**
+ * \file vl_search.h
+ * \brief Searches over sorted arrays of numeric keys.
+ *
+ * A sorted array is the most compact read-only index there is, and these
+ * functions make it a fast one. Keys are described by a `vl_numtype`, and are
+ * expected in the order vlSortNumeric and vlSortRadix produce: ascending, with
+ * floats ordered as `-NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN`.
+ *
+ * Three layouts of the same data are supported:
+ * - **Sorted arrays**, searched with a branchless binary search that finishes
+ *   with a SIMD scan of the last few keys.
+ * - **Batches of queries** against a sorted array, interleaved so that the
+ *   memory latency of one search hides behind the others.
+ * - **Eytzinger arrays**, the sorted keys rearranged in breadth-first tree
+ *   order so that every probe of a search lands in a predictable, prefetchable
+ *   place. Best for very large indexes that are queried far more often than
+ *   they are rebuilt.
+ *
+ * Every key argument points to a single value of the array's key type.
+ */
+
+/**
+ * \brief Finds the first key that does not order before `key`.
+ *
+ * The search halves the range without branching on the comparison, so its
+ * cost does not depend on how predictable the queries are. Once the range is
+ * small, 32-bit keys are finished with the SIMD rank kernels selected by
+ * vlSIMDInit.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of `keys` or `key`.
+ * - **Lifetime**: `keys` and `key` must remain valid for the duration of the call.
+ * - **Thread Safety**: Thread-safe for concurrent readers.
+ * - **Nullability**: `keys` may be `NULL` only if `numElements` is 0. `key` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_STRUCTURE_INDEX_MAX` if `keyType` is out of range.
+ * - **Undefined Behavior**: Keys that are not sorted as vlSortNumeric sorts them.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Index of the first key not less than `key`, or `numElements` if there is none.
+ *
+ * \param keys sorted array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param key pointer to the key to search for
+ * \return lower bound index
+ * \par Complexity of O(log(n)).
+ * \sa vlSearchUpperBound, vlSearchEqualRange
+ */
+VL_API vl_dsidx_t vlSearchLowerBound(const void* keys, vl_dsidx_t numElements, vl_numtype keyType, const void* key);
+
+/**
+ * \brief Finds the first key that orders after `key`.
+ *
+ * ## Contract
+ * - **Ownership**: As vlSearchLowerBound.
+ * - **Lifetime**: As vlSearchLowerBound.
+ * - **Thread Safety**: As vlSearchLowerBound.
+ * - **Nullability**: As vlSearchLowerBound.
+ * - **Error Conditions**: Returns `VL_STRUCTURE_INDEX_MAX` if `keyType` is out of range.
+ * - **Undefined Behavior**: As vlSearchLowerBound.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Index of the first key greater than `key`, or `numElements` if there is none.
+ *
+ * \param keys sorted array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param key pointer to the key to search for
+ * \return upper bound index
+ * \par Complexity of O(log(n)).
+ * \sa vlSearchLowerBound
+ */
+VL_API vl_dsidx_t vlSearchUpperBound(const void* keys, vl_dsidx_t numElements, vl_numtype keyType, const void* key);
+
+/**
+ * \brief Finds the run of keys equal to `key`.
+ *
+ * ## Contract
+ * - **Ownership**: As vlSearchLowerBound.
+ * - **Lifetime**: As vlSearchLowerBound.
+ * - **Thread Safety**: As vlSearchLowerBound.
+ * - **Nullability**: As vlSearchLowerBound. `first` must not be `NULL`.
+ * - **Error Conditions**: Returns 0 and sets `first` to `VL_STRUCTURE_INDEX_MAX` if `keyType` is out of range.
+ * - **Undefined Behavior**: As vlSearchLowerBound.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Number of keys equal to `key`. `first` receives the lower bound, which is where
+ * `key` would be inserted if the count is 0.
+ *
+ * \param keys sorted array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param key pointer to the key to search for
+ * \param first receives the index of the first equal key
+ * \return number of equal keys
+ * \par Complexity of O(log(n)).
+ * \sa vlSearchLowerBound, vlSearchUpperBound
+ */
+VL_API vl_dsidx_t vlSearchEqualRange(const void* keys, vl_dsidx_t numElements, vl_numtype keyType, const void* key,
+                                     vl_dsidx_t* first);
+
+/**
+ * \brief Computes the lower bound of many keys at once.
+ *
+ * Queries are processed in groups that advance through the binary search in
+ * lockstep. Every search in a group takes the same number of steps, and each
+ * step prefetches that search's next probe, so the cache misses of the whole
+ * group overlap instead of being paid one after another. On arrays much
+ * larger than the cache this is several times faster than separate calls.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of `keys`, `queries`, or `results`.
+ * - **Lifetime**: All buffers must remain valid for the duration of the call.
+ * - **Thread Safety**: Thread-safe for concurrent readers, as long as `results` is not shared.
+ * - **Nullability**: Pointers may be `NULL` only when the matching count is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` without writing `results` if `keyType` is out of range.
+ * - **Undefined Behavior**: As vlSearchLowerBound. `results` overlapping `keys` or `queries`.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once `results[i]` holds the lower bound of `queries[i]`.
+ *
+ * \param keys sorted array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys and queries
+ * \param queries array of keys to search for
+ * \param numQueries number of queries
+ * \param results array of `numQueries` indices to fill
+ * \return VL_TRUE on success
+ * \par Complexity of O(m log(n)) for m queries.
+ * \sa vlSearchLowerBound, vlSearchUpperBoundBatch
+ */
+VL_API vl_bool_t vlSearchLowerBoundBatch(const void* keys, vl_dsidx_t numElements, vl_numtype keyType,
+                                         const void* queries, vl_dsidx_t numQueries, vl_dsidx_t* results);
+
+/**
+ * \brief Computes the upper bound of many keys at once.
+ *
+ * ## Contract
+ * - **Ownership**: As vlSearchLowerBoundBatch.
+ * - **Lifetime**: As vlSearchLowerBoundBatch.
+ * - **Thread Safety**: As vlSearchLowerBoundBatch.
+ * - **Nullability**: As vlSearchLowerBoundBatch.
+ * - **Error Conditions**: Returns `VL_FALSE` without writing `results` if `keyType` is out of range.
+ * - **Undefined Behavior**: As vlSearchLowerBoundBatch.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once `results[i]` holds the upper bound of `queries[i]`.
+ *
+ * \param keys sorted array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys and queries
+ * \param queries array of keys to search for
+ * \param numQueries number of queries
+ * \param results array of `numQueries` indices to fill
+ * \return VL_TRUE on success
+ * \sa vlSearchLowerBoundBatch
+ */
+VL_API vl_bool_t vlSearchUpperBoundBatch(const void* keys, vl_dsidx_t numElements, vl_numtype keyType,
+                                         const void* queries, vl_dsidx_t numQueries, vl_dsidx_t* results);
+
+/**
+ * \brief Rearranges a sorted array into Eytzinger (breadth-first) order.
+ *
+ * Slot 0 of `layout` holds the root of an implicit binary search tree, and
+ * the children of slot `i` are slots `2i + 1` and `2i + 2`. If `order` is not
+ * `NULL`, `order[i]` receives the index in `sorted` of the key placed in slot
+ * `i`, which lets payload arrays be permuted the same way or looked up by
+ * their original index.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of any buffer.
+ * - **Lifetime**: All buffers must remain valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe if `layout` or `order` is accessed concurrently.
+ * - **Nullability**: `sorted` and `layout` may be `NULL` only if `numElements` is 0. `order` may be `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` without writing anything if `keyType` is out of range.
+ * - **Undefined Behavior**: `layout` overlapping `sorted`. `numElements` above half of `VL_STRUCTURE_INDEX_MAX`.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the layout is built.
+ *
+ * \param sorted sorted array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param layout array of `numElements` keys to fill
+ * \param order optional array of `numElements` indices to fill
+ * \return VL_TRUE on success
+ * \par Complexity of O(n).
+ * \sa vlSearchEytzingerLowerBound
+ */
+VL_API vl_bool_t vlSearchEytzingerBuild(const void* sorted, vl_dsidx_t numElements, vl_numtype keyType, void* layout,
+                                        vl_dsidx_t* order);
+
+/**
+ * \brief Finds the slot of the first key that does not order before `key` in an Eytzinger array.
+ *
+ * The search walks down the implicit tree without branching on comparisons.
+ * Because the descendants four levels below a node sit next to each other,
+ * each step prefetches the cache line the search will need a few steps later.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of `layout` or `key`.
+ * - **Lifetime**: `layout` and `key` must remain valid for the duration of the call.
+ * - **Thread Safety**: Thread-safe for concurrent readers.
+ * - **Nullability**: `layout` may be `NULL` only if `numElements` is 0. `key` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_STRUCTURE_INDEX_MAX` if `keyType` is out of range.
+ * - **Undefined Behavior**: A `layout` not produced by vlSearchEytzingerBuild from sorted keys.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Slot in `layout` of the lower bound, or `numElements` if every key is less than
+ * `key`. Use the `order` array from vlSearchEytzingerBuild to map a slot back to a sorted index.
+ *
+ * \param layout Eytzinger array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param key pointer to the key to search for
+ * \return slot of the lower bound
+ * \par Complexity of O(log(n)).
+ * \sa vlSearchEytzingerBuild, vlSearchEytzingerUpperBound
+ */
+VL_API vl_dsidx_t vlSearchEytzingerLowerBound(const void* layout, vl_dsidx_t numElements, vl_numtype keyType,
+                                              const void* key);
+
+/**
+ * \brief Finds the slot of the first key that orders after `key` in an Eytzinger array.
+ *
+ * ## Contract
+ * - **Ownership**: As vlSearchEytzingerLowerBound.
+ * - **Lifetime**: As vlSearchEytzingerLowerBound.
+ * - **Thread Safety**: As vlSearchEytzingerLowerBound.
+ * - **Nullability**: As vlSearchEytzingerLowerBound.
+ * - **Error Conditions**: Returns `VL_STRUCTURE_INDEX_MAX` if `keyType` is out of range.
+ * - **Undefined Behavior**: As vlSearchEytzingerLowerBound.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Slot in `layout` of the upper bound, or `numElements` if no key is greater than
+ * `key`.
+ *
+ * \param layout Eytzinger array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param key pointer to the key to search for
+ * \return slot of the upper bound
+ * \sa vlSearchEytzingerLowerBound
+ */
+VL_API vl_dsidx_t vlSearchEytzingerUpperBound(const void* layout, vl_dsidx_t numElements, vl_numtype keyType,
+                                              const void* key);
+
+#endif // VL_SEARCH_H
@@ -80,8 +80,8 @@ VL_API void vlSemaphoreDelete(vl_semaphore sem);
  * error.
  *
  * \param sem Semaphore handle
- * \param timeoutMs Maximum time to wait in milliseconds. Note: 0 results in an immediate return if the semaphore is not
- * available. \return VL_TRUE if acquired, VL_FALSE if timeout occurred
+ * \param timeoutMs Maximum time to wait in milliseconds. Note: 0 waits indefinitely; use `vlSemaphoreTryWait` for an
+ * immediate return. \return VL_TRUE if acquired, VL_FALSE if timeout occurred
  */
 VL_API vl_bool_t vlSemaphoreWait(vl_semaphore sem, vl_uint_t timeoutMs);
 
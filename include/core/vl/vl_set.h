@@ -426,6 +426,33 @@ VL_API vl_set* vlSetClone(const vl_set* src, vl_set* dest);
  */
 VL_API int vlSetCopy(vl_set* src, vl_set_iter begin, vl_set_iter end, vl_set* dest);
 
+/**
+ * \brief Replaces the contents of a set with a sorted array, building the tree bottom-up.
+ *
+ * The tree is built directly in its final, balanced shape, without the
+ * searches and rebalancing of inserting elements one at a time. Nodes are
+ * laid out in the node pool in order, so iterating the result walks memory
+ * sequentially. Runs of equal elements keep only their first element.
+ *
+ * ## Contract
+ * - **Ownership**: Elements are copied into the set.
+ * - **Lifetime**: Previous iterators become invalid.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `set` must not be `NULL`. `elements` may be `NULL` only if `numElements` is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the set empty if `elements` is not sorted in ascending
+ * order under the set comparator, or if allocation fails.
+ * - **Undefined Behavior**: Passing an uninitialized set.
+ * - **Memory Allocation Expectations**: Reserves node pool capacity for every unique element.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the set holds the given elements.
+ *
+ * \param set pointer
+ * \param elements sorted array of elements
+ * \param numElements number of elements
+ * \par Complexity of O(n) linear.
+ * \return VL_TRUE on success
+ */
+VL_API vl_bool_t vlSetBuildSorted(vl_set* set, const void* elements, vl_dsidx_t numElements);
+
 /**
  * Searches for the specified element in the set.
  * Returns VL_SET_ITER_INVALID if element is not found.
@@ -447,6 +474,82 @@ VL_API int vlSetCopy(vl_set* src, vl_set_iter begin, vl_set_iter end, vl_set* de
  */
 VL_API vl_set_iter vlSetFind(vl_set* set, const void* elem);
 
+/**
+ * \brief Returns the number of elements that order before the specified element.
+ *
+ * The element does not need to be in the set. If it is, its rank is also its
+ * zero-based position in iteration order, so `vlSetSelect(set, rank)`
+ * returns it.
+ *
+ * When the library is built with VL_SET_ORDER_STATISTICS (the default), every
+ * node records the size of its subtree and this is a single walk from the
+ * root. Otherwise, it counts elements from the front of the set.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Safe for concurrent reads.
+ * - **Nullability**: Returns 0 if `set` or `elem` is `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an uninitialized set.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the count of elements strictly less than `elem`.
+ *
+ * \param set pointer to set
+ * \param elem pointer to element
+ * \par Complexity O(log(n)) with VL_SET_ORDER_STATISTICS, otherwise O(n).
+ * \return number of elements ordered before elem.
+ */
+VL_API vl_dsidx_t vlSetRank(vl_set* set, const void* elem);
+
+/**
+ * \brief Returns the element at the specified position in iteration order.
+ *
+ * Index 0 is the smallest element. This is the inverse of vlSetRank, and can
+ * be used to find percentiles, e.g. the median at `totalElements / 2`.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: The returned iterator is valid until the element is removed.
+ * - **Thread Safety**: Safe for concurrent reads.
+ * - **Nullability**: Returns `VL_SET_ITER_INVALID` if `set` is `NULL`.
+ * - **Error Conditions**: Returns `VL_SET_ITER_INVALID` if `index` is not less than the number of elements.
+ * - **Undefined Behavior**: Passing an uninitialized set.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the iterator of the element, or `VL_SET_ITER_INVALID`.
+ *
+ * \param set pointer to set
+ * \param index zero-based position of the element
+ * \par Complexity O(log(n)) with VL_SET_ORDER_STATISTICS, otherwise O(n).
+ * \return iterator of the element, or VL_SET_ITER_INVALID.
+ */
+VL_API vl_set_iter vlSetSelect(vl_set* set, vl_dsidx_t index);
+
+/**
+ * \brief Counts the elements in the half-open range [low, high).
+ *
+ * Either bound may be `NULL`, in which case the range is unbounded on that
+ * side. Neither bound needs to be in the set.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Safe for concurrent reads.
+ * - **Nullability**: Returns 0 if `set` is `NULL`. `low` and `high` may be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an uninitialized set.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the number of elements not less than `low` and less than `high`; 0 if
+ * `high` does not order after `low`.
+ *
+ * \param set pointer to set
+ * \param low inclusive lower bound, or NULL
+ * \param high exclusive upper bound, or NULL
+ * \par Complexity O(log(n)) with VL_SET_ORDER_STATISTICS, otherwise O(n).
+ * \return number of elements in the range.
+ */
+VL_API vl_dsidx_t vlSetCountRange(vl_set* set, const void* low, const void* high);
+
 /**
  * \brief Computes the union between sets A and B, stored in set dest.
  *
@@ -455,12 +558,16 @@ VL_API vl_set_iter vlSetFind(vl_set* set, const void* elem);
  *
  * This function has computational relevance to set theory.
  *
- * Both A and B sets must have identical element sizes and comparators.
+ * A, B, and dest must have identical element sizes and comparators.
  * Otherwise, this is a no-op and will return null.
  *
  * The 'dest' set pointer may be null, but if it is not null it must be
  * initialized. If the 'dest' set pointer is null, a new set is created via
- * vlSetNew.
+ * vlSetNew. Elements already in 'dest' are kept, unless 'dest' is one of the
+ * inputs, in which case it is overwritten with the result.
+ *
+ * Both inputs are walked in order and merged, and the result is built
+ * bottom-up as with vlSetBuildSorted, so the operation runs in linear time.
  *
  * The set notation for this operation is: A u B
  *
@@ -471,13 +578,14 @@ VL_API vl_set_iter vlSetFind(vl_set* set, const void* elem);
  * - **Nullability**: `a` and `b` must not be `NULL`. `dest` can be `NULL`.
  * - **Error Conditions**: Returns `NULL` if element sizes or comparators do not match, or if allocation fails.
  * - **Undefined Behavior**: None.
- * - **Memory Allocation Expectations**: May allocate a new set struct and multiple nodes.
+ * - **Memory Allocation Expectations**: May allocate a new set struct and multiple nodes, and temporarily one pointer
+ * per element of the result.
  * - **Return-value Semantics**: Returns the pointer to the union set (`dest` or a new instance), or `NULL`.
  *
  * \param a first set
  * \param b second set
  * \param dest destination set
- * \par Complexity of O(nlog(n)) log-linear.
+ * \par Complexity of O(n + m) linear.
  * \return pointer to set that was copied to or created, or NULL on mismatched
  * sets.
  */
@@ -492,12 +600,13 @@ VL_API vl_set* vlSetUnion(vl_set* a, vl_set* b, vl_set* dest);
  *
  * This function has computational relevance to set theory.
  *
- * Both A and B sets must have identical element sizes and comparators.
+ * A, B, and dest must have identical element sizes and comparators.
  * Otherwise, this is a no-op and will return null.
  *
  * The 'dest' set pointer may be null, but if it is not null it must be
  * initialized. If the 'dest' set pointer is null, a new set is created via
- * vlSetNew.
+ * vlSetNew. As with vlSetUnion, elements already in 'dest' are kept unless
+ * 'dest' is one of the inputs, and the result is merged in linear time.
  *
  * The set notation for this operation is: A n B
  *
@@ -514,7 +623,7 @@ VL_API vl_set* vlSetUnion(vl_set* a, vl_set* b, vl_set* dest);
  * \param a first set
  * \param b second set
  * \param dest destination set
- * \par Complexity of O(nlog(n)) log-linear.
+ * \par Complexity of O(n + m) linear.
  * \return pointer to set that was copied to or created, or NULL on mismatched
  * sets.
  */
@@ -523,18 +632,19 @@ VL_API vl_set* vlSetIntersection(vl_set* a, vl_set* b, vl_set* dest);
 /**
  * \brief Compute the difference between sets A and B, stored in set dest.
  *
- * Differences consist of all elements that reside in either A and B,
- * but NOT elements that exist in both A and B.
- * Consider this equivalent to bitwise XOR.
+ * Differences consist of all elements that reside in A, but NOT elements
+ * that also exist in B.
+ * Consider this equivalent to bitwise A AND NOT B.
  *
  * This function has computational relevance to set theory.
  *
- * Both A and B sets must have identical element sizes and comparators.
+ * A, B, and dest must have identical element sizes and comparators.
  * Otherwise, this is a no-op and will return null.
  *
  * The 'dest' set pointer may be null, but if it is not null it must be
  * initialized. If the 'dest' set pointer is null, a new set is created via
- * vlSetNew.
+ * vlSetNew. As with vlSetUnion, elements already in 'dest' are kept unless
+ * 'dest' is one of the inputs, and the result is merged in linear time.
  *
  * The set notation for this operation is: A - B
  *
@@ -551,7 +661,7 @@ VL_API vl_set* vlSetIntersection(vl_set* a, vl_set* b, vl_set* dest);
  * \param a first set
  * \param b second set
  * \param dest destination set
- * \par Complexity of O(nlog(n)) log-linear.
+ * \par Complexity of O(n + m) linear.
  * \return pointer to set that was copied to or created, or NULL on mismatched
  * sets.
  */
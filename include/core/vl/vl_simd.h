@@ -48,6 +48,10 @@
  * - **AVX2**: Intel Haswell (2013+), AMD Excavator (2015+). Extends SSE with
  * 256-bit operations (8 float or 8 int32), true FMA, and better integer
  * operations.
+ * - **AVX-512 (F/BW/VL/DQ)**: Intel Skylake-SP (2017+), AMD Zen 4 (2022+).
+ * 512-bit operations (16 float, 16 int32 or 64 bytes) and mask registers,
+ * which the array kernels use to finish tails without a scalar loop. Builds
+ * on the AVX2 backend for the operations it does not widen.
  *
  * ### ARM / ARM64
  * - **NEON (ARMv7)**: 128-bit operations on 4 float or mixed-width integers.
@@ -57,7 +61,7 @@
  *   Handles 8-wide operations via two 128-bit registers.
  *
  * Selection priority (checked in order):
- * - x86: AVX2 > SSE2 > Portable C
+ * - x86: AVX-512 > AVX2 > SSE2 > Portable C
  * - ARM64: NEON64 > Portable C
  * - ARM32: NEON > Portable C
  * - Other: Portable C
@@ -97,6 +101,8 @@
  * - **4-wide int32 (I32)**: 4 × 32-bit signed integers, 16-byte aligned
  * - **8-wide int16 (I16)**: 8 × 16-bit signed integers, 32-byte aligned
  * - **32-wide uint8 (U8)**: 32 × 8-bit unsigned integers, 32-byte aligned
+ * - **16-wide float / int32**: 16 × 32-bit lanes, 64-byte aligned (for AVX-512)
+ * - **64-wide uint8 (U8)**: 64 × 8-bit unsigned integers, 64-byte aligned
  *
  * ## Operation Categories
  *
@@ -136,6 +142,72 @@
  * - **I16**: Load, store, add (8-wide)
  * - **U8**: Load, store (32-wide)
  *
+ * ### 512-bit Operations
+ * - **F32 (16-wide)**: Load, store, splat, add, sub, mul, FMA, horizontal sum
+ * - **I32 (16-wide)**: Load, store, add, multiply
+ * - **U8 (64-wide)**: Load, store, and vlSIMDEqMaskVec64U8, which compares
+ * every byte against a scalar and returns one bit per byte
+ *
+ * ### Sorting Networks
+ * - **vlSIMDSortI32, vlSIMDSortU32, vlSIMDSortF32**: Sort up to
+ * VL_SIMD_SORT_NETWORK_MAX keys in place with a bitonic sorting network.
+ * These are building blocks for vlSortNumeric, which handles arrays of any
+ * length.
+ *
+ * ### Key Ranking
+ * - **vlSIMDRankI32, vlSIMDRankU32, vlSIMDRankF32**: Count the keys in an
+ * array that order before a probe key. vl_search uses these to finish binary
+ * searches with a linear scan.
+ *
+ * ### Array Kernels
+ * Whole-array loops that dispatch once per call rather than once per vector:
+ * - **vlSIMDSum\*, vlSIMDDot\***: Reductions; integer variants accumulate in 64 bits
+ * - **vlSIMDAxpy\*, vlSIMDScale\***: `y += alpha * x` and `dst = alpha * src`
+ * - **vlSIMDMinMax\*, vlSIMDArgMin\*, vlSIMDClamp\***: Range queries and clamping
+ * - **vlSIMDPrefixSum\***: Inclusive scans
+ * - **vlSIMDCompare\***: Compare against a scalar into a packed bit mask
+ *
+ * Each family covers a subset of F32, I32, I16 and U8; see the individual
+ * functions. vlSIMDUseBackend forces a specific backend, which is how the
+ * backends are compared against each other in tests and benchmarks.
+ *
+ * ### Byte Scanning
+ * - **vlSIMDFindU8, vlSIMDFindLastU8**: First or last occurrence of a byte,
+ * like `memchr` and `memrchr` over a known length
+ * - **vlSIMDFindAnyU8**: First byte that belongs to a small set
+ * - **vlSIMDCountU8**: Number of occurrences of a byte
+ * - **vlSIMDEqualU8**: Equality of two byte ranges, for keys of known length
+ *
+ * The hash table compares keys and the filesystem module splits paths with
+ * these.
+ *
+ * ### Half-Precision Conversion
+ * - **vlSIMDConvertF32ToHalf, vlSIMDConvertHalfToF32**: Whole-array
+ * conversion between floats and vl_half_t, matching vlHalfFromFloat and
+ * vlHalfToFloat bit for bit. AVX2 and AVX-512 use the F16C instructions,
+ * NEON64 uses `fcvt`, and SSE2 uses branch-free integer arithmetic.
+ *
+ * ### Numeric Type Conversion
+ * - **vlSIMDConvert\***: Whole-array versions of the C casts between the
+ * common element types: I32, I16 and U8 to F32, F32 to I32, F32 to and from
+ * F64, and I16 to and from I32. vlNumTypeCastArray routes packed arrays of
+ * these pairs here.
+ *
+ * ### Byte Swapping and Gathers
+ * - **vlSIMDByteSwapU16, vlSIMDByteSwapU32, vlSIMDByteSwapU64**: Reverse the
+ * bytes of every element in place, for endianness conversion
+ * - **vlSIMDGather32, vlSIMDGather64**: Copy 4- or 8-byte elements from a
+ * strided source into a packed array, using hardware gathers on AVX2 and
+ * AVX-512
+ *
+ * vlMemReverseSubArraysStride and vlMemCopyStride dispatch to these.
+ *
+ * ### Random Number Generation
+ * - **vlSIMDXoshiroU64, vlSIMDXoshiroF32, vlSIMDXoshiroF64**: Step eight
+ * interleaved xoshiro256++ generators together and write their outputs as raw
+ * 64-bit words, floats or doubles in [0, 1). Every backend produces the same
+ * values. vl_rand_xoshiro (in vl_rand.h) owns the state and dispatches here.
+ *
  * ## Important Notes on Precision & Behavior
  *
  * ### Division on NEON (ARMv7/ARMv8)
@@ -195,10 +267,15 @@
  * ### 8-Wide Operations
  * 8-wide operations on NEON/SSE2 are synthesized from two 128-bit registers.
  *
+ * ### 16-Wide and 64-Byte Operations
+ * These are single instructions on AVX-512 and are synthesized from two
+ * 256-bit or four 128-bit registers on the other backends.
+ *
  * \sa vlSIMDInit
  * \sa vl_simd_functions_t
  */
 
+#include <vl/vl_half.h>
 #include <vl/vl_memory.h>
 #include <vl/vl_numtypes.h>
 
@@ -299,6 +376,43 @@ typedef struct VL_ALIGN_HINT(32) vl_simd_vec32_u8_
     vl_uint8_t components[32];
 } vl_simd_vec32_u8;
 
+/**
+ * \brief 16-element 32-bit float vector.
+ *
+ * Represents a 512-bit SIMD vector on AVX-512, and two or four narrower
+ * registers elsewhere.
+ * Alignment: 64 bytes (one cache line).
+ *
+ * \sa vlSIMDLoadVec16F32, vlSIMDStoreVec16F32
+ */
+typedef struct VL_ALIGN_HINT(64) vl_simd_vec16_f32_
+{
+    vl_float32_t components[16];
+} vl_simd_vec16_f32;
+
+/**
+ * \brief 16-element 32-bit signed integer vector.
+ *
+ * Alignment: 64 bytes.
+ */
+typedef struct VL_ALIGN_HINT(64) vl_simd_vec16_i32_
+{
+    vl_int32_t components[16];
+} vl_simd_vec16_i32;
+
+/**
+ * \brief 64-element 8-bit unsigned integer vector.
+ *
+ * Used for byte scanning, where one comparison covers a whole cache line.
+ * Alignment: 64 bytes.
+ *
+ * \sa vlSIMDEqMaskVec64U8
+ */
+typedef struct VL_ALIGN_HINT(64) vl_simd_vec64_u8_
+{
+    vl_uint8_t components[64];
+} vl_simd_vec64_u8;
+
 /* ============================================================================
  * Function Pointer Types for Runtime Dispatch
  *
@@ -348,6 +462,112 @@ typedef void (*vl_simd_store_vec8i16_fn)(vl_int16_t*, vl_simd_vec8_i16);
 typedef vl_simd_vec8_i16 (*vl_simd_add_vec8i16_fn)(vl_simd_vec8_i16, vl_simd_vec8_i16);
 typedef vl_simd_vec32_u8 (*vl_simd_load_vec32u8_fn)(const vl_uint8_t*);
 typedef void (*vl_simd_store_vec32u8_fn)(vl_uint8_t*, vl_simd_vec32_u8);
+typedef vl_simd_vec16_f32 (*vl_simd_load_vec16f32_fn)(const vl_float32_t*);
+typedef void (*vl_simd_store_vec16f32_fn)(vl_float32_t*, vl_simd_vec16_f32);
+typedef vl_simd_vec16_f32 (*vl_simd_splat_vec16f32_fn)(vl_float32_t);
+typedef vl_simd_vec16_f32 (*vl_simd_add_vec16f32_fn)(vl_simd_vec16_f32, vl_simd_vec16_f32);
+typedef vl_simd_vec16_f32 (*vl_simd_sub_vec16f32_fn)(vl_simd_vec16_f32, vl_simd_vec16_f32);
+typedef vl_simd_vec16_f32 (*vl_simd_mul_vec16f32_fn)(vl_simd_vec16_f32, vl_simd_vec16_f32);
+typedef vl_simd_vec16_f32 (*vl_simd_fma_vec16f32_fn)(vl_simd_vec16_f32, vl_simd_vec16_f32, vl_simd_vec16_f32);
+typedef vl_float32_t (*vl_simd_hsum_vec16f32_fn)(vl_simd_vec16_f32);
+typedef vl_simd_vec16_i32 (*vl_simd_load_vec16i32_fn)(const vl_int32_t*);
+typedef void (*vl_simd_store_vec16i32_fn)(vl_int32_t*, vl_simd_vec16_i32);
+typedef vl_simd_vec16_i32 (*vl_simd_add_vec16i32_fn)(vl_simd_vec16_i32, vl_simd_vec16_i32);
+typedef vl_simd_vec16_i32 (*vl_simd_mul_vec16i32_fn)(vl_simd_vec16_i32, vl_simd_vec16_i32);
+typedef vl_simd_vec64_u8 (*vl_simd_load_vec64u8_fn)(const vl_uint8_t*);
+typedef void (*vl_simd_store_vec64u8_fn)(vl_uint8_t*, vl_simd_vec64_u8);
+typedef vl_uint64_t (*vl_simd_eqmask_vec64u8_fn)(vl_simd_vec64_u8, vl_uint8_t);
+typedef void (*vl_simd_sort_i32_fn)(vl_int32_t*, vl_dsidx_t);
+typedef void (*vl_simd_sort_u32_fn)(vl_uint32_t*, vl_dsidx_t);
+typedef void (*vl_simd_sort_f32_fn)(vl_float32_t*, vl_dsidx_t);
+typedef vl_dsidx_t (*vl_simd_rank_i32_fn)(const vl_int32_t*, vl_dsidx_t, vl_int32_t, vl_bool_t);
+typedef vl_dsidx_t (*vl_simd_rank_u32_fn)(const vl_uint32_t*, vl_dsidx_t, vl_uint32_t, vl_bool_t);
+typedef vl_dsidx_t (*vl_simd_rank_f32_fn)(const vl_float32_t*, vl_dsidx_t, vl_float32_t, vl_bool_t);
+
+/**
+ * \brief Comparison applied by the array compare kernels, as `element <op> value`.
+ *
+ * \sa vlSIMDCompareF32
+ */
+typedef enum
+{
+    VL_SIMD_CMP_LT, /**< element < value */
+    VL_SIMD_CMP_LE, /**< element <= value */
+    VL_SIMD_CMP_EQ, /**< element == value */
+    VL_SIMD_CMP_NE, /**< element != value */
+    VL_SIMD_CMP_GE, /**< element >= value */
+    VL_SIMD_CMP_GT  /**< element > value */
+} vl_simd_cmp_op;
+
+typedef vl_float32_t (*vl_simd_sum_f32_fn)(const vl_float32_t*, vl_dsidx_t);
+typedef vl_int64_t (*vl_simd_sum_i32_fn)(const vl_int32_t*, vl_dsidx_t);
+typedef vl_int64_t (*vl_simd_sum_i16_fn)(const vl_int16_t*, vl_dsidx_t);
+typedef vl_uint64_t (*vl_simd_sum_u8_fn)(const vl_uint8_t*, vl_dsidx_t);
+typedef vl_float32_t (*vl_simd_dot_f32_fn)(const vl_float32_t*, const vl_float32_t*, vl_dsidx_t);
+typedef vl_int64_t (*vl_simd_dot_i32_fn)(const vl_int32_t*, const vl_int32_t*, vl_dsidx_t);
+typedef vl_int64_t (*vl_simd_dot_i16_fn)(const vl_int16_t*, const vl_int16_t*, vl_dsidx_t);
+typedef void (*vl_simd_axpy_f32_fn)(const vl_float32_t*, vl_float32_t*, vl_dsidx_t, vl_float32_t);
+typedef void (*vl_simd_axpy_i32_fn)(const vl_int32_t*, vl_int32_t*, vl_dsidx_t, vl_int32_t);
+typedef void (*vl_simd_scale_f32_fn)(const vl_float32_t*, vl_float32_t*, vl_dsidx_t, vl_float32_t);
+typedef void (*vl_simd_scale_i32_fn)(const vl_int32_t*, vl_int32_t*, vl_dsidx_t, vl_int32_t);
+typedef vl_bool_t (*vl_simd_minmax_f32_fn)(const vl_float32_t*, vl_dsidx_t, vl_float32_t*, vl_float32_t*);
+typedef vl_bool_t (*vl_simd_minmax_i32_fn)(const vl_int32_t*, vl_dsidx_t, vl_int32_t*, vl_int32_t*);
+typedef vl_bool_t (*vl_simd_minmax_i16_fn)(const vl_int16_t*, vl_dsidx_t, vl_int16_t*, vl_int16_t*);
+typedef vl_bool_t (*vl_simd_minmax_u8_fn)(const vl_uint8_t*, vl_dsidx_t, vl_uint8_t*, vl_uint8_t*);
+typedef vl_dsidx_t (*vl_simd_argmin_f32_fn)(const vl_float32_t*, vl_dsidx_t);
+typedef vl_dsidx_t (*vl_simd_argmin_i32_fn)(const vl_int32_t*, vl_dsidx_t);
+typedef vl_dsidx_t (*vl_simd_argmin_i16_fn)(const vl_int16_t*, vl_dsidx_t);
+typedef vl_dsidx_t (*vl_simd_argmin_u8_fn)(const vl_uint8_t*, vl_dsidx_t);
+typedef void (*vl_simd_clamp_f32_fn)(const vl_float32_t*, vl_float32_t*, vl_dsidx_t, vl_float32_t, vl_float32_t);
+typedef void (*vl_simd_clamp_i32_fn)(const vl_int32_t*, vl_int32_t*, vl_dsidx_t, vl_int32_t, vl_int32_t);
+typedef void (*vl_simd_clamp_i16_fn)(const vl_int16_t*, vl_int16_t*, vl_dsidx_t, vl_int16_t, vl_int16_t);
+typedef void (*vl_simd_clamp_u8_fn)(const vl_uint8_t*, vl_uint8_t*, vl_dsidx_t, vl_uint8_t, vl_uint8_t);
+typedef void (*vl_simd_prefix_sum_f32_fn)(const vl_float32_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_prefix_sum_i32_fn)(const vl_int32_t*, vl_int32_t*, vl_dsidx_t);
+typedef vl_dsidx_t (*vl_simd_compare_f32_fn)(const vl_float32_t*, vl_dsidx_t, vl_float32_t, vl_simd_cmp_op,
+                                             vl_uint8_t*);
+typedef vl_dsidx_t (*vl_simd_compare_i32_fn)(const vl_int32_t*, vl_dsidx_t, vl_int32_t, vl_simd_cmp_op, vl_uint8_t*);
+typedef vl_dsidx_t (*vl_simd_compare_i16_fn)(const vl_int16_t*, vl_dsidx_t, vl_int16_t, vl_simd_cmp_op, vl_uint8_t*);
+typedef vl_dsidx_t (*vl_simd_compare_u8_fn)(const vl_uint8_t*, vl_dsidx_t, vl_uint8_t, vl_simd_cmp_op, vl_uint8_t*);
+typedef vl_dsidx_t (*vl_simd_find_u8_fn)(const vl_uint8_t*, vl_dsidx_t, vl_uint8_t);
+typedef vl_dsidx_t (*vl_simd_find_last_u8_fn)(const vl_uint8_t*, vl_dsidx_t, vl_uint8_t);
+typedef vl_dsidx_t (*vl_simd_find_any_u8_fn)(const vl_uint8_t*, vl_dsidx_t, const vl_uint8_t*, vl_dsidx_t);
+typedef vl_dsidx_t (*vl_simd_count_u8_fn)(const vl_uint8_t*, vl_dsidx_t, vl_uint8_t);
+typedef vl_bool_t (*vl_simd_equal_u8_fn)(const vl_uint8_t*, const vl_uint8_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_f32_to_half_fn)(const vl_float32_t*, vl_half_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_half_to_f32_fn)(const vl_half_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_i32_to_f32_fn)(const vl_int32_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_f32_to_i32_fn)(const vl_float32_t*, vl_int32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_i16_to_f32_fn)(const vl_int16_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_u8_to_f32_fn)(const vl_uint8_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_f32_to_f64_fn)(const vl_float32_t*, vl_float64_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_f64_to_f32_fn)(const vl_float64_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_i16_to_i32_fn)(const vl_int16_t*, vl_int32_t*, vl_dsidx_t);
+typedef void (*vl_simd_convert_i32_to_i16_fn)(const vl_int32_t*, vl_int16_t*, vl_dsidx_t);
+typedef void (*vl_simd_byteswap_u16_fn)(vl_uint16_t*, vl_dsidx_t);
+typedef void (*vl_simd_byteswap_u32_fn)(vl_uint32_t*, vl_dsidx_t);
+typedef void (*vl_simd_byteswap_u64_fn)(vl_uint64_t*, vl_dsidx_t);
+typedef void (*vl_simd_gather_fn)(const void*, vl_dsoffs_t, void*, vl_dsidx_t);
+typedef void (*vl_simd_xoshiro_u64_fn)(vl_uint64_t*, void*, vl_dsidx_t);
+typedef void (*vl_simd_xoshiro_f32_fn)(vl_uint64_t*, vl_float32_t*, vl_dsidx_t);
+typedef void (*vl_simd_xoshiro_f64_fn)(vl_uint64_t*, vl_float64_t*, vl_dsidx_t);
+
+/**
+ * \brief Largest key count accepted by the sorting network kernels.
+ *
+ * \sa vlSIMDSortI32, vlSIMDSortU32, vlSIMDSortF32
+ */
+#define VL_SIMD_SORT_NETWORK_MAX 256
+
+/**
+ * \brief Number of xoshiro256++ generators stepped together by the xoshiro kernels.
+ *
+ * Their state is laid out word-major: word `w` of lane `l` lives at
+ * `state[w * VL_SIMD_XOSHIRO_LANES + l]`, 32 words in total.
+ *
+ * \sa vlSIMDXoshiroU64
+ */
+#define VL_SIMD_XOSHIRO_LANES 8
 
 /* ============================================================================
  * Global Function Pointer Table
@@ -371,6 +591,13 @@ typedef void (*vl_simd_store_vec32u8_fn)(vl_uint8_t*, vl_simd_vec32_u8);
  * - Horizontal reductions (sum, max, min, product)
  * - Lane operations (extract, broadcast)
  * - Integer operations (I32, I16, U8)
+ * - 512-bit wide operations (16 x F32, 16 x I32, 64 x U8)
+ * - Small-array sorting networks (I32, U32, F32)
+ * - Key rank counting (I32, U32, F32)
+ * - Whole-array kernels: reductions, axpy, scaling, clamping, prefix sums and
+ *   compare-to-mask (F32, I32, I16, U8)
+ * - Byte scanning: find, find-last, find-any, count and equality (U8)
+ * - Half-precision conversion (F32 <-> vl_half_t)
  *
  * \note Read-only after vlSIMDInit(). Modifying this after initialization
  *       will cause undefined behavior.
@@ -423,6 +650,79 @@ typedef struct
     vl_simd_add_vec8i16_fn add_vec8i16;
     vl_simd_load_vec32u8_fn load_vec32u8;
     vl_simd_store_vec32u8_fn store_vec32u8;
+    vl_simd_load_vec16f32_fn load_vec16f32;
+    vl_simd_store_vec16f32_fn store_vec16f32;
+    vl_simd_splat_vec16f32_fn splat_vec16f32;
+    vl_simd_add_vec16f32_fn add_vec16f32;
+    vl_simd_sub_vec16f32_fn sub_vec16f32;
+    vl_simd_mul_vec16f32_fn mul_vec16f32;
+    vl_simd_fma_vec16f32_fn fma_vec16f32;
+    vl_simd_hsum_vec16f32_fn hsum_vec16f32;
+    vl_simd_load_vec16i32_fn load_vec16i32;
+    vl_simd_store_vec16i32_fn store_vec16i32;
+    vl_simd_add_vec16i32_fn add_vec16i32;
+    vl_simd_mul_vec16i32_fn mul_vec16i32;
+    vl_simd_load_vec64u8_fn load_vec64u8;
+    vl_simd_store_vec64u8_fn store_vec64u8;
+    vl_simd_eqmask_vec64u8_fn eqmask_vec64u8;
+    vl_simd_sort_i32_fn sort_i32;
+    vl_simd_sort_u32_fn sort_u32;
+    vl_simd_sort_f32_fn sort_f32;
+    vl_simd_rank_i32_fn rank_i32;
+    vl_simd_rank_u32_fn rank_u32;
+    vl_simd_rank_f32_fn rank_f32;
+    vl_simd_sum_f32_fn sum_f32;
+    vl_simd_sum_i32_fn sum_i32;
+    vl_simd_sum_i16_fn sum_i16;
+    vl_simd_sum_u8_fn sum_u8;
+    vl_simd_dot_f32_fn dot_f32;
+    vl_simd_dot_i32_fn dot_i32;
+    vl_simd_dot_i16_fn dot_i16;
+    vl_simd_axpy_f32_fn axpy_f32;
+    vl_simd_axpy_i32_fn axpy_i32;
+    vl_simd_scale_f32_fn scale_f32;
+    vl_simd_scale_i32_fn scale_i32;
+    vl_simd_minmax_f32_fn minmax_f32;
+    vl_simd_minmax_i32_fn minmax_i32;
+    vl_simd_minmax_i16_fn minmax_i16;
+    vl_simd_minmax_u8_fn minmax_u8;
+    vl_simd_argmin_f32_fn argmin_f32;
+    vl_simd_argmin_i32_fn argmin_i32;
+    vl_simd_argmin_i16_fn argmin_i16;
+    vl_simd_argmin_u8_fn argmin_u8;
+    vl_simd_clamp_f32_fn clamp_f32;
+    vl_simd_clamp_i32_fn clamp_i32;
+    vl_simd_clamp_i16_fn clamp_i16;
+    vl_simd_clamp_u8_fn clamp_u8;
+    vl_simd_prefix_sum_f32_fn prefix_sum_f32;
+    vl_simd_prefix_sum_i32_fn prefix_sum_i32;
+    vl_simd_compare_f32_fn compare_f32;
+    vl_simd_compare_i32_fn compare_i32;
+    vl_simd_compare_i16_fn compare_i16;
+    vl_simd_compare_u8_fn compare_u8;
+    vl_simd_find_u8_fn find_u8;
+    vl_simd_find_last_u8_fn find_last_u8;
+    vl_simd_find_any_u8_fn find_any_u8;
+    vl_simd_count_u8_fn count_u8;
+    vl_simd_equal_u8_fn equal_u8;
+    vl_simd_convert_f32_to_half_fn convert_f32_to_half;
+    vl_simd_convert_half_to_f32_fn convert_half_to_f32;
+    vl_simd_convert_i32_to_f32_fn convert_i32_to_f32;
+    vl_simd_convert_f32_to_i32_fn convert_f32_to_i32;
+    vl_simd_convert_i16_to_f32_fn convert_i16_to_f32;
+    vl_simd_convert_u8_to_f32_fn convert_u8_to_f32;
+    vl_simd_convert_f32_to_f64_fn convert_f32_to_f64;
+    vl_simd_convert_f64_to_f32_fn convert_f64_to_f32;
+    vl_simd_convert_i16_to_i32_fn convert_i16_to_i32;
+    vl_simd_convert_i32_to_i16_fn convert_i32_to_i16;
+    vl_simd_byteswap_u16_fn byteswap_u16;
+    vl_simd_byteswap_u32_fn byteswap_u32;
+    vl_simd_byteswap_u64_fn byteswap_u64;
+    vl_simd_gather_fn gather_32;
+    vl_simd_gather_fn gather_64;
+    vl_simd_xoshiro_u64_fn xoshiro_u64;
+    vl_simd_xoshiro_f32_fn xoshiro_f32;
+    vl_simd_xoshiro_f64_fn xoshiro_f64;
 
     /** \brief Backend name string for logging/debugging (e.g., "AVX2", "NEON64").
      */
@@ -453,13 +753,14 @@ VL_API extern vl_simd_functions_t vlSIMDFunctions;
  *
  * ## Backend Selection Algorithm
  *
- * 1. **x86/x86-64**: Check for AVX2 → SSE2 → fallback to Portable C
+ * 1. **x86/x86-64**: Check for AVX-512 → AVX2 → SSE2 → fallback to Portable C
  * 2. **ARM64**: Use NEON64 (guaranteed available) → fallback to Portable C
  * 3. **ARM32**: Use NEON (if available) → fallback to Portable C
  * 4. **Other**: Use Portable C
  *
  * CPU capability detection uses:
  * - CPUID instruction (x86/MSVC and GCC/Clang)
+ * - XGETBV, to confirm the OS saves AVX and AVX-512 register state (x86)
  * - Compile-time guarantees (ARM with -mfpu=neon)
  *
  * ## Example
@@ -478,7 +779,7 @@ VL_API extern vl_simd_functions_t vlSIMDFunctions;
  * ```
  *
  * \return Pointer to a static string naming the selected backend.
- *         Examples: "SSE2", "AVX2", "NEON64", "NEON (ARMv7)", "Portable C".
+ *         Examples: "SSE2", "AVX2", "AVX-512", "NEON64", "NEON (ARMv7)", "Portable C".
  *         Pointer is valid for the lifetime of the program.
  *
  * \note Safe to call from any thread. Repeated calls are safe and return
@@ -488,6 +789,43 @@ VL_API extern vl_simd_functions_t vlSIMDFunctions;
  */
 VL_API const char* vlSIMDInit(void);
 
+/**
+ * \brief Identifies one SIMD backend, for vlSIMDUseBackend.
+ */
+typedef enum
+{
+    VL_SIMD_BACKEND_PORTABLE,
+    VL_SIMD_BACKEND_SSE2,
+    VL_SIMD_BACKEND_AVX2,
+    VL_SIMD_BACKEND_NEON,
+    VL_SIMD_BACKEND_NEON64,
+    VL_SIMD_BACKEND_AVX512,
+    VL_SIMD_BACKEND_COUNT
+} vl_simd_backend;
+
+/**
+ * \brief Switches vlSIMDFunctions to a specific backend.
+ *
+ * Intended for tests and benchmarks that compare backends on one machine.
+ * Once a backend has been chosen this way, vlSIMDInit keeps it.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: The selection lasts until the next call.
+ * - **Thread Safety**: Not thread-safe. No other thread may use SIMD functions during the call.
+ * - **Nullability**: N/A.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the table unchanged if the backend was not compiled in or
+ * the CPU does not support it.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if the backend is now active.
+ *
+ * \param backend backend to activate
+ * \return whether the backend is now active
+ * \sa vlSIMDInit
+ */
+VL_API vl_bool_t vlSIMDUseBackend(vl_simd_backend backend);
+
 /* ============================================================================
  * Inline API (User-Facing)
  *
@@ -934,108 +1272,1216 @@ static inline vl_simd_vec32_u8 vlSIMDLoadVec32U8(const vl_uint8_t* ptr) { return
  */
 static inline void vlSIMDStoreVec32U8(vl_uint8_t* ptr, vl_simd_vec32_u8 v) { vlSIMDFunctions.store_vec32u8(ptr, v); }
 
+/* --- Sorting Networks --- */
+
 /**
- * \brief Broadcasts a scalar into all 8 lanes.
+ * \brief Sorts a small array of 32-bit signed integers in place.
  *
- * \param scalar Float value to replicate.
- * \return Vector with all 8 elements set to scalar.
+ * Keys are padded to a power of two in a stack buffer and sorted with a
+ * bitonic network whose compare-exchange steps run across whole vectors.
+ *
+ * \param data Pointer to the keys.
+ * \param count Number of keys, at most VL_SIMD_SORT_NETWORK_MAX.
+ *
+ * \sa vlSortNumeric
  */
-static inline vl_simd_vec8_f32 vlSIMDSplatVec8F32(vl_float32_t scalar) { return vlSIMDFunctions.splat_vec8f32(scalar); }
+static inline void vlSIMDSortI32(vl_int32_t* data, vl_dsidx_t count) { vlSIMDFunctions.sort_i32(data, count); }
 
 /**
- * \brief Element-wise subtraction of two 8-float vectors.
+ * \brief Sorts a small array of 32-bit unsigned integers in place.
  *
- * \param a Minuend vector.
- * \param b Subtrahend vector.
- * \return Result vector with element-wise difference.
+ * \param data Pointer to the keys.
+ * \param count Number of keys, at most VL_SIMD_SORT_NETWORK_MAX.
+ *
+ * \sa vlSIMDSortI32
  */
-static inline vl_simd_vec8_f32 vlSIMDSubVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline void vlSIMDSortU32(vl_uint32_t* data, vl_dsidx_t count) { vlSIMDFunctions.sort_u32(data, count); }
+
+/**
+ * \brief Sorts a small array of 32-bit floats in place.
+ *
+ * Floats are ordered by their bit patterns as
+ * `-NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN`, matching vlSortRadix.
+ *
+ * \param data Pointer to the keys.
+ * \param count Number of keys, at most VL_SIMD_SORT_NETWORK_MAX.
+ *
+ * \sa vlSIMDSortI32
+ */
+static inline void vlSIMDSortF32(vl_float32_t* data, vl_dsidx_t count) { vlSIMDFunctions.sort_f32(data, count); }
+
+/* --- Key Ranking --- */
+
+/**
+ * \brief Counts the 32-bit signed keys that order before `key`.
+ *
+ * With `inclusive` set, keys equal to `key` are counted too. The keys need
+ * not be sorted; on a sorted array the result is the lower (or upper) bound
+ * of `key`.
+ *
+ * \param keys Pointer to the keys.
+ * \param count Number of keys.
+ * \param key Probe key.
+ * \param inclusive Whether keys equal to `key` are counted.
+ * \return Number of keys less than (or not greater than) `key`.
+ *
+ * \sa vlSearchLowerBound
+ */
+static inline vl_dsidx_t vlSIMDRankI32(const vl_int32_t* keys, vl_dsidx_t count, vl_int32_t key, vl_bool_t inclusive)
 {
-    return vlSIMDFunctions.sub_vec8f32(a, b);
+    return vlSIMDFunctions.rank_i32(keys, count, key, inclusive);
 }
 
-/* --- 8-Wide Float (F32) Comparisons --- */
+/**
+ * \brief Counts the 32-bit unsigned keys that order before `key`.
+ *
+ * \param keys Pointer to the keys.
+ * \param count Number of keys.
+ * \param key Probe key.
+ * \param inclusive Whether keys equal to `key` are counted.
+ * \return Number of keys less than (or not greater than) `key`.
+ *
+ * \sa vlSIMDRankI32
+ */
+static inline vl_dsidx_t vlSIMDRankU32(const vl_uint32_t* keys, vl_dsidx_t count, vl_uint32_t key,
+                                       vl_bool_t inclusive)
+{
+    return vlSIMDFunctions.rank_u32(keys, count, key, inclusive);
+}
 
 /**
- * \brief Element-wise less-than comparison for 8-float vectors.
+ * \brief Counts the 32-bit floats that order before `key`.
  *
- * \param a First vector.
- * \param b Second vector.
- * \return Mask vector: [a[i] < b[i] ? 0xFFFFFFFF : 0x00000000 for i in 0..7].
+ * Floats compare by the same total order as vlSIMDSortF32, so `-0.0` ranks
+ * before `+0.0` and NaNs rank at the ends.
+ *
+ * \param keys Pointer to the keys.
+ * \param count Number of keys.
+ * \param key Probe key.
+ * \param inclusive Whether keys equal to `key` are counted.
+ * \return Number of keys less than (or not greater than) `key`.
+ *
+ * \sa vlSIMDRankI32
  */
-static inline vl_simd_vec8_f32 vlSIMDLtVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline vl_dsidx_t vlSIMDRankF32(const vl_float32_t* keys, vl_dsidx_t count, vl_float32_t key,
+                                       vl_bool_t inclusive)
 {
-    return vlSIMDFunctions.lt_vec8f32(a, b);
+    return vlSIMDFunctions.rank_f32(keys, count, key, inclusive);
 }
 
+/* --- Array Kernels: Reductions --- */
+
 /**
- * \brief Element-wise greater-than comparison for 8-float vectors.
+ * \brief Sums an array of 32-bit floats.
  *
- * \param a First vector.
- * \param b Second vector.
- * \return Mask vector: [a[i] > b[i] ? 0xFFFFFFFF : 0x00000000 for i in 0..7].
+ * Lanes accumulate independently and are combined at the end, so the result
+ * may differ from a sequential sum by rounding.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Sum of the elements, or 0 if `count` is 0.
  */
-static inline vl_simd_vec8_f32 vlSIMDGtVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline vl_float32_t vlSIMDSumF32(const vl_float32_t* data, vl_dsidx_t count)
 {
-    return vlSIMDFunctions.gt_vec8f32(a, b);
+    return vlSIMDFunctions.sum_f32(data, count);
 }
 
 /**
- * \brief Element-wise equality comparison for 8-float vectors.
+ * \brief Sums an array of 32-bit signed integers into a 64-bit total, without overflow.
  *
- * \param a First vector.
- * \param b Second vector.
- * \return Mask vector: [a[i] == b[i] ? 0xFFFFFFFF : 0x00000000 for i in 0..7].
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Sum of the elements.
+ *
+ * \sa vlSIMDSumF32
  */
-static inline vl_simd_vec8_f32 vlSIMDEqVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline vl_int64_t vlSIMDSumI32(const vl_int32_t* data, vl_dsidx_t count)
 {
-    return vlSIMDFunctions.eq_vec8f32(a, b);
+    return vlSIMDFunctions.sum_i32(data, count);
 }
 
-/* --- 8-Wide Float (F32) Bitwise Operations --- */
+/**
+ * \brief Sums an array of 16-bit signed integers into a 64-bit total, without overflow.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Sum of the elements.
+ *
+ * \sa vlSIMDSumF32
+ */
+static inline vl_int64_t vlSIMDSumI16(const vl_int16_t* data, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.sum_i16(data, count);
+}
 
 /**
- * \brief Bitwise AND on 8-float vector bit patterns.
+ * \brief Sums an array of 8-bit unsigned integers into a 64-bit total, without overflow.
  *
- * \param a First vector.
- * \param b Second vector.
- * \return Result with bitwise AND applied to each lane.
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Sum of the elements.
+ *
+ * \sa vlSIMDSumF32
  */
-static inline vl_simd_vec8_f32 vlSIMDAndVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline vl_uint64_t vlSIMDSumU8(const vl_uint8_t* data, vl_dsidx_t count)
 {
-    return vlSIMDFunctions.and_vec8f32(a, b);
+    return vlSIMDFunctions.sum_u8(data, count);
 }
 
 /**
- * \brief Bitwise OR on 8-float vector bit patterns.
+ * \brief Computes the dot product of two arrays of 32-bit floats.
  *
- * \param a First vector.
- * \param b Second vector.
- * \return Result with bitwise OR applied to each lane.
+ * As with vlSIMDSumF32, the summation order differs from a sequential loop.
+ *
+ * \param a First array.
+ * \param b Second array.
+ * \param count Number of elements in each array.
+ * \return Sum of `a[i] * b[i]`.
  */
-static inline vl_simd_vec8_f32 vlSIMDOrVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline vl_float32_t vlSIMDDotF32(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
 {
-    return vlSIMDFunctions.or_vec8f32(a, b);
+    return vlSIMDFunctions.dot_f32(a, b, count);
 }
 
 /**
- * \brief Bitwise XOR on 8-float vector bit patterns.
+ * \brief Computes the dot product of two arrays of 32-bit signed integers with 64-bit accumulation.
  *
- * \param a First vector.
- * \param b Second vector.
- * \return Result with bitwise XOR applied to each lane.
+ * \param a First array.
+ * \param b Second array.
+ * \param count Number of elements in each array.
+ * \return Sum of `a[i] * b[i]`.
+ *
+ * \sa vlSIMDDotF32
  */
-static inline vl_simd_vec8_f32 vlSIMDXorVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+static inline vl_int64_t vlSIMDDotI32(const vl_int32_t* a, const vl_int32_t* b, vl_dsidx_t count)
 {
-    return vlSIMDFunctions.xor_vec8f32(a, b);
+    return vlSIMDFunctions.dot_i32(a, b, count);
 }
 
 /**
- * \brief Bitwise NOT on 8-float vector bit patterns.
+ * \brief Computes the dot product of two arrays of 16-bit signed integers with 64-bit accumulation.
  *
- * \param a Input vector.
- * \return Result with all bits inverted in each lane.
+ * \param a First array.
+ * \param b Second array.
+ * \param count Number of elements in each array.
+ * \return Sum of `a[i] * b[i]`.
+ *
+ * \sa vlSIMDDotF32
  */
-static inline vl_simd_vec8_f32 vlSIMDNotVec8F32(vl_simd_vec8_f32 a) { return vlSIMDFunctions.not_vec8f32(a); }
+static inline vl_int64_t vlSIMDDotI16(const vl_int16_t* a, const vl_int16_t* b, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.dot_i16(a, b, count);
+}
+
+/* --- Array Kernels: Element-wise Arithmetic --- */
+
+/**
+ * \brief Computes `y[i] += alpha * x[i]` over two arrays of 32-bit floats.
+ *
+ * Backends with FMA fuse the multiply and add, which rounds once instead of twice.
+ *
+ * \param x Input array.
+ * \param y Array updated in place; must not partially overlap `x`.
+ * \param count Number of elements.
+ * \param alpha Scale applied to `x`.
+ */
+static inline void vlSIMDAxpyF32(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    vlSIMDFunctions.axpy_f32(x, y, count, alpha);
+}
+
+/**
+ * \brief Computes `y[i] += alpha * x[i]` over two arrays of 32-bit signed integers, wrapping on overflow.
+ *
+ * \param x Input array.
+ * \param y Array updated in place; must not partially overlap `x`.
+ * \param count Number of elements.
+ * \param alpha Scale applied to `x`.
+ *
+ * \sa vlSIMDAxpyF32
+ */
+static inline void vlSIMDAxpyI32(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    vlSIMDFunctions.axpy_i32(x, y, count, alpha);
+}
+
+/**
+ * \brief Computes `dst[i] = alpha * src[i]` for 32-bit floats.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ * \param alpha Scale factor.
+ */
+static inline void vlSIMDScaleF32(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t alpha)
+{
+    vlSIMDFunctions.scale_f32(src, dst, count, alpha);
+}
+
+/**
+ * \brief Computes `dst[i] = alpha * src[i]` for 32-bit signed integers, wrapping on overflow.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ * \param alpha Scale factor.
+ *
+ * \sa vlSIMDScaleF32
+ */
+static inline void vlSIMDScaleI32(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    vlSIMDFunctions.scale_i32(src, dst, count, alpha);
+}
+
+/* --- Array Kernels: Min, Max and Clamp --- */
+
+/**
+ * \brief Finds the smallest and largest elements of an array of 32-bit floats.
+ *
+ * The result is unspecified if the array contains NaN.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param outMin Receives the minimum; may be `NULL`.
+ * \param outMax Receives the maximum; may be `NULL`.
+ * \return `VL_FALSE` without writing the outputs if `count` is 0.
+ */
+static inline vl_bool_t vlSIMDMinMaxF32(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* outMin,
+                                        vl_float32_t* outMax)
+{
+    return vlSIMDFunctions.minmax_f32(data, count, outMin, outMax);
+}
+
+/**
+ * \brief Finds the smallest and largest elements of an array of 32-bit signed integers.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param outMin Receives the minimum; may be `NULL`.
+ * \param outMax Receives the maximum; may be `NULL`.
+ * \return `VL_FALSE` without writing the outputs if `count` is 0.
+ *
+ * \sa vlSIMDMinMaxF32
+ */
+static inline vl_bool_t vlSIMDMinMaxI32(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* outMin,
+                                        vl_int32_t* outMax)
+{
+    return vlSIMDFunctions.minmax_i32(data, count, outMin, outMax);
+}
+
+/**
+ * \brief Finds the smallest and largest elements of an array of 16-bit signed integers.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param outMin Receives the minimum; may be `NULL`.
+ * \param outMax Receives the maximum; may be `NULL`.
+ * \return `VL_FALSE` without writing the outputs if `count` is 0.
+ *
+ * \sa vlSIMDMinMaxF32
+ */
+static inline vl_bool_t vlSIMDMinMaxI16(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* outMin,
+                                        vl_int16_t* outMax)
+{
+    return vlSIMDFunctions.minmax_i16(data, count, outMin, outMax);
+}
+
+/**
+ * \brief Finds the smallest and largest elements of an array of 8-bit unsigned integers.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param outMin Receives the minimum; may be `NULL`.
+ * \param outMax Receives the maximum; may be `NULL`.
+ * \return `VL_FALSE` without writing the outputs if `count` is 0.
+ *
+ * \sa vlSIMDMinMaxF32
+ */
+static inline vl_bool_t vlSIMDMinMaxU8(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* outMin, vl_uint8_t* outMax)
+{
+    return vlSIMDFunctions.minmax_u8(data, count, outMin, outMax);
+}
+
+/**
+ * \brief Finds the index of the first smallest element of an array of 32-bit floats.
+ *
+ * The array is reduced to its minimum, then scanned for the first element
+ * equal to it. If the array contains NaN, the result is an unspecified valid index.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Index of the minimum, or VL_STRUCTURE_INDEX_MAX if `count` is 0.
+ */
+static inline vl_dsidx_t vlSIMDArgMinF32(const vl_float32_t* data, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.argmin_f32(data, count);
+}
+
+/**
+ * \brief Finds the index of the first smallest element of an array of 32-bit signed integers.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Index of the minimum, or VL_STRUCTURE_INDEX_MAX if `count` is 0.
+ *
+ * \sa vlSIMDArgMinF32
+ */
+static inline vl_dsidx_t vlSIMDArgMinI32(const vl_int32_t* data, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.argmin_i32(data, count);
+}
+
+/**
+ * \brief Finds the index of the first smallest element of an array of 16-bit signed integers.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Index of the minimum, or VL_STRUCTURE_INDEX_MAX if `count` is 0.
+ *
+ * \sa vlSIMDArgMinF32
+ */
+static inline vl_dsidx_t vlSIMDArgMinI16(const vl_int16_t* data, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.argmin_i16(data, count);
+}
+
+/**
+ * \brief Finds the index of the first smallest element of an array of 8-bit unsigned integers.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \return Index of the minimum, or VL_STRUCTURE_INDEX_MAX if `count` is 0.
+ *
+ * \sa vlSIMDArgMinF32
+ */
+static inline vl_dsidx_t vlSIMDArgMinU8(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.argmin_u8(data, count);
+}
+
+/**
+ * \brief Clamps every element of an array of 32-bit floats to `[lo, hi]`.
+ *
+ * Computes `min(max(src[i], lo), hi)`. The result for NaN elements is unspecified.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ * \param lo Lower bound.
+ * \param hi Upper bound; must not be less than `lo`.
+ */
+static inline void vlSIMDClampF32(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t lo,
+                                  vl_float32_t hi)
+{
+    vlSIMDFunctions.clamp_f32(src, dst, count, lo, hi);
+}
+
+/**
+ * \brief Clamps every element of an array of 32-bit signed integers to `[lo, hi]`.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ * \param lo Lower bound.
+ * \param hi Upper bound; must not be less than `lo`.
+ *
+ * \sa vlSIMDClampF32
+ */
+static inline void vlSIMDClampI32(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t lo,
+                                  vl_int32_t hi)
+{
+    vlSIMDFunctions.clamp_i32(src, dst, count, lo, hi);
+}
+
+/**
+ * \brief Clamps every element of an array of 16-bit signed integers to `[lo, hi]`.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ * \param lo Lower bound.
+ * \param hi Upper bound; must not be less than `lo`.
+ *
+ * \sa vlSIMDClampF32
+ */
+static inline void vlSIMDClampI16(const vl_int16_t* src, vl_int16_t* dst, vl_dsidx_t count, vl_int16_t lo,
+                                  vl_int16_t hi)
+{
+    vlSIMDFunctions.clamp_i16(src, dst, count, lo, hi);
+}
+
+/**
+ * \brief Clamps every element of an array of 8-bit unsigned integers to `[lo, hi]`.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ * \param lo Lower bound.
+ * \param hi Upper bound; must not be less than `lo`.
+ *
+ * \sa vlSIMDClampF32
+ */
+static inline void vlSIMDClampU8(const vl_uint8_t* src, vl_uint8_t* dst, vl_dsidx_t count, vl_uint8_t lo, vl_uint8_t hi)
+{
+    vlSIMDFunctions.clamp_u8(src, dst, count, lo, hi);
+}
+
+/* --- Array Kernels: Prefix Sums --- */
+
+/**
+ * \brief Computes the inclusive prefix sum of an array of 32-bit floats.
+ *
+ * `dst[i]` receives `src[0] + ... + src[i]`. Each vector is scanned in
+ * registers, so results may differ from a sequential scan by rounding.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ */
+static inline void vlSIMDPrefixSumF32(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.prefix_sum_f32(src, dst, count);
+}
+
+/**
+ * \brief Computes the inclusive prefix sum of an array of 32-bit signed integers, wrapping on overflow.
+ *
+ * \param src Input array.
+ * \param dst Output array; may equal `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlSIMDPrefixSumF32
+ */
+static inline void vlSIMDPrefixSumI32(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.prefix_sum_i32(src, dst, count);
+}
+
+/* --- Array Kernels: Compare to Mask --- */
+
+/**
+ * \brief Compares every element of an array of 32-bit floats to a scalar, producing a bit mask.
+ *
+ * Bit `i % 8` of `mask[i / 8]` is set when `data[i] <op> value` holds. Unused
+ * bits of the final byte are cleared. Comparisons follow IEEE 754, so NaN
+ * elements only satisfy VL_SIMD_CMP_NE.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param value Scalar to compare against.
+ * \param op Comparison to apply.
+ * \param mask Receives `(count + 7) / 8` bytes.
+ * \return Number of elements that satisfied the comparison.
+ */
+static inline vl_dsidx_t vlSIMDCompareF32(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t value,
+                                          vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    return vlSIMDFunctions.compare_f32(data, count, value, op, mask);
+}
+
+/**
+ * \brief Compares every element of an array of 32-bit signed integers to a scalar, producing a bit mask.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param value Scalar to compare against.
+ * \param op Comparison to apply.
+ * \param mask Receives `(count + 7) / 8` bytes.
+ * \return Number of elements that satisfied the comparison.
+ *
+ * \sa vlSIMDCompareF32
+ */
+static inline vl_dsidx_t vlSIMDCompareI32(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t value, vl_simd_cmp_op op,
+                                          vl_uint8_t* mask)
+{
+    return vlSIMDFunctions.compare_i32(data, count, value, op, mask);
+}
+
+/**
+ * \brief Compares every element of an array of 16-bit signed integers to a scalar, producing a bit mask.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param value Scalar to compare against.
+ * \param op Comparison to apply.
+ * \param mask Receives `(count + 7) / 8` bytes.
+ * \return Number of elements that satisfied the comparison.
+ *
+ * \sa vlSIMDCompareF32
+ */
+static inline vl_dsidx_t vlSIMDCompareI16(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t value, vl_simd_cmp_op op,
+                                          vl_uint8_t* mask)
+{
+    return vlSIMDFunctions.compare_i16(data, count, value, op, mask);
+}
+
+/**
+ * \brief Compares every element of an array of 8-bit unsigned integers to a scalar, producing a bit mask.
+ *
+ * \param data Pointer to the elements.
+ * \param count Number of elements.
+ * \param value Scalar to compare against.
+ * \param op Comparison to apply.
+ * \param mask Receives `(count + 7) / 8` bytes.
+ * \return Number of elements that satisfied the comparison.
+ *
+ * \sa vlSIMDCompareF32
+ */
+static inline vl_dsidx_t vlSIMDCompareU8(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value, vl_simd_cmp_op op,
+                                         vl_uint8_t* mask)
+{
+    return vlSIMDFunctions.compare_u8(data, count, value, op, mask);
+}
+
+/* --- Array Kernels: Byte Scanning --- */
+
+/**
+ * \brief Finds the first occurrence of a byte in an array.
+ *
+ * Equivalent to `memchr` over exactly `count` bytes; no byte past the end is
+ * read, so the array does not need a terminator.
+ *
+ * \param data Pointer to the bytes.
+ * \param count Number of bytes.
+ * \param value Byte to look for.
+ * \return Index of the first byte equal to `value`, or `count` if there is none.
+ */
+static inline vl_dsidx_t vlSIMDFindU8(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    return vlSIMDFunctions.find_u8(data, count, value);
+}
+
+/**
+ * \brief Finds the last occurrence of a byte in an array.
+ *
+ * \param data Pointer to the bytes.
+ * \param count Number of bytes.
+ * \param value Byte to look for.
+ * \return Index of the last byte equal to `value`, or `count` if there is none.
+ *
+ * \sa vlSIMDFindU8
+ */
+static inline vl_dsidx_t vlSIMDFindLastU8(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    return vlSIMDFunctions.find_last_u8(data, count, value);
+}
+
+/**
+ * \brief Finds the first byte of an array that belongs to a set of bytes.
+ *
+ * Each vector is compared against every member of the set, so this is meant
+ * for small sets such as separators or delimiters. Sets of more than 16 bytes
+ * are matched through a lookup table instead.
+ *
+ * \param data Pointer to the bytes.
+ * \param count Number of bytes.
+ * \param set Bytes to look for; duplicates are allowed.
+ * \param setCount Number of bytes in `set`.
+ * \return Index of the first byte found in `set`, or `count` if there is none.
+ *
+ * \sa vlSIMDFindU8
+ */
+static inline vl_dsidx_t vlSIMDFindAnyU8(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                         vl_dsidx_t setCount)
+{
+    return vlSIMDFunctions.find_any_u8(data, count, set, setCount);
+}
+
+/**
+ * \brief Counts the occurrences of a byte in an array.
+ *
+ * \param data Pointer to the bytes.
+ * \param count Number of bytes.
+ * \param value Byte to count.
+ * \return Number of bytes equal to `value`.
+ */
+static inline vl_dsidx_t vlSIMDCountU8(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    return vlSIMDFunctions.count_u8(data, count, value);
+}
+
+/**
+ * \brief Tests two byte arrays of the same length for equality.
+ *
+ * Equivalent to `memcmp(a, b, count) == 0` without the ordering result, and
+ * returns as soon as one vector differs.
+ *
+ * \param a First array.
+ * \param b Second array.
+ * \param count Number of bytes in each array.
+ * \return VL_TRUE if every byte matches, including when `count` is zero.
+ */
+static inline vl_bool_t vlSIMDEqualU8(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    return vlSIMDFunctions.equal_u8(a, b, count);
+}
+
+/* --- Array Kernels: Half-Precision Conversion --- */
+
+/**
+ * \brief Converts an array of 32-bit floats to half precision.
+ *
+ * Rounds to nearest, ties to even, regardless of the current floating-point
+ * environment. Every element matches vlHalfFromFloat bit for bit, including
+ * subnormals, overflow to infinity and NaN payloads.
+ *
+ * \param src Input floats.
+ * \param dst Output halves; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlHalfFromFloat
+ */
+static inline void vlSIMDConvertF32ToHalf(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_f32_to_half(src, dst, count);
+}
+
+/**
+ * \brief Converts an array of half-precision values to 32-bit floats.
+ *
+ * The conversion is exact; every element matches vlHalfToFloat bit for bit.
+ *
+ * \param src Input halves.
+ * \param dst Output floats; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlHalfToFloat
+ */
+static inline void vlSIMDConvertHalfToF32(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_half_to_f32(src, dst, count);
+}
+
+/* --- Array Kernels: Numeric Type Conversion --- */
+
+/**
+ * \brief Converts an array of 32-bit integers to floats.
+ *
+ * Equivalent to `dst[i] = (vl_float32_t)src[i]`; values beyond 2^24 round to
+ * nearest even.
+ *
+ * \param src Input integers.
+ * \param dst Output floats; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertI32ToF32(const vl_int32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_i32_to_f32(src, dst, count);
+}
+
+/**
+ * \brief Converts an array of floats to 32-bit integers, truncating toward zero.
+ *
+ * Equivalent to `dst[i] = (vl_int32_t)src[i]`. As with the C cast, the result
+ * for NaN and for values outside the range of vl_int32_t is unspecified; x86
+ * backends produce INT32_MIN and ARM backends saturate.
+ *
+ * \param src Input floats.
+ * \param dst Output integers; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertF32ToI32(const vl_float32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_f32_to_i32(src, dst, count);
+}
+
+/**
+ * \brief Converts an array of 16-bit integers to floats. The conversion is exact.
+ *
+ * \param src Input integers.
+ * \param dst Output floats; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertI16ToF32(const vl_int16_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_i16_to_f32(src, dst, count);
+}
+
+/**
+ * \brief Converts an array of bytes to floats. The conversion is exact.
+ *
+ * \param src Input bytes.
+ * \param dst Output floats; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertU8ToF32(const vl_uint8_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_u8_to_f32(src, dst, count);
+}
+
+/**
+ * \brief Widens an array of floats to doubles. The conversion is exact.
+ *
+ * ARMv7 NEON has no double-precision vectors and converts one element at a time.
+ *
+ * \param src Input floats.
+ * \param dst Output doubles; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertF32ToF64(const vl_float32_t* src, vl_float64_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_f32_to_f64(src, dst, count);
+}
+
+/**
+ * \brief Narrows an array of doubles to floats, rounding to nearest even.
+ *
+ * ARMv7 NEON has no double-precision vectors and converts one element at a time.
+ *
+ * \param src Input doubles.
+ * \param dst Output floats; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertF64ToF32(const vl_float64_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_f64_to_f32(src, dst, count);
+}
+
+/**
+ * \brief Sign-extends an array of 16-bit integers to 32 bits.
+ *
+ * \param src Input integers.
+ * \param dst Output integers; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertI16ToI32(const vl_int16_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_i16_to_i32(src, dst, count);
+}
+
+/**
+ * \brief Narrows an array of 32-bit integers to 16 bits, keeping the low 16 bits.
+ *
+ * Values outside the range of vl_int16_t wrap, as the C cast does on every
+ * two's complement target; nothing saturates.
+ *
+ * \param src Input integers.
+ * \param dst Output integers; must not overlap `src`.
+ * \param count Number of elements.
+ *
+ * \sa vlNumTypeCastArray
+ */
+static inline void vlSIMDConvertI32ToI16(const vl_int32_t* src, vl_int16_t* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.convert_i32_to_i16(src, dst, count);
+}
+
+/* --- Array Kernels: Byte Swapping and Gathers --- */
+
+/**
+ * \brief Reverses the two bytes of every element in place.
+ *
+ * \param data Array to convert.
+ * \param count Number of elements.
+ *
+ * \sa vlMemReverseSubArraysStride
+ */
+static inline void vlSIMDByteSwapU16(vl_uint16_t* data, vl_dsidx_t count) { vlSIMDFunctions.byteswap_u16(data, count); }
+
+/**
+ * \brief Reverses the four bytes of every element in place.
+ *
+ * \param data Array to convert.
+ * \param count Number of elements.
+ *
+ * \sa vlMemReverseSubArraysStride
+ */
+static inline void vlSIMDByteSwapU32(vl_uint32_t* data, vl_dsidx_t count) { vlSIMDFunctions.byteswap_u32(data, count); }
+
+/**
+ * \brief Reverses the eight bytes of every element in place.
+ *
+ * \param data Array to convert.
+ * \param count Number of elements.
+ *
+ * \sa vlMemReverseSubArraysStride
+ */
+static inline void vlSIMDByteSwapU64(vl_uint64_t* data, vl_dsidx_t count) { vlSIMDFunctions.byteswap_u64(data, count); }
+
+/**
+ * \brief Copies 4-byte elements from a strided source into a packed array.
+ *
+ * Element `i` is read from `src + i * srcStride`. Neither pointer needs to be
+ * aligned. AVX2 and AVX-512 use hardware gathers when seven (or fifteen)
+ * strides fit in a signed 32-bit offset, and fall back to scalar copies
+ * otherwise.
+ *
+ * \param src First source element.
+ * \param srcStride Bytes between the starts of consecutive source elements.
+ * \param dst Packed destination of `count * 4` bytes; must not overlap the source.
+ * \param count Number of elements.
+ *
+ * \sa vlMemCopyStride
+ */
+static inline void vlSIMDGather32(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.gather_32(src, srcStride, dst, count);
+}
+
+/**
+ * \brief Copies 8-byte elements from a strided source into a packed array.
+ *
+ * As vlSIMDGather32, for 8-byte elements.
+ *
+ * \param src First source element.
+ * \param srcStride Bytes between the starts of consecutive source elements.
+ * \param dst Packed destination of `count * 8` bytes; must not overlap the source.
+ * \param count Number of elements.
+ *
+ * \sa vlMemCopyStride
+ */
+static inline void vlSIMDGather64(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDFunctions.gather_64(src, srcStride, dst, count);
+}
+
+/* --- Array Kernels: Random Number Generation --- */
+
+/**
+ * \brief Steps eight xoshiro256++ generators and writes their raw outputs.
+ *
+ * Each block steps every lane once and writes eight 64-bit words, lane 0
+ * first. The destination needs no alignment.
+ *
+ * \param state 32 words of generator state, laid out as described at VL_SIMD_XOSHIRO_LANES.
+ * \param dst Destination of `blocks * 64` bytes.
+ * \param blocks Number of blocks to generate.
+ *
+ * \sa vlRandXoshiroFill
+ */
+static inline void vlSIMDXoshiroU64(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    vlSIMDFunctions.xoshiro_u64(state, dst, blocks);
+}
+
+/**
+ * \brief Steps eight xoshiro256++ generators and writes floats in [0, 1).
+ *
+ * Each 64-bit output yields two floats, from the top 23 bits of its low and
+ * high halves in that order, so a block writes sixteen floats.
+ *
+ * \param state 32 words of generator state, laid out as described at VL_SIMD_XOSHIRO_LANES.
+ * \param dst Destination of `blocks * 16` floats.
+ * \param blocks Number of blocks to generate.
+ *
+ * \sa vlRandXoshiroFillF
+ */
+static inline void vlSIMDXoshiroF32(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    vlSIMDFunctions.xoshiro_f32(state, dst, blocks);
+}
+
+/**
+ * \brief Steps eight xoshiro256++ generators and writes doubles in [0, 1).
+ *
+ * Each 64-bit output yields one double from its top 52 bits, so a block
+ * writes eight doubles.
+ *
+ * \param state 32 words of generator state, laid out as described at VL_SIMD_XOSHIRO_LANES.
+ * \param dst Destination of `blocks * 8` doubles.
+ * \param blocks Number of blocks to generate.
+ *
+ * \sa vlRandXoshiroFillD
+ */
+static inline void vlSIMDXoshiroF64(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    vlSIMDFunctions.xoshiro_f64(state, dst, blocks);
+}
+
+/**
+ * \brief Broadcasts a scalar into all 8 lanes.
+ *
+ * \param scalar Float value to replicate.
+ * \return Vector with all 8 elements set to scalar.
+ */
+static inline vl_simd_vec8_f32 vlSIMDSplatVec8F32(vl_float32_t scalar) { return vlSIMDFunctions.splat_vec8f32(scalar); }
+
+/**
+ * \brief Element-wise subtraction of two 8-float vectors.
+ *
+ * \param a Minuend vector.
+ * \param b Subtrahend vector.
+ * \return Result vector with element-wise difference.
+ */
+static inline vl_simd_vec8_f32 vlSIMDSubVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.sub_vec8f32(a, b);
+}
+
+/* --- 8-Wide Float (F32) Comparisons --- */
+
+/**
+ * \brief Element-wise less-than comparison for 8-float vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Mask vector: [a[i] < b[i] ? 0xFFFFFFFF : 0x00000000 for i in 0..7].
+ */
+static inline vl_simd_vec8_f32 vlSIMDLtVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.lt_vec8f32(a, b);
+}
+
+/**
+ * \brief Element-wise greater-than comparison for 8-float vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Mask vector: [a[i] > b[i] ? 0xFFFFFFFF : 0x00000000 for i in 0..7].
+ */
+static inline vl_simd_vec8_f32 vlSIMDGtVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.gt_vec8f32(a, b);
+}
+
+/**
+ * \brief Element-wise equality comparison for 8-float vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Mask vector: [a[i] == b[i] ? 0xFFFFFFFF : 0x00000000 for i in 0..7].
+ */
+static inline vl_simd_vec8_f32 vlSIMDEqVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.eq_vec8f32(a, b);
+}
+
+/* --- 8-Wide Float (F32) Bitwise Operations --- */
+
+/**
+ * \brief Bitwise AND on 8-float vector bit patterns.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result with bitwise AND applied to each lane.
+ */
+static inline vl_simd_vec8_f32 vlSIMDAndVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.and_vec8f32(a, b);
+}
+
+/**
+ * \brief Bitwise OR on 8-float vector bit patterns.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result with bitwise OR applied to each lane.
+ */
+static inline vl_simd_vec8_f32 vlSIMDOrVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.or_vec8f32(a, b);
+}
+
+/**
+ * \brief Bitwise XOR on 8-float vector bit patterns.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result with bitwise XOR applied to each lane.
+ */
+static inline vl_simd_vec8_f32 vlSIMDXorVec8F32(vl_simd_vec8_f32 a, vl_simd_vec8_f32 b)
+{
+    return vlSIMDFunctions.xor_vec8f32(a, b);
+}
+
+/**
+ * \brief Bitwise NOT on 8-float vector bit patterns.
+ *
+ * \param a Input vector.
+ * \return Result with all bits inverted in each lane.
+ */
+static inline vl_simd_vec8_f32 vlSIMDNotVec8F32(vl_simd_vec8_f32 a) { return vlSIMDFunctions.not_vec8f32(a); }
+
+/* --- 16-Wide Float (F32) --- */
+
+/**
+ * \brief Loads 16 floats from memory into a vector.
+ *
+ * \param ptr Pointer to array of 16 floats (no alignment required).
+ * \return 16-element float vector.
+ *
+ * \sa vlSIMDStoreVec16F32
+ */
+static inline vl_simd_vec16_f32 vlSIMDLoadVec16F32(const vl_float32_t* ptr)
+{
+    return vlSIMDFunctions.load_vec16f32(ptr);
+}
+
+/**
+ * \brief Stores a 16-float vector to memory.
+ *
+ * \param ptr Pointer to memory for 16 floats.
+ * \param v Vector to store.
+ */
+static inline void vlSIMDStoreVec16F32(vl_float32_t* ptr, vl_simd_vec16_f32 v)
+{
+    vlSIMDFunctions.store_vec16f32(ptr, v);
+}
+
+/**
+ * \brief Replicates a scalar into all 16 lanes.
+ *
+ * \param scalar Value to broadcast.
+ * \return Vector with every lane equal to scalar.
+ */
+static inline vl_simd_vec16_f32 vlSIMDSplatVec16F32(vl_float32_t scalar)
+{
+    return vlSIMDFunctions.splat_vec16f32(scalar);
+}
+
+/**
+ * \brief Element-wise addition of two 16-float vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result vector with element-wise sum.
+ */
+static inline vl_simd_vec16_f32 vlSIMDAddVec16F32(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    return vlSIMDFunctions.add_vec16f32(a, b);
+}
+
+/**
+ * \brief Element-wise subtraction of two 16-float vectors.
+ *
+ * \param a Minuend vector.
+ * \param b Subtrahend vector.
+ * \return Result vector with a - b in each lane.
+ */
+static inline vl_simd_vec16_f32 vlSIMDSubVec16F32(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    return vlSIMDFunctions.sub_vec16f32(a, b);
+}
+
+/**
+ * \brief Element-wise multiplication of two 16-float vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result vector with element-wise product.
+ */
+static inline vl_simd_vec16_f32 vlSIMDMulVec16F32(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    return vlSIMDFunctions.mul_vec16f32(a, b);
+}
+
+/**
+ * \brief 16-wide fused multiply-add: (a * b) + c.
+ *
+ * \param a Multiplier vector.
+ * \param b Multiplicand vector.
+ * \param c Addend vector.
+ * \return Result vector with FMA applied to each lane.
+ *
+ * \note On backends without hardware FMA (SSE2), this is emulated as (a * b) + c.
+ */
+static inline vl_simd_vec16_f32 vlSIMDFmaVec16F32(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b, vl_simd_vec16_f32 c)
+{
+    return vlSIMDFunctions.fma_vec16f32(a, b, c);
+}
+
+/**
+ * \brief Horizontal sum of all 16 lanes.
+ *
+ * The association order differs between backends, so results may differ in
+ * the last bits for inputs that do not add exactly.
+ *
+ * \param v Input vector.
+ * \return Sum of all lanes.
+ */
+static inline vl_float32_t vlSIMDHsumVec16F32(vl_simd_vec16_f32 v) { return vlSIMDFunctions.hsum_vec16f32(v); }
+
+/* --- 16-Wide Integer (I32) --- */
+
+/**
+ * \brief Loads 16 signed 32-bit integers from memory.
+ *
+ * \param ptr Pointer to array of 16 int32 values.
+ * \return 16-element integer vector.
+ *
+ * \sa vlSIMDStoreVec16I32
+ */
+static inline vl_simd_vec16_i32 vlSIMDLoadVec16I32(const vl_int32_t* ptr) { return vlSIMDFunctions.load_vec16i32(ptr); }
+
+/**
+ * \brief Stores a 16-int32 vector to memory.
+ *
+ * \param ptr Pointer to memory for 16 int32 values.
+ * \param v Vector to store.
+ */
+static inline void vlSIMDStoreVec16I32(vl_int32_t* ptr, vl_simd_vec16_i32 v) { vlSIMDFunctions.store_vec16i32(ptr, v); }
+
+/**
+ * \brief Element-wise addition of two 16-int32 vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result vector with element-wise sum (wrapping on overflow).
+ */
+static inline vl_simd_vec16_i32 vlSIMDAddVec16I32(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    return vlSIMDFunctions.add_vec16i32(a, b);
+}
+
+/**
+ * \brief Element-wise multiplication of two 16-int32 vectors.
+ *
+ * \param a First vector.
+ * \param b Second vector.
+ * \return Result vector with the low 32 bits of each product (wrapping on overflow).
+ */
+static inline vl_simd_vec16_i32 vlSIMDMulVec16I32(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    return vlSIMDFunctions.mul_vec16i32(a, b);
+}
+
+/* --- 64-Wide Byte (U8) --- */
+
+/**
+ * \brief Loads 64 unsigned 8-bit integers from memory.
+ *
+ * \param ptr Pointer to array of 64 uint8 values.
+ * \return 64-element 8-bit unsigned integer vector.
+ *
+ * \sa vlSIMDStoreVec64U8
+ */
+static inline vl_simd_vec64_u8 vlSIMDLoadVec64U8(const vl_uint8_t* ptr) { return vlSIMDFunctions.load_vec64u8(ptr); }
+
+/**
+ * \brief Stores a 64-uint8 vector to memory.
+ *
+ * \param ptr Pointer to memory for 64 uint8 values.
+ * \param v Vector to store.
+ */
+static inline void vlSIMDStoreVec64U8(vl_uint8_t* ptr, vl_simd_vec64_u8 v) { vlSIMDFunctions.store_vec64u8(ptr, v); }
+
+/**
+ * \brief Compares all 64 bytes against a scalar.
+ *
+ * Bit `i` of the result is set when byte `i` equals `byte`. Combine masks
+ * with bitwise operators and locate matches with a count of trailing zeros.
+ *
+ * \param v Bytes to compare.
+ * \param byte Value to look for.
+ * \return 64-bit match mask, bit 0 corresponding to byte 0.
+ */
+static inline vl_uint64_t vlSIMDEqMaskVec64U8(vl_simd_vec64_u8 v, vl_uint8_t byte)
+{
+    return vlSIMDFunctions.eqmask_vec64u8(v, byte);
+}
 
 #endif
@@ -0,0 +1,323 @@
+/**
+ * ██    ██ ██       █████  ███████  █████   ██████  ███    ██  █████
+ * ██    ██ ██      ██   ██ ██      ██   ██ ██       ████   ██ ██   ██
+ * ██    ██ ██      ███████ ███████ ███████ ██   ███ ██ ██  ██ ███████
+ *  ██  ██  ██      ██   ██      ██ ██   ██ ██    ██ ██  ██ ██ ██   ██
+ *   ████   ███████ ██   ██ ███████ ██   ██  ██████  ██   ████ ██   ██
+ * ====---: A Data Structure and Algorithms library for C11.  :---====
+ *
+ * Copyright 2026 Jesse Walker, released under the MIT license.
+ * Git Repository:  https://github.com/walkerje/veritable_lasagna
+ * \private
+ */
+
+#ifndef VL_SKIPLIST_H
+#define VL_SKIPLIST_H
+
+#include "vl_async_pool.h"
+#include "vl_atomic.h"
+#include "vl_compare.h"
+
+/**
+ * \brief Maximum number of levels in a skiplist node.
+ *
+ * Each level holds a quarter of the nodes of the level below it, so sixteen
+ * levels keep searches logarithmic up to roughly four billion elements.
+ */
+#define VL_SKIPLIST_MAX_LEVEL 16
+
+/**
+ * \brief Number of node pools in a skiplist.
+ *
+ * Nodes are drawn from one pool per power-of-two height: 1, 2, 4, 8 and 16
+ * levels. A node is allocated from the smallest pool that fits its height.
+ */
+#define VL_SKIPLIST_POOL_COUNT 5
+
+/**
+ * \brief Position of an element within a vl_skiplist.
+ *
+ * An iterator is the address of a node. It remains dereferenceable after the
+ * element is removed, until the next call to vlSkipListReclaim, vlSkipListClear
+ * or vlSkipListFree.
+ */
+typedef vl_uintptr_t vl_skiplist_iter;
+
+/**
+ * \brief Iterator value naming no element.
+ */
+#define VL_SKIPLIST_ITER_INVALID 0
+
+/**
+ * Convenience macro for iterating over a skiplist in ascending order.
+ * \param list pointer
+ * \param trackVar name of the tracking variable used as the iterator
+ */
+#define VL_SKIPLIST_FOREACH(list, trackVar)                                                                            \
+    for (vl_skiplist_iter trackVar = vlSkipListFront(list); (trackVar) != VL_SKIPLIST_ITER_INVALID;                    \
+         (trackVar) = vlSkipListNext(list, trackVar))
+
+/**
+ * \brief A concurrent ordered set, implemented as a lock-free skiplist.
+ *
+ * The vl_skiplist holds unique elements ordered by a comparator, with the same
+ * contract as vl_set: elements are ordered by a key, and may carry
+ * supplementary data in the same block of memory, so the skiplist can serve as
+ * an ordered map.
+ *
+ * Insertion, removal, lookup and iteration may all run concurrently from any
+ * number of threads without external synchronization.
+ *
+ * - Insertion links a node into the bottom level with a single CAS, which is the
+ *   point at which the element becomes visible, then links the upper levels.
+ * - Removal marks the node's forward pointers, top level first. Marking the
+ *   bottom level is the point at which the element is removed. Marked nodes are
+ *   unlinked by whichever thread next walks past them.
+ * - Lookup and iteration only read. They step over marked nodes and never
+ *   retry, so they are not slowed down by concurrent writers.
+ *
+ * Nodes are allocated from vl_async_pool instances, one per height class.
+ * Removed nodes are not handed back to the pools straight away, since another
+ * thread may still be reading them. They are kept on a retired list until
+ * vlSkipListReclaim is called while no other thread is using the skiplist.
+ *
+ * \note Elements are immutable once inserted, as far as the comparator is
+ *       concerned. Supplementary data may be modified in place, but that
+ *       memory is not synchronized by the skiplist.
+ *
+ * \note The \c size field is exact when the skiplist is quiescent, but may lag
+ *       behind concurrent modifications.
+ *
+ * \sa vl_set
+ * \see https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf
+ */
+typedef struct
+{
+    /** Node pools, one per height class. */
+    vl_async_pool nodes[VL_SKIPLIST_POOL_COUNT];
+
+    /** Head sentinel node, with VL_SKIPLIST_MAX_LEVEL levels and no element. */
+    void* head;
+
+    /** Stack of removed nodes awaiting vlSkipListReclaim. */
+    vl_atomic_uintptr_t retired;
+
+    /** Number of elements in the skiplist. */
+    vl_atomic_ularge_t size;
+
+    /** comparator function pointer. see vl_compare. */
+    vl_compare_function comparator;
+
+    /** Size in bytes of each element. */
+    vl_uint16_t elementSize;
+} vl_skiplist;
+
+/**
+ * \brief Number of elements in a skiplist.
+ */
+#define vlSkipListSize(list) ((vl_dsidx_t)vlAtomicLoad(&(list)->size))
+
+/**
+ * \brief Initializes a skiplist holding elements of the specified size.
+ *
+ * ## Contract
+ * - **Ownership**: The caller provides the `list` memory. The skiplist owns its nodes.
+ * - **Lifetime**: The skiplist is valid until `vlSkipListFree` or `vlSkipListDelete`.
+ * - **Thread Safety**: Not thread-safe for the same `list` instance.
+ * - **Nullability**: `list` and `comparator` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: An `elementSize` of 0, or one so large that a node of VL_SKIPLIST_MAX_LEVEL levels no
+ * longer fits in 65535 bytes. Initializing a skiplist twice without freeing it (leaks memory).
+ * - **Memory Allocation Expectations**: Allocates the head node.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param list skiplist to initialize
+ * \param elementSize size of each element, in bytes
+ * \param comparator comparator function; 0 = same, >0 = greater, <0 = lesser.
+ * \par Complexity of O(1) constant.
+ * \sa vlSkipListFree
+ */
+VL_API void vlSkipListInit(vl_skiplist* list, vl_uint16_t elementSize, vl_compare_function comparator);
+
+/**
+ * \brief Frees the nodes of a skiplist, including removed nodes awaiting reclamation.
+ *
+ * \warning No other thread may be using the skiplist.
+ *
+ * \param list skiplist to free
+ * \sa vlSkipListInit
+ */
+VL_API void vlSkipListFree(vl_skiplist* list);
+
+/**
+ * \brief Allocates and initializes a skiplist on the heap.
+ *
+ * \param elementSize size of each element, in bytes
+ * \param comparator comparator function; 0 = same, >0 = greater, <0 = lesser.
+ * \return pointer to the new skiplist, to be deleted with vlSkipListDelete
+ * \sa vlSkipListDelete
+ */
+VL_API vl_skiplist* vlSkipListNew(vl_uint16_t elementSize, vl_compare_function comparator);
+
+/**
+ * \brief Frees and deletes a skiplist created by vlSkipListNew.
+ *
+ * \warning No other thread may be using the skiplist.
+ *
+ * \param list skiplist to delete
+ * \sa vlSkipListNew
+ */
+VL_API void vlSkipListDelete(vl_skiplist* list);
+
+/**
+ * \brief Removes every element from a skiplist, keeping its pool memory.
+ *
+ * \warning No other thread may be using the skiplist. All iterators become invalid.
+ *
+ * \param list skiplist to clear
+ */
+VL_API void vlSkipListClear(vl_skiplist* list);
+
+/**
+ * \brief Returns the nodes of removed elements to the node pools.
+ *
+ * Every level is swept first, so that nodes which were marked but not yet
+ * unlinked are unlinked before being recycled.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: Iterators to removed elements become invalid. Iterators to present elements remain valid.
+ * - **Thread Safety**: Not thread-safe. No other thread may be using the skiplist.
+ * - **Nullability**: `list` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Calling while another thread is using the skiplist.
+ * - **Memory Allocation Expectations**: None. Reclaimed nodes are kept by the pools for reuse.
+ * - **Return-value Semantics**: Returns the number of nodes reclaimed.
+ *
+ * \param list skiplist to reclaim nodes from
+ * \return number of nodes returned to the pools
+ * \par Complexity of O(n) linear.
+ */
+VL_API vl_dsidx_t vlSkipListReclaim(vl_skiplist* list);
+
+/**
+ * \brief Inserts a copy of an element into a skiplist, unless an equal element is present.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged. The skiplist maintains its own copy.
+ * - **Lifetime**: The element is present until it is removed.
+ * - **Thread Safety**: Thread-safe (lock-free).
+ * - **Nullability**: `list` and `elem` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` and leaves the skiplist unchanged if node allocation fails.
+ * - **Undefined Behavior**: Passing an uninitialized skiplist.
+ * - **Memory Allocation Expectations**: May allocate a new block in one of the node pools.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if the element was inserted, or `VL_FALSE` if an equal element was
+ * already present or allocation failed.
+ *
+ * \param list skiplist to insert into
+ * \param elem element to copy
+ * \return VL_TRUE if the element was inserted
+ * \par Complexity of O(log(n)) expected.
+ */
+VL_API vl_bool_t vlSkipListInsert(vl_skiplist* list, const void* elem);
+
+/**
+ * \brief Removes the element equal to `elem` from a skiplist, if there is one.
+ *
+ * When several threads remove the same element concurrently, exactly one of
+ * them succeeds.
+ *
+ * ## Contract
+ * - **Ownership**: The removed element is copied to `dest`, if given.
+ * - **Lifetime**: The removed node stays readable through existing iterators until vlSkipListReclaim.
+ * - **Thread Safety**: Thread-safe (lock-free).
+ * - **Nullability**: `list` and `elem` must not be `NULL`. `dest` may be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an uninitialized skiplist.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if this call removed an element.
+ *
+ * \param list skiplist to remove from
+ * \param elem element to find
+ * \param dest destination for the removed element, or `NULL`
+ * \return VL_TRUE if an element was removed
+ * \par Complexity of O(log(n)) expected.
+ */
+VL_API vl_bool_t vlSkipListRemove(vl_skiplist* list, const void* elem, void* dest);
+
+/**
+ * \brief Finds the element equal to `elem`.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: The iterator remains dereferenceable until vlSkipListReclaim, even if the element is removed.
+ * - **Thread Safety**: Thread-safe. Only reads shared memory.
+ * - **Nullability**: `list` and `elem` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an uninitialized skiplist.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns an iterator to the element, or `VL_SKIPLIST_ITER_INVALID`.
+ *
+ * \param list skiplist to search
+ * \param elem element to find
+ * \return iterator to the element, or VL_SKIPLIST_ITER_INVALID if there is none
+ * \par Complexity of O(log(n)) expected.
+ */
+VL_API vl_skiplist_iter vlSkipListFind(const vl_skiplist* list, const void* elem);
+
+/**
+ * \brief Finds the first element that does not order before `elem`.
+ *
+ * Together with vlSkipListNext, this is the starting point of a range scan.
+ *
+ * \param list skiplist to search
+ * \param elem element to compare against
+ * \return iterator to the element, or VL_SKIPLIST_ITER_INVALID if every element orders before `elem`
+ * \par Complexity of O(log(n)) expected.
+ */
+VL_API vl_skiplist_iter vlSkipListLowerBound(const vl_skiplist* list, const void* elem);
+
+/**
+ * \brief Returns an iterator to the smallest element.
+ *
+ * \param list skiplist
+ * \return iterator to the first element, or VL_SKIPLIST_ITER_INVALID if the skiplist is empty
+ * \par Complexity of O(1) amortized.
+ */
+VL_API vl_skiplist_iter vlSkipListFront(const vl_skiplist* list);
+
+/**
+ * \brief Returns an iterator to the next element in ascending order.
+ *
+ * The iterator may name an element that has since been removed. The walk
+ * then continues from where that element was, so a scan that races with
+ * removals still visits the remaining elements in order.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: As for vlSkipListFind.
+ * - **Thread Safety**: Thread-safe. Only reads shared memory, and never retries.
+ * - **Nullability**: `iter` must not be `VL_SKIPLIST_ITER_INVALID`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an iterator invalidated by vlSkipListReclaim or vlSkipListClear.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the next present element, or `VL_SKIPLIST_ITER_INVALID` at the end.
+ *
+ * \param list skiplist
+ * \param iter current position
+ * \return iterator to the next element
+ * \par Complexity of O(1) amortized.
+ */
+VL_API vl_skiplist_iter vlSkipListNext(const vl_skiplist* list, vl_skiplist_iter iter);
+
+/**
+ * \brief Returns a pointer to the element named by an iterator.
+ *
+ * \param list skiplist
+ * \param iter iterator to a node
+ * \return pointer to the element
+ * \par Complexity of O(1) constant.
+ */
+VL_API void* vlSkipListSample(const vl_skiplist* list, vl_skiplist_iter iter);
+
+#endif // VL_SKIPLIST_H
@@ -0,0 +1,456 @@
+/**
+ * ██    ██ ██       █████  ███████  █████   ██████  ███    ██  █████
+ * ██    ██ ██      ██   ██ ██      ██   ██ ██       ████   ██ ██   ██
+ * ██    ██ ██      ███████ ███████ ███████ ██   ███ ██ ██  ██ ███████
+ *  ██  ██  ██      ██   ██      ██ ██   ██ ██    ██ ██  ██ ██ ██   ██
+ *   ████   ███████ ██   ██ ███████ ██   ██  ██████  ██   ████ ██   ██
+ * ====---: A Data Structure and Algorithms library for C11.  :---====
+ *
+ * Copyright 2026 Jesse Walker, released under the MIT license.
+ * Git Repository:  https://github.com/walkerje/veritable_lasagna
+ * \private
+ */
+
+#ifndef VL_SORT_H
+#define VL_SORT_H
+
+#include "vl_compare.h"
+#include "vl_memory.h"
+#include "vl_numtypes.h"
+#include "vl_thread_pool.h"
+
+/**
+ * \file vl_sort.h
+ * \brief Key-aware sorting of contiguous arrays.
+ *
+ * Where vlMemSort orders elements through a comparator callback, the sorts in
+ * this header know the type and position of each element's key, which lets
+ * them avoid per-comparison indirect calls entirely.
+ *
+ * Keys are described by a `vl_numtype` and a byte offset within each element,
+ * so the same entry points sort bare key arrays and arrays of records that
+ * carry an integer or floating-point key field.
+ *
+ * Comparator sorts that spread their work across a `vl_thread_pool` also live
+ * here, keeping `vl_memory.h` free of threading dependencies.
+ *
+ * For percentiles and top-N lists, typed selection and partial sorts avoid
+ * sorting a whole array, and vl_topk keeps the best k elements of a stream.
+ */
+
+/**
+ * \brief Sorts an array of records by a numeric key field using LSD radix sort.
+ *
+ * Keys are mapped to unsigned integers whose ordering matches the key type's:
+ * signed integers have their sign bit flipped, and floating-point keys are
+ * flipped so that negative values order before positive ones. Keys of 32 bits
+ * or more are sorted 11 bits per pass, narrower keys 8 bits per pass. All digit
+ * histograms are gathered in a single pass over the input, and digits on which
+ * every key agrees are skipped, so narrow-range keys cost fewer passes than
+ * their width suggests.
+ *
+ * Floating-point keys order as `-NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN`.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of the `buffer`.
+ * - **Lifetime**: The `buffer` must remain valid for the duration of the sort.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `buffer` concurrently.
+ * - **Nullability**: `buffer` must not be `NULL` unless `numElements` is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` without modifying the buffer if `keyType` is out of range, the key does
+ * not fit within `elementSize` at `keyOffset`, or scratch allocation fails.
+ * - **Undefined Behavior**: Key fields that are not properly initialized values of `keyType`.
+ * - **Memory Allocation Expectations**: Allocates scratch space equal to the size of the buffer, plus histograms.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the buffer is sorted.
+ *
+ * \param buffer array of records
+ * \param elementSize size of each record, in bytes
+ * \param numElements number of records
+ * \param keyType numeric type of the key field
+ * \param keyOffset byte offset of the key field within each record
+ * \return VL_TRUE on success
+ * \note The sort is stable.
+ * \par Complexity of O(n * k), where k is the key width in bytes (space complexity of O(n)).
+ */
+VL_API vl_bool_t vlSortRadix(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_numtype keyType,
+                             vl_memsize_t keyOffset);
+
+/**
+ * \brief Radix-sorts an array of records by a numeric key field across a thread pool.
+ *
+ * The buffer is split into contiguous chunks. Each pass counts digits per
+ * chunk in parallel, derives every chunk's output offsets from those counts,
+ * and scatters all chunks concurrently. Output is identical to vlSortRadix.
+ * Arrays too small to benefit are sorted on the calling thread.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of the `buffer` or `pool`.
+ * - **Lifetime**: The `buffer` must remain valid for the duration of the sort.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `buffer` concurrently. The pool may be
+ * shared with unrelated work.
+ * - **Nullability**: If `pool` is `NULL`, behaves as vlSortRadix.
+ * - **Error Conditions**: As vlSortRadix.
+ * - **Undefined Behavior**: As vlSortRadix.
+ * - **Memory Allocation Expectations**: Allocates scratch space equal to the size of the buffer, plus per-chunk
+ * histograms.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the buffer is sorted.
+ *
+ * \param pool thread pool to run on
+ * \param buffer array of records
+ * \param elementSize size of each record, in bytes
+ * \param numElements number of records
+ * \param keyType numeric type of the key field
+ * \param keyOffset byte offset of the key field within each record
+ * \return VL_TRUE on success
+ * \note The sort is stable.
+ * \sa vlSortRadix, vlThreadPoolParallelFor
+ */
+VL_API vl_bool_t vlSortRadixParallel(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                     vl_dsidx_t numElements, vl_numtype keyType, vl_memsize_t keyOffset);
+
+/**
+ * \brief Radix-sorts a bare array of numeric keys.
+ *
+ * Equivalent to `vlSortRadix(keys, vlNumTypeSizeof(keyType), numElements, keyType, 0)`.
+ *
+ * \param keys array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \return VL_TRUE on success
+ * \sa vlSortRadix
+ */
+static inline vl_bool_t vlSortRadixKeys(void* keys, vl_dsidx_t numElements, vl_numtype keyType)
+{
+    return vlSortRadix(keys, keyType < VL_NUMTYPE_MAX ? vlNumTypeSizeof(keyType) : 0, numElements, keyType, 0);
+}
+
+/**
+ * \brief Sorts a bare array of numeric keys in place without allocating.
+ *
+ * 32-bit keys (`INT32`, `UINT32`, `FLOAT32`) never call a comparator. Arrays
+ * of up to VL_SIMD_SORT_NETWORK_MAX keys go straight to the vectorized sorting
+ * network selected by vlSIMDInit. Longer arrays are mapped to signed integers,
+ * partitioned by an introsort, and each small partition is finished by the
+ * same network. Other key widths are sorted by vlMemSort with a built-in
+ * comparator; prefer vlSortRadixKeys for large arrays of those.
+ *
+ * Floating-point keys order as `-NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN`,
+ * matching vlSortRadix.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of `keys`.
+ * - **Lifetime**: `keys` must remain valid for the duration of the sort.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `keys` concurrently.
+ * - **Nullability**: `keys` must not be `NULL` unless `numElements` is below 2.
+ * - **Error Conditions**: Returns `VL_FALSE` without modifying `keys` if `keyType` is out of range.
+ * - **Undefined Behavior**: Keys that are not properly initialized values of `keyType`.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the keys are sorted.
+ *
+ * \param keys array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \return VL_TRUE on success
+ * \note Uses the portable network until vlSIMDInit has been called.
+ * \par Complexity of O(n log(n)) (space complexity of O(log(n)) stack).
+ * \sa vlSIMDSortI32, vlSortRadixKeys
+ */
+VL_API vl_bool_t vlSortNumeric(void* keys, vl_dsidx_t numElements, vl_numtype keyType);
+
+/**
+ * \brief Places the key a full sort would put at index `nth`, without sorting the rest.
+ *
+ * Keys before `nth` order no later than it and keys after no earlier. 32-bit
+ * keys use the same branchless partitioning as vlSortNumeric, keeping only
+ * the side that holds `nth`. Other widths defer to vlMemSelect with a built-in
+ * comparator. Floating-point keys use the same total order as vlSortNumeric.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of `keys`.
+ * - **Lifetime**: `keys` must remain valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `keys` concurrently.
+ * - **Nullability**: `keys` must not be `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` without modifying `keys` if `keyType` is out of range or `nth` is not less
+ * than `numElements`.
+ * - **Undefined Behavior**: Keys that are not properly initialized values of `keyType`.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the key at `nth` is in place.
+ *
+ * \param keys array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param nth index whose key should be placed
+ * \return VL_TRUE on success
+ * \par Complexity of O(n) expected, O(n log(n)) worst case (space complexity of O(1)).
+ * \sa vlMemSelect, vlSortNumericPartial
+ */
+VL_API vl_bool_t vlSortNumericSelect(void* keys, vl_dsidx_t numElements, vl_numtype keyType, vl_dsidx_t nth);
+
+/**
+ * \brief Sorts the `count` smallest keys into the front of the array, in place and without allocating.
+ *
+ * Equivalent to selecting index `count - 1` with vlSortNumericSelect and then
+ * sorting the keys before it. A `count` of at least `numElements` sorts the
+ * whole array, as vlSortNumeric does.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of `keys`.
+ * - **Lifetime**: `keys` must remain valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `keys` concurrently.
+ * - **Nullability**: `keys` must not be `NULL` unless `numElements` is 0.
+ * - **Error Conditions**: Returns `VL_FALSE` without modifying `keys` if `keyType` is out of range.
+ * - **Undefined Behavior**: Keys that are not properly initialized values of `keyType`.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the prefix is sorted.
+ *
+ * \param keys array of keys
+ * \param numElements number of keys
+ * \param keyType numeric type of the keys
+ * \param count length of the sorted prefix
+ * \return VL_TRUE on success
+ * \par Complexity of O(n + k log(k)) expected for a prefix of k keys (space complexity of O(log(k)) stack).
+ * \sa vlMemPartialSort
+ */
+VL_API vl_bool_t vlSortNumericPartial(void* keys, vl_dsidx_t numElements, vl_numtype keyType, vl_dsidx_t count);
+
+/**
+ * \brief Streaming selector that retains the `k` elements ordering first under a comparator.
+ *
+ * Elements are kept in a binary heap whose root is the worst one retained, so
+ * once the selector is full each new element costs a single comparison unless
+ * it displaces the root. Memory use is fixed at `k` elements no matter how
+ * many are pushed. To keep the `k` largest values, pass a comparator that
+ * orders in descending order.
+ */
+typedef struct
+{
+    vl_memory* elements;            // Heap of retained elements; the root orders last.
+    vl_memsize_t elementSize;
+    vl_dsidx_t capacity;            // k, or 0 if the heap could not be allocated.
+    vl_dsidx_t count;
+    vl_compare_function comparator;
+} vl_topk;
+
+/**
+ * \brief Number of elements currently retained by a top-k selector.
+ */
+#define vlTopKSize(topk) ((topk)->count)
+
+/**
+ * \brief Initializes a top-k selector in place.
+ *
+ * ## Contract
+ * - **Ownership**: The caller maintains ownership of the `topk` struct. The selector owns its element storage.
+ * - **Lifetime**: Valid until vlTopKFree.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `topk` and `comparator` must not be `NULL`.
+ * - **Error Conditions**: If the element storage cannot be allocated, the capacity is set to 0 and every push is
+ * rejected.
+ * - **Undefined Behavior**: Initializing a selector twice without freeing it (leaks memory).
+ * - **Memory Allocation Expectations**: Allocates `elementSize * k` bytes.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param topk selector to initialize
+ * \param elementSize size of each element, in bytes
+ * \param k number of elements to retain
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \par Complexity of O(1) constant.
+ * \sa vlTopKFree
+ */
+VL_API void vlTopKInit(vl_topk* topk, vl_memsize_t elementSize, vl_dsidx_t k, vl_compare_function comparator);
+
+/**
+ * \brief Frees a selector's element storage.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the element storage. Does NOT release the `topk` struct itself.
+ * - **Lifetime**: The selector is invalid until initialized again.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `topk` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Freeing an uninitialized selector.
+ * - **Memory Allocation Expectations**: Deallocates the element storage.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param topk selector to free
+ * \par Complexity of O(1) constant.
+ * \sa vlTopKInit
+ */
+VL_API void vlTopKFree(vl_topk* topk);
+
+/**
+ * \brief Allocates and initializes a top-k selector on the heap.
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns the returned selector and must release it with vlTopKDelete.
+ * - **Lifetime**: Valid until vlTopKDelete.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: Returns `NULL` if the struct cannot be allocated.
+ * - **Error Conditions**: As vlTopKInit.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: Allocates the struct and `elementSize * k` bytes of element storage.
+ * - **Return-value Semantics**: Returns the new selector, or `NULL`.
+ *
+ * \param elementSize size of each element, in bytes
+ * \param k number of elements to retain
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \return selector pointer
+ * \par Complexity of O(1) constant.
+ * \sa vlTopKDelete
+ */
+VL_API vl_topk* vlTopKNew(vl_memsize_t elementSize, vl_dsidx_t k, vl_compare_function comparator);
+
+/**
+ * \brief Frees a selector created by vlTopKNew.
+ *
+ * ## Contract
+ * - **Ownership**: Releases the element storage and the struct.
+ * - **Lifetime**: The pointer is invalid after the call.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: Safe to call with `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Double deletion.
+ * - **Memory Allocation Expectations**: Deallocates the element storage and the struct.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param topk selector to delete
+ * \par Complexity of O(1) constant.
+ * \sa vlTopKNew
+ */
+VL_API void vlTopKDelete(vl_topk* topk);
+
+/**
+ * \brief Discards every retained element, keeping the storage for reuse.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `topk` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an uninitialized selector.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param topk selector to clear
+ * \par Complexity of O(1) constant.
+ */
+VL_API void vlTopKClear(vl_topk* topk);
+
+/**
+ * \brief Offers one element to the selector.
+ *
+ * The element is copied in if fewer than `k` are retained, or if it orders
+ * strictly before the worst retained element, which it then replaces.
+ *
+ * ## Contract
+ * - **Ownership**: The element is copied; the caller keeps ownership of `element`.
+ * - **Lifetime**: `element` need only be valid for the duration of the call.
+ * - **Thread Safety**: Not thread-safe.
+ * - **Nullability**: `topk` and `element` must not be `NULL`.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: Passing an uninitialized selector.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if the element was retained.
+ *
+ * \param topk selector
+ * \param element element to offer
+ * \return whether the element was retained
+ * \par Complexity of O(log(k)) worst case, O(1) when rejected.
+ */
+VL_API vl_bool_t vlTopKPush(vl_topk* topk, const void* element);
+
+/**
+ * \brief Offers every element of an array to the selector, in order.
+ *
+ * \param topk selector
+ * \param buffer array of elements
+ * \param numElements number of elements
+ * \sa vlTopKPush
+ */
+VL_API void vlTopKPushArray(vl_topk* topk, const void* buffer, vl_dsidx_t numElements);
+
+/**
+ * \brief Copies the retained elements into `dest`, sorted from first to last.
+ *
+ * The selector is left unchanged and may keep receiving elements.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer ownership. `dest` is written, not retained.
+ * - **Lifetime**: `dest` must hold at least vlTopKSize(topk) elements.
+ * - **Thread Safety**: Not thread-safe if the selector is modified concurrently.
+ * - **Nullability**: `topk` must not be `NULL`. `dest` may be `NULL` only if the selector is empty.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: A `dest` smaller than the retained elements.
+ * - **Memory Allocation Expectations**: As vlMemSort.
+ * - **Return-value Semantics**: Returns the number of elements written.
+ *
+ * \param topk selector
+ * \param dest destination array
+ * \return number of elements written
+ * \par Complexity of O(k log(k)).
+ */
+VL_API vl_dsidx_t vlTopKSort(const vl_topk* topk, void* dest);
+
+/**
+ * \brief Sorts a buffer with a comparator across a thread pool.
+ *
+ * The buffer is cut into one contiguous run per pool thread (workers plus the
+ * caller), the runs are sorted concurrently with vlMemSort, and then merged
+ * pairwise. Each merge is itself split into independent slices by binary
+ * searching the split points, so every round keeps all threads busy until a
+ * single run remains. Buffers below a few tens of thousands of elements, or a
+ * `NULL` pool, fall back to a serial sort.
+ *
+ * ## Contract
+ * - **Ownership**: Does not transfer or affect ownership of the `buffer` or `pool`.
+ * - **Lifetime**: The `buffer` must remain valid for the duration of the sort.
+ * - **Thread Safety**: Not thread-safe if multiple threads access the same `buffer` concurrently. `comparator` is
+ * called concurrently from several threads and must be reentrant.
+ * - **Nullability**: `buffer` and `comparator` must not be `NULL`. A `NULL` `pool` sorts on the calling thread.
+ * - **Error Conditions**: Returns `VL_FALSE` without modifying the buffer if scratch allocation fails.
+ * - **Undefined Behavior**: A comparator that is not a strict weak ordering.
+ * - **Memory Allocation Expectations**: Allocates scratch space equal to the size of the buffer. Serial fallbacks
+ * allocate as vlMemSort does.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the buffer is sorted.
+ *
+ * \param pool thread pool to run on
+ * \param buffer array to sort
+ * \param elementSize size of each element, in bytes
+ * \param numElements number of elements
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \return VL_TRUE on success
+ * \par Complexity of O(n log(n)) work, O(n log(n) / p + n) span (space complexity of O(n)).
+ * \sa vlMemSort, vlMemSortParallelStable
+ */
+VL_API vl_bool_t vlMemSortParallel(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                   vl_dsidx_t numElements, vl_compare_function comparator);
+
+/**
+ * \brief Stable variant of vlMemSortParallel.
+ *
+ * Runs are sorted with a stable merge sort instead of vlMemSort, and merges
+ * always take from the earlier run on ties, so elements that compare equal
+ * keep their original relative order.
+ *
+ * ## Contract
+ * - **Ownership**: As vlMemSortParallel.
+ * - **Lifetime**: As vlMemSortParallel.
+ * - **Thread Safety**: As vlMemSortParallel.
+ * - **Nullability**: As vlMemSortParallel. A `NULL` `pool` performs a serial stable sort.
+ * - **Error Conditions**: Returns `VL_FALSE` without modifying the buffer if scratch allocation fails.
+ * - **Undefined Behavior**: As vlMemSortParallel.
+ * - **Memory Allocation Expectations**: Allocates scratch space equal to the size of the buffer.
+ * - **Return-value Semantics**: Returns `VL_TRUE` once the buffer is sorted.
+ *
+ * \param pool thread pool to run on
+ * \param buffer array to sort
+ * \param elementSize size of each element, in bytes
+ * \param numElements number of elements
+ * \param comparator ordering, with the same contract as vlMemSort
+ * \return VL_TRUE on success
+ * \sa vlMemSortParallel
+ */
+VL_API vl_bool_t vlMemSortParallelStable(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                         vl_dsidx_t numElements, vl_compare_function comparator);
+
+#endif // VL_SORT_H
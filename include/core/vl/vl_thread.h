@@ -186,6 +186,27 @@ VL_API void vlThreadSleep(vl_ularge_t milliseconds);
  */
 VL_API void vlThreadSleepNano(vl_ularge_t nanoseconds);
 
+/**
+ * \brief Reads a monotonic clock with nanosecond resolution.
+ *
+ * The epoch is unspecified; only differences between two readings are
+ * meaningful. The clock never jumps backwards and is unaffected by wall-clock
+ * adjustments.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: N/A.
+ * - **Thread Safety**: This function is thread-safe.
+ * - **Nullability**: N/A.
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the current monotonic time in nanoseconds.
+ *
+ * \return monotonic timestamp in nanoseconds
+ */
+VL_API vl_ularge_t vlThreadMonotonicNano(void);
+
 /**
  * \brief Exits the calling thread.
  *
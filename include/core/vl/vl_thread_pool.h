@@ -33,19 +33,20 @@
  * - **Priority respect**: High-priority work gets preferential execution
  * - **Load balancing**: Idle workers steal across priority tiers
  * - **Lock-free enqueueing**: All priority levels use atomic queues
- * - **Efficient signaling**: Per-tier semaphores reduce spurious wakeups
+ * - **Efficient signaling**: A single counting semaphore tracks available work
  *
  * ## Architecture
  *
- * Each priority tier (HIGH, MEDIUM, LOW) has its own:
- * - Atomic MPMC work queue (vl_async_queue)
- * - Counting semaphore (vl_semaphore)
+ * Each priority tier (HIGH, MEDIUM, LOW) has its own atomic MPMC work queue
+ * (vl_async_queue). One counting semaphore (vl_semaphore) is posted once per
+ * enqueued task, regardless of tier, so a parked worker wakes for work at any
+ * priority.
  *
  * Worker threads employ the following strategy:
  * 1. Try to pop from HIGH priority queue
  * 2. If empty, try MEDIUM priority queue
  * 3. If empty, try LOW priority queue
- * 4. If all empty, wait on semaphore (blocking)
+ * 4. If all empty, park on the semaphore (blocking)
  * 5. Upon wakeup, repeat from step 1
  *
  * ## Typical Usage
@@ -95,13 +96,49 @@
  * Tasks themselves are responsible for any necessary synchronization if
  * accessing shared state.
  *
- * ## Starvation Prevention
- *
- * While the scheduler respects priorities, it prevents LOW-priority starvation
- * through work-stealing:
- * - When a worker's preferred tier is empty, it steals from lower tiers
- * - This ensures LOW-priority work eventually gets CPU time
- * - Adjust priority distribution based on your workload
+ * ## Scheduling Policies
+ *
+ * How a worker picks its next tier is configurable:
+ * - **Strict** (default): always drain HIGH, then MEDIUM, then LOW. Sustained
+ *   HIGH traffic starves the lower tiers indefinitely.
+ * - **Weighted**: each worker serves the tiers in weighted round-robin, taking
+ *   up to `tier_weights[p]` tasks from tier `p` per cycle. Empty tiers forfeit
+ *   their turn, so no worker idles while work is queued.
+ * - **Aging**: strict order, except that a MEDIUM or LOW tier with pending work
+ *   that has not been served for `aging_threshold_ms[p]` is promoted ahead of
+ *   HIGH for one task.
+ *
+ * Enable instrumentation to read per-tier queueing delay histograms via
+ * `vlThreadPoolGetPriorityStats()` when tuning weights or thresholds.
+ *
+ * ## Instrumentation
+ *
+ * Every worker keeps a private set of counters (tasks executed, steals, idle
+ * transitions, parks) that it alone writes, so bookkeeping never contends
+ * across workers. Enabling instrumentation with
+ * `vlThreadPoolSetInstrumentation()` additionally timestamps each task at
+ * enqueue, start and end, and records queueing delay and execution time into
+ * HDR-style log-linear histograms kept per worker and per priority tier.
+ * Snapshots are plain data (`vl_thread_pool_worker_stats`,
+ * `vl_thread_pool_priority_stats`) and may be copied, merged, or serialized
+ * freely.
+ *
+ * ## Elastic Scaling
+ *
+ * Pools created with `vlThreadPoolNewConfig()` keep between `min_workers` and
+ * `max_workers` threads. Producers spawn an extra worker when every worker is
+ * busy and a backlog has persisted past a delay threshold; workers above the
+ * minimum retire after idling longer than a keepalive. Fixed-size pools
+ * (`vlThreadPoolNew()`) skip these checks entirely.
+ *
+ * ## Backpressure
+ *
+ * Each tier may be given a capacity. Enqueueing into a full tier follows the
+ * configured overflow policy: block until a worker frees a slot (optionally
+ * with a timeout), fail fast, or run the task on the caller's thread. Bounded
+ * tiers keep the underlying vl_async_pool from growing past the capacity, so
+ * memory stays bounded under overload. Every tier's queue-depth high-water
+ * mark is reported in `vl_thread_pool_stats`.
  *
  * ## Shutdown Behavior
  *
@@ -127,6 +164,26 @@ typedef enum
     VL_THREAD_POOL_PRIORITY_COUNT = 3 /**< Total number of priority levels */
 } vl_thread_pool_priority;
 
+/**
+ * \brief What an enqueue does when its priority tier is at capacity.
+ */
+typedef enum
+{
+    VL_THREAD_POOL_OVERFLOW_BLOCK = 0, /**< Wait for space, up to `block_timeout_ms` */
+    VL_THREAD_POOL_OVERFLOW_FAIL = 1, /**< Reject the task immediately */
+    VL_THREAD_POOL_OVERFLOW_CALLER_RUNS = 2 /**< Execute the task on the submitting thread */
+} vl_thread_pool_overflow_policy;
+
+/**
+ * \brief How workers choose between priority tiers.
+ */
+typedef enum
+{
+    VL_THREAD_POOL_SCHEDULE_STRICT = 0, /**< Always serve the highest non-empty tier */
+    VL_THREAD_POOL_SCHEDULE_WEIGHTED = 1, /**< Weighted round-robin over `tier_weights` */
+    VL_THREAD_POOL_SCHEDULE_AGING = 2 /**< Strict, promoting tiers unserved past `aging_threshold_ms` */
+} vl_thread_pool_schedule_policy;
+
 typedef enum
 {
     VL_THREAD_POOL_RUNNING = 0,
@@ -134,6 +191,97 @@ typedef enum
     VL_THREAD_POOL_SHUT_DOWN = 2
 } vl_thread_pool_state;
 
+/**
+ * \brief Number of linear sub-buckets per power-of-two range, as a bit count.
+ *
+ * Each octave of the histogram is split into `1 << SUB_BITS` equal-width
+ * buckets, bounding the relative error of any recorded value to
+ * `1 / (1 << SUB_BITS)` (12.5% with the default of 3).
+ */
+#define VL_THREAD_POOL_HISTOGRAM_SUB_BITS 3
+
+/**
+ * \brief Highest power of two (in nanoseconds) tracked before values saturate
+ * into the final bucket. 2^40 ns is roughly 18 minutes.
+ */
+#define VL_THREAD_POOL_HISTOGRAM_MAX_EXP 40
+
+/**
+ * \brief Total number of buckets in a thread pool latency histogram.
+ */
+#define VL_THREAD_POOL_HISTOGRAM_BUCKETS                                                                              \
+    ((VL_THREAD_POOL_HISTOGRAM_MAX_EXP - VL_THREAD_POOL_HISTOGRAM_SUB_BITS + 2) << VL_THREAD_POOL_HISTOGRAM_SUB_BITS)
+
+/**
+ * \brief HDR-style log-linear latency histogram, in nanoseconds.
+ *
+ * Values below `1 << SUB_BITS` map to their own bucket; every power-of-two
+ * range above that is split into `1 << SUB_BITS` linear buckets. Use
+ * `vlThreadPoolHistogramBucketLowerBound()` to map a bucket index back to a
+ * value range when exporting.
+ *
+ * \field count Number of recorded samples
+ * \field sum Sum of all recorded samples
+ * \field min Smallest recorded sample (0 if empty)
+ * \field max Largest recorded sample
+ * \field buckets Per-bucket sample counts
+ */
+typedef struct
+{
+    vl_ularge_t count;
+    vl_ularge_t sum;
+    vl_ularge_t min;
+    vl_ularge_t max;
+    vl_ularge_t buckets[VL_THREAD_POOL_HISTOGRAM_BUCKETS];
+} vl_thread_pool_histogram;
+
+/**
+ * \brief Per-worker statistics snapshot.
+ *
+ * Counters are maintained at all times. Histograms and `busy_ns` are only
+ * populated for tasks executed while instrumentation was enabled.
+ *
+ * \field tasks_executed Tasks executed by this worker
+ * \field steals Tasks taken from MEDIUM or LOW by the strict cascade after higher
+ *        tiers were empty; weighted picks and aging promotions are not counted
+ * \field idles Times the worker found every queue empty
+ * \field parks Times the worker blocked on the work semaphore
+ * \field busy_ns Total nanoseconds spent executing instrumented tasks
+ * \field wait_histogram Queueing delay (enqueue to start) across all tiers
+ * \field exec_histogram Execution time (start to end) across all tiers
+ */
+typedef struct
+{
+    vl_ularge_t tasks_executed;
+    vl_ularge_t steals;
+    vl_ularge_t idles;
+    vl_ularge_t parks;
+    vl_ularge_t busy_ns;
+    vl_thread_pool_histogram wait_histogram;
+    vl_thread_pool_histogram exec_histogram;
+} vl_thread_pool_worker_stats;
+
+/**
+ * \brief Per-priority statistics snapshot, aggregated across all workers.
+ *
+ * \field tasks_executed Tasks of this priority executed by any worker
+ * \field tasks_promoted Tasks of this priority served ahead of HIGH by the aging policy
+ * \field wait_histogram Queueing delay (enqueue to start) of instrumented tasks
+ * \field exec_histogram Execution time (start to end) of instrumented tasks
+ */
+typedef struct
+{
+    vl_ularge_t tasks_executed;
+    vl_ularge_t tasks_promoted;
+    vl_thread_pool_histogram wait_histogram;
+    vl_thread_pool_histogram exec_histogram;
+} vl_thread_pool_priority_stats;
+
+/**
+ * \brief Private per-worker state. Defined in vl_thread_pool.c.
+ */
+typedef struct vl_thread_pool_worker_ vl_thread_pool_worker;
+
 /**
  * \brief Function signature for worker thread task procedures.
  *
@@ -153,6 +301,84 @@ typedef struct
     void* user_data;
 } vl_thread_pool_task;
 
+/**
+ * \brief Configuration consumed by `vlThreadPoolNewConfig()`.
+ *
+ * Start from `vlThreadPoolConfigDefault()` and override individual fields so
+ * that fields added in the future keep sensible values.
+ */
+typedef struct vl_thread_pool_config_
+{
+    /**
+     * \brief Workers kept alive at all times. Spawned at creation; must be > 0.
+     */
+    vl_uint_t min_workers;
+
+    /**
+     * \brief Upper bound on live workers. Values below `min_workers` are raised
+     * to `min_workers`, producing a fixed-size pool.
+     */
+    vl_uint_t max_workers;
+
+    /**
+     * \brief Pending tasks (across all tiers) that count as a backlog.
+     *
+     * A new worker is only considered while no worker is idle and at least this
+     * many tasks are queued.
+     */
+    vl_uint_t scale_up_backlog;
+
+    /**
+     * \brief Milliseconds the backlog must persist before a worker is spawned.
+     *
+     * This approximates queueing delay without timestamping every task: the
+     * tail of a backlog that has not drained for this long has waited at least
+     * this long. Also rate-limits growth to one worker per interval.
+     */
+    vl_uint_t scale_up_delay_ms;
+
+    /**
+     * \brief Milliseconds a worker above `min_workers` may stay parked before it
+     * retires. Zero disables retirement.
+     */
+    vl_uint_t keepalive_ms;
+
+    /**
+     * \brief Maximum queued tasks per priority tier. Zero leaves a tier
+     * unbounded.
+     */
+    vl_uint_t queue_capacity[VL_THREAD_POOL_PRIORITY_COUNT];
+
+    /**
+     * \brief Behavior of an enqueue into a full tier.
+     */
+    vl_thread_pool_overflow_policy overflow_policy;
+
+    /**
+     * \brief Milliseconds a `VL_THREAD_POOL_OVERFLOW_BLOCK` enqueue waits for
+     * space before giving up. Zero waits indefinitely.
+     */
+    vl_uint_t block_timeout_ms;
+
+    /**
+     * \brief How workers choose between priority tiers.
+     */
+    vl_thread_pool_schedule_policy schedule_policy;
+
+    /**
+     * \brief Tasks taken from each tier per round-robin cycle under
+     * `VL_THREAD_POOL_SCHEDULE_WEIGHTED`. Zero is treated as one.
+     */
+    vl_uint_t tier_weights[VL_THREAD_POOL_PRIORITY_COUNT];
+
+    /**
+     * \brief Milliseconds a tier with pending work may go unserved before
+     * `VL_THREAD_POOL_SCHEDULE_AGING` promotes it. Zero disables promotion for
+     * that tier; the HIGH entry is ignored.
+     */
+    vl_uint_t aging_threshold_ms[VL_THREAD_POOL_PRIORITY_COUNT];
+} vl_thread_pool_config;
+
 /**
  * \brief Opaque thread pool handle.
  */
@@ -161,16 +387,46 @@ typedef struct vl_thread_pool_
     /* Work queues per priority tier */
     vl_async_queue* workQueues[VL_THREAD_POOL_PRIORITY_COUNT];
 
-    /* Semaphore per tier: counts available work at that priority */
-    vl_semaphore semaphores[VL_THREAD_POOL_PRIORITY_COUNT];
+    /* Counts available work across all tiers; posted once per enqueue */
+    vl_semaphore workAvailable;
 
-    /* Worker thread management */
-    vl_thread* workers;
-    vl_uint_t workerCount;
+    /* Worker thread management: one slot per potential worker */
+    vl_thread_pool_worker* workers;
+    vl_uint_t workerCapacity;
+    vl_uint_t minWorkers;
+    VL_ATOMIC vl_uint_t workerCount;
+
+    /* Elastic scaling */
+    vl_mutex scaleLock;
+    vl_uint_t scaleBacklog;
+    vl_ularge_t scaleDelayNanos;
+    vl_uint_t keepaliveMs;
+    VL_ATOMIC vl_ularge_t pressureSince;
+    VL_ATOMIC vl_ularge_t workersSpawned;
+    VL_ATOMIC vl_ularge_t workersRetired;
+
+    /* Backpressure: slots reserved per bounded tier, and producers waiting for one */
+    vl_uint_t queueCapacity[VL_THREAD_POOL_PRIORITY_COUNT];
+    vl_thread_pool_overflow_policy overflowPolicy;
+    vl_uint_t blockTimeoutMs;
+    VL_ATOMIC vl_uint32_t queueReserved[VL_THREAD_POOL_PRIORITY_COUNT];
+    VL_ATOMIC vl_uint32_t queuePeak[VL_THREAD_POOL_PRIORITY_COUNT];
+    VL_ATOMIC vl_uint_t blockedProducers;
+    vl_mutex spaceLock;
+    vl_condition spaceAvailable;
+    VL_ATOMIC vl_ularge_t tasksRejected;
+    VL_ATOMIC vl_ularge_t tasksCallerRan;
+
+    /* Tier selection; tierServedAt is the last time each tier was served or became non-empty */
+    vl_thread_pool_schedule_policy schedulePolicy;
+    vl_uint_t tierWeights[VL_THREAD_POOL_PRIORITY_COUNT];
+    vl_ularge_t agingNanos[VL_THREAD_POOL_PRIORITY_COUNT];
+    VL_ATOMIC vl_ularge_t tierServedAt[VL_THREAD_POOL_PRIORITY_COUNT];
 
     /* State & statistics */
     VL_ATOMIC vl_thread_pool_state state;
     VL_ATOMIC vl_ularge_t tasksCompleted;
+    VL_ATOMIC vl_bool_t instrumented;
 
     /* Idle synchronization: for vlThreadPoolWait() */
     vl_condition all_idle;
@@ -183,7 +439,13 @@ typedef struct vl_thread_pool_
  *
  * \field tasks_completed Total tasks executed since pool creation
  * \field tasks_pending_by_priority Queue depth for each priority tier
- * \field worker_count Number of active worker threads
+ * \field worker_count Number of live worker threads
+ * \field workers_spawned Workers started since creation, including the minimum set
+ * \field workers_retired Workers that exited after exceeding their keepalive
+ * \field tasks_pending_peak High-water mark of each tier's queue depth
+ * \field tasks_rejected Enqueues refused because a tier was full
+ * \field tasks_caller_ran Tasks executed on the submitting thread by the
+ * caller-runs overflow policy
  *
  * \note Counts may be slightly stale due to concurrent modifications.
  */
@@ -192,6 +454,11 @@ typedef struct
     vl_ularge_t tasks_completed;
     vl_uint32_t tasksPending[VL_THREAD_POOL_PRIORITY_COUNT];
     vl_uint_t worker_count;
+    vl_ularge_t workers_spawned;
+    vl_ularge_t workers_retired;
+    vl_uint32_t tasks_pending_peak[VL_THREAD_POOL_PRIORITY_COUNT];
+    vl_ularge_t tasks_rejected;
+    vl_ularge_t tasks_caller_ran;
 } vl_thread_pool_stats;
 
 /**
@@ -217,11 +484,59 @@ typedef struct
  * \return Thread pool handle, or VL_THREAD_POOL_NULL on failure
  *
  * \note If worker_count is 0 or thread creation fails, returns null.
+ * \note Equivalent to `vlThreadPoolNewConfig()` with `min_workers` and
+ * `max_workers` both set to `worker_count`.
  *
- * \sa vlThreadPoolDelete
+ * \sa vlThreadPoolDelete, vlThreadPoolNewConfig
  */
 VL_API vl_thread_pool* vlThreadPoolNew(vl_uint_t worker_count);
 
+/**
+ * \brief Fills a configuration with default values.
+ *
+ * Defaults describe a single-worker pool that never scales; callers are
+ * expected to set `min_workers` and `max_workers`. The scaling thresholds
+ * default to a backlog of 2 tasks sustained for 1 ms, and a 1 second
+ * keepalive. Queues are unbounded; if capacities are set, the default
+ * overflow policy blocks indefinitely. Scheduling is strict priority; the
+ * weighted policy defaults to 4:2:1 and aging to 20 ms for MEDIUM and 100 ms
+ * for LOW.
+ *
+ * \param config Configuration to initialize; must not be `NULL`.
+ */
+VL_API void vlThreadPoolConfigDefault(vl_thread_pool_config* config);
+
+/**
+ * \brief Creates a thread pool whose worker count scales between bounds.
+ *
+ * `min_workers` threads are created immediately. While every live worker is
+ * busy and the backlog has persisted past `scale_up_delay_ms`, enqueueing
+ * spawns one more worker, up to `max_workers`. A worker above the minimum that
+ * stays parked for `keepalive_ms` exits; its thread is joined and its slot
+ * reused by the next spawn (or by `vlThreadPoolDelete()`).
+ *
+ * ## Contract
+ * - **Ownership**: The caller owns the returned `vl_thread_pool` handle and is responsible for calling
+ * `vlThreadPoolDelete`.
+ * - **Lifetime**: The thread pool remains valid until `vlThreadPoolDelete`.
+ * - **Thread Safety**: This function is thread-safe.
+ * - **Nullability**: Returns `NULL` if `config` is `NULL` or `min_workers` is 0.
+ * - **Error Conditions**: Returns `NULL` if any heap allocation fails or if the minimum workers cannot be spawned.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: Allocates the pool structure, `max_workers` worker slots, queues, and
+ * synchronization primitives on the heap. Scaling up allocates only the new thread's metadata.
+ * - **Return-value Semantics**: Returns an opaque handle to the new thread pool, or `NULL` on failure.
+ *
+ * \param config Pool configuration
+ * \return Thread pool handle, or NULL on failure
+ *
+ * \note Worker statistics are reported per slot; a reused slot keeps
+ * accumulating into the same counters.
+ *
+ * \sa vlThreadPoolConfigDefault, vlThreadPoolDelete
+ */
+VL_API vl_thread_pool* vlThreadPoolNewConfig(const vl_thread_pool_config* config);
+
 /**
  * \brief Deletes a thread pool and frees all associated resources.
  *
@@ -258,20 +573,24 @@ VL_API void vlThreadPoolDelete(vl_thread_pool* pool);
  * - **Ownership**: The pool copies the `task` data into its internal storage. The caller retains ownership of the
  * `task` pointer.
  * - **Lifetime**: Unchanged.
- * - **Thread Safety**: Thread-safe (lock-free).
+ * - **Thread Safety**: Thread-safe (lock-free unless a full tier blocks the caller).
  * - **Nullability**: Returns `VL_FALSE` if `pool` or `task` is `NULL`.
- * - **Error Conditions**: Returns `VL_FALSE` if the pool is in the process of shutting down.
+ * - **Error Conditions**: Returns `VL_FALSE` if the pool is in the process of shutting down, or if the tier is full
+ * and the overflow policy is `VL_THREAD_POOL_OVERFLOW_FAIL` or a blocking wait timed out.
  * - **Undefined Behavior**: None.
  * - **Memory Allocation Expectations**: May trigger node allocation in the underlying async queues.
- * - **Return-value Semantics**: Returns `VL_TRUE` if the task was successfully enqueued, `VL_FALSE` otherwise.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if the task was successfully enqueued, or executed inline under
+ * `VL_THREAD_POOL_OVERFLOW_CALLER_RUNS`; `VL_FALSE` otherwise.
  *
  * \param pool Thread pool handle
  * \param priority Priority level (HIGH, MEDIUM, or LOW)
  * \param task Pointer to task structure (copied internally)
- * \return VL_TRUE on success, VL_FALSE if pool is shutting down
+ * \return VL_TRUE on success, VL_FALSE if pool is shutting down or the task
+ * was rejected by the overflow policy
  *
  * \note This function is lock-free and safe to call concurrently from any
- * thread.
+ * thread, except that a full tier under `VL_THREAD_POOL_OVERFLOW_BLOCK` waits
+ * on a condition variable.
  *
  * \sa vlThreadPoolEnqueueBatchPriority, vlThreadPoolWait
  */
@@ -287,21 +606,24 @@ VL_API vl_bool_t vlThreadPoolEnqueuePriority(vl_thread_pool* pool, vl_thread_poo
  * ## Contract
  * - **Ownership**: The pool copies the tasks in the `tasks` array into its internal storage.
  * - **Lifetime**: Unchanged.
- * - **Thread Safety**: Thread-safe (lock-free).
+ * - **Thread Safety**: Thread-safe (lock-free unless a full tier blocks the caller).
  * - **Nullability**: Returns 0 if `pool` or `tasks` is `NULL`.
- * - **Error Conditions**: Returns 0 if the pool is shutting down.
+ * - **Error Conditions**: Returns 0 if the pool is shutting down. Stops early at the first task the overflow policy
+ * rejects.
  * - **Undefined Behavior**: None.
  * - **Memory Allocation Expectations**: May trigger node allocation in the underlying async queues.
- * - **Return-value Semantics**: Returns the number of tasks successfully enqueued.
+ * - **Return-value Semantics**: Returns the number of tasks successfully enqueued, counting tasks executed inline
+ * under `VL_THREAD_POOL_OVERFLOW_CALLER_RUNS`.
  *
  * \param pool Thread pool handle
  * \param priority Priority level for all tasks
  * \param tasks Pointer to array of task structures
  * \param count Number of tasks in the array
  * \return Number of tasks successfully enqueued (< count if shutdown in
- * progress)
+ * progress or the overflow policy rejected a task)
  *
- * \note This function is lock-free and safe to call concurrently.
+ * \note This function is lock-free and safe to call concurrently, with the
+ * same blocking caveat as vlThreadPoolEnqueuePriority.
  *
  * \sa vlThreadPoolEnqueuePriority
  */
@@ -373,6 +695,44 @@ static inline vl_uint_t vlThreadPoolEnqueueBatch(vl_thread_pool* pool, const vl_
  */
 VL_API vl_bool_t vlThreadPoolWait(vl_thread_pool* pool, vl_uint_t timeout_ms);
 
+/**
+ * \brief Loop body for vlThreadPoolParallelFor.
+ *
+ * \param user_data Context pointer passed to vlThreadPoolParallelFor
+ * \param index Iteration index in `[0, count)`
+ */
+typedef void (*vl_thread_pool_for_proc)(void* user_data, vl_uint_t index);
+
+/**
+ * \brief Runs `proc(user_data, i)` for every `i` in `[0, count)` across the
+ * pool's workers, returning once every iteration has finished.
+ *
+ * Iterations are claimed dynamically, so uneven iteration costs balance
+ * themselves. The calling thread claims iterations alongside the workers,
+ * which means the loop always makes progress: it is safe to call from inside
+ * a pool task, from a saturated pool, or from a pool that is shutting down.
+ * Unlike vlThreadPoolWait, it waits only for its own iterations.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged. `user_data` remains owned by the caller.
+ * - **Lifetime**: `user_data` only needs to remain valid until this function returns.
+ * - **Thread Safety**: Thread-safe. `proc` is invoked concurrently from several threads.
+ * - **Nullability**: If `pool` is `NULL`, every iteration runs on the calling thread. `proc` must not be `NULL`.
+ * - **Error Conditions**: If helper tasks cannot be allocated or enqueued, the calling thread runs the
+ * remaining iterations itself. Helpers are only queued into free MEDIUM slots; the overflow policy never applies,
+ * so a full bounded tier neither blocks the call nor runs helpers inline.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: Allocates one small job descriptor per call.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param pool Thread pool handle
+ * \param count Number of iterations
+ * \param proc Loop body
+ * \param user_data Context pointer passed to every iteration
+ */
+VL_API void vlThreadPoolParallelFor(vl_thread_pool* pool, vl_uint_t count, vl_thread_pool_for_proc proc,
+                                    void* user_data);
+
 /**
  * \brief Initiates graceful shutdown of the thread pool.
  *
@@ -444,4 +804,122 @@ static inline vl_uint32_t vlThreadPoolQueueDepth(vl_thread_pool* pool)
     return stats.tasksPending[0] + stats.tasksPending[1] + stats.tasksPending[2];
 }
 
+/**
+ * \brief Enables or disables per-task timing capture.
+ *
+ * While enabled, every enqueued task is stamped with its enqueue time, and
+ * workers record queueing delay and execution time into their private
+ * histograms. Tasks enqueued while disabled are not timed, even if
+ * instrumentation is enabled before they execute.
+ *
+ * ## Contract
+ * - **Ownership**: Unchanged.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Thread-safe; may be toggled while tasks are running.
+ * - **Nullability**: Safe to call with `NULL` (no-op).
+ * - **Error Conditions**: None.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: None (void).
+ *
+ * \param pool Thread pool handle
+ * \param enabled VL_TRUE to capture timings, VL_FALSE to stop
+ *
+ * \note Timing costs two monotonic clock reads per task on the worker and one
+ * per task on the producer.
+ */
+VL_API void vlThreadPoolSetInstrumentation(vl_thread_pool* pool, vl_bool_t enabled);
+
+/**
+ * \brief Retrieves a snapshot of one worker's counters and histograms.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Thread-safe. Each field is read atomically, but fields
+ *   are not captured as a single consistent unit.
+ * - **Nullability**: Returns `VL_FALSE` if `pool` or `out_stats` is `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` if `worker_index` is out of range.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if `out_stats` was populated.
+ *
+ * \param pool Thread pool handle
+ * \param worker_index Worker slot index in `[0, max_workers)`
+ * \param out_stats Pointer to stats structure to populate
+ * \return VL_TRUE on success, VL_FALSE otherwise
+ */
+VL_API vl_bool_t vlThreadPoolGetWorkerStats(vl_thread_pool* pool, vl_uint_t worker_index,
+                                            vl_thread_pool_worker_stats* out_stats);
+
+/**
+ * \brief Retrieves a snapshot of one priority tier, merged across workers.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Thread-safe, with the same consistency caveat as
+ *   `vlThreadPoolGetWorkerStats`.
+ * - **Nullability**: Returns `VL_FALSE` if `pool` or `out_stats` is `NULL`.
+ * - **Error Conditions**: Returns `VL_FALSE` if `priority` is out of range.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns `VL_TRUE` if `out_stats` was populated.
+ *
+ * \param pool Thread pool handle
+ * \param priority Priority tier to report
+ * \param out_stats Pointer to stats structure to populate
+ * \return VL_TRUE on success, VL_FALSE otherwise
+ */
+VL_API vl_bool_t vlThreadPoolGetPriorityStats(vl_thread_pool* pool, vl_thread_pool_priority priority,
+                                              vl_thread_pool_priority_stats* out_stats);
+
+/**
+ * \brief Maps a nanosecond value to its histogram bucket index.
+ *
+ * \param value Sample in nanoseconds
+ * \return Bucket index in `[0, VL_THREAD_POOL_HISTOGRAM_BUCKETS)`
+ */
+VL_API vl_uint_t vlThreadPoolHistogramBucketIndex(vl_ularge_t value);
+
+/**
+ * \brief Returns the smallest value that maps to the specified bucket.
+ *
+ * The bucket covers `[lowerBound(i), lowerBound(i + 1))`.
+ *
+ * \param bucket Bucket index in `[0, VL_THREAD_POOL_HISTOGRAM_BUCKETS)`
+ * \return Inclusive lower bound in nanoseconds
+ */
+VL_API vl_ularge_t vlThreadPoolHistogramBucketLowerBound(vl_uint_t bucket);
+
+/**
+ * \brief Estimates a percentile of a histogram.
+ *
+ * ## Contract
+ * - **Ownership**: None.
+ * - **Lifetime**: Unchanged.
+ * - **Thread Safety**: Safe for concurrent reads of the same snapshot.
+ * - **Nullability**: Returns 0 if `hist` is `NULL`.
+ * - **Error Conditions**: Returns 0 for an empty histogram.
+ * - **Undefined Behavior**: None.
+ * - **Memory Allocation Expectations**: None.
+ * - **Return-value Semantics**: Returns the upper bound of the bucket holding
+ *   the requested rank, clamped to the recorded maximum.
+ *
+ * \param hist Histogram snapshot
+ * \param percentile Percentile in `[0, 100]`
+ * \return Estimated value in nanoseconds
+ */
+VL_API vl_ularge_t vlThreadPoolHistogramPercentile(const vl_thread_pool_histogram* hist, vl_float32_t percentile);
+
+/**
+ * \brief Accumulates one histogram snapshot into another.
+ *
+ * Useful for combining per-worker snapshots or building custom aggregates.
+ *
+ * \param dest Histogram receiving the merged counts
+ * \param src Histogram to add into `dest`
+ */
+VL_API void vlThreadPoolHistogramMerge(vl_thread_pool_histogram* dest, const vl_thread_pool_histogram* src);
+
 #endif // VL_THREAD_POOL_H
@@ -0,0 +1,286 @@
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define VL_FIBER_ASM_SWITCH 1
+#else
+#include <ucontext.h>
+#endif
+
+#ifndef MAP_STACK
+#define MAP_STACK 0
+#endif
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+
+/**
+ * \brief Saved execution state of a fiber or of the thread hosting it.
+ * \private
+ */
+typedef struct vl_fiber_context_
+{
+#ifdef VL_FIBER_ASM_SWITCH
+    void* stackPointer; /* Saved stack pointer; callee-saved registers live on the stack below it. */
+#else
+    ucontext_t ucontext;
+#endif
+    void* mapping; /* Base of the stack mapping, including the guard page. NULL for host contexts. */
+    vl_memsize_t mappingSize;
+} vl_fiber_context;
+
+/**
+ * \brief Fiber entry point signature.
+ * \private
+ */
+typedef void (*vl_fiber_context_entry)(void* arg);
+#define VL_FIBER_ENTRY_CALL
+
+#if defined(VL_FIBER_ASM_SWITCH) && defined(__x86_64__)
+
+/*
+ * System V AMD64: rbx, rbp, r12-r15, the MXCSR control bits and the x87
+ * control word are callee-saved. The switch pushes them onto the outgoing
+ * stack, swaps stack pointers, and pops them from the incoming one.
+ *
+ * A fresh stack is laid out so that the first switch "returns" into the start
+ * stub with the entry function in r13 and its argument in r12.
+ */
+__asm__(".text\n"
+        ".globl vl_fiber_switch_x86_64\n"
+        ".hidden vl_fiber_switch_x86_64\n"
+        ".type vl_fiber_switch_x86_64,@function\n"
+        ".p2align 4\n"
+        "vl_fiber_switch_x86_64:\n"
+        "    pushq %rbp\n"
+        "    pushq %rbx\n"
+        "    pushq %r12\n"
+        "    pushq %r13\n"
+        "    pushq %r14\n"
+        "    pushq %r15\n"
+        "    subq $8, %rsp\n"
+        "    stmxcsr (%rsp)\n"
+        "    fnstcw 4(%rsp)\n"
+        "    movq %rsp, (%rdi)\n"
+        "    movq %rsi, %rsp\n"
+        "    ldmxcsr (%rsp)\n"
+        "    fldcw 4(%rsp)\n"
+        "    addq $8, %rsp\n"
+        "    popq %r15\n"
+        "    popq %r14\n"
+        "    popq %r13\n"
+        "    popq %r12\n"
+        "    popq %rbx\n"
+        "    popq %rbp\n"
+        "    ret\n"
+        ".size vl_fiber_switch_x86_64, .-vl_fiber_switch_x86_64\n"
+        "\n"
+        ".globl vl_fiber_start_x86_64\n"
+        ".hidden vl_fiber_start_x86_64\n"
+        ".type vl_fiber_start_x86_64,@function\n"
+        ".p2align 4\n"
+        "vl_fiber_start_x86_64:\n"
+        "    movq %r12, %rdi\n"
+        "    callq *%r13\n"
+        "    ud2\n"
+        ".size vl_fiber_start_x86_64, .-vl_fiber_start_x86_64\n");
+
+extern void vl_fiber_switch_x86_64(void** saveStack, void* loadStack);
+extern void vl_fiber_start_x86_64(void);
+
+#elif defined(VL_FIBER_ASM_SWITCH) && defined(__aarch64__)
+
+/*
+ * AAPCS64: x19-x29, the link register and the low halves of v8-v15 (d8-d15)
+ * are callee-saved. The 160-byte frame keeps sp 16-byte aligned.
+ *
+ * A fresh stack is laid out so that the first switch "returns" through x30
+ * into the start stub with the argument in x19 and the entry function in x20.
+ */
+__asm__(".text\n"
+        ".globl vl_fiber_switch_aarch64\n"
+        ".hidden vl_fiber_switch_aarch64\n"
+        ".type vl_fiber_switch_aarch64,%function\n"
+        ".p2align 4\n"
+        "vl_fiber_switch_aarch64:\n"
+        "    sub sp, sp, #160\n"
+        "    stp x19, x20, [sp, #0]\n"
+        "    stp x21, x22, [sp, #16]\n"
+        "    stp x23, x24, [sp, #32]\n"
+        "    stp x25, x26, [sp, #48]\n"
+        "    stp x27, x28, [sp, #64]\n"
+        "    stp x29, x30, [sp, #80]\n"
+        "    stp d8, d9, [sp, #96]\n"
+        "    stp d10, d11, [sp, #112]\n"
+        "    stp d12, d13, [sp, #128]\n"
+        "    stp d14, d15, [sp, #144]\n"
+        "    mov x9, sp\n"
+        "    str x9, [x0]\n"
+        "    mov sp, x1\n"
+        "    ldp x19, x20, [sp, #0]\n"
+        "    ldp x21, x22, [sp, #16]\n"
+        "    ldp x23, x24, [sp, #32]\n"
+        "    ldp x25, x26, [sp, #48]\n"
+        "    ldp x27, x28, [sp, #64]\n"
+        "    ldp x29, x30, [sp, #80]\n"
+        "    ldp d8, d9, [sp, #96]\n"
+        "    ldp d10, d11, [sp, #112]\n"
+        "    ldp d12, d13, [sp, #128]\n"
+        "    ldp d14, d15, [sp, #144]\n"
+        "    add sp, sp, #160\n"
+        "    ret\n"
+        ".size vl_fiber_switch_aarch64, .-vl_fiber_switch_aarch64\n"
+        "\n"
+        ".globl vl_fiber_start_aarch64\n"
+        ".hidden vl_fiber_start_aarch64\n"
+        ".type vl_fiber_start_aarch64,%function\n"
+        ".p2align 4\n"
+        "vl_fiber_start_aarch64:\n"
+        "    mov x0, x19\n"
+        "    blr x20\n"
+        "    brk #0\n"
+        ".size vl_fiber_start_aarch64, .-vl_fiber_start_aarch64\n");
+
+extern void vl_fiber_switch_aarch64(void** saveStack, void* loadStack);
+extern void vl_fiber_start_aarch64(void);
+
+#else
+
+/**
+ * \brief Reassembles the entry function and argument split across makecontext's int arguments.
+ * \private
+ */
+static void vl_FiberContextTrampoline(unsigned int procHi, unsigned int procLo, unsigned int argHi,
+                                      unsigned int argLo)
+{
+    const vl_uintptr_t procBits = ((vl_uintptr_t)procHi << 16 << 16) | (vl_uintptr_t)procLo;
+    const vl_uintptr_t argBits = ((vl_uintptr_t)argHi << 16 << 16) | (vl_uintptr_t)argLo;
+
+    ((vl_fiber_context_entry)procBits)((void*)argBits);
+    abort();
+}
+
+#endif
+
+/**
+ * \brief Returns the system page size.
+ * \private
+ */
+static vl_memsize_t vl_FiberPageSize(void)
+{
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    return pageSize > 0 ? (vl_memsize_t)pageSize : VL_KB(4);
+}
+
+/**
+ * \brief Maps a stack and prepares `context` to call `entry(arg)` when first switched to.
+ * \private
+ */
+static vl_bool_t vl_FiberContextInit(vl_fiber_context* context, vl_memsize_t stackSize, vl_bool_t guardPage,
+                                     vl_fiber_context_entry entry, void* arg)
+{
+    const vl_memsize_t pageSize = vl_FiberPageSize();
+    const vl_memsize_t guardSize = guardPage ? pageSize : 0;
+    const vl_memsize_t mappingSize = VL_MEMORY_PAD_UP(stackSize, pageSize) + guardSize;
+
+    void* mapping =
+        mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return VL_FALSE;
+    }
+
+    /* Stacks grow down; overflowing into the lowest page faults instead of corrupting a neighbour. */
+    if (guardPage && mprotect(mapping, guardSize, PROT_NONE) != 0)
+    {
+        munmap(mapping, mappingSize);
+        return VL_FALSE;
+    }
+
+    context->mapping = mapping;
+    context->mappingSize = mappingSize;
+
+    vl_uintptr_t top = ((vl_uintptr_t)mapping + mappingSize) & ~(vl_uintptr_t)15;
+
+#if defined(VL_FIBER_ASM_SWITCH) && defined(__x86_64__)
+    vl_uint64_t* frame = (vl_uint64_t*)(top - 80);
+    frame[0] = 0x037F00001F80ull; /* Default MXCSR (low) and x87 control word (bits 32-47). */
+    frame[1] = 0; /* r15 */
+    frame[2] = 0; /* r14 */
+    frame[3] = (vl_uint64_t)(vl_uintptr_t)entry; /* r13 */
+    frame[4] = (vl_uint64_t)(vl_uintptr_t)arg; /* r12 */
+    frame[5] = 0; /* rbx */
+    frame[6] = 0; /* rbp */
+    frame[7] = (vl_uint64_t)(vl_uintptr_t)vl_fiber_start_x86_64; /* return address */
+    frame[8] = 0;
+    frame[9] = 0;
+    context->stackPointer = frame;
+#elif defined(VL_FIBER_ASM_SWITCH) && defined(__aarch64__)
+    vl_uint64_t* frame = (vl_uint64_t*)(top - 160);
+    memset(frame, 0, 160);
+    frame[0] = (vl_uint64_t)(vl_uintptr_t)arg; /* x19 */
+    frame[1] = (vl_uint64_t)(vl_uintptr_t)entry; /* x20 */
+    frame[11] = (vl_uint64_t)(vl_uintptr_t)vl_fiber_start_aarch64; /* x30 */
+    context->stackPointer = frame;
+#else
+    (void)top;
+    if (getcontext(&context->ucontext) != 0)
+    {
+        munmap(mapping, mappingSize);
+        return VL_FALSE;
+    }
+
+    context->ucontext.uc_stack.ss_sp = (vl_uint8_t*)mapping + guardSize;
+    context->ucontext.uc_stack.ss_size = mappingSize - guardSize;
+    context->ucontext.uc_link = NULL;
+
+    const vl_uintptr_t procBits = (vl_uintptr_t)entry;
+    const vl_uintptr_t argBits = (vl_uintptr_t)arg;
+    makecontext(&context->ucontext, (void (*)(void))vl_FiberContextTrampoline, 4,
+                (unsigned int)(procBits >> 16 >> 16), (unsigned int)(procBits & 0xFFFFFFFFu),
+                (unsigned int)(argBits >> 16 >> 16), (unsigned int)(argBits & 0xFFFFFFFFu));
+#endif
+
+    return VL_TRUE;
+}
+
+/**
+ * \brief Unmaps a fiber stack.
+ * \private
+ */
+static void vl_FiberContextFree(vl_fiber_context* context)
+{
+    if (context->mapping != NULL)
+    {
+        munmap(context->mapping, context->mappingSize);
+        context->mapping = NULL;
+    }
+}
+
+/**
+ * \brief Prepares the calling thread to switch into fibers.
+ * \private
+ */
+static vl_bool_t vl_FiberContextHostInit(vl_fiber_context* host)
+{
+    /* The host's state is captured by the first switch out of it. */
+    host->mapping = NULL;
+    host->mappingSize = 0;
+    return VL_TRUE;
+}
+
+/**
+ * \brief Saves the current state into `from` and resumes `to`.
+ * \private
+ */
+static inline void vl_FiberContextSwitch(vl_fiber_context* from, vl_fiber_context* to)
+{
+#if defined(VL_FIBER_ASM_SWITCH) && defined(__x86_64__)
+    vl_fiber_switch_x86_64(&from->stackPointer, to->stackPointer);
+#elif defined(VL_FIBER_ASM_SWITCH) && defined(__aarch64__)
+    vl_fiber_switch_aarch64(&from->stackPointer, to->stackPointer);
+#else
+    swapcontext(&from->ucontext, &to->ucontext);
+#endif
+}
@@ -273,7 +273,7 @@ static vl_filesys_result vl_FSPathMkDirRecursive(const char* path, mode_t mode)
     }
 
     // Find the last separator in the path
-    char* last_sep = strrchr(path_copy, '/');
+    char* last_sep = (char*)vl_FSFindLast(path_copy, len - (size_t)removedSlash, '/');
     if (last_sep != NULL)
     {
         // Temporarily terminate the string at the separator
@@ -1,3 +1,4 @@
+#include <errno.h>
 #include <semaphore.h>
 #include <time.h>
 
@@ -29,6 +30,16 @@ void vlSemaphoreDelete(vl_semaphore sem)
 
 vl_bool_t vlSemaphoreWait(vl_semaphore sem, vl_uint_t timeoutMs)
 {
+    if (timeoutMs == 0)
+    {
+        /* Infinite wait, matching the Win32 implementation. Retry on signal interruption. */
+        int result;
+        while ((result = sem_wait((sem_t*)sem)) != 0 && errno == EINTR)
+        {
+        }
+        return result == 0;
+    }
+
     struct timespec waitTime, now;
     clock_gettime(CLOCK_REALTIME, &now);
 
@@ -43,7 +54,11 @@ vl_bool_t vlSemaphoreWait(vl_semaphore sem, vl_uint_t timeoutMs)
         waitTime.tv_sec += 1;
         waitTime.tv_nsec -= 1000000000;
     }
-    return sem_timedwait((sem_t*)sem, &waitTime) == 0;
+    int result;
+    while ((result = sem_timedwait((sem_t*)sem, &waitTime)) != 0 && errno == EINTR)
+    {
+    }
+    return result == 0;
 }
 
 void vlSemaphorePost(vl_semaphore sem) { sem_post((sem_t*)sem); }
@@ -254,4 +254,11 @@ void vlThreadSleepNano(vl_ularge_t nanoseconds)
     nanosleep(&request, NULL);
 }
 
+vl_ularge_t vlThreadMonotonicNano(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (vl_ularge_t)now.tv_sec * 1000000000ull + (vl_ularge_t)now.tv_nsec;
+}
+
 void vlThreadExit(void) { pthread_exit(NULL); }
@@ -9,7 +9,10 @@
  */
 
 #include <immintrin.h>
+#include <string.h>
+#include <vl/vl_algo.h>
 #include <vl/vl_simd.h>
+#include "vl_simd_kernels.h"
 
 /* ============================================================================
  * 4-Wide Float Operations (F32)
@@ -444,12 +447,1502 @@ static vl_simd_vec8_f32 vlSIMDNotVec8F32AVX2(vl_simd_vec8_f32 a)
     return result;
 }
 
+/* ============================================================================
+ * Sorting Networks
+ * ============================================================================
+ */
+
+/**
+ * Copies keys into a power-of-two block of at least 8 signed integers with the
+ * same ordering, padding the tail with INT32_MAX. floatMask is 0x7FFFFFFF for
+ * floats and flip is 0x80000000 for unsigned integers; the mapping is its own
+ * inverse.
+ */
+static vl_dsidx_t vlSIMDSortPackAVX2(vl_int32_t* block, const vl_uint32_t* keys, vl_dsidx_t count,
+                                     vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_dsidx_t blockSize = 8;
+    while (blockSize < count)
+    {
+        blockSize <<= 1;
+    }
+
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        block[i] = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+    }
+    for (vl_dsidx_t i = count; i < blockSize; i++)
+    {
+        block[i] = 0x7FFFFFFF;
+    }
+    return blockSize;
+}
+
+static void vlSIMDSortUnpackAVX2(vl_uint32_t* keys, const vl_int32_t* block, vl_dsidx_t count,
+                                 vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = (vl_uint32_t)block[i] ^ flip;
+        keys[i] = x ^ ((0u - (x >> 31)) & floatMask);
+    }
+}
+
+/**
+ * Compare-exchanges each lane with its partner `p`, keeping the maximum in
+ * lanes set in `takeMax` and the minimum elsewhere.
+ */
+static inline __m256i vlSIMDSortStepAVX2(__m256i v, __m256i p, __m256i takeMax)
+{
+    return _mm256_blendv_epi8(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), takeMax);
+}
+
+/**
+ * Runs the in-register steps (partner distance 4, 2, 1) of one bitonic merge
+ * stage, with `dir` set in lanes that merge in descending order.
+ */
+static inline __m256i vlSIMDSortMergeLanesAVX2(__m256i v, __m256i dir, __m256i bit4, __m256i bit2, __m256i bit1)
+{
+    v = vlSIMDSortStepAVX2(v, _mm256_permute2x128_si256(v, v, 0x01), _mm256_xor_si256(bit4, dir));
+    v = vlSIMDSortStepAVX2(v, _mm256_shuffle_epi32(v, 0x4E), _mm256_xor_si256(bit2, dir));
+    return vlSIMDSortStepAVX2(v, _mm256_shuffle_epi32(v, 0xB1), _mm256_xor_si256(bit1, dir));
+}
+
+static void vlSIMDSortNetworkAVX2(vl_int32_t* block, vl_dsidx_t n)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_cmpeq_epi32(zero, zero);
+    const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i bit1 = _mm256_cmpgt_epi32(_mm256_and_si256(iota, _mm256_set1_epi32(1)), zero);
+    const __m256i bit2 = _mm256_cmpgt_epi32(_mm256_and_si256(iota, _mm256_set1_epi32(2)), zero);
+    const __m256i bit4 = _mm256_cmpgt_epi32(_mm256_and_si256(iota, _mm256_set1_epi32(4)), zero);
+
+    /* Stages 2, 4 and 8 sort each vector on its own, alternating direction. */
+    for (vl_dsidx_t i = 0; i < n; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(block + i));
+        v = vlSIMDSortStepAVX2(v, _mm256_shuffle_epi32(v, 0xB1), _mm256_xor_si256(bit1, bit2));
+        v = vlSIMDSortStepAVX2(v, _mm256_shuffle_epi32(v, 0x4E), _mm256_xor_si256(bit2, bit4));
+        v = vlSIMDSortStepAVX2(v, _mm256_shuffle_epi32(v, 0xB1), _mm256_xor_si256(bit1, bit4));
+        v = vlSIMDSortMergeLanesAVX2(v, (i & 8) ? ones : zero, bit4, bit2, bit1);
+        _mm256_storeu_si256((__m256i*)(block + i), v);
+    }
+
+    for (vl_dsidx_t k = 16; k <= n; k <<= 1)
+    {
+        /* Partners at least one vector apart: whole vectors compare-exchange. */
+        for (vl_dsidx_t j = k >> 1; j >= 8; j >>= 1)
+        {
+            for (vl_dsidx_t base = 0; base < n; base += j << 1)
+            {
+                for (vl_dsidx_t i = base; i < base + j; i += 8)
+                {
+                    const __m256i a = _mm256_loadu_si256((const __m256i*)(block + i));
+                    const __m256i b = _mm256_loadu_si256((const __m256i*)(block + i + j));
+                    const __m256i lo = _mm256_min_epi32(a, b);
+                    const __m256i hi = _mm256_max_epi32(a, b);
+                    const vl_bool_t descending = (i & k) != 0;
+                    _mm256_storeu_si256((__m256i*)(block + i), descending ? hi : lo);
+                    _mm256_storeu_si256((__m256i*)(block + i + j), descending ? lo : hi);
+                }
+            }
+        }
+
+        for (vl_dsidx_t i = 0; i < n; i += 8)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(block + i));
+            v = vlSIMDSortMergeLanesAVX2(v, (i & k) ? ones : zero, bit4, bit2, bit1);
+            _mm256_storeu_si256((__m256i*)(block + i), v);
+        }
+    }
+}
+
+static void vlSIMDSortKeysAVX2(void* keys, vl_dsidx_t count, vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_int32_t block[VL_SIMD_SORT_NETWORK_MAX];
+    if (count < 2)
+    {
+        return;
+    }
+    const vl_dsidx_t blockSize = vlSIMDSortPackAVX2(block, (const vl_uint32_t*)keys, count, floatMask, flip);
+    vlSIMDSortNetworkAVX2(block, blockSize);
+    vlSIMDSortUnpackAVX2((vl_uint32_t*)keys, block, count, floatMask, flip);
+}
+
+static void vlSIMDSortI32AVX2(vl_int32_t* data, vl_dsidx_t count) { vlSIMDSortKeysAVX2(data, count, 0, 0); }
+
+static void vlSIMDSortU32AVX2(vl_uint32_t* data, vl_dsidx_t count) { vlSIMDSortKeysAVX2(data, count, 0, 0x80000000u); }
+
+static void vlSIMDSortF32AVX2(vl_float32_t* data, vl_dsidx_t count)
+{
+    vlSIMDSortKeysAVX2(data, count, 0x7FFFFFFFu, 0);
+}
+
+/**
+ * Scalar tail of the rank kernels: counts encoded keys before `encodedKey`.
+ */
+static vl_dsidx_t vlSIMDRankTailAVX2(const vl_uint32_t* keys, vl_dsidx_t count, vl_int32_t encodedKey,
+                                     vl_uint32_t floatMask, vl_uint32_t flip, vl_bool_t inclusive)
+{
+    vl_dsidx_t rank = 0;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        const vl_int32_t encoded = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+        rank += inclusive ? encoded <= encodedKey : encoded < encodedKey;
+    }
+    return rank;
+}
+
+/**
+ * Counts keys before `key`, comparing eight keys per step after mapping them
+ * to order-preserving signed integers in-register.
+ */
+static vl_dsidx_t vlSIMDRankKeysAVX2(const void* keys, vl_dsidx_t count, vl_uint32_t key, vl_uint32_t floatMask,
+                                     vl_uint32_t flip, vl_bool_t inclusive)
+{
+    const vl_uint32_t* src = (const vl_uint32_t*)keys;
+    const vl_int32_t encodedKey = (vl_int32_t)(key ^ ((0u - (key >> 31)) & floatMask) ^ flip);
+    const __m256i vKey = _mm256_set1_epi32(encodedKey);
+    const __m256i vFloat = _mm256_set1_epi32((vl_int32_t)floatMask);
+    const __m256i vFlip = _mm256_set1_epi32((vl_int32_t)flip);
+    __m256i counts = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        v = _mm256_xor_si256(_mm256_xor_si256(v, _mm256_and_si256(_mm256_srai_epi32(v, 31), vFloat)), vFlip);
+        /* Each matching lane is -1, so subtracting the mask counts it. */
+        counts = _mm256_sub_epi32(counts, inclusive ? _mm256_cmpgt_epi32(v, vKey) : _mm256_cmpgt_epi32(vKey, v));
+    }
+
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(counts), _mm256_extracti128_si256(counts, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    const vl_dsidx_t vectorCount = (vl_dsidx_t)(vl_uint32_t)_mm_cvtsi128_si32(sum);
+
+    /* Inclusive ranks count the greater keys and take the complement. */
+    return (inclusive ? i - vectorCount : vectorCount) +
+        vlSIMDRankTailAVX2(src + i, count - i, encodedKey, floatMask, flip, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankI32AVX2(const vl_int32_t* keys, vl_dsidx_t count, vl_int32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysAVX2(keys, count, (vl_uint32_t)key, 0, 0, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankU32AVX2(const vl_uint32_t* keys, vl_dsidx_t count, vl_uint32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysAVX2(keys, count, key, 0, 0x80000000u, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankF32AVX2(const vl_float32_t* keys, vl_dsidx_t count, vl_float32_t key,
+                                    vl_bool_t inclusive)
+{
+    vl_uint32_t bits;
+    memcpy(&bits, &key, sizeof(bits));
+    return vlSIMDRankKeysAVX2(keys, count, bits, 0x7FFFFFFFu, 0, inclusive);
+}
+
+/* ============================================================================
+ * Array Kernels
+ * ============================================================================
+ */
+
+static inline vl_uint64_t vlSIMDHsumU64AVX2(__m256i acc)
+{
+    vl_uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+static inline vl_float32_t vlSIMDHsumF32AVX2(__m256 v)
+{
+    __m128 x = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 0x55));
+    return _mm_cvtss_f32(x);
+}
+
+/**
+ * Adds signed 32-bit lanes to four 64-bit accumulators. `sign` holds the upper
+ * halves; lanes are paired within each 128-bit half, which a sum ignores.
+ */
+static inline __m256i vlSIMDAccumulateI64AVX2(__m256i acc, __m256i v, __m256i sign)
+{
+    acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(v, sign));
+    return _mm256_add_epi64(acc, _mm256_unpackhi_epi32(v, sign));
+}
+
+static vl_float32_t vlSIMDSumF32AVX2(const vl_float32_t* data, vl_dsidx_t count)
+{
+    __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+        acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(data + i + 8));
+    }
+    for (; i + 8 <= count; i += 8)
+    {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+    }
+    return vlSIMDHsumF32AVX2(_mm256_add_ps(acc0, acc1)) + vlSIMDSumF32Scalar(data + i, count - i);
+}
+
+static vl_int64_t vlSIMDSumI32AVX2(const vl_int32_t* data, vl_dsidx_t count)
+{
+    __m256i acc = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        acc = vlSIMDAccumulateI64AVX2(acc, v, _mm256_srai_epi32(v, 31));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64AVX2(acc) + (vl_uint64_t)vlSIMDSumI32Scalar(data + i, count - i));
+}
+
+static vl_int64_t vlSIMDSumI16AVX2(const vl_int16_t* data, vl_dsidx_t count)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i acc = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i pairs = _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)(data + i)), ones);
+        acc = vlSIMDAccumulateI64AVX2(acc, pairs, _mm256_srai_epi32(pairs, 31));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64AVX2(acc) + (vl_uint64_t)vlSIMDSumI16Scalar(data + i, count - i));
+}
+
+static vl_uint64_t vlSIMDSumU8AVX2(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(data + i)), zero));
+    }
+    return vlSIMDHsumU64AVX2(acc) + vlSIMDSumU8Scalar(data + i, count - i);
+}
+
+static vl_float32_t vlSIMDDotF32AVX2(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
+{
+    __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    for (; i + 8 <= count; i += 8)
+    {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    }
+    return vlSIMDHsumF32AVX2(_mm256_add_ps(acc0, acc1)) + vlSIMDDotF32Scalar(a + i, b + i, count - i);
+}
+
+static vl_int64_t vlSIMDDotI32AVX2(const vl_int32_t* a, const vl_int32_t* b, vl_dsidx_t count)
+{
+    __m256i acc = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        const __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(va, vb));
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32)));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64AVX2(acc) + (vl_uint64_t)vlSIMDDotI32Scalar(a + i, b + i, count - i));
+}
+
+static vl_int64_t vlSIMDDotI16AVX2(const vl_int16_t* a, const vl_int16_t* b, vl_dsidx_t count)
+{
+    const __m256i intMin = _mm256_set1_epi32((vl_int32_t)0x80000000u);
+    __m256i acc = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i pairs = _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)(a + i)),
+                                                _mm256_loadu_si256((const __m256i*)(b + i)));
+        /* A pair sum of exactly 2^31 (both products -32768 * -32768) wraps to INT_MIN; widen it as unsigned. */
+        const __m256i sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(pairs, intMin), _mm256_srai_epi32(pairs, 31));
+        acc = vlSIMDAccumulateI64AVX2(acc, pairs, sign);
+    }
+    return (vl_int64_t)(vlSIMDHsumU64AVX2(acc) + (vl_uint64_t)vlSIMDDotI16Scalar(a + i, b + i, count - i));
+}
+
+static void vlSIMDAxpyF32AVX2(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const __m256 va = _mm256_set1_ps(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    vlSIMDAxpyF32Scalar(x + i, y + i, count - i, alpha);
+}
+
+static void vlSIMDAxpyI32AVX2(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const __m256i va = _mm256_set1_epi32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i product = _mm256_mullo_epi32(va, _mm256_loadu_si256((const __m256i*)(x + i)));
+        _mm256_storeu_si256((__m256i*)(y + i),
+                            _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(y + i)), product));
+    }
+    vlSIMDAxpyI32Scalar(x + i, y + i, count - i, alpha);
+}
+
+static void vlSIMDScaleF32AVX2(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const __m256 va = _mm256_set1_ps(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(va, _mm256_loadu_ps(src + i)));
+    }
+    vlSIMDScaleF32Scalar(src + i, dst + i, count - i, alpha);
+}
+
+static void vlSIMDScaleI32AVX2(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const __m256i va = _mm256_set1_epi32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                            _mm256_mullo_epi32(va, _mm256_loadu_si256((const __m256i*)(src + i))));
+    }
+    vlSIMDScaleI32Scalar(src + i, dst + i, count - i, alpha);
+}
+
+/**
+ * Folds full vectors into lane-wise minimum and maximum registers, then
+ * reduces the lanes and the tail with the scalar kernel.
+ */
+static void vlSIMDMinMaxFoldF32AVX2(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* min, vl_float32_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 8)
+    {
+        __m256 lo = _mm256_set1_ps(*min), hi = _mm256_set1_ps(*max);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 v = _mm256_loadu_ps(data + i);
+            lo = _mm256_min_ps(lo, v);
+            hi = _mm256_max_ps(hi, v);
+        }
+        vl_float32_t lanes[8];
+        _mm256_storeu_ps(lanes, lo);
+        vlSIMDMinMaxF32Scalar(lanes, 8, min, max);
+        _mm256_storeu_ps(lanes, hi);
+        vlSIMDMinMaxF32Scalar(lanes, 8, min, max);
+    }
+    vlSIMDMinMaxF32Scalar(data + i, count - i, min, max);
+}
+
+static void vlSIMDMinMaxFoldI32AVX2(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* min, vl_int32_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 8)
+    {
+        __m256i lo = _mm256_set1_epi32(*min), hi = _mm256_set1_epi32(*max);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+            lo = _mm256_min_epi32(lo, v);
+            hi = _mm256_max_epi32(hi, v);
+        }
+        vl_int32_t lanes[8];
+        _mm256_storeu_si256((__m256i*)lanes, lo);
+        vlSIMDMinMaxI32Scalar(lanes, 8, min, max);
+        _mm256_storeu_si256((__m256i*)lanes, hi);
+        vlSIMDMinMaxI32Scalar(lanes, 8, min, max);
+    }
+    vlSIMDMinMaxI32Scalar(data + i, count - i, min, max);
+}
+
+static void vlSIMDMinMaxFoldI16AVX2(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* min, vl_int16_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 16)
+    {
+        __m256i lo = _mm256_set1_epi16(*min), hi = _mm256_set1_epi16(*max);
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+            lo = _mm256_min_epi16(lo, v);
+            hi = _mm256_max_epi16(hi, v);
+        }
+        vl_int16_t lanes[16];
+        _mm256_storeu_si256((__m256i*)lanes, lo);
+        vlSIMDMinMaxI16Scalar(lanes, 16, min, max);
+        _mm256_storeu_si256((__m256i*)lanes, hi);
+        vlSIMDMinMaxI16Scalar(lanes, 16, min, max);
+    }
+    vlSIMDMinMaxI16Scalar(data + i, count - i, min, max);
+}
+
+static void vlSIMDMinMaxFoldU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* min, vl_uint8_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 32)
+    {
+        __m256i lo = _mm256_set1_epi8((char)*min), hi = _mm256_set1_epi8((char)*max);
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+            lo = _mm256_min_epu8(lo, v);
+            hi = _mm256_max_epu8(hi, v);
+        }
+        vl_uint8_t lanes[32];
+        _mm256_storeu_si256((__m256i*)lanes, lo);
+        vlSIMDMinMaxU8Scalar(lanes, 32, min, max);
+        _mm256_storeu_si256((__m256i*)lanes, hi);
+        vlSIMDMinMaxU8Scalar(lanes, 32, min, max);
+    }
+    vlSIMDMinMaxU8Scalar(data + i, count - i, min, max);
+}
+
+static vl_bool_t vlSIMDMinMaxF32AVX2(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* outMin,
+                                     vl_float32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_float32_t, vlSIMDMinMaxFoldF32AVX2, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI32AVX2(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* outMin,
+                                     vl_int32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int32_t, vlSIMDMinMaxFoldI32AVX2, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI16AVX2(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* outMin,
+                                     vl_int16_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int16_t, vlSIMDMinMaxFoldI16AVX2, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* outMin,
+                                    vl_uint8_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_uint8_t, vlSIMDMinMaxFoldU8AVX2, data, count, outMin, outMax);
+}
+
+/*
+ * Arg-min runs in two passes: a vector reduction finds the minimum, then a
+ * vector scan stops at the first block holding it. If the minimum is never
+ * found again (only possible with NaN), index 0 is returned.
+ */
+
+static vl_dsidx_t vlSIMDArgMinF32AVX2(const vl_float32_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_float32_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldF32AVX2(data, count, &min, &max);
+
+    const __m256 target = _mm256_set1_ps(min);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), target, _CMP_EQ_OQ)))
+        {
+            break;
+        }
+    }
+    i += vlSIMDFindF32Scalar(data + i, count - i, min);
+    return i < count ? i : 0;
+}
+
+static vl_dsidx_t vlSIMDArgMinI32AVX2(const vl_int32_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_int32_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldI32AVX2(data, count, &min, &max);
+
+    const __m256i target = _mm256_set1_epi32(min);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), target)))
+        {
+            break;
+        }
+    }
+    return i + vlSIMDFindI32Scalar(data + i, count - i, min);
+}
+
+static vl_dsidx_t vlSIMDArgMinI16AVX2(const vl_int16_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_int16_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldI16AVX2(data, count, &min, &max);
+
+    const __m256i target = _mm256_set1_epi16(min);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(data + i)), target)))
+        {
+            break;
+        }
+    }
+    return i + vlSIMDFindI16Scalar(data + i, count - i, min);
+}
+
+static vl_dsidx_t vlSIMDArgMinU8AVX2(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_uint8_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldU8AVX2(data, count, &min, &max);
+
+    const __m256i target = _mm256_set1_epi8((char)min);
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i)), target)))
+        {
+            break;
+        }
+    }
+    return i + vlSIMDFindU8Scalar(data + i, count - i, min);
+}
+
+static void vlSIMDClampF32AVX2(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t lo,
+                               vl_float32_t hi)
+{
+    const __m256 vLo = _mm256_set1_ps(lo), vHi = _mm256_set1_ps(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), vLo), vHi));
+    }
+    vlSIMDClampF32Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+static void vlSIMDClampI32AVX2(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t lo,
+                               vl_int32_t hi)
+{
+    const __m256i vLo = _mm256_set1_epi32(lo), vHi = _mm256_set1_epi32(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_min_epi32(_mm256_max_epi32(v, vLo), vHi));
+    }
+    vlSIMDClampI32Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+static void vlSIMDClampI16AVX2(const vl_int16_t* src, vl_int16_t* dst, vl_dsidx_t count, vl_int16_t lo,
+                               vl_int16_t hi)
+{
+    const __m256i vLo = _mm256_set1_epi16(lo), vHi = _mm256_set1_epi16(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_min_epi16(_mm256_max_epi16(v, vLo), vHi));
+    }
+    vlSIMDClampI16Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+static void vlSIMDClampU8AVX2(const vl_uint8_t* src, vl_uint8_t* dst, vl_dsidx_t count, vl_uint8_t lo,
+                              vl_uint8_t hi)
+{
+    const __m256i vLo = _mm256_set1_epi8((char)lo), vHi = _mm256_set1_epi8((char)hi);
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_min_epu8(_mm256_max_epu8(v, vLo), vHi));
+    }
+    vlSIMDClampU8Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+/**
+ * Prefix sums scan each 128-bit half with two shifted adds, add the low
+ * half's total into the high half, then add the carry from the last vector.
+ */
+static void vlSIMDPrefixSumF32AVX2(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    const __m256i lastLow = _mm256_set1_epi32(3), lastHigh = _mm256_set1_epi32(7);
+    __m256 carry = _mm256_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 v = _mm256_loadu_ps(src + i);
+        v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 4)));
+        v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 8)));
+        v = _mm256_add_ps(v, _mm256_blend_ps(_mm256_setzero_ps(), _mm256_permutevar8x32_ps(v, lastLow), 0xF0));
+        v = _mm256_add_ps(v, carry);
+        _mm256_storeu_ps(dst + i, v);
+        carry = _mm256_permutevar8x32_ps(v, lastHigh);
+    }
+    vlSIMDPrefixSumF32Scalar(src + i, dst + i, count - i, _mm_cvtss_f32(_mm256_castps256_ps128(carry)));
+}
+
+static void vlSIMDPrefixSumI32AVX2(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    const __m256i lastLow = _mm256_set1_epi32(3), lastHigh = _mm256_set1_epi32(7);
+    __m256i carry = _mm256_setzero_si256();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+        v = _mm256_add_epi32(
+            v, _mm256_blend_epi32(_mm256_setzero_si256(), _mm256_permutevar8x32_epi32(v, lastLow), 0xF0));
+        v = _mm256_add_epi32(v, carry);
+        _mm256_storeu_si256((__m256i*)(dst + i), v);
+        carry = _mm256_permutevar8x32_epi32(v, lastHigh);
+    }
+    vlSIMDPrefixSumI32Scalar(src + i, dst + i, count - i, _mm_cvtsi128_si32(_mm256_castsi256_si128(carry)));
+}
+
+/**
+ * Compare kernels evaluate less, equal and greater for every lane and keep the
+ * ones selected by the compare code, so a single loop serves every operator.
+ */
+static inline __m256i vlSIMDCompareSelectAVX2(vl_uint32_t code, vl_uint32_t bit)
+{
+    return _mm256_set1_epi32((code & bit) ? -1 : 0);
+}
+
+static vl_dsidx_t vlSIMDCompareF32AVX2(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t value,
+                                       vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m256 wantLt = _mm256_castsi256_ps(vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_LT));
+    const __m256 wantEq = _mm256_castsi256_ps(vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_EQ));
+    const __m256 wantGt = _mm256_castsi256_ps(vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_GT));
+    const int invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFF : 0;
+    const __m256 v = _mm256_set1_ps(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 a = _mm256_loadu_ps(data + i);
+        const __m256 hit = _mm256_or_ps(_mm256_or_ps(_mm256_and_ps(_mm256_cmp_ps(a, v, _CMP_LT_OQ), wantLt),
+                                                     _mm256_and_ps(_mm256_cmp_ps(a, v, _CMP_EQ_OQ), wantEq)),
+                                        _mm256_and_ps(_mm256_cmp_ps(a, v, _CMP_GT_OQ), wantGt));
+        const vl_uint32_t byte = (vl_uint32_t)(_mm256_movemask_ps(hit) ^ invert);
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareF32Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareI32AVX2(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t value,
+                                       vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m256i wantLt = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_LT);
+    const __m256i wantEq = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_EQ);
+    const __m256i wantGt = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_GT);
+    const int invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFF : 0;
+    const __m256i v = _mm256_set1_epi32(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi32(v, a), wantLt),
+                                                            _mm256_and_si256(_mm256_cmpeq_epi32(a, v), wantEq)),
+                                             _mm256_and_si256(_mm256_cmpgt_epi32(a, v), wantGt));
+        const vl_uint32_t byte = (vl_uint32_t)(_mm256_movemask_ps(_mm256_castsi256_ps(hit)) ^ invert);
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareI32Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareI16AVX2(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t value,
+                                       vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m256i wantLt = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_LT);
+    const __m256i wantEq = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_EQ);
+    const __m256i wantGt = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_GT);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFFFu : 0u;
+    const __m256i v = _mm256_set1_epi16(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi16(v, a), wantLt),
+                                                            _mm256_and_si256(_mm256_cmpeq_epi16(a, v), wantEq)),
+                                             _mm256_and_si256(_mm256_cmpgt_epi16(a, v), wantGt));
+        /* Packing the two 128-bit halves together keeps the elements in order. */
+        const __m128i packed =
+            _mm_packs_epi16(_mm256_castsi256_si128(hit), _mm256_extracti128_si256(hit, 1));
+        const vl_uint32_t bits = (vl_uint32_t)_mm_movemask_epi8(packed) ^ invert;
+        mask[i / 8] = (vl_uint8_t)bits;
+        mask[i / 8 + 1] = (vl_uint8_t)(bits >> 8);
+        total += vlSIMDPopCountScalar(bits);
+    }
+    return total + vlSIMDCompareI16Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value,
+                                      vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m256i wantLt = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_LT);
+    const __m256i wantEq = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_EQ);
+    const __m256i wantGt = vlSIMDCompareSelectAVX2(code, VL_SIMD_CMP_CODE_GT);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFFFFFFFu : 0u;
+    /* Byte compares are signed; flipping the top bit maps unsigned order onto signed order. */
+    const __m256i bias = _mm256_set1_epi8((char)0x80);
+    const __m256i v = _mm256_xor_si256(_mm256_set1_epi8((char)value), bias);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i a = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(data + i)), bias);
+        const __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi8(v, a), wantLt),
+                                                            _mm256_and_si256(_mm256_cmpeq_epi8(a, v), wantEq)),
+                                             _mm256_and_si256(_mm256_cmpgt_epi8(a, v), wantGt));
+        const vl_uint32_t bits = (vl_uint32_t)_mm256_movemask_epi8(hit) ^ invert;
+        memcpy(mask + i / 8, &bits, sizeof(bits));
+        total += vlSIMDPopCountScalar(bits);
+    }
+    return total + vlSIMDCompareU8Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+/* ============================================================================
+ * 512-bit Wide Operations
+ *
+ * Each 16-lane or 64-byte vector is processed as two 256-bit halves.
+ * ============================================================================
+ */
+
+static vl_simd_vec16_f32 vlSIMDLoadVec16F32AVX2(const vl_float32_t* ptr)
+{
+    vl_simd_vec16_f32 result;
+    _mm256_storeu_ps(&result.components[0], _mm256_loadu_ps(&ptr[0]));
+    _mm256_storeu_ps(&result.components[8], _mm256_loadu_ps(&ptr[8]));
+    return result;
+}
+
+static void vlSIMDStoreVec16F32AVX2(vl_float32_t* ptr, vl_simd_vec16_f32 v)
+{
+    _mm256_storeu_ps(&ptr[0], _mm256_loadu_ps(&v.components[0]));
+    _mm256_storeu_ps(&ptr[8], _mm256_loadu_ps(&v.components[8]));
+}
+
+static vl_simd_vec16_f32 vlSIMDSplatVec16F32AVX2(vl_float32_t scalar)
+{
+    vl_simd_vec16_f32 result;
+    const __m256 s = _mm256_set1_ps(scalar);
+    _mm256_storeu_ps(&result.components[0], s);
+    _mm256_storeu_ps(&result.components[8], s);
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDAddVec16F32AVX2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int h = 0; h < 16; h += 8)
+        _mm256_storeu_ps(&result.components[h],
+                         _mm256_add_ps(_mm256_loadu_ps(&a.components[h]), _mm256_loadu_ps(&b.components[h])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDSubVec16F32AVX2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int h = 0; h < 16; h += 8)
+        _mm256_storeu_ps(&result.components[h],
+                         _mm256_sub_ps(_mm256_loadu_ps(&a.components[h]), _mm256_loadu_ps(&b.components[h])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDMulVec16F32AVX2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int h = 0; h < 16; h += 8)
+        _mm256_storeu_ps(&result.components[h],
+                         _mm256_mul_ps(_mm256_loadu_ps(&a.components[h]), _mm256_loadu_ps(&b.components[h])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDFmaVec16F32AVX2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b, vl_simd_vec16_f32 c)
+{
+    vl_simd_vec16_f32 result;
+    for (int h = 0; h < 16; h += 8)
+    {
+        const __m256 va = _mm256_loadu_ps(&a.components[h]);
+        const __m256 vb = _mm256_loadu_ps(&b.components[h]);
+        _mm256_storeu_ps(&result.components[h], _mm256_fmadd_ps(va, vb, _mm256_loadu_ps(&c.components[h])));
+    }
+    return result;
+}
+
+static vl_float32_t vlSIMDHsumVec16F32AVX2(vl_simd_vec16_f32 v)
+{
+    return vlSIMDHsumF32AVX2(_mm256_add_ps(_mm256_loadu_ps(&v.components[0]), _mm256_loadu_ps(&v.components[8])));
+}
+
+static vl_simd_vec16_i32 vlSIMDLoadVec16I32AVX2(const vl_int32_t* ptr)
+{
+    vl_simd_vec16_i32 result;
+    _mm256_storeu_si256((__m256i*)&result.components[0], _mm256_loadu_si256((const __m256i*)&ptr[0]));
+    _mm256_storeu_si256((__m256i*)&result.components[8], _mm256_loadu_si256((const __m256i*)&ptr[8]));
+    return result;
+}
+
+static void vlSIMDStoreVec16I32AVX2(vl_int32_t* ptr, vl_simd_vec16_i32 v)
+{
+    _mm256_storeu_si256((__m256i*)&ptr[0], _mm256_loadu_si256((const __m256i*)&v.components[0]));
+    _mm256_storeu_si256((__m256i*)&ptr[8], _mm256_loadu_si256((const __m256i*)&v.components[8]));
+}
+
+static vl_simd_vec16_i32 vlSIMDAddVec16I32AVX2(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int h = 0; h < 16; h += 8)
+    {
+        const __m256i va = _mm256_loadu_si256((const __m256i*)&a.components[h]);
+        const __m256i vb = _mm256_loadu_si256((const __m256i*)&b.components[h]);
+        _mm256_storeu_si256((__m256i*)&result.components[h], _mm256_add_epi32(va, vb));
+    }
+    return result;
+}
+
+static vl_simd_vec16_i32 vlSIMDMulVec16I32AVX2(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int h = 0; h < 16; h += 8)
+    {
+        const __m256i va = _mm256_loadu_si256((const __m256i*)&a.components[h]);
+        const __m256i vb = _mm256_loadu_si256((const __m256i*)&b.components[h]);
+        _mm256_storeu_si256((__m256i*)&result.components[h], _mm256_mullo_epi32(va, vb));
+    }
+    return result;
+}
+
+static vl_simd_vec64_u8 vlSIMDLoadVec64U8AVX2(const vl_uint8_t* ptr)
+{
+    vl_simd_vec64_u8 result;
+    _mm256_storeu_si256((__m256i*)&result.components[0], _mm256_loadu_si256((const __m256i*)&ptr[0]));
+    _mm256_storeu_si256((__m256i*)&result.components[32], _mm256_loadu_si256((const __m256i*)&ptr[32]));
+    return result;
+}
+
+static void vlSIMDStoreVec64U8AVX2(vl_uint8_t* ptr, vl_simd_vec64_u8 v)
+{
+    _mm256_storeu_si256((__m256i*)&ptr[0], _mm256_loadu_si256((const __m256i*)&v.components[0]));
+    _mm256_storeu_si256((__m256i*)&ptr[32], _mm256_loadu_si256((const __m256i*)&v.components[32]));
+}
+
+static vl_uint64_t vlSIMDEqMaskVec64U8AVX2(vl_simd_vec64_u8 v, vl_uint8_t byte)
+{
+    const __m256i needle = _mm256_set1_epi8((char)byte);
+    const __m256i low = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&v.components[0]), needle);
+    const __m256i high = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&v.components[32]), needle);
+    return (vl_uint64_t)(vl_uint32_t)_mm256_movemask_epi8(low) |
+        ((vl_uint64_t)(vl_uint32_t)_mm256_movemask_epi8(high) << 32);
+}
+
+/* ============================================================================
+ * Byte Scanning
+ *
+ * Long arrays are skimmed four vectors at a time, testing only whether any
+ * byte in the block matched; the single-vector loop then pins down where.
+ * Arrays of at least one vector end with a vector that overlaps the one
+ * before it instead of a scalar tail. The overlapped bytes are already known
+ * not to match, so they cannot change a find or equality result. Arrays of
+ * 16 to 31 bytes use two overlapping 128-bit vectors the same way.
+ * ============================================================================
+ */
+
+/** Bit `i` is set when byte `i` of the 32 at `ptr` equals the splatted value. */
+static inline vl_uint32_t vlSIMDEqBitsU8AVX2(const vl_uint8_t* ptr, __m256i value)
+{
+    return (vl_uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)ptr), value));
+}
+
+/** Whether any of the 128 bytes at `ptr` equals the splatted value. */
+static inline vl_bool_t vlSIMDEqAny4U8AVX2(const vl_uint8_t* ptr, __m256i value)
+{
+    const __m256i e0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)ptr), value);
+    const __m256i e1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(ptr + 32)), value);
+    const __m256i e2 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(ptr + 64)), value);
+    const __m256i e3 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(ptr + 96)), value);
+    const __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+    return !_mm256_testz_si256(any, any);
+}
+
+/**
+ * Match bits for 16 to 31 bytes: bit `i` is set when byte `i` equals the value.
+ * The two 128-bit compares overlap, and agree wherever they do.
+ */
+static inline vl_uint32_t vlSIMDEqBitsShortU8AVX2(const vl_uint8_t* ptr, vl_dsidx_t count, vl_uint8_t value)
+{
+    const __m128i v = _mm_set1_epi8((char)value);
+    const vl_uint32_t lo = (vl_uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ptr), v));
+    const vl_uint32_t hi =
+        (vl_uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(ptr + count - 16)), v));
+    return lo | (hi << (count - 16));
+}
+
+/** Bit `i` is set when byte `i` of the 32 at `ptr` equals any of the `setCount` splatted values. */
+static inline vl_uint32_t vlSIMDAnyBitsU8AVX2(const vl_uint8_t* ptr, const __m256i* set, vl_dsidx_t setCount)
+{
+    const __m256i a = _mm256_loadu_si256((const __m256i*)ptr);
+    __m256i hit = _mm256_cmpeq_epi8(a, set[0]);
+    for (vl_dsidx_t k = 1; k < setCount; k++)
+    {
+        hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(a, set[k]));
+    }
+    return (vl_uint32_t)_mm256_movemask_epi8(hit);
+}
+
+static vl_dsidx_t vlSIMDFindU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    vl_uint32_t bits;
+    if (count < 32)
+    {
+        if (count < 16)
+        {
+            return vlSIMDFindU8Scalar(data, count, value);
+        }
+        bits = vlSIMDEqBitsShortU8AVX2(data, count, value);
+        return bits ? vlAlgoCTZ32(bits) : count;
+    }
+    const __m256i v = _mm256_set1_epi8((char)value);
+    vl_dsidx_t i = 0;
+    while (i + 128 <= count && !vlSIMDEqAny4U8AVX2(data + i, v))
+    {
+        i += 128;
+    }
+    for (; i + 32 <= count; i += 32)
+    {
+        if ((bits = vlSIMDEqBitsU8AVX2(data + i, v)) != 0)
+        {
+            return i + vlAlgoCTZ32(bits);
+        }
+    }
+    if (i == count)
+    {
+        return count;
+    }
+    i = count - 32;
+    bits = vlSIMDEqBitsU8AVX2(data + i, v);
+    return bits ? i + vlAlgoCTZ32(bits) : count;
+}
+
+static vl_dsidx_t vlSIMDFindLastU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    vl_uint32_t bits;
+    if (count < 32)
+    {
+        if (count < 16)
+        {
+            return vlSIMDFindLastU8Scalar(data, count, value);
+        }
+        bits = vlSIMDEqBitsShortU8AVX2(data, count, value);
+        return bits ? 31 - vlAlgoCLZ32(bits) : count;
+    }
+    const __m256i v = _mm256_set1_epi8((char)value);
+    vl_dsidx_t i = count;
+    while (i >= 128 && !vlSIMDEqAny4U8AVX2(data + i - 128, v))
+    {
+        i -= 128;
+    }
+    while (i >= 32)
+    {
+        i -= 32;
+        if ((bits = vlSIMDEqBitsU8AVX2(data + i, v)) != 0)
+        {
+            return i + 31 - vlAlgoCLZ32(bits);
+        }
+    }
+    if (i == 0)
+    {
+        return count;
+    }
+    bits = vlSIMDEqBitsU8AVX2(data, v);
+    return bits ? 31 - vlAlgoCLZ32(bits) : count;
+}
+
+static vl_dsidx_t vlSIMDFindAnyU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                      vl_dsidx_t setCount)
+{
+    if (count < 32 || setCount == 0 || setCount > VL_SIMD_FIND_ANY_VECTOR_MAX)
+    {
+        return vlSIMDFindAnyU8Scalar(data, count, set, setCount);
+    }
+    __m256i splat[VL_SIMD_FIND_ANY_VECTOR_MAX];
+    for (vl_dsidx_t k = 0; k < setCount; k++)
+    {
+        splat[k] = _mm256_set1_epi8((char)set[k]);
+    }
+    vl_dsidx_t i = 0;
+    vl_uint32_t bits;
+    for (; i + 32 <= count; i += 32)
+    {
+        if ((bits = vlSIMDAnyBitsU8AVX2(data + i, splat, setCount)) != 0)
+        {
+            return i + vlAlgoCTZ32(bits);
+        }
+    }
+    if (i == count)
+    {
+        return count;
+    }
+    i = count - 32;
+    bits = vlSIMDAnyBitsU8AVX2(data + i, splat, setCount);
+    return bits ? i + vlAlgoCTZ32(bits) : count;
+}
+
+static vl_dsidx_t vlSIMDCountU8AVX2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    if (count < 32)
+    {
+        return count < 16 ? vlSIMDCountU8Scalar(data, count, value)
+                          : vlAlgoPopCount32(vlSIMDEqBitsShortU8AVX2(data, count, value));
+    }
+    const __m256i v = _mm256_set1_epi8((char)value);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i total = zero;
+    vl_dsidx_t i = 0;
+    while (count - i >= 32)
+    {
+        /*
+         * A match is -1, so subtracting it counts up per byte. Two counters
+         * take alternate vectors and are widened every 252 vectors, before
+         * either can wrap.
+         */
+        const vl_dsidx_t vectors = (count - i) / 32 < 252 ? (count - i) / 32 : 252;
+        __m256i acc0 = zero, acc1 = zero;
+        vl_dsidx_t k = 0;
+        for (; k + 4 <= vectors; k += 4, i += 128)
+        {
+            acc0 = _mm256_sub_epi8(acc0, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i)), v));
+            acc1 = _mm256_sub_epi8(acc1, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i + 32)), v));
+            acc0 = _mm256_sub_epi8(acc0, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i + 64)), v));
+            acc1 = _mm256_sub_epi8(acc1, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i + 96)), v));
+        }
+        for (; k < vectors; k++, i += 32)
+        {
+            acc0 = _mm256_sub_epi8(acc0, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i)), v));
+        }
+        total = _mm256_add_epi64(total, _mm256_add_epi64(_mm256_sad_epu8(acc0, zero), _mm256_sad_epu8(acc1, zero)));
+    }
+    vl_uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, total);
+    return (vl_dsidx_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]) + vlSIMDCountU8Scalar(data + i, count - i, value);
+}
+
+static vl_bool_t vlSIMDEqualU8AVX2(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    if (count < 32)
+    {
+        if (count < 16)
+        {
+            return vlSIMDEqualU8Scalar(a, b, count);
+        }
+        const __m128i lo = _mm_xor_si128(_mm_loadu_si128((const __m128i*)a), _mm_loadu_si128((const __m128i*)b));
+        const __m128i hi = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + count - 16)),
+                                         _mm_loadu_si128((const __m128i*)(b + count - 16)));
+        const __m128i diff = _mm_or_si128(lo, hi);
+        return _mm_testz_si128(diff, diff) != 0;
+    }
+    vl_dsidx_t i = 0;
+    for (; i + 128 <= count; i += 128)
+    {
+        __m256i diff = _mm256_setzero_si256();
+        for (int k = 0; k < 128; k += 32)
+        {
+            diff = _mm256_or_si256(diff, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i + k)),
+                                                          _mm256_loadu_si256((const __m256i*)(b + i + k))));
+        }
+        if (!_mm256_testz_si256(diff, diff))
+        {
+            return VL_FALSE;
+        }
+    }
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i diff =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i)));
+        if (!_mm256_testz_si256(diff, diff))
+        {
+            return VL_FALSE;
+        }
+    }
+    if (i == count)
+    {
+        return VL_TRUE;
+    }
+    i = count - 32;
+    const __m256i diff =
+        _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i)));
+    return _mm256_testz_si256(diff, diff) != 0;
+}
+
+/* ============================================================================
+ * Half-Precision Conversion
+ *
+ * F16C converts eight elements per instruction and rounds to nearest even.
+ * ============================================================================
+ */
+
+static void vlSIMDConvertF32ToHalfAVX2(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i lo = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        const __m128i hi = _mm256_cvtps_ph(_mm256_loadu_ps(src + i + 8), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(dst + i), lo);
+        _mm_storeu_si128((__m128i*)(dst + i + 8), hi);
+    }
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    vlSIMDConvertF32ToHalfScalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertHalfToF32AVX2(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256 lo = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i)));
+        const __m256 hi = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i + 8)));
+        _mm256_storeu_ps(dst + i, lo);
+        _mm256_storeu_ps(dst + i + 8, hi);
+    }
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+    }
+    vlSIMDConvertHalfToF32Scalar(src + i, dst + i, count - i);
+}
+
+/* ============================================================================
+ * Numeric Type Conversion
+ *
+ * Widening loads (vpmovsx/vpmovzx) feed the 256-bit conversions directly.
+ * The AVX-512 backend keeps these kernels.
+ * ============================================================================
+ */
+
+static void vlSIMDConvertI32ToF32AVX2(const vl_int32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(src + i))));
+        _mm256_storeu_ps(dst + i + 8, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(src + i + 8))));
+    }
+    vlSIMDConvertI32ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF32ToI32AVX2(const vl_float32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_cvttps_epi32(_mm256_loadu_ps(src + i)));
+        _mm256_storeu_si256((__m256i*)(dst + i + 8), _mm256_cvttps_epi32(_mm256_loadu_ps(src + i + 8)));
+    }
+    vlSIMDConvertF32ToI32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI16ToF32AVX2(const vl_int16_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src + i)));
+        const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src + i + 8)));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(lo));
+        _mm256_storeu_ps(dst + i + 8, _mm256_cvtepi32_ps(hi));
+    }
+    vlSIMDConvertI16ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertU8ToF32AVX2(const vl_uint8_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i lo = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i)));
+        const __m256i hi = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i + 8)));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(lo));
+        _mm256_storeu_ps(dst + i + 8, _mm256_cvtepi32_ps(hi));
+    }
+    vlSIMDConvertU8ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF32ToF64AVX2(const vl_float32_t* src, vl_float64_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+        _mm256_storeu_pd(dst + i + 4, _mm256_cvtps_pd(_mm_loadu_ps(src + i + 4)));
+    }
+    vlSIMDConvertF32ToF64Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF64ToF32AVX2(const vl_float64_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+        _mm_storeu_ps(dst + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4)));
+    }
+    vlSIMDConvertF64ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI16ToI32AVX2(const vl_int16_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src + i)));
+        const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src + i + 8)));
+        _mm256_storeu_si256((__m256i*)(dst + i), lo);
+        _mm256_storeu_si256((__m256i*)(dst + i + 8), hi);
+    }
+    vlSIMDConvertI16ToI32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI32ToI16AVX2(const vl_int32_t* src, vl_int16_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        /* Sign-extend the low halves so the saturating pack keeps them intact, then undo its lane interleave. */
+        const __m256i lo = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i hi = _mm256_loadu_si256((const __m256i*)(src + i + 8));
+        const __m256i packed = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16),
+                                                  _mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 16));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    vlSIMDConvertI32ToI16Scalar(src + i, dst + i, count - i);
+}
+
+/* ============================================================================
+ * Byte Swapping and Gathers
+ *
+ * Byte swaps are a single vpshufb per vector. Gathers take their offsets as
+ * signed 32-bit lane values, so strides whose last-lane offset would not fit,
+ * positive or negative, use the scalar loop instead.
+ * ============================================================================
+ */
+
+/** Reverses the bytes of each element with one in-lane shuffle. */
+static inline void vlSIMDByteSwapAVX2(void* data, vl_ularge_t bytes, __m256i order)
+{
+    vl_uint8_t* ptr = (vl_uint8_t*)data;
+    for (vl_ularge_t i = 0; i + 64 <= bytes; i += 64)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(ptr + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(ptr + i + 32));
+        _mm256_storeu_si256((__m256i*)(ptr + i), _mm256_shuffle_epi8(a, order));
+        _mm256_storeu_si256((__m256i*)(ptr + i + 32), _mm256_shuffle_epi8(b, order));
+    }
+}
+
+static void vlSIMDByteSwapU16AVX2(vl_uint16_t* data, vl_dsidx_t count)
+{
+    const __m256i order = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                           1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const vl_dsidx_t vectorCount = count & ~(vl_dsidx_t)31;
+    vlSIMDByteSwapAVX2(data, (vl_ularge_t)vectorCount * 2, order);
+    vlSIMDByteSwapU16Scalar(data + vectorCount, count - vectorCount);
+}
+
+static void vlSIMDByteSwapU32AVX2(vl_uint32_t* data, vl_dsidx_t count)
+{
+    const __m256i order = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const vl_dsidx_t vectorCount = count & ~(vl_dsidx_t)15;
+    vlSIMDByteSwapAVX2(data, (vl_ularge_t)vectorCount * 4, order);
+    vlSIMDByteSwapU32Scalar(data + vectorCount, count - vectorCount);
+}
+
+static void vlSIMDByteSwapU64AVX2(vl_uint64_t* data, vl_dsidx_t count)
+{
+    const __m256i order = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                           7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const vl_dsidx_t vectorCount = count & ~(vl_dsidx_t)7;
+    vlSIMDByteSwapAVX2(data, (vl_ularge_t)vectorCount * 8, order);
+    vlSIMDByteSwapU64Scalar(data + vectorCount, count - vectorCount);
+}
+
+/**
+ * Whether every lane offset `stride * [0, lanes)` fits a signed 32-bit lane.
+ * Negative strides arrive wrapped in the unsigned offset type, so the
+ * magnitude is bounded on the signed value.
+ */
+static inline vl_bool_t vlSIMDGatherStrideFitsAVX2(vl_dsoffs_t srcStride, vl_ilarge_t lanes)
+{
+    const vl_ilarge_t stride = (vl_ilarge_t)srcStride;
+    return stride <= 0x7FFFFFFF / lanes && stride >= -0x7FFFFFFF / lanes;
+}
+
+static void vlSIMDGather32AVX2(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    const vl_uint8_t* srcPtr = (const vl_uint8_t*)src;
+    vl_uint8_t* dstPtr = (vl_uint8_t*)dst;
+    vl_dsidx_t i = 0;
+    if (vlSIMDGatherStrideFitsAVX2(srcStride, 8))
+    {
+        const __m256i offsets =
+            _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)srcStride));
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_i32gather_epi32((const int*)srcPtr, offsets, 1);
+            _mm256_storeu_si256((__m256i*)(dstPtr + (vl_ularge_t)i * 4), v);
+            srcPtr += srcStride * 8;
+        }
+    }
+    vlSIMDGather32Scalar(srcPtr, srcStride, dstPtr + (vl_ularge_t)i * 4, count - i);
+}
+
+static void vlSIMDGather64AVX2(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    const vl_uint8_t* srcPtr = (const vl_uint8_t*)src;
+    vl_uint8_t* dstPtr = (vl_uint8_t*)dst;
+    vl_dsidx_t i = 0;
+    if (vlSIMDGatherStrideFitsAVX2(srcStride, 8))
+    {
+        const __m128i offsets = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)srcStride));
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i lo = _mm256_i32gather_epi64((const long long*)srcPtr, offsets, 1);
+            const __m256i hi = _mm256_i32gather_epi64((const long long*)(srcPtr + srcStride * 4), offsets, 1);
+            _mm256_storeu_si256((__m256i*)(dstPtr + (vl_ularge_t)i * 8), lo);
+            _mm256_storeu_si256((__m256i*)(dstPtr + (vl_ularge_t)i * 8 + 32), hi);
+            srcPtr += srcStride * 8;
+        }
+    }
+    vlSIMDGather64Scalar(srcPtr, srcStride, dstPtr + (vl_ularge_t)i * 8, count - i);
+}
+
+/* ============================================================================
+ * Random Number Generation
+ *
+ * The eight xoshiro256++ lanes live in two vectors per state word for the
+ * whole call; the two halves are independent chains, which hides latency.
+ * ============================================================================
+ */
+
+/** Steps the four lanes held in `s` and returns their outputs. */
+static inline __m256i vlSIMDXoshiroStepAVX2(__m256i* s)
+{
+    const __m256i sum = _mm256_add_epi64(s[0], s[3]);
+    const __m256i result =
+        _mm256_add_epi64(_mm256_or_si256(_mm256_slli_epi64(sum, 23), _mm256_srli_epi64(sum, 41)), s[0]);
+    const __m256i t = _mm256_slli_epi64(s[1], 17);
+    s[2] = _mm256_xor_si256(s[2], s[0]);
+    s[3] = _mm256_xor_si256(s[3], s[1]);
+    s[1] = _mm256_xor_si256(s[1], s[2]);
+    s[0] = _mm256_xor_si256(s[0], s[3]);
+    s[2] = _mm256_xor_si256(s[2], t);
+    s[3] = _mm256_or_si256(_mm256_slli_epi64(s[3], 45), _mm256_srli_epi64(s[3], 19));
+    return result;
+}
+
+static inline void vlSIMDXoshiroLoadAVX2(const vl_uint64_t* state, __m256i* lo, __m256i* hi)
+{
+    for (int w = 0; w < 4; w++)
+    {
+        lo[w] = _mm256_loadu_si256((const __m256i*)(state + w * VL_SIMD_XOSHIRO_LANES));
+        hi[w] = _mm256_loadu_si256((const __m256i*)(state + w * VL_SIMD_XOSHIRO_LANES + 4));
+    }
+}
+
+static inline void vlSIMDXoshiroStoreAVX2(vl_uint64_t* state, const __m256i* lo, const __m256i* hi)
+{
+    for (int w = 0; w < 4; w++)
+    {
+        _mm256_storeu_si256((__m256i*)(state + w * VL_SIMD_XOSHIRO_LANES), lo[w]);
+        _mm256_storeu_si256((__m256i*)(state + w * VL_SIMD_XOSHIRO_LANES + 4), hi[w]);
+    }
+}
+
+/** Maps the top 23 bits of each 32-bit half to a float in [0, 1). */
+static inline __m256 vlSIMDXoshiroToF32AVX2(__m256i r)
+{
+    const __m256i bits = _mm256_or_si256(_mm256_srli_epi32(r, 9), _mm256_set1_epi32((int)VL_SIMD_XOSHIRO_F32_ONE));
+    return _mm256_sub_ps(_mm256_castsi256_ps(bits), _mm256_set1_ps(1.0f));
+}
+
+/** Maps the top 52 bits of each 64-bit output to a double in [0, 1). */
+static inline __m256d vlSIMDXoshiroToF64AVX2(__m256i r)
+{
+    const __m256i bits =
+        _mm256_or_si256(_mm256_srli_epi64(r, 12), _mm256_set1_epi64x((long long)VL_SIMD_XOSHIRO_F64_ONE));
+    return _mm256_sub_pd(_mm256_castsi256_pd(bits), _mm256_set1_pd(1.0));
+}
+
+static void vlSIMDXoshiroU64AVX2(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    __m256i lo[4], hi[4];
+    vl_uint8_t* out = (vl_uint8_t*)dst;
+    vlSIMDXoshiroLoadAVX2(state, lo, hi);
+    for (vl_dsidx_t b = 0; b < blocks; b++, out += 64)
+    {
+        _mm256_storeu_si256((__m256i*)out, vlSIMDXoshiroStepAVX2(lo));
+        _mm256_storeu_si256((__m256i*)(out + 32), vlSIMDXoshiroStepAVX2(hi));
+    }
+    vlSIMDXoshiroStoreAVX2(state, lo, hi);
+}
+
+static void vlSIMDXoshiroF32AVX2(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    __m256i lo[4], hi[4];
+    vlSIMDXoshiroLoadAVX2(state, lo, hi);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 16)
+    {
+        _mm256_storeu_ps(dst, vlSIMDXoshiroToF32AVX2(vlSIMDXoshiroStepAVX2(lo)));
+        _mm256_storeu_ps(dst + 8, vlSIMDXoshiroToF32AVX2(vlSIMDXoshiroStepAVX2(hi)));
+    }
+    vlSIMDXoshiroStoreAVX2(state, lo, hi);
+}
+
+static void vlSIMDXoshiroF64AVX2(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    __m256i lo[4], hi[4];
+    vlSIMDXoshiroLoadAVX2(state, lo, hi);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 8)
+    {
+        _mm256_storeu_pd(dst, vlSIMDXoshiroToF64AVX2(vlSIMDXoshiroStepAVX2(lo)));
+        _mm256_storeu_pd(dst + 4, vlSIMDXoshiroToF64AVX2(vlSIMDXoshiroStepAVX2(hi)));
+    }
+    vlSIMDXoshiroStoreAVX2(state, lo, hi);
+}
+
 /* ============================================================================
  * Initialization
  * ============================================================================
  */
 
-void vlSIMDInit_AVX2(void)
+void vlSIMDInitAVX2(void)
 {
     vlSIMDFunctions.load_vec4f32 = vlSIMDLoadVec4F32AVX2;
     vlSIMDFunctions.store_vec4f32 = vlSIMDStoreVec4F32AVX2;
@@ -495,6 +1988,79 @@ void vlSIMDInit_AVX2(void)
     vlSIMDFunctions.add_vec8i16 = vlSIMDAddVec8I16AVX2;
     vlSIMDFunctions.load_vec32u8 = vlSIMDLoadVec32U8AVX2;
     vlSIMDFunctions.store_vec32u8 = vlSIMDStoreVec32U8AVX2;
+    vlSIMDFunctions.load_vec16f32 = vlSIMDLoadVec16F32AVX2;
+    vlSIMDFunctions.store_vec16f32 = vlSIMDStoreVec16F32AVX2;
+    vlSIMDFunctions.splat_vec16f32 = vlSIMDSplatVec16F32AVX2;
+    vlSIMDFunctions.add_vec16f32 = vlSIMDAddVec16F32AVX2;
+    vlSIMDFunctions.sub_vec16f32 = vlSIMDSubVec16F32AVX2;
+    vlSIMDFunctions.mul_vec16f32 = vlSIMDMulVec16F32AVX2;
+    vlSIMDFunctions.fma_vec16f32 = vlSIMDFmaVec16F32AVX2;
+    vlSIMDFunctions.hsum_vec16f32 = vlSIMDHsumVec16F32AVX2;
+    vlSIMDFunctions.load_vec16i32 = vlSIMDLoadVec16I32AVX2;
+    vlSIMDFunctions.store_vec16i32 = vlSIMDStoreVec16I32AVX2;
+    vlSIMDFunctions.add_vec16i32 = vlSIMDAddVec16I32AVX2;
+    vlSIMDFunctions.mul_vec16i32 = vlSIMDMulVec16I32AVX2;
+    vlSIMDFunctions.load_vec64u8 = vlSIMDLoadVec64U8AVX2;
+    vlSIMDFunctions.store_vec64u8 = vlSIMDStoreVec64U8AVX2;
+    vlSIMDFunctions.eqmask_vec64u8 = vlSIMDEqMaskVec64U8AVX2;
+    vlSIMDFunctions.sort_i32 = vlSIMDSortI32AVX2;
+    vlSIMDFunctions.sort_u32 = vlSIMDSortU32AVX2;
+    vlSIMDFunctions.sort_f32 = vlSIMDSortF32AVX2;
+    vlSIMDFunctions.rank_i32 = vlSIMDRankI32AVX2;
+    vlSIMDFunctions.rank_u32 = vlSIMDRankU32AVX2;
+    vlSIMDFunctions.rank_f32 = vlSIMDRankF32AVX2;
 
+    vlSIMDFunctions.sum_f32 = vlSIMDSumF32AVX2;
+    vlSIMDFunctions.sum_i32 = vlSIMDSumI32AVX2;
+    vlSIMDFunctions.sum_i16 = vlSIMDSumI16AVX2;
+    vlSIMDFunctions.sum_u8 = vlSIMDSumU8AVX2;
+    vlSIMDFunctions.dot_f32 = vlSIMDDotF32AVX2;
+    vlSIMDFunctions.dot_i32 = vlSIMDDotI32AVX2;
+    vlSIMDFunctions.dot_i16 = vlSIMDDotI16AVX2;
+    vlSIMDFunctions.axpy_f32 = vlSIMDAxpyF32AVX2;
+    vlSIMDFunctions.axpy_i32 = vlSIMDAxpyI32AVX2;
+    vlSIMDFunctions.scale_f32 = vlSIMDScaleF32AVX2;
+    vlSIMDFunctions.scale_i32 = vlSIMDScaleI32AVX2;
+    vlSIMDFunctions.minmax_f32 = vlSIMDMinMaxF32AVX2;
+    vlSIMDFunctions.minmax_i32 = vlSIMDMinMaxI32AVX2;
+    vlSIMDFunctions.minmax_i16 = vlSIMDMinMaxI16AVX2;
+    vlSIMDFunctions.minmax_u8 = vlSIMDMinMaxU8AVX2;
+    vlSIMDFunctions.argmin_f32 = vlSIMDArgMinF32AVX2;
+    vlSIMDFunctions.argmin_i32 = vlSIMDArgMinI32AVX2;
+    vlSIMDFunctions.argmin_i16 = vlSIMDArgMinI16AVX2;
+    vlSIMDFunctions.argmin_u8 = vlSIMDArgMinU8AVX2;
+    vlSIMDFunctions.clamp_f32 = vlSIMDClampF32AVX2;
+    vlSIMDFunctions.clamp_i32 = vlSIMDClampI32AVX2;
+    vlSIMDFunctions.clamp_i16 = vlSIMDClampI16AVX2;
+    vlSIMDFunctions.clamp_u8 = vlSIMDClampU8AVX2;
+    vlSIMDFunctions.prefix_sum_f32 = vlSIMDPrefixSumF32AVX2;
+    vlSIMDFunctions.prefix_sum_i32 = vlSIMDPrefixSumI32AVX2;
+    vlSIMDFunctions.compare_f32 = vlSIMDCompareF32AVX2;
+    vlSIMDFunctions.compare_i32 = vlSIMDCompareI32AVX2;
+    vlSIMDFunctions.compare_i16 = vlSIMDCompareI16AVX2;
+    vlSIMDFunctions.compare_u8 = vlSIMDCompareU8AVX2;
+    vlSIMDFunctions.find_u8 = vlSIMDFindU8AVX2;
+    vlSIMDFunctions.find_last_u8 = vlSIMDFindLastU8AVX2;
+    vlSIMDFunctions.find_any_u8 = vlSIMDFindAnyU8AVX2;
+    vlSIMDFunctions.count_u8 = vlSIMDCountU8AVX2;
+    vlSIMDFunctions.equal_u8 = vlSIMDEqualU8AVX2;
+    vlSIMDFunctions.convert_f32_to_half = vlSIMDConvertF32ToHalfAVX2;
+    vlSIMDFunctions.convert_half_to_f32 = vlSIMDConvertHalfToF32AVX2;
+    vlSIMDFunctions.convert_i32_to_f32 = vlSIMDConvertI32ToF32AVX2;
+    vlSIMDFunctions.convert_f32_to_i32 = vlSIMDConvertF32ToI32AVX2;
+    vlSIMDFunctions.convert_i16_to_f32 = vlSIMDConvertI16ToF32AVX2;
+    vlSIMDFunctions.convert_u8_to_f32 = vlSIMDConvertU8ToF32AVX2;
+    vlSIMDFunctions.convert_f32_to_f64 = vlSIMDConvertF32ToF64AVX2;
+    vlSIMDFunctions.convert_f64_to_f32 = vlSIMDConvertF64ToF32AVX2;
+    vlSIMDFunctions.convert_i16_to_i32 = vlSIMDConvertI16ToI32AVX2;
+    vlSIMDFunctions.convert_i32_to_i16 = vlSIMDConvertI32ToI16AVX2;
+    vlSIMDFunctions.byteswap_u16 = vlSIMDByteSwapU16AVX2;
+    vlSIMDFunctions.byteswap_u32 = vlSIMDByteSwapU32AVX2;
+    vlSIMDFunctions.byteswap_u64 = vlSIMDByteSwapU64AVX2;
+    vlSIMDFunctions.gather_32 = vlSIMDGather32AVX2;
+    vlSIMDFunctions.gather_64 = vlSIMDGather64AVX2;
+    vlSIMDFunctions.xoshiro_u64 = vlSIMDXoshiroU64AVX2;
+    vlSIMDFunctions.xoshiro_f32 = vlSIMDXoshiroF32AVX2;
+    vlSIMDFunctions.xoshiro_f64 = vlSIMDXoshiroF64AVX2;
     vlSIMDFunctions.backend_name = "AVX2";
 }
@@ -0,0 +1,1230 @@
+
+/**
+ * \file vl_simd_avx512.c
+ * \brief AVX-512 SIMD implementation
+ *
+ * Provides 512-bit versions of the wide vector operations and the array
+ * kernels using AVX-512 F, BW, VL and DQ. Everything else is inherited from
+ * the AVX2 backend, which every AVX-512 CPU also supports.
+ *
+ * Array kernels finish with a masked load and store instead of a scalar loop,
+ * so inputs shorter than one vector never leave the vector unit.
+ */
+
+#include <immintrin.h>
+#include <string.h>
+#include <vl/vl_algo.h>
+#include <vl/vl_simd.h>
+#include "vl_simd_kernels.h"
+
+void vlSIMDInitAVX2(void);
+
+/* ============================================================================
+ * Tail Masks
+ * ============================================================================
+ */
+
+/* Each helper takes the number of remaining lanes, which is less than the vector width. */
+
+static inline __mmask16 vlSIMDTailMask16AVX512(vl_dsidx_t remaining)
+{
+    return (__mmask16)((1u << remaining) - 1u);
+}
+
+static inline __mmask32 vlSIMDTailMask32AVX512(vl_dsidx_t remaining)
+{
+    return (__mmask32)((1u << remaining) - 1u);
+}
+
+static inline __mmask64 vlSIMDTailMask64AVX512(vl_dsidx_t remaining)
+{
+    return (__mmask64)((1ull << remaining) - 1ull);
+}
+
+/* ============================================================================
+ * 512-bit Wide Operations
+ * ============================================================================
+ */
+
+static vl_simd_vec16_f32 vlSIMDLoadVec16F32AVX512(const vl_float32_t* ptr)
+{
+    vl_simd_vec16_f32 result;
+    _mm512_storeu_ps(result.components, _mm512_loadu_ps(ptr));
+    return result;
+}
+
+static void vlSIMDStoreVec16F32AVX512(vl_float32_t* ptr, vl_simd_vec16_f32 v)
+{
+    _mm512_storeu_ps(ptr, _mm512_loadu_ps(v.components));
+}
+
+static vl_simd_vec16_f32 vlSIMDSplatVec16F32AVX512(vl_float32_t scalar)
+{
+    vl_simd_vec16_f32 result;
+    _mm512_storeu_ps(result.components, _mm512_set1_ps(scalar));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDAddVec16F32AVX512(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    _mm512_storeu_ps(result.components, _mm512_add_ps(_mm512_loadu_ps(a.components), _mm512_loadu_ps(b.components)));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDSubVec16F32AVX512(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    _mm512_storeu_ps(result.components, _mm512_sub_ps(_mm512_loadu_ps(a.components), _mm512_loadu_ps(b.components)));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDMulVec16F32AVX512(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    _mm512_storeu_ps(result.components, _mm512_mul_ps(_mm512_loadu_ps(a.components), _mm512_loadu_ps(b.components)));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDFmaVec16F32AVX512(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b, vl_simd_vec16_f32 c)
+{
+    vl_simd_vec16_f32 result;
+    const __m512 va = _mm512_loadu_ps(a.components);
+    const __m512 vb = _mm512_loadu_ps(b.components);
+    _mm512_storeu_ps(result.components, _mm512_fmadd_ps(va, vb, _mm512_loadu_ps(c.components)));
+    return result;
+}
+
+static vl_float32_t vlSIMDHsumVec16F32AVX512(vl_simd_vec16_f32 v)
+{
+    return _mm512_reduce_add_ps(_mm512_loadu_ps(v.components));
+}
+
+static vl_simd_vec16_i32 vlSIMDLoadVec16I32AVX512(const vl_int32_t* ptr)
+{
+    vl_simd_vec16_i32 result;
+    _mm512_storeu_si512(result.components, _mm512_loadu_si512(ptr));
+    return result;
+}
+
+static void vlSIMDStoreVec16I32AVX512(vl_int32_t* ptr, vl_simd_vec16_i32 v)
+{
+    _mm512_storeu_si512(ptr, _mm512_loadu_si512(v.components));
+}
+
+static vl_simd_vec16_i32 vlSIMDAddVec16I32AVX512(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    _mm512_storeu_si512(result.components,
+                        _mm512_add_epi32(_mm512_loadu_si512(a.components), _mm512_loadu_si512(b.components)));
+    return result;
+}
+
+static vl_simd_vec16_i32 vlSIMDMulVec16I32AVX512(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    _mm512_storeu_si512(result.components,
+                        _mm512_mullo_epi32(_mm512_loadu_si512(a.components), _mm512_loadu_si512(b.components)));
+    return result;
+}
+
+static vl_simd_vec64_u8 vlSIMDLoadVec64U8AVX512(const vl_uint8_t* ptr)
+{
+    vl_simd_vec64_u8 result;
+    _mm512_storeu_si512(result.components, _mm512_loadu_si512(ptr));
+    return result;
+}
+
+static void vlSIMDStoreVec64U8AVX512(vl_uint8_t* ptr, vl_simd_vec64_u8 v)
+{
+    _mm512_storeu_si512(ptr, _mm512_loadu_si512(v.components));
+}
+
+static vl_uint64_t vlSIMDEqMaskVec64U8AVX512(vl_simd_vec64_u8 v, vl_uint8_t byte)
+{
+    return (vl_uint64_t)_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(v.components), _mm512_set1_epi8((char)byte));
+}
+
+/* ============================================================================
+ * Array Kernels
+ * ============================================================================
+ */
+
+/**
+ * Adds signed 32-bit lanes to eight 64-bit accumulators. `sign` holds the upper
+ * halves; lanes are paired within each 128-bit block, which a sum ignores.
+ */
+static inline __m512i vlSIMDAccumulateI64AVX512(__m512i acc, __m512i v, __m512i sign)
+{
+    acc = _mm512_add_epi64(acc, _mm512_unpacklo_epi32(v, sign));
+    return _mm512_add_epi64(acc, _mm512_unpackhi_epi32(v, sign));
+}
+
+static vl_float32_t vlSIMDSumF32AVX512(const vl_float32_t* data, vl_dsidx_t count)
+{
+    __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(data + i));
+        acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(data + i + 16));
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(data + i));
+    }
+    acc1 = _mm512_add_ps(acc1, _mm512_maskz_loadu_ps(vlSIMDTailMask16AVX512(count - i), data + i));
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+static vl_int64_t vlSIMDSumI32AVX512(const vl_int32_t* data, vl_dsidx_t count)
+{
+    __m512i acc = _mm512_setzero_si512();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512i v = _mm512_loadu_si512(data + i);
+        acc = vlSIMDAccumulateI64AVX512(acc, v, _mm512_srai_epi32(v, 31));
+    }
+    const __m512i tail = _mm512_maskz_loadu_epi32(vlSIMDTailMask16AVX512(count - i), data + i);
+    acc = vlSIMDAccumulateI64AVX512(acc, tail, _mm512_srai_epi32(tail, 31));
+    return (vl_int64_t)_mm512_reduce_add_epi64(acc);
+}
+
+static vl_int64_t vlSIMDSumI16AVX512(const vl_int16_t* data, vl_dsidx_t count)
+{
+    const __m512i ones = _mm512_set1_epi16(1);
+    __m512i acc = _mm512_setzero_si512();
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m512i pairs = _mm512_madd_epi16(_mm512_loadu_si512(data + i), ones);
+        acc = vlSIMDAccumulateI64AVX512(acc, pairs, _mm512_srai_epi32(pairs, 31));
+    }
+    const __m512i pairs =
+        _mm512_madd_epi16(_mm512_maskz_loadu_epi16(vlSIMDTailMask32AVX512(count - i), data + i), ones);
+    acc = vlSIMDAccumulateI64AVX512(acc, pairs, _mm512_srai_epi32(pairs, 31));
+    return (vl_int64_t)_mm512_reduce_add_epi64(acc);
+}
+
+static vl_uint64_t vlSIMDSumU8AVX512(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i acc = _mm512_setzero_si512();
+    vl_dsidx_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        acc = _mm512_add_epi64(acc, _mm512_sad_epu8(_mm512_loadu_si512(data + i), zero));
+    }
+    const __m512i tail = _mm512_maskz_loadu_epi8(vlSIMDTailMask64AVX512(count - i), data + i);
+    acc = _mm512_add_epi64(acc, _mm512_sad_epu8(tail, zero));
+    return (vl_uint64_t)_mm512_reduce_add_epi64(acc);
+}
+
+static vl_float32_t vlSIMDDotF32AVX512(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
+{
+    __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), acc1);
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, a + i), _mm512_maskz_loadu_ps(tail, b + i), acc1);
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+static vl_int64_t vlSIMDDotI32AVX512(const vl_int32_t* a, const vl_int32_t* b, vl_dsidx_t count)
+{
+    __m512i acc = _mm512_setzero_si512();
+    vl_dsidx_t i = 0;
+    for (;; i += 16)
+    {
+        const __mmask16 lanes = i + 16 <= count ? (__mmask16)0xFFFF : vlSIMDTailMask16AVX512(count - i);
+        const __m512i va = _mm512_maskz_loadu_epi32(lanes, a + i);
+        const __m512i vb = _mm512_maskz_loadu_epi32(lanes, b + i);
+        acc = _mm512_add_epi64(acc, _mm512_mul_epi32(va, vb));
+        acc = _mm512_add_epi64(acc, _mm512_mul_epi32(_mm512_srli_epi64(va, 32), _mm512_srli_epi64(vb, 32)));
+        if (lanes != 0xFFFF)
+        {
+            break;
+        }
+    }
+    return (vl_int64_t)_mm512_reduce_add_epi64(acc);
+}
+
+static vl_int64_t vlSIMDDotI16AVX512(const vl_int16_t* a, const vl_int16_t* b, vl_dsidx_t count)
+{
+    const __m512i intMin = _mm512_set1_epi32((vl_int32_t)0x80000000u);
+    __m512i acc = _mm512_setzero_si512();
+    vl_dsidx_t i = 0;
+    for (;; i += 32)
+    {
+        const __mmask32 lanes = i + 32 <= count ? (__mmask32)0xFFFFFFFFu : vlSIMDTailMask32AVX512(count - i);
+        const __m512i pairs =
+            _mm512_madd_epi16(_mm512_maskz_loadu_epi16(lanes, a + i), _mm512_maskz_loadu_epi16(lanes, b + i));
+        /* A pair sum of exactly 2^31 (both products -32768 * -32768) wraps to INT_MIN; widen it as unsigned. */
+        const __m512i sign = _mm512_maskz_srai_epi32(_mm512_cmpneq_epi32_mask(pairs, intMin), pairs, 31);
+        acc = vlSIMDAccumulateI64AVX512(acc, pairs, sign);
+        if (lanes != 0xFFFFFFFFu)
+        {
+            break;
+        }
+    }
+    return (vl_int64_t)_mm512_reduce_add_epi64(acc);
+}
+
+static void vlSIMDAxpyF32AVX512(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const __m512 va = _mm512_set1_ps(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    _mm512_mask_storeu_ps(y + i, tail,
+                          _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(tail, x + i), _mm512_maskz_loadu_ps(tail, y + i)));
+}
+
+static void vlSIMDAxpyI32AVX512(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const __m512i va = _mm512_set1_epi32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512i product = _mm512_mullo_epi32(va, _mm512_loadu_si512(x + i));
+        _mm512_storeu_si512(y + i, _mm512_add_epi32(_mm512_loadu_si512(y + i), product));
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    const __m512i product = _mm512_mullo_epi32(va, _mm512_maskz_loadu_epi32(tail, x + i));
+    _mm512_mask_storeu_epi32(y + i, tail, _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail, y + i), product));
+}
+
+static void vlSIMDScaleF32AVX512(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const __m512 va = _mm512_set1_ps(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm512_storeu_ps(dst + i, _mm512_mul_ps(va, _mm512_loadu_ps(src + i)));
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    _mm512_mask_storeu_ps(dst + i, tail, _mm512_mul_ps(va, _mm512_maskz_loadu_ps(tail, src + i)));
+}
+
+static void vlSIMDScaleI32AVX512(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const __m512i va = _mm512_set1_epi32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm512_storeu_si512(dst + i, _mm512_mullo_epi32(va, _mm512_loadu_si512(src + i)));
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    _mm512_mask_storeu_epi32(dst + i, tail, _mm512_mullo_epi32(va, _mm512_maskz_loadu_epi32(tail, src + i)));
+}
+
+/**
+ * Folds full vectors into lane-wise minimum and maximum registers. The tail is
+ * loaded over a copy of the incoming minimum, which is an element of the input
+ * and so cannot change either result. The lanes are then reduced with the
+ * scalar kernel.
+ */
+static void vlSIMDMinMaxFoldF32AVX512(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* min,
+                                      vl_float32_t* max)
+{
+    const __m512 seed = _mm512_set1_ps(*min);
+    __m512 lo = seed, hi = _mm512_set1_ps(*max);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 v = _mm512_loadu_ps(data + i);
+        lo = _mm512_min_ps(lo, v);
+        hi = _mm512_max_ps(hi, v);
+    }
+    const __m512 v = _mm512_mask_loadu_ps(seed, vlSIMDTailMask16AVX512(count - i), data + i);
+    lo = _mm512_min_ps(lo, v);
+    hi = _mm512_max_ps(hi, v);
+
+    vl_float32_t lanes[16];
+    _mm512_storeu_ps(lanes, lo);
+    vlSIMDMinMaxF32Scalar(lanes, 16, min, max);
+    _mm512_storeu_ps(lanes, hi);
+    vlSIMDMinMaxF32Scalar(lanes, 16, min, max);
+}
+
+static void vlSIMDMinMaxFoldI32AVX512(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* min, vl_int32_t* max)
+{
+    const __m512i seed = _mm512_set1_epi32(*min);
+    __m512i lo = seed, hi = _mm512_set1_epi32(*max);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512i v = _mm512_loadu_si512(data + i);
+        lo = _mm512_min_epi32(lo, v);
+        hi = _mm512_max_epi32(hi, v);
+    }
+    const __m512i v = _mm512_mask_loadu_epi32(seed, vlSIMDTailMask16AVX512(count - i), data + i);
+    *min = _mm512_reduce_min_epi32(_mm512_min_epi32(lo, v));
+    *max = _mm512_reduce_max_epi32(_mm512_max_epi32(hi, v));
+}
+
+static void vlSIMDMinMaxFoldI16AVX512(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* min, vl_int16_t* max)
+{
+    const __m512i seed = _mm512_set1_epi16(*min);
+    __m512i lo = seed, hi = _mm512_set1_epi16(*max);
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m512i v = _mm512_loadu_si512(data + i);
+        lo = _mm512_min_epi16(lo, v);
+        hi = _mm512_max_epi16(hi, v);
+    }
+    const __m512i v = _mm512_mask_loadu_epi16(seed, vlSIMDTailMask32AVX512(count - i), data + i);
+    lo = _mm512_min_epi16(lo, v);
+    hi = _mm512_max_epi16(hi, v);
+
+    vl_int16_t lanes[32];
+    _mm512_storeu_si512(lanes, lo);
+    vlSIMDMinMaxI16Scalar(lanes, 32, min, max);
+    _mm512_storeu_si512(lanes, hi);
+    vlSIMDMinMaxI16Scalar(lanes, 32, min, max);
+}
+
+static void vlSIMDMinMaxFoldU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* min, vl_uint8_t* max)
+{
+    const __m512i seed = _mm512_set1_epi8((char)*min);
+    __m512i lo = seed, hi = _mm512_set1_epi8((char)*max);
+    vl_dsidx_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        const __m512i v = _mm512_loadu_si512(data + i);
+        lo = _mm512_min_epu8(lo, v);
+        hi = _mm512_max_epu8(hi, v);
+    }
+    const __m512i v = _mm512_mask_loadu_epi8(seed, vlSIMDTailMask64AVX512(count - i), data + i);
+    lo = _mm512_min_epu8(lo, v);
+    hi = _mm512_max_epu8(hi, v);
+
+    vl_uint8_t lanes[64];
+    _mm512_storeu_si512(lanes, lo);
+    vlSIMDMinMaxU8Scalar(lanes, 64, min, max);
+    _mm512_storeu_si512(lanes, hi);
+    vlSIMDMinMaxU8Scalar(lanes, 64, min, max);
+}
+
+static vl_bool_t vlSIMDMinMaxF32AVX512(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* outMin,
+                                       vl_float32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_float32_t, vlSIMDMinMaxFoldF32AVX512, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI32AVX512(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* outMin,
+                                       vl_int32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int32_t, vlSIMDMinMaxFoldI32AVX512, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI16AVX512(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* outMin,
+                                       vl_int16_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int16_t, vlSIMDMinMaxFoldI16AVX512, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* outMin,
+                                      vl_uint8_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_uint8_t, vlSIMDMinMaxFoldU8AVX512, data, count, outMin, outMax);
+}
+
+/*
+ * Arg-min runs in two passes: a vector reduction finds the minimum, then a
+ * vector scan returns the first lane equal to it. If the minimum is never
+ * found again (only possible with NaN), index 0 is returned.
+ */
+
+static vl_dsidx_t vlSIMDArgMinF32AVX512(const vl_float32_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_float32_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldF32AVX512(data, count, &min, &max);
+
+    const __m512 target = _mm512_set1_ps(min);
+    for (vl_dsidx_t i = 0; i < count; i += 16)
+    {
+        const __mmask16 lanes = i + 16 <= count ? (__mmask16)0xFFFF : vlSIMDTailMask16AVX512(count - i);
+        const __m512 v = _mm512_maskz_loadu_ps(lanes, data + i);
+        const __mmask16 hit = _mm512_mask_cmp_ps_mask(lanes, v, target, _CMP_EQ_OQ);
+        if (hit)
+        {
+            return i + vlAlgoCTZ32(hit);
+        }
+    }
+    return 0;
+}
+
+static vl_dsidx_t vlSIMDArgMinI32AVX512(const vl_int32_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_int32_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldI32AVX512(data, count, &min, &max);
+
+    const __m512i target = _mm512_set1_epi32(min);
+    for (vl_dsidx_t i = 0; i < count; i += 16)
+    {
+        const __mmask16 lanes = i + 16 <= count ? (__mmask16)0xFFFF : vlSIMDTailMask16AVX512(count - i);
+        const __mmask16 hit = _mm512_mask_cmpeq_epi32_mask(lanes, _mm512_maskz_loadu_epi32(lanes, data + i), target);
+        if (hit)
+        {
+            return i + vlAlgoCTZ32(hit);
+        }
+    }
+    return 0;
+}
+
+static vl_dsidx_t vlSIMDArgMinI16AVX512(const vl_int16_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_int16_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldI16AVX512(data, count, &min, &max);
+
+    const __m512i target = _mm512_set1_epi16(min);
+    for (vl_dsidx_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = i + 32 <= count ? (__mmask32)0xFFFFFFFFu : vlSIMDTailMask32AVX512(count - i);
+        const __mmask32 hit = _mm512_mask_cmpeq_epi16_mask(lanes, _mm512_maskz_loadu_epi16(lanes, data + i), target);
+        if (hit)
+        {
+            return i + vlAlgoCTZ32(hit);
+        }
+    }
+    return 0;
+}
+
+static vl_dsidx_t vlSIMDArgMinU8AVX512(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_uint8_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldU8AVX512(data, count, &min, &max);
+
+    const __m512i target = _mm512_set1_epi8((char)min);
+    for (vl_dsidx_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = i + 64 <= count ? ~(__mmask64)0 : vlSIMDTailMask64AVX512(count - i);
+        const __mmask64 hit = _mm512_mask_cmpeq_epi8_mask(lanes, _mm512_maskz_loadu_epi8(lanes, data + i), target);
+        if (hit)
+        {
+            return i + vlAlgoCTZ64(hit);
+        }
+    }
+    return 0;
+}
+
+static void vlSIMDClampF32AVX512(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t lo,
+                                 vl_float32_t hi)
+{
+    const __m512 vLo = _mm512_set1_ps(lo), vHi = _mm512_set1_ps(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm512_storeu_ps(dst + i, _mm512_min_ps(_mm512_max_ps(_mm512_loadu_ps(src + i), vLo), vHi));
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    const __m512 v = _mm512_maskz_loadu_ps(tail, src + i);
+    _mm512_mask_storeu_ps(dst + i, tail, _mm512_min_ps(_mm512_max_ps(v, vLo), vHi));
+}
+
+static void vlSIMDClampI32AVX512(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t lo,
+                                 vl_int32_t hi)
+{
+    const __m512i vLo = _mm512_set1_epi32(lo), vHi = _mm512_set1_epi32(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm512_storeu_si512(dst + i, _mm512_min_epi32(_mm512_max_epi32(_mm512_loadu_si512(src + i), vLo), vHi));
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    const __m512i v = _mm512_maskz_loadu_epi32(tail, src + i);
+    _mm512_mask_storeu_epi32(dst + i, tail, _mm512_min_epi32(_mm512_max_epi32(v, vLo), vHi));
+}
+
+static void vlSIMDClampI16AVX512(const vl_int16_t* src, vl_int16_t* dst, vl_dsidx_t count, vl_int16_t lo,
+                                 vl_int16_t hi)
+{
+    const __m512i vLo = _mm512_set1_epi16(lo), vHi = _mm512_set1_epi16(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        _mm512_storeu_si512(dst + i, _mm512_min_epi16(_mm512_max_epi16(_mm512_loadu_si512(src + i), vLo), vHi));
+    }
+    const __mmask32 tail = vlSIMDTailMask32AVX512(count - i);
+    const __m512i v = _mm512_maskz_loadu_epi16(tail, src + i);
+    _mm512_mask_storeu_epi16(dst + i, tail, _mm512_min_epi16(_mm512_max_epi16(v, vLo), vHi));
+}
+
+static void vlSIMDClampU8AVX512(const vl_uint8_t* src, vl_uint8_t* dst, vl_dsidx_t count, vl_uint8_t lo,
+                                vl_uint8_t hi)
+{
+    const __m512i vLo = _mm512_set1_epi8((char)lo), vHi = _mm512_set1_epi8((char)hi);
+    vl_dsidx_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        _mm512_storeu_si512(dst + i, _mm512_min_epu8(_mm512_max_epu8(_mm512_loadu_si512(src + i), vLo), vHi));
+    }
+    const __mmask64 tail = vlSIMDTailMask64AVX512(count - i);
+    const __m512i v = _mm512_maskz_loadu_epi8(tail, src + i);
+    _mm512_mask_storeu_epi8(dst + i, tail, _mm512_min_epu8(_mm512_max_epu8(v, vLo), vHi));
+}
+
+/**
+ * Prefix sums scan each vector with four shifted adds (log2 of sixteen lanes)
+ * and add the carry broadcast from the last lane of the previous vector. The
+ * tail is scanned the same way from a zero-filled masked load.
+ */
+static inline __m512i vlSIMDPrefixScanI32AVX512(__m512i v)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 15));
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 14));
+    v = _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 12));
+    return _mm512_add_epi32(v, _mm512_alignr_epi32(v, zero, 8));
+}
+
+static inline __m512 vlSIMDPrefixScanF32AVX512(__m512 v)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    v = _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(v), zero, 15)));
+    v = _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(v), zero, 14)));
+    v = _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(v), zero, 12)));
+    return _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(v), zero, 8)));
+}
+
+static void vlSIMDPrefixSumF32AVX512(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    const __m512i last = _mm512_set1_epi32(15);
+    __m512 carry = _mm512_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 v = _mm512_add_ps(vlSIMDPrefixScanF32AVX512(_mm512_loadu_ps(src + i)), carry);
+        _mm512_storeu_ps(dst + i, v);
+        carry = _mm512_permutexvar_ps(last, v);
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    const __m512 v = vlSIMDPrefixScanF32AVX512(_mm512_maskz_loadu_ps(tail, src + i));
+    _mm512_mask_storeu_ps(dst + i, tail, _mm512_add_ps(v, carry));
+}
+
+static void vlSIMDPrefixSumI32AVX512(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    const __m512i last = _mm512_set1_epi32(15);
+    __m512i carry = _mm512_setzero_si512();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512i v = _mm512_add_epi32(vlSIMDPrefixScanI32AVX512(_mm512_loadu_si512(src + i)), carry);
+        _mm512_storeu_si512(dst + i, v);
+        carry = _mm512_permutexvar_epi32(last, v);
+    }
+    const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+    const __m512i v = vlSIMDPrefixScanI32AVX512(_mm512_maskz_loadu_epi32(tail, src + i));
+    _mm512_mask_storeu_epi32(dst + i, tail, _mm512_add_epi32(v, carry));
+}
+
+/**
+ * Compare kernels produce less, equal and greater as mask registers and keep
+ * the ones selected by the compare code, so a single loop serves every
+ * operator. `lanes` limits the final vector to the remaining elements, and
+ * only the mask bytes those elements touch are written; `width` is the vector's
+ * lane count.
+ */
+static inline vl_uint64_t vlSIMDCompareSelectAVX512(vl_uint32_t code, vl_uint32_t bit)
+{
+    return (code & bit) ? ~0ull : 0ull;
+}
+
+static inline vl_dsidx_t vlSIMDCompareStoreAVX512(vl_uint8_t* mask, vl_uint64_t bits, vl_dsidx_t lanes,
+                                                   vl_dsidx_t width)
+{
+    if (lanes == width)
+    {
+        /* x86 is little-endian, so the low mask bits land in the first byte. */
+        memcpy(mask, &bits, width / 8);
+    }
+    else
+    {
+        for (vl_dsidx_t b = 0; b * 8 < lanes; b++)
+        {
+            mask[b] = (vl_uint8_t)(bits >> (b * 8));
+        }
+    }
+    return vlSIMDPopCountScalar((vl_uint32_t)bits) + vlSIMDPopCountScalar((vl_uint32_t)(bits >> 32));
+}
+
+static vl_dsidx_t vlSIMDCompareF32AVX512(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t value,
+                                         vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __mmask16 wantLt = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_LT);
+    const __mmask16 wantEq = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_EQ);
+    const __mmask16 wantGt = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_GT);
+    const __mmask16 invert = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_INVERT);
+    const __m512 v = _mm512_set1_ps(value);
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t i = 0; i < count; i += 16)
+    {
+        const vl_dsidx_t n = count - i < 16 ? count - i : 16;
+        const __mmask16 lanes = n == 16 ? (__mmask16)0xFFFF : vlSIMDTailMask16AVX512(n);
+        const __m512 a = _mm512_maskz_loadu_ps(lanes, data + i);
+        const __mmask16 hit = (__mmask16)((_mm512_cmp_ps_mask(a, v, _CMP_LT_OQ) & wantLt) |
+                                          (_mm512_cmp_ps_mask(a, v, _CMP_EQ_OQ) & wantEq) |
+                                          (_mm512_cmp_ps_mask(a, v, _CMP_GT_OQ) & wantGt));
+        total += vlSIMDCompareStoreAVX512(mask + i / 8, (vl_uint64_t)((hit ^ invert) & lanes), n, 16);
+    }
+    return total;
+}
+
+static vl_dsidx_t vlSIMDCompareI32AVX512(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t value,
+                                         vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __mmask16 wantLt = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_LT);
+    const __mmask16 wantEq = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_EQ);
+    const __mmask16 wantGt = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_GT);
+    const __mmask16 invert = (__mmask16)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_INVERT);
+    const __m512i v = _mm512_set1_epi32(value);
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t i = 0; i < count; i += 16)
+    {
+        const vl_dsidx_t n = count - i < 16 ? count - i : 16;
+        const __mmask16 lanes = n == 16 ? (__mmask16)0xFFFF : vlSIMDTailMask16AVX512(n);
+        const __m512i a = _mm512_maskz_loadu_epi32(lanes, data + i);
+        const __mmask16 hit = (__mmask16)((_mm512_cmplt_epi32_mask(a, v) & wantLt) |
+                                          (_mm512_cmpeq_epi32_mask(a, v) & wantEq) |
+                                          (_mm512_cmpgt_epi32_mask(a, v) & wantGt));
+        total += vlSIMDCompareStoreAVX512(mask + i / 8, (vl_uint64_t)((hit ^ invert) & lanes), n, 16);
+    }
+    return total;
+}
+
+static vl_dsidx_t vlSIMDCompareI16AVX512(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t value,
+                                         vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __mmask32 wantLt = (__mmask32)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_LT);
+    const __mmask32 wantEq = (__mmask32)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_EQ);
+    const __mmask32 wantGt = (__mmask32)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_GT);
+    const __mmask32 invert = (__mmask32)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_INVERT);
+    const __m512i v = _mm512_set1_epi16(value);
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t i = 0; i < count; i += 32)
+    {
+        const vl_dsidx_t n = count - i < 32 ? count - i : 32;
+        const __mmask32 lanes = n == 32 ? (__mmask32)0xFFFFFFFFu : vlSIMDTailMask32AVX512(n);
+        const __m512i a = _mm512_maskz_loadu_epi16(lanes, data + i);
+        const __mmask32 hit = (_mm512_cmplt_epi16_mask(a, v) & wantLt) | (_mm512_cmpeq_epi16_mask(a, v) & wantEq) |
+            (_mm512_cmpgt_epi16_mask(a, v) & wantGt);
+        total += vlSIMDCompareStoreAVX512(mask + i / 8, (vl_uint64_t)((hit ^ invert) & lanes), n, 32);
+    }
+    return total;
+}
+
+static vl_dsidx_t vlSIMDCompareU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value,
+                                        vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __mmask64 wantLt = (__mmask64)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_LT);
+    const __mmask64 wantEq = (__mmask64)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_EQ);
+    const __mmask64 wantGt = (__mmask64)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_GT);
+    const __mmask64 invert = (__mmask64)vlSIMDCompareSelectAVX512(code, VL_SIMD_CMP_CODE_INVERT);
+    const __m512i v = _mm512_set1_epi8((char)value);
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t i = 0; i < count; i += 64)
+    {
+        const vl_dsidx_t n = count - i < 64 ? count - i : 64;
+        const __mmask64 lanes = n == 64 ? ~(__mmask64)0 : vlSIMDTailMask64AVX512(n);
+        const __m512i a = _mm512_maskz_loadu_epi8(lanes, data + i);
+        const __mmask64 hit = (_mm512_cmplt_epu8_mask(a, v) & wantLt) | (_mm512_cmpeq_epu8_mask(a, v) & wantEq) |
+            (_mm512_cmpgt_epu8_mask(a, v) & wantGt);
+        total += vlSIMDCompareStoreAVX512(mask + i / 8, (vl_uint64_t)((hit ^ invert) & lanes), n, 64);
+    }
+    return total;
+}
+
+/* ============================================================================
+ * Byte Scanning
+ *
+ * Long arrays are skimmed four vectors at a time, testing only whether any
+ * byte in the block matched; the masked single-vector loop then pins down
+ * where, and also covers the partial block at the end.
+ * ============================================================================
+ */
+
+/** Whether any of the 256 bytes at `ptr` equals the splatted value. */
+static inline vl_bool_t vlSIMDEqAny4U8AVX512(const vl_uint8_t* ptr, __m512i value)
+{
+    return (_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr), value) |
+            _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + 64), value) |
+            _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + 128), value) |
+            _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + 192), value)) != 0;
+}
+
+/* Lanes of the 64-byte block at `i`: all of them, or a tail mask for the last partial block. */
+static inline __mmask64 vlSIMDBlockMask64AVX512(vl_dsidx_t i, vl_dsidx_t count)
+{
+    return count - i >= 64 ? ~(__mmask64)0 : vlSIMDTailMask64AVX512(count - i);
+}
+
+static vl_dsidx_t vlSIMDFindU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    const __m512i v = _mm512_set1_epi8((char)value);
+    vl_dsidx_t i = 0;
+    while (i + 256 <= count && !vlSIMDEqAny4U8AVX512(data + i, v))
+    {
+        i += 256;
+    }
+    for (; i < count; i += 64)
+    {
+        const __mmask64 lanes = vlSIMDBlockMask64AVX512(i, count);
+        const __mmask64 hit = _mm512_mask_cmpeq_epi8_mask(lanes, _mm512_maskz_loadu_epi8(lanes, data + i), v);
+        if (hit)
+        {
+            return i + vlAlgoCTZ64(hit);
+        }
+    }
+    return count;
+}
+
+static vl_dsidx_t vlSIMDFindLastU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    const __m512i v = _mm512_set1_epi8((char)value);
+    __mmask64 hit;
+
+    /* The partial block, if any, sits at the end and is searched first. */
+    vl_dsidx_t i = count - count % 64;
+    if (i < count)
+    {
+        const __mmask64 lanes = vlSIMDTailMask64AVX512(count - i);
+        if ((hit = _mm512_mask_cmpeq_epi8_mask(lanes, _mm512_maskz_loadu_epi8(lanes, data + i), v)) != 0)
+        {
+            return i + 63 - vlAlgoCLZ64(hit);
+        }
+    }
+    while (i >= 256 && !vlSIMDEqAny4U8AVX512(data + i - 256, v))
+    {
+        i -= 256;
+    }
+    while (i >= 64)
+    {
+        i -= 64;
+        if ((hit = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i), v)) != 0)
+        {
+            return i + 63 - vlAlgoCLZ64(hit);
+        }
+    }
+    return count;
+}
+
+static vl_dsidx_t vlSIMDFindAnyU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                        vl_dsidx_t setCount)
+{
+    if (setCount == 0 || setCount > VL_SIMD_FIND_ANY_VECTOR_MAX)
+    {
+        return vlSIMDFindAnyU8Scalar(data, count, set, setCount);
+    }
+    __m512i splat[VL_SIMD_FIND_ANY_VECTOR_MAX];
+    for (vl_dsidx_t k = 0; k < setCount; k++)
+    {
+        splat[k] = _mm512_set1_epi8((char)set[k]);
+    }
+    for (vl_dsidx_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = vlSIMDBlockMask64AVX512(i, count);
+        const __m512i a = _mm512_maskz_loadu_epi8(lanes, data + i);
+        __mmask64 hit = 0;
+        for (vl_dsidx_t k = 0; k < setCount; k++)
+        {
+            hit |= _mm512_mask_cmpeq_epi8_mask(lanes, a, splat[k]);
+        }
+        if (hit)
+        {
+            return i + vlAlgoCTZ64(hit);
+        }
+    }
+    return count;
+}
+
+static vl_dsidx_t vlSIMDCountU8AVX512(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    const __m512i v = _mm512_set1_epi8((char)value);
+    const __m512i one = _mm512_set1_epi8(1);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i total = zero;
+    vl_dsidx_t i = 0;
+    while (i < count)
+    {
+        /*
+         * Two per-byte counters take alternate vectors and are widened every
+         * 252 vectors, before either can wrap. The last vector may be partial.
+         */
+        __m512i acc0 = zero, acc1 = zero;
+        vl_dsidx_t k = 0;
+        for (; k + 4 <= 252 && i + 256 <= count; k += 4, i += 256)
+        {
+            const __mmask64 h0 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i), v);
+            const __mmask64 h1 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i + 64), v);
+            const __mmask64 h2 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i + 128), v);
+            const __mmask64 h3 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i + 192), v);
+            acc0 = _mm512_mask_add_epi8(acc0, h0, acc0, one);
+            acc1 = _mm512_mask_add_epi8(acc1, h1, acc1, one);
+            acc0 = _mm512_mask_add_epi8(acc0, h2, acc0, one);
+            acc1 = _mm512_mask_add_epi8(acc1, h3, acc1, one);
+        }
+        for (; k < 252 && i < count; k++, i += 64)
+        {
+            const __mmask64 lanes = vlSIMDBlockMask64AVX512(i, count);
+            const __mmask64 hit = _mm512_mask_cmpeq_epi8_mask(lanes, _mm512_maskz_loadu_epi8(lanes, data + i), v);
+            acc0 = _mm512_mask_add_epi8(acc0, hit, acc0, one);
+        }
+        total = _mm512_add_epi64(total, _mm512_add_epi64(_mm512_sad_epu8(acc0, zero), _mm512_sad_epu8(acc1, zero)));
+    }
+    return (vl_dsidx_t)_mm512_reduce_add_epi64(total);
+}
+
+static vl_bool_t vlSIMDEqualU8AVX512(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 256 <= count; i += 256)
+    {
+        __m512i diff = _mm512_setzero_si512();
+        for (int k = 0; k < 256; k += 64)
+        {
+            const __m512i va = _mm512_loadu_si512(a + i + k), vb = _mm512_loadu_si512(b + i + k);
+            diff = _mm512_or_si512(diff, _mm512_xor_si512(va, vb));
+        }
+        if (_mm512_test_epi8_mask(diff, diff))
+        {
+            return VL_FALSE;
+        }
+    }
+    for (; i < count; i += 64)
+    {
+        const __mmask64 lanes = vlSIMDBlockMask64AVX512(i, count);
+        if (_mm512_mask_cmpneq_epi8_mask(lanes, _mm512_maskz_loadu_epi8(lanes, a + i),
+                                         _mm512_maskz_loadu_epi8(lanes, b + i)))
+        {
+            return VL_FALSE;
+        }
+    }
+    return VL_TRUE;
+}
+
+/* ============================================================================
+ * Half-Precision Conversion
+ *
+ * Sixteen elements per instruction; the partial block at the end is handled
+ * with masked loads and stores.
+ * ============================================================================
+ */
+
+static void vlSIMDConvertF32ToHalfAVX512(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i lo = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        const __m256i hi = _mm512_cvtps_ph(_mm512_loadu_ps(src + i + 16), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256((__m256i*)(dst + i), lo);
+        _mm256_storeu_si256((__m256i*)(dst + i + 16), hi);
+    }
+    for (; i < count; i += 16)
+    {
+        const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+        const __m256i h = _mm512_cvtps_ph(_mm512_maskz_loadu_ps(tail, src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_mask_storeu_epi16(dst + i, tail, h);
+    }
+}
+
+static void vlSIMDConvertHalfToF32AVX512(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m512 lo = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(src + i)));
+        const __m512 hi = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(src + i + 16)));
+        _mm512_storeu_ps(dst + i, lo);
+        _mm512_storeu_ps(dst + i + 16, hi);
+    }
+    for (; i < count; i += 16)
+    {
+        const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+        _mm512_mask_storeu_ps(dst + i, tail, _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(tail, src + i)));
+    }
+}
+
+/* ============================================================================
+ * Byte Swapping and Gathers
+ *
+ * As on AVX2, with 64-byte shuffles and 16-lane gathers; the partial block at
+ * the end uses masked loads, gathers and stores.
+ * ============================================================================
+ */
+
+/** Byte order that reverses each element of 2, 4 or 8 bytes, repeated in every 128-bit lane. */
+static inline __m512i vlSIMDByteSwapOrderAVX512(int bytes)
+{
+    const __m128i order = bytes == 2   ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                          : bytes == 4 ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+                                       : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    return _mm512_broadcast_i32x4(order);
+}
+
+/** Byte-swaps `bytes` bytes of whole elements, finishing with a masked vector. */
+static inline void vlSIMDByteSwapAVX512(void* data, vl_ularge_t bytes, __m512i order)
+{
+    vl_uint8_t* ptr = (vl_uint8_t*)data;
+    vl_ularge_t i = 0;
+    for (; i + 64 <= bytes; i += 64)
+    {
+        _mm512_storeu_si512(ptr + i, _mm512_shuffle_epi8(_mm512_loadu_si512(ptr + i), order));
+    }
+    if (i < bytes)
+    {
+        const __mmask64 tail = vlSIMDTailMask64AVX512((vl_dsidx_t)(bytes - i));
+        _mm512_mask_storeu_epi8(ptr + i, tail, _mm512_shuffle_epi8(_mm512_maskz_loadu_epi8(tail, ptr + i), order));
+    }
+}
+
+static void vlSIMDByteSwapU16AVX512(vl_uint16_t* data, vl_dsidx_t count)
+{
+    vlSIMDByteSwapAVX512(data, (vl_ularge_t)count * 2, vlSIMDByteSwapOrderAVX512(2));
+}
+
+static void vlSIMDByteSwapU32AVX512(vl_uint32_t* data, vl_dsidx_t count)
+{
+    vlSIMDByteSwapAVX512(data, (vl_ularge_t)count * 4, vlSIMDByteSwapOrderAVX512(4));
+}
+
+static void vlSIMDByteSwapU64AVX512(vl_uint64_t* data, vl_dsidx_t count)
+{
+    vlSIMDByteSwapAVX512(data, (vl_ularge_t)count * 8, vlSIMDByteSwapOrderAVX512(8));
+}
+
+/** Whether every lane offset fits a signed 32-bit lane; negative strides arrive wrapped, so test the signed value. */
+static inline vl_bool_t vlSIMDGatherStrideFitsAVX512(vl_dsoffs_t srcStride, vl_ilarge_t lanes)
+{
+    const vl_ilarge_t stride = (vl_ilarge_t)srcStride;
+    return stride <= 0x7FFFFFFF / lanes && stride >= -0x7FFFFFFF / lanes;
+}
+
+static void vlSIMDGather32AVX512(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    if (!vlSIMDGatherStrideFitsAVX512(srcStride, 16))
+    {
+        vlSIMDGather32Scalar(src, srcStride, dst, count);
+        return;
+    }
+    const vl_uint8_t* srcPtr = (const vl_uint8_t*)src;
+    vl_int32_t* dstPtr = (vl_int32_t*)dst;
+    const __m512i offsets = _mm512_mullo_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((int)srcStride));
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm512_storeu_si512(dstPtr + i, _mm512_i32gather_epi32(offsets, srcPtr, 1));
+        srcPtr += srcStride * 16;
+    }
+    if (i < count)
+    {
+        const __mmask16 tail = vlSIMDTailMask16AVX512(count - i);
+        const __m512i v = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, offsets, srcPtr, 1);
+        _mm512_mask_storeu_epi32(dstPtr + i, tail, v);
+    }
+}
+
+static void vlSIMDGather64AVX512(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    if (!vlSIMDGatherStrideFitsAVX512(srcStride, 8))
+    {
+        vlSIMDGather64Scalar(src, srcStride, dst, count);
+        return;
+    }
+    const vl_uint8_t* srcPtr = (const vl_uint8_t*)src;
+    vl_int64_t* dstPtr = (vl_int64_t*)dst;
+    const __m256i offsets =
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)srcStride));
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm512_storeu_si512(dstPtr + i, _mm512_i32gather_epi64(offsets, srcPtr, 1));
+        srcPtr += srcStride * 8;
+    }
+    if (i < count)
+    {
+        const __mmask8 tail = (__mmask8)((1u << (count - i)) - 1);
+        const __m512i v = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), tail, offsets, srcPtr, 1);
+        _mm512_mask_storeu_epi64(dstPtr + i, tail, v);
+    }
+}
+
+/* ============================================================================
+ * Random Number Generation
+ *
+ * One vector per state word holds all eight xoshiro256++ lanes, and vprolq
+ * does each rotate in one instruction.
+ * ============================================================================
+ */
+
+/** Steps the eight lanes held in `s` and returns their outputs. */
+static inline __m512i vlSIMDXoshiroStepAVX512(__m512i* s)
+{
+    const __m512i result = _mm512_add_epi64(_mm512_rol_epi64(_mm512_add_epi64(s[0], s[3]), 23), s[0]);
+    const __m512i t = _mm512_slli_epi64(s[1], 17);
+    s[2] = _mm512_xor_si512(s[2], s[0]);
+    s[3] = _mm512_xor_si512(s[3], s[1]);
+    s[1] = _mm512_xor_si512(s[1], s[2]);
+    s[0] = _mm512_xor_si512(s[0], s[3]);
+    s[2] = _mm512_xor_si512(s[2], t);
+    s[3] = _mm512_rol_epi64(s[3], 45);
+    return result;
+}
+
+static inline void vlSIMDXoshiroLoadAVX512(const vl_uint64_t* state, __m512i* s)
+{
+    for (int w = 0; w < 4; w++)
+        s[w] = _mm512_loadu_si512((const void*)(state + w * VL_SIMD_XOSHIRO_LANES));
+}
+
+static inline void vlSIMDXoshiroStoreAVX512(vl_uint64_t* state, const __m512i* s)
+{
+    for (int w = 0; w < 4; w++)
+        _mm512_storeu_si512((void*)(state + w * VL_SIMD_XOSHIRO_LANES), s[w]);
+}
+
+static void vlSIMDXoshiroU64AVX512(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    __m512i s[4];
+    vl_uint8_t* out = (vl_uint8_t*)dst;
+    vlSIMDXoshiroLoadAVX512(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, out += 64)
+    {
+        _mm512_storeu_si512((void*)out, vlSIMDXoshiroStepAVX512(s));
+    }
+    vlSIMDXoshiroStoreAVX512(state, s);
+}
+
+static void vlSIMDXoshiroF32AVX512(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    const __m512i one = _mm512_set1_epi32((int)VL_SIMD_XOSHIRO_F32_ONE);
+    __m512i s[4];
+    vlSIMDXoshiroLoadAVX512(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 16)
+    {
+        const __m512i bits = _mm512_or_si512(_mm512_srli_epi32(vlSIMDXoshiroStepAVX512(s), 9), one);
+        _mm512_storeu_ps(dst, _mm512_sub_ps(_mm512_castsi512_ps(bits), _mm512_set1_ps(1.0f)));
+    }
+    vlSIMDXoshiroStoreAVX512(state, s);
+}
+
+static void vlSIMDXoshiroF64AVX512(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    const __m512i one = _mm512_set1_epi64((long long)VL_SIMD_XOSHIRO_F64_ONE);
+    __m512i s[4];
+    vlSIMDXoshiroLoadAVX512(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 8)
+    {
+        const __m512i bits = _mm512_or_si512(_mm512_srli_epi64(vlSIMDXoshiroStepAVX512(s), 12), one);
+        _mm512_storeu_pd(dst, _mm512_sub_pd(_mm512_castsi512_pd(bits), _mm512_set1_pd(1.0)));
+    }
+    vlSIMDXoshiroStoreAVX512(state, s);
+}
+
+/* ============================================================================
+ * Initialization
+ * ============================================================================
+ */
+
+void vlSIMDInitAVX512(void)
+{
+    /* Start from AVX2 for sorting, ranking and the 128/256-bit operations. */
+    vlSIMDInitAVX2();
+
+    vlSIMDFunctions.load_vec16f32 = vlSIMDLoadVec16F32AVX512;
+    vlSIMDFunctions.store_vec16f32 = vlSIMDStoreVec16F32AVX512;
+    vlSIMDFunctions.splat_vec16f32 = vlSIMDSplatVec16F32AVX512;
+    vlSIMDFunctions.add_vec16f32 = vlSIMDAddVec16F32AVX512;
+    vlSIMDFunctions.sub_vec16f32 = vlSIMDSubVec16F32AVX512;
+    vlSIMDFunctions.mul_vec16f32 = vlSIMDMulVec16F32AVX512;
+    vlSIMDFunctions.fma_vec16f32 = vlSIMDFmaVec16F32AVX512;
+    vlSIMDFunctions.hsum_vec16f32 = vlSIMDHsumVec16F32AVX512;
+    vlSIMDFunctions.load_vec16i32 = vlSIMDLoadVec16I32AVX512;
+    vlSIMDFunctions.store_vec16i32 = vlSIMDStoreVec16I32AVX512;
+    vlSIMDFunctions.add_vec16i32 = vlSIMDAddVec16I32AVX512;
+    vlSIMDFunctions.mul_vec16i32 = vlSIMDMulVec16I32AVX512;
+    vlSIMDFunctions.load_vec64u8 = vlSIMDLoadVec64U8AVX512;
+    vlSIMDFunctions.store_vec64u8 = vlSIMDStoreVec64U8AVX512;
+    vlSIMDFunctions.eqmask_vec64u8 = vlSIMDEqMaskVec64U8AVX512;
+    vlSIMDFunctions.sum_f32 = vlSIMDSumF32AVX512;
+    vlSIMDFunctions.sum_i32 = vlSIMDSumI32AVX512;
+    vlSIMDFunctions.sum_i16 = vlSIMDSumI16AVX512;
+    vlSIMDFunctions.sum_u8 = vlSIMDSumU8AVX512;
+    vlSIMDFunctions.dot_f32 = vlSIMDDotF32AVX512;
+    vlSIMDFunctions.dot_i32 = vlSIMDDotI32AVX512;
+    vlSIMDFunctions.dot_i16 = vlSIMDDotI16AVX512;
+    vlSIMDFunctions.axpy_f32 = vlSIMDAxpyF32AVX512;
+    vlSIMDFunctions.axpy_i32 = vlSIMDAxpyI32AVX512;
+    vlSIMDFunctions.scale_f32 = vlSIMDScaleF32AVX512;
+    vlSIMDFunctions.scale_i32 = vlSIMDScaleI32AVX512;
+    vlSIMDFunctions.minmax_f32 = vlSIMDMinMaxF32AVX512;
+    vlSIMDFunctions.minmax_i32 = vlSIMDMinMaxI32AVX512;
+    vlSIMDFunctions.minmax_i16 = vlSIMDMinMaxI16AVX512;
+    vlSIMDFunctions.minmax_u8 = vlSIMDMinMaxU8AVX512;
+    vlSIMDFunctions.argmin_f32 = vlSIMDArgMinF32AVX512;
+    vlSIMDFunctions.argmin_i32 = vlSIMDArgMinI32AVX512;
+    vlSIMDFunctions.argmin_i16 = vlSIMDArgMinI16AVX512;
+    vlSIMDFunctions.argmin_u8 = vlSIMDArgMinU8AVX512;
+    vlSIMDFunctions.clamp_f32 = vlSIMDClampF32AVX512;
+    vlSIMDFunctions.clamp_i32 = vlSIMDClampI32AVX512;
+    vlSIMDFunctions.clamp_i16 = vlSIMDClampI16AVX512;
+    vlSIMDFunctions.clamp_u8 = vlSIMDClampU8AVX512;
+    vlSIMDFunctions.prefix_sum_f32 = vlSIMDPrefixSumF32AVX512;
+    vlSIMDFunctions.prefix_sum_i32 = vlSIMDPrefixSumI32AVX512;
+    vlSIMDFunctions.compare_f32 = vlSIMDCompareF32AVX512;
+    vlSIMDFunctions.compare_i32 = vlSIMDCompareI32AVX512;
+    vlSIMDFunctions.compare_i16 = vlSIMDCompareI16AVX512;
+    vlSIMDFunctions.compare_u8 = vlSIMDCompareU8AVX512;
+    vlSIMDFunctions.find_u8 = vlSIMDFindU8AVX512;
+    vlSIMDFunctions.find_last_u8 = vlSIMDFindLastU8AVX512;
+    vlSIMDFunctions.find_any_u8 = vlSIMDFindAnyU8AVX512;
+    vlSIMDFunctions.count_u8 = vlSIMDCountU8AVX512;
+    vlSIMDFunctions.equal_u8 = vlSIMDEqualU8AVX512;
+    vlSIMDFunctions.convert_f32_to_half = vlSIMDConvertF32ToHalfAVX512;
+    vlSIMDFunctions.convert_half_to_f32 = vlSIMDConvertHalfToF32AVX512;
+    vlSIMDFunctions.byteswap_u16 = vlSIMDByteSwapU16AVX512;
+    vlSIMDFunctions.byteswap_u32 = vlSIMDByteSwapU32AVX512;
+    vlSIMDFunctions.byteswap_u64 = vlSIMDByteSwapU64AVX512;
+    vlSIMDFunctions.gather_32 = vlSIMDGather32AVX512;
+    vlSIMDFunctions.gather_64 = vlSIMDGather64AVX512;
+    vlSIMDFunctions.xoshiro_u64 = vlSIMDXoshiroU64AVX512;
+    vlSIMDFunctions.xoshiro_f32 = vlSIMDXoshiroF32AVX512;
+    vlSIMDFunctions.xoshiro_f64 = vlSIMDXoshiroF64AVX512;
+    vlSIMDFunctions.backend_name = "AVX-512";
+}
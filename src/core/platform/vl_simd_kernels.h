@@ -0,0 +1,539 @@
+/**
+ * \file vl_simd_kernels.h
+ * \brief Scalar array kernels shared by every SIMD backend.
+ *
+ * The portable backend wraps these directly. Vector backends call them for
+ * whatever is left after their last full vector, and to reduce a register's
+ * lanes once it has been spilled to memory.
+ *
+ * \private
+ */
+
+#ifndef VL_SIMD_KERNELS_H
+#define VL_SIMD_KERNELS_H
+
+#include <string.h>
+#include <vl/vl_simd.h>
+
+/**
+ * Bits of a compare code: which of less, equal and greater satisfy the
+ * operator, and whether the combined result is inverted afterwards. Inversion
+ * is only used for NE, so that unordered floats compare unequal.
+ */
+#define VL_SIMD_CMP_CODE_LT 0x1u
+#define VL_SIMD_CMP_CODE_EQ 0x2u
+#define VL_SIMD_CMP_CODE_GT 0x4u
+#define VL_SIMD_CMP_CODE_INVERT 0x8u
+
+static inline vl_uint32_t vlSIMDCompareCodeScalar(vl_simd_cmp_op op)
+{
+    switch (op)
+    {
+    case VL_SIMD_CMP_LT:
+        return VL_SIMD_CMP_CODE_LT;
+    case VL_SIMD_CMP_LE:
+        return VL_SIMD_CMP_CODE_LT | VL_SIMD_CMP_CODE_EQ;
+    case VL_SIMD_CMP_EQ:
+        return VL_SIMD_CMP_CODE_EQ;
+    case VL_SIMD_CMP_NE:
+        return VL_SIMD_CMP_CODE_EQ | VL_SIMD_CMP_CODE_INVERT;
+    case VL_SIMD_CMP_GE:
+        return VL_SIMD_CMP_CODE_GT | VL_SIMD_CMP_CODE_EQ;
+    default:
+        return VL_SIMD_CMP_CODE_GT;
+    }
+}
+
+static inline vl_dsidx_t vlSIMDPopCountScalar(vl_uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    x = (x + (x >> 4)) & 0x0F0F0F0Fu;
+    return (vl_dsidx_t)((x * 0x01010101u) >> 24);
+}
+
+/* --- Reductions --- */
+
+static inline vl_float32_t vlSIMDSumF32Scalar(const vl_float32_t* data, vl_dsidx_t count)
+{
+    vl_float32_t sum = 0.0f;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
+/**
+ * Integer sums and dot products accumulate in unsigned 64-bit arithmetic, so
+ * the rare overflow wraps identically in every backend.
+ */
+#define VL_SIMD_SUM_SCALAR_DEFINE(SUFFIX, T, R)                                                                        \
+    static inline R vlSIMDSum##SUFFIX##Scalar(const T* data, vl_dsidx_t count)                                         \
+    {                                                                                                                  \
+        vl_uint64_t sum = 0;                                                                                           \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            sum += (vl_uint64_t)(vl_int64_t)data[i];                                                                   \
+        }                                                                                                              \
+        return (R)sum;                                                                                                 \
+    }
+
+VL_SIMD_SUM_SCALAR_DEFINE(I32, vl_int32_t, vl_int64_t)
+VL_SIMD_SUM_SCALAR_DEFINE(I16, vl_int16_t, vl_int64_t)
+VL_SIMD_SUM_SCALAR_DEFINE(U8, vl_uint8_t, vl_uint64_t)
+
+static inline vl_float32_t vlSIMDDotF32Scalar(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
+{
+    vl_float32_t sum = 0.0f;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+#define VL_SIMD_DOT_SCALAR_DEFINE(SUFFIX, T)                                                                           \
+    static inline vl_int64_t vlSIMDDot##SUFFIX##Scalar(const T* a, const T* b, vl_dsidx_t count)                       \
+    {                                                                                                                  \
+        vl_uint64_t sum = 0;                                                                                           \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            sum += (vl_uint64_t)((vl_int64_t)a[i] * (vl_int64_t)b[i]);                                                 \
+        }                                                                                                              \
+        return (vl_int64_t)sum;                                                                                        \
+    }
+
+VL_SIMD_DOT_SCALAR_DEFINE(I32, vl_int32_t)
+VL_SIMD_DOT_SCALAR_DEFINE(I16, vl_int16_t)
+
+/* --- Element-wise Arithmetic --- */
+
+static inline void vlSIMDAxpyF32Scalar(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+static inline void vlSIMDAxpyI32Scalar(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        y[i] = (vl_int32_t)((vl_uint32_t)y[i] + (vl_uint32_t)alpha * (vl_uint32_t)x[i]);
+    }
+}
+
+static inline void vlSIMDScaleF32Scalar(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count,
+                                        vl_float32_t alpha)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        dst[i] = alpha * src[i];
+    }
+}
+
+static inline void vlSIMDScaleI32Scalar(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        dst[i] = (vl_int32_t)((vl_uint32_t)alpha * (vl_uint32_t)src[i]);
+    }
+}
+
+/* --- Min, Max and Clamp --- */
+
+/**
+ * For each element type, defines:
+ * - MinMax: folds `count` elements into an already-seeded minimum and maximum.
+ * - Find: index of the first element equal to `value`, or `count` if none is.
+ * - ArgMin: index of the first minimum, or VL_STRUCTURE_INDEX_MAX when empty.
+ * - Clamp: `min(max(x, lo), hi)` per element.
+ */
+#define VL_SIMD_RANGE_SCALAR_DEFINE(SUFFIX, T)                                                                         \
+    static inline void vlSIMDMinMax##SUFFIX##Scalar(const T* data, vl_dsidx_t count, T* min, T* max)                   \
+    {                                                                                                                  \
+        T lo = *min, hi = *max;                                                                                        \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            lo = data[i] < lo ? data[i] : lo;                                                                          \
+            hi = data[i] > hi ? data[i] : hi;                                                                          \
+        }                                                                                                              \
+        *min = lo;                                                                                                     \
+        *max = hi;                                                                                                     \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline vl_dsidx_t vlSIMDFind##SUFFIX##Scalar(const T* data, vl_dsidx_t count, T value)                      \
+    {                                                                                                                  \
+        vl_dsidx_t i = 0;                                                                                              \
+        while (i < count && !(data[i] == value))                                                                       \
+        {                                                                                                              \
+            i++;                                                                                                       \
+        }                                                                                                              \
+        return i;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline vl_dsidx_t vlSIMDArgMin##SUFFIX##Scalar(const T* data, vl_dsidx_t count)                             \
+    {                                                                                                                  \
+        if (count == 0)                                                                                                \
+        {                                                                                                              \
+            return VL_STRUCTURE_INDEX_MAX;                                                                             \
+        }                                                                                                              \
+        vl_dsidx_t best = 0;                                                                                           \
+        for (vl_dsidx_t i = 1; i < count; i++)                                                                         \
+        {                                                                                                              \
+            best = data[i] < data[best] ? i : best;                                                                    \
+        }                                                                                                              \
+        return best;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void vlSIMDClamp##SUFFIX##Scalar(const T* src, T* dst, vl_dsidx_t count, T lo, T hi)                 \
+    {                                                                                                                  \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            const T x = src[i] > lo ? src[i] : lo;                                                                     \
+            dst[i] = x < hi ? x : hi;                                                                                  \
+        }                                                                                                              \
+    }
+
+VL_SIMD_RANGE_SCALAR_DEFINE(F32, vl_float32_t)
+VL_SIMD_RANGE_SCALAR_DEFINE(I32, vl_int32_t)
+VL_SIMD_RANGE_SCALAR_DEFINE(I16, vl_int16_t)
+VL_SIMD_RANGE_SCALAR_DEFINE(U8, vl_uint8_t)
+
+/**
+ * Shared body of the public min/max kernels: seeds from the first element,
+ * lets the backend fold the rest, then writes whichever outputs were asked for.
+ */
+#define VL_SIMD_MINMAX_WRAP(T, FOLD, data, count, outMin, outMax)                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if ((count) == 0)                                                                                              \
+        {                                                                                                              \
+            return VL_FALSE;                                                                                           \
+        }                                                                                                              \
+        T vlMin_ = (data)[0], vlMax_ = (data)[0];                                                                      \
+        FOLD((data) + 1, (count) - 1, &vlMin_, &vlMax_);                                                               \
+        if (outMin)                                                                                                    \
+        {                                                                                                              \
+            *(outMin) = vlMin_;                                                                                        \
+        }                                                                                                              \
+        if (outMax)                                                                                                    \
+        {                                                                                                              \
+            *(outMax) = vlMax_;                                                                                        \
+        }                                                                                                              \
+        return VL_TRUE;                                                                                                \
+    } while (0)
+
+/* --- Prefix Sums --- */
+
+/**
+ * Inclusive scans continue from `carry`, the running total before `src[0]`,
+ * and return the running total after the last element.
+ */
+static inline vl_float32_t vlSIMDPrefixSumF32Scalar(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count,
+                                                    vl_float32_t carry)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        carry += src[i];
+        dst[i] = carry;
+    }
+    return carry;
+}
+
+static inline vl_int32_t vlSIMDPrefixSumI32Scalar(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count,
+                                                  vl_int32_t carry)
+{
+    vl_uint32_t total = (vl_uint32_t)carry;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        total += (vl_uint32_t)src[i];
+        dst[i] = (vl_int32_t)total;
+    }
+    return (vl_int32_t)total;
+}
+
+/* --- Byte Scanning --- */
+
+/**
+ * Largest set the vector find-any kernels match with one compare per member;
+ * bigger sets are scanned with the scalar membership bitmap instead.
+ */
+#define VL_SIMD_FIND_ANY_VECTOR_MAX 16
+
+static inline vl_dsidx_t vlSIMDFindLastU8Scalar(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    for (vl_dsidx_t i = count; i > 0; i--)
+    {
+        if (data[i - 1] == value)
+        {
+            return i - 1;
+        }
+    }
+    return count;
+}
+
+/** Index of the first byte that is a member of `set`, or `count` if none is. */
+static inline vl_dsidx_t vlSIMDFindAnyU8Scalar(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                               vl_dsidx_t setCount)
+{
+    vl_uint32_t bits[8] = {0};
+    for (vl_dsidx_t k = 0; k < setCount; k++)
+    {
+        bits[set[k] >> 5] |= 1u << (set[k] & 31u);
+    }
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        if (bits[data[i] >> 5] & (1u << (data[i] & 31u)))
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+static inline vl_dsidx_t vlSIMDCountU8Scalar(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+/**
+ * Compares eight bytes at a time; an array of at least eight bytes finishes
+ * with a word that overlaps the previous one rather than a byte loop.
+ */
+static inline vl_bool_t vlSIMDEqualU8Scalar(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    if (count < 8)
+    {
+        for (vl_dsidx_t i = 0; i < count; i++)
+        {
+            if (a[i] != b[i])
+            {
+                return VL_FALSE;
+            }
+        }
+        return VL_TRUE;
+    }
+
+    vl_uint64_t wa, wb;
+    for (vl_dsidx_t i = 0; i + 8 <= count; i += 8)
+    {
+        memcpy(&wa, a + i, 8);
+        memcpy(&wb, b + i, 8);
+        if (wa != wb)
+        {
+            return VL_FALSE;
+        }
+    }
+    memcpy(&wa, a + count - 8, 8);
+    memcpy(&wb, b + count - 8, 8);
+    return wa == wb;
+}
+
+/* --- Half-Precision Conversion --- */
+
+static inline void vlSIMDConvertF32ToHalfScalar(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        dst[i] = vlHalfFromFloat(src[i]);
+    }
+}
+
+static inline void vlSIMDConvertHalfToF32Scalar(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        dst[i] = vlHalfToFloat(src[i]);
+    }
+}
+
+/* --- Numeric Type Conversion --- */
+
+/**
+ * Element-wise C casts. The vector backends use these for their tails and must
+ * match them exactly for every input the cast defines.
+ */
+#define VL_SIMD_CONVERT_SCALAR_DEFINE(SUFFIX, S, D)                                                                    \
+    static inline void vlSIMDConvert##SUFFIX##Scalar(const S* src, D* dst, vl_dsidx_t count)                           \
+    {                                                                                                                  \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            dst[i] = (D)src[i];                                                                                        \
+        }                                                                                                              \
+    }
+
+VL_SIMD_CONVERT_SCALAR_DEFINE(I32ToF32, vl_int32_t, vl_float32_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(F32ToI32, vl_float32_t, vl_int32_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(I16ToF32, vl_int16_t, vl_float32_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(U8ToF32, vl_uint8_t, vl_float32_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(F32ToF64, vl_float32_t, vl_float64_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(F64ToF32, vl_float64_t, vl_float32_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(I16ToI32, vl_int16_t, vl_int32_t)
+VL_SIMD_CONVERT_SCALAR_DEFINE(I32ToI16, vl_int32_t, vl_int16_t)
+
+/* --- Byte Swapping and Strided Gathers --- */
+
+static inline vl_uint16_t vlSIMDBSwap16(vl_uint16_t v) { return (vl_uint16_t)((v << 8) | (v >> 8)); }
+
+static inline vl_uint32_t vlSIMDBSwap32(vl_uint32_t v)
+{
+    v = ((v << 8) & 0xFF00FF00u) | ((v >> 8) & 0x00FF00FFu);
+    return (v << 16) | (v >> 16);
+}
+
+static inline vl_uint64_t vlSIMDBSwap64(vl_uint64_t v)
+{
+    return ((vl_uint64_t)vlSIMDBSwap32((vl_uint32_t)v) << 32) | vlSIMDBSwap32((vl_uint32_t)(v >> 32));
+}
+
+#define VL_SIMD_BYTESWAP_SCALAR_DEFINE(BITS)                                                                           \
+    static inline void vlSIMDByteSwapU##BITS##Scalar(vl_uint##BITS##_t* data, vl_dsidx_t count)                        \
+    {                                                                                                                  \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            data[i] = vlSIMDBSwap##BITS(data[i]);                                                                      \
+        }                                                                                                              \
+    }
+
+VL_SIMD_BYTESWAP_SCALAR_DEFINE(16)
+VL_SIMD_BYTESWAP_SCALAR_DEFINE(32)
+VL_SIMD_BYTESWAP_SCALAR_DEFINE(64)
+
+/**
+ * Gathers copy fixed-size elements from a strided source into a packed
+ * destination. Neither side needs to be aligned; the constant memcpy size
+ * compiles to a single load and store.
+ */
+#define VL_SIMD_GATHER_SCALAR_DEFINE(BITS)                                                                             \
+    static inline void vlSIMDGather##BITS##Scalar(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count) \
+    {                                                                                                                  \
+        const vl_uint8_t* srcPtr = (const vl_uint8_t*)src;                                                             \
+        vl_uint8_t* dstPtr = (vl_uint8_t*)dst;                                                                         \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            memcpy(dstPtr, srcPtr, BITS / 8);                                                                          \
+            srcPtr += srcStride;                                                                                       \
+            dstPtr += BITS / 8;                                                                                        \
+        }                                                                                                              \
+    }
+
+VL_SIMD_GATHER_SCALAR_DEFINE(32)
+VL_SIMD_GATHER_SCALAR_DEFINE(64)
+
+/* --- Xoshiro256++ Generators --- */
+
+#define VL_SIMD_XOSHIRO_F32_ONE 0x3F800000u
+#define VL_SIMD_XOSHIRO_F64_ONE 0x3FF0000000000000ull
+
+static inline vl_uint64_t vlSIMDRotl64Scalar(vl_uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+/**
+ * Steps every lane once and writes the eight outputs, lane 0 first.
+ */
+static inline void vlSIMDXoshiroBlockScalar(vl_uint64_t* state, vl_uint64_t* out)
+{
+    for (int lane = 0; lane < VL_SIMD_XOSHIRO_LANES; lane++)
+    {
+        vl_uint64_t* s = state + lane;
+        const vl_uint64_t s0 = s[0], s1 = s[VL_SIMD_XOSHIRO_LANES];
+        vl_uint64_t s2 = s[2 * VL_SIMD_XOSHIRO_LANES], s3 = s[3 * VL_SIMD_XOSHIRO_LANES];
+
+        out[lane] = vlSIMDRotl64Scalar(s0 + s3, 23) + s0;
+        s2 ^= s0;
+        s3 ^= s1;
+        s[VL_SIMD_XOSHIRO_LANES] = s1 ^ s2;
+        s[0] = s0 ^ s3;
+        s[2 * VL_SIMD_XOSHIRO_LANES] = s2 ^ (s1 << 17);
+        s[3 * VL_SIMD_XOSHIRO_LANES] = vlSIMDRotl64Scalar(s3, 45);
+    }
+}
+
+static inline void vlSIMDXoshiroU64Scalar(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    vl_uint8_t* out = (vl_uint8_t*)dst;
+    for (vl_dsidx_t b = 0; b < blocks; b++)
+    {
+        vl_uint64_t block[VL_SIMD_XOSHIRO_LANES];
+        vlSIMDXoshiroBlockScalar(state, block);
+        memcpy(out, block, sizeof(block));
+        out += sizeof(block);
+    }
+}
+
+static inline void vlSIMDXoshiroF32Scalar(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    for (vl_dsidx_t b = 0; b < blocks; b++)
+    {
+        vl_uint64_t block[VL_SIMD_XOSHIRO_LANES];
+        vlSIMDXoshiroBlockScalar(state, block);
+        for (int lane = 0; lane < VL_SIMD_XOSHIRO_LANES; lane++)
+        {
+            const vl_uint32_t bits[2] = {((vl_uint32_t)block[lane] >> 9) | VL_SIMD_XOSHIRO_F32_ONE,
+                                         ((vl_uint32_t)(block[lane] >> 32) >> 9) | VL_SIMD_XOSHIRO_F32_ONE};
+            vl_float32_t values[2];
+            memcpy(values, bits, sizeof(values));
+            *dst++ = values[0] - 1.0f;
+            *dst++ = values[1] - 1.0f;
+        }
+    }
+}
+
+static inline void vlSIMDXoshiroF64Scalar(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    for (vl_dsidx_t b = 0; b < blocks; b++)
+    {
+        vl_uint64_t block[VL_SIMD_XOSHIRO_LANES];
+        vlSIMDXoshiroBlockScalar(state, block);
+        for (int lane = 0; lane < VL_SIMD_XOSHIRO_LANES; lane++)
+        {
+            const vl_uint64_t bits = (block[lane] >> 12) | VL_SIMD_XOSHIRO_F64_ONE;
+            vl_float64_t value;
+            memcpy(&value, &bits, sizeof(value));
+            *dst++ = value - 1.0;
+        }
+    }
+}
+
+/* --- Compare to Mask --- */
+
+/**
+ * Writes the mask bytes for `count` elements, starting on a byte boundary.
+ * `code` comes from vlSIMDCompareCodeScalar.
+ */
+#define VL_SIMD_COMPARE_SCALAR_DEFINE(SUFFIX, T)                                                                       \
+    static inline vl_dsidx_t vlSIMDCompare##SUFFIX##Scalar(const T* data, vl_dsidx_t count, T value,                   \
+                                                           vl_uint32_t code, vl_uint8_t* mask)                         \
+    {                                                                                                                  \
+        const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 1u : 0u;                                         \
+        vl_dsidx_t total = 0;                                                                                          \
+        for (vl_dsidx_t base = 0; base < count; base += 8)                                                             \
+        {                                                                                                              \
+            const vl_dsidx_t n = count - base < 8 ? count - base : 8;                                                  \
+            vl_uint32_t byte = 0;                                                                                      \
+            for (vl_dsidx_t i = 0; i < n; i++)                                                                         \
+            {                                                                                                          \
+                const T x = data[base + i];                                                                            \
+                const vl_uint32_t hit = ((code & VL_SIMD_CMP_CODE_LT) && x < value) ||                                 \
+                    ((code & VL_SIMD_CMP_CODE_EQ) && x == value) || ((code & VL_SIMD_CMP_CODE_GT) && x > value);       \
+                byte |= (hit ^ invert) << i;                                                                           \
+            }                                                                                                          \
+            mask[base / 8] = (vl_uint8_t)byte;                                                                         \
+            total += vlSIMDPopCountScalar(byte);                                                                       \
+        }                                                                                                              \
+        return total;                                                                                                  \
+    }
+
+VL_SIMD_COMPARE_SCALAR_DEFINE(F32, vl_float32_t)
+VL_SIMD_COMPARE_SCALAR_DEFINE(I32, vl_int32_t)
+VL_SIMD_COMPARE_SCALAR_DEFINE(I16, vl_int16_t)
+VL_SIMD_COMPARE_SCALAR_DEFINE(U8, vl_uint8_t)
+
+#endif // VL_SIMD_KERNELS_H
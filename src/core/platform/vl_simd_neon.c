@@ -8,7 +8,10 @@
  */
 
 #include <arm_neon.h>
+#include <string.h>
+#include <vl/vl_algo.h>
 #include <vl/vl_simd.h>
+#include "vl_simd_kernels.h"
 
 /* ============================================================================
  * 4-wide F32 Operations
@@ -477,6 +480,1133 @@ static vl_simd_vec8_f32 vlSIMDNotVec8F32NEON(vl_simd_vec8_f32 a)
     return result;
 }
 
+/* ============================================================================
+ * Sorting Networks
+ * ============================================================================
+ */
+
+/**
+ * Copies keys into a power-of-two block of at least 4 signed integers with the
+ * same ordering, padding the tail with INT32_MAX. floatMask is 0x7FFFFFFF for
+ * floats and flip is 0x80000000 for unsigned integers; the mapping is its own
+ * inverse.
+ */
+static vl_dsidx_t vlSIMDSortPackNEON(vl_int32_t* block, const vl_uint32_t* keys, vl_dsidx_t count,
+                                     vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_dsidx_t blockSize = 4;
+    while (blockSize < count)
+    {
+        blockSize <<= 1;
+    }
+
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        block[i] = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+    }
+    for (vl_dsidx_t i = count; i < blockSize; i++)
+    {
+        block[i] = 0x7FFFFFFF;
+    }
+    return blockSize;
+}
+
+static void vlSIMDSortUnpackNEON(vl_uint32_t* keys, const vl_int32_t* block, vl_dsidx_t count,
+                                 vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = (vl_uint32_t)block[i] ^ flip;
+        keys[i] = x ^ ((0u - (x >> 31)) & floatMask);
+    }
+}
+
+/**
+ * Compare-exchanges each lane with its partner `p`, keeping the maximum in
+ * lanes set in `takeMax` and the minimum elsewhere.
+ */
+static inline int32x4_t vlSIMDSortStepNEON(int32x4_t v, int32x4_t p, uint32x4_t takeMax)
+{
+    return vbslq_s32(takeMax, vmaxq_s32(v, p), vminq_s32(v, p));
+}
+
+/**
+ * Runs the in-register steps (partner distance 2, 1) of one bitonic merge
+ * stage, with `dir` set in lanes that merge in descending order.
+ */
+static inline int32x4_t vlSIMDSortMergeLanesNEON(int32x4_t v, uint32x4_t dir, uint32x4_t bit2, uint32x4_t bit1)
+{
+    v = vlSIMDSortStepNEON(v, vextq_s32(v, v, 2), veorq_u32(bit2, dir));
+    return vlSIMDSortStepNEON(v, vrev64q_s32(v), veorq_u32(bit1, dir));
+}
+
+static void vlSIMDSortNetworkNEON(vl_int32_t* block, vl_dsidx_t n)
+{
+    static const vl_uint32_t bit1Lanes[4] = {0, 0xFFFFFFFFu, 0, 0xFFFFFFFFu};
+    static const vl_uint32_t bit2Lanes[4] = {0, 0, 0xFFFFFFFFu, 0xFFFFFFFFu};
+    const uint32x4_t zero = vdupq_n_u32(0);
+    const uint32x4_t ones = vdupq_n_u32(0xFFFFFFFFu);
+    const uint32x4_t bit1 = vld1q_u32(bit1Lanes);
+    const uint32x4_t bit2 = vld1q_u32(bit2Lanes);
+
+    /* Stages 2 and 4 sort each vector on its own, alternating direction. */
+    for (vl_dsidx_t i = 0; i < n; i += 4)
+    {
+        int32x4_t v = vld1q_s32(block + i);
+        v = vlSIMDSortStepNEON(v, vrev64q_s32(v), veorq_u32(bit1, bit2));
+        v = vlSIMDSortMergeLanesNEON(v, (i & 4) ? ones : zero, bit2, bit1);
+        vst1q_s32(block + i, v);
+    }
+
+    for (vl_dsidx_t k = 8; k <= n; k <<= 1)
+    {
+        /* Partners at least one vector apart: whole vectors compare-exchange. */
+        for (vl_dsidx_t j = k >> 1; j >= 4; j >>= 1)
+        {
+            for (vl_dsidx_t base = 0; base < n; base += j << 1)
+            {
+                for (vl_dsidx_t i = base; i < base + j; i += 4)
+                {
+                    const int32x4_t a = vld1q_s32(block + i);
+                    const int32x4_t b = vld1q_s32(block + i + j);
+                    const int32x4_t lo = vminq_s32(a, b);
+                    const int32x4_t hi = vmaxq_s32(a, b);
+                    const vl_bool_t descending = (i & k) != 0;
+                    vst1q_s32(block + i, descending ? hi : lo);
+                    vst1q_s32(block + i + j, descending ? lo : hi);
+                }
+            }
+        }
+
+        for (vl_dsidx_t i = 0; i < n; i += 4)
+        {
+            int32x4_t v = vld1q_s32(block + i);
+            v = vlSIMDSortMergeLanesNEON(v, (i & k) ? ones : zero, bit2, bit1);
+            vst1q_s32(block + i, v);
+        }
+    }
+}
+
+static void vlSIMDSortKeysNEON(void* keys, vl_dsidx_t count, vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_int32_t block[VL_SIMD_SORT_NETWORK_MAX];
+    if (count < 2)
+    {
+        return;
+    }
+    const vl_dsidx_t blockSize = vlSIMDSortPackNEON(block, (const vl_uint32_t*)keys, count, floatMask, flip);
+    vlSIMDSortNetworkNEON(block, blockSize);
+    vlSIMDSortUnpackNEON((vl_uint32_t*)keys, block, count, floatMask, flip);
+}
+
+static void vlSIMDSortI32NEON(vl_int32_t* data, vl_dsidx_t count) { vlSIMDSortKeysNEON(data, count, 0, 0); }
+
+static void vlSIMDSortU32NEON(vl_uint32_t* data, vl_dsidx_t count) { vlSIMDSortKeysNEON(data, count, 0, 0x80000000u); }
+
+static void vlSIMDSortF32NEON(vl_float32_t* data, vl_dsidx_t count)
+{
+    vlSIMDSortKeysNEON(data, count, 0x7FFFFFFFu, 0);
+}
+
+/**
+ * Scalar tail of the rank kernels: counts encoded keys before `encodedKey`.
+ */
+static vl_dsidx_t vlSIMDRankTailNEON(const vl_uint32_t* keys, vl_dsidx_t count, vl_int32_t encodedKey,
+                                     vl_uint32_t floatMask, vl_uint32_t flip, vl_bool_t inclusive)
+{
+    vl_dsidx_t rank = 0;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        const vl_int32_t encoded = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+        rank += inclusive ? encoded <= encodedKey : encoded < encodedKey;
+    }
+    return rank;
+}
+
+/**
+ * Counts keys before `key`, comparing four keys per step after mapping them
+ * to order-preserving signed integers in-register.
+ */
+static vl_dsidx_t vlSIMDRankKeysNEON(const void* keys, vl_dsidx_t count, vl_uint32_t key, vl_uint32_t floatMask,
+                                     vl_uint32_t flip, vl_bool_t inclusive)
+{
+    const vl_uint32_t* src = (const vl_uint32_t*)keys;
+    const vl_int32_t encodedKey = (vl_int32_t)(key ^ ((0u - (key >> 31)) & floatMask) ^ flip);
+    const int32x4_t vKey = vdupq_n_s32(encodedKey);
+    const uint32x4_t vFloat = vdupq_n_u32(floatMask);
+    const uint32x4_t vFlip = vdupq_n_u32(flip);
+    uint32x4_t counts = vdupq_n_u32(0);
+    vl_dsidx_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t raw = vld1q_u32(src + i);
+        const uint32x4_t sign = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(raw), 31));
+        const int32x4_t v = vreinterpretq_s32_u32(veorq_u32(veorq_u32(raw, vandq_u32(sign, vFloat)), vFlip));
+        /* Each matching lane is all ones, so subtracting the mask counts it. */
+        counts = vsubq_u32(counts, inclusive ? vcgtq_s32(v, vKey) : vcltq_s32(v, vKey));
+    }
+
+    const vl_dsidx_t vectorCount = (vl_dsidx_t)(vgetq_lane_u32(counts, 0) + vgetq_lane_u32(counts, 1) +
+                                                vgetq_lane_u32(counts, 2) + vgetq_lane_u32(counts, 3));
+
+    /* Inclusive ranks count the greater keys and take the complement. */
+    return (inclusive ? i - vectorCount : vectorCount) +
+        vlSIMDRankTailNEON(src + i, count - i, encodedKey, floatMask, flip, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankI32NEON(const vl_int32_t* keys, vl_dsidx_t count, vl_int32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysNEON(keys, count, (vl_uint32_t)key, 0, 0, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankU32NEON(const vl_uint32_t* keys, vl_dsidx_t count, vl_uint32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysNEON(keys, count, key, 0, 0x80000000u, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankF32NEON(const vl_float32_t* keys, vl_dsidx_t count, vl_float32_t key,
+                                    vl_bool_t inclusive)
+{
+    vl_uint32_t bits;
+    memcpy(&bits, &key, sizeof(bits));
+    return vlSIMDRankKeysNEON(keys, count, bits, 0x7FFFFFFFu, 0, inclusive);
+}
+
+/* ============================================================================
+ * Array Kernels
+ * ============================================================================
+ */
+
+static inline vl_float32_t vlSIMDHsumF32NEON(float32x4_t v)
+{
+    const float32x2_t pair = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(pair, pair), 0);
+}
+
+static inline vl_uint64_t vlSIMDHsumU64NEON(uint64x2_t v) { return vgetq_lane_u64(v, 0) + vgetq_lane_u64(v, 1); }
+
+static vl_float32_t vlSIMDSumF32NEON(const vl_float32_t* data, vl_dsidx_t count)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        acc0 = vaddq_f32(acc0, vld1q_f32(data + i));
+        acc1 = vaddq_f32(acc1, vld1q_f32(data + i + 4));
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        acc0 = vaddq_f32(acc0, vld1q_f32(data + i));
+    }
+    return vlSIMDHsumF32NEON(vaddq_f32(acc0, acc1)) + vlSIMDSumF32Scalar(data + i, count - i);
+}
+
+static vl_int64_t vlSIMDSumI32NEON(const vl_int32_t* data, vl_dsidx_t count)
+{
+    int64x2_t acc = vdupq_n_s64(0);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        acc = vpadalq_s32(acc, vld1q_s32(data + i));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64NEON(vreinterpretq_u64_s64(acc)) +
+                        (vl_uint64_t)vlSIMDSumI32Scalar(data + i, count - i));
+}
+
+static vl_int64_t vlSIMDSumI16NEON(const vl_int16_t* data, vl_dsidx_t count)
+{
+    int64x2_t acc = vdupq_n_s64(0);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        acc = vpadalq_s32(acc, vpaddlq_s16(vld1q_s16(data + i)));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64NEON(vreinterpretq_u64_s64(acc)) +
+                        (vl_uint64_t)vlSIMDSumI16Scalar(data + i, count - i));
+}
+
+static vl_uint64_t vlSIMDSumU8NEON(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    uint64x2_t acc = vdupq_n_u64(0);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(vld1q_u8(data + i))));
+    }
+    return vlSIMDHsumU64NEON(acc) + vlSIMDSumU8Scalar(data + i, count - i);
+}
+
+static vl_float32_t vlSIMDDotF32NEON(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    return vlSIMDHsumF32NEON(vaddq_f32(acc0, acc1)) + vlSIMDDotF32Scalar(a + i, b + i, count - i);
+}
+
+static vl_int64_t vlSIMDDotI32NEON(const vl_int32_t* a, const vl_int32_t* b, vl_dsidx_t count)
+{
+    int64x2_t acc = vdupq_n_s64(0);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const int32x4_t va = vld1q_s32(a + i), vb = vld1q_s32(b + i);
+        acc = vmlal_s32(acc, vget_low_s32(va), vget_low_s32(vb));
+        acc = vmlal_s32(acc, vget_high_s32(va), vget_high_s32(vb));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64NEON(vreinterpretq_u64_s64(acc)) +
+                        (vl_uint64_t)vlSIMDDotI32Scalar(a + i, b + i, count - i));
+}
+
+static vl_int64_t vlSIMDDotI16NEON(const vl_int16_t* a, const vl_int16_t* b, vl_dsidx_t count)
+{
+    int64x2_t acc = vdupq_n_s64(0);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x8_t va = vld1q_s16(a + i), vb = vld1q_s16(b + i);
+        /* Single 16x16 products fit in 32 bits; pairs are widened before adding. */
+        acc = vpadalq_s32(acc, vmull_s16(vget_low_s16(va), vget_low_s16(vb)));
+        acc = vpadalq_s32(acc, vmull_s16(vget_high_s16(va), vget_high_s16(vb)));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64NEON(vreinterpretq_u64_s64(acc)) +
+                        (vl_uint64_t)vlSIMDDotI16Scalar(a + i, b + i, count - i));
+}
+
+static void vlSIMDAxpyF32NEON(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const float32x4_t va = vdupq_n_f32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(y + i, vmlaq_f32(vld1q_f32(y + i), va, vld1q_f32(x + i)));
+    }
+    vlSIMDAxpyF32Scalar(x + i, y + i, count - i, alpha);
+}
+
+static void vlSIMDAxpyI32NEON(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const int32x4_t va = vdupq_n_s32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_s32(y + i, vmlaq_s32(vld1q_s32(y + i), va, vld1q_s32(x + i)));
+    }
+    vlSIMDAxpyI32Scalar(x + i, y + i, count - i, alpha);
+}
+
+static void vlSIMDScaleF32NEON(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const float32x4_t va = vdupq_n_f32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(dst + i, vmulq_f32(va, vld1q_f32(src + i)));
+    }
+    vlSIMDScaleF32Scalar(src + i, dst + i, count - i, alpha);
+}
+
+static void vlSIMDScaleI32NEON(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const int32x4_t va = vdupq_n_s32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_s32(dst + i, vmulq_s32(va, vld1q_s32(src + i)));
+    }
+    vlSIMDScaleI32Scalar(src + i, dst + i, count - i, alpha);
+}
+
+/**
+ * Generates the min/max fold, arg-min and clamp kernels for one element type.
+ * NEON has native minimum, maximum and equality for every type used here.
+ */
+#define VL_SIMD_RANGE_NEON_DEFINE(SUFFIX, T, LANES, VT, LD, ST, DUP, MIN, MAX, CEQ, ANY)                               \
+    static void vlSIMDMinMaxFold##SUFFIX##NEON(const T* data, vl_dsidx_t count, T* min, T* max)                        \
+    {                                                                                                                  \
+        vl_dsidx_t i = 0;                                                                                              \
+        if (count >= LANES)                                                                                            \
+        {                                                                                                              \
+            VT lo = DUP(*min), hi = DUP(*max);                                                                         \
+            for (; i + LANES <= count; i += LANES)                                                                     \
+            {                                                                                                          \
+                const VT v = LD(data + i);                                                                             \
+                lo = MIN(lo, v);                                                                                       \
+                hi = MAX(hi, v);                                                                                       \
+            }                                                                                                          \
+            T lanes[LANES];                                                                                            \
+            ST(lanes, lo);                                                                                             \
+            vlSIMDMinMax##SUFFIX##Scalar(lanes, LANES, min, max);                                                      \
+            ST(lanes, hi);                                                                                             \
+            vlSIMDMinMax##SUFFIX##Scalar(lanes, LANES, min, max);                                                      \
+        }                                                                                                              \
+        vlSIMDMinMax##SUFFIX##Scalar(data + i, count - i, min, max);                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static vl_bool_t vlSIMDMinMax##SUFFIX##NEON(const T* data, vl_dsidx_t count, T* outMin, T* outMax)                 \
+    {                                                                                                                  \
+        VL_SIMD_MINMAX_WRAP(T, vlSIMDMinMaxFold##SUFFIX##NEON, data, count, outMin, outMax);                           \
+    }                                                                                                                  \
+                                                                                                                       \
+    static vl_dsidx_t vlSIMDArgMin##SUFFIX##NEON(const T* data, vl_dsidx_t count)                                      \
+    {                                                                                                                  \
+        if (count == 0)                                                                                                \
+        {                                                                                                              \
+            return VL_STRUCTURE_INDEX_MAX;                                                                             \
+        }                                                                                                              \
+        T min = data[0], max = data[0];                                                                                \
+        vlSIMDMinMaxFold##SUFFIX##NEON(data, count, &min, &max);                                                       \
+        const VT target = DUP(min);                                                                                    \
+        vl_dsidx_t i = 0;                                                                                              \
+        for (; i + LANES <= count; i += LANES)                                                                         \
+        {                                                                                                              \
+            if (ANY(CEQ(LD(data + i), target)))                                                                        \
+            {                                                                                                          \
+                break;                                                                                                 \
+            }                                                                                                          \
+        }                                                                                                              \
+        i += vlSIMDFind##SUFFIX##Scalar(data + i, count - i, min);                                                     \
+        return i < count ? i : 0;                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    static void vlSIMDClamp##SUFFIX##NEON(const T* src, T* dst, vl_dsidx_t count, T lo, T hi)                          \
+    {                                                                                                                  \
+        const VT vLo = DUP(lo), vHi = DUP(hi);                                                                         \
+        vl_dsidx_t i = 0;                                                                                              \
+        for (; i + LANES <= count; i += LANES)                                                                         \
+        {                                                                                                              \
+            ST(dst + i, MIN(MAX(LD(src + i), vLo), vHi));                                                              \
+        }                                                                                                              \
+        vlSIMDClamp##SUFFIX##Scalar(src + i, dst + i, count - i, lo, hi);                                              \
+    }
+
+/** Whether any lane of a compare mask is set, by folding it down to 64 bits. */
+static inline vl_bool_t vlSIMDAnyU32NEON(uint32x4_t m)
+{
+    const uint32x2_t folded = vorr_u32(vget_low_u32(m), vget_high_u32(m));
+    return vget_lane_u64(vreinterpret_u64_u32(folded), 0) != 0;
+}
+
+static inline vl_bool_t vlSIMDAnyU16NEON(uint16x8_t m) { return vlSIMDAnyU32NEON(vreinterpretq_u32_u16(m)); }
+
+static inline vl_bool_t vlSIMDAnyU8NEON(uint8x16_t m) { return vlSIMDAnyU32NEON(vreinterpretq_u32_u8(m)); }
+
+VL_SIMD_RANGE_NEON_DEFINE(F32, vl_float32_t, 4, float32x4_t, vld1q_f32, vst1q_f32, vdupq_n_f32, vminq_f32, vmaxq_f32,
+                          vceqq_f32, vlSIMDAnyU32NEON)
+VL_SIMD_RANGE_NEON_DEFINE(I32, vl_int32_t, 4, int32x4_t, vld1q_s32, vst1q_s32, vdupq_n_s32, vminq_s32, vmaxq_s32,
+                          vceqq_s32, vlSIMDAnyU32NEON)
+VL_SIMD_RANGE_NEON_DEFINE(I16, vl_int16_t, 8, int16x8_t, vld1q_s16, vst1q_s16, vdupq_n_s16, vminq_s16, vmaxq_s16,
+                          vceqq_s16, vlSIMDAnyU16NEON)
+VL_SIMD_RANGE_NEON_DEFINE(U8, vl_uint8_t, 16, uint8x16_t, vld1q_u8, vst1q_u8, vdupq_n_u8, vminq_u8, vmaxq_u8,
+                          vceqq_u8, vlSIMDAnyU8NEON)
+
+/**
+ * Prefix sums scan each vector with two shifted adds (log2 of four lanes),
+ * then add the running total carried over from the previous vector.
+ */
+static void vlSIMDPrefixSumF32NEON(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    float32x4_t carry = zero;
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t v = vld1q_f32(src + i);
+        v = vaddq_f32(v, vextq_f32(zero, v, 3));
+        v = vaddq_f32(v, vextq_f32(zero, v, 2));
+        v = vaddq_f32(v, carry);
+        vst1q_f32(dst + i, v);
+        carry = vdupq_n_f32(vgetq_lane_f32(v, 3));
+    }
+    vlSIMDPrefixSumF32Scalar(src + i, dst + i, count - i, vgetq_lane_f32(carry, 0));
+}
+
+static void vlSIMDPrefixSumI32NEON(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    const int32x4_t zero = vdupq_n_s32(0);
+    int32x4_t carry = zero;
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        int32x4_t v = vld1q_s32(src + i);
+        v = vaddq_s32(v, vextq_s32(zero, v, 3));
+        v = vaddq_s32(v, vextq_s32(zero, v, 2));
+        v = vaddq_s32(v, carry);
+        vst1q_s32(dst + i, v);
+        carry = vdupq_n_s32(vgetq_lane_s32(v, 3));
+    }
+    vlSIMDPrefixSumI32Scalar(src + i, dst + i, count - i, vgetq_lane_s32(carry, 0));
+}
+
+/**
+ * Compare kernels evaluate less, equal and greater for every lane and keep the
+ * ones selected by the compare code. Lane masks become bits by keeping one
+ * weight per lane and adding the lanes together pairwise.
+ */
+static const vl_uint32_t vlSIMDCompareWeightsU32NEON[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+static const vl_uint16_t vlSIMDCompareWeightsU16NEON[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+static const vl_uint8_t vlSIMDCompareWeightsU8NEON[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+static inline vl_uint32_t vlSIMDCompareByteU32NEON(uint32x4_t lo, uint32x4_t hi)
+{
+    const uint32x4_t bits = vorrq_u32(vandq_u32(lo, vld1q_u32(vlSIMDCompareWeightsU32NEON)),
+                                      vandq_u32(hi, vld1q_u32(vlSIMDCompareWeightsU32NEON + 4)));
+    const uint32x2_t pair = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return vget_lane_u32(vpadd_u32(pair, pair), 0);
+}
+
+static vl_dsidx_t vlSIMDCompareF32NEON(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t value,
+                                     vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const uint32x4_t wantLt = vdupq_n_u32((code & VL_SIMD_CMP_CODE_LT) ? ~0u : 0u);
+    const uint32x4_t wantEq = vdupq_n_u32((code & VL_SIMD_CMP_CODE_EQ) ? ~0u : 0u);
+    const uint32x4_t wantGt = vdupq_n_u32((code & VL_SIMD_CMP_CODE_GT) ? ~0u : 0u);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFu : 0u;
+    const float32x4_t v = vdupq_n_f32(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const float32x4_t a = vld1q_f32(data + i), b = vld1q_f32(data + i + 4);
+        const uint32x4_t hitA = vorrq_u32(vorrq_u32(vandq_u32(vcltq_f32(a, v), wantLt),
+                                                    vandq_u32(vceqq_f32(a, v), wantEq)),
+                                          vandq_u32(vcgtq_f32(a, v), wantGt));
+        const uint32x4_t hitB = vorrq_u32(vorrq_u32(vandq_u32(vcltq_f32(b, v), wantLt),
+                                                    vandq_u32(vceqq_f32(b, v), wantEq)),
+                                          vandq_u32(vcgtq_f32(b, v), wantGt));
+        const vl_uint32_t byte = vlSIMDCompareByteU32NEON(hitA, hitB) ^ invert;
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareF32Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareI32NEON(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t value,
+                                     vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const uint32x4_t wantLt = vdupq_n_u32((code & VL_SIMD_CMP_CODE_LT) ? ~0u : 0u);
+    const uint32x4_t wantEq = vdupq_n_u32((code & VL_SIMD_CMP_CODE_EQ) ? ~0u : 0u);
+    const uint32x4_t wantGt = vdupq_n_u32((code & VL_SIMD_CMP_CODE_GT) ? ~0u : 0u);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFu : 0u;
+    const int32x4_t v = vdupq_n_s32(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const int32x4_t a = vld1q_s32(data + i), b = vld1q_s32(data + i + 4);
+        const uint32x4_t hitA = vorrq_u32(vorrq_u32(vandq_u32(vcltq_s32(a, v), wantLt),
+                                                    vandq_u32(vceqq_s32(a, v), wantEq)),
+                                          vandq_u32(vcgtq_s32(a, v), wantGt));
+        const uint32x4_t hitB = vorrq_u32(vorrq_u32(vandq_u32(vcltq_s32(b, v), wantLt),
+                                                    vandq_u32(vceqq_s32(b, v), wantEq)),
+                                          vandq_u32(vcgtq_s32(b, v), wantGt));
+        const vl_uint32_t byte = vlSIMDCompareByteU32NEON(hitA, hitB) ^ invert;
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareI32Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareI16NEON(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t value,
+                                     vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const uint16x8_t wantLt = vdupq_n_u16((code & VL_SIMD_CMP_CODE_LT) ? 0xFFFFu : 0u);
+    const uint16x8_t wantEq = vdupq_n_u16((code & VL_SIMD_CMP_CODE_EQ) ? 0xFFFFu : 0u);
+    const uint16x8_t wantGt = vdupq_n_u16((code & VL_SIMD_CMP_CODE_GT) ? 0xFFFFu : 0u);
+    const uint16x8_t weights = vld1q_u16(vlSIMDCompareWeightsU16NEON);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFu : 0u;
+    const int16x8_t v = vdupq_n_s16(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x8_t a = vld1q_s16(data + i);
+        const uint16x8_t hit = vorrq_u16(vorrq_u16(vandq_u16(vcltq_s16(a, v), wantLt),
+                                                   vandq_u16(vceqq_s16(a, v), wantEq)),
+                                         vandq_u16(vcgtq_s16(a, v), wantGt));
+        const uint16x8_t bits = vandq_u16(hit, weights);
+        uint16x4_t sum = vpadd_u16(vget_low_u16(bits), vget_high_u16(bits));
+        sum = vpadd_u16(sum, sum);
+        sum = vpadd_u16(sum, sum);
+        const vl_uint32_t byte = (vl_uint32_t)vget_lane_u16(sum, 0) ^ invert;
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareI16Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareU8NEON(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value,
+                                    vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const uint8x16_t wantLt = vdupq_n_u8((code & VL_SIMD_CMP_CODE_LT) ? 0xFFu : 0u);
+    const uint8x16_t wantEq = vdupq_n_u8((code & VL_SIMD_CMP_CODE_EQ) ? 0xFFu : 0u);
+    const uint8x16_t wantGt = vdupq_n_u8((code & VL_SIMD_CMP_CODE_GT) ? 0xFFu : 0u);
+    const uint8x16_t weights = vld1q_u8(vlSIMDCompareWeightsU8NEON);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFFFu : 0u;
+    const uint8x16_t v = vdupq_n_u8(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t a = vld1q_u8(data + i);
+        const uint8x16_t hit =
+            vorrq_u8(vorrq_u8(vandq_u8(vcltq_u8(a, v), wantLt), vandq_u8(vceqq_u8(a, v), wantEq)),
+                     vandq_u8(vcgtq_u8(a, v), wantGt));
+        const uint8x16_t bits = vandq_u8(hit, weights);
+        /* Three pairwise adds collapse each group of eight lanes into one byte. */
+        uint8x8_t sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+        sum = vpadd_u8(sum, sum);
+        sum = vpadd_u8(sum, sum);
+        const vl_uint32_t word =
+            ((vl_uint32_t)vget_lane_u8(sum, 0) | ((vl_uint32_t)vget_lane_u8(sum, 1) << 8)) ^ invert;
+        mask[i / 8] = (vl_uint8_t)word;
+        mask[i / 8 + 1] = (vl_uint8_t)(word >> 8);
+        total += vlSIMDPopCountScalar(word);
+    }
+    return total + vlSIMDCompareU8Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+/* ============================================================================
+ * 512-bit Wide Operations
+ *
+ * Each 16-lane or 64-byte vector is processed as four 128-bit quarters.
+ * ============================================================================
+ */
+
+static vl_simd_vec16_f32 vlSIMDLoadVec16F32NEON(const vl_float32_t* ptr)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_f32(&result.components[q], vld1q_f32(&ptr[q]));
+    return result;
+}
+
+static void vlSIMDStoreVec16F32NEON(vl_float32_t* ptr, vl_simd_vec16_f32 v)
+{
+    for (int q = 0; q < 16; q += 4)
+        vst1q_f32(&ptr[q], vld1q_f32(&v.components[q]));
+}
+
+static vl_simd_vec16_f32 vlSIMDSplatVec16F32NEON(vl_float32_t scalar)
+{
+    vl_simd_vec16_f32 result;
+    const float32x4_t s = vdupq_n_f32(scalar);
+    for (int q = 0; q < 16; q += 4)
+        vst1q_f32(&result.components[q], s);
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDAddVec16F32NEON(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_f32(&result.components[q], vaddq_f32(vld1q_f32(&a.components[q]), vld1q_f32(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDSubVec16F32NEON(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_f32(&result.components[q], vsubq_f32(vld1q_f32(&a.components[q]), vld1q_f32(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDMulVec16F32NEON(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_f32(&result.components[q], vmulq_f32(vld1q_f32(&a.components[q]), vld1q_f32(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDFmaVec16F32NEON(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b, vl_simd_vec16_f32 c)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+    {
+        const float32x4_t va = vld1q_f32(&a.components[q]);
+        const float32x4_t vb = vld1q_f32(&b.components[q]);
+        vst1q_f32(&result.components[q], vmlaq_f32(vld1q_f32(&c.components[q]), va, vb));
+    }
+    return result;
+}
+
+static vl_float32_t vlSIMDHsumVec16F32NEON(vl_simd_vec16_f32 v)
+{
+    const float32x4_t low = vaddq_f32(vld1q_f32(&v.components[0]), vld1q_f32(&v.components[4]));
+    const float32x4_t high = vaddq_f32(vld1q_f32(&v.components[8]), vld1q_f32(&v.components[12]));
+    return vlSIMDHsumF32NEON(vaddq_f32(low, high));
+}
+
+static vl_simd_vec16_i32 vlSIMDLoadVec16I32NEON(const vl_int32_t* ptr)
+{
+    vl_simd_vec16_i32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_s32(&result.components[q], vld1q_s32(&ptr[q]));
+    return result;
+}
+
+static void vlSIMDStoreVec16I32NEON(vl_int32_t* ptr, vl_simd_vec16_i32 v)
+{
+    for (int q = 0; q < 16; q += 4)
+        vst1q_s32(&ptr[q], vld1q_s32(&v.components[q]));
+}
+
+static vl_simd_vec16_i32 vlSIMDAddVec16I32NEON(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_s32(&result.components[q], vaddq_s32(vld1q_s32(&a.components[q]), vld1q_s32(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_i32 vlSIMDMulVec16I32NEON(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int q = 0; q < 16; q += 4)
+        vst1q_s32(&result.components[q], vmulq_s32(vld1q_s32(&a.components[q]), vld1q_s32(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec64_u8 vlSIMDLoadVec64U8NEON(const vl_uint8_t* ptr)
+{
+    vl_simd_vec64_u8 result;
+    for (int q = 0; q < 64; q += 16)
+        vst1q_u8(&result.components[q], vld1q_u8(&ptr[q]));
+    return result;
+}
+
+static void vlSIMDStoreVec64U8NEON(vl_uint8_t* ptr, vl_simd_vec64_u8 v)
+{
+    for (int q = 0; q < 64; q += 16)
+        vst1q_u8(&ptr[q], vld1q_u8(&v.components[q]));
+}
+
+static vl_uint64_t vlSIMDEqMaskVec64U8NEON(vl_simd_vec64_u8 v, vl_uint8_t byte)
+{
+    const uint8x16_t needle = vdupq_n_u8(byte);
+    const uint8x16_t weights = vld1q_u8(vlSIMDCompareWeightsU8NEON);
+    uint8x8_t pairs[4];
+    for (int q = 0; q < 4; q++)
+    {
+        const uint8x16_t bits = vandq_u8(vceqq_u8(vld1q_u8(&v.components[q * 16]), needle), weights);
+        pairs[q] = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+    }
+    /* Two more rounds of pairwise adds leave one mask byte per group of eight lanes, in lane order. */
+    const uint8x8_t quads = vpadd_u8(vpadd_u8(pairs[0], pairs[1]), vpadd_u8(pairs[2], pairs[3]));
+    return vget_lane_u64(vreinterpret_u64_u8(quads), 0);
+}
+
+/* ============================================================================
+ * Byte Scanning
+ *
+ * Long arrays are skimmed four vectors at a time, testing only whether any
+ * byte in the block matched; the single-vector loop then pins down where.
+ * Arrays of at least one vector end with a vector that overlaps the one
+ * before it instead of a scalar tail. The overlapped bytes are already known
+ * not to match, so they cannot change a find or equality result.
+ * ============================================================================
+ */
+
+/**
+ * Narrows a byte compare result to 64 bits, four per lane: bits `4 * i` to
+ * `4 * i + 3` are set when lane `i` matched. NEON has no byte movemask.
+ */
+static inline vl_uint64_t vlSIMDNibbleMaskNEON(uint8x16_t eq)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+/** Whether any of the 64 bytes at `ptr` equals the splatted value. */
+static inline vl_bool_t vlSIMDEqAny4U8NEON(const vl_uint8_t* ptr, uint8x16_t value)
+{
+    const uint8x16_t e01 = vorrq_u8(vceqq_u8(vld1q_u8(ptr), value), vceqq_u8(vld1q_u8(ptr + 16), value));
+    const uint8x16_t e23 = vorrq_u8(vceqq_u8(vld1q_u8(ptr + 32), value), vceqq_u8(vld1q_u8(ptr + 48), value));
+    return vlSIMDNibbleMaskNEON(vorrq_u8(e01, e23)) != 0;
+}
+
+static inline vl_uint64_t vlSIMDAnyBitsU8NEON(const vl_uint8_t* ptr, const uint8x16_t* set, vl_dsidx_t setCount)
+{
+    const uint8x16_t a = vld1q_u8(ptr);
+    uint8x16_t hit = vceqq_u8(a, set[0]);
+    for (vl_dsidx_t k = 1; k < setCount; k++)
+    {
+        hit = vorrq_u8(hit, vceqq_u8(a, set[k]));
+    }
+    return vlSIMDNibbleMaskNEON(hit);
+}
+
+static vl_dsidx_t vlSIMDFindU8NEON(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    if (count < 16)
+    {
+        return vlSIMDFindU8Scalar(data, count, value);
+    }
+    const uint8x16_t v = vdupq_n_u8(value);
+    vl_dsidx_t i = 0;
+    vl_uint64_t bits;
+    while (i + 64 <= count && !vlSIMDEqAny4U8NEON(data + i, v))
+    {
+        i += 64;
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        if ((bits = vlSIMDNibbleMaskNEON(vceqq_u8(vld1q_u8(data + i), v))) != 0)
+        {
+            return i + vlAlgoCTZ64(bits) / 4;
+        }
+    }
+    if (i == count)
+    {
+        return count;
+    }
+    i = count - 16;
+    bits = vlSIMDNibbleMaskNEON(vceqq_u8(vld1q_u8(data + i), v));
+    return bits ? i + vlAlgoCTZ64(bits) / 4 : count;
+}
+
+static vl_dsidx_t vlSIMDFindLastU8NEON(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    if (count < 16)
+    {
+        return vlSIMDFindLastU8Scalar(data, count, value);
+    }
+    const uint8x16_t v = vdupq_n_u8(value);
+    vl_dsidx_t i = count;
+    vl_uint64_t bits;
+    while (i >= 64 && !vlSIMDEqAny4U8NEON(data + i - 64, v))
+    {
+        i -= 64;
+    }
+    while (i >= 16)
+    {
+        i -= 16;
+        if ((bits = vlSIMDNibbleMaskNEON(vceqq_u8(vld1q_u8(data + i), v))) != 0)
+        {
+            return i + (63 - vlAlgoCLZ64(bits)) / 4;
+        }
+    }
+    if (i == 0)
+    {
+        return count;
+    }
+    bits = vlSIMDNibbleMaskNEON(vceqq_u8(vld1q_u8(data), v));
+    return bits ? (63 - vlAlgoCLZ64(bits)) / 4 : count;
+}
+
+static vl_dsidx_t vlSIMDFindAnyU8NEON(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                       vl_dsidx_t setCount)
+{
+    if (count < 16 || setCount == 0 || setCount > VL_SIMD_FIND_ANY_VECTOR_MAX)
+    {
+        return vlSIMDFindAnyU8Scalar(data, count, set, setCount);
+    }
+    uint8x16_t splat[VL_SIMD_FIND_ANY_VECTOR_MAX];
+    for (vl_dsidx_t k = 0; k < setCount; k++)
+    {
+        splat[k] = vdupq_n_u8(set[k]);
+    }
+    vl_dsidx_t i = 0;
+    vl_uint64_t bits;
+    for (; i + 16 <= count; i += 16)
+    {
+        if ((bits = vlSIMDAnyBitsU8NEON(data + i, splat, setCount)) != 0)
+        {
+            return i + vlAlgoCTZ64(bits) / 4;
+        }
+    }
+    if (i == count)
+    {
+        return count;
+    }
+    i = count - 16;
+    bits = vlSIMDAnyBitsU8NEON(data + i, splat, setCount);
+    return bits ? i + vlAlgoCTZ64(bits) / 4 : count;
+}
+
+static vl_dsidx_t vlSIMDCountU8NEON(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    const uint8x16_t v = vdupq_n_u8(value);
+    uint64x2_t total = vdupq_n_u64(0);
+    vl_dsidx_t i = 0;
+    while (count - i >= 16)
+    {
+        /* A match is all ones, so subtracting it counts up per byte; counters are widened every 255 vectors. */
+        const vl_dsidx_t blocks = (count - i) / 16 < 255 ? (count - i) / 16 : 255;
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (vl_dsidx_t b = 0; b < blocks; b++, i += 16)
+        {
+            acc = vsubq_u8(acc, vceqq_u8(vld1q_u8(data + i), v));
+        }
+        total = vpadalq_u32(total, vpaddlq_u16(vpaddlq_u8(acc)));
+    }
+    const vl_uint64_t sum = vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1);
+    return (vl_dsidx_t)sum + vlSIMDCountU8Scalar(data + i, count - i, value);
+}
+
+static vl_bool_t vlSIMDEqualU8NEON(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    if (count < 16)
+    {
+        return vlSIMDEqualU8Scalar(a, b, count);
+    }
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        if (vlSIMDNibbleMaskNEON(vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i))) != ~0ull)
+        {
+            return VL_FALSE;
+        }
+    }
+    if (i == count)
+    {
+        return VL_TRUE;
+    }
+    i = count - 16;
+    return vlSIMDNibbleMaskNEON(vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i))) == ~0ull;
+}
+
+/* ============================================================================
+ * Half-Precision Conversion
+ *
+ * Conversion instructions are an optional extension on ARMv7 (-mfpu=neon-fp16),
+ * so this backend converts one element at a time with the scalar routines.
+ * ============================================================================
+ */
+
+static void vlSIMDConvertF32ToHalfNEON(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF32ToHalfScalar(src, dst, count);
+}
+
+static void vlSIMDConvertHalfToF32NEON(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertHalfToF32Scalar(src, dst, count);
+}
+
+/* ============================================================================
+ * Numeric Type Conversion
+ *
+ * Integer widening uses vmovl and narrowing vmovn, which keeps the low half
+ * like the C cast. ARMv7 NEON has no double-precision vectors, so the F64
+ * conversions run the scalar casts.
+ * ============================================================================
+ */
+
+static void vlSIMDConvertI32ToF32NEON(const vl_int32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        vst1q_f32(dst + i, vcvtq_f32_s32(vld1q_s32(src + i)));
+        vst1q_f32(dst + i + 4, vcvtq_f32_s32(vld1q_s32(src + i + 4)));
+    }
+    vlSIMDConvertI32ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF32ToI32NEON(const vl_float32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        vst1q_s32(dst + i, vcvtq_s32_f32(vld1q_f32(src + i)));
+        vst1q_s32(dst + i + 4, vcvtq_s32_f32(vld1q_f32(src + i + 4)));
+    }
+    vlSIMDConvertF32ToI32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI16ToF32NEON(const vl_int16_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x8_t v = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+        vst1q_f32(dst + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+    }
+    vlSIMDConvertI16ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertU8ToF32NEON(const vl_uint8_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint16x8_t v = vmovl_u8(vld1_u8(src + i));
+        vst1q_f32(dst + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+        vst1q_f32(dst + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+    }
+    vlSIMDConvertU8ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF32ToF64NEON(const vl_float32_t* src, vl_float64_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF32ToF64Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertF64ToF32NEON(const vl_float64_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF64ToF32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertI16ToI32NEON(const vl_int16_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x8_t v = vld1q_s16(src + i);
+        vst1q_s32(dst + i, vmovl_s16(vget_low_s16(v)));
+        vst1q_s32(dst + i + 4, vmovl_s16(vget_high_s16(v)));
+    }
+    vlSIMDConvertI16ToI32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI32ToI16NEON(const vl_int32_t* src, vl_int16_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x4_t lo = vmovn_s32(vld1q_s32(src + i));
+        const int16x4_t hi = vmovn_s32(vld1q_s32(src + i + 4));
+        vst1q_s16(dst + i, vcombine_s16(lo, hi));
+    }
+    vlSIMDConvertI32ToI16Scalar(src + i, dst + i, count - i);
+}
+
+/* ============================================================================
+ * Byte Swapping and Gathers
+ *
+ * vrev16/32/64 reverse the bytes within each element directly. NEON has no
+ * gather, so strided copies use the scalar loops.
+ * ============================================================================
+ */
+
+static void vlSIMDByteSwapU16NEON(vl_uint16_t* data, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        vst1q_u16(data + i, vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(vld1q_u16(data + i)))));
+    }
+    vlSIMDByteSwapU16Scalar(data + i, count - i);
+}
+
+static void vlSIMDByteSwapU32NEON(vl_uint32_t* data, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_u32(data + i, vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(data + i)))));
+    }
+    vlSIMDByteSwapU32Scalar(data + i, count - i);
+}
+
+static void vlSIMDByteSwapU64NEON(vl_uint64_t* data, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        vst1q_u64(data + i, vreinterpretq_u64_u8(vrev64q_u8(vreinterpretq_u8_u64(vld1q_u64(data + i)))));
+    }
+    vlSIMDByteSwapU64Scalar(data + i, count - i);
+}
+
+static void vlSIMDGather32NEON(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDGather32Scalar(src, srcStride, dst, count);
+}
+
+static void vlSIMDGather64NEON(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDGather64Scalar(src, srcStride, dst, count);
+}
+
+/* ============================================================================
+ * Random Number Generation
+ *
+ * The eight xoshiro256++ lanes live in four vectors per state word for the
+ * whole call; rotates are a shift pair ORed together.
+ * ============================================================================
+ */
+
+/** Steps the two lanes held in `s` and returns their outputs. */
+static inline uint64x2_t vlSIMDXoshiroStepNEON(uint64x2_t* s)
+{
+    const uint64x2_t sum = vaddq_u64(s[0], s[3]);
+    const uint64x2_t result = vaddq_u64(vorrq_u64(vshlq_n_u64(sum, 23), vshrq_n_u64(sum, 41)), s[0]);
+    const uint64x2_t t = vshlq_n_u64(s[1], 17);
+    s[2] = veorq_u64(s[2], s[0]);
+    s[3] = veorq_u64(s[3], s[1]);
+    s[1] = veorq_u64(s[1], s[2]);
+    s[0] = veorq_u64(s[0], s[3]);
+    s[2] = veorq_u64(s[2], t);
+    s[3] = vorrq_u64(vshlq_n_u64(s[3], 45), vshrq_n_u64(s[3], 19));
+    return result;
+}
+
+/** Loads lane pair `q` (lanes 2q and 2q+1) of every state word into s[q]. */
+static inline void vlSIMDXoshiroLoadNEON(const vl_uint64_t* state, uint64x2_t (*s)[4])
+{
+    for (int q = 0; q < 4; q++)
+        for (int w = 0; w < 4; w++)
+            s[q][w] = vld1q_u64(state + w * VL_SIMD_XOSHIRO_LANES + q * 2);
+}
+
+static inline void vlSIMDXoshiroStoreNEON(vl_uint64_t* state, uint64x2_t (*s)[4])
+{
+    for (int q = 0; q < 4; q++)
+        for (int w = 0; w < 4; w++)
+            vst1q_u64(state + w * VL_SIMD_XOSHIRO_LANES + q * 2, s[q][w]);
+}
+
+static void vlSIMDXoshiroU64NEON(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    uint64x2_t s[4][4];
+    vl_uint8_t* out = (vl_uint8_t*)dst;
+    vlSIMDXoshiroLoadNEON(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, out += 64)
+    {
+        for (int q = 0; q < 4; q++)
+            vst1q_u8(out + q * 16, vreinterpretq_u8_u64(vlSIMDXoshiroStepNEON(s[q])));
+    }
+    vlSIMDXoshiroStoreNEON(state, s);
+}
+
+static void vlSIMDXoshiroF32NEON(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    const uint32x4_t one = vdupq_n_u32(VL_SIMD_XOSHIRO_F32_ONE);
+    uint64x2_t s[4][4];
+    vlSIMDXoshiroLoadNEON(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 16)
+    {
+        for (int q = 0; q < 4; q++)
+        {
+            const uint32x4_t r = vreinterpretq_u32_u64(vlSIMDXoshiroStepNEON(s[q]));
+            const uint32x4_t bits = vorrq_u32(vshrq_n_u32(r, 9), one);
+            vst1q_f32(dst + q * 4, vsubq_f32(vreinterpretq_f32_u32(bits), vdupq_n_f32(1.0f)));
+        }
+    }
+    vlSIMDXoshiroStoreNEON(state, s);
+}
+
+/** ARMv7 NEON has no double-precision vectors. */
+static void vlSIMDXoshiroF64NEON(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    vlSIMDXoshiroF64Scalar(state, dst, blocks);
+}
+
 /* ============================================================================
  * Initialization
  * ============================================================================
@@ -540,5 +1670,78 @@ void vlSIMDInitNEON(void)
     vlSIMDFunctions.load_vec32u8 = vlSIMDLoadVec32U8NEON;
     vlSIMDFunctions.store_vec32u8 = vlSIMDStoreVec32U8NEON;
 
+    vlSIMDFunctions.load_vec16f32 = vlSIMDLoadVec16F32NEON;
+    vlSIMDFunctions.store_vec16f32 = vlSIMDStoreVec16F32NEON;
+    vlSIMDFunctions.splat_vec16f32 = vlSIMDSplatVec16F32NEON;
+    vlSIMDFunctions.add_vec16f32 = vlSIMDAddVec16F32NEON;
+    vlSIMDFunctions.sub_vec16f32 = vlSIMDSubVec16F32NEON;
+    vlSIMDFunctions.mul_vec16f32 = vlSIMDMulVec16F32NEON;
+    vlSIMDFunctions.fma_vec16f32 = vlSIMDFmaVec16F32NEON;
+    vlSIMDFunctions.hsum_vec16f32 = vlSIMDHsumVec16F32NEON;
+    vlSIMDFunctions.load_vec16i32 = vlSIMDLoadVec16I32NEON;
+    vlSIMDFunctions.store_vec16i32 = vlSIMDStoreVec16I32NEON;
+    vlSIMDFunctions.add_vec16i32 = vlSIMDAddVec16I32NEON;
+    vlSIMDFunctions.mul_vec16i32 = vlSIMDMulVec16I32NEON;
+    vlSIMDFunctions.load_vec64u8 = vlSIMDLoadVec64U8NEON;
+    vlSIMDFunctions.store_vec64u8 = vlSIMDStoreVec64U8NEON;
+    vlSIMDFunctions.eqmask_vec64u8 = vlSIMDEqMaskVec64U8NEON;
+    vlSIMDFunctions.sort_i32 = vlSIMDSortI32NEON;
+    vlSIMDFunctions.sort_u32 = vlSIMDSortU32NEON;
+    vlSIMDFunctions.sort_f32 = vlSIMDSortF32NEON;
+    vlSIMDFunctions.rank_i32 = vlSIMDRankI32NEON;
+    vlSIMDFunctions.rank_u32 = vlSIMDRankU32NEON;
+    vlSIMDFunctions.rank_f32 = vlSIMDRankF32NEON;
+    vlSIMDFunctions.sum_f32 = vlSIMDSumF32NEON;
+    vlSIMDFunctions.sum_i32 = vlSIMDSumI32NEON;
+    vlSIMDFunctions.sum_i16 = vlSIMDSumI16NEON;
+    vlSIMDFunctions.sum_u8 = vlSIMDSumU8NEON;
+    vlSIMDFunctions.dot_f32 = vlSIMDDotF32NEON;
+    vlSIMDFunctions.dot_i32 = vlSIMDDotI32NEON;
+    vlSIMDFunctions.dot_i16 = vlSIMDDotI16NEON;
+    vlSIMDFunctions.axpy_f32 = vlSIMDAxpyF32NEON;
+    vlSIMDFunctions.axpy_i32 = vlSIMDAxpyI32NEON;
+    vlSIMDFunctions.scale_f32 = vlSIMDScaleF32NEON;
+    vlSIMDFunctions.scale_i32 = vlSIMDScaleI32NEON;
+    vlSIMDFunctions.minmax_f32 = vlSIMDMinMaxF32NEON;
+    vlSIMDFunctions.minmax_i32 = vlSIMDMinMaxI32NEON;
+    vlSIMDFunctions.minmax_i16 = vlSIMDMinMaxI16NEON;
+    vlSIMDFunctions.minmax_u8 = vlSIMDMinMaxU8NEON;
+    vlSIMDFunctions.argmin_f32 = vlSIMDArgMinF32NEON;
+    vlSIMDFunctions.argmin_i32 = vlSIMDArgMinI32NEON;
+    vlSIMDFunctions.argmin_i16 = vlSIMDArgMinI16NEON;
+    vlSIMDFunctions.argmin_u8 = vlSIMDArgMinU8NEON;
+    vlSIMDFunctions.clamp_f32 = vlSIMDClampF32NEON;
+    vlSIMDFunctions.clamp_i32 = vlSIMDClampI32NEON;
+    vlSIMDFunctions.clamp_i16 = vlSIMDClampI16NEON;
+    vlSIMDFunctions.clamp_u8 = vlSIMDClampU8NEON;
+    vlSIMDFunctions.prefix_sum_f32 = vlSIMDPrefixSumF32NEON;
+    vlSIMDFunctions.prefix_sum_i32 = vlSIMDPrefixSumI32NEON;
+    vlSIMDFunctions.compare_f32 = vlSIMDCompareF32NEON;
+    vlSIMDFunctions.compare_i32 = vlSIMDCompareI32NEON;
+    vlSIMDFunctions.compare_i16 = vlSIMDCompareI16NEON;
+    vlSIMDFunctions.compare_u8 = vlSIMDCompareU8NEON;
+    vlSIMDFunctions.find_u8 = vlSIMDFindU8NEON;
+    vlSIMDFunctions.find_last_u8 = vlSIMDFindLastU8NEON;
+    vlSIMDFunctions.find_any_u8 = vlSIMDFindAnyU8NEON;
+    vlSIMDFunctions.count_u8 = vlSIMDCountU8NEON;
+    vlSIMDFunctions.equal_u8 = vlSIMDEqualU8NEON;
+    vlSIMDFunctions.convert_f32_to_half = vlSIMDConvertF32ToHalfNEON;
+    vlSIMDFunctions.convert_half_to_f32 = vlSIMDConvertHalfToF32NEON;
+    vlSIMDFunctions.convert_i32_to_f32 = vlSIMDConvertI32ToF32NEON;
+    vlSIMDFunctions.convert_f32_to_i32 = vlSIMDConvertF32ToI32NEON;
+    vlSIMDFunctions.convert_i16_to_f32 = vlSIMDConvertI16ToF32NEON;
+    vlSIMDFunctions.convert_u8_to_f32 = vlSIMDConvertU8ToF32NEON;
+    vlSIMDFunctions.convert_f32_to_f64 = vlSIMDConvertF32ToF64NEON;
+    vlSIMDFunctions.convert_f64_to_f32 = vlSIMDConvertF64ToF32NEON;
+    vlSIMDFunctions.convert_i16_to_i32 = vlSIMDConvertI16ToI32NEON;
+    vlSIMDFunctions.convert_i32_to_i16 = vlSIMDConvertI32ToI16NEON;
+    vlSIMDFunctions.byteswap_u16 = vlSIMDByteSwapU16NEON;
+    vlSIMDFunctions.byteswap_u32 = vlSIMDByteSwapU32NEON;
+    vlSIMDFunctions.byteswap_u64 = vlSIMDByteSwapU64NEON;
+    vlSIMDFunctions.gather_32 = vlSIMDGather32NEON;
+    vlSIMDFunctions.gather_64 = vlSIMDGather64NEON;
+    vlSIMDFunctions.xoshiro_u64 = vlSIMDXoshiroU64NEON;
+    vlSIMDFunctions.xoshiro_f32 = vlSIMDXoshiroF32NEON;
+    vlSIMDFunctions.xoshiro_f64 = vlSIMDXoshiroF64NEON;
     vlSIMDFunctions.backend_name = "NEON (ARMv7)";
 }
@@ -5,6 +5,7 @@
 
 #include <string.h>
 #include <vl/vl_simd.h>
+#include "vl_simd_kernels.h"
 
 static vl_simd_vec4_f32 vlSIMDLoadVec4F32Portable(const vl_float32_t* ptr)
 {
@@ -423,6 +424,508 @@ static void vlSIMDStoreVec32U8Portable(vl_uint8_t* ptr, vl_simd_vec32_u8 v)
     }
 }
 
+static vl_simd_vec16_f32 vlSIMDLoadVec16F32Portable(const vl_float32_t* ptr)
+{
+    vl_simd_vec16_f32 result;
+    memcpy(result.components, ptr, sizeof(result.components));
+    return result;
+}
+
+static void vlSIMDStoreVec16F32Portable(vl_float32_t* ptr, vl_simd_vec16_f32 v)
+{
+    memcpy(ptr, v.components, sizeof(v.components));
+}
+
+static vl_simd_vec16_f32 vlSIMDSplatVec16F32Portable(vl_float32_t scalar)
+{
+    vl_simd_vec16_f32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = scalar;
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDAddVec16F32Portable(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = a.components[i] + b.components[i];
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDSubVec16F32Portable(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = a.components[i] - b.components[i];
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDMulVec16F32Portable(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = a.components[i] * b.components[i];
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDFmaVec16F32Portable(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b, vl_simd_vec16_f32 c)
+{
+    vl_simd_vec16_f32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = a.components[i] * b.components[i] + c.components[i];
+    return result;
+}
+
+static vl_float32_t vlSIMDHsumVec16F32Portable(vl_simd_vec16_f32 v)
+{
+    vl_float32_t sum = 0.0f;
+    for (int i = 0; i < 16; i++)
+        sum += v.components[i];
+    return sum;
+}
+
+static vl_simd_vec16_i32 vlSIMDLoadVec16I32Portable(const vl_int32_t* ptr)
+{
+    vl_simd_vec16_i32 result;
+    memcpy(result.components, ptr, sizeof(result.components));
+    return result;
+}
+
+static void vlSIMDStoreVec16I32Portable(vl_int32_t* ptr, vl_simd_vec16_i32 v)
+{
+    memcpy(ptr, v.components, sizeof(v.components));
+}
+
+static vl_simd_vec16_i32 vlSIMDAddVec16I32Portable(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = (vl_int32_t)((vl_uint32_t)a.components[i] + (vl_uint32_t)b.components[i]);
+    return result;
+}
+
+static vl_simd_vec16_i32 vlSIMDMulVec16I32Portable(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int i = 0; i < 16; i++)
+        result.components[i] = (vl_int32_t)((vl_uint32_t)a.components[i] * (vl_uint32_t)b.components[i]);
+    return result;
+}
+
+static vl_simd_vec64_u8 vlSIMDLoadVec64U8Portable(const vl_uint8_t* ptr)
+{
+    vl_simd_vec64_u8 result;
+    memcpy(result.components, ptr, sizeof(result.components));
+    return result;
+}
+
+static void vlSIMDStoreVec64U8Portable(vl_uint8_t* ptr, vl_simd_vec64_u8 v)
+{
+    memcpy(ptr, v.components, sizeof(v.components));
+}
+
+static vl_uint64_t vlSIMDEqMaskVec64U8Portable(vl_simd_vec64_u8 v, vl_uint8_t byte)
+{
+    vl_uint64_t mask = 0;
+    for (int i = 0; i < 64; i++)
+        mask |= (vl_uint64_t)(v.components[i] == byte) << i;
+    return mask;
+}
+
+/* Sorting networks */
+
+/**
+ * Copies keys into a power-of-two block as signed integers with the same ordering,
+ * padding the tail with INT32_MAX. floatMask is 0x7FFFFFFF for floats and flip is
+ * 0x80000000 for unsigned integers; the mapping is its own inverse.
+ */
+static vl_dsidx_t vlSIMDSortPackPortable(vl_int32_t* block, const vl_uint32_t* keys, vl_dsidx_t count,
+                                         vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_dsidx_t blockSize = 2;
+    while (blockSize < count)
+    {
+        blockSize <<= 1;
+    }
+
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        block[i] = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+    }
+    for (vl_dsidx_t i = count; i < blockSize; i++)
+    {
+        block[i] = 0x7FFFFFFF;
+    }
+    return blockSize;
+}
+
+static void vlSIMDSortUnpackPortable(vl_uint32_t* keys, const vl_int32_t* block, vl_dsidx_t count,
+                                     vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = (vl_uint32_t)block[i] ^ flip;
+        keys[i] = x ^ ((0u - (x >> 31)) & floatMask);
+    }
+}
+
+static void vlSIMDSortNetworkPortable(vl_int32_t* block, vl_dsidx_t n)
+{
+    for (vl_dsidx_t k = 2; k <= n; k <<= 1)
+    {
+        for (vl_dsidx_t j = k >> 1; j > 0; j >>= 1)
+        {
+            /* Direction is fixed across each run of j partners, leaving a loop compilers can vectorize. */
+            for (vl_dsidx_t base = 0; base < n; base += j << 1)
+            {
+                vl_int32_t* lower = (base & k) ? block + base + j : block + base;
+                vl_int32_t* upper = (base & k) ? block + base : block + base + j;
+                for (vl_dsidx_t i = 0; i < j; i++)
+                {
+                    const vl_int32_t a = lower[i], b = upper[i];
+                    lower[i] = a < b ? a : b;
+                    upper[i] = a < b ? b : a;
+                }
+            }
+        }
+    }
+}
+
+static void vlSIMDSortKeysPortable(void* keys, vl_dsidx_t count, vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_int32_t block[VL_SIMD_SORT_NETWORK_MAX];
+    if (count < 2)
+    {
+        return;
+    }
+    const vl_dsidx_t blockSize = vlSIMDSortPackPortable(block, (const vl_uint32_t*)keys, count, floatMask, flip);
+    vlSIMDSortNetworkPortable(block, blockSize);
+    vlSIMDSortUnpackPortable((vl_uint32_t*)keys, block, count, floatMask, flip);
+}
+
+static void vlSIMDSortI32Portable(vl_int32_t* data, vl_dsidx_t count) { vlSIMDSortKeysPortable(data, count, 0, 0); }
+
+static void vlSIMDSortU32Portable(vl_uint32_t* data, vl_dsidx_t count)
+{
+    vlSIMDSortKeysPortable(data, count, 0, 0x80000000u);
+}
+
+static void vlSIMDSortF32Portable(vl_float32_t* data, vl_dsidx_t count)
+{
+    vlSIMDSortKeysPortable(data, count, 0x7FFFFFFFu, 0);
+}
+
+/**
+ * Scalar tail of the rank kernels: counts encoded keys before `encodedKey`.
+ */
+static vl_dsidx_t vlSIMDRankTailPortable(const vl_uint32_t* keys, vl_dsidx_t count, vl_int32_t encodedKey,
+                                         vl_uint32_t floatMask, vl_uint32_t flip, vl_bool_t inclusive)
+{
+    vl_dsidx_t rank = 0;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        const vl_int32_t encoded = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+        rank += inclusive ? encoded <= encodedKey : encoded < encodedKey;
+    }
+    return rank;
+}
+
+static vl_dsidx_t vlSIMDRankKeysPortable(const void* keys, vl_dsidx_t count, vl_uint32_t key, vl_uint32_t floatMask,
+                                         vl_uint32_t flip, vl_bool_t inclusive)
+{
+    const vl_int32_t encodedKey = (vl_int32_t)(key ^ ((0u - (key >> 31)) & floatMask) ^ flip);
+    return vlSIMDRankTailPortable((const vl_uint32_t*)keys, count, encodedKey, floatMask, flip, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankI32Portable(const vl_int32_t* keys, vl_dsidx_t count, vl_int32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysPortable(keys, count, (vl_uint32_t)key, 0, 0, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankU32Portable(const vl_uint32_t* keys, vl_dsidx_t count, vl_uint32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysPortable(keys, count, key, 0, 0x80000000u, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankF32Portable(const vl_float32_t* keys, vl_dsidx_t count, vl_float32_t key,
+                                        vl_bool_t inclusive)
+{
+    vl_uint32_t bits;
+    memcpy(&bits, &key, sizeof(bits));
+    return vlSIMDRankKeysPortable(keys, count, bits, 0x7FFFFFFFu, 0, inclusive);
+}
+
+/* ============================================================================
+ * Array Kernels
+ * ============================================================================
+ */
+
+static vl_float32_t vlSIMDSumF32Portable(const vl_float32_t* data, vl_dsidx_t count)
+{
+    return vlSIMDSumF32Scalar(data, count);
+}
+
+static vl_int64_t vlSIMDSumI32Portable(const vl_int32_t* data, vl_dsidx_t count)
+{
+    return vlSIMDSumI32Scalar(data, count);
+}
+
+static vl_int64_t vlSIMDSumI16Portable(const vl_int16_t* data, vl_dsidx_t count)
+{
+    return vlSIMDSumI16Scalar(data, count);
+}
+
+static vl_uint64_t vlSIMDSumU8Portable(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    return vlSIMDSumU8Scalar(data, count);
+}
+
+static vl_float32_t vlSIMDDotF32Portable(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
+{
+    return vlSIMDDotF32Scalar(a, b, count);
+}
+
+static vl_int64_t vlSIMDDotI32Portable(const vl_int32_t* a, const vl_int32_t* b, vl_dsidx_t count)
+{
+    return vlSIMDDotI32Scalar(a, b, count);
+}
+
+static vl_int64_t vlSIMDDotI16Portable(const vl_int16_t* a, const vl_int16_t* b, vl_dsidx_t count)
+{
+    return vlSIMDDotI16Scalar(a, b, count);
+}
+
+static void vlSIMDAxpyF32Portable(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    vlSIMDAxpyF32Scalar(x, y, count, alpha);
+}
+
+static void vlSIMDAxpyI32Portable(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    vlSIMDAxpyI32Scalar(x, y, count, alpha);
+}
+
+static void vlSIMDScaleF32Portable(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t alpha)
+{
+    vlSIMDScaleF32Scalar(src, dst, count, alpha);
+}
+
+static void vlSIMDScaleI32Portable(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    vlSIMDScaleI32Scalar(src, dst, count, alpha);
+}
+
+static vl_bool_t vlSIMDMinMaxF32Portable(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* outMin,
+                                         vl_float32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_float32_t, vlSIMDMinMaxF32Scalar, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI32Portable(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* outMin,
+                                         vl_int32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int32_t, vlSIMDMinMaxI32Scalar, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI16Portable(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* outMin,
+                                         vl_int16_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int16_t, vlSIMDMinMaxI16Scalar, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxU8Portable(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* outMin,
+                                        vl_uint8_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_uint8_t, vlSIMDMinMaxU8Scalar, data, count, outMin, outMax);
+}
+
+static vl_dsidx_t vlSIMDArgMinF32Portable(const vl_float32_t* data, vl_dsidx_t count)
+{
+    return vlSIMDArgMinF32Scalar(data, count);
+}
+
+static vl_dsidx_t vlSIMDArgMinI32Portable(const vl_int32_t* data, vl_dsidx_t count)
+{
+    return vlSIMDArgMinI32Scalar(data, count);
+}
+
+static vl_dsidx_t vlSIMDArgMinI16Portable(const vl_int16_t* data, vl_dsidx_t count)
+{
+    return vlSIMDArgMinI16Scalar(data, count);
+}
+
+static vl_dsidx_t vlSIMDArgMinU8Portable(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    return vlSIMDArgMinU8Scalar(data, count);
+}
+
+static void vlSIMDClampF32Portable(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t lo,
+                                   vl_float32_t hi)
+{
+    vlSIMDClampF32Scalar(src, dst, count, lo, hi);
+}
+
+static void vlSIMDClampI32Portable(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t lo,
+                                   vl_int32_t hi)
+{
+    vlSIMDClampI32Scalar(src, dst, count, lo, hi);
+}
+
+static void vlSIMDClampI16Portable(const vl_int16_t* src, vl_int16_t* dst, vl_dsidx_t count, vl_int16_t lo,
+                                   vl_int16_t hi)
+{
+    vlSIMDClampI16Scalar(src, dst, count, lo, hi);
+}
+
+static void vlSIMDClampU8Portable(const vl_uint8_t* src, vl_uint8_t* dst, vl_dsidx_t count, vl_uint8_t lo,
+                                  vl_uint8_t hi)
+{
+    vlSIMDClampU8Scalar(src, dst, count, lo, hi);
+}
+
+static void vlSIMDPrefixSumF32Portable(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDPrefixSumF32Scalar(src, dst, count, 0);
+}
+
+static void vlSIMDPrefixSumI32Portable(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDPrefixSumI32Scalar(src, dst, count, 0);
+}
+
+static vl_dsidx_t vlSIMDCompareF32Portable(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t value,
+                                           vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    return vlSIMDCompareF32Scalar(data, count, value, vlSIMDCompareCodeScalar(op), mask);
+}
+
+static vl_dsidx_t vlSIMDCompareI32Portable(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t value,
+                                           vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    return vlSIMDCompareI32Scalar(data, count, value, vlSIMDCompareCodeScalar(op), mask);
+}
+
+static vl_dsidx_t vlSIMDCompareI16Portable(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t value,
+                                           vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    return vlSIMDCompareI16Scalar(data, count, value, vlSIMDCompareCodeScalar(op), mask);
+}
+
+static vl_dsidx_t vlSIMDCompareU8Portable(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value, vl_simd_cmp_op op,
+                                          vl_uint8_t* mask)
+{
+    return vlSIMDCompareU8Scalar(data, count, value, vlSIMDCompareCodeScalar(op), mask);
+}
+
+static vl_dsidx_t vlSIMDFindU8Portable(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    return vlSIMDFindU8Scalar(data, count, value);
+}
+
+static vl_dsidx_t vlSIMDFindLastU8Portable(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    return vlSIMDFindLastU8Scalar(data, count, value);
+}
+
+static vl_dsidx_t vlSIMDFindAnyU8Portable(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                          vl_dsidx_t setCount)
+{
+    return vlSIMDFindAnyU8Scalar(data, count, set, setCount);
+}
+
+static vl_dsidx_t vlSIMDCountU8Portable(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    return vlSIMDCountU8Scalar(data, count, value);
+}
+
+static vl_bool_t vlSIMDEqualU8Portable(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    return vlSIMDEqualU8Scalar(a, b, count);
+}
+
+static void vlSIMDConvertF32ToHalfPortable(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF32ToHalfScalar(src, dst, count);
+}
+
+static void vlSIMDConvertHalfToF32Portable(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertHalfToF32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertI32ToF32Portable(const vl_int32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertI32ToF32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertF32ToI32Portable(const vl_float32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF32ToI32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertI16ToF32Portable(const vl_int16_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertI16ToF32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertU8ToF32Portable(const vl_uint8_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertU8ToF32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertF32ToF64Portable(const vl_float32_t* src, vl_float64_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF32ToF64Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertF64ToF32Portable(const vl_float64_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertF64ToF32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertI16ToI32Portable(const vl_int16_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertI16ToI32Scalar(src, dst, count);
+}
+
+static void vlSIMDConvertI32ToI16Portable(const vl_int32_t* src, vl_int16_t* dst, vl_dsidx_t count)
+{
+    vlSIMDConvertI32ToI16Scalar(src, dst, count);
+}
+
+static void vlSIMDByteSwapU16Portable(vl_uint16_t* data, vl_dsidx_t count) { vlSIMDByteSwapU16Scalar(data, count); }
+
+static void vlSIMDByteSwapU32Portable(vl_uint32_t* data, vl_dsidx_t count) { vlSIMDByteSwapU32Scalar(data, count); }
+
+static void vlSIMDByteSwapU64Portable(vl_uint64_t* data, vl_dsidx_t count) { vlSIMDByteSwapU64Scalar(data, count); }
+
+static void vlSIMDGather32Portable(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDGather32Scalar(src, srcStride, dst, count);
+}
+
+static void vlSIMDGather64Portable(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDGather64Scalar(src, srcStride, dst, count);
+}
+
+static void vlSIMDXoshiroU64Portable(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    vlSIMDXoshiroU64Scalar(state, dst, blocks);
+}
+
+static void vlSIMDXoshiroF32Portable(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    vlSIMDXoshiroF32Scalar(state, dst, blocks);
+}
+
+static void vlSIMDXoshiroF64Portable(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    vlSIMDXoshiroF64Scalar(state, dst, blocks);
+}
+
 static void vlSIMDInitPortable(void)
 {
     vlSIMDFunctions.load_vec4f32 = vlSIMDLoadVec4F32Portable;
@@ -469,5 +972,78 @@ static void vlSIMDInitPortable(void)
     vlSIMDFunctions.add_vec8i16 = vlSIMDAddVec8I16Portable;
     vlSIMDFunctions.load_vec32u8 = vlSIMDLoadVec32U8Portable;
     vlSIMDFunctions.store_vec32u8 = vlSIMDStoreVec32U8Portable;
+    vlSIMDFunctions.load_vec16f32 = vlSIMDLoadVec16F32Portable;
+    vlSIMDFunctions.store_vec16f32 = vlSIMDStoreVec16F32Portable;
+    vlSIMDFunctions.splat_vec16f32 = vlSIMDSplatVec16F32Portable;
+    vlSIMDFunctions.add_vec16f32 = vlSIMDAddVec16F32Portable;
+    vlSIMDFunctions.sub_vec16f32 = vlSIMDSubVec16F32Portable;
+    vlSIMDFunctions.mul_vec16f32 = vlSIMDMulVec16F32Portable;
+    vlSIMDFunctions.fma_vec16f32 = vlSIMDFmaVec16F32Portable;
+    vlSIMDFunctions.hsum_vec16f32 = vlSIMDHsumVec16F32Portable;
+    vlSIMDFunctions.load_vec16i32 = vlSIMDLoadVec16I32Portable;
+    vlSIMDFunctions.store_vec16i32 = vlSIMDStoreVec16I32Portable;
+    vlSIMDFunctions.add_vec16i32 = vlSIMDAddVec16I32Portable;
+    vlSIMDFunctions.mul_vec16i32 = vlSIMDMulVec16I32Portable;
+    vlSIMDFunctions.load_vec64u8 = vlSIMDLoadVec64U8Portable;
+    vlSIMDFunctions.store_vec64u8 = vlSIMDStoreVec64U8Portable;
+    vlSIMDFunctions.eqmask_vec64u8 = vlSIMDEqMaskVec64U8Portable;
+    vlSIMDFunctions.sort_i32 = vlSIMDSortI32Portable;
+    vlSIMDFunctions.sort_u32 = vlSIMDSortU32Portable;
+    vlSIMDFunctions.sort_f32 = vlSIMDSortF32Portable;
+    vlSIMDFunctions.rank_i32 = vlSIMDRankI32Portable;
+    vlSIMDFunctions.rank_u32 = vlSIMDRankU32Portable;
+    vlSIMDFunctions.rank_f32 = vlSIMDRankF32Portable;
+    vlSIMDFunctions.sum_f32 = vlSIMDSumF32Portable;
+    vlSIMDFunctions.sum_i32 = vlSIMDSumI32Portable;
+    vlSIMDFunctions.sum_i16 = vlSIMDSumI16Portable;
+    vlSIMDFunctions.sum_u8 = vlSIMDSumU8Portable;
+    vlSIMDFunctions.dot_f32 = vlSIMDDotF32Portable;
+    vlSIMDFunctions.dot_i32 = vlSIMDDotI32Portable;
+    vlSIMDFunctions.dot_i16 = vlSIMDDotI16Portable;
+    vlSIMDFunctions.axpy_f32 = vlSIMDAxpyF32Portable;
+    vlSIMDFunctions.axpy_i32 = vlSIMDAxpyI32Portable;
+    vlSIMDFunctions.scale_f32 = vlSIMDScaleF32Portable;
+    vlSIMDFunctions.scale_i32 = vlSIMDScaleI32Portable;
+    vlSIMDFunctions.minmax_f32 = vlSIMDMinMaxF32Portable;
+    vlSIMDFunctions.minmax_i32 = vlSIMDMinMaxI32Portable;
+    vlSIMDFunctions.minmax_i16 = vlSIMDMinMaxI16Portable;
+    vlSIMDFunctions.minmax_u8 = vlSIMDMinMaxU8Portable;
+    vlSIMDFunctions.argmin_f32 = vlSIMDArgMinF32Portable;
+    vlSIMDFunctions.argmin_i32 = vlSIMDArgMinI32Portable;
+    vlSIMDFunctions.argmin_i16 = vlSIMDArgMinI16Portable;
+    vlSIMDFunctions.argmin_u8 = vlSIMDArgMinU8Portable;
+    vlSIMDFunctions.clamp_f32 = vlSIMDClampF32Portable;
+    vlSIMDFunctions.clamp_i32 = vlSIMDClampI32Portable;
+    vlSIMDFunctions.clamp_i16 = vlSIMDClampI16Portable;
+    vlSIMDFunctions.clamp_u8 = vlSIMDClampU8Portable;
+    vlSIMDFunctions.prefix_sum_f32 = vlSIMDPrefixSumF32Portable;
+    vlSIMDFunctions.prefix_sum_i32 = vlSIMDPrefixSumI32Portable;
+    vlSIMDFunctions.compare_f32 = vlSIMDCompareF32Portable;
+    vlSIMDFunctions.compare_i32 = vlSIMDCompareI32Portable;
+    vlSIMDFunctions.compare_i16 = vlSIMDCompareI16Portable;
+    vlSIMDFunctions.compare_u8 = vlSIMDCompareU8Portable;
+    vlSIMDFunctions.find_u8 = vlSIMDFindU8Portable;
+    vlSIMDFunctions.find_last_u8 = vlSIMDFindLastU8Portable;
+    vlSIMDFunctions.find_any_u8 = vlSIMDFindAnyU8Portable;
+    vlSIMDFunctions.count_u8 = vlSIMDCountU8Portable;
+    vlSIMDFunctions.equal_u8 = vlSIMDEqualU8Portable;
+    vlSIMDFunctions.convert_f32_to_half = vlSIMDConvertF32ToHalfPortable;
+    vlSIMDFunctions.convert_half_to_f32 = vlSIMDConvertHalfToF32Portable;
+    vlSIMDFunctions.convert_i32_to_f32 = vlSIMDConvertI32ToF32Portable;
+    vlSIMDFunctions.convert_f32_to_i32 = vlSIMDConvertF32ToI32Portable;
+    vlSIMDFunctions.convert_i16_to_f32 = vlSIMDConvertI16ToF32Portable;
+    vlSIMDFunctions.convert_u8_to_f32 = vlSIMDConvertU8ToF32Portable;
+    vlSIMDFunctions.convert_f32_to_f64 = vlSIMDConvertF32ToF64Portable;
+    vlSIMDFunctions.convert_f64_to_f32 = vlSIMDConvertF64ToF32Portable;
+    vlSIMDFunctions.convert_i16_to_i32 = vlSIMDConvertI16ToI32Portable;
+    vlSIMDFunctions.convert_i32_to_i16 = vlSIMDConvertI32ToI16Portable;
+    vlSIMDFunctions.byteswap_u16 = vlSIMDByteSwapU16Portable;
+    vlSIMDFunctions.byteswap_u32 = vlSIMDByteSwapU32Portable;
+    vlSIMDFunctions.byteswap_u64 = vlSIMDByteSwapU64Portable;
+    vlSIMDFunctions.gather_32 = vlSIMDGather32Portable;
+    vlSIMDFunctions.gather_64 = vlSIMDGather64Portable;
+    vlSIMDFunctions.xoshiro_u64 = vlSIMDXoshiroU64Portable;
+    vlSIMDFunctions.xoshiro_f32 = vlSIMDXoshiroF32Portable;
+    vlSIMDFunctions.xoshiro_f64 = vlSIMDXoshiroF64Portable;
     vlSIMDFunctions.backend_name = "Portable C";
 }
@@ -10,7 +10,9 @@
 
 #include <emmintrin.h>
 #include <string.h>
+#include <vl/vl_algo.h>
 #include <vl/vl_simd.h>
+#include "vl_simd_kernels.h"
 
 /* ============================================================================
  * 4-Wide Float32 Operations
@@ -466,12 +468,1532 @@ static vl_simd_vec8_f32 vlSIMDFmaVec8F32SSE2(vl_simd_vec8_f32 a, vl_simd_vec8_f3
     return result;
 }
 
+/* ============================================================================
+ * Sorting Networks
+ * ============================================================================
+ */
+
+/**
+ * Copies keys into a power-of-two block of at least 4 signed integers with the
+ * same ordering, padding the tail with INT32_MAX. floatMask is 0x7FFFFFFF for
+ * floats and flip is 0x80000000 for unsigned integers; the mapping is its own
+ * inverse.
+ */
+static vl_dsidx_t vlSIMDSortPackSSE2(vl_int32_t* block, const vl_uint32_t* keys, vl_dsidx_t count,
+                                     vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_dsidx_t blockSize = 4;
+    while (blockSize < count)
+    {
+        blockSize <<= 1;
+    }
+
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        block[i] = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+    }
+    for (vl_dsidx_t i = count; i < blockSize; i++)
+    {
+        block[i] = 0x7FFFFFFF;
+    }
+    return blockSize;
+}
+
+static void vlSIMDSortUnpackSSE2(vl_uint32_t* keys, const vl_int32_t* block, vl_dsidx_t count,
+                                 vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = (vl_uint32_t)block[i] ^ flip;
+        keys[i] = x ^ ((0u - (x >> 31)) & floatMask);
+    }
+}
+
+/**
+ * Compare-exchanges each lane with its partner `p`, keeping the maximum in
+ * lanes set in `takeMax` and the minimum elsewhere. SSE2 has no 32-bit
+ * min/max, so the choice is made from a single comparison.
+ */
+static inline __m128i vlSIMDSortStepSSE2(__m128i v, __m128i p, __m128i takeMax)
+{
+    const __m128i takePartner = _mm_xor_si128(_mm_cmpgt_epi32(v, p), takeMax);
+    return _mm_or_si128(_mm_and_si128(takePartner, p), _mm_andnot_si128(takePartner, v));
+}
+
+/**
+ * Runs the in-register steps (partner distance 2, 1) of one bitonic merge
+ * stage, with `dir` set in lanes that merge in descending order.
+ */
+static inline __m128i vlSIMDSortMergeLanesSSE2(__m128i v, __m128i dir, __m128i bit2, __m128i bit1)
+{
+    v = vlSIMDSortStepSSE2(v, _mm_shuffle_epi32(v, 0x4E), _mm_xor_si128(bit2, dir));
+    return vlSIMDSortStepSSE2(v, _mm_shuffle_epi32(v, 0xB1), _mm_xor_si128(bit1, dir));
+}
+
+static void vlSIMDSortNetworkSSE2(vl_int32_t* block, vl_dsidx_t n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_cmpeq_epi32(zero, zero);
+    const __m128i bit1 = _mm_setr_epi32(0, -1, 0, -1);
+    const __m128i bit2 = _mm_setr_epi32(0, 0, -1, -1);
+
+    /* Stages 2 and 4 sort each vector on its own, alternating direction. */
+    for (vl_dsidx_t i = 0; i < n; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(block + i));
+        v = vlSIMDSortStepSSE2(v, _mm_shuffle_epi32(v, 0xB1), _mm_xor_si128(bit1, bit2));
+        v = vlSIMDSortMergeLanesSSE2(v, (i & 4) ? ones : zero, bit2, bit1);
+        _mm_storeu_si128((__m128i*)(block + i), v);
+    }
+
+    for (vl_dsidx_t k = 8; k <= n; k <<= 1)
+    {
+        /* Partners at least one vector apart: whole vectors compare-exchange. */
+        for (vl_dsidx_t j = k >> 1; j >= 4; j >>= 1)
+        {
+            for (vl_dsidx_t base = 0; base < n; base += j << 1)
+            {
+                for (vl_dsidx_t i = base; i < base + j; i += 4)
+                {
+                    const __m128i a = _mm_loadu_si128((const __m128i*)(block + i));
+                    const __m128i b = _mm_loadu_si128((const __m128i*)(block + i + j));
+                    const __m128i swap = _mm_xor_si128(_mm_cmpgt_epi32(a, b), (i & k) ? ones : zero);
+                    const __m128i delta = _mm_and_si128(_mm_xor_si128(a, b), swap);
+                    _mm_storeu_si128((__m128i*)(block + i), _mm_xor_si128(a, delta));
+                    _mm_storeu_si128((__m128i*)(block + i + j), _mm_xor_si128(b, delta));
+                }
+            }
+        }
+
+        for (vl_dsidx_t i = 0; i < n; i += 4)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(block + i));
+            v = vlSIMDSortMergeLanesSSE2(v, (i & k) ? ones : zero, bit2, bit1);
+            _mm_storeu_si128((__m128i*)(block + i), v);
+        }
+    }
+}
+
+static void vlSIMDSortKeysSSE2(void* keys, vl_dsidx_t count, vl_uint32_t floatMask, vl_uint32_t flip)
+{
+    vl_int32_t block[VL_SIMD_SORT_NETWORK_MAX];
+    if (count < 2)
+    {
+        return;
+    }
+    const vl_dsidx_t blockSize = vlSIMDSortPackSSE2(block, (const vl_uint32_t*)keys, count, floatMask, flip);
+    vlSIMDSortNetworkSSE2(block, blockSize);
+    vlSIMDSortUnpackSSE2((vl_uint32_t*)keys, block, count, floatMask, flip);
+}
+
+static void vlSIMDSortI32SSE2(vl_int32_t* data, vl_dsidx_t count) { vlSIMDSortKeysSSE2(data, count, 0, 0); }
+
+static void vlSIMDSortU32SSE2(vl_uint32_t* data, vl_dsidx_t count) { vlSIMDSortKeysSSE2(data, count, 0, 0x80000000u); }
+
+static void vlSIMDSortF32SSE2(vl_float32_t* data, vl_dsidx_t count)
+{
+    vlSIMDSortKeysSSE2(data, count, 0x7FFFFFFFu, 0);
+}
+
+/**
+ * Scalar tail of the rank kernels: counts encoded keys before `encodedKey`.
+ */
+static vl_dsidx_t vlSIMDRankTailSSE2(const vl_uint32_t* keys, vl_dsidx_t count, vl_int32_t encodedKey,
+                                     vl_uint32_t floatMask, vl_uint32_t flip, vl_bool_t inclusive)
+{
+    vl_dsidx_t rank = 0;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        const vl_int32_t encoded = (vl_int32_t)(x ^ ((0u - (x >> 31)) & floatMask) ^ flip);
+        rank += inclusive ? encoded <= encodedKey : encoded < encodedKey;
+    }
+    return rank;
+}
+
+/**
+ * Counts keys before `key`, comparing four keys per step after mapping them
+ * to order-preserving signed integers in-register.
+ */
+static vl_dsidx_t vlSIMDRankKeysSSE2(const void* keys, vl_dsidx_t count, vl_uint32_t key, vl_uint32_t floatMask,
+                                     vl_uint32_t flip, vl_bool_t inclusive)
+{
+    const vl_uint32_t* src = (const vl_uint32_t*)keys;
+    const vl_int32_t encodedKey = (vl_int32_t)(key ^ ((0u - (key >> 31)) & floatMask) ^ flip);
+    const __m128i vKey = _mm_set1_epi32(encodedKey);
+    const __m128i vFloat = _mm_set1_epi32((vl_int32_t)floatMask);
+    const __m128i vFlip = _mm_set1_epi32((vl_int32_t)flip);
+    __m128i counts = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        v = _mm_xor_si128(_mm_xor_si128(v, _mm_and_si128(_mm_srai_epi32(v, 31), vFloat)), vFlip);
+        /* Each matching lane is -1, so subtracting the mask counts it. */
+        counts = _mm_sub_epi32(counts, inclusive ? _mm_cmpgt_epi32(v, vKey) : _mm_cmpgt_epi32(vKey, v));
+    }
+
+    counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, 0x4E));
+    counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, 0xB1));
+    const vl_dsidx_t vectorCount = (vl_dsidx_t)(vl_uint32_t)_mm_cvtsi128_si32(counts);
+
+    /* Inclusive ranks count the greater keys and take the complement. */
+    return (inclusive ? i - vectorCount : vectorCount) +
+        vlSIMDRankTailSSE2(src + i, count - i, encodedKey, floatMask, flip, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankI32SSE2(const vl_int32_t* keys, vl_dsidx_t count, vl_int32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysSSE2(keys, count, (vl_uint32_t)key, 0, 0, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankU32SSE2(const vl_uint32_t* keys, vl_dsidx_t count, vl_uint32_t key, vl_bool_t inclusive)
+{
+    return vlSIMDRankKeysSSE2(keys, count, key, 0, 0x80000000u, inclusive);
+}
+
+static vl_dsidx_t vlSIMDRankF32SSE2(const vl_float32_t* keys, vl_dsidx_t count, vl_float32_t key,
+                                    vl_bool_t inclusive)
+{
+    vl_uint32_t bits;
+    memcpy(&bits, &key, sizeof(bits));
+    return vlSIMDRankKeysSSE2(keys, count, bits, 0x7FFFFFFFu, 0, inclusive);
+}
+
+/* ============================================================================
+ * Array Kernels
+ * ============================================================================
+ */
+
+/**
+ * Low 32 bits of a 4-wide 32-bit multiply, built from the two 32x32->64
+ * multiplies SSE2 does have.
+ */
+static inline __m128i vlSIMDMulLoI32SSE2(__m128i a, __m128i b)
+{
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+}
+
+static inline __m128i vlSIMDMinI32SSE2(__m128i a, __m128i b)
+{
+    const __m128i aGreater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+}
+
+static inline __m128i vlSIMDMaxI32SSE2(__m128i a, __m128i b)
+{
+    const __m128i aGreater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+}
+
+/**
+ * Adds signed 32-bit lanes to a pair of 64-bit accumulators. `sign` holds the
+ * upper halves, normally `_mm_srai_epi32(v, 31)`.
+ */
+static inline __m128i vlSIMDAccumulateI64SSE2(__m128i acc, __m128i v, __m128i sign)
+{
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+    return _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+}
+
+static inline vl_uint64_t vlSIMDHsumU64SSE2(__m128i acc)
+{
+    vl_uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    return lanes[0] + lanes[1];
+}
+
+static inline vl_float32_t vlSIMDHsumF32SSE2(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 0x55));
+    return _mm_cvtss_f32(v);
+}
+
+static vl_float32_t vlSIMDSumF32SSE2(const vl_float32_t* data, vl_dsidx_t count)
+{
+    __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_loadu_ps(data + i));
+        acc1 = _mm_add_ps(acc1, _mm_loadu_ps(data + i + 4));
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_loadu_ps(data + i));
+    }
+    return vlSIMDHsumF32SSE2(_mm_add_ps(acc0, acc1)) + vlSIMDSumF32Scalar(data + i, count - i);
+}
+
+static vl_int64_t vlSIMDSumI32SSE2(const vl_int32_t* data, vl_dsidx_t count)
+{
+    __m128i acc = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        acc = vlSIMDAccumulateI64SSE2(acc, v, _mm_srai_epi32(v, 31));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64SSE2(acc) + (vl_uint64_t)vlSIMDSumI32Scalar(data + i, count - i));
+}
+
+static vl_int64_t vlSIMDSumI16SSE2(const vl_int16_t* data, vl_dsidx_t count)
+{
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i acc = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        /* Pairwise sums of 16-bit values always fit in 32 bits. */
+        const __m128i pairs = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(data + i)), ones);
+        acc = vlSIMDAccumulateI64SSE2(acc, pairs, _mm_srai_epi32(pairs, 31));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64SSE2(acc) + (vl_uint64_t)vlSIMDSumI16Scalar(data + i, count - i));
+}
+
+static vl_uint64_t vlSIMDSumU8SSE2(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(data + i)), zero));
+    }
+    return vlSIMDHsumU64SSE2(acc) + vlSIMDSumU8Scalar(data + i, count - i);
+}
+
+static vl_float32_t vlSIMDDotF32SSE2(const vl_float32_t* a, const vl_float32_t* b, vl_dsidx_t count)
+{
+    __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    return vlSIMDHsumF32SSE2(_mm_add_ps(acc0, acc1)) + vlSIMDDotF32Scalar(a + i, b + i, count - i);
+}
+
+/**
+ * Signed 64-bit products of the even lanes. The unsigned product is off by
+ * 2^32 times the other operand for each negative operand, which is removed
+ * from the upper half.
+ */
+static inline __m128i vlSIMDMulEvenI32SSE2(__m128i a, __m128i b)
+{
+    const __m128i product = _mm_mul_epu32(a, b);
+    const __m128i fix =
+        _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi64(product, _mm_slli_epi64(fix, 32));
+}
+
+static vl_int64_t vlSIMDDotI32SSE2(const vl_int32_t* a, const vl_int32_t* b, vl_dsidx_t count)
+{
+    __m128i acc = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        const __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+        acc = _mm_add_epi64(acc, vlSIMDMulEvenI32SSE2(va, vb));
+        acc = _mm_add_epi64(acc, vlSIMDMulEvenI32SSE2(_mm_srli_epi64(va, 32), _mm_srli_epi64(vb, 32)));
+    }
+    return (vl_int64_t)(vlSIMDHsumU64SSE2(acc) + (vl_uint64_t)vlSIMDDotI32Scalar(a + i, b + i, count - i));
+}
+
+static vl_int64_t vlSIMDDotI16SSE2(const vl_int16_t* a, const vl_int16_t* b, vl_dsidx_t count)
+{
+    const __m128i intMin = _mm_set1_epi32((vl_int32_t)0x80000000u);
+    __m128i acc = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i pairs =
+            _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i)));
+        /* A pair sum of exactly 2^31 (both products -32768 * -32768) wraps to INT_MIN; widen it as unsigned. */
+        const __m128i sign = _mm_andnot_si128(_mm_cmpeq_epi32(pairs, intMin), _mm_srai_epi32(pairs, 31));
+        acc = vlSIMDAccumulateI64SSE2(acc, pairs, sign);
+    }
+    return (vl_int64_t)(vlSIMDHsumU64SSE2(acc) + (vl_uint64_t)vlSIMDDotI16Scalar(a + i, b + i, count - i));
+}
+
+static void vlSIMDAxpyF32SSE2(const vl_float32_t* x, vl_float32_t* y, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const __m128 va = _mm_set1_ps(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(va, _mm_loadu_ps(x + i))));
+    }
+    vlSIMDAxpyF32Scalar(x + i, y + i, count - i, alpha);
+}
+
+static void vlSIMDAxpyI32SSE2(const vl_int32_t* x, vl_int32_t* y, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const __m128i va = _mm_set1_epi32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i product = vlSIMDMulLoI32SSE2(va, _mm_loadu_si128((const __m128i*)(x + i)));
+        _mm_storeu_si128((__m128i*)(y + i), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(y + i)), product));
+    }
+    vlSIMDAxpyI32Scalar(x + i, y + i, count - i, alpha);
+}
+
+static void vlSIMDScaleF32SSE2(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t alpha)
+{
+    const __m128 va = _mm_set1_ps(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_mul_ps(va, _mm_loadu_ps(src + i)));
+    }
+    vlSIMDScaleF32Scalar(src + i, dst + i, count - i, alpha);
+}
+
+static void vlSIMDScaleI32SSE2(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t alpha)
+{
+    const __m128i va = _mm_set1_epi32(alpha);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), vlSIMDMulLoI32SSE2(va, _mm_loadu_si128((const __m128i*)(src + i))));
+    }
+    vlSIMDScaleI32Scalar(src + i, dst + i, count - i, alpha);
+}
+
+/**
+ * Folds full vectors into lane-wise minimum and maximum registers, then
+ * reduces the lanes and the tail with the scalar kernel.
+ */
+static void vlSIMDMinMaxFoldF32SSE2(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* min, vl_float32_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 4)
+    {
+        __m128 lo = _mm_set1_ps(*min), hi = _mm_set1_ps(*max);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 v = _mm_loadu_ps(data + i);
+            lo = _mm_min_ps(lo, v);
+            hi = _mm_max_ps(hi, v);
+        }
+        vl_float32_t lanes[4];
+        _mm_storeu_ps(lanes, lo);
+        vlSIMDMinMaxF32Scalar(lanes, 4, min, max);
+        _mm_storeu_ps(lanes, hi);
+        vlSIMDMinMaxF32Scalar(lanes, 4, min, max);
+    }
+    vlSIMDMinMaxF32Scalar(data + i, count - i, min, max);
+}
+
+static void vlSIMDMinMaxFoldI32SSE2(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* min, vl_int32_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 4)
+    {
+        __m128i lo = _mm_set1_epi32(*min), hi = _mm_set1_epi32(*max);
+        __m128i lo2 = lo, hi2 = hi;
+        /* Emulated min/max take three dependent steps, so two register pairs keep both ALUs busy. */
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+            const __m128i w = _mm_loadu_si128((const __m128i*)(data + i + 4));
+            lo = vlSIMDMinI32SSE2(lo, v);
+            hi = vlSIMDMaxI32SSE2(hi, v);
+            lo2 = vlSIMDMinI32SSE2(lo2, w);
+            hi2 = vlSIMDMaxI32SSE2(hi2, w);
+        }
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+            lo = vlSIMDMinI32SSE2(lo, v);
+            hi = vlSIMDMaxI32SSE2(hi, v);
+        }
+        lo = vlSIMDMinI32SSE2(lo, lo2);
+        hi = vlSIMDMaxI32SSE2(hi, hi2);
+        vl_int32_t lanes[4];
+        _mm_storeu_si128((__m128i*)lanes, lo);
+        vlSIMDMinMaxI32Scalar(lanes, 4, min, max);
+        _mm_storeu_si128((__m128i*)lanes, hi);
+        vlSIMDMinMaxI32Scalar(lanes, 4, min, max);
+    }
+    vlSIMDMinMaxI32Scalar(data + i, count - i, min, max);
+}
+
+static void vlSIMDMinMaxFoldI16SSE2(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* min, vl_int16_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 8)
+    {
+        __m128i lo = _mm_set1_epi16(*min), hi = _mm_set1_epi16(*max);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+            lo = _mm_min_epi16(lo, v);
+            hi = _mm_max_epi16(hi, v);
+        }
+        vl_int16_t lanes[8];
+        _mm_storeu_si128((__m128i*)lanes, lo);
+        vlSIMDMinMaxI16Scalar(lanes, 8, min, max);
+        _mm_storeu_si128((__m128i*)lanes, hi);
+        vlSIMDMinMaxI16Scalar(lanes, 8, min, max);
+    }
+    vlSIMDMinMaxI16Scalar(data + i, count - i, min, max);
+}
+
+static void vlSIMDMinMaxFoldU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* min, vl_uint8_t* max)
+{
+    vl_dsidx_t i = 0;
+    if (count >= 16)
+    {
+        __m128i lo = _mm_set1_epi8((char)*min), hi = _mm_set1_epi8((char)*max);
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+            lo = _mm_min_epu8(lo, v);
+            hi = _mm_max_epu8(hi, v);
+        }
+        vl_uint8_t lanes[16];
+        _mm_storeu_si128((__m128i*)lanes, lo);
+        vlSIMDMinMaxU8Scalar(lanes, 16, min, max);
+        _mm_storeu_si128((__m128i*)lanes, hi);
+        vlSIMDMinMaxU8Scalar(lanes, 16, min, max);
+    }
+    vlSIMDMinMaxU8Scalar(data + i, count - i, min, max);
+}
+
+static vl_bool_t vlSIMDMinMaxF32SSE2(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t* outMin,
+                                     vl_float32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_float32_t, vlSIMDMinMaxFoldF32SSE2, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI32SSE2(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t* outMin,
+                                     vl_int32_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int32_t, vlSIMDMinMaxFoldI32SSE2, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxI16SSE2(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t* outMin,
+                                     vl_int16_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_int16_t, vlSIMDMinMaxFoldI16SSE2, data, count, outMin, outMax);
+}
+
+static vl_bool_t vlSIMDMinMaxU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t* outMin,
+                                    vl_uint8_t* outMax)
+{
+    VL_SIMD_MINMAX_WRAP(vl_uint8_t, vlSIMDMinMaxFoldU8SSE2, data, count, outMin, outMax);
+}
+
+/*
+ * Arg-min runs in two passes: a vector reduction finds the minimum, then a
+ * vector scan stops at the first block holding it. Both passes are branch-light
+ * and stream through memory, which beats tracking indices per lane. If the
+ * minimum is never found again (only possible with NaN), index 0 is returned.
+ */
+
+static vl_dsidx_t vlSIMDArgMinF32SSE2(const vl_float32_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_float32_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldF32SSE2(data, count, &min, &max);
+
+    const __m128 target = _mm_set1_ps(min);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        if (_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), target)))
+        {
+            break;
+        }
+    }
+    i += vlSIMDFindF32Scalar(data + i, count - i, min);
+    return i < count ? i : 0;
+}
+
+static vl_dsidx_t vlSIMDArgMinI32SSE2(const vl_int32_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_int32_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldI32SSE2(data, count, &min, &max);
+
+    const __m128i target = _mm_set1_epi32(min);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), target)))
+        {
+            break;
+        }
+    }
+    return i + vlSIMDFindI32Scalar(data + i, count - i, min);
+}
+
+static vl_dsidx_t vlSIMDArgMinI16SSE2(const vl_int16_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_int16_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldI16SSE2(data, count, &min, &max);
+
+    const __m128i target = _mm_set1_epi16(min);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(data + i)), target)))
+        {
+            break;
+        }
+    }
+    return i + vlSIMDFindI16Scalar(data + i, count - i, min);
+}
+
+static vl_dsidx_t vlSIMDArgMinU8SSE2(const vl_uint8_t* data, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return VL_STRUCTURE_INDEX_MAX;
+    }
+    vl_uint8_t min = data[0], max = data[0];
+    vlSIMDMinMaxFoldU8SSE2(data, count, &min, &max);
+
+    const __m128i target = _mm_set1_epi8((char)min);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i)), target)))
+        {
+            break;
+        }
+    }
+    return i + vlSIMDFindU8Scalar(data + i, count - i, min);
+}
+
+static void vlSIMDClampF32SSE2(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count, vl_float32_t lo,
+                               vl_float32_t hi)
+{
+    const __m128 vLo = _mm_set1_ps(lo), vHi = _mm_set1_ps(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), vLo), vHi));
+    }
+    vlSIMDClampF32Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+static void vlSIMDClampI32SSE2(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count, vl_int32_t lo,
+                               vl_int32_t hi)
+{
+    const __m128i vLo = _mm_set1_epi32(lo), vHi = _mm_set1_epi32(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), vlSIMDMinI32SSE2(vlSIMDMaxI32SSE2(v, vLo), vHi));
+    }
+    vlSIMDClampI32Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+static void vlSIMDClampI16SSE2(const vl_int16_t* src, vl_int16_t* dst, vl_dsidx_t count, vl_int16_t lo,
+                               vl_int16_t hi)
+{
+    const __m128i vLo = _mm_set1_epi16(lo), vHi = _mm_set1_epi16(hi);
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_min_epi16(_mm_max_epi16(v, vLo), vHi));
+    }
+    vlSIMDClampI16Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+static void vlSIMDClampU8SSE2(const vl_uint8_t* src, vl_uint8_t* dst, vl_dsidx_t count, vl_uint8_t lo,
+                              vl_uint8_t hi)
+{
+    const __m128i vLo = _mm_set1_epi8((char)lo), vHi = _mm_set1_epi8((char)hi);
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_min_epu8(_mm_max_epu8(v, vLo), vHi));
+    }
+    vlSIMDClampU8Scalar(src + i, dst + i, count - i, lo, hi);
+}
+
+/**
+ * Prefix sums scan each vector with two shifted adds (log2 of four lanes),
+ * then add the running total carried over from the previous vector.
+ */
+static void vlSIMDPrefixSumF32SSE2(const vl_float32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    __m128 carry = _mm_setzero_ps();
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 v = _mm_loadu_ps(src + i);
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+        v = _mm_add_ps(v, carry);
+        _mm_storeu_ps(dst + i, v);
+        carry = _mm_shuffle_ps(v, v, 0xFF);
+    }
+    vlSIMDPrefixSumF32Scalar(src + i, dst + i, count - i, _mm_cvtss_f32(carry));
+}
+
+static void vlSIMDPrefixSumI32SSE2(const vl_int32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    __m128i carry = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi32(v, carry);
+        _mm_storeu_si128((__m128i*)(dst + i), v);
+        carry = _mm_shuffle_epi32(v, 0xFF);
+    }
+    vlSIMDPrefixSumI32Scalar(src + i, dst + i, count - i, _mm_cvtsi128_si32(carry));
+}
+
+/**
+ * Compare kernels evaluate less, equal and greater for every lane and keep the
+ * ones selected by the compare code, so a single loop serves every operator.
+ */
+static inline __m128i vlSIMDCompareSelectSSE2(vl_uint32_t code, vl_uint32_t bit)
+{
+    return _mm_set1_epi32((code & bit) ? -1 : 0);
+}
+
+static vl_dsidx_t vlSIMDCompareF32SSE2(const vl_float32_t* data, vl_dsidx_t count, vl_float32_t value,
+                                       vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m128 wantLt = _mm_castsi128_ps(vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_LT));
+    const __m128 wantEq = _mm_castsi128_ps(vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_EQ));
+    const __m128 wantGt = _mm_castsi128_ps(vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_GT));
+    const int invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFF : 0;
+    const __m128 v = _mm_set1_ps(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128 a = _mm_loadu_ps(data + i), b = _mm_loadu_ps(data + i + 4);
+        const __m128 hitA = _mm_or_ps(_mm_or_ps(_mm_and_ps(_mm_cmplt_ps(a, v), wantLt),
+                                                _mm_and_ps(_mm_cmpeq_ps(a, v), wantEq)),
+                                      _mm_and_ps(_mm_cmpgt_ps(a, v), wantGt));
+        const __m128 hitB = _mm_or_ps(_mm_or_ps(_mm_and_ps(_mm_cmplt_ps(b, v), wantLt),
+                                                _mm_and_ps(_mm_cmpeq_ps(b, v), wantEq)),
+                                      _mm_and_ps(_mm_cmpgt_ps(b, v), wantGt));
+        const vl_uint32_t byte = (vl_uint32_t)((_mm_movemask_ps(hitA) | (_mm_movemask_ps(hitB) << 4)) ^ invert);
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareF32Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareI32SSE2(const vl_int32_t* data, vl_dsidx_t count, vl_int32_t value,
+                                       vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m128i wantLt = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_LT);
+    const __m128i wantEq = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_EQ);
+    const __m128i wantGt = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_GT);
+    const int invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFF : 0;
+    const __m128i v = _mm_set1_epi32(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(data + i + 4));
+        const __m128i hitA = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmplt_epi32(a, v), wantLt),
+                                                       _mm_and_si128(_mm_cmpeq_epi32(a, v), wantEq)),
+                                          _mm_and_si128(_mm_cmpgt_epi32(a, v), wantGt));
+        const __m128i hitB = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmplt_epi32(b, v), wantLt),
+                                                       _mm_and_si128(_mm_cmpeq_epi32(b, v), wantEq)),
+                                          _mm_and_si128(_mm_cmpgt_epi32(b, v), wantGt));
+        /* Saturating packs keep each lane's all-ones or all-zeros, one byte per element. */
+        const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(hitA, hitB), _mm_setzero_si128());
+        const vl_uint32_t byte = (vl_uint32_t)((_mm_movemask_epi8(packed) & 0xFF) ^ invert);
+        mask[i / 8] = (vl_uint8_t)byte;
+        total += vlSIMDPopCountScalar(byte);
+    }
+    return total + vlSIMDCompareI32Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareI16SSE2(const vl_int16_t* data, vl_dsidx_t count, vl_int16_t value,
+                                       vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m128i wantLt = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_LT);
+    const __m128i wantEq = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_EQ);
+    const __m128i wantGt = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_GT);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFFFu : 0u;
+    const __m128i v = _mm_set1_epi16(value);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(data + i + 8));
+        const __m128i hitA = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmplt_epi16(a, v), wantLt),
+                                                       _mm_and_si128(_mm_cmpeq_epi16(a, v), wantEq)),
+                                          _mm_and_si128(_mm_cmpgt_epi16(a, v), wantGt));
+        const __m128i hitB = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmplt_epi16(b, v), wantLt),
+                                                       _mm_and_si128(_mm_cmpeq_epi16(b, v), wantEq)),
+                                          _mm_and_si128(_mm_cmpgt_epi16(b, v), wantGt));
+        const vl_uint32_t bits = (vl_uint32_t)_mm_movemask_epi8(_mm_packs_epi16(hitA, hitB)) ^ invert;
+        mask[i / 8] = (vl_uint8_t)bits;
+        mask[i / 8 + 1] = (vl_uint8_t)(bits >> 8);
+        total += vlSIMDPopCountScalar(bits);
+    }
+    return total + vlSIMDCompareI16Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+static vl_dsidx_t vlSIMDCompareU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value,
+                                      vl_simd_cmp_op op, vl_uint8_t* mask)
+{
+    const vl_uint32_t code = vlSIMDCompareCodeScalar(op);
+    const __m128i wantLt = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_LT);
+    const __m128i wantEq = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_EQ);
+    const __m128i wantGt = vlSIMDCompareSelectSSE2(code, VL_SIMD_CMP_CODE_GT);
+    const vl_uint32_t invert = (code & VL_SIMD_CMP_CODE_INVERT) ? 0xFFFFu : 0u;
+    /* SSE2 only compares signed bytes; flipping the top bit maps unsigned order onto signed order. */
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    const __m128i v = _mm_xor_si128(_mm_set1_epi8((char)value), bias);
+    vl_dsidx_t total = 0, i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i a = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(data + i)), bias);
+        const __m128i hit = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmplt_epi8(a, v), wantLt),
+                                                      _mm_and_si128(_mm_cmpeq_epi8(a, v), wantEq)),
+                                         _mm_and_si128(_mm_cmpgt_epi8(a, v), wantGt));
+        const vl_uint32_t bits = (vl_uint32_t)_mm_movemask_epi8(hit) ^ invert;
+        mask[i / 8] = (vl_uint8_t)bits;
+        mask[i / 8 + 1] = (vl_uint8_t)(bits >> 8);
+        total += vlSIMDPopCountScalar(bits);
+    }
+    return total + vlSIMDCompareU8Scalar(data + i, count - i, value, code, mask + i / 8);
+}
+
+/* ============================================================================
+ * 512-bit Wide Operations
+ *
+ * Each 16-lane or 64-byte vector is processed as four 128-bit quarters.
+ * ============================================================================
+ */
+
+static vl_simd_vec16_f32 vlSIMDLoadVec16F32SSE2(const vl_float32_t* ptr)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_ps(&result.components[q], _mm_loadu_ps(&ptr[q]));
+    return result;
+}
+
+static void vlSIMDStoreVec16F32SSE2(vl_float32_t* ptr, vl_simd_vec16_f32 v)
+{
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_ps(&ptr[q], _mm_loadu_ps(&v.components[q]));
+}
+
+static vl_simd_vec16_f32 vlSIMDSplatVec16F32SSE2(vl_float32_t scalar)
+{
+    vl_simd_vec16_f32 result;
+    const __m128 s = _mm_set1_ps(scalar);
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_ps(&result.components[q], s);
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDAddVec16F32SSE2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_ps(&result.components[q],
+                      _mm_add_ps(_mm_loadu_ps(&a.components[q]), _mm_loadu_ps(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDSubVec16F32SSE2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_ps(&result.components[q],
+                      _mm_sub_ps(_mm_loadu_ps(&a.components[q]), _mm_loadu_ps(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDMulVec16F32SSE2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_ps(&result.components[q],
+                      _mm_mul_ps(_mm_loadu_ps(&a.components[q]), _mm_loadu_ps(&b.components[q])));
+    return result;
+}
+
+static vl_simd_vec16_f32 vlSIMDFmaVec16F32SSE2(vl_simd_vec16_f32 a, vl_simd_vec16_f32 b, vl_simd_vec16_f32 c)
+{
+    vl_simd_vec16_f32 result;
+    for (int q = 0; q < 16; q += 4)
+    {
+        const __m128 prod = _mm_mul_ps(_mm_loadu_ps(&a.components[q]), _mm_loadu_ps(&b.components[q]));
+        _mm_storeu_ps(&result.components[q], _mm_add_ps(prod, _mm_loadu_ps(&c.components[q])));
+    }
+    return result;
+}
+
+static vl_float32_t vlSIMDHsumVec16F32SSE2(vl_simd_vec16_f32 v)
+{
+    const __m128 low = _mm_add_ps(_mm_loadu_ps(&v.components[0]), _mm_loadu_ps(&v.components[4]));
+    const __m128 high = _mm_add_ps(_mm_loadu_ps(&v.components[8]), _mm_loadu_ps(&v.components[12]));
+    return vlSIMDHsumF32SSE2(_mm_add_ps(low, high));
+}
+
+static vl_simd_vec16_i32 vlSIMDLoadVec16I32SSE2(const vl_int32_t* ptr)
+{
+    vl_simd_vec16_i32 result;
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_si128((__m128i*)&result.components[q], _mm_loadu_si128((const __m128i*)&ptr[q]));
+    return result;
+}
+
+static void vlSIMDStoreVec16I32SSE2(vl_int32_t* ptr, vl_simd_vec16_i32 v)
+{
+    for (int q = 0; q < 16; q += 4)
+        _mm_storeu_si128((__m128i*)&ptr[q], _mm_loadu_si128((const __m128i*)&v.components[q]));
+}
+
+static vl_simd_vec16_i32 vlSIMDAddVec16I32SSE2(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int q = 0; q < 16; q += 4)
+    {
+        const __m128i va = _mm_loadu_si128((const __m128i*)&a.components[q]);
+        const __m128i vb = _mm_loadu_si128((const __m128i*)&b.components[q]);
+        _mm_storeu_si128((__m128i*)&result.components[q], _mm_add_epi32(va, vb));
+    }
+    return result;
+}
+
+static vl_simd_vec16_i32 vlSIMDMulVec16I32SSE2(vl_simd_vec16_i32 a, vl_simd_vec16_i32 b)
+{
+    vl_simd_vec16_i32 result;
+    for (int q = 0; q < 16; q += 4)
+    {
+        const __m128i va = _mm_loadu_si128((const __m128i*)&a.components[q]);
+        const __m128i vb = _mm_loadu_si128((const __m128i*)&b.components[q]);
+        _mm_storeu_si128((__m128i*)&result.components[q], vlSIMDMulLoI32SSE2(va, vb));
+    }
+    return result;
+}
+
+static vl_simd_vec64_u8 vlSIMDLoadVec64U8SSE2(const vl_uint8_t* ptr)
+{
+    vl_simd_vec64_u8 result;
+    for (int q = 0; q < 64; q += 16)
+        _mm_storeu_si128((__m128i*)&result.components[q], _mm_loadu_si128((const __m128i*)&ptr[q]));
+    return result;
+}
+
+static void vlSIMDStoreVec64U8SSE2(vl_uint8_t* ptr, vl_simd_vec64_u8 v)
+{
+    for (int q = 0; q < 64; q += 16)
+        _mm_storeu_si128((__m128i*)&ptr[q], _mm_loadu_si128((const __m128i*)&v.components[q]));
+}
+
+static vl_uint64_t vlSIMDEqMaskVec64U8SSE2(vl_simd_vec64_u8 v, vl_uint8_t byte)
+{
+    const __m128i needle = _mm_set1_epi8((char)byte);
+    vl_uint64_t mask = 0;
+    for (int q = 0; q < 64; q += 16)
+    {
+        const __m128i hit = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)&v.components[q]), needle);
+        mask |= (vl_uint64_t)(vl_uint32_t)_mm_movemask_epi8(hit) << q;
+    }
+    return mask;
+}
+
+/* ============================================================================
+ * Byte Scanning
+ *
+ * Long arrays are skimmed four vectors at a time, testing only whether any
+ * byte in the block matched; the single-vector loop then pins down where.
+ * Arrays of at least one vector end with a vector that overlaps the one
+ * before it instead of a scalar tail. The overlapped bytes are already known
+ * not to match, so they cannot change a find or equality result.
+ * ============================================================================
+ */
+
+/** Bit `i` is set when byte `i` of the 16 at `ptr` equals the splatted value. */
+static inline vl_uint32_t vlSIMDEqBitsU8SSE2(const vl_uint8_t* ptr, __m128i value)
+{
+    return (vl_uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ptr), value));
+}
+
+/** Whether any of the 64 bytes at `ptr` equals the splatted value. */
+static inline vl_bool_t vlSIMDEqAny4U8SSE2(const vl_uint8_t* ptr, __m128i value)
+{
+    const __m128i e0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ptr), value);
+    const __m128i e1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(ptr + 16)), value);
+    const __m128i e2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(ptr + 32)), value);
+    const __m128i e3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(ptr + 48)), value);
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3))) != 0;
+}
+
+/** Bit `i` is set when byte `i` of the 16 at `ptr` equals any of the `setCount` splatted values. */
+static inline vl_uint32_t vlSIMDAnyBitsU8SSE2(const vl_uint8_t* ptr, const __m128i* set, vl_dsidx_t setCount)
+{
+    const __m128i a = _mm_loadu_si128((const __m128i*)ptr);
+    __m128i hit = _mm_cmpeq_epi8(a, set[0]);
+    for (vl_dsidx_t k = 1; k < setCount; k++)
+    {
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(a, set[k]));
+    }
+    return (vl_uint32_t)_mm_movemask_epi8(hit);
+}
+
+static vl_dsidx_t vlSIMDFindU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    if (count < 16)
+    {
+        return vlSIMDFindU8Scalar(data, count, value);
+    }
+    const __m128i v = _mm_set1_epi8((char)value);
+    vl_dsidx_t i = 0;
+    vl_uint32_t bits;
+    while (i + 64 <= count && !vlSIMDEqAny4U8SSE2(data + i, v))
+    {
+        i += 64;
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        if ((bits = vlSIMDEqBitsU8SSE2(data + i, v)) != 0)
+        {
+            return i + vlAlgoCTZ32(bits);
+        }
+    }
+    if (i == count)
+    {
+        return count;
+    }
+    i = count - 16;
+    bits = vlSIMDEqBitsU8SSE2(data + i, v);
+    return bits ? i + vlAlgoCTZ32(bits) : count;
+}
+
+static vl_dsidx_t vlSIMDFindLastU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    if (count < 16)
+    {
+        return vlSIMDFindLastU8Scalar(data, count, value);
+    }
+    const __m128i v = _mm_set1_epi8((char)value);
+    vl_dsidx_t i = count;
+    vl_uint32_t bits;
+    while (i >= 64 && !vlSIMDEqAny4U8SSE2(data + i - 64, v))
+    {
+        i -= 64;
+    }
+    while (i >= 16)
+    {
+        i -= 16;
+        if ((bits = vlSIMDEqBitsU8SSE2(data + i, v)) != 0)
+        {
+            return i + 31 - vlAlgoCLZ32(bits);
+        }
+    }
+    if (i == 0)
+    {
+        return count;
+    }
+    bits = vlSIMDEqBitsU8SSE2(data, v);
+    return bits ? 31 - vlAlgoCLZ32(bits) : count;
+}
+
+static vl_dsidx_t vlSIMDFindAnyU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, const vl_uint8_t* set,
+                                      vl_dsidx_t setCount)
+{
+    if (count < 16 || setCount == 0 || setCount > VL_SIMD_FIND_ANY_VECTOR_MAX)
+    {
+        return vlSIMDFindAnyU8Scalar(data, count, set, setCount);
+    }
+    __m128i splat[VL_SIMD_FIND_ANY_VECTOR_MAX];
+    for (vl_dsidx_t k = 0; k < setCount; k++)
+    {
+        splat[k] = _mm_set1_epi8((char)set[k]);
+    }
+    vl_dsidx_t i = 0;
+    vl_uint32_t bits;
+    for (; i + 16 <= count; i += 16)
+    {
+        if ((bits = vlSIMDAnyBitsU8SSE2(data + i, splat, setCount)) != 0)
+        {
+            return i + vlAlgoCTZ32(bits);
+        }
+    }
+    if (i == count)
+    {
+        return count;
+    }
+    i = count - 16;
+    bits = vlSIMDAnyBitsU8SSE2(data + i, splat, setCount);
+    return bits ? i + vlAlgoCTZ32(bits) : count;
+}
+
+static vl_dsidx_t vlSIMDCountU8SSE2(const vl_uint8_t* data, vl_dsidx_t count, vl_uint8_t value)
+{
+    const __m128i v = _mm_set1_epi8((char)value);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i total = zero;
+    vl_dsidx_t i = 0;
+    while (count - i >= 16)
+    {
+        /*
+         * A match is -1, so subtracting it counts up per byte. Two counters
+         * take alternate vectors and are widened every 252 vectors, before
+         * either can wrap.
+         */
+        const vl_dsidx_t vectors = (count - i) / 16 < 252 ? (count - i) / 16 : 252;
+        __m128i acc0 = zero, acc1 = zero;
+        vl_dsidx_t k = 0;
+        for (; k + 4 <= vectors; k += 4, i += 64)
+        {
+            acc0 = _mm_sub_epi8(acc0, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i)), v));
+            acc1 = _mm_sub_epi8(acc1, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i + 16)), v));
+            acc0 = _mm_sub_epi8(acc0, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i + 32)), v));
+            acc1 = _mm_sub_epi8(acc1, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i + 48)), v));
+        }
+        for (; k < vectors; k++, i += 16)
+        {
+            acc0 = _mm_sub_epi8(acc0, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i)), v));
+        }
+        total = _mm_add_epi64(total, _mm_add_epi64(_mm_sad_epu8(acc0, zero), _mm_sad_epu8(acc1, zero)));
+    }
+    vl_uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, total);
+    return (vl_dsidx_t)(lanes[0] + lanes[1]) + vlSIMDCountU8Scalar(data + i, count - i, value);
+}
+
+static vl_bool_t vlSIMDEqualU8SSE2(const vl_uint8_t* a, const vl_uint8_t* b, vl_dsidx_t count)
+{
+    if (count < 16)
+    {
+        return vlSIMDEqualU8Scalar(a, b, count);
+    }
+    vl_dsidx_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        __m128i diff = _mm_setzero_si128();
+        for (int k = 0; k < 64; k += 16)
+        {
+            diff = _mm_or_si128(diff, _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + k)),
+                                                    _mm_loadu_si128((const __m128i*)(b + i + k))));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xFFFF)
+        {
+            return VL_FALSE;
+        }
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        if (vlSIMDEqBitsU8SSE2(a + i, _mm_loadu_si128((const __m128i*)(b + i))) != 0xFFFFu)
+        {
+            return VL_FALSE;
+        }
+    }
+    if (i == count)
+    {
+        return VL_TRUE;
+    }
+    i = count - 16;
+    return vlSIMDEqBitsU8SSE2(a + i, _mm_loadu_si128((const __m128i*)(b + i))) == 0xFFFFu;
+}
+
+/* ============================================================================
+ * Half-Precision Conversion
+ *
+ * SSE2 has no conversion instructions, so both directions are done with
+ * integer arithmetic on the bit patterns, selecting between the normal,
+ * subnormal and infinity/NaN results with masks instead of branches. The
+ * subnormal cases lean on float addition to round, which is exact for every
+ * input; only the default round-to-nearest mode is assumed.
+ * ============================================================================
+ */
+
+/** Converts four floats to halves, each in the low 16 bits of a 32-bit lane. */
+static inline __m128i vlSIMDF32ToHalf4SSE2(__m128i bits)
+{
+    const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32((int)0x80000000u));
+    const __m128i a = _mm_xor_si128(bits, sign);
+
+    /* Infinity, or a quiet NaN keeping the top of its payload. */
+    const __m128i isNaN = _mm_cmpgt_epi32(a, _mm_set1_epi32(0x7F800000));
+    const __m128i payload = _mm_or_si128(_mm_set1_epi32(0x200), _mm_and_si128(_mm_srli_epi32(a, 13),
+                                                                              _mm_set1_epi32(0x3FF)));
+    const __m128i special = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(isNaN, payload));
+
+    /* Subnormal or zero: adding 0.5 rounds the value to a multiple of 2^-24 in the low mantissa bits. */
+    const __m128i magic = _mm_set1_epi32(0x3F000000);
+    const __m128i sub =
+        _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(magic))), magic);
+
+    /* Normal: rebias the exponent, then round to nearest even on the 13 dropped bits. */
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(a, 13), _mm_set1_epi32(1));
+    const __m128i rebiased = _mm_add_epi32(a, _mm_set1_epi32((int)0xC8000FFFu));
+    const __m128i normal = _mm_srli_epi32(_mm_add_epi32(rebiased, odd), 13);
+
+    const __m128i isSpecial = _mm_cmpgt_epi32(a, _mm_set1_epi32(0x477FFFFF));
+    const __m128i isSub = _mm_cmplt_epi32(a, _mm_set1_epi32(0x38800000));
+    __m128i result = _mm_or_si128(_mm_and_si128(isSub, sub), _mm_andnot_si128(isSub, normal));
+    result = _mm_or_si128(_mm_and_si128(isSpecial, special), _mm_andnot_si128(isSpecial, result));
+    return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+}
+
+/** Converts four halves, each in the low 16 bits of a 32-bit lane, to float bit patterns. */
+static inline __m128i vlSIMDHalfToF324SSE2(__m128i h)
+{
+    const __m128i expMask = _mm_set1_epi32(0x0F800000);
+    __m128i o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+    const __m128i exp = _mm_and_si128(o, expMask);
+    o = _mm_add_epi32(o, _mm_set1_epi32(0x38000000));
+
+    /* Infinity and NaN take the maximum exponent; NaNs come back quiet. */
+    const __m128i isSpecial = _mm_cmpeq_epi32(exp, expMask);
+    const __m128i isNaN =
+        _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(h, _mm_set1_epi32(0x3FF)), _mm_setzero_si128()), isSpecial);
+    o = _mm_add_epi32(o, _mm_and_si128(isSpecial, _mm_set1_epi32(0x38000000)));
+    o = _mm_or_si128(o, _mm_and_si128(isNaN, _mm_set1_epi32(0x400000)));
+
+    /* Zero and subnormals: build 2^-14 * (1 + f) and subtract 2^-14, which is exact. */
+    const __m128i isSub = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(0x38800000));
+    const __m128i sub = _mm_castps_si128(
+        _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(0x00800000))), magic));
+    o = _mm_or_si128(_mm_and_si128(isSub, sub), _mm_andnot_si128(isSub, o));
+
+    return _mm_or_si128(o, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16));
+}
+
+static void vlSIMDConvertF32ToHalfSSE2(const vl_float32_t* src, vl_half_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i lo = vlSIMDF32ToHalf4SSE2(_mm_loadu_si128((const __m128i*)(src + i)));
+        const __m128i hi = vlSIMDF32ToHalf4SSE2(_mm_loadu_si128((const __m128i*)(src + i + 4)));
+        /* Sign-extending first lets the signed saturating pack pass all 16 bits through. */
+        const __m128i packed = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+                                               _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+        _mm_storeu_si128((__m128i*)(dst + i), packed);
+    }
+    vlSIMDConvertF32ToHalfScalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertHalfToF32SSE2(const vl_half_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i h = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), vlSIMDHalfToF324SSE2(_mm_unpacklo_epi16(h, zero)));
+        _mm_storeu_si128((__m128i*)(dst + i + 4), vlSIMDHalfToF324SSE2(_mm_unpackhi_epi16(h, zero)));
+    }
+    vlSIMDConvertHalfToF32Scalar(src + i, dst + i, count - i);
+}
+
+/* ============================================================================
+ * Numeric Type Conversion
+ *
+ * Each loop converts a block of whole vectors and leaves the remainder to the
+ * scalar casts. Conversions to float round under MXCSR, which matches the C
+ * cast in the default rounding mode.
+ * ============================================================================
+ */
+
+static void vlSIMDConvertI32ToF32SSE2(const vl_int32_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(src + i + 4))));
+    }
+    vlSIMDConvertI32ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF32ToI32SSE2(const vl_float32_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_cvttps_epi32(_mm_loadu_ps(src + i)));
+        _mm_storeu_si128((__m128i*)(dst + i + 4), _mm_cvttps_epi32(_mm_loadu_ps(src + i + 4)));
+    }
+    vlSIMDConvertF32ToI32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI16ToF32SSE2(const vl_int16_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        /* Each 16-bit value lands in the top half of a 32-bit lane; the arithmetic shift sign-extends it. */
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(lo));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(hi));
+    }
+    vlSIMDConvertI16ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertU8ToF32SSE2(const vl_uint8_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)));
+        _mm_storeu_ps(dst + i + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)));
+        _mm_storeu_ps(dst + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)));
+    }
+    vlSIMDConvertU8ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF32ToF64SSE2(const vl_float32_t* src, vl_float64_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 v = _mm_loadu_ps(src + i);
+        _mm_storeu_pd(dst + i, _mm_cvtps_pd(v));
+        _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+    vlSIMDConvertF32ToF64Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertF64ToF32SSE2(const vl_float64_t* src, vl_float32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+    }
+    vlSIMDConvertF64ToF32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI16ToI32SSE2(const vl_int16_t* src, vl_int32_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+        _mm_storeu_si128((__m128i*)(dst + i + 4), _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+    }
+    vlSIMDConvertI16ToI32Scalar(src + i, dst + i, count - i);
+}
+
+static void vlSIMDConvertI32ToI16SSE2(const vl_int32_t* src, vl_int16_t* dst, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        /* Sign-extending the low halves first keeps the saturating pack from clamping. */
+        const __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 4));
+        const __m128i packed = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+                                               _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+        _mm_storeu_si128((__m128i*)(dst + i), packed);
+    }
+    vlSIMDConvertI32ToI16Scalar(src + i, dst + i, count - i);
+}
+
+/* ============================================================================
+ * Byte Swapping and Gathers
+ *
+ * Without a byte shuffle, wider swaps first reorder 16-bit words with
+ * pshuflw/pshufhw and then swap the bytes within each word by shifting.
+ * SSE2 has no gather, so strided copies use the scalar loops.
+ * ============================================================================
+ */
+
+/** Swaps the two bytes of every 16-bit word. */
+static inline __m128i vlSIMDSwapWordBytesSSE2(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+static void vlSIMDByteSwapU16SSE2(vl_uint16_t* data, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(data + i + 8));
+        _mm_storeu_si128((__m128i*)(data + i), vlSIMDSwapWordBytesSSE2(a));
+        _mm_storeu_si128((__m128i*)(data + i + 8), vlSIMDSwapWordBytesSSE2(b));
+    }
+    vlSIMDByteSwapU16Scalar(data + i, count - i);
+}
+
+static void vlSIMDByteSwapU32SSE2(vl_uint32_t* data, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(data + i + 4));
+        a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0xB1), 0xB1);
+        b = _mm_shufflehi_epi16(_mm_shufflelo_epi16(b, 0xB1), 0xB1);
+        _mm_storeu_si128((__m128i*)(data + i), vlSIMDSwapWordBytesSSE2(a));
+        _mm_storeu_si128((__m128i*)(data + i + 4), vlSIMDSwapWordBytesSSE2(b));
+    }
+    vlSIMDByteSwapU32Scalar(data + i, count - i);
+}
+
+static void vlSIMDByteSwapU64SSE2(vl_uint64_t* data, vl_dsidx_t count)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(data + i + 2));
+        a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0x1B), 0x1B);
+        b = _mm_shufflehi_epi16(_mm_shufflelo_epi16(b, 0x1B), 0x1B);
+        _mm_storeu_si128((__m128i*)(data + i), vlSIMDSwapWordBytesSSE2(a));
+        _mm_storeu_si128((__m128i*)(data + i + 2), vlSIMDSwapWordBytesSSE2(b));
+    }
+    vlSIMDByteSwapU64Scalar(data + i, count - i);
+}
+
+static void vlSIMDGather32SSE2(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDGather32Scalar(src, srcStride, dst, count);
+}
+
+static void vlSIMDGather64SSE2(const void* src, vl_dsoffs_t srcStride, void* dst, vl_dsidx_t count)
+{
+    vlSIMDGather64Scalar(src, srcStride, dst, count);
+}
+
+/* ============================================================================
+ * Random Number Generation
+ *
+ * The eight xoshiro256++ lanes live in four vectors per state word for the
+ * whole call. SSE2 has 64-bit adds and shifts, so only the rotates take more
+ * than one instruction.
+ * ============================================================================
+ */
+
+/** Steps the two lanes held in `s` and returns their outputs. */
+static inline __m128i vlSIMDXoshiroStepSSE2(__m128i* s)
+{
+    const __m128i sum = _mm_add_epi64(s[0], s[3]);
+    const __m128i result = _mm_add_epi64(_mm_or_si128(_mm_slli_epi64(sum, 23), _mm_srli_epi64(sum, 41)), s[0]);
+    const __m128i t = _mm_slli_epi64(s[1], 17);
+    s[2] = _mm_xor_si128(s[2], s[0]);
+    s[3] = _mm_xor_si128(s[3], s[1]);
+    s[1] = _mm_xor_si128(s[1], s[2]);
+    s[0] = _mm_xor_si128(s[0], s[3]);
+    s[2] = _mm_xor_si128(s[2], t);
+    s[3] = _mm_or_si128(_mm_slli_epi64(s[3], 45), _mm_srli_epi64(s[3], 19));
+    return result;
+}
+
+/** Loads lane pair `q` (lanes 2q and 2q+1) of every state word into s[q]. */
+static inline void vlSIMDXoshiroLoadSSE2(const vl_uint64_t* state, __m128i (*s)[4])
+{
+    for (int q = 0; q < 4; q++)
+        for (int w = 0; w < 4; w++)
+            s[q][w] = _mm_loadu_si128((const __m128i*)(state + w * VL_SIMD_XOSHIRO_LANES + q * 2));
+}
+
+static inline void vlSIMDXoshiroStoreSSE2(vl_uint64_t* state, __m128i (*s)[4])
+{
+    for (int q = 0; q < 4; q++)
+        for (int w = 0; w < 4; w++)
+            _mm_storeu_si128((__m128i*)(state + w * VL_SIMD_XOSHIRO_LANES + q * 2), s[q][w]);
+}
+
+static void vlSIMDXoshiroU64SSE2(vl_uint64_t* state, void* dst, vl_dsidx_t blocks)
+{
+    __m128i s[4][4];
+    vl_uint8_t* out = (vl_uint8_t*)dst;
+    vlSIMDXoshiroLoadSSE2(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, out += 64)
+    {
+        for (int q = 0; q < 4; q++)
+            _mm_storeu_si128((__m128i*)(out + q * 16), vlSIMDXoshiroStepSSE2(s[q]));
+    }
+    vlSIMDXoshiroStoreSSE2(state, s);
+}
+
+static void vlSIMDXoshiroF32SSE2(vl_uint64_t* state, vl_float32_t* dst, vl_dsidx_t blocks)
+{
+    const __m128i one = _mm_set1_epi32((int)VL_SIMD_XOSHIRO_F32_ONE);
+    __m128i s[4][4];
+    vlSIMDXoshiroLoadSSE2(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 16)
+    {
+        for (int q = 0; q < 4; q++)
+        {
+            const __m128i bits = _mm_or_si128(_mm_srli_epi32(vlSIMDXoshiroStepSSE2(s[q]), 9), one);
+            _mm_storeu_ps(dst + q * 4, _mm_sub_ps(_mm_castsi128_ps(bits), _mm_set1_ps(1.0f)));
+        }
+    }
+    vlSIMDXoshiroStoreSSE2(state, s);
+}
+
+static void vlSIMDXoshiroF64SSE2(vl_uint64_t* state, vl_float64_t* dst, vl_dsidx_t blocks)
+{
+    const __m128i one = _mm_set1_epi64x((long long)VL_SIMD_XOSHIRO_F64_ONE);
+    __m128i s[4][4];
+    vlSIMDXoshiroLoadSSE2(state, s);
+    for (vl_dsidx_t b = 0; b < blocks; b++, dst += 8)
+    {
+        for (int q = 0; q < 4; q++)
+        {
+            const __m128i bits = _mm_or_si128(_mm_srli_epi64(vlSIMDXoshiroStepSSE2(s[q]), 12), one);
+            _mm_storeu_pd(dst + q * 2, _mm_sub_pd(_mm_castsi128_pd(bits), _mm_set1_pd(1.0)));
+        }
+    }
+    vlSIMDXoshiroStoreSSE2(state, s);
+}
+
 /* ============================================================================
  * Initialization
  * ============================================================================
  */
 
-void vlSIMDInit_SSE2(void)
+void vlSIMDInitSSE2(void)
 {
     vlSIMDFunctions.load_vec4f32 = vlSIMDLoadVec4F32SSE2;
     vlSIMDFunctions.store_vec4f32 = vlSIMDStoreVec4F32SSE2;
@@ -517,5 +2039,78 @@ void vlSIMDInit_SSE2(void)
     vlSIMDFunctions.add_vec8f32 = vlSIMDAddVec8F32SSE2;
     vlSIMDFunctions.mul_vec8f32 = vlSIMDMulVec8F32SSE2;
     vlSIMDFunctions.fma_vec8f32 = vlSIMDFmaVec8F32SSE2;
+    vlSIMDFunctions.load_vec16f32 = vlSIMDLoadVec16F32SSE2;
+    vlSIMDFunctions.store_vec16f32 = vlSIMDStoreVec16F32SSE2;
+    vlSIMDFunctions.splat_vec16f32 = vlSIMDSplatVec16F32SSE2;
+    vlSIMDFunctions.add_vec16f32 = vlSIMDAddVec16F32SSE2;
+    vlSIMDFunctions.sub_vec16f32 = vlSIMDSubVec16F32SSE2;
+    vlSIMDFunctions.mul_vec16f32 = vlSIMDMulVec16F32SSE2;
+    vlSIMDFunctions.fma_vec16f32 = vlSIMDFmaVec16F32SSE2;
+    vlSIMDFunctions.hsum_vec16f32 = vlSIMDHsumVec16F32SSE2;
+    vlSIMDFunctions.load_vec16i32 = vlSIMDLoadVec16I32SSE2;
+    vlSIMDFunctions.store_vec16i32 = vlSIMDStoreVec16I32SSE2;
+    vlSIMDFunctions.add_vec16i32 = vlSIMDAddVec16I32SSE2;
+    vlSIMDFunctions.mul_vec16i32 = vlSIMDMulVec16I32SSE2;
+    vlSIMDFunctions.load_vec64u8 = vlSIMDLoadVec64U8SSE2;
+    vlSIMDFunctions.store_vec64u8 = vlSIMDStoreVec64U8SSE2;
+    vlSIMDFunctions.eqmask_vec64u8 = vlSIMDEqMaskVec64U8SSE2;
+    vlSIMDFunctions.sort_i32 = vlSIMDSortI32SSE2;
+    vlSIMDFunctions.sort_u32 = vlSIMDSortU32SSE2;
+    vlSIMDFunctions.sort_f32 = vlSIMDSortF32SSE2;
+    vlSIMDFunctions.rank_i32 = vlSIMDRankI32SSE2;
+    vlSIMDFunctions.rank_u32 = vlSIMDRankU32SSE2;
+    vlSIMDFunctions.rank_f32 = vlSIMDRankF32SSE2;
+    vlSIMDFunctions.sum_f32 = vlSIMDSumF32SSE2;
+    vlSIMDFunctions.sum_i32 = vlSIMDSumI32SSE2;
+    vlSIMDFunctions.sum_i16 = vlSIMDSumI16SSE2;
+    vlSIMDFunctions.sum_u8 = vlSIMDSumU8SSE2;
+    vlSIMDFunctions.dot_f32 = vlSIMDDotF32SSE2;
+    vlSIMDFunctions.dot_i32 = vlSIMDDotI32SSE2;
+    vlSIMDFunctions.dot_i16 = vlSIMDDotI16SSE2;
+    vlSIMDFunctions.axpy_f32 = vlSIMDAxpyF32SSE2;
+    vlSIMDFunctions.axpy_i32 = vlSIMDAxpyI32SSE2;
+    vlSIMDFunctions.scale_f32 = vlSIMDScaleF32SSE2;
+    vlSIMDFunctions.scale_i32 = vlSIMDScaleI32SSE2;
+    vlSIMDFunctions.minmax_f32 = vlSIMDMinMaxF32SSE2;
+    vlSIMDFunctions.minmax_i32 = vlSIMDMinMaxI32SSE2;
+    vlSIMDFunctions.minmax_i16 = vlSIMDMinMaxI16SSE2;
+    vlSIMDFunctions.minmax_u8 = vlSIMDMinMaxU8SSE2;
+    vlSIMDFunctions.argmin_f32 = vlSIMDArgMinF32SSE2;
+    vlSIMDFunctions.argmin_i32 = vlSIMDArgMinI32SSE2;
+    vlSIMDFunctions.argmin_i16 = vlSIMDArgMinI16SSE2;
+    vlSIMDFunctions.argmin_u8 = vlSIMDArgMinU8SSE2;
+    vlSIMDFunctions.clamp_f32 = vlSIMDClampF32SSE2;
+    vlSIMDFunctions.clamp_i32 = vlSIMDClampI32SSE2;
+    vlSIMDFunctions.clamp_i16 = vlSIMDClampI16SSE2;
+    vlSIMDFunctions.clamp_u8 = vlSIMDClampU8SSE2;
+    vlSIMDFunctions.prefix_sum_f32 = vlSIMDPrefixSumF32SSE2;
+    vlSIMDFunctions.prefix_sum_i32 = vlSIMDPrefixSumI32SSE2;
+    vlSIMDFunctions.compare_f32 = vlSIMDCompareF32SSE2;
+    vlSIMDFunctions.compare_i32 = vlSIMDCompareI32SSE2;
+    vlSIMDFunctions.compare_i16 = vlSIMDCompareI16SSE2;
+    vlSIMDFunctions.compare_u8 = vlSIMDCompareU8SSE2;
+    vlSIMDFunctions.find_u8 = vlSIMDFindU8SSE2;
+    vlSIMDFunctions.find_last_u8 = vlSIMDFindLastU8SSE2;
+    vlSIMDFunctions.find_any_u8 = vlSIMDFindAnyU8SSE2;
+    vlSIMDFunctions.count_u8 = vlSIMDCountU8SSE2;
+    vlSIMDFunctions.equal_u8 = vlSIMDEqualU8SSE2;
+    vlSIMDFunctions.convert_f32_to_half = vlSIMDConvertF32ToHalfSSE2;
+    vlSIMDFunctions.convert_half_to_f32 = vlSIMDConvertHalfToF32SSE2;
+    vlSIMDFunctions.convert_i32_to_f32 = vlSIMDConvertI32ToF32SSE2;
+    vlSIMDFunctions.convert_f32_to_i32 = vlSIMDConvertF32ToI32SSE2;
+    vlSIMDFunctions.convert_i16_to_f32 = vlSIMDConvertI16ToF32SSE2;
+    vlSIMDFunctions.convert_u8_to_f32 = vlSIMDConvertU8ToF32SSE2;
+    vlSIMDFunctions.convert_f32_to_f64 = vlSIMDConvertF32ToF64SSE2;
+    vlSIMDFunctions.convert_f64_to_f32 = vlSIMDConvertF64ToF32SSE2;
+    vlSIMDFunctions.convert_i16_to_i32 = vlSIMDConvertI16ToI32SSE2;
+    vlSIMDFunctions.convert_i32_to_i16 = vlSIMDConvertI32ToI16SSE2;
+    vlSIMDFunctions.byteswap_u16 = vlSIMDByteSwapU16SSE2;
+    vlSIMDFunctions.byteswap_u32 = vlSIMDByteSwapU32SSE2;
+    vlSIMDFunctions.byteswap_u64 = vlSIMDByteSwapU64SSE2;
+    vlSIMDFunctions.gather_32 = vlSIMDGather32SSE2;
+    vlSIMDFunctions.gather_64 = vlSIMDGather64SSE2;
+    vlSIMDFunctions.xoshiro_u64 = vlSIMDXoshiroU64SSE2;
+    vlSIMDFunctions.xoshiro_f32 = vlSIMDXoshiroF32SSE2;
+    vlSIMDFunctions.xoshiro_f64 = vlSIMDXoshiroF64SSE2;
     vlSIMDFunctions.backend_name = "SSE2";
 }
@@ -0,0 +1,82 @@
+#include <windows.h>
+
+/**
+ * \brief Saved execution state of a fiber or of the thread hosting it.
+ *
+ * Win32 fibers own their stacks, so the context is simply the fiber handle.
+ * \private
+ */
+typedef struct vl_fiber_context_
+{
+    LPVOID handle;
+    vl_bool_t ownsHandle; /* VL_TRUE for fibers created by the scheduler. */
+} vl_fiber_context;
+
+/**
+ * \brief Fiber entry point signature; Win32 fiber procedures use the WINAPI convention.
+ * \private
+ */
+typedef VOID(WINAPI* vl_fiber_context_entry)(void* arg);
+#define VL_FIBER_ENTRY_CALL WINAPI
+
+/**
+ * \brief Returns the system page size.
+ * \private
+ */
+static vl_memsize_t vl_FiberPageSize(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (vl_memsize_t)info.dwPageSize;
+}
+
+/**
+ * \brief Creates a fiber that calls `entry(arg)` when first switched to.
+ *
+ * Win32 always reserves a guard region for fiber stacks, so `guardPage` is ignored.
+ * \private
+ */
+static vl_bool_t vl_FiberContextInit(vl_fiber_context* context, vl_memsize_t stackSize, vl_bool_t guardPage,
+                                     vl_fiber_context_entry entry, void* arg)
+{
+    (void)guardPage;
+    context->handle = CreateFiberEx(0, (SIZE_T)stackSize, FIBER_FLAG_FLOAT_SWITCH, entry, arg);
+    context->ownsHandle = VL_TRUE;
+    return context->handle != NULL;
+}
+
+/**
+ * \brief Destroys a fiber and its stack.
+ * \private
+ */
+static void vl_FiberContextFree(vl_fiber_context* context)
+{
+    if (context->ownsHandle && context->handle != NULL)
+    {
+        DeleteFiber(context->handle);
+    }
+    context->handle = NULL;
+}
+
+/**
+ * \brief Converts the calling thread into a fiber so it can switch into scheduler fibers.
+ *
+ * The conversion is kept for the lifetime of the thread.
+ * \private
+ */
+static vl_bool_t vl_FiberContextHostInit(vl_fiber_context* host)
+{
+    host->ownsHandle = VL_FALSE;
+    host->handle = IsThreadAFiber() ? GetCurrentFiber() : ConvertThreadToFiberEx(NULL, FIBER_FLAG_FLOAT_SWITCH);
+    return host->handle != NULL;
+}
+
+/**
+ * \brief Resumes `to`. Win32 records the outgoing fiber's state implicitly.
+ * \private
+ */
+static inline void vl_FiberContextSwitch(vl_fiber_context* from, vl_fiber_context* to)
+{
+    (void)from;
+    SwitchToFiber(to->handle);
+}
@@ -221,6 +221,18 @@ void vlThreadSleepNano(vl_ularge_t nanoseconds)
     }
 }
 
+vl_ularge_t vlThreadMonotonicNano(void)
+{
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+
+    /* Split to avoid overflowing the multiplication on long uptimes. */
+    const vl_ularge_t seconds = (vl_ularge_t)(now.QuadPart / freq.QuadPart);
+    const vl_ularge_t remainder = (vl_ularge_t)(now.QuadPart % freq.QuadPart);
+    return seconds * 1000000000ull + (remainder * 1000000000ull) / (vl_ularge_t)freq.QuadPart;
+}
+
 void vlThreadExit()
 {
     /* Ensure TLS/meta is set so we can decide the safest exit primitive. */
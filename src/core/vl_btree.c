@@ -0,0 +1,801 @@
+#include "vl_btree.h"
+
+#include <string.h>
+
+/**
+ * \brief Header shared by leaf and interior nodes.
+ *
+ * Leaves store `count` elements directly after the header, and are chained to
+ * their neighbours through `prev` and `next`. Interior nodes store `count + 1`
+ * child pointers after the header, then `count` separators. Every element in
+ * child `i` orders before separator `i`, and every element in child `i + 1`
+ * orders no earlier than it.
+ * \private
+ */
+typedef struct vl_btree_node_
+{
+    vl_uint32_t count;
+    vl_uint32_t isLeaf;
+    struct vl_btree_node_* prev;
+    struct vl_btree_node_* next;
+} vl_btree_node;
+
+/**
+ * \brief Offset of the element or child array within a node.
+ * \private
+ */
+#define VL_BTREE_HEADER_SIZE VL_MEMORY_PAD_UP(sizeof(vl_btree_node), 16)
+
+/**
+ * \brief Fewest elements or separators a node must hold before the tree refuses to shrink it.
+ * \private
+ */
+#define VL_BTREE_MIN_CAPACITY 4
+
+/**
+ * \brief Returns a pointer to slot `index` of a leaf.
+ * \private
+ */
+static inline vl_usmall_t* vl_BTreeLeafSlot(const vl_btree* tree, const vl_btree_node* leaf, vl_uint_t index)
+{
+    return (vl_usmall_t*)leaf + VL_BTREE_HEADER_SIZE + (vl_memsize_t)index * tree->elementSize;
+}
+
+/**
+ * \brief Returns the child pointer array of an interior node.
+ * \private
+ */
+static inline vl_btree_node** vl_BTreeChildren(const vl_btree_node* node)
+{
+    return (vl_btree_node**)((vl_usmall_t*)node + VL_BTREE_HEADER_SIZE);
+}
+
+/**
+ * \brief Returns a pointer to separator `index` of an interior node.
+ * \private
+ */
+static inline vl_usmall_t* vl_BTreeKey(const vl_btree* tree, const vl_btree_node* node, vl_uint_t index)
+{
+    return (vl_usmall_t*)node + VL_BTREE_HEADER_SIZE + (tree->branchCapacity + 1) * sizeof(vl_btree_node*) +
+        (vl_memsize_t)index * tree->elementSize;
+}
+
+/**
+ * \brief Returns the index of the first of `count` elements at `base` that does not order before `elem`.
+ * \private
+ */
+static vl_uint_t vl_BTreeLowerIndex(const vl_btree* tree, const vl_usmall_t* base, vl_uint_t count, const void* elem)
+{
+    vl_uint_t low = 0, high = count;
+    while (low < high)
+    {
+        const vl_uint_t mid = (low + high) / 2;
+        if (tree->comparator(base + (vl_memsize_t)mid * tree->elementSize, elem) < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
+/**
+ * \brief Returns the index of the first of `count` elements at `base` that orders after `elem`.
+ * \private
+ */
+static vl_uint_t vl_BTreeUpperIndex(const vl_btree* tree, const vl_usmall_t* base, vl_uint_t count, const void* elem)
+{
+    vl_uint_t low = 0, high = count;
+    while (low < high)
+    {
+        const vl_uint_t mid = (low + high) / 2;
+        if (tree->comparator(base + (vl_memsize_t)mid * tree->elementSize, elem) <= 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
+/**
+ * \brief Returns the index of the child of an interior node whose range holds `elem`.
+ * \private
+ */
+static inline vl_uint_t vl_BTreeChildIndex(const vl_btree* tree, const vl_btree_node* node, const void* elem)
+{
+    return vl_BTreeUpperIndex(tree, vl_BTreeKey(tree, node, 0), node->count, elem);
+}
+
+/**
+ * \brief Walks from the root to the leaf whose range holds `elem`.
+ * \private
+ */
+static vl_btree_node* vl_BTreeFindLeaf(const vl_btree* tree, const void* elem)
+{
+    vl_btree_node* node = (vl_btree_node*)tree->root;
+    while (!node->isLeaf)
+        node = vl_BTreeChildren(node)[vl_BTreeChildIndex(tree, node, elem)];
+    return node;
+}
+
+/**
+ * \brief Allocates an empty node.
+ * \private
+ */
+static vl_btree_node* vl_BTreeNodeNew(vl_btree* tree, vl_bool_t isLeaf)
+{
+    vl_btree_node* node = (vl_btree_node*)vlMemAllocAligned(tree->nodeSize, VL_BTREE_NODE_ALIGN);
+    if (node == NULL)
+        return NULL;
+    node->count = 0;
+    node->isLeaf = isLeaf;
+    node->prev = node->next = NULL;
+    tree->totalNodes++;
+    return node;
+}
+
+/**
+ * \brief Frees a node.
+ * \private
+ */
+static void vl_BTreeNodeDelete(vl_btree* tree, vl_btree_node* node)
+{
+    vlMemFree((vl_memory*)node);
+    tree->totalNodes--;
+}
+
+/**
+ * \brief Frees a node and everything below it.
+ * \private
+ */
+static void vl_BTreeNodeDeleteAll(vl_btree* tree, vl_btree_node* node)
+{
+    if (!node->isLeaf)
+    {
+        vl_btree_node** children = vl_BTreeChildren(node);
+        for (vl_uint_t i = 0; i <= node->count; i++)
+            vl_BTreeNodeDeleteAll(tree, children[i]);
+    }
+    vl_BTreeNodeDelete(tree, node);
+}
+
+/**
+ * \brief Returns the fewest entries a node of the given kind may hold before it is refilled during removal.
+ *
+ * Two nodes at this size always fit in one, with a separator to spare for interior nodes.
+ * \private
+ */
+static inline vl_uint_t vl_BTreeMinCount(const vl_btree* tree, const vl_btree_node* node)
+{
+    return node->isLeaf ? tree->leafCapacity / 2 : (tree->branchCapacity - 1) / 2;
+}
+
+/**
+ * \brief Returns `VL_TRUE` if a node has no room for another entry.
+ * \private
+ */
+static inline vl_bool_t vl_BTreeIsFull(const vl_btree* tree, const vl_btree_node* node)
+{
+    return node->count == (node->isLeaf ? tree->leafCapacity : tree->branchCapacity);
+}
+
+/**
+ * \brief Splits the full child `index` of `parent`, which must not be full, into two siblings.
+ *
+ * If `appending` is set, the child is the rightmost leaf and the new element orders after all of it; the split then
+ * moves only the last element, so ascending insertions leave leaves full rather than half full.
+ * \private
+ */
+static vl_bool_t vl_BTreeSplitChild(vl_btree* tree, vl_btree_node* parent, vl_uint_t index, vl_bool_t appending)
+{
+    vl_btree_node** children = vl_BTreeChildren(parent);
+    vl_btree_node* child = children[index];
+    vl_btree_node* right = vl_BTreeNodeNew(tree, child->isLeaf);
+    if (right == NULL)
+        return VL_FALSE;
+
+    const vl_memsize_t size = tree->elementSize;
+    const vl_usmall_t* separator;
+    if (child->isLeaf)
+    {
+        const vl_uint_t mid = appending ? child->count - 1 : child->count / 2;
+        right->count = child->count - mid;
+        memcpy(vl_BTreeLeafSlot(tree, right, 0), vl_BTreeLeafSlot(tree, child, mid), right->count * size);
+        child->count = mid;
+
+        right->prev = child;
+        right->next = child->next;
+        if (child->next != NULL)
+            child->next->prev = right;
+        else
+            tree->last = right;
+        child->next = right;
+        separator = vl_BTreeLeafSlot(tree, right, 0);
+    }
+    else
+    {
+        const vl_uint_t mid = child->count / 2;
+        right->count = child->count - mid - 1;
+        memcpy(vl_BTreeKey(tree, right, 0), vl_BTreeKey(tree, child, mid + 1), right->count * size);
+        memcpy(vl_BTreeChildren(right), vl_BTreeChildren(child) + mid + 1, (right->count + 1) * sizeof(vl_btree_node*));
+        child->count = mid;
+        separator = vl_BTreeKey(tree, child, mid);
+    }
+
+    vl_usmall_t* keys = vl_BTreeKey(tree, parent, 0);
+    memmove(keys + (index + 1) * size, keys + index * size, (parent->count - index) * size);
+    memcpy(keys + index * size, separator, size);
+    memmove(children + index + 2, children + index + 1, (parent->count - index) * sizeof(vl_btree_node*));
+    children[index + 1] = right;
+    parent->count++;
+    return VL_TRUE;
+}
+
+/**
+ * \brief Merges child `index + 1` of `parent` into child `index`, then frees it.
+ * \private
+ */
+static void vl_BTreeMergeChildren(vl_btree* tree, vl_btree_node* parent, vl_uint_t index)
+{
+    vl_btree_node** children = vl_BTreeChildren(parent);
+    vl_btree_node* left = children[index];
+    vl_btree_node* right = children[index + 1];
+    const vl_memsize_t size = tree->elementSize;
+
+    if (left->isLeaf)
+    {
+        memcpy(vl_BTreeLeafSlot(tree, left, left->count), vl_BTreeLeafSlot(tree, right, 0), right->count * size);
+        left->next = right->next;
+        if (right->next != NULL)
+            right->next->prev = left;
+        else
+            tree->last = left;
+    }
+    else
+    {
+        memcpy(vl_BTreeKey(tree, left, left->count), vl_BTreeKey(tree, parent, index), size);
+        memcpy(vl_BTreeKey(tree, left, left->count + 1), vl_BTreeKey(tree, right, 0), right->count * size);
+        memcpy(vl_BTreeChildren(left) + left->count + 1, vl_BTreeChildren(right),
+               (right->count + 1) * sizeof(vl_btree_node*));
+        left->count++;
+    }
+    left->count += right->count;
+
+    vl_usmall_t* keys = vl_BTreeKey(tree, parent, 0);
+    memmove(keys + index * size, keys + (index + 1) * size, (parent->count - index - 1) * size);
+    memmove(children + index + 1, children + index + 2, (parent->count - index - 1) * sizeof(vl_btree_node*));
+    parent->count--;
+    vl_BTreeNodeDelete(tree, right);
+}
+
+/**
+ * \brief Moves the last entry of child `index - 1` of `parent` into the front of child `index`.
+ * \private
+ */
+static void vl_BTreeBorrowLeft(vl_btree* tree, vl_btree_node* parent, vl_uint_t index)
+{
+    vl_btree_node** children = vl_BTreeChildren(parent);
+    vl_btree_node* child = children[index];
+    vl_btree_node* left = children[index - 1];
+    const vl_memsize_t size = tree->elementSize;
+
+    if (child->isLeaf)
+    {
+        vl_usmall_t* slots = vl_BTreeLeafSlot(tree, child, 0);
+        memmove(slots + size, slots, child->count * size);
+        memcpy(slots, vl_BTreeLeafSlot(tree, left, left->count - 1), size);
+        memcpy(vl_BTreeKey(tree, parent, index - 1), slots, size);
+    }
+    else
+    {
+        vl_usmall_t* keys = vl_BTreeKey(tree, child, 0);
+        vl_btree_node** grandchildren = vl_BTreeChildren(child);
+        memmove(keys + size, keys, child->count * size);
+        memmove(grandchildren + 1, grandchildren, (child->count + 1) * sizeof(vl_btree_node*));
+        memcpy(keys, vl_BTreeKey(tree, parent, index - 1), size);
+        grandchildren[0] = vl_BTreeChildren(left)[left->count];
+        memcpy(vl_BTreeKey(tree, parent, index - 1), vl_BTreeKey(tree, left, left->count - 1), size);
+    }
+    left->count--;
+    child->count++;
+}
+
+/**
+ * \brief Moves the first entry of child `index + 1` of `parent` onto the end of child `index`.
+ * \private
+ */
+static void vl_BTreeBorrowRight(vl_btree* tree, vl_btree_node* parent, vl_uint_t index)
+{
+    vl_btree_node** children = vl_BTreeChildren(parent);
+    vl_btree_node* child = children[index];
+    vl_btree_node* right = children[index + 1];
+    const vl_memsize_t size = tree->elementSize;
+
+    if (child->isLeaf)
+    {
+        vl_usmall_t* slots = vl_BTreeLeafSlot(tree, right, 0);
+        memcpy(vl_BTreeLeafSlot(tree, child, child->count), slots, size);
+        memmove(slots, slots + size, (right->count - 1) * size);
+        memcpy(vl_BTreeKey(tree, parent, index), slots, size);
+    }
+    else
+    {
+        vl_usmall_t* keys = vl_BTreeKey(tree, right, 0);
+        vl_btree_node** grandchildren = vl_BTreeChildren(right);
+        memcpy(vl_BTreeKey(tree, child, child->count), vl_BTreeKey(tree, parent, index), size);
+        vl_BTreeChildren(child)[child->count + 1] = grandchildren[0];
+        memcpy(vl_BTreeKey(tree, parent, index), keys, size);
+        memmove(keys, keys + size, (right->count - 1) * size);
+        memmove(grandchildren, grandchildren + 1, right->count * sizeof(vl_btree_node*));
+    }
+    right->count--;
+    child->count++;
+}
+
+/**
+ * \brief Refills child `index` of `parent` from a sibling, or merges it with one; returns the index to descend into.
+ * \private
+ */
+static vl_uint_t vl_BTreeRefillChild(vl_btree* tree, vl_btree_node* parent, vl_uint_t index)
+{
+    vl_btree_node** children = vl_BTreeChildren(parent);
+    const vl_uint_t minCount = vl_BTreeMinCount(tree, children[index]);
+
+    if (index > 0 && children[index - 1]->count > minCount)
+    {
+        vl_BTreeBorrowLeft(tree, parent, index);
+        return index;
+    }
+    if (index < parent->count && children[index + 1]->count > minCount)
+    {
+        vl_BTreeBorrowRight(tree, parent, index);
+        return index;
+    }
+    if (index < parent->count)
+    {
+        vl_BTreeMergeChildren(tree, parent, index);
+        return index;
+    }
+    vl_BTreeMergeChildren(tree, parent, index - 1);
+    return index - 1;
+}
+
+/**
+ * \brief Returns an iterator to slot `index` of `leaf`, moving on to the next leaf if the slot is past the end.
+ * \private
+ */
+static inline vl_btree_iter vl_BTreeIterAt(const vl_btree_node* leaf, vl_uint_t index)
+{
+    vl_btree_iter iter = {NULL, 0};
+    if (index >= leaf->count)
+    {
+        leaf = leaf->next;
+        index = 0;
+    }
+    if (leaf != NULL)
+    {
+        iter.leaf = (void*)leaf;
+        iter.index = index;
+    }
+    return iter;
+}
+
+VL_API void vlBTreeInit(vl_btree* tree, vl_memsize_t elementSize, vl_uint_t nodeSize, vl_compare_function comparator)
+{
+    const vl_memsize_t header = VL_BTREE_HEADER_SIZE;
+    const vl_memsize_t minLeaf = header + VL_BTREE_MIN_CAPACITY * elementSize;
+    const vl_memsize_t minBranch =
+        header + sizeof(vl_btree_node*) + VL_BTREE_MIN_CAPACITY * (sizeof(vl_btree_node*) + elementSize);
+
+    vl_memsize_t size = nodeSize == 0 ? VL_BTREE_DEFAULT_NODE_SIZE : nodeSize;
+    size = size < minLeaf ? minLeaf : size;
+    size = size < minBranch ? minBranch : size;
+    size = VL_MEMORY_PAD_UP(size, VL_BTREE_NODE_ALIGN);
+
+    tree->root = tree->first = tree->last = NULL;
+    tree->elementSize = elementSize;
+    tree->totalElements = 0;
+    tree->totalNodes = 0;
+    tree->height = 0;
+    tree->nodeSize = (vl_uint_t)size;
+    tree->leafCapacity = (vl_uint_t)((size - header) / elementSize);
+    tree->branchCapacity =
+        (vl_uint_t)((size - header - sizeof(vl_btree_node*)) / (sizeof(vl_btree_node*) + elementSize));
+    tree->comparator = comparator;
+}
+
+VL_API void vlBTreeFree(vl_btree* tree) { vlBTreeClear(tree); }
+
+VL_API vl_btree* vlBTreeNew(vl_memsize_t elementSize, vl_uint_t nodeSize, vl_compare_function comparator)
+{
+    vl_btree* tree = (vl_btree*)vlMemAlloc(sizeof(vl_btree));
+    if (tree == NULL)
+        return NULL;
+    vlBTreeInit(tree, elementSize, nodeSize, comparator);
+    return tree;
+}
+
+VL_API void vlBTreeDelete(vl_btree* tree)
+{
+    if (tree == NULL)
+        return;
+    vlBTreeFree(tree);
+    vlMemFree((vl_memory*)tree);
+}
+
+VL_API void vlBTreeClear(vl_btree* tree)
+{
+    if (tree->root != NULL)
+        vl_BTreeNodeDeleteAll(tree, (vl_btree_node*)tree->root);
+    tree->root = tree->first = tree->last = NULL;
+    tree->totalElements = 0;
+    tree->totalNodes = 0;
+    tree->height = 0;
+}
+
+VL_API vl_btree* vlBTreeClone(const vl_btree* src, vl_btree* dest)
+{
+    if (src == dest)
+        return dest;
+
+    vl_bool_t allocated = VL_FALSE;
+    if (dest == NULL)
+    {
+        dest = vlBTreeNew(src->elementSize, src->nodeSize, src->comparator);
+        if (dest == NULL)
+            return NULL;
+        allocated = VL_TRUE;
+    }
+    else
+    {
+        vlBTreeFree(dest);
+        vlBTreeInit(dest, src->elementSize, src->nodeSize, src->comparator);
+    }
+
+    if (src->totalElements == 0)
+        return dest;
+
+    vl_usmall_t* elements = (vl_usmall_t*)vlMemAlloc((vl_memsize_t)src->totalElements * src->elementSize);
+    vl_bool_t result = elements != NULL;
+    if (result)
+    {
+        vl_usmall_t* out = elements;
+        for (const vl_btree_node* leaf = (const vl_btree_node*)src->first; leaf != NULL; leaf = leaf->next)
+        {
+            memcpy(out, vl_BTreeLeafSlot(src, leaf, 0), leaf->count * src->elementSize);
+            out += leaf->count * src->elementSize;
+        }
+        result = vlBTreeBuildSorted(dest, elements, src->totalElements);
+        vlMemFree((vl_memory*)elements);
+    }
+
+    if (!result)
+    {
+        if (allocated)
+            vlBTreeDelete(dest);
+        return NULL;
+    }
+    return dest;
+}
+
+VL_API vl_bool_t vlBTreeBuildSorted(vl_btree* tree, const void* elements, vl_dsidx_t numElements)
+{
+    vlBTreeClear(tree);
+    if (numElements == 0)
+        return VL_TRUE;
+
+    const vl_memsize_t size = tree->elementSize;
+    const vl_dsidx_t maxLeaves = (numElements + tree->leafCapacity - 1) / tree->leafCapacity;
+    vl_btree_node** level = (vl_btree_node**)vlMemAlloc(maxLeaves * sizeof(vl_btree_node*));
+    if (level == NULL)
+        return VL_FALSE;
+
+    // Fill leaves in order, skipping repeats and rejecting anything out of order.
+    const vl_usmall_t* element = (const vl_usmall_t*)elements;
+    const vl_usmall_t* previous = NULL;
+    vl_btree_node* leaf = NULL;
+    vl_dsidx_t leafCount = 0;
+    for (vl_dsidx_t i = 0; i < numElements; i++, element += size)
+    {
+        if (previous != NULL)
+        {
+            const vl_int_t order = tree->comparator(previous, element);
+            if (order == 0)
+                continue;
+            if (order > 0)
+                goto failed;
+        }
+        previous = element;
+
+        if (leaf == NULL || leaf->count == tree->leafCapacity)
+        {
+            vl_btree_node* next = vl_BTreeNodeNew(tree, VL_TRUE);
+            if (next == NULL)
+                goto failed;
+            next->prev = leaf;
+            if (leaf != NULL)
+                leaf->next = next;
+            level[leafCount++] = leaf = next;
+        }
+        memcpy(vl_BTreeLeafSlot(tree, leaf, leaf->count++), element, size);
+        tree->totalElements++;
+    }
+
+    tree->first = level[0];
+    tree->last = leaf;
+    tree->height = 1;
+
+    // Leaves are packed full, except that the last one is topped up from its neighbour so removals can refill it.
+    if (leafCount > 1 && leaf->count < tree->leafCapacity / 2)
+    {
+        vl_btree_node* prev = leaf->prev;
+        const vl_uint_t move = (prev->count + leaf->count) / 2 - leaf->count;
+        memmove(vl_BTreeLeafSlot(tree, leaf, move), vl_BTreeLeafSlot(tree, leaf, 0), leaf->count * size);
+        memcpy(vl_BTreeLeafSlot(tree, leaf, 0), vl_BTreeLeafSlot(tree, prev, prev->count - move), move * size);
+        prev->count -= move;
+        leaf->count += move;
+    }
+
+    // Build interior levels, spreading children evenly over the fewest nodes that can hold them.
+    vl_dsidx_t count = leafCount;
+    while (count > 1)
+    {
+        const vl_dsidx_t fanout = tree->branchCapacity + 1;
+        const vl_dsidx_t parents = (count + fanout - 1) / fanout;
+        vl_dsidx_t consumed = 0;
+        for (vl_dsidx_t p = 0; p < parents; p++)
+        {
+            const vl_dsidx_t take = (count - consumed) / (parents - p);
+            vl_btree_node* parent = vl_BTreeNodeNew(tree, VL_FALSE);
+            if (parent == NULL)
+            {
+                for (vl_dsidx_t i = 0; i < p; i++)
+                    vl_BTreeNodeDeleteAll(tree, level[i]);
+                for (vl_dsidx_t i = consumed; i < count; i++)
+                    vl_BTreeNodeDeleteAll(tree, level[i]);
+                vlMemFree((vl_memory*)level);
+                tree->root = tree->first = tree->last = NULL;
+                tree->totalElements = tree->totalNodes = 0;
+                tree->height = 0;
+                return VL_FALSE;
+            }
+
+            vl_btree_node** children = vl_BTreeChildren(parent);
+            for (vl_dsidx_t c = 0; c < take; c++)
+            {
+                vl_btree_node* child = level[consumed + c];
+                children[c] = child;
+                if (c == 0)
+                    continue;
+                // The separator is the smallest element below the child: the first slot of its leftmost leaf.
+                while (!child->isLeaf)
+                    child = vl_BTreeChildren(child)[0];
+                memcpy(vl_BTreeKey(tree, parent, (vl_uint_t)c - 1), vl_BTreeLeafSlot(tree, child, 0), size);
+            }
+            parent->count = (vl_uint32_t)(take - 1);
+            consumed += take;
+            level[p] = parent;
+        }
+        count = parents;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    vlMemFree((vl_memory*)level);
+    return VL_TRUE;
+
+failed:
+    for (vl_dsidx_t i = 0; i < leafCount; i++)
+        vl_BTreeNodeDelete(tree, level[i]);
+    vlMemFree((vl_memory*)level);
+    tree->root = tree->first = tree->last = NULL;
+    tree->totalElements = 0;
+    tree->height = 0;
+    return VL_FALSE;
+}
+
+VL_API vl_btree_iter vlBTreeInsert(vl_btree* tree, const void* elem)
+{
+    vl_btree_iter iter = {NULL, 0};
+
+    if (tree->root == NULL)
+    {
+        vl_btree_node* leaf = vl_BTreeNodeNew(tree, VL_TRUE);
+        if (leaf == NULL)
+            return iter;
+        tree->root = tree->first = tree->last = leaf;
+        tree->height = 1;
+    }
+
+    // Full nodes are split on the way down, so a split never has to propagate back up.
+    vl_btree_node* node = (vl_btree_node*)tree->root;
+    if (vl_BTreeIsFull(tree, node))
+    {
+        vl_btree_node* root = vl_BTreeNodeNew(tree, VL_FALSE);
+        if (root == NULL)
+            return iter;
+        vl_BTreeChildren(root)[0] = node;
+        const vl_bool_t appending =
+            node->isLeaf && tree->comparator(vl_BTreeLeafSlot(tree, node, node->count - 1), elem) < 0;
+        if (!vl_BTreeSplitChild(tree, root, 0, appending))
+        {
+            vl_BTreeNodeDelete(tree, root);
+            return iter;
+        }
+        tree->root = node = root;
+        tree->height++;
+    }
+
+    while (!node->isLeaf)
+    {
+        vl_uint_t index = vl_BTreeChildIndex(tree, node, elem);
+        vl_btree_node* child = vl_BTreeChildren(node)[index];
+        if (vl_BTreeIsFull(tree, child))
+        {
+            const vl_bool_t appending = child->isLeaf && child->next == NULL &&
+                tree->comparator(vl_BTreeLeafSlot(tree, child, child->count - 1), elem) < 0;
+            if (!vl_BTreeSplitChild(tree, node, index, appending))
+                return iter;
+            if (tree->comparator(vl_BTreeKey(tree, node, index), elem) <= 0)
+                index++;
+            child = vl_BTreeChildren(node)[index];
+        }
+        node = child;
+    }
+
+    const vl_uint_t slot = vl_BTreeLowerIndex(tree, vl_BTreeLeafSlot(tree, node, 0), node->count, elem);
+    iter.leaf = node;
+    iter.index = slot;
+    if (slot < node->count && tree->comparator(vl_BTreeLeafSlot(tree, node, slot), elem) == 0)
+        return iter;
+
+    vl_usmall_t* dest = vl_BTreeLeafSlot(tree, node, slot);
+    memmove(dest + tree->elementSize, dest, (node->count - slot) * tree->elementSize);
+    memcpy(dest, elem, tree->elementSize);
+    node->count++;
+    tree->totalElements++;
+    return iter;
+}
+
+VL_API vl_bool_t vlBTreeRemove(vl_btree* tree, const void* elem, void* dest)
+{
+    if (tree->root == NULL)
+        return VL_FALSE;
+
+    // Children about to be descended into are refilled first, so removal from the leaf never has to propagate up.
+    vl_btree_node* node = (vl_btree_node*)tree->root;
+    while (!node->isLeaf)
+    {
+        vl_uint_t index = vl_BTreeChildIndex(tree, node, elem);
+        if (vl_BTreeChildren(node)[index]->count <= vl_BTreeMinCount(tree, vl_BTreeChildren(node)[index]))
+            index = vl_BTreeRefillChild(tree, node, index);
+
+        vl_btree_node* child = vl_BTreeChildren(node)[index];
+        if (node == tree->root && node->count == 0)
+        {
+            // The root's last two children merged; the merged child becomes the root.
+            vl_BTreeNodeDelete(tree, node);
+            tree->root = child;
+            tree->height--;
+        }
+        node = child;
+    }
+
+    const vl_uint_t slot = vl_BTreeLowerIndex(tree, vl_BTreeLeafSlot(tree, node, 0), node->count, elem);
+    if (slot == node->count || tree->comparator(vl_BTreeLeafSlot(tree, node, slot), elem) != 0)
+        return VL_FALSE;
+
+    vl_usmall_t* src = vl_BTreeLeafSlot(tree, node, slot);
+    if (dest != NULL)
+        memcpy(dest, src, tree->elementSize);
+    memmove(src, src + tree->elementSize, (node->count - slot - 1) * tree->elementSize);
+    node->count--;
+    tree->totalElements--;
+
+    if (node->count == 0)
+    {
+        // Only a root leaf can empty out; every other leaf was refilled above its minimum on the way down.
+        vl_BTreeNodeDelete(tree, node);
+        tree->root = tree->first = tree->last = NULL;
+        tree->height = 0;
+    }
+    return VL_TRUE;
+}
+
+VL_API vl_btree_iter vlBTreeFind(const vl_btree* tree, const void* elem)
+{
+    vl_btree_iter iter = vlBTreeLowerBound(tree, elem);
+    if (vlBTreeIterValid(iter) && tree->comparator(vlBTreeSample(tree, iter), elem) != 0)
+        iter.leaf = NULL;
+    return iter;
+}
+
+VL_API vl_btree_iter vlBTreeLowerBound(const vl_btree* tree, const void* elem)
+{
+    vl_btree_iter iter = {NULL, 0};
+    if (tree->root == NULL)
+        return iter;
+    const vl_btree_node* leaf = vl_BTreeFindLeaf(tree, elem);
+    return vl_BTreeIterAt(leaf, vl_BTreeLowerIndex(tree, vl_BTreeLeafSlot(tree, leaf, 0), leaf->count, elem));
+}
+
+VL_API vl_btree_iter vlBTreeUpperBound(const vl_btree* tree, const void* elem)
+{
+    vl_btree_iter iter = {NULL, 0};
+    if (tree->root == NULL)
+        return iter;
+    const vl_btree_node* leaf = vl_BTreeFindLeaf(tree, elem);
+    return vl_BTreeIterAt(leaf, vl_BTreeUpperIndex(tree, vl_BTreeLeafSlot(tree, leaf, 0), leaf->count, elem));
+}
+
+VL_API vl_btree_iter vlBTreeFront(const vl_btree* tree)
+{
+    vl_btree_iter iter = {tree->first, 0};
+    return iter;
+}
+
+VL_API vl_btree_iter vlBTreeBack(const vl_btree* tree)
+{
+    vl_btree_iter iter = {tree->last, 0};
+    if (tree->last != NULL)
+        iter.index = ((const vl_btree_node*)tree->last)->count - 1;
+    return iter;
+}
+
+VL_API vl_btree_iter vlBTreeNext(const vl_btree* tree, vl_btree_iter iter)
+{
+    (void)tree;
+    return vl_BTreeIterAt((const vl_btree_node*)iter.leaf, iter.index + 1);
+}
+
+VL_API vl_btree_iter vlBTreePrev(const vl_btree* tree, vl_btree_iter iter)
+{
+    (void)tree;
+    if (iter.index > 0)
+    {
+        iter.index--;
+        return iter;
+    }
+    const vl_btree_node* prev = ((const vl_btree_node*)iter.leaf)->prev;
+    iter.leaf = (void*)prev;
+    iter.index = prev != NULL ? prev->count - 1 : 0;
+    return iter;
+}
+
+VL_API void* vlBTreeSample(const vl_btree* tree, vl_btree_iter iter)
+{
+    return vl_BTreeLeafSlot(tree, (const vl_btree_node*)iter.leaf, iter.index);
+}
+
+VL_API vl_dsidx_t vlBTreeCopyRange(const vl_btree* tree, const void* low, const void* high, void* dest,
+                                   vl_dsidx_t maxElements)
+{
+    vl_btree_iter iter = low != NULL ? vlBTreeLowerBound(tree, low) : vlBTreeFront(tree);
+    const vl_memsize_t size = tree->elementSize;
+    vl_usmall_t* out = (vl_usmall_t*)dest;
+    vl_dsidx_t copied = 0;
+
+    const vl_btree_node* leaf = (const vl_btree_node*)iter.leaf;
+    vl_uint_t begin = iter.index;
+    while (leaf != NULL && copied < maxElements)
+    {
+        vl_uint_t end = leaf->count;
+        vl_bool_t done = VL_FALSE;
+        if (high != NULL && tree->comparator(vl_BTreeLeafSlot(tree, leaf, end - 1), high) >= 0)
+        {
+            end = vl_BTreeLowerIndex(tree, vl_BTreeLeafSlot(tree, leaf, 0), end, high);
+            done = VL_TRUE;
+        }
+
+        vl_dsidx_t take = end > begin ? end - begin : 0;
+        take = take < maxElements - copied ? take : maxElements - copied;
+        memcpy(out, vl_BTreeLeafSlot(tree, leaf, begin), take * size);
+        out += take * size;
+        copied += take;
+
+        if (done)
+            break;
+        leaf = leaf->next;
+        begin = 0;
+    }
+    return copied;
+}
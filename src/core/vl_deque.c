@@ -4,31 +4,76 @@
 #include <stdlib.h>
 
 /**
- * \brief Deque node header.
- * Analogous to a linked list element header.
- * Node data is stored immediately after.
+ * \brief Grows the ring buffer to hold at least the specified number of elements.
+ *
+ * The capacity is rounded up to a power of two. Elements that wrapped around
+ * the end of the old buffer are moved so that the ring stays contiguous modulo
+ * the new capacity; whichever of the two segments is smaller is the one moved.
+ *
+ * \param deq pointer
+ * \param minCapacity number of elements the ring must hold
+ * \return VL_TRUE on success, VL_FALSE if reallocation failed
  * \private
  */
-typedef struct
+static vl_bool_t vl_DequeGrow(vl_deque* deq, vl_dsidx_t minCapacity)
 {
-    vl_pool_idx prev;
-    vl_pool_idx next;
-} vl_deque_node;
+    const vl_dsidx_t oldCapacity = deq->capacity;
+    vl_dsidx_t newCapacity = oldCapacity ? oldCapacity : VL_DEQUE_DEFAULT_CAPACITY;
+
+    while (newCapacity < minCapacity)
+        newCapacity *= 2;
+
+    if (newCapacity == oldCapacity)
+        return VL_TRUE;
+
+    const vl_memsize_t newSize = (vl_memsize_t)newCapacity * deq->elementSize;
+    vl_transient* elements = deq->elements ? (vl_transient*)vlMemRealloc((vl_memory*)deq->elements, newSize)
+                                           : (vl_transient*)vlMemAlloc(newSize);
+    if (elements == NULL)
+        return VL_FALSE;
+
+    const vl_dsidx_t leading = oldCapacity - deq->head;
+    if (deq->totalElements > leading)
+    {
+        const vl_dsidx_t wrapped = deq->totalElements - leading;
+
+        if (wrapped <= leading)
+        {
+            // Move the wrapped prefix to just past the old end.
+            memcpy(elements + (vl_memsize_t)oldCapacity * deq->elementSize, elements,
+                   (vl_memsize_t)wrapped * deq->elementSize);
+        }
+        else
+        {
+            // Move the head segment to the end of the new buffer.
+            const vl_dsidx_t newHead = newCapacity - leading;
+            memmove(elements + (vl_memsize_t)newHead * deq->elementSize,
+                    elements + (vl_memsize_t)deq->head * deq->elementSize, (vl_memsize_t)leading * deq->elementSize);
+            deq->head = newHead;
+        }
+    }
+
+    deq->elements = elements;
+    deq->capacity = newCapacity;
+    return VL_TRUE;
+}
 
 void vlDequeInit(vl_deque* deq, vl_uint16_t elementSize)
 {
-    vlPoolInit(&deq->nodes, elementSize + sizeof(vl_deque_node));
-    deq->elementSize = elementSize;
-    deq->head = VL_POOL_INVALID_IDX;
-    deq->tail = VL_POOL_INVALID_IDX;
+    deq->elements = NULL;
+    deq->capacity = 0;
+    deq->head = 0;
     deq->totalElements = 0;
+    deq->elementSize = elementSize;
 }
 
 void vlDequeFree(vl_deque* deq)
 {
-    vlPoolFree(&deq->nodes);
-    deq->head = VL_POOL_INVALID_IDX;
-    deq->tail = VL_POOL_INVALID_IDX;
+    if (deq->elements)
+        vlMemFree((vl_memory*)deq->elements);
+    deq->elements = NULL;
+    deq->capacity = 0;
+    deq->head = 0;
     deq->elementSize = 0;
     deq->totalElements = 0;
 }
@@ -36,150 +81,145 @@ void vlDequeFree(vl_deque* deq)
 vl_deque* vlDequeNew(vl_uint16_t elementSize)
 {
     vl_deque* result = (vl_deque*)malloc(sizeof(vl_deque));
-    vlDequeInit(result, elementSize);
+    if (result)
+        vlDequeInit(result, elementSize);
     return result;
 }
 
 void vlDequeDelete(vl_deque* deq)
 {
+    if (deq == NULL)
+        return;
     vlDequeFree(deq);
     free(deq);
 }
 
 void vlDequeClear(vl_deque* deq)
 {
-    deq->head = VL_POOL_INVALID_IDX;
-    deq->tail = VL_POOL_INVALID_IDX;
+    deq->head = 0;
     deq->totalElements = 0;
-    vlPoolClear(&deq->nodes);
 }
 
-void vlDequeReserve(vl_deque* deque, vl_dsidx_t numElems) { vlPoolReserve(&deque->nodes, numElems); }
+void vlDequeReserve(vl_deque* deque, vl_dsidx_t numElems) { vl_DequeGrow(deque, numElems); }
 
 vl_deque* vlDequeClone(const vl_deque* src, vl_deque* dest)
 {
-    if (dest == NULL)
+    if (src == dest)
+        return dest;
+
+    const vl_bool_t created = dest == NULL;
+    if (created)
+    {
         dest = vlDequeNew(src->elementSize);
+        if (dest == NULL)
+            return NULL;
+    }
+    else
+        vlDequeFree(dest);
 
-    vlPoolClone(&src->nodes, &dest->nodes);
-    dest->head = src->head;
-    dest->tail = src->tail;
     dest->elementSize = src->elementSize;
-    dest->totalElements = src->totalElements;
+    if (src->capacity == 0)
+        return dest;
 
+    if (!vl_DequeGrow(dest, src->capacity))
+    {
+        if (created)
+            vlDequeDelete(dest);
+        return NULL;
+    }
+
+    // The clone starts at slot 0, so the elements are copied in order with at most two calls.
+    const vl_dsidx_t leading = src->capacity - src->head;
+    const vl_dsidx_t first = src->totalElements < leading ? src->totalElements : leading;
+    memcpy(dest->elements, src->elements + (vl_memsize_t)src->head * src->elementSize,
+           (vl_memsize_t)first * src->elementSize);
+    memcpy(dest->elements + (vl_memsize_t)first * src->elementSize, src->elements,
+           (vl_memsize_t)(src->totalElements - first) * src->elementSize);
+
+    dest->totalElements = src->totalElements;
     return dest;
 }
 
 void vlDequePushFront(vl_deque* deq, const void* val)
 {
-    const vl_pool_idx oldHead = deq->head;
-    const vl_pool_idx newHead = vlPoolTake(&deq->nodes);
-
-    void* dest = vlPoolSample(&deq->nodes, newHead);
-    vl_deque_node* newNode = dest;
-    dest = newNode + 1;
-
-    memcpy(dest, val, deq->elementSize);
-
-    newNode->prev = VL_POOL_INVALID_IDX;
-    newNode->next = oldHead;
-
-    if (oldHead != VL_POOL_INVALID_IDX)
-    {
-        vl_deque_node* oldNode = (vl_deque_node*)vlPoolSample(&deq->nodes, oldHead);
-        oldNode->prev = newHead;
-    }
-
-    if (deq->tail == VL_POOL_INVALID_IDX)
-    {
-        deq->tail = newHead;
-    }
+    if (deq->totalElements == deq->capacity && !vl_DequeGrow(deq, deq->totalElements + 1))
+        return;
 
-    deq->head = newHead;
+    deq->head = (deq->head - 1) & (deq->capacity - 1);
+    memcpy(deq->elements + (vl_memsize_t)deq->head * deq->elementSize, val, deq->elementSize);
     deq->totalElements++;
 }
 
 int vlDequePopFront(vl_deque* deq, void* val)
 {
-    if (deq->head == VL_POOL_INVALID_IDX)
+    if (deq->totalElements == 0)
         return 0;
-    else if (deq->head == deq->tail)
-    {
-        vl_deque_node* oldHead = (vl_deque_node*)vlPoolSample(&deq->nodes, deq->head);
-        memcpy(val, oldHead + 1, deq->elementSize);
-        vlPoolReturn(&deq->nodes, deq->head);
-        deq->head = deq->tail = VL_POOL_INVALID_IDX;
-        deq->totalElements--;
-        return 1;
-    }
-
-    vl_deque_node* oldNode = (vl_deque_node*)vlPoolSample(&deq->nodes, deq->head);
 
     if (val)
-        memcpy(val, oldNode + 1, deq->elementSize);
-    const vl_pool_idx rightIter = oldNode->next;
-
-    vl_deque_node* rightNode = (vl_deque_node*)vlPoolSample(&deq->nodes, rightIter);
-    rightNode->prev = VL_POOL_INVALID_IDX;
+        memcpy(val, deq->elements + (vl_memsize_t)deq->head * deq->elementSize, deq->elementSize);
 
+    deq->head = (deq->head + 1) & (deq->capacity - 1);
     deq->totalElements--;
-    vlPoolReturn(&deq->nodes, deq->head);
-    deq->head = rightIter;
-
     return 1;
 }
 
 void vlDequePushBack(vl_deque* deq, const void* val)
 {
-    const vl_pool_idx oldTail = deq->tail;
-    const vl_pool_idx newTail = vlPoolTake(&deq->nodes);
+    if (deq->totalElements == deq->capacity && !vl_DequeGrow(deq, deq->totalElements + 1))
+        return;
 
-    void* dest = vlPoolSample(&deq->nodes, newTail);
-    vl_deque_node* newNode = dest;
-    dest = newNode + 1;
+    memcpy(vlDequeSample(deq, deq->totalElements), val, deq->elementSize);
+    deq->totalElements++;
+}
 
-    memcpy(dest, val, deq->elementSize);
-    newNode->next = VL_POOL_INVALID_IDX;
-    newNode->prev = oldTail;
+int vlDequePopBack(vl_deque* deq, void* val)
+{
+    if (deq->totalElements == 0)
+        return 0;
 
-    if (oldTail != VL_POOL_INVALID_IDX)
-    {
-        vl_deque_node* oldNode = (vl_deque_node*)vlPoolSample(&deq->nodes, oldTail);
-        oldNode->next = newTail;
-    }
+    deq->totalElements--;
+    if (val)
+        memcpy(val, vlDequeSample(deq, deq->totalElements), deq->elementSize);
+    return 1;
+}
 
-    if (deq->head == VL_POOL_INVALID_IDX)
-        deq->head = newTail;
+void vlDequePushBackN(vl_deque* deq, const void* vals, vl_dsidx_t n)
+{
+    if (n == 0 || (deq->totalElements + n > deq->capacity && !vl_DequeGrow(deq, deq->totalElements + n)))
+        return;
 
-    deq->tail = newTail;
-    deq->totalElements++;
+    const vl_dsidx_t tail = (deq->head + deq->totalElements) & (deq->capacity - 1);
+    const vl_dsidx_t untilEnd = deq->capacity - tail;
+    const vl_dsidx_t first = n < untilEnd ? n : untilEnd;
+
+    memcpy(deq->elements + (vl_memsize_t)tail * deq->elementSize, vals, (vl_memsize_t)first * deq->elementSize);
+    if (first < n)
+        memcpy(deq->elements, (const vl_transient*)vals + (vl_memsize_t)first * deq->elementSize,
+               (vl_memsize_t)(n - first) * deq->elementSize);
+
+    deq->totalElements += n;
 }
 
-int vlDequePopBack(vl_deque* deq, void* val)
+vl_dsidx_t vlDequePopFrontN(vl_deque* deq, void* vals, vl_dsidx_t n)
 {
-    if (deq->tail == VL_POOL_INVALID_IDX)
+    if (n > deq->totalElements)
+        n = deq->totalElements;
+    if (n == 0)
         return 0;
-    else if (deq->head == deq->tail)
+
+    if (vals)
     {
-        vl_deque_node* oldHead = (vl_deque_node*)vlPoolSample(&deq->nodes, deq->tail);
-        memcpy(val, oldHead + 1, deq->elementSize);
-        vlPoolReturn(&deq->nodes, deq->tail);
-        deq->head = deq->tail = VL_POOL_INVALID_IDX;
-        deq->totalElements--;
-        return 1;
+        const vl_dsidx_t untilEnd = deq->capacity - deq->head;
+        const vl_dsidx_t first = n < untilEnd ? n : untilEnd;
+
+        memcpy(vals, deq->elements + (vl_memsize_t)deq->head * deq->elementSize,
+               (vl_memsize_t)first * deq->elementSize);
+        if (first < n)
+            memcpy((vl_transient*)vals + (vl_memsize_t)first * deq->elementSize, deq->elements,
+                   (vl_memsize_t)(n - first) * deq->elementSize);
     }
 
-    vl_deque_node* oldNode = (vl_deque_node*)vlPoolSample(&deq->nodes, deq->tail);
-
-    if (val)
-        memcpy(val, oldNode + 1, deq->elementSize);
-
-    const vl_pool_idx leftIter = oldNode->prev;
-    vl_deque_node* leftNode = (vl_deque_node*)vlPoolSample(&deq->nodes, leftIter);
-    leftNode->next = VL_POOL_INVALID_IDX;
-
-    vlPoolReturn(&deq->nodes, deq->tail);
-    deq->tail = leftIter;
-    deq->totalElements--;
-    return 1;
+    deq->head = (deq->head + n) & (deq->capacity - 1);
+    deq->totalElements -= n;
+    return n;
 }
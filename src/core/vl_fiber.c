@@ -0,0 +1,991 @@
+#include "vl_fiber.h"
+
+#include "vl_atomic.h"
+#include "vl_condition.h"
+#include "vl_mutex.h"
+#include "vl_pool.h"
+#include "vl_thread.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef VL_THREADS_WIN32
+
+#include "platform/win32/vl_fiber_win32.c"
+
+#elif defined VL_THREADS_PTHREAD
+
+#include "platform/posix/vl_fiber_posix.c"
+
+#else
+#error Failed to configure vl_fiber implementation.
+#endif
+
+/**
+ * \brief What the host worker must do once a fiber has switched off its stack.
+ * \private
+ */
+typedef enum
+{
+    VL_FIBER_SUSPEND_YIELD, /* Requeue immediately. */
+    VL_FIBER_SUSPEND_SLEEP, /* Arm a timer. */
+    VL_FIBER_SUSPEND_EVENT, /* Arm an optional timer, then release the event lock. */
+    VL_FIBER_SUSPEND_BLOCKING, /* Hand the pending call to the blocking pool. */
+    VL_FIBER_SUSPEND_DONE /* Return the descriptor to the free list. */
+} vl_fiber_suspend;
+
+typedef struct vl_fiber_ vl_fiber;
+typedef struct vl_fiber_host_ vl_fiber_host;
+
+/**
+ * \brief Fiber descriptor. Allocated from the scheduler's `vl_pool` and
+ * recycled together with its stack.
+ * \private
+ */
+struct vl_fiber_
+{
+    vl_fiber_context context;
+    vl_fiber_scheduler* scheduler;
+    vl_fiber_host* host; /* Worker currently running the fiber; set on every resume. */
+
+    vl_fiber_proc proc;
+    void* userData;
+
+    vl_fiber_suspend suspendAction;
+
+    /*
+     * Odd while parked on a wait that several parties may complete. A waker
+     * owns the wakeup only if it advances this from the value it registered.
+     */
+    VL_ATOMIC vl_uint32_t parkSeq;
+    vl_uint32_t waitSeq;
+    vl_ularge_t wakeAt; /* Monotonic deadline in nanoseconds, or 0 for none. */
+    vl_bool_t timedOut;
+
+    vl_fiber_event waitingOn; /* Guarded by the event's lock. */
+    vl_fiber* prevWaiter;
+    vl_fiber* nextWaiter;
+
+    vl_fiber_proc blockingProc;
+    void* blockingData;
+
+    vl_fiber* nextFree;
+    vl_fiber* nextAllocated;
+};
+
+/**
+ * \brief Per-thread state of a pool worker that runs fibers.
+ * \private
+ */
+struct vl_fiber_host_
+{
+    vl_fiber_context context;
+    vl_bool_t initialized;
+    vl_fiber* current;
+};
+
+/**
+ * \private
+ */
+typedef struct
+{
+    vl_ularge_t wakeAt;
+    vl_fiber* fiber;
+    vl_uint32_t seq;
+} vl_fiber_timer;
+
+struct vl_fiber_event_
+{
+    vl_mutex lock;
+    vl_condition threadWake; /* Wakes plain threads waiting on the event. */
+    vl_bool_t set;
+    vl_fiber* waiters;
+};
+
+struct vl_fiber_scheduler_
+{
+    vl_thread_pool* pool;
+    vl_bool_t ownsPool;
+    vl_thread_pool_priority priority;
+    vl_thread_pool* blockingPool;
+    vl_memsize_t stackSize;
+    vl_bool_t guardPages;
+
+    vl_mutex fiberLock; /* Guards everything down to stacksAllocated. */
+    vl_pool fibers;
+    vl_fiber* freeFibers;
+    vl_fiber* allocatedFibers;
+    vl_uint_t stacksAllocated;
+
+    VL_ATOMIC vl_ularge_t fibersSpawned;
+    VL_ATOMIC vl_ularge_t fibersCompleted;
+    VL_ATOMIC vl_ularge_t fibersFailed;
+    VL_ATOMIC vl_uint_t fibersLive;
+    vl_mutex idleLock;
+    vl_condition idle;
+
+    vl_mutex timerLock; /* Guards the timer heap and timerRunning. */
+    vl_condition timerWake;
+    vl_fiber_timer* timers;
+    vl_uint_t timerCount;
+    vl_uint_t timerCapacity;
+    vl_bool_t timerRunning;
+    vl_thread timerThread;
+};
+
+/**
+ * \brief Host state of the calling thread.
+ *
+ * Only read on a thread's own stack or at the start of an in-fiber call, never
+ * after a switch within the same function: a fiber may resume on another
+ * thread, and a TLS address cached across the switch would be stale.
+ * \private
+ */
+static VL_THREAD_LOCAL vl_fiber_host vlFiberTlsHost;
+
+/**
+ * \brief Returns the fiber running on the calling thread, or NULL.
+ * \private
+ */
+static vl_fiber* vl_FiberSelf(void)
+{
+    return vlFiberTlsHost.current;
+}
+
+/**
+ * \brief Queues a resumption of `fiber` on the scheduler's pool, abandoning
+ * the fiber if the pool rejects it.
+ * \private
+ */
+static void vl_FiberSchedule(vl_fiber* fiber);
+
+/**
+ * \brief Completes a park registered with sequence `seq`, unless another waker already has.
+ * \private
+ */
+static void vl_FiberWake(vl_fiber* fiber, vl_uint32_t seq, vl_bool_t timedOut)
+{
+    vl_uint32_t expected = seq;
+    if (!vlAtomicCompareExchangeStrong(&fiber->parkSeq, &expected, seq + 1))
+    {
+        return;
+    }
+
+    fiber->timedOut = timedOut;
+    vl_FiberSchedule(fiber);
+}
+
+/**
+ * \brief Opens a new park generation for the calling fiber.
+ * \private
+ */
+static inline vl_uint32_t vl_FiberPreparePark(vl_fiber* fiber)
+{
+    const vl_uint32_t seq = vlAtomicLoadExplicit(&fiber->parkSeq, VL_MEMORY_ORDER_RELAXED) + 1;
+    vlAtomicStore(&fiber->parkSeq, seq);
+    fiber->waitSeq = seq;
+    fiber->timedOut = VL_FALSE;
+    return seq;
+}
+
+/**
+ * \brief Switches from the calling fiber back to its host worker.
+ * \private
+ */
+static inline void vl_FiberSuspend(vl_fiber* fiber, vl_fiber_suspend action)
+{
+    fiber->suspendAction = action;
+    vl_FiberContextSwitch(&fiber->context, &fiber->host->context);
+}
+
+/**
+ * \brief Arms a timer that wakes `fiber` at its `wakeAt` deadline. Runs on the host.
+ * \private
+ */
+static void vl_FiberTimerAdd(vl_fiber_scheduler* scheduler, vl_fiber* fiber)
+{
+    const vl_fiber_timer timer = {fiber->wakeAt, fiber, fiber->waitSeq};
+
+    vlMutexObtain(scheduler->timerLock);
+
+    if (scheduler->timerCount == scheduler->timerCapacity)
+    {
+        const vl_uint_t capacity = scheduler->timerCapacity == 0 ? 64 : scheduler->timerCapacity * 2;
+        vl_memory* grown = scheduler->timers == NULL
+            ? vlMemAlloc(sizeof(vl_fiber_timer) * capacity)
+            : vlMemRealloc((vl_memory*)scheduler->timers, sizeof(vl_fiber_timer) * capacity);
+
+        if (grown == NULL)
+        {
+            /* Wake early rather than never. */
+            vlMutexRelease(scheduler->timerLock);
+            vl_FiberWake(fiber, timer.seq, VL_TRUE);
+            return;
+        }
+
+        scheduler->timers = (vl_fiber_timer*)grown;
+        scheduler->timerCapacity = capacity;
+    }
+
+    /* Binary min-heap ordered by deadline. */
+    vl_fiber_timer* heap = scheduler->timers;
+    vl_uint_t i = scheduler->timerCount++;
+    while (i > 0)
+    {
+        const vl_uint_t parent = (i - 1) / 2;
+        if (heap[parent].wakeAt <= timer.wakeAt)
+        {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = timer;
+
+    if (i == 0)
+    {
+        vlConditionSignal(scheduler->timerWake);
+    }
+
+    vlMutexRelease(scheduler->timerLock);
+}
+
+/**
+ * \brief Removes the earliest timer. Requires `timerLock`.
+ * \private
+ */
+static vl_fiber_timer vl_FiberTimerPop(vl_fiber_scheduler* scheduler)
+{
+    vl_fiber_timer* heap = scheduler->timers;
+    const vl_fiber_timer top = heap[0];
+    const vl_fiber_timer last = heap[--scheduler->timerCount];
+    const vl_uint_t count = scheduler->timerCount;
+
+    vl_uint_t i = 0;
+    for (;;)
+    {
+        vl_uint_t child = i * 2 + 1;
+        if (child >= count)
+        {
+            break;
+        }
+        if (child + 1 < count && heap[child + 1].wakeAt < heap[child].wakeAt)
+        {
+            child++;
+        }
+        if (last.wakeAt <= heap[child].wakeAt)
+        {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+
+    if (count > 0)
+    {
+        heap[i] = last;
+    }
+
+    return top;
+}
+
+/**
+ * \brief Timer thread: fires expired timers, sleeping until the earliest deadline.
+ * \private
+ */
+static void vl_FiberTimerProc(void* arg)
+{
+    vl_fiber_scheduler* scheduler = (vl_fiber_scheduler*)arg;
+
+    vlMutexObtain(scheduler->timerLock);
+    while (scheduler->timerRunning)
+    {
+        if (scheduler->timerCount == 0)
+        {
+            vlConditionWait(scheduler->timerWake, scheduler->timerLock);
+            continue;
+        }
+
+        const vl_ularge_t now = vlThreadMonotonicNano();
+        const vl_ularge_t wakeAt = scheduler->timers[0].wakeAt;
+
+        if (wakeAt <= now)
+        {
+            const vl_fiber_timer timer = vl_FiberTimerPop(scheduler);
+
+            vlMutexRelease(scheduler->timerLock);
+            vl_FiberWake(timer.fiber, timer.seq, VL_TRUE);
+            vlMutexObtain(scheduler->timerLock);
+            continue;
+        }
+
+        /* Round up so the deadline has passed when the wait ends. */
+        vlConditionWaitTimeout(scheduler->timerWake, scheduler->timerLock, (wakeAt - now + 999999ull) / 1000000ull);
+    }
+    vlMutexRelease(scheduler->timerLock);
+}
+
+/**
+ * \brief Drops one live fiber, waking waiters once none remain.
+ * \private
+ */
+static void vl_FiberReleaseLive(vl_fiber_scheduler* scheduler)
+{
+    if (vlAtomicFetchSub(&scheduler->fibersLive, 1) == 1)
+    {
+        vlMutexObtain(scheduler->idleLock);
+        vlConditionBroadcast(scheduler->idle);
+        vlMutexRelease(scheduler->idleLock);
+    }
+}
+
+/**
+ * \brief Returns a fiber's descriptor and stack to the free list.
+ *
+ * Only valid for a fiber that has finished or has never run, as its context
+ * must resume at the top of `vl_FiberEntry`'s loop.
+ * \private
+ */
+static void vl_FiberRecycle(vl_fiber* fiber)
+{
+    vl_fiber_scheduler* scheduler = fiber->scheduler;
+
+    vlMutexObtain(scheduler->fiberLock);
+    fiber->nextFree = scheduler->freeFibers;
+    scheduler->freeFibers = fiber;
+    vlMutexRelease(scheduler->fiberLock);
+}
+
+/**
+ * \brief Blocking pool task: performs a fiber's blocking call, then resumes it.
+ * \private
+ */
+static void vl_FiberBlockingTask(void* arg)
+{
+    vl_fiber* fiber = (vl_fiber*)arg;
+    fiber->blockingProc(fiber->blockingData);
+    vl_FiberSchedule(fiber);
+}
+
+/**
+ * \brief Publishes a suspended fiber to whatever will resume it.
+ *
+ * Runs on the host's stack once the fiber's state is fully saved, so any
+ * wakeup triggered from here can safely resume the fiber on another worker.
+ * The fiber must not be touched after it has been published.
+ * \private
+ */
+static void vl_FiberAfterSuspend(vl_fiber* fiber)
+{
+    vl_fiber_scheduler* scheduler = fiber->scheduler;
+
+    switch (fiber->suspendAction)
+    {
+        case VL_FIBER_SUSPEND_YIELD:
+            vl_FiberSchedule(fiber);
+            break;
+        case VL_FIBER_SUSPEND_SLEEP:
+            vl_FiberTimerAdd(scheduler, fiber);
+            break;
+        case VL_FIBER_SUSPEND_EVENT:
+        {
+            /* The fiber parked holding the event lock; no signal can reach it until it is released. */
+            vl_fiber_event event = fiber->waitingOn;
+            if (fiber->wakeAt != 0)
+            {
+                vl_FiberTimerAdd(scheduler, fiber);
+            }
+            vlMutexRelease(event->lock);
+            break;
+        }
+        case VL_FIBER_SUSPEND_BLOCKING:
+        {
+            const vl_thread_pool_task task = {vl_FiberBlockingTask, fiber};
+            if (!vlThreadPoolEnqueue(scheduler->blockingPool, &task))
+            {
+                vl_FiberBlockingTask(fiber);
+            }
+            break;
+        }
+        case VL_FIBER_SUSPEND_DONE:
+            vl_FiberRecycle(fiber);
+            vlAtomicFetchAdd(&scheduler->fibersCompleted, 1);
+            vl_FiberReleaseLive(scheduler);
+            break;
+    }
+}
+
+/**
+ * \brief Pool task: runs one fiber until it suspends.
+ * \private
+ */
+static void vl_FiberResumeTask(void* arg)
+{
+    vl_fiber* fiber = (vl_fiber*)arg;
+    vl_fiber_host* host = &vlFiberTlsHost;
+
+    if (!host->initialized)
+    {
+        host->initialized = vl_FiberContextHostInit(&host->context);
+        if (!host->initialized)
+        {
+            /* Unreachable on supported platforms; retry rather than lose the fiber. */
+            vl_FiberSchedule(fiber);
+            return;
+        }
+    }
+
+    fiber->host = host;
+    host->current = fiber;
+    vl_FiberContextSwitch(&host->context, &fiber->context);
+    host->current = NULL;
+
+    vl_FiberAfterSuspend(fiber);
+}
+
+/**
+ * \brief Queues a resumption of `fiber` on the scheduler's pool.
+ * \private
+ */
+static vl_bool_t vl_FiberTrySchedule(vl_fiber* fiber)
+{
+    vl_fiber_scheduler* scheduler = fiber->scheduler;
+    const vl_thread_pool_task task = {vl_FiberResumeTask, fiber};
+    return vlThreadPoolEnqueuePriority(scheduler->pool, scheduler->priority, &task);
+}
+
+static void vl_FiberSchedule(vl_fiber* fiber)
+{
+    if (vl_FiberTrySchedule(fiber))
+    {
+        return;
+    }
+
+    /*
+     * The pool was shut down underneath the scheduler. The fiber is suspended
+     * mid-procedure, so it can be neither resumed nor recycled; its stack is
+     * released with the scheduler. Counting it out keeps waiters from hanging.
+     */
+    vl_fiber_scheduler* scheduler = fiber->scheduler;
+    vlAtomicFetchAdd(&scheduler->fibersFailed, 1);
+    vl_FiberReleaseLive(scheduler);
+}
+
+/**
+ * \brief Fiber entry point. Loops forever so a recycled descriptor resumes
+ * here to run its next procedure without re-initializing its stack.
+ * \private
+ */
+static void VL_FIBER_ENTRY_CALL vl_FiberEntry(void* arg)
+{
+    vl_fiber* fiber = (vl_fiber*)arg;
+
+    for (;;)
+    {
+        fiber->proc(fiber->userData);
+        vl_FiberSuspend(fiber, VL_FIBER_SUSPEND_DONE);
+    }
+}
+
+/**
+ * \brief Takes a pooled fiber, or allocates a new descriptor and stack.
+ * \private
+ */
+static vl_fiber* vl_FiberAcquire(vl_fiber_scheduler* scheduler)
+{
+    vlMutexObtain(scheduler->fiberLock);
+
+    vl_fiber* fiber = scheduler->freeFibers;
+    if (fiber != NULL)
+    {
+        scheduler->freeFibers = fiber->nextFree;
+        vlMutexRelease(scheduler->fiberLock);
+        return fiber;
+    }
+
+    const vl_pool_idx idx = vlPoolTake(&scheduler->fibers);
+    fiber = (vl_fiber*)vlPoolSample(&scheduler->fibers, idx);
+    memset(fiber, 0, sizeof(vl_fiber));
+    fiber->scheduler = scheduler;
+    vlAtomicInit(&fiber->parkSeq, 0);
+
+    if (!vl_FiberContextInit(&fiber->context, scheduler->stackSize, scheduler->guardPages, vl_FiberEntry, fiber))
+    {
+        vlPoolReturn(&scheduler->fibers, idx);
+        vlMutexRelease(scheduler->fiberLock);
+        return NULL;
+    }
+
+    fiber->nextAllocated = scheduler->allocatedFibers;
+    scheduler->allocatedFibers = fiber;
+    scheduler->stacksAllocated++;
+
+    vlMutexRelease(scheduler->fiberLock);
+    return fiber;
+}
+
+VL_API void vlFiberSchedulerConfigDefault(vl_fiber_scheduler_config* config)
+{
+    config->pool = NULL;
+    config->workers = 4;
+    config->priority = VL_THREAD_POOL_PRIORITY_MEDIUM;
+    config->stack_size = VL_FIBER_DEFAULT_STACK_SIZE;
+    config->guard_pages = VL_TRUE;
+    config->blocking_workers = 4;
+}
+
+VL_API vl_fiber_scheduler* vlFiberSchedulerNew(const vl_fiber_scheduler_config* config)
+{
+    if (config == NULL || config->priority < 0 || config->priority >= VL_THREAD_POOL_PRIORITY_COUNT)
+    {
+        return NULL;
+    }
+
+    /*
+     * A resumption that is rejected or run inline on a fiber stack would corrupt the scheduler. Every overflow
+     * policy can do one or the other once a tier is bounded, so only unbounded tiers of a running pool qualify.
+     */
+    if (config->pool != NULL && (config->pool->queueCapacity[config->priority] != 0 ||
+                                 vlAtomicLoad(&config->pool->state) != VL_THREAD_POOL_RUNNING))
+    {
+        return NULL;
+    }
+
+    vl_fiber_scheduler* scheduler = vlMemAllocType(vl_fiber_scheduler);
+    if (scheduler == NULL)
+    {
+        return NULL;
+    }
+    memset(scheduler, 0, sizeof(vl_fiber_scheduler));
+
+    const vl_memsize_t stackSize =
+        config->stack_size < VL_FIBER_MIN_STACK_SIZE ? VL_FIBER_MIN_STACK_SIZE : config->stack_size;
+    scheduler->stackSize = VL_MEMORY_PAD_UP(stackSize, vl_FiberPageSize());
+    scheduler->guardPages = config->guard_pages;
+    scheduler->priority = config->priority;
+
+    vlPoolInit(&scheduler->fibers, (vl_uint16_t)sizeof(vl_fiber));
+    vlAtomicInit(&scheduler->fibersSpawned, 0);
+    vlAtomicInit(&scheduler->fibersCompleted, 0);
+    vlAtomicInit(&scheduler->fibersFailed, 0);
+    vlAtomicInit(&scheduler->fibersLive, 0);
+
+    scheduler->fiberLock = vlMutexNew();
+    scheduler->idleLock = vlMutexNew();
+    scheduler->idle = vlConditionNew();
+    scheduler->timerLock = vlMutexNew();
+    scheduler->timerWake = vlConditionNew();
+
+    if (config->pool != NULL)
+    {
+        scheduler->pool = config->pool;
+    }
+    else
+    {
+        scheduler->pool = vlThreadPoolNew(config->workers == 0 ? 1 : config->workers);
+        scheduler->ownsPool = VL_TRUE;
+    }
+
+    vl_thread_pool_config blockingConfig;
+    vlThreadPoolConfigDefault(&blockingConfig);
+    blockingConfig.min_workers = 1;
+    blockingConfig.max_workers = config->blocking_workers == 0 ? 1 : config->blocking_workers;
+    blockingConfig.scale_up_backlog = 1;
+    blockingConfig.scale_up_delay_ms = 0; /* Blocking calls are long by definition; grow on first sight of a backlog. */
+    scheduler->blockingPool = vlThreadPoolNewConfig(&blockingConfig);
+
+    if (scheduler->fiberLock == NULL || scheduler->idleLock == NULL || scheduler->idle == NULL ||
+        scheduler->timerLock == NULL || scheduler->timerWake == NULL || scheduler->pool == NULL ||
+        scheduler->blockingPool == NULL)
+    {
+        vlFiberSchedulerDelete(scheduler);
+        return NULL;
+    }
+
+    scheduler->timerRunning = VL_TRUE;
+    scheduler->timerThread = vlThreadNew(vl_FiberTimerProc, scheduler);
+    if (scheduler->timerThread == VL_THREAD_NULL)
+    {
+        scheduler->timerRunning = VL_FALSE;
+        vlFiberSchedulerDelete(scheduler);
+        return NULL;
+    }
+
+    return scheduler;
+}
+
+VL_API void vlFiberSchedulerDelete(vl_fiber_scheduler* scheduler)
+{
+    if (scheduler == NULL)
+    {
+        return;
+    }
+
+    if (scheduler->timerThread != VL_THREAD_NULL)
+    {
+        vlMutexObtain(scheduler->timerLock);
+        scheduler->timerRunning = VL_FALSE;
+        vlConditionSignal(scheduler->timerWake);
+        vlMutexRelease(scheduler->timerLock);
+
+        vlThreadJoin(scheduler->timerThread);
+        vlThreadDelete(scheduler->timerThread);
+    }
+
+    if (scheduler->blockingPool != NULL)
+    {
+        vlThreadPoolDelete(scheduler->blockingPool);
+    }
+
+    if (scheduler->ownsPool && scheduler->pool != NULL)
+    {
+        vlThreadPoolDelete(scheduler->pool);
+    }
+
+    vl_fiber* fiber = scheduler->allocatedFibers;
+    while (fiber != NULL)
+    {
+        vl_fiber* next = fiber->nextAllocated;
+        vl_FiberContextFree(&fiber->context);
+        fiber = next;
+    }
+    vlPoolFree(&scheduler->fibers);
+
+    if (scheduler->timers != NULL)
+    {
+        vlMemFree((vl_memory*)scheduler->timers);
+    }
+
+    if (scheduler->fiberLock != NULL)
+    {
+        vlMutexDelete(scheduler->fiberLock);
+    }
+    if (scheduler->idleLock != NULL)
+    {
+        vlMutexDelete(scheduler->idleLock);
+    }
+    if (scheduler->idle != NULL)
+    {
+        vlConditionDelete(scheduler->idle);
+    }
+    if (scheduler->timerLock != NULL)
+    {
+        vlMutexDelete(scheduler->timerLock);
+    }
+    if (scheduler->timerWake != NULL)
+    {
+        vlConditionDelete(scheduler->timerWake);
+    }
+
+    vlMemFree((vl_memory*)scheduler);
+}
+
+VL_API vl_bool_t vlFiberSpawn(vl_fiber_scheduler* scheduler, vl_fiber_proc proc, void* user_data)
+{
+    if (scheduler == NULL || proc == NULL)
+    {
+        return VL_FALSE;
+    }
+
+    vl_fiber* fiber = vl_FiberAcquire(scheduler);
+    if (fiber == NULL)
+    {
+        return VL_FALSE;
+    }
+
+    fiber->proc = proc;
+    fiber->userData = user_data;
+
+    vlAtomicFetchAdd(&scheduler->fibersLive, 1);
+
+    if (!vl_FiberTrySchedule(fiber))
+    {
+        /* Never ran, so the descriptor is still at the top of its entry loop and can be reused. */
+        vl_FiberRecycle(fiber);
+        vl_FiberReleaseLive(scheduler);
+        return VL_FALSE;
+    }
+
+    vlAtomicFetchAdd(&scheduler->fibersSpawned, 1);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlFiberSchedulerWait(vl_fiber_scheduler* scheduler, vl_uint_t timeout_ms)
+{
+    if (scheduler == NULL)
+    {
+        return VL_FALSE;
+    }
+
+    const vl_ularge_t deadline = vlThreadMonotonicNano() + (vl_ularge_t)timeout_ms * 1000000ull;
+    vl_bool_t result = VL_TRUE;
+
+    vlMutexObtain(scheduler->idleLock);
+    while (vlAtomicLoad(&scheduler->fibersLive) > 0)
+    {
+        if (timeout_ms == 0)
+        {
+            vlConditionWait(scheduler->idle, scheduler->idleLock);
+            continue;
+        }
+
+        const vl_ularge_t now = vlThreadMonotonicNano();
+        if (now >= deadline)
+        {
+            result = VL_FALSE;
+            break;
+        }
+        vlConditionWaitTimeout(scheduler->idle, scheduler->idleLock, (deadline - now + 999999ull) / 1000000ull);
+    }
+    vlMutexRelease(scheduler->idleLock);
+
+    return result;
+}
+
+VL_API void vlFiberSchedulerGetStats(vl_fiber_scheduler* scheduler, vl_fiber_scheduler_stats* out_stats)
+{
+    if (scheduler == NULL || out_stats == NULL)
+    {
+        return;
+    }
+
+    out_stats->fibers_spawned = vlAtomicLoad(&scheduler->fibersSpawned);
+    out_stats->fibers_completed = vlAtomicLoad(&scheduler->fibersCompleted);
+    out_stats->fibers_failed = vlAtomicLoad(&scheduler->fibersFailed);
+    out_stats->fibers_live = vlAtomicLoad(&scheduler->fibersLive);
+    out_stats->stack_size = scheduler->stackSize;
+
+    vlMutexObtain(scheduler->fiberLock);
+    out_stats->stacks_allocated = scheduler->stacksAllocated;
+    vlMutexRelease(scheduler->fiberLock);
+}
+
+VL_API vl_fiber_scheduler* vlFiberCurrentScheduler(void)
+{
+    vl_fiber* fiber = vl_FiberSelf();
+    return fiber == NULL ? NULL : fiber->scheduler;
+}
+
+VL_API void vlFiberYield(void)
+{
+    vl_fiber* fiber = vl_FiberSelf();
+    if (fiber == NULL)
+    {
+        vlThreadYield();
+        return;
+    }
+
+    vl_FiberSuspend(fiber, VL_FIBER_SUSPEND_YIELD);
+}
+
+VL_API void vlFiberSleep(vl_ularge_t milliseconds)
+{
+    vl_fiber* fiber = vl_FiberSelf();
+    if (fiber == NULL)
+    {
+        vlThreadSleep(milliseconds);
+        return;
+    }
+
+    if (milliseconds == 0)
+    {
+        vl_FiberSuspend(fiber, VL_FIBER_SUSPEND_YIELD);
+        return;
+    }
+
+    vl_FiberPreparePark(fiber);
+    fiber->wakeAt = vlThreadMonotonicNano() + milliseconds * 1000000ull;
+    vl_FiberSuspend(fiber, VL_FIBER_SUSPEND_SLEEP);
+}
+
+VL_API void vlFiberBlocking(vl_fiber_proc proc, void* user_data)
+{
+    if (proc == NULL)
+    {
+        return;
+    }
+
+    vl_fiber* fiber = vl_FiberSelf();
+    if (fiber == NULL)
+    {
+        proc(user_data);
+        return;
+    }
+
+    fiber->blockingProc = proc;
+    fiber->blockingData = user_data;
+    vl_FiberSuspend(fiber, VL_FIBER_SUSPEND_BLOCKING);
+}
+
+VL_API vl_fiber_event vlFiberEventNew(void)
+{
+    vl_fiber_event event = vlMemAllocType(struct vl_fiber_event_);
+    if (event == NULL)
+    {
+        return NULL;
+    }
+
+    event->lock = vlMutexNew();
+    event->threadWake = vlConditionNew();
+    event->set = VL_FALSE;
+    event->waiters = NULL;
+
+    if (event->lock == NULL || event->threadWake == NULL)
+    {
+        vlFiberEventDelete(event);
+        return NULL;
+    }
+
+    return event;
+}
+
+VL_API void vlFiberEventDelete(vl_fiber_event event)
+{
+    if (event == NULL)
+    {
+        return;
+    }
+
+    if (event->lock != NULL)
+    {
+        vlMutexDelete(event->lock);
+    }
+    if (event->threadWake != NULL)
+    {
+        vlConditionDelete(event->threadWake);
+    }
+    vlMemFree((vl_memory*)event);
+}
+
+VL_API void vlFiberEventSet(vl_fiber_event event)
+{
+    if (event == NULL)
+    {
+        return;
+    }
+
+    vlMutexObtain(event->lock);
+    event->set = VL_TRUE;
+
+    vl_fiber* waiter = event->waiters;
+    event->waiters = NULL;
+    while (waiter != NULL)
+    {
+        /* Read the link first; a woken fiber may immediately wait elsewhere. */
+        vl_fiber* next = waiter->nextWaiter;
+        waiter->waitingOn = NULL;
+        vl_FiberWake(waiter, waiter->waitSeq, VL_FALSE);
+        waiter = next;
+    }
+
+    vlConditionBroadcast(event->threadWake);
+    vlMutexRelease(event->lock);
+}
+
+VL_API void vlFiberEventReset(vl_fiber_event event)
+{
+    if (event == NULL)
+    {
+        return;
+    }
+
+    vlMutexObtain(event->lock);
+    event->set = VL_FALSE;
+    vlMutexRelease(event->lock);
+}
+
+VL_API vl_bool_t vlFiberEventIsSet(vl_fiber_event event)
+{
+    if (event == NULL)
+    {
+        return VL_FALSE;
+    }
+
+    vlMutexObtain(event->lock);
+    const vl_bool_t set = event->set;
+    vlMutexRelease(event->lock);
+    return set;
+}
+
+VL_API vl_bool_t vlFiberEventWait(vl_fiber_event event, vl_uint_t timeout_ms)
+{
+    if (event == NULL)
+    {
+        return VL_FALSE;
+    }
+
+    const vl_ularge_t deadline = vlThreadMonotonicNano() + (vl_ularge_t)timeout_ms * 1000000ull;
+    vl_fiber* fiber = vl_FiberSelf();
+
+    vlMutexObtain(event->lock);
+
+    if (fiber == NULL)
+    {
+        while (!event->set)
+        {
+            if (timeout_ms == 0)
+            {
+                vlConditionWait(event->threadWake, event->lock);
+                continue;
+            }
+
+            const vl_ularge_t now = vlThreadMonotonicNano();
+            if (now >= deadline)
+            {
+                break;
+            }
+            vlConditionWaitTimeout(event->threadWake, event->lock, (deadline - now + 999999ull) / 1000000ull);
+        }
+
+        const vl_bool_t set = event->set;
+        vlMutexRelease(event->lock);
+        return set;
+    }
+
+    if (event->set)
+    {
+        vlMutexRelease(event->lock);
+        return VL_TRUE;
+    }
+
+    vl_FiberPreparePark(fiber);
+    fiber->wakeAt = timeout_ms == 0 ? 0 : deadline;
+    fiber->waitingOn = event;
+    fiber->prevWaiter = NULL;
+    fiber->nextWaiter = event->waiters;
+    if (event->waiters != NULL)
+    {
+        event->waiters->prevWaiter = fiber;
+    }
+    event->waiters = fiber;
+
+    /* The host releases the event lock once this fiber is off its stack. */
+    vl_FiberSuspend(fiber, VL_FIBER_SUSPEND_EVENT);
+
+    if (!fiber->timedOut)
+    {
+        return VL_TRUE;
+    }
+
+    /* The timer won; unlink unless a concurrent set already detached the waiter list. */
+    vlMutexObtain(event->lock);
+    if (fiber->waitingOn == event)
+    {
+        if (fiber->prevWaiter != NULL)
+        {
+            fiber->prevWaiter->nextWaiter = fiber->nextWaiter;
+        }
+        else
+        {
+            event->waiters = fiber->nextWaiter;
+        }
+        if (fiber->nextWaiter != NULL)
+        {
+            fiber->nextWaiter->prevWaiter = fiber->prevWaiter;
+        }
+        fiber->waitingOn = NULL;
+    }
+    vlMutexRelease(event->lock);
+
+    return VL_FALSE;
+}
@@ -5,8 +5,23 @@
 #endif
 
 #include "vl_filesys.h"
+#include "vl_simd.h"
 #include <string.h>
 
+/**
+ * \brief Finds the last occurrence of a character within the first `length` characters of a string.
+ * \param str
+ * \param length
+ * \param c
+ * \return pointer to the character, or NULL if it does not occur.
+ * \private
+ */
+static inline const char* vl_FSFindLast(const char* str, vl_memsize_t length, char c)
+{
+    const vl_dsidx_t index = vlSIMDFindLastU8((const vl_uint8_t*)str, (vl_dsidx_t)length, (vl_uint8_t)c);
+    return index < length ? str + index : NULL;
+}
+
 /**
  * \brief Parses out the path components of a stat structure's file path.
  * \param sys
@@ -22,8 +37,10 @@ static inline void vl_FSParsePathComponents(vl_filesys* sys, vl_filesys_stat* st
     const char* path = (const char*)vlArenaMemSample(&sys->memory, stat->filePath.pathStringPtr);
 
     // Find the last separator in the path
-    const char* lastSep = strrchr(path, VL_NATIVE_PATH_SEPARATOR_CHAR);
+    const vl_memsize_t pathLen = strlen(path);
+    const char* lastSep = vl_FSFindLast(path, pathLen, VL_NATIVE_PATH_SEPARATOR_CHAR);
     const char* filename = lastSep ? lastSep + 1 : path;
+    const vl_memsize_t filenameLen = pathLen - (vl_memsize_t)(filename - path);
 
     // Handle dot files properly: skip leading dots when looking for extension
     const char* extensionStart = filename;
@@ -35,7 +52,7 @@ static inline void vl_FSParsePathComponents(vl_filesys* sys, vl_filesys_stat* st
     }
 
     // Find the last dot in the filename portion after any leading dots
-    const char* lastDot = strrchr(extensionStart, '.');
+    const char* lastDot = vl_FSFindLast(extensionStart, filenameLen - (vl_memsize_t)(extensionStart - filename), '.');
 
     // If we found a dot and it's not at the start of extensionStart, it's a real
     // extension
@@ -50,7 +67,7 @@ static inline void vl_FSParsePathComponents(vl_filesys* sys, vl_filesys_stat* st
     }
 
     // Calculate lengths
-    const vl_memsize_t fullNameLen = strlen(filename) + 1;
+    const vl_memsize_t fullNameLen = filenameLen + 1;
     const vl_memsize_t baseNameLen = lastDot ? (vl_memsize_t)(lastDot - filename) + 1 : fullNameLen;
     const vl_memsize_t extensionLen = lastDot ? strlen(lastDot + 1) + 1 : 0;
 
@@ -78,7 +95,7 @@ static inline void vl_FSParsePathComponents(vl_filesys* sys, vl_filesys_stat* st
 
     // Then, fix our pointers
     path = (const char*)vlArenaMemSample(&sys->memory, stat->filePath.pathStringPtr);
-    lastSep = strrchr(path, VL_NATIVE_PATH_SEPARATOR_CHAR);
+    lastSep = vl_FSFindLast(path, pathLen, VL_NATIVE_PATH_SEPARATOR_CHAR);
     filename = lastSep ? lastSep + 1 : path;
 
     // Recalculate lastDot using the same logic
@@ -87,7 +104,7 @@ static inline void vl_FSParsePathComponents(vl_filesys* sys, vl_filesys_stat* st
     {
         extensionStart++;
     }
-    lastDot = strrchr(extensionStart, '.');
+    lastDot = vl_FSFindLast(extensionStart, filenameLen - (vl_memsize_t)(extensionStart - filename), '.');
     if (lastDot && lastDot != extensionStart)
     {
         lastDot = filename + (lastDot - extensionStart) + (extensionStart - filename);
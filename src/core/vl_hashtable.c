@@ -1,4 +1,5 @@
 #include "vl_hashtable.h"
+#include "vl_simd.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -9,7 +10,7 @@
  */
 static inline vl_usmall_t vl_HashTableBinCompare(const void* a, vl_memsize_t aSize, const void* b, vl_memsize_t bSize)
 {
-    return aSize != bSize ? 0 : memcmp(a, b, aSize) == 0;
+    return aSize != bSize ? 0 : vlSIMDEqualU8((const vl_uint8_t*)a, (const vl_uint8_t*)b, (vl_dsidx_t)aSize);
 }
 
 // grows the mapping table and re-builds collision chains.
@@ -0,0 +1,641 @@
+#include "vl_heap.h"
+
+#include <string.h>
+
+/**
+ * \brief Typed comparisons available to numeric heaps; 0 selects the comparator.
+ * \private
+ */
+enum
+{
+    VL_HEAP_KEY_COMPARATOR = 0,
+    VL_HEAP_KEY_I8,
+    VL_HEAP_KEY_U8,
+    VL_HEAP_KEY_I16,
+    VL_HEAP_KEY_U16,
+    VL_HEAP_KEY_I32,
+    VL_HEAP_KEY_U32,
+    VL_HEAP_KEY_I64,
+    VL_HEAP_KEY_U64,
+    VL_HEAP_KEY_F32,
+    VL_HEAP_KEY_F64
+};
+
+/**
+ * \brief Smallest capacity allocated by the first push.
+ * \private
+ */
+#define VL_HEAP_MIN_CAPACITY 16
+
+/**
+ * \brief Returns a pointer to the element slot at `index`.
+ * \private
+ */
+static inline vl_usmall_t* vl_HeapSlot(const vl_heap* heap, vl_dsidx_t index)
+{
+    return (vl_usmall_t*)heap->elements + (vl_memsize_t)index * heap->elementSize;
+}
+
+/**
+ * \brief Copies one element, with fixed-size copies for common element sizes.
+ * \private
+ */
+static inline void vl_HeapCopy(vl_usmall_t* dest, const vl_usmall_t* src, vl_memsize_t size)
+{
+    switch (size)
+    {
+        case 4:
+            memcpy(dest, src, 4);
+            break;
+        case 8:
+            memcpy(dest, src, 8);
+            break;
+        case 16:
+            memcpy(dest, src, 16);
+            break;
+        default:
+            memcpy(dest, src, size);
+            break;
+    }
+}
+
+/**
+ * \brief Writes an element and its handle into slot `index`.
+ * \private
+ */
+static inline void vl_HeapStore(vl_heap* heap, vl_dsidx_t index, const vl_usmall_t* element, vl_heap_handle handle)
+{
+    vl_usmall_t* const slot = vl_HeapSlot(heap, index);
+    if (slot != element)
+        vl_HeapCopy(slot, element, heap->elementSize);
+    heap->handles[index] = handle;
+    heap->positions[handle] = index;
+}
+
+/**
+ * \brief Copies the heap's fields into locals for the sift routines.
+ *
+ * Stores through the handle and position arrays may alias the heap struct as far as the compiler can tell, so fields
+ * read through `heap` inside a sift loop would be reloaded after every move.
+ * \private
+ */
+#define VL_HEAP_SIFT_LOCALS(heap)                                                                                      \
+    vl_usmall_t* const base = (vl_usmall_t*)(heap)->elements;                                                          \
+    vl_heap_handle* const handles = (heap)->handles;                                                                   \
+    vl_dsidx_t* const positions = (heap)->positions;                                                                   \
+    const vl_memsize_t size = (heap)->elementSize;                                                                     \
+    const vl_memsize_t keyOffset = (heap)->keyOffset;                                                                  \
+    const vl_compare_function comparator = (heap)->comparator;                                                         \
+    const vl_dsidx_t arity = (heap)->arity, count = (heap)->count;                                                     \
+    const vl_uint_t arityShift = (heap)->arityShift;                                                                   \
+    (void)comparator;                                                                                                  \
+    (void)count;                                                                                                       \
+    (void)arityShift
+
+/**
+ * \brief Moves the element in slot `src` into slot `dest` within a sift routine, along with its handle.
+ * \private
+ */
+#define VL_HEAP_SIFT_MOVE(dest, src)                                                                                   \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        const vl_heap_handle movedHandle = handles[src];                                                               \
+        vl_HeapCopy(base + (dest) * size, base + (src) * size, size);                                                  \
+        handles[dest] = movedHandle;                                                                                   \
+        positions[movedHandle] = (dest);                                                                               \
+    } while (0)
+
+/**
+ * \brief Finds the child in [first, end) that orders first, leaving its slot in `best` and its key in `bestKey`.
+ * \private
+ */
+#define VL_HEAP_SIFT_BEST_CHILD(KEY_T, KEY_LOAD, KEY_LESS, first, end, best, bestKey)                                  \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (best) = (first);                                                                                              \
+        (bestKey) = KEY_LOAD(base + (first) * size + keyOffset);                                                       \
+        for (vl_dsidx_t child = (first) + 1; child < (end); child++)                                                   \
+        {                                                                                                              \
+            const KEY_T childKey = KEY_LOAD(base + child * size + keyOffset);                                          \
+            const vl_bool_t childFirst = KEY_LESS(childKey, bestKey);                                                  \
+            (best) = childFirst ? child : (best);                                                                      \
+            (bestKey) = childFirst ? childKey : (bestKey);                                                             \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * \brief Defines the sift routines for one kind of key.
+ *
+ * Each routine moves a hole through the heap rather than swapping, shifting
+ * elements into the hole and returning the slot where the held element belongs.
+ * The held element must not live in a slot below `count`.
+ *
+ *  - SiftUp moves the hole toward the root while `held` orders before the parent.
+ *  - SiftDown moves the hole toward the leaves while a child orders before `held`.
+ *  - SiftHole moves the hole all the way down to a leaf, promoting the best child at each level.
+ *
+ * KEY_LOAD(key) reads the key at `key`, which is `keyOffset` bytes into an element, and KEY_LESS(a, b) tests whether
+ * key `a` orders before key `b`. Comparator heaps have a `keyOffset` of 0 and use the element itself as the key.
+ * \private
+ */
+#define VL_HEAP_DEFINE_SIFT(NAME, KEY_T, KEY_LOAD, KEY_LESS)                                                           \
+    static vl_dsidx_t vl_HeapSiftUp##NAME(vl_heap* heap, vl_dsidx_t hole, const vl_usmall_t* held)                     \
+    {                                                                                                                  \
+        VL_HEAP_SIFT_LOCALS(heap);                                                                                     \
+        const KEY_T heldKey = KEY_LOAD(held + keyOffset);                                                              \
+        while (hole > 0)                                                                                               \
+        {                                                                                                              \
+            const vl_dsidx_t parent = arityShift ? (hole - 1) >> arityShift : (hole - 1) / arity;                      \
+            if (!KEY_LESS(heldKey, KEY_LOAD(base + parent * size + keyOffset)))                                        \
+                break;                                                                                                 \
+            VL_HEAP_SIFT_MOVE(hole, parent);                                                                           \
+            hole = parent;                                                                                             \
+        }                                                                                                              \
+        return hole;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static vl_dsidx_t vl_HeapSiftDown##NAME(vl_heap* heap, vl_dsidx_t hole, const vl_usmall_t* held)                   \
+    {                                                                                                                  \
+        VL_HEAP_SIFT_LOCALS(heap);                                                                                     \
+        const KEY_T heldKey = KEY_LOAD(held + keyOffset);                                                              \
+        for (;;)                                                                                                       \
+        {                                                                                                              \
+            const vl_dsidx_t first = hole * arity + 1;                                                                 \
+            if (first >= count)                                                                                        \
+                break;                                                                                                 \
+            vl_dsidx_t best;                                                                                           \
+            KEY_T bestKey;                                                                                             \
+            VL_HEAP_SIFT_BEST_CHILD(KEY_T, KEY_LOAD, KEY_LESS, first, count - first > arity ? first + arity : count,   \
+                                    best, bestKey);                                                                    \
+            if (!KEY_LESS(bestKey, heldKey))                                                                           \
+                break;                                                                                                 \
+            VL_HEAP_SIFT_MOVE(hole, best);                                                                             \
+            hole = best;                                                                                               \
+        }                                                                                                              \
+        return hole;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static vl_dsidx_t vl_HeapSiftHole##NAME(vl_heap* heap, vl_dsidx_t hole)                                            \
+    {                                                                                                                  \
+        VL_HEAP_SIFT_LOCALS(heap);                                                                                     \
+        for (;;)                                                                                                       \
+        {                                                                                                              \
+            const vl_dsidx_t first = hole * arity + 1;                                                                 \
+            if (first >= count)                                                                                        \
+                break;                                                                                                 \
+            vl_dsidx_t best;                                                                                           \
+            KEY_T bestKey;                                                                                             \
+            VL_HEAP_SIFT_BEST_CHILD(KEY_T, KEY_LOAD, KEY_LESS, first, count - first > arity ? first + arity : count,   \
+                                    best, bestKey);                                                                    \
+            VL_HEAP_SIFT_MOVE(hole, best);                                                                             \
+            hole = best;                                                                                               \
+        }                                                                                                              \
+        return hole;                                                                                                   \
+    }
+
+/**
+ * \brief Key access for comparator heaps, whose keys are whole elements, and for numeric heaps.
+ * \private
+ */
+#define VL_HEAP_CMP_LOAD(slot) (slot)
+#define VL_HEAP_CMP_LESS(a, b) (comparator((a), (b)) < 0)
+#define VL_HEAP_KEY_LESS(a, b) ((a) < (b))
+
+VL_HEAP_DEFINE_SIFT(Cmp, const vl_usmall_t*, VL_HEAP_CMP_LOAD, VL_HEAP_CMP_LESS)
+
+/**
+ * \brief Defines a key loader and the sift routines for one numeric key type.
+ * \private
+ */
+#define VL_HEAP_DEFINE_NUMERIC(NAME, KEY_T)                                                                            \
+    static inline KEY_T vl_HeapLoad##NAME(const vl_usmall_t* key)                                                      \
+    {                                                                                                                  \
+        KEY_T value;                                                                                                   \
+        memcpy(&value, key, sizeof(KEY_T));                                                                            \
+        return value;                                                                                                  \
+    }                                                                                                                  \
+    VL_HEAP_DEFINE_SIFT(NAME, KEY_T, vl_HeapLoad##NAME, VL_HEAP_KEY_LESS)
+
+VL_HEAP_DEFINE_NUMERIC(I8, vl_int8_t)
+VL_HEAP_DEFINE_NUMERIC(U8, vl_uint8_t)
+VL_HEAP_DEFINE_NUMERIC(I16, vl_int16_t)
+VL_HEAP_DEFINE_NUMERIC(U16, vl_uint16_t)
+VL_HEAP_DEFINE_NUMERIC(I32, vl_int32_t)
+VL_HEAP_DEFINE_NUMERIC(U32, vl_uint32_t)
+VL_HEAP_DEFINE_NUMERIC(I64, vl_int64_t)
+VL_HEAP_DEFINE_NUMERIC(U64, vl_uint64_t)
+VL_HEAP_DEFINE_NUMERIC(F32, vl_float32_t)
+VL_HEAP_DEFINE_NUMERIC(F64, vl_float64_t)
+
+/**
+ * \brief Dispatches a sift routine on the heap's key kind.
+ * \private
+ */
+#define VL_HEAP_DISPATCH(heap, ROUTINE, ...)                                                                           \
+    switch ((heap)->keyKind)                                                                                           \
+    {                                                                                                                  \
+        case VL_HEAP_KEY_I8:                                                                                           \
+            return ROUTINE##I8(__VA_ARGS__);                                                                           \
+        case VL_HEAP_KEY_U8:                                                                                           \
+            return ROUTINE##U8(__VA_ARGS__);                                                                           \
+        case VL_HEAP_KEY_I16:                                                                                          \
+            return ROUTINE##I16(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_U16:                                                                                          \
+            return ROUTINE##U16(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_I32:                                                                                          \
+            return ROUTINE##I32(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_U32:                                                                                          \
+            return ROUTINE##U32(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_I64:                                                                                          \
+            return ROUTINE##I64(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_U64:                                                                                          \
+            return ROUTINE##U64(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_F32:                                                                                          \
+            return ROUTINE##F32(__VA_ARGS__);                                                                          \
+        case VL_HEAP_KEY_F64:                                                                                          \
+            return ROUTINE##F64(__VA_ARGS__);                                                                          \
+        default:                                                                                                       \
+            return ROUTINE##Cmp(__VA_ARGS__);                                                                          \
+    }
+
+/**
+ * \brief Moves a hole at `hole` toward the root for `held`; returns the slot `held` belongs in.
+ * \private
+ */
+static vl_dsidx_t vl_HeapSiftUp(vl_heap* heap, vl_dsidx_t hole, const vl_usmall_t* held)
+{
+    VL_HEAP_DISPATCH(heap, vl_HeapSiftUp, heap, hole, held)
+}
+
+/**
+ * \brief Moves a hole at `hole` toward the leaves for `held`; returns the slot `held` belongs in.
+ * \private
+ */
+static vl_dsidx_t vl_HeapSiftDown(vl_heap* heap, vl_dsidx_t hole, const vl_usmall_t* held)
+{
+    VL_HEAP_DISPATCH(heap, vl_HeapSiftDown, heap, hole, held)
+}
+
+/**
+ * \brief Moves a hole at `hole` down to a leaf; returns the leaf slot.
+ * \private
+ */
+static vl_dsidx_t vl_HeapSiftHole(vl_heap* heap, vl_dsidx_t hole)
+{
+    VL_HEAP_DISPATCH(heap, vl_HeapSiftHole, heap, hole)
+}
+
+/**
+ * \brief Places `held`, which was taken out of slot `hole`, wherever restores heap order around that slot.
+ * \private
+ */
+static void vl_HeapRestore(vl_heap* heap, vl_dsidx_t hole, const vl_usmall_t* held, vl_heap_handle handle)
+{
+    vl_dsidx_t slot = vl_HeapSiftUp(heap, hole, held);
+    if (slot == hole)
+        slot = vl_HeapSiftDown(heap, hole, held);
+    vl_HeapStore(heap, slot, held, handle);
+}
+
+/**
+ * \brief Restores heap order over the whole array, bottom-up.
+ * \private
+ */
+static void vl_HeapHeapify(vl_heap* heap)
+{
+    if (heap->count < 2)
+        return;
+
+    vl_usmall_t* const scratch = vl_HeapSlot(heap, heap->capacity);
+    for (vl_dsidx_t i = (heap->count - 2) / heap->arity + 1; i-- > 0;)
+    {
+        const vl_heap_handle handle = heap->handles[i];
+        vl_HeapCopy(scratch, vl_HeapSlot(heap, i), heap->elementSize);
+        vl_HeapStore(heap, vl_HeapSiftDown(heap, i, scratch), scratch, handle);
+    }
+}
+
+/**
+ * \brief Selects the typed comparison for a key type.
+ * \private
+ */
+static vl_uint8_t vl_HeapKeyKind(const vl_numtype_info* info)
+{
+    if (info->isFloating)
+        return info->size == 4 ? VL_HEAP_KEY_F32 : info->size == 8 ? VL_HEAP_KEY_F64 : VL_HEAP_KEY_COMPARATOR;
+
+    switch (info->size)
+    {
+        case 1:
+            return info->isSigned ? VL_HEAP_KEY_I8 : VL_HEAP_KEY_U8;
+        case 2:
+            return info->isSigned ? VL_HEAP_KEY_I16 : VL_HEAP_KEY_U16;
+        case 4:
+            return info->isSigned ? VL_HEAP_KEY_I32 : VL_HEAP_KEY_U32;
+        case 8:
+            return info->isSigned ? VL_HEAP_KEY_I64 : VL_HEAP_KEY_U64;
+        default:
+            return VL_HEAP_KEY_COMPARATOR;
+    }
+}
+
+VL_API void vlHeapInit(vl_heap* heap, vl_memsize_t elementSize, vl_dsidx_t arity, vl_compare_function comparator)
+{
+    heap->elements = NULL;
+    heap->handles = NULL;
+    heap->positions = NULL;
+    heap->elementSize = elementSize;
+    heap->count = 0;
+    heap->capacity = 0;
+    heap->handleCount = 0;
+    heap->arity = arity == 0 ? VL_HEAP_DEFAULT_ARITY : (arity < 2 ? 2 : arity);
+    heap->arityShift = 0;
+    if ((heap->arity & (heap->arity - 1)) == 0)
+        while (((vl_dsidx_t)1 << heap->arityShift) < heap->arity)
+            heap->arityShift++;
+    heap->comparator = comparator;
+    heap->keyOffset = 0;
+    heap->keyType = VL_NUMTYPE_MAX;
+    heap->keyKind = VL_HEAP_KEY_COMPARATOR;
+}
+
+VL_API vl_bool_t vlHeapInitNumeric(vl_heap* heap, vl_memsize_t elementSize, vl_dsidx_t arity, vl_numtype keyType,
+                                   vl_memsize_t keyOffset)
+{
+    if ((vl_uint_t)keyType >= VL_NUMTYPE_MAX)
+        return VL_FALSE;
+
+    const vl_numtype_info* info = &VL_NUMTYPE_INFO[keyType];
+    const vl_uint8_t kind = vl_HeapKeyKind(info);
+    if (kind == VL_HEAP_KEY_COMPARATOR || keyOffset + info->size > elementSize)
+        return VL_FALSE;
+
+    vlHeapInit(heap, elementSize, arity, NULL);
+    heap->keyOffset = keyOffset;
+    heap->keyType = keyType;
+    heap->keyKind = kind;
+    return VL_TRUE;
+}
+
+VL_API void vlHeapFree(vl_heap* heap)
+{
+    if (heap->elements != NULL)
+        vlMemFree(heap->elements);
+    if (heap->handles != NULL)
+        vlMemFree((vl_memory*)heap->handles);
+    if (heap->positions != NULL)
+        vlMemFree((vl_memory*)heap->positions);
+
+    heap->elements = NULL;
+    heap->handles = NULL;
+    heap->positions = NULL;
+    heap->count = heap->capacity = heap->handleCount = 0;
+}
+
+VL_API vl_heap* vlHeapNew(vl_memsize_t elementSize, vl_dsidx_t arity, vl_compare_function comparator)
+{
+    vl_heap* heap = (vl_heap*)vlMemAlloc(sizeof(vl_heap));
+    if (heap == NULL)
+        return NULL;
+    vlHeapInit(heap, elementSize, arity, comparator);
+    return heap;
+}
+
+VL_API void vlHeapDelete(vl_heap* heap)
+{
+    if (heap == NULL)
+        return;
+    vlHeapFree(heap);
+    vlMemFree((vl_memory*)heap);
+}
+
+VL_API void vlHeapClear(vl_heap* heap) { heap->count = heap->handleCount = 0; }
+
+VL_API vl_bool_t vlHeapReserve(vl_heap* heap, vl_dsidx_t numElements)
+{
+    if (numElements <= heap->capacity)
+        return VL_TRUE;
+
+    vl_dsidx_t capacity = heap->capacity < VL_HEAP_MIN_CAPACITY ? VL_HEAP_MIN_CAPACITY : heap->capacity;
+    while (capacity < numElements)
+        capacity *= 2;
+
+    // Storage only grows, so a failure part way through leaves the heap consistent at its old capacity.
+    vl_memory* elements = vlMemRealloc(heap->elements, (vl_memsize_t)(capacity + 1) * heap->elementSize);
+    if (elements == NULL)
+        return VL_FALSE;
+    heap->elements = elements;
+
+    vl_memory* handles = vlMemRealloc((vl_memory*)heap->handles, capacity * sizeof(vl_heap_handle));
+    if (handles == NULL)
+        return VL_FALSE;
+    heap->handles = (vl_heap_handle*)handles;
+
+    vl_memory* positions = vlMemRealloc((vl_memory*)heap->positions, capacity * sizeof(vl_dsidx_t));
+    if (positions == NULL)
+        return VL_FALSE;
+    heap->positions = (vl_dsidx_t*)positions;
+
+    heap->capacity = capacity;
+    return VL_TRUE;
+}
+
+VL_API vl_heap* vlHeapClone(const vl_heap* src, vl_heap* dest)
+{
+    if (src == dest)
+        return dest;
+
+    vl_bool_t allocated = VL_FALSE;
+    if (dest == NULL)
+    {
+        dest = vlHeapNew(src->elementSize, src->arity, src->comparator);
+        if (dest == NULL)
+            return NULL;
+        allocated = VL_TRUE;
+    }
+
+    // Storage sized for another element size is regrown from scratch; vlMemRealloc keeps the allocations.
+    if (dest->elementSize != src->elementSize)
+        dest->capacity = 0;
+    dest->count = dest->handleCount = 0;
+    dest->elementSize = src->elementSize;
+    if (!vlHeapReserve(dest, src->handleCount))
+    {
+        if (allocated)
+            vlHeapDelete(dest);
+        return NULL;
+    }
+
+    if (src->handleCount > 0)
+    {
+        memcpy(dest->elements, src->elements, (vl_memsize_t)src->count * src->elementSize);
+        memcpy(dest->handles, src->handles, src->handleCount * sizeof(vl_heap_handle));
+        memcpy(dest->positions, src->positions, src->handleCount * sizeof(vl_dsidx_t));
+    }
+
+    dest->count = src->count;
+    dest->handleCount = src->handleCount;
+    dest->arity = src->arity;
+    dest->arityShift = src->arityShift;
+    dest->comparator = src->comparator;
+    dest->keyOffset = src->keyOffset;
+    dest->keyType = src->keyType;
+    dest->keyKind = src->keyKind;
+    return dest;
+}
+
+/**
+ * \brief Takes the next free handle, assuming the heap has room for one more element.
+ * \private
+ */
+static inline vl_heap_handle vl_HeapTakeHandle(vl_heap* heap)
+{
+    // Handles freed by pops and removals sit in the handle slots just past count.
+    return heap->count < heap->handleCount ? heap->handles[heap->count] : heap->handleCount++;
+}
+
+VL_API vl_heap_handle vlHeapPush(vl_heap* heap, const void* element)
+{
+    if (heap->count == heap->capacity && !vlHeapReserve(heap, heap->count + 1))
+        return VL_HEAP_HANDLE_INVALID;
+
+    const vl_heap_handle handle = vl_HeapTakeHandle(heap);
+    const vl_dsidx_t hole = heap->count++;
+    vl_HeapStore(heap, vl_HeapSiftUp(heap, hole, (const vl_usmall_t*)element), (const vl_usmall_t*)element, handle);
+    return handle;
+}
+
+VL_API vl_bool_t vlHeapPushArray(vl_heap* heap, const void* elements, vl_dsidx_t numElements,
+                                 vl_heap_handle* handles)
+{
+    if (numElements == 0)
+        return VL_TRUE;
+    if (!vlHeapReserve(heap, heap->count + numElements))
+        return VL_FALSE;
+
+    const vl_usmall_t* element = (const vl_usmall_t*)elements;
+    if (numElements < heap->count)
+    {
+        for (vl_dsidx_t i = 0; i < numElements; i++, element += heap->elementSize)
+        {
+            const vl_heap_handle handle = vlHeapPush(heap, element);
+            if (handles != NULL)
+                handles[i] = handle;
+        }
+        return VL_TRUE;
+    }
+
+    for (vl_dsidx_t i = 0; i < numElements; i++, element += heap->elementSize)
+    {
+        const vl_heap_handle handle = vl_HeapTakeHandle(heap);
+        vl_HeapStore(heap, heap->count++, element, handle);
+        if (handles != NULL)
+            handles[i] = handle;
+    }
+    vl_HeapHeapify(heap);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlHeapBuild(vl_heap* heap, const void* elements, vl_dsidx_t numElements)
+{
+    if (!vlHeapReserve(heap, numElements))
+        return VL_FALSE;
+
+    if (numElements > 0)
+        memcpy(heap->elements, elements, (vl_memsize_t)numElements * heap->elementSize);
+    for (vl_dsidx_t i = 0; i < numElements; i++)
+        heap->handles[i] = heap->positions[i] = i;
+
+    heap->count = heap->handleCount = numElements;
+    vl_HeapHeapify(heap);
+    return VL_TRUE;
+}
+
+VL_API void* vlHeapPeek(const vl_heap* heap) { return heap->count > 0 ? heap->elements : NULL; }
+
+VL_API vl_heap_handle vlHeapPeekHandle(const vl_heap* heap)
+{
+    return heap->count > 0 ? heap->handles[0] : VL_HEAP_HANDLE_INVALID;
+}
+
+VL_API vl_heap_handle vlHeapPop(vl_heap* heap, void* dest)
+{
+    if (heap->count == 0)
+        return VL_HEAP_HANDLE_INVALID;
+
+    const vl_heap_handle rootHandle = heap->handles[0];
+    if (dest != NULL)
+        vl_HeapCopy((vl_usmall_t*)dest, vl_HeapSlot(heap, 0), heap->elementSize);
+
+    const vl_dsidx_t last = --heap->count;
+    if (last > 0)
+    {
+        // The last element usually belongs near the bottom, so walk the hole down to a leaf first and then sift the
+        // element up from there; this spends one comparison per level instead of two.
+        const vl_heap_handle lastHandle = heap->handles[last];
+        const vl_usmall_t* held = vl_HeapSlot(heap, last);
+        const vl_dsidx_t leaf = vl_HeapSiftHole(heap, 0);
+        vl_HeapStore(heap, vl_HeapSiftUp(heap, leaf, held), held, lastHandle);
+    }
+
+    heap->handles[last] = rootHandle;
+    heap->positions[rootHandle] = last;
+    return rootHandle;
+}
+
+VL_API vl_dsidx_t vlHeapPopArray(vl_heap* heap, void* dest, vl_dsidx_t numElements)
+{
+    vl_usmall_t* out = (vl_usmall_t*)dest;
+    vl_dsidx_t popped = 0;
+    while (popped < numElements && heap->count > 0)
+    {
+        vlHeapPop(heap, out);
+        if (out != NULL)
+            out += heap->elementSize;
+        popped++;
+    }
+    return popped;
+}
+
+VL_API vl_bool_t vlHeapContains(const vl_heap* heap, vl_heap_handle handle)
+{
+    return handle < heap->handleCount && heap->positions[handle] < heap->count;
+}
+
+VL_API void* vlHeapSample(const vl_heap* heap, vl_heap_handle handle)
+{
+    return vl_HeapSlot(heap, heap->positions[handle]);
+}
+
+VL_API vl_bool_t vlHeapUpdate(vl_heap* heap, vl_heap_handle handle, const void* element)
+{
+    if (!vlHeapContains(heap, handle))
+        return VL_FALSE;
+
+    const vl_dsidx_t hole = heap->positions[handle];
+    vl_usmall_t* const scratch = vl_HeapSlot(heap, heap->capacity);
+    memmove(scratch, element != NULL ? element : vl_HeapSlot(heap, hole), heap->elementSize);
+    vl_HeapRestore(heap, hole, scratch, handle);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlHeapRemove(vl_heap* heap, vl_heap_handle handle, void* dest)
+{
+    if (!vlHeapContains(heap, handle))
+        return VL_FALSE;
+
+    const vl_dsidx_t hole = heap->positions[handle];
+    if (dest != NULL)
+        vl_HeapCopy((vl_usmall_t*)dest, vl_HeapSlot(heap, hole), heap->elementSize);
+
+    const vl_dsidx_t last = --heap->count;
+    if (hole != last)
+    {
+        const vl_heap_handle lastHandle = heap->handles[last];
+        vl_HeapRestore(heap, hole, vl_HeapSlot(heap, last), lastHandle);
+    }
+
+    heap->handles[last] = handle;
+    heap->positions[handle] = last;
+    return VL_TRUE;
+}
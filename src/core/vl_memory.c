@@ -1,4 +1,5 @@
 #include "vl_memory.h"
+#include "vl_simd.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -135,106 +136,783 @@ vl_memory* vlMemClone(vl_memory* mem)
     return alloc;
 }
 
-#ifdef vl_MemSortSwap
-#undef vl_MemSortSwap
+/**
+ * \brief Partitions smaller than this are finished with insertion sort.
+ * \private
+ */
+#define VL_MEM_SORT_INSERTION_THRESHOLD 24
+
+/**
+ * \brief Partitions larger than this choose their pivot with Tukey's ninther.
+ * \private
+ */
+#define VL_MEM_SORT_NINTHER_THRESHOLD 128
+
+/**
+ * \brief Elements moved before a partial insertion sort gives up.
+ * \private
+ */
+#define VL_MEM_SORT_PARTIAL_LIMIT 8
+
+/**
+ * \brief Largest element size whose scratch space lives on the stack.
+ * \private
+ */
+#define VL_MEM_SORT_STACK_ELEMENT 64
+
+/**
+ * \brief State shared by every level of a single vlMemSort call.
+ * \private
+ */
+typedef struct
+{
+    vl_memsize_t size;
+    vl_compare_function compare;
+    vl_usmall_t* pivot; // Copy of the current partition's pivot.
+    vl_usmall_t* hole;  // Element being inserted during insertion sort.
+} vl_mem_sort_context;
+
+/**
+ * \brief Swaps two elements, with fixed-width paths for 4, 8 and 16-byte types.
+ *
+ * The element size is constant for a whole sort, so the switch is perfectly predicted.
+ * \private
+ */
+static inline void vl_MemSortSwap(vl_usmall_t* a, vl_usmall_t* b, vl_memsize_t size)
+{
+    switch (size)
+    {
+#ifdef VL_U32_T
+        case 4:
+        {
+            vl_uint32_t ta, tb;
+            memcpy(&ta, a, 4);
+            memcpy(&tb, b, 4);
+            memcpy(a, &tb, 4);
+            memcpy(b, &ta, 4);
+            return;
+        }
 #endif
+#ifdef VL_U64_T
+        case 8:
+        {
+            vl_uint64_t ta, tb;
+            memcpy(&ta, a, 8);
+            memcpy(&tb, b, 8);
+            memcpy(a, &tb, 8);
+            memcpy(b, &ta, 8);
+            return;
+        }
+        case 16:
+        {
+            vl_uint64_t ta[2], tb[2];
+            memcpy(ta, a, 16);
+            memcpy(tb, b, 16);
+            memcpy(a, tb, 16);
+            memcpy(b, ta, 16);
+            return;
+        }
+#endif
+        default:
+        {
+            vl_usmall_t chunk[VL_MEM_SORT_STACK_ELEMENT];
+            while (size > 0)
+            {
+                const vl_memsize_t step = size < sizeof(chunk) ? size : sizeof(chunk);
+                memcpy(chunk, a, step);
+                memcpy(a, b, step);
+                memcpy(b, chunk, step);
+                a += step;
+                b += step;
+                size -= step;
+            }
+            return;
+        }
+    }
+}
 
-#define vl_MemSortSwap(temp, a, b, memSize)                                                                            \
-    memcpy(temp, a, memSize);                                                                                          \
-    memcpy(a, b, memSize);                                                                                             \
-    memcpy(b, temp, memSize)
+/**
+ * \brief Returns true if `a` orders strictly before `b`.
+ * \private
+ */
+static inline vl_bool_t vl_MemSortLess(const vl_mem_sort_context* ctx, const void* a, const void* b)
+{
+    return ctx->compare(a, b) < 0;
+}
 
-vl_int_t vl_MemSortPartition(vl_usmall_t* buffer, void* pivot, void* swap, vl_int_t low, vl_int_t high,
-                             vl_memsize_t elementSize, vl_compare_function comparator)
+/**
+ * \brief Orders two elements.
+ * \private
+ */
+static inline void vl_MemSortTwo(const vl_mem_sort_context* ctx, vl_usmall_t* a, vl_usmall_t* b)
 {
-    memcpy(pivot, buffer + (high * elementSize), elementSize);
-    vl_int_t i = (low - 1);
+    if (vl_MemSortLess(ctx, b, a))
+        vl_MemSortSwap(a, b, ctx->size);
+}
 
-    for (vl_int_t j = low; j <= high - 1; j++)
+/**
+ * \brief Orders three elements so the median ends up in `b`.
+ * \private
+ */
+static inline void vl_MemSortThree(const vl_mem_sort_context* ctx, vl_usmall_t* a, vl_usmall_t* b, vl_usmall_t* c)
+{
+    vl_MemSortTwo(ctx, a, b);
+    vl_MemSortTwo(ctx, b, c);
+    vl_MemSortTwo(ctx, a, b);
+}
+
+/**
+ * \brief Moves the element at `cur` down to `dest`, shifting the run between them up by one.
+ * \private
+ */
+static inline void vl_MemSortRotate(const vl_mem_sort_context* ctx, vl_usmall_t* dest, vl_usmall_t* cur)
+{
+    const vl_memsize_t size = ctx->size;
+    memcpy(ctx->hole, cur, size);
+    memmove(dest + size, dest, (vl_memsize_t)(cur - dest));
+    memcpy(dest, ctx->hole, size);
+}
+
+/**
+ * \brief Insertion sort over `[begin, end)`.
+ *
+ * When `guarded` is false, the element before `begin` must be no greater than
+ * any element in the range, which lets the inner scan skip its bounds check.
+ * \private
+ */
+static void vl_MemSortInsertion(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end,
+                                vl_bool_t guarded)
+{
+    const vl_memsize_t size = ctx->size;
+    if (begin == end)
+        return;
+
+    for (vl_usmall_t* cur = begin + size; cur < end; cur += size)
     {
-        if (comparator(buffer + (j * elementSize), pivot) <= 0)
+        if (!vl_MemSortLess(ctx, cur, cur - size))
+            continue;
+
+        vl_usmall_t* sift = cur - size;
+        if (guarded)
         {
-            i++;
-            vl_MemSortSwap(swap, buffer + (i * elementSize), buffer + (j * elementSize), elementSize);
+            while (sift > begin && vl_MemSortLess(ctx, cur, sift - size))
+                sift -= size;
         }
+        else
+        {
+            while (vl_MemSortLess(ctx, cur, sift - size))
+                sift -= size;
+        }
+
+        vl_MemSortRotate(ctx, sift, cur);
     }
+}
 
-    vl_MemSortSwap(swap, buffer + ((i + 1) * elementSize), buffer + (high * elementSize), elementSize);
-    return (i + 1);
+/**
+ * \brief Insertion sort that gives up after moving VL_MEM_SORT_PARTIAL_LIMIT elements.
+ *
+ * Returns true if the range ended up sorted. Lets already-sorted inputs finish in linear time.
+ * \private
+ */
+static vl_bool_t vl_MemSortPartialInsertion(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end)
+{
+    const vl_memsize_t size = ctx->size;
+    vl_memsize_t moved = 0;
+
+    if (begin == end)
+        return VL_TRUE;
+
+    for (vl_usmall_t* cur = begin + size; cur < end; cur += size)
+    {
+        if (!vl_MemSortLess(ctx, cur, cur - size))
+            continue;
+
+        vl_usmall_t* sift = cur - size;
+        while (sift > begin && vl_MemSortLess(ctx, cur, sift - size))
+            sift -= size;
+
+        vl_MemSortRotate(ctx, sift, cur);
+        moved += (vl_memsize_t)(cur - sift) / size;
+
+        if (moved > VL_MEM_SORT_PARTIAL_LIMIT)
+            return VL_FALSE;
+    }
+
+    return VL_TRUE;
 }
 
-#undef vl_MemSortSwap
+/**
+ * \brief Restores the max-heap property below `root` within a heap of `count` elements.
+ * \private
+ */
+static void vl_MemSortSiftDown(const vl_mem_sort_context* ctx, vl_usmall_t* base, vl_memsize_t root,
+                               vl_memsize_t count)
+{
+    const vl_memsize_t size = ctx->size;
 
-void vl_MemSortQuicksort(vl_int_t* stack, void* buffer, void* pivot, void* swap, vl_memsize_t elementSize,
-                         vl_dsidx_t numElements, vl_compare_function comparator)
+    for (;;)
+    {
+        vl_memsize_t child = 2 * root + 1;
+        if (child >= count)
+            return;
+
+        if (child + 1 < count && vl_MemSortLess(ctx, base + child * size, base + (child + 1) * size))
+            child++;
+
+        if (!vl_MemSortLess(ctx, base + root * size, base + child * size))
+            return;
+
+        vl_MemSortSwap(base + root * size, base + child * size, size);
+        root = child;
+    }
+}
+
+/**
+ * \brief Heapsort fallback that bounds the worst case at O(n log n).
+ * \private
+ */
+static void vl_MemSortHeap(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end)
 {
-    vl_int_t top = -1, p, low, high;
+    const vl_memsize_t size = ctx->size;
+    const vl_memsize_t count = (vl_memsize_t)(end - begin) / size;
 
-    stack[++top] = 0;
-    stack[++top] = numElements - 1;
+    for (vl_memsize_t i = count / 2; i > 0; i--)
+        vl_MemSortSiftDown(ctx, begin, i - 1, count);
 
-    while (top >= 0)
+    for (vl_memsize_t i = count - 1; i > 0; i--)
     {
-        high = stack[top--];
-        low = stack[top--];
+        vl_MemSortSwap(begin, begin + i * size, size);
+        vl_MemSortSiftDown(ctx, begin, 0, i);
+    }
+}
+
+/**
+ * \brief Partitions `[begin, end)` around the pivot at `begin`; equal elements go right.
+ *
+ * Returns the pivot's final position. `alreadyPartitioned` is set when no swaps were needed.
+ * \private
+ */
+static vl_usmall_t* vl_MemSortPartitionRight(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end,
+                                             vl_bool_t* alreadyPartitioned)
+{
+    const vl_memsize_t size = ctx->size;
+    vl_usmall_t* const pivot = ctx->pivot;
+    memcpy(pivot, begin, size);
+
+    vl_usmall_t* first = begin;
+    vl_usmall_t* last = end;
 
-        p = vl_MemSortPartition(buffer, pivot, swap, low, high, elementSize, comparator);
+    // The median-of-3 guarantees an element >= pivot exists, so this scan is bounded.
+    do
+        first += size;
+    while (vl_MemSortLess(ctx, first, pivot));
 
-        if (p - 1 > low)
+    // Without such an element on the left we must guard the right scan.
+    if (first - size == begin)
+    {
+        do
+            last -= size;
+        while (first < last && !vl_MemSortLess(ctx, last, pivot));
+    }
+    else
+    {
+        do
+            last -= size;
+        while (!vl_MemSortLess(ctx, last, pivot));
+    }
+
+    *alreadyPartitioned = first >= last;
+
+    while (first < last)
+    {
+        vl_MemSortSwap(first, last, size);
+        do
+            first += size;
+        while (vl_MemSortLess(ctx, first, pivot));
+        do
+            last -= size;
+        while (!vl_MemSortLess(ctx, last, pivot));
+    }
+
+    vl_usmall_t* const pivotPos = first - size;
+    memcpy(begin, pivotPos, size);
+    memcpy(pivotPos, pivot, size);
+    return pivotPos;
+}
+
+/**
+ * \brief Partitions `[begin, end)` around the pivot at `begin`; equal elements go left.
+ *
+ * Used when the pivot equals its predecessor, so the whole equal run is finished in one pass.
+ * \private
+ */
+static vl_usmall_t* vl_MemSortPartitionLeft(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end)
+{
+    const vl_memsize_t size = ctx->size;
+    vl_usmall_t* const pivot = ctx->pivot;
+    memcpy(pivot, begin, size);
+
+    vl_usmall_t* first = begin;
+    vl_usmall_t* last = end;
+
+    do
+        last -= size;
+    while (vl_MemSortLess(ctx, pivot, last));
+
+    if (last + size == end)
+    {
+        do
+            first += size;
+        while (first < last && !vl_MemSortLess(ctx, pivot, first));
+    }
+    else
+    {
+        do
+            first += size;
+        while (!vl_MemSortLess(ctx, pivot, first));
+    }
+
+    while (first < last)
+    {
+        vl_MemSortSwap(first, last, size);
+        do
+            last -= size;
+        while (vl_MemSortLess(ctx, pivot, last));
+        do
+            first += size;
+        while (!vl_MemSortLess(ctx, pivot, first));
+    }
+
+    memcpy(begin, last, size);
+    memcpy(last, pivot, size);
+    return last;
+}
+
+/**
+ * \brief Breaks up a pattern after an unbalanced partition by swapping a few elements from the run's quartiles.
+ * \private
+ */
+static void vl_MemSortShuffle(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end)
+{
+    const vl_memsize_t size = ctx->size;
+    const vl_memsize_t count = (vl_memsize_t)(end - begin) / size;
+    const vl_memsize_t quarter = count / 4;
+
+    if (count < VL_MEM_SORT_INSERTION_THRESHOLD)
+        return;
+
+    vl_MemSortSwap(begin, begin + quarter * size, size);
+    vl_MemSortSwap(end - size, end - quarter * size, size);
+
+    if (count > VL_MEM_SORT_NINTHER_THRESHOLD)
+    {
+        vl_MemSortSwap(begin + size, begin + (quarter + 1) * size, size);
+        vl_MemSortSwap(begin + 2 * size, begin + (quarter + 2) * size, size);
+        vl_MemSortSwap(end - 2 * size, end - (quarter + 1) * size, size);
+        vl_MemSortSwap(end - 3 * size, end - (quarter + 2) * size, size);
+    }
+}
+
+/**
+ * \brief Moves the median of 3 (or Tukey's ninther, for large ranges) of `[begin, end)` to `begin`.
+ * \private
+ */
+static inline void vl_MemSortPivot(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end,
+                                   vl_memsize_t count)
+{
+    const vl_memsize_t size = ctx->size;
+    vl_usmall_t* const mid = begin + (count / 2) * size;
+    if (count > VL_MEM_SORT_NINTHER_THRESHOLD)
+    {
+        vl_MemSortThree(ctx, begin, mid, end - size);
+        vl_MemSortThree(ctx, begin + size, mid - size, end - 2 * size);
+        vl_MemSortThree(ctx, begin + 2 * size, mid + size, end - 3 * size);
+        vl_MemSortThree(ctx, mid - size, mid, mid + size);
+        vl_MemSortSwap(begin, mid, size);
+    }
+    else
+    {
+        vl_MemSortThree(ctx, mid, begin, end - size);
+    }
+}
+
+/**
+ * \brief Pattern-defeating quicksort over `[begin, end)`.
+ *
+ * Recurses into the smaller partition and loops on the larger, so stack depth
+ * stays logarithmic. `badAllowed` counts the unbalanced partitions tolerated
+ * before falling back to heapsort. `leftmost` is false when the element before
+ * `begin` is known to be no greater than anything in the range.
+ * \private
+ */
+static void vl_MemSortLoop(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end,
+                           vl_uint_t badAllowed, vl_bool_t leftmost)
+{
+    const vl_memsize_t size = ctx->size;
+
+    for (;;)
+    {
+        const vl_memsize_t count = (vl_memsize_t)(end - begin) / size;
+
+        if (count < VL_MEM_SORT_INSERTION_THRESHOLD)
+        {
+            vl_MemSortInsertion(ctx, begin, end, leftmost);
+            return;
+        }
+
+        vl_MemSortPivot(ctx, begin, end, count);
+
+        // A pivot equal to the predecessor means everything equal to it can be skipped.
+        if (!leftmost && !vl_MemSortLess(ctx, begin - size, begin))
+        {
+            begin = vl_MemSortPartitionLeft(ctx, begin, end) + size;
+            continue;
+        }
+
+        vl_bool_t alreadyPartitioned;
+        vl_usmall_t* const pivotPos = vl_MemSortPartitionRight(ctx, begin, end, &alreadyPartitioned);
+
+        const vl_memsize_t leftCount = (vl_memsize_t)(pivotPos - begin) / size;
+        const vl_memsize_t rightCount = count - leftCount - 1;
+
+        if (leftCount < count / 8 || rightCount < count / 8)
+        {
+            if (--badAllowed == 0)
+            {
+                vl_MemSortHeap(ctx, begin, end);
+                return;
+            }
+
+            vl_MemSortShuffle(ctx, begin, pivotPos);
+            vl_MemSortShuffle(ctx, pivotPos + size, end);
+        }
+        else if (alreadyPartitioned && vl_MemSortPartialInsertion(ctx, begin, pivotPos) &&
+                 vl_MemSortPartialInsertion(ctx, pivotPos + size, end))
         {
-            stack[++top] = low;
-            stack[++top] = p - 1;
+            return;
         }
 
-        if (p + 1 < high)
+        if (leftCount < rightCount)
         {
-            stack[++top] = p + 1;
-            stack[++top] = high;
+            vl_MemSortLoop(ctx, begin, pivotPos, badAllowed, leftmost);
+            begin = pivotPos + size;
+            leftmost = VL_FALSE;
+        }
+        else
+        {
+            vl_MemSortLoop(ctx, pivotPos + size, end, badAllowed, VL_FALSE);
+            end = pivotPos;
         }
     }
 }
 
+/**
+ * \brief Prepares the context shared by vlMemSort and the selection functions.
+ *
+ * Pivot and hole copies live in `stackScratch` unless elements exceed
+ * VL_MEM_SORT_STACK_ELEMENT bytes. Returns false if heap scratch could not be allocated.
+ * \private
+ */
+static vl_bool_t vl_MemSortBegin(vl_mem_sort_context* ctx, vl_usmall_t* stackScratch, vl_memsize_t elementSize,
+                                 vl_compare_function comparator)
+{
+    vl_usmall_t* scratch = stackScratch;
+    if (elementSize > VL_MEM_SORT_STACK_ELEMENT)
+    {
+        scratch = vlMemAlloc(elementSize * 2);
+        if (scratch == NULL)
+            return VL_FALSE;
+    }
+
+    ctx->size = elementSize;
+    ctx->compare = comparator;
+    ctx->pivot = scratch;
+    ctx->hole = scratch + elementSize;
+    return VL_TRUE;
+}
+
+/**
+ * \brief Releases scratch space acquired by vl_MemSortBegin.
+ * \private
+ */
+static void vl_MemSortEnd(vl_mem_sort_context* ctx, vl_usmall_t* stackScratch)
+{
+    if (ctx->pivot != stackScratch)
+        vlMemFree(ctx->pivot);
+}
+
+/**
+ * \brief Unbalanced partitions tolerated before falling back to heapsort: log2(n) + 1.
+ * \private
+ */
+static vl_uint_t vl_MemSortBadAllowed(vl_dsidx_t numElements)
+{
+    vl_uint_t badAllowed = 1;
+    for (vl_dsidx_t n = numElements; n > 1; n >>= 1)
+        badAllowed++;
+    return badAllowed;
+}
+
 void vlMemSort(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_compare_function comparator)
 {
-    const vl_memsize_t sortIndexSize = sizeof(vl_int_t) * numElements;
+    if (numElements < 2 || elementSize == 0)
+        return;
+
+    vl_usmall_t stackScratch[VL_MEM_SORT_STACK_ELEMENT * 2];
+    vl_mem_sort_context ctx;
+    if (!vl_MemSortBegin(&ctx, stackScratch, elementSize, comparator))
+        return;
+
+    vl_usmall_t* const begin = buffer;
+    vl_MemSortLoop(&ctx, begin, begin + (vl_memsize_t)numElements * elementSize, vl_MemSortBadAllowed(numElements),
+                   VL_TRUE);
+
+    vl_MemSortEnd(&ctx, stackScratch);
+}
+
+/**
+ * \brief Introselect over `[begin, end)`: partitions until the element that belongs at `nth` is in place.
+ *
+ * Uses the same pivots and partitions as vl_MemSortLoop but only continues
+ * into the side holding `nth`, so the expected cost is linear. Once
+ * `badAllowed` unbalanced partitions have been seen, the remaining range is
+ * heapsorted. `leftmost` has the same meaning as in vl_MemSortLoop.
+ * \private
+ */
+static void vl_MemSelectLoop(const vl_mem_sort_context* ctx, vl_usmall_t* begin, vl_usmall_t* end,
+                             const vl_usmall_t* nth, vl_uint_t badAllowed, vl_bool_t leftmost)
+{
+    const vl_memsize_t size = ctx->size;
+
+    for (;;)
+    {
+        const vl_memsize_t count = (vl_memsize_t)(end - begin) / size;
+
+        if (count < VL_MEM_SORT_INSERTION_THRESHOLD)
+        {
+            vl_MemSortInsertion(ctx, begin, end, leftmost);
+            return;
+        }
+
+        vl_MemSortPivot(ctx, begin, end, count);
+
+        // The run equal to the predecessor holds the smallest elements left, so it is already in place.
+        if (!leftmost && !vl_MemSortLess(ctx, begin - size, begin))
+        {
+            begin = vl_MemSortPartitionLeft(ctx, begin, end) + size;
+            if (nth < begin)
+                return;
+            continue;
+        }
+
+        vl_bool_t alreadyPartitioned;
+        vl_usmall_t* const pivotPos = vl_MemSortPartitionRight(ctx, begin, end, &alreadyPartitioned);
+        if (pivotPos == nth)
+            return;
+
+        const vl_memsize_t leftCount = (vl_memsize_t)(pivotPos - begin) / size;
+        const vl_memsize_t rightCount = count - leftCount - 1;
+
+        if (leftCount < count / 8 || rightCount < count / 8)
+        {
+            if (--badAllowed == 0)
+            {
+                vl_MemSortHeap(ctx, begin, end);
+                return;
+            }
+
+            vl_MemSortShuffle(ctx, begin, pivotPos);
+            vl_MemSortShuffle(ctx, pivotPos + size, end);
+        }
+
+        if (nth < pivotPos)
+        {
+            end = pivotPos;
+        }
+        else
+        {
+            begin = pivotPos + size;
+            leftmost = VL_FALSE;
+        }
+    }
+}
+
+void vlMemSelect(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_dsidx_t nth,
+                 vl_compare_function comparator)
+{
+    if (nth >= numElements || numElements < 2 || elementSize == 0)
+        return;
+
+    vl_usmall_t stackScratch[VL_MEM_SORT_STACK_ELEMENT * 2];
+    vl_mem_sort_context ctx;
+    if (!vl_MemSortBegin(&ctx, stackScratch, elementSize, comparator))
+        return;
+
+    vl_usmall_t* const begin = buffer;
+    vl_usmall_t* const end = begin + (vl_memsize_t)numElements * elementSize;
+    vl_MemSelectLoop(&ctx, begin, end, begin + (vl_memsize_t)nth * elementSize, vl_MemSortBadAllowed(numElements),
+                     VL_TRUE);
+
+    vl_MemSortEnd(&ctx, stackScratch);
+}
+
+void vlMemPartialSort(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_dsidx_t count,
+                      vl_compare_function comparator)
+{
+    if (count == 0 || numElements < 2 || elementSize == 0)
+        return;
 
-    vl_usmall_t* const tempMem = vlMemAlloc(sortIndexSize + (elementSize * 2));
-    if (tempMem == NULL)
+    vl_usmall_t stackScratch[VL_MEM_SORT_STACK_ELEMENT * 2];
+    vl_mem_sort_context ctx;
+    if (!vl_MemSortBegin(&ctx, stackScratch, elementSize, comparator))
         return;
 
-    vl_usmall_t* const pivot = tempMem;
-    vl_usmall_t* const swapTemp = pivot + elementSize;
-    vl_usmall_t* const memStack = swapTemp + elementSize;
+    vl_usmall_t* const begin = buffer;
+    const vl_uint_t badAllowed = vl_MemSortBadAllowed(numElements);
 
-    vl_MemSortQuicksort((vl_int_t*)memStack, buffer, pivot, swapTemp, elementSize, numElements, comparator);
+    // Select the last element of the prefix, then sort what lies before it.
+    if (count < numElements)
+    {
+        vl_usmall_t* const last = begin + (vl_memsize_t)(count - 1) * elementSize;
+        vl_MemSelectLoop(&ctx, begin, begin + (vl_memsize_t)numElements * elementSize, last, badAllowed, VL_TRUE);
+        vl_MemSortLoop(&ctx, begin, last, badAllowed, VL_TRUE);
+    }
+    else
+    {
+        vl_MemSortLoop(&ctx, begin, begin + (vl_memsize_t)numElements * elementSize, badAllowed, VL_TRUE);
+    }
 
-    vlMemFree(tempMem);
+    vl_MemSortEnd(&ctx, stackScratch);
 }
 
+/**
+ * \brief Copies elements of one constant size between strided arrays.
+ *
+ * The constant size lets each memcpy compile to a single load and store.
+ * \private
+ */
+#define VL_MEMORY_COPY_STRIDE_FIXED(size)                                                                              \
+    for (vl_dsidx_t i = 0; i < numElements; i++)                                                                       \
+    {                                                                                                                  \
+        memcpy(dstPtr, srcPtr, size);                                                                                  \
+        srcPtr += srcStride;                                                                                           \
+        dstPtr += dstStride;                                                                                           \
+    }
+
 void vlMemCopyStride(const void* src, vl_dsoffs_t srcStride, void* dest, vl_dsoffs_t dstStride,
                      vl_memsize_t elementSize, vl_dsidx_t numElements)
 {
-    if (dstStride == 0 && srcStride == 0)
+    if ((dstStride == 0 && srcStride == 0) || (dstStride == elementSize && srcStride == elementSize))
     {
         memcpy(dest, src, elementSize * numElements);
         return;
     }
 
+    // Packed destinations of 4- and 8-byte elements use the SIMD gathers.
+    if (dstStride == elementSize && elementSize == 4)
+    {
+        vlSIMDGather32(src, srcStride, dest, numElements);
+        return;
+    }
+    if (dstStride == elementSize && elementSize == 8)
+    {
+        vlSIMDGather64(src, srcStride, dest, numElements);
+        return;
+    }
+
     const vl_usmall_t* srcPtr = src;
     vl_usmall_t* dstPtr = dest;
 
-    for (vl_dsidx_t i = 0; i < numElements; i++)
+    switch (elementSize)
     {
-        memcpy(dstPtr, srcPtr, elementSize);
-        srcPtr += srcStride;
-        dstPtr += dstStride;
+    case 1:
+        VL_MEMORY_COPY_STRIDE_FIXED(1)
+        break;
+    case 2:
+        VL_MEMORY_COPY_STRIDE_FIXED(2)
+        break;
+    case 4:
+        VL_MEMORY_COPY_STRIDE_FIXED(4)
+        break;
+    case 8:
+        VL_MEMORY_COPY_STRIDE_FIXED(8)
+        break;
+    case 16:
+        VL_MEMORY_COPY_STRIDE_FIXED(16)
+        break;
+    default:
+        VL_MEMORY_COPY_STRIDE_FIXED(elementSize)
+        break;
     }
 }
 
+/**
+ * \brief Byte-swaps strided elements of one integer type in place.
+ *
+ * Elements are loaded and stored with memcpy, so they need not be aligned.
+ * \private
+ */
+#define VL_MEMORY_BYTESWAP_STRIDE(T, SWAP)                                                                             \
+    for (vl_dsidx_t i = 0; i < numElements; i++)                                                                       \
+    {                                                                                                                  \
+        T value;                                                                                                       \
+        memcpy(&value, srcPtr, sizeof(T));                                                                             \
+        value = SWAP(value);                                                                                           \
+        memcpy(srcPtr, &value, sizeof(T));                                                                             \
+        srcPtr += srcStride;                                                                                           \
+    }
+
+static inline vl_uint16_t vl_MemByteSwap16(vl_uint16_t v) { return (vl_uint16_t)((v << 8) | (v >> 8)); }
+
+static inline vl_uint32_t vl_MemByteSwap32(vl_uint32_t v)
+{
+    v = ((v << 8) & 0xFF00FF00u) | ((v >> 8) & 0x00FF00FFu);
+    return (v << 16) | (v >> 16);
+}
+
+static inline vl_uint64_t vl_MemByteSwap64(vl_uint64_t v)
+{
+    return ((vl_uint64_t)vl_MemByteSwap32((vl_uint32_t)v) << 32) | vl_MemByteSwap32((vl_uint32_t)(v >> 32));
+}
+
 void vlMemReverseSubArraysStride(void* src, vl_dsoffs_t srcStride, vl_memsize_t elementSize, vl_dsidx_t numElements)
 {
+    vl_usmall_t* srcPtr = src;
+
+    // Packed, aligned arrays of 2-, 4- and 8-byte elements use the SIMD byte swaps.
+    const vl_bool_t packed = srcStride == elementSize && elementSize != 0 && ((vl_uintptr_t)src % elementSize) == 0;
+    switch (elementSize)
+    {
+    case 2:
+        if (packed)
+        {
+            vlSIMDByteSwapU16((vl_uint16_t*)src, numElements);
+            return;
+        }
+        VL_MEMORY_BYTESWAP_STRIDE(vl_uint16_t, vl_MemByteSwap16)
+        return;
+    case 4:
+        if (packed)
+        {
+            vlSIMDByteSwapU32((vl_uint32_t*)src, numElements);
+            return;
+        }
+        VL_MEMORY_BYTESWAP_STRIDE(vl_uint32_t, vl_MemByteSwap32)
+        return;
+    case 8:
+        if (packed)
+        {
+            vlSIMDByteSwapU64((vl_uint64_t*)src, numElements);
+            return;
+        }
+        VL_MEMORY_BYTESWAP_STRIDE(vl_uint64_t, vl_MemByteSwap64)
+        return;
+    default:
+        break;
+    }
+
     const vl_dsidx_t numSteps = (vl_dsidx_t)(elementSize / 2);
-    vl_usmall_t *srcPtr = src, *first, *last, temp;
+    vl_usmall_t *first, *last, temp;
     vl_dsidx_t curElem, curStep;
 
     for (curElem = 0; curElem < numElements; curElem++)
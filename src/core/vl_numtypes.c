@@ -2,6 +2,7 @@
 #include <vl/vl_numtypes.h>
 
 #include "vl_memory.h"
+#include "vl_simd.h"
 
 //===== Converter Functions =====
 
@@ -935,3 +936,262 @@ const vl_numtype_info VL_NUMTYPE_INFO[VL_NUMTYPE_MAX] = {
          }},
 #endif
 };
+
+//===== Array Conversion =====
+
+/**
+ * \private Casts `count` elements from S to D. The packed loop is kept separate
+ * from the strided one so that it indexes plain arrays.
+ */
+#define VL_NUMTYPE_CAST_LOOP(S, D)                                                                                     \
+    if (srcStride == sizeof(S) && dstStride == sizeof(D))                                                              \
+    {                                                                                                                  \
+        const S* srcElems = (const S*)src;                                                                             \
+        D* dstElems = (D*)dst;                                                                                         \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            dstElems[i] = (D)srcElems[i];                                                                              \
+        }                                                                                                              \
+    }                                                                                                                  \
+    else                                                                                                               \
+    {                                                                                                                  \
+        const vl_usmall_t* srcPtr = (const vl_usmall_t*)src;                                                           \
+        vl_usmall_t* dstPtr = (vl_usmall_t*)dst;                                                                       \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                         \
+        {                                                                                                              \
+            *(D*)dstPtr = (D)(*(const S*)srcPtr);                                                                      \
+            srcPtr += srcStride;                                                                                       \
+            dstPtr += dstStride;                                                                                       \
+        }                                                                                                              \
+    }
+
+/*
+ * One switch case per destination type, or nothing where the platform lacks
+ * the type. The self-cast cases are never reached; they keep the expansion
+ * uniform.
+ */
+#define VL_NUMTYPE_CAST_TO_DSOFFS(S) case VL_NUMTYPE_DSOFFS: VL_NUMTYPE_CAST_LOOP(S, vl_dsoffs_t) break;
+#define VL_NUMTYPE_CAST_TO_DSIDX(S) case VL_NUMTYPE_DSIDX: VL_NUMTYPE_CAST_LOOP(S, vl_dsidx_t) break;
+#ifdef VL_U8_T
+#define VL_NUMTYPE_CAST_TO_UINT8(S) case VL_NUMTYPE_UINT8: VL_NUMTYPE_CAST_LOOP(S, vl_uint8_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_UINT8(S)
+#endif
+#ifdef VL_U16_T
+#define VL_NUMTYPE_CAST_TO_UINT16(S) case VL_NUMTYPE_UINT16: VL_NUMTYPE_CAST_LOOP(S, vl_uint16_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_UINT16(S)
+#endif
+#ifdef VL_U32_T
+#define VL_NUMTYPE_CAST_TO_UINT32(S) case VL_NUMTYPE_UINT32: VL_NUMTYPE_CAST_LOOP(S, vl_uint32_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_UINT32(S)
+#endif
+#ifdef VL_U64_T
+#define VL_NUMTYPE_CAST_TO_UINT64(S) case VL_NUMTYPE_UINT64: VL_NUMTYPE_CAST_LOOP(S, vl_uint64_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_UINT64(S)
+#endif
+#ifdef VL_I8_T
+#define VL_NUMTYPE_CAST_TO_INT8(S) case VL_NUMTYPE_INT8: VL_NUMTYPE_CAST_LOOP(S, vl_int8_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_INT8(S)
+#endif
+#ifdef VL_I16_T
+#define VL_NUMTYPE_CAST_TO_INT16(S) case VL_NUMTYPE_INT16: VL_NUMTYPE_CAST_LOOP(S, vl_int16_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_INT16(S)
+#endif
+#ifdef VL_I32_T
+#define VL_NUMTYPE_CAST_TO_INT32(S) case VL_NUMTYPE_INT32: VL_NUMTYPE_CAST_LOOP(S, vl_int32_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_INT32(S)
+#endif
+#ifdef VL_I64_T
+#define VL_NUMTYPE_CAST_TO_INT64(S) case VL_NUMTYPE_INT64: VL_NUMTYPE_CAST_LOOP(S, vl_int64_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_INT64(S)
+#endif
+#ifdef VL_F32_T
+#define VL_NUMTYPE_CAST_TO_FLOAT32(S) case VL_NUMTYPE_FLOAT32: VL_NUMTYPE_CAST_LOOP(S, vl_float32_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_FLOAT32(S)
+#endif
+#ifdef VL_F64_T
+#define VL_NUMTYPE_CAST_TO_FLOAT64(S) case VL_NUMTYPE_FLOAT64: VL_NUMTYPE_CAST_LOOP(S, vl_float64_t) break;
+#else
+#define VL_NUMTYPE_CAST_TO_FLOAT64(S)
+#endif
+
+#define VL_NUMTYPE_CAST_FROM(S)                                                                                        \
+    switch (dstType)                                                                                                   \
+    {                                                                                                                  \
+        VL_NUMTYPE_CAST_TO_DSOFFS(S)                                                                                   \
+        VL_NUMTYPE_CAST_TO_DSIDX(S)                                                                                    \
+        VL_NUMTYPE_CAST_TO_UINT8(S)                                                                                    \
+        VL_NUMTYPE_CAST_TO_UINT16(S)                                                                                   \
+        VL_NUMTYPE_CAST_TO_UINT32(S)                                                                                   \
+        VL_NUMTYPE_CAST_TO_UINT64(S)                                                                                   \
+        VL_NUMTYPE_CAST_TO_INT8(S)                                                                                     \
+        VL_NUMTYPE_CAST_TO_INT16(S)                                                                                    \
+        VL_NUMTYPE_CAST_TO_INT32(S)                                                                                    \
+        VL_NUMTYPE_CAST_TO_INT64(S)                                                                                    \
+        VL_NUMTYPE_CAST_TO_FLOAT32(S)                                                                                  \
+        VL_NUMTYPE_CAST_TO_FLOAT64(S)                                                                                  \
+        default:                                                                                                       \
+            break;                                                                                                     \
+    }
+
+/**
+ * \private Runs the vl_simd kernel for a packed pair, if there is one.
+ * \return VL_TRUE if the pair was converted.
+ */
+static vl_bool_t vl_NumTypeCastArraySIMD(const void* src, vl_numtype srcType, void* dst, vl_numtype dstType,
+                                         vl_dsidx_t count)
+{
+    switch (srcType)
+    {
+    case VL_NUMTYPE_UINT8:
+        if (dstType == VL_NUMTYPE_FLOAT32)
+        {
+            vlSIMDConvertU8ToF32((const vl_uint8_t*)src, (vl_float32_t*)dst, count);
+            return VL_TRUE;
+        }
+        break;
+    case VL_NUMTYPE_INT16:
+        if (dstType == VL_NUMTYPE_FLOAT32)
+        {
+            vlSIMDConvertI16ToF32((const vl_int16_t*)src, (vl_float32_t*)dst, count);
+            return VL_TRUE;
+        }
+        if (dstType == VL_NUMTYPE_INT32)
+        {
+            vlSIMDConvertI16ToI32((const vl_int16_t*)src, (vl_int32_t*)dst, count);
+            return VL_TRUE;
+        }
+        break;
+    case VL_NUMTYPE_INT32:
+        if (dstType == VL_NUMTYPE_FLOAT32)
+        {
+            vlSIMDConvertI32ToF32((const vl_int32_t*)src, (vl_float32_t*)dst, count);
+            return VL_TRUE;
+        }
+        if (dstType == VL_NUMTYPE_INT16)
+        {
+            vlSIMDConvertI32ToI16((const vl_int32_t*)src, (vl_int16_t*)dst, count);
+            return VL_TRUE;
+        }
+        break;
+    case VL_NUMTYPE_FLOAT32:
+        if (dstType == VL_NUMTYPE_INT32)
+        {
+            vlSIMDConvertF32ToI32((const vl_float32_t*)src, (vl_int32_t*)dst, count);
+            return VL_TRUE;
+        }
+        if (dstType == VL_NUMTYPE_FLOAT64)
+        {
+            vlSIMDConvertF32ToF64((const vl_float32_t*)src, (vl_float64_t*)dst, count);
+            return VL_TRUE;
+        }
+        break;
+    case VL_NUMTYPE_FLOAT64:
+        if (dstType == VL_NUMTYPE_FLOAT32)
+        {
+            vlSIMDConvertF64ToF32((const vl_float64_t*)src, (vl_float32_t*)dst, count);
+            return VL_TRUE;
+        }
+        break;
+    default:
+        break;
+    }
+    return VL_FALSE;
+}
+
+void vlNumTypeCastArray(const void* src, vl_numtype srcType, vl_dsoffs_t srcStride, void* dst, vl_numtype dstType,
+                        vl_dsoffs_t dstStride, vl_dsidx_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const vl_numtype_info* srcInfo = &VL_NUMTYPE_INFO[srcType];
+    const vl_numtype_info* dstInfo = &VL_NUMTYPE_INFO[dstType];
+    srcStride = srcStride ? srcStride : srcInfo->size;
+    dstStride = dstStride ? dstStride : dstInfo->size;
+    const vl_bool_t packed = srcStride == srcInfo->size && dstStride == dstInfo->size;
+
+    // Same type, or integers of one width: the cast keeps every bit.
+    if (srcType == dstType || (srcInfo->isInteger && dstInfo->isInteger && srcInfo->size == dstInfo->size))
+    {
+        vlMemCopyStride(src, packed ? 0 : srcStride, dst, packed ? 0 : dstStride, srcInfo->size, count);
+        return;
+    }
+
+    if (packed && vl_NumTypeCastArraySIMD(src, srcType, dst, dstType, count))
+    {
+        return;
+    }
+
+    switch (srcType)
+    {
+    case VL_NUMTYPE_DSOFFS:
+        VL_NUMTYPE_CAST_FROM(vl_dsoffs_t)
+        break;
+    case VL_NUMTYPE_DSIDX:
+        VL_NUMTYPE_CAST_FROM(vl_dsidx_t)
+        break;
+#ifdef VL_U8_T
+    case VL_NUMTYPE_UINT8:
+        VL_NUMTYPE_CAST_FROM(vl_uint8_t)
+        break;
+#endif
+#ifdef VL_U16_T
+    case VL_NUMTYPE_UINT16:
+        VL_NUMTYPE_CAST_FROM(vl_uint16_t)
+        break;
+#endif
+#ifdef VL_U32_T
+    case VL_NUMTYPE_UINT32:
+        VL_NUMTYPE_CAST_FROM(vl_uint32_t)
+        break;
+#endif
+#ifdef VL_U64_T
+    case VL_NUMTYPE_UINT64:
+        VL_NUMTYPE_CAST_FROM(vl_uint64_t)
+        break;
+#endif
+#ifdef VL_I8_T
+    case VL_NUMTYPE_INT8:
+        VL_NUMTYPE_CAST_FROM(vl_int8_t)
+        break;
+#endif
+#ifdef VL_I16_T
+    case VL_NUMTYPE_INT16:
+        VL_NUMTYPE_CAST_FROM(vl_int16_t)
+        break;
+#endif
+#ifdef VL_I32_T
+    case VL_NUMTYPE_INT32:
+        VL_NUMTYPE_CAST_FROM(vl_int32_t)
+        break;
+#endif
+#ifdef VL_I64_T
+    case VL_NUMTYPE_INT64:
+        VL_NUMTYPE_CAST_FROM(vl_int64_t)
+        break;
+#endif
+#ifdef VL_F32_T
+    case VL_NUMTYPE_FLOAT32:
+        VL_NUMTYPE_CAST_FROM(vl_float32_t)
+        break;
+#endif
+#ifdef VL_F64_T
+    case VL_NUMTYPE_FLOAT64:
+        VL_NUMTYPE_CAST_FROM(vl_float64_t)
+        break;
+#endif
+    default:
+        break;
+    }
+}
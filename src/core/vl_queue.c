@@ -1,99 +1,61 @@
 #include "vl_queue.h"
 
-#include <memory.h>
 #include <stdlib.h>
 
-#include "vl_memory.h"
+void vlQueueInit(vl_queue* queue, vl_uint16_t elementSize) { vlDequeInit(&queue->ring, elementSize); }
 
-/**
- * Queues have a very simple header, which is just a single index to the next
- * element. As such, they don't really have a more advanced structure for their
- * management.
- * \private
- */
-typedef vl_pool_idx vl_queue_header;
-
-void vlQueueInit(vl_queue* queue, vl_uint16_t elementSize)
-{
-    vlPoolInit(&queue->nodes, elementSize + sizeof(vl_queue_header));
-    queue->elementSize = elementSize;
-    queue->head = VL_POOL_INVALID_IDX;
-    queue->tail = VL_POOL_INVALID_IDX;
-}
-
-void vlQueueFree(vl_queue* queue) { vlPoolFree(&queue->nodes); }
+void vlQueueFree(vl_queue* queue) { vlDequeFree(&queue->ring); }
 
 vl_queue* vlQueueNew(vl_uint16_t elementSize)
 {
     vl_queue* queue = malloc(sizeof(vl_queue));
-    vlQueueInit(queue, elementSize);
+    if (queue)
+        vlQueueInit(queue, elementSize);
     return queue;
 }
 
 void vlQueueDelete(vl_queue* queue)
 {
+    if (queue == NULL)
+        return;
     vlQueueFree(queue);
     free(queue);
 }
 
-void vlQueueClear(vl_queue* queue)
-{
-    vlPoolClear(&queue->nodes);
-    queue->head = queue->tail = VL_POOL_INVALID_IDX;
-}
+void vlQueueClear(vl_queue* queue) { vlDequeClear(&queue->ring); }
 
 vl_queue* vlQueueClone(const vl_queue* src, vl_queue* dest)
 {
-    if (dest == NULL)
-        dest = vlQueueNew(src->elementSize);
-
-    vlPoolClone(&src->nodes, &dest->nodes);
+    const vl_bool_t created = dest == NULL;
+    if (created)
+    {
+        dest = vlQueueNew(src->ring.elementSize);
+        if (dest == NULL)
+            return NULL;
+    }
 
-    dest->head = src->head;
-    dest->tail = src->tail;
-    dest->elementSize = src->elementSize;
+    if (vlDequeClone(&src->ring, &dest->ring) == NULL)
+    {
+        if (created)
+            vlQueueDelete(dest);
+        return NULL;
+    }
 
     return dest;
 }
 
-void vlQueueReserve(vl_queue* queue, vl_dsidx_t numElems) { vlPoolReserve(&queue->nodes, numElems); }
-
-void vlQueuePushBack(vl_queue* queue, const void* element)
-{
-    const vl_pool_idx oldTail = queue->tail;
-    const vl_pool_idx newTail = vlPoolTake(&queue->nodes);
-    vl_transient* const newMem = vlPoolSample(&queue->nodes, newTail);
-    *((vl_queue_header* const)newMem) = newTail;
-    memcpy(newMem + sizeof(vl_queue_header), element, queue->elementSize);
+void vlQueueReserve(vl_queue* queue, vl_dsidx_t numElems) { vlDequeReserve(&queue->ring, numElems); }
 
-    if (oldTail != VL_POOL_INVALID_IDX)
-        *((vl_queue_header*)vlPoolSample(&queue->nodes, oldTail)) = newTail;
+void vlQueuePushBack(vl_queue* queue, const void* element) { vlDequePushBack(&queue->ring, element); }
 
-    if (queue->head == VL_POOL_INVALID_IDX)
-        queue->head = newTail;
+int vlQueuePopFront(vl_queue* queue, void* element) { return vlDequePopFront(&queue->ring, element); }
 
-    queue->tail = newTail;
+void vlQueuePushBackN(vl_queue* queue, const void* elements, vl_dsidx_t n)
+{
+    vlDequePushBackN(&queue->ring, elements, n);
 }
 
-int vlQueuePopFront(vl_queue* queue, void* element)
+vl_dsidx_t vlQueuePopFrontN(vl_queue* queue, void* elements, vl_dsidx_t n)
 {
-    if (queue->head == VL_POOL_INVALID_IDX)
-        return 0;
-
-    const vl_pool_idx target = queue->head;
-    vl_queue_header* const header = (vl_queue_header*)(vlPoolSample(&queue->nodes, target));
-    vl_transient* const data = (vl_transient*)(header + 1);
-
-    if (queue->head == queue->tail)
-    {
-        queue->head = queue->tail = VL_POOL_INVALID_IDX;
-    }
-    else
-        queue->head = *header;
-
-    if (element)
-        memcpy(element, data, queue->elementSize);
-
-    vlPoolReturn(&queue->nodes, target);
-    return 1;
+    return vlDequePopFrontN(&queue->ring, elements, n);
 }
@@ -1,6 +1,8 @@
 #include "vl_rand.h"
+#include "vl_simd.h"
 
 #include <limits.h>
+#include <math.h>
 #include <string.h>
 #include <time.h>
 
@@ -198,3 +200,569 @@ vl_float64_t vlRandD(vl_rand* rand)
 }
 
 #endif
+
+#if VL_RAND_XOSHIRO_LANES != VL_SIMD_XOSHIRO_LANES
+#error "vl_rand_xoshiro and the SIMD xoshiro kernels disagree on the lane count."
+#endif
+
+// Largest number of blocks handed to one kernel call; keeps the count within vl_dsidx_t.
+#define VL_RAND_XOSHIRO_CHUNK_BLOCKS (1u << 24)
+
+/**
+ * \brief Xoshiro256 jump polynomials: 2^128 steps (jump) and 2^192 steps (long jump).
+ * \private
+ */
+static const vl_uint64_t vl_RandXoshiroJumpPoly[4] = {0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                                      0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+static const vl_uint64_t vl_RandXoshiroLongJumpPoly[4] = {0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull,
+                                                          0x77710069854EE241ull, 0x39109BB02ACBE635ull};
+
+/**
+ * \brief Steps one lane's four state words without producing output.
+ * \private
+ */
+static void vl_RandXoshiroStepLane(vl_uint64_t* s)
+{
+    const vl_uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+}
+
+/**
+ * \brief Advances one lane by the number of steps the given polynomial encodes.
+ * \private
+ */
+static void vl_RandXoshiroJumpLane(vl_uint64_t* s, const vl_uint64_t* poly)
+{
+    vl_uint64_t acc[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++)
+    {
+        for (int b = 0; b < 64; b++)
+        {
+            // Branch-free select of whether this power of the step contributes.
+            const vl_uint64_t mask = (vl_uint64_t)0 - ((poly[i] >> b) & 1u);
+            for (int w = 0; w < 4; w++)
+                acc[w] ^= s[w] & mask;
+            vl_RandXoshiroStepLane(s);
+        }
+    }
+    memcpy(s, acc, sizeof(acc));
+}
+
+/**
+ * \brief Copies one lane's state words out of the interleaved layout, or back into it.
+ * \private
+ */
+static void vl_RandXoshiroGetLane(const vl_rand_xoshiro* rand, int lane, vl_uint64_t* s)
+{
+    for (int w = 0; w < 4; w++)
+        s[w] = rand->state[w * VL_RAND_XOSHIRO_LANES + lane];
+}
+
+static void vl_RandXoshiroSetLane(vl_rand_xoshiro* rand, int lane, const vl_uint64_t* s)
+{
+    for (int w = 0; w < 4; w++)
+        rand->state[w * VL_RAND_XOSHIRO_LANES + lane] = s[w];
+}
+
+void vlRandXoshiroInit(vl_rand_xoshiro* rand, vl_ularge_t seed)
+{
+    // Four consecutive splitmix64 outputs are distinct, so the state is never all zero.
+    vl_rand mix = seed;
+    vl_uint64_t lane[4];
+    for (int w = 0; w < 4; w++)
+        lane[w] = (vl_uint64_t)vlRandNext(&mix);
+
+    for (int l = 0; l < VL_RAND_XOSHIRO_LANES; l++)
+    {
+        vl_RandXoshiroSetLane(rand, l, lane);
+        vl_RandXoshiroJumpLane(lane, vl_RandXoshiroJumpPoly);
+    }
+}
+
+void vlRandXoshiroJump(vl_rand_xoshiro* rand)
+{
+    for (int l = 0; l < VL_RAND_XOSHIRO_LANES; l++)
+    {
+        vl_uint64_t lane[4];
+        vl_RandXoshiroGetLane(rand, l, lane);
+        vl_RandXoshiroJumpLane(lane, vl_RandXoshiroLongJumpPoly);
+        vl_RandXoshiroSetLane(rand, l, lane);
+    }
+}
+
+void vlRandXoshiroSplit(vl_rand_xoshiro* rand, vl_rand_xoshiro* stream)
+{
+    *stream = *rand;
+    vlRandXoshiroJump(rand);
+}
+
+void vlRandXoshiroFill(vl_rand_xoshiro* rand, void* mem, vl_ularge_t len)
+{
+    const vl_ularge_t blockBytes = sizeof(vl_uint64_t) * VL_RAND_XOSHIRO_LANES;
+    vl_usmall_t* bytes = (vl_usmall_t*)mem;
+    vl_ularge_t blocks = len / blockBytes;
+
+    while (blocks > 0)
+    {
+        const vl_dsidx_t chunk =
+            (vl_dsidx_t)(blocks < VL_RAND_XOSHIRO_CHUNK_BLOCKS ? blocks : VL_RAND_XOSHIRO_CHUNK_BLOCKS);
+        vlSIMDXoshiroU64(rand->state, bytes, chunk);
+        bytes += chunk * blockBytes;
+        blocks -= chunk;
+    }
+
+    const vl_ularge_t remaining = len % blockBytes;
+    if (remaining > 0)
+    {
+        vl_uint64_t block[VL_RAND_XOSHIRO_LANES];
+        vlSIMDXoshiroU64(rand->state, block, 1);
+        memcpy(bytes, block, (size_t)remaining);
+    }
+}
+
+void vlRandXoshiroFillF(vl_rand_xoshiro* rand, vl_float32_t* dst, vl_dsidx_t count)
+{
+    const vl_dsidx_t perBlock = 2 * VL_RAND_XOSHIRO_LANES;
+    const vl_dsidx_t blocks = count / perBlock;
+    vlSIMDXoshiroF32(rand->state, dst, blocks);
+
+    const vl_dsidx_t remaining = count % perBlock;
+    if (remaining > 0)
+    {
+        vl_float32_t block[2 * VL_RAND_XOSHIRO_LANES];
+        vlSIMDXoshiroF32(rand->state, block, 1);
+        memcpy(dst + blocks * perBlock, block, remaining * sizeof(vl_float32_t));
+    }
+}
+
+void vlRandXoshiroFillD(vl_rand_xoshiro* rand, vl_float64_t* dst, vl_dsidx_t count)
+{
+    const vl_dsidx_t perBlock = VL_RAND_XOSHIRO_LANES;
+    const vl_dsidx_t blocks = count / perBlock;
+    vlSIMDXoshiroF64(rand->state, dst, blocks);
+
+    const vl_dsidx_t remaining = count % perBlock;
+    if (remaining > 0)
+    {
+        vl_float64_t block[VL_RAND_XOSHIRO_LANES];
+        vlSIMDXoshiroF64(rand->state, block, 1);
+        memcpy(dst + blocks * perBlock, block, remaining * sizeof(vl_float64_t));
+    }
+}
+
+/* ============================================================================
+ * Distributions
+ * ============================================================================
+ */
+
+// 2^-53, turning the top 53 bits of a random word into a double in [0, 1).
+#define VL_RAND_DOUBLE_UNIT (1.0 / 9007199254740992.0)
+
+/**
+ * \brief Multiplies two 64-bit integers into a 128-bit result, returning the high half.
+ * \private
+ */
+static inline vl_uint64_t vl_RandMul64(vl_uint64_t a, vl_uint64_t b, vl_uint64_t* low)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 vl_uint128_t;
+    const vl_uint128_t product = (vl_uint128_t)a * b;
+    *low = (vl_uint64_t)product;
+    return (vl_uint64_t)(product >> 64);
+#else
+    const vl_uint64_t aLo = a & 0xFFFFFFFFu, aHi = a >> 32;
+    const vl_uint64_t bLo = b & 0xFFFFFFFFu, bHi = b >> 32;
+    const vl_uint64_t lolo = aLo * bLo, lohi = aLo * bHi, hilo = aHi * bLo, hihi = aHi * bHi;
+    const vl_uint64_t mid = (lolo >> 32) + (lohi & 0xFFFFFFFFu) + (hilo & 0xFFFFFFFFu);
+    *low = (mid << 32) | (lolo & 0xFFFFFFFFu);
+    return hihi + (lohi >> 32) + (hilo >> 32) + (mid >> 32);
+#endif
+}
+
+/**
+ * \brief Maps a random 32-bit value into [0, bound), drawing fresh values until unbiased.
+ *
+ * The rejection threshold `2^32 mod bound` is only computed when the first
+ * candidate lands in the low, possibly over-represented range.
+ * \private
+ */
+static inline vl_uint32_t vl_RandBoundedFrom32(vl_rand* rand, vl_uint32_t candidate, vl_uint32_t bound)
+{
+    vl_uint64_t m = (vl_uint64_t)candidate * bound;
+    if ((vl_uint32_t)m < bound)
+    {
+        const vl_uint32_t threshold = (0u - bound) % bound;
+        while ((vl_uint32_t)m < threshold)
+            m = (vl_uint64_t)(vl_uint32_t)vlRandNext(rand) * bound;
+    }
+    return (vl_uint32_t)(m >> 32);
+}
+
+vl_uint32_t vlRandBoundedU32(vl_rand* rand, vl_uint32_t bound)
+{
+    return vl_RandBoundedFrom32(rand, (vl_uint32_t)vlRandNext(rand), bound);
+}
+
+vl_uint64_t vlRandBoundedU64(vl_rand* rand, vl_uint64_t bound)
+{
+    vl_uint64_t low;
+    vl_uint64_t high = vl_RandMul64((vl_uint64_t)vlRandNext(rand), bound, &low);
+    if (low < bound)
+    {
+        const vl_uint64_t threshold = (0u - bound) % bound;
+        while (low < threshold)
+            high = vl_RandMul64((vl_uint64_t)vlRandNext(rand), bound, &low);
+    }
+    return high;
+}
+
+void vlRandBoundedFillU32(vl_rand* rand, vl_uint32_t* dst, vl_dsidx_t count, vl_uint32_t bound)
+{
+    vl_dsidx_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        const vl_uint64_t bits = (vl_uint64_t)vlRandNext(rand);
+        dst[i] = vl_RandBoundedFrom32(rand, (vl_uint32_t)bits, bound);
+        dst[i + 1] = vl_RandBoundedFrom32(rand, (vl_uint32_t)(bits >> 32), bound);
+    }
+    if (i < count)
+        dst[i] = vlRandBoundedU32(rand, bound);
+}
+
+/**
+ * \brief Ziggurat layer edges for the standard normal density, 128 layers.
+ *
+ * Entry 0 is the width of the base layer including the tail (its area over
+ * the density at the tail start), entry 1 is the tail start, and the last
+ * entry is 0. Layer `i` spans `[0, x[i])` between densities at `x[i]` and
+ * `x[i + 1]`. Computed with Doornik's recurrence for R = 3.442619855899 and
+ * layer area V = 9.91256303526217e-3.
+ * \private
+ */
+static const vl_float64_t vl_RandNormalZigX[129] = {
+    3.7130862467425505, 3.4426198558990002, 3.2230849845811416, 3.0832288582168683, 2.9786962526477803,
+    2.8943440070215289, 2.8231253505489105, 2.7611693723871769, 2.7061135731218195, 2.6564064112613597,
+    2.6109722484318474, 2.5690336259249378, 2.5300096723888275, 2.4934545220953721, 2.4590181774118305,
+    2.4264206455337498, 2.3954342780110625, 2.3658713701176386, 2.3375752413392368, 2.310413683698763,
+    2.2842740596774718, 2.2590595738691985, 2.2346863955909795, 2.2110814088787034, 2.1881804320760492,
+    2.1659267937489219, 2.1442701823603953, 2.1231657086739766, 2.1025731351892385, 2.0824562379920168,
+    2.0627822745083084, 2.0435215366550676, 2.0246469733773855, 2.0061338699634721, 1.9879595741276199,
+    1.9701032608543265, 1.9525457295535567, 1.9352692282966228, 1.9182573008645099, 1.9014946531051511,
+    1.884967035707759, 1.8686611409944887, 1.8525645117280911, 1.836665460258446, 1.8209529965961255,
+    1.8054167642192285, 1.7900469825998586, 1.7748343955860695, 1.7597702248995934, 1.7448461281138004,
+    1.7300541605637305, 1.7153867407136676, 1.7008366185699169, 1.6863968467791681, 1.6720607540976009,
+    1.6578219209540241, 1.6436741568628686, 1.6296114794706347, 1.615628095043161, 1.6017183802213781,
+    1.5878768648905761, 1.5740982160230008, 1.5603772223661689, 1.5467087798599104, 1.5330878776740433,
+    1.5195095847659401, 1.5059690368632033, 1.492461423781354, 1.4789819769899242, 1.4655259573427108,
+    1.4520886428892246, 1.4386653166845635, 1.4252512545140601, 1.4118417124470577, 1.3984319141310053,
+    1.3850170377326518, 1.3715922024273426, 1.3581524543301435, 1.344692751753547, 1.3312079496656273,
+    1.3176927832094141, 1.3041418501286168, 1.2905495919261964, 1.2769102735601556, 1.2632179614546211,
+    1.2494664995730682, 1.2356494832633627, 1.2217602305399964, 1.2077917504159497, 1.1937367078331287,
+    1.1795873846639882, 1.1653356361647524, 1.1509728421488674, 1.1364898520131608, 1.1218769225825422,
+    1.107123647534036, 1.0922188769072774, 1.0771506248928957, 1.0619059636948243, 1.0464709007640454,
+    1.0308302360681956, 1.0149673952513305, 0.99886423349298359, 0.98250080351542901, 0.9658550794011499,
+    0.94890262551130644, 0.93161619661515083, 0.91396525102303228, 0.89591535258093769, 0.87742742911292337,
+    0.85845684319381321, 0.83895221429757738, 0.81885390670035729, 0.79809206064405691, 0.77658398789475991,
+    0.75423066445405562, 0.73091191064248884, 0.70647961133543646, 0.68074791866915463, 0.65347863873997525,
+    0.6243585973360507, 0.59296294247144832, 0.55869217840818519, 0.52065603876206057, 0.47743783729668982,
+    0.42654798635542351, 0.36287143109703196, 0.27232086481396467, 0.0,
+};
+
+/**
+ * \brief Ziggurat layer edges for the exponential density, 256 layers.
+ *
+ * Laid out as vl_RandNormalZigX, for R = 7.69711747013104972 and
+ * V = 3.949659822581572e-3.
+ * \private
+ */
+static const vl_float64_t vl_RandExpZigX[257] = {
+    8.6971174701310847, 7.6971174701310501, 6.9410336293772108, 6.478378493832567, 6.14416466577247, 5.8821443157953963,
+    5.6664101674540301, 5.4828906275260589, 5.3230905057543945, 5.1814872813014965, 5.0542884899813005,
+    4.938777085901247, 4.8329397410251076, 4.7352429966017366, 4.6444918854200807, 4.5597370617073469,
+    4.4802117465284175, 4.4052876934735679, 4.3344436803172677, 4.2672424802773614, 4.2033137137351799,
+    4.142340865664047, 4.0840513104082934, 4.0282085446479323, 3.9746060666737844, 3.9230625001354853,
+    3.8734176703995047, 3.8255294185223323, 3.7792709924116634, 3.7345288940397929, 3.6912010902374144,
+    3.6491955157608493, 3.6084288131289051, 3.568825265648333, 3.5303158891293394, 3.4928376547740556,
+    3.4563328211327562, 3.4207483572511159, 3.386035442460297, 3.3521490309001054, 3.319047470970744,
+    3.2866921715990647, 3.2550473085704459, 3.2240795652862602, 3.1937579032122363, 3.1640533580259689,
+    3.134938858084436, 3.10638906233982, 3.0783802152540858, 3.0508900166154507, 3.0238975044556722, 2.9973829495161262,
+    2.9713277599210852, 2.9457143948950413, 2.9205262865127364, 2.8957477686001374, 2.8713640120155319,
+    2.8473609656351844, 2.8237253024500308, 2.8004443702507333, 2.7775061464397521, 2.7548991965623402,
+    2.7326126361946956, 2.7106360958679243, 2.6889596887417988, 2.6675739807732617, 2.6464699631518038,
+    2.6256390267977832, 2.6050729387408302, 2.5847638202141354, 2.5647041263168999, 2.5448866271118646,
+    2.5253043900378223, 2.5059507635285883, 2.4868193617402041, 2.4679040502973595, 2.4491989329782444,
+    2.4306983392644144, 2.4123968126888653, 2.3942890999214526, 2.3763701405361353, 2.358635057409332,
+    2.3410791477030291, 2.3236978743901906, 2.306486858283574, 2.2894418705322637, 2.272558825553149,
+    2.2558337743672134, 2.2392628983129033, 2.222842503111031, 2.2065690132576581, 2.1904389667232143,
+    2.1744490099377689, 2.1585958930438802, 2.1428764653998362, 2.1272876713173625, 2.1118265460190364,
+    2.0964902118017092, 2.0812758743932194, 2.0661808194905702, 2.0512024094685795, 2.0363380802487643,
+    2.0215853383189208, 2.0069417578945128, 1.9924049782135711, 1.9779727009573547, 1.9636426877895423,
+    1.9494127580071789, 1.9352807862970454, 1.9212447005915219, 1.9073024800183813, 1.8934521529393018,
+    1.879691795072205, 1.8660195276928215, 1.8524335159111693, 1.8389319670188735, 1.8255131289035134,
+    1.8121752885263842, 1.7989167704602844, 1.7857359354841194, 1.7726311792312988, 1.7596009308890681,
+    1.7466436519460677, 1.7337578349855649, 1.7209420025219289, 1.7081947058780513, 1.6955145241015315,
+    1.6829000629175475, 1.6703499537164457, 1.6578628525741663, 1.6454374393037172, 1.6330724165359849,
+    1.6207665088282515, 1.6085184617988519, 1.596327041286477, 1.5841910325326825, 1.5721092393862233,
+    1.5600804835278816, 1.5481036037145068, 1.5361774550410254, 1.5243009082192196, 1.5124728488721104,
+    1.5006921768428103, 1.4889578055167394, 1.4772686611561272, 1.4656236822457387, 1.454021818848787,
+    1.4424620319720061, 1.4309432929388732, 1.4194645827699766, 1.408024891569529, 1.3966232179170355,
+    1.3852585682631156, 1.3739299563284839, 1.3626364025050801, 1.3513769332583287, 1.3401505805294984,
+    1.3289563811371101, 1.3177933761763183, 1.3066606104151677, 1.2955571316865944, 1.284481990275006,
+    1.2734342382962345, 1.2624129290696087, 1.2514171164808459, 1.2404458543343997, 1.2294981956938424,
+    1.2185731922087835, 1.2076698934267542, 1.196787346088396, 1.1859245934041951, 1.1750806743109043,
+    1.1642546227056716, 1.1534454666557674, 1.1426522275816655, 1.1318739194110714, 1.1211095477013233,
+    1.1103581087274039, 1.0996185885325902, 1.0888899619385397, 1.0781711915113652, 1.0674612264799606,
+    1.0567590016025443, 1.0460634359770369, 1.0353734317905212, 1.0246878730026101, 1.0140056239570894,
+    1.0033255279156894, 0.99264640550726846, 0.98196705308505516, 0.97128624098389593, 0.96060271166865907,
+    0.94991517776406853, 0.93922231995525485, 0.92852278474720296, 0.91781518207003676, 0.90709808271568271,
+    0.89637001558988239, 0.88562946476174387, 0.87487486629101741, 0.86410460481099671, 0.85331700984236547,
+    0.8425103518103606, 0.8316828377342651, 0.82083260655440382, 0.80995772405741018, 0.79905617735547896,
+    0.78812586886948433, 0.77716460975912138, 0.76617011273542623, 0.75513998418197359, 0.74407171550049944,
+    0.73296267358435663, 0.72181009030874732, 0.71061105090964605, 0.69936248110322297, 0.68806113277373881,
+    0.67670356802951348, 0.66528614139266862, 0.65380497984765551, 0.64225596042452693, 0.63063468493348063,
+    0.61893645139486642, 0.60715622162029026, 0.59528858429149301, 0.58332771274875961, 0.57126731653257812,
+    0.55910058551153019, 0.54682012516329981, 0.53441788123715472, 0.52188505159212406, 0.50921198244364319,
+    0.49638804551865967, 0.48340149165345014, 0.47023927508215713, 0.45688684093140813, 0.44332786607354013,
+    0.42954394022539827, 0.4155141696003436, 0.40121467889626466, 0.38661797794110619, 0.37169214532990352,
+    0.35639976025837972, 0.34069648106483463, 0.32452911701689441, 0.30783295467491661, 0.29052795549121424,
+    0.27251318547844777, 0.25365836338589415, 0.23379048305965566, 0.21267151063094616, 0.18995868962240969,
+    0.1651276225641628, 0.13730498093998469, 0.10483850756578511, 0.063852163814956245, 0.0,
+};
+
+/**
+ * \brief Draws a double in (0, 1), safe to pass to `log`.
+ * \private
+ */
+static inline vl_float64_t vl_RandOpenUnit(vl_rand* rand)
+{
+    return ((vl_float64_t)((vl_uint64_t)vlRandNext(rand) >> 11) + 0.5) * VL_RAND_DOUBLE_UNIT;
+}
+
+vl_float64_t vlRandNormal(vl_rand* rand)
+{
+    for (;;)
+    {
+        // Low 7 bits pick the layer; the top 54 bits give a signed position in (-1, 1).
+        const vl_uint64_t bits = (vl_uint64_t)vlRandNext(rand);
+        const vl_uint32_t layer = (vl_uint32_t)(bits & 0x7F);
+        const vl_float64_t u = (vl_float64_t)((vl_int64_t)bits >> 10) * VL_RAND_DOUBLE_UNIT;
+        const vl_float64_t x = u * vl_RandNormalZigX[layer];
+
+        // Inside the rectangle that lies wholly under the density.
+        if (fabs(x) < vl_RandNormalZigX[layer + 1])
+            return x;
+
+        // Base layer overflow: sample the tail beyond R (Marsaglia's method).
+        if (layer == 0)
+        {
+            const vl_float64_t r = vl_RandNormalZigX[1];
+            vl_float64_t tx, ty;
+            do
+            {
+                tx = log(vl_RandOpenUnit(rand)) / r;
+                ty = log(vl_RandOpenUnit(rand));
+            } while (-2.0 * ty < tx * tx);
+            return u < 0 ? tx - r : r - tx;
+        }
+
+        // Wedge: accept if a uniform height falls under the density.
+        const vl_float64_t xi = vl_RandNormalZigX[layer], xn = vl_RandNormalZigX[layer + 1];
+        const vl_float64_t f0 = exp(-0.5 * (xi * xi - x * x));
+        const vl_float64_t f1 = exp(-0.5 * (xn * xn - x * x));
+        if (f1 + vl_RandOpenUnit(rand) * (f0 - f1) < 1.0)
+            return x;
+    }
+}
+
+void vlRandNormalFill(vl_rand* rand, vl_float64_t* dst, vl_dsidx_t count, vl_float64_t mean, vl_float64_t stddev)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+        dst[i] = mean + stddev * vlRandNormal(rand);
+}
+
+vl_float64_t vlRandExponential(vl_rand* rand)
+{
+    for (;;)
+    {
+        // Low 8 bits pick the layer; the top 53 bits give a position in [0, 1).
+        const vl_uint64_t bits = (vl_uint64_t)vlRandNext(rand);
+        const vl_uint32_t layer = (vl_uint32_t)(bits & 0xFF);
+        const vl_float64_t x = (vl_float64_t)(bits >> 11) * VL_RAND_DOUBLE_UNIT * vl_RandExpZigX[layer];
+
+        if (x < vl_RandExpZigX[layer + 1])
+            return x;
+
+        // The exponential is memoryless, so the tail beyond R is R plus another exponential.
+        if (layer == 0)
+            return vl_RandExpZigX[1] - log(vl_RandOpenUnit(rand));
+
+        const vl_float64_t f0 = exp(vl_RandExpZigX[layer] - x);
+        const vl_float64_t f1 = exp(vl_RandExpZigX[layer + 1] - x);
+        if (f1 + vl_RandOpenUnit(rand) * (f0 - f1) < 1.0)
+            return x;
+    }
+}
+
+void vlRandExponentialFill(vl_rand* rand, vl_float64_t* dst, vl_dsidx_t count, vl_float64_t rate)
+{
+    const vl_float64_t scale = 1.0 / rate;
+    for (vl_dsidx_t i = 0; i < count; i++)
+        dst[i] = scale * vlRandExponential(rand);
+}
+
+/**
+ * \brief Swaps two non-overlapping elements through a small stack buffer.
+ * \private
+ */
+static inline void vl_RandSwap(vl_usmall_t* a, vl_usmall_t* b, vl_memsize_t elementSize)
+{
+    vl_usmall_t temp[64];
+    while (elementSize > 0)
+    {
+        const vl_memsize_t chunk = elementSize < sizeof(temp) ? elementSize : sizeof(temp);
+        memcpy(temp, a, chunk);
+        memcpy(a, b, chunk);
+        memcpy(b, temp, chunk);
+        a += chunk;
+        b += chunk;
+        elementSize -= chunk;
+    }
+}
+
+void vlRandShuffle(vl_rand* rand, void* data, vl_memsize_t elementSize, vl_dsidx_t count)
+{
+    vl_usmall_t* elements = (vl_usmall_t*)data;
+    for (vl_dsidx_t i = count; i > 1; i--)
+    {
+        const vl_dsidx_t j = vlRandBoundedU32(rand, i);
+        if (j != i - 1)
+            vl_RandSwap(elements + (vl_memsize_t)j * elementSize, elements + (vl_memsize_t)(i - 1) * elementSize,
+                        elementSize);
+    }
+}
+
+vl_dsidx_t vlRandReservoir(vl_rand* rand, const void* src, vl_memsize_t elementSize, vl_dsidx_t count, void* dst,
+                           vl_dsidx_t k)
+{
+    const vl_usmall_t* source = (const vl_usmall_t*)src;
+    vl_usmall_t* sample = (vl_usmall_t*)dst;
+    if (k == 0)
+        return 0;
+    if (count <= k)
+    {
+        memcpy(sample, source, (vl_memsize_t)count * elementSize);
+        return count;
+    }
+
+    memcpy(sample, source, (vl_memsize_t)k * elementSize);
+
+    // Algorithm L: w tracks the largest of k uniform keys; skips between replacements are geometric in w.
+    vl_float64_t w = exp(log(vl_RandOpenUnit(rand)) / k);
+    vl_dsidx_t i = k - 1;
+    for (;;)
+    {
+        const vl_float64_t skip = floor(log(vl_RandOpenUnit(rand)) / log1p(-w));
+        if (!(skip < (vl_float64_t)(count - 1 - i)))
+            break;
+        i += (vl_dsidx_t)skip + 1;
+
+        const vl_dsidx_t slot = vlRandBoundedU32(rand, k);
+        memcpy(sample + (vl_memsize_t)slot * elementSize, source + (vl_memsize_t)i * elementSize, elementSize);
+        w *= exp(log(vl_RandOpenUnit(rand)) / k);
+    }
+    return k;
+}
+
+vl_bool_t vlRandAliasInit(vl_rand_alias* table, const vl_float64_t* weights, vl_dsidx_t count)
+{
+    table->count = 0;
+    table->threshold = NULL;
+    table->alias = NULL;
+
+    vl_float64_t total = 0.0;
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        if (!(weights[i] >= 0.0) || !isfinite(weights[i]))
+            return VL_FALSE;
+        total += weights[i];
+    }
+    if (count == 0 || !(total > 0.0) || !isfinite(total))
+        return VL_FALSE;
+
+    // One block: thresholds, aliases, then the scaled weights and two work lists used only while building.
+    const vl_memsize_t columnBytes = sizeof(vl_uint64_t) + sizeof(vl_float64_t) + 3 * sizeof(vl_dsidx_t);
+    vl_memory* block = vlMemAlloc((vl_memsize_t)count * columnBytes);
+    if (block == NULL)
+        return VL_FALSE;
+
+    vl_uint64_t* threshold = (vl_uint64_t*)block;
+    vl_float64_t* scaled = (vl_float64_t*)(threshold + count);
+    vl_dsidx_t* alias = (vl_dsidx_t*)(scaled + count);
+    vl_dsidx_t* small = alias + count;
+    vl_dsidx_t* large = small + count;
+    vl_dsidx_t smallCount = 0, largeCount = 0;
+
+    // Vose's method: pair each under-full column with an over-full one that tops it up.
+    for (vl_dsidx_t i = 0; i < count; i++)
+    {
+        scaled[i] = weights[i] * (vl_float64_t)count / total;
+        alias[i] = i;
+        if (scaled[i] < 1.0)
+            small[smallCount++] = i;
+        else
+            large[largeCount++] = i;
+    }
+
+    while (smallCount > 0 && largeCount > 0)
+    {
+        const vl_dsidx_t less = small[--smallCount];
+        const vl_dsidx_t more = large[largeCount - 1];
+        threshold[less] = (vl_uint64_t)(scaled[less] * 9007199254740992.0);
+        alias[less] = more;
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0)
+        {
+            largeCount--;
+            small[smallCount++] = more;
+        }
+    }
+
+    // Whatever remains is full up to rounding error.
+    while (largeCount > 0)
+        threshold[large[--largeCount]] = (vl_uint64_t)1 << 53;
+    while (smallCount > 0)
+        threshold[small[--smallCount]] = (vl_uint64_t)1 << 53;
+
+    table->count = count;
+    table->threshold = threshold;
+    table->alias = alias;
+    return VL_TRUE;
+}
+
+void vlRandAliasFree(vl_rand_alias* table)
+{
+    if (table->threshold != NULL)
+        vlMemFree((vl_memory*)table->threshold);
+    table->count = 0;
+    table->threshold = NULL;
+    table->alias = NULL;
+}
+
+vl_dsidx_t vlRandAliasSample(const vl_rand_alias* table, vl_rand* rand)
+{
+    const vl_dsidx_t column = vlRandBoundedU32(rand, table->count);
+    const vl_uint64_t coin = (vl_uint64_t)vlRandNext(rand) >> 11;
+    return coin < table->threshold[column] ? column : table->alias[column];
+}
+
+void vlRandAliasFill(const vl_rand_alias* table, vl_rand* rand, vl_dsidx_t* dst, vl_dsidx_t count)
+{
+    for (vl_dsidx_t i = 0; i < count; i++)
+        dst[i] = vlRandAliasSample(table, rand);
+}
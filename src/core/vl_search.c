@@ -0,0 +1,367 @@
+#include "vl_search.h"
+#include "vl_algo.h"
+#include "vl_simd.h"
+
+#include <string.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+/**
+ * \brief Issues a read prefetch for the cache line holding `addr`.
+ * \private
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define VL_SEARCH_PREFETCH(addr) __builtin_prefetch(addr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define VL_SEARCH_PREFETCH(addr) _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#else
+#define VL_SEARCH_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * \brief Range length at which a binary search over 32-bit keys switches to a SIMD scan.
+ *
+ * Sixteen 32-bit keys span a single cache line, so the scan costs no more
+ * memory traffic than the four halving steps it replaces.
+ * \private
+ */
+#define VL_SEARCH_LINEAR 16
+
+/**
+ * \brief Searches advanced in lockstep by the batch functions.
+ *
+ * Enough to keep a dozen or so cache misses in flight at once.
+ * \private
+ */
+#define VL_SEARCH_BATCH 16
+
+/**
+ * \brief Assumed cache line size, used to prefetch Eytzinger descendants.
+ * \private
+ */
+#define VL_SEARCH_CACHE_LINE 64
+
+typedef vl_dsidx_t (*vl_search_bound_fn)(const void* keys, vl_dsidx_t numElements, const void* key,
+                                         vl_bool_t inclusive);
+typedef void (*vl_search_batch_fn)(const void* keys, vl_dsidx_t numElements, const void* queries,
+                                   vl_dsidx_t numQueries, vl_dsidx_t* results, vl_bool_t inclusive);
+
+/**
+ * \brief Search routines specialized for one key representation.
+ * \private
+ */
+typedef struct
+{
+    vl_search_bound_fn bound;
+    vl_search_batch_fn batch;
+    vl_search_bound_fn eytzinger;
+} vl_search_kind;
+
+/**
+ * \brief Maps a float's bits to a signed integer with the same total order.
+ * \private
+ */
+static inline vl_int32_t vl_SearchEncodeF32(const vl_float32_t* value)
+{
+    vl_uint32_t bits;
+    memcpy(&bits, value, sizeof(bits));
+    return (vl_int32_t)(bits ^ ((0u - (bits >> 31)) & 0x7FFFFFFFu));
+}
+
+/**
+ * \brief Maps a double's bits to a signed integer with the same total order.
+ * \private
+ */
+static inline vl_int64_t vl_SearchEncodeF64(const vl_float64_t* value)
+{
+    vl_uint64_t bits;
+    memcpy(&bits, value, sizeof(bits));
+    return (vl_int64_t)(bits ^ (((vl_uint64_t)0 - (bits >> 63)) & 0x7FFFFFFFFFFFFFFFull));
+}
+
+#define VL_SEARCH_ENCODE_INT(ptr) (*(ptr))
+
+/**
+ * \brief Finishes a search over a short range by counting keys that order before the probe.
+ * \private
+ */
+#define VL_SEARCH_FINISH_SCALAR(suffix, T, K, ENCODE)                                                              \
+    static inline vl_dsidx_t vl_SearchFinish##suffix(const T* base, vl_dsidx_t count, const T* key, K probe,       \
+                                                     vl_bool_t inclusive)                                          \
+    {                                                                                                              \
+        vl_dsidx_t rank = 0;                                                                                       \
+        (void)key;                                                                                                 \
+        for (vl_dsidx_t i = 0; i < count; i++)                                                                     \
+        {                                                                                                          \
+            const K value = ENCODE(base + i);                                                                      \
+            rank += inclusive ? value <= probe : value < probe;                                                    \
+        }                                                                                                          \
+        return rank;                                                                                               \
+    }
+
+#define VL_SEARCH_FINISH_SIMD(suffix, T, K, RANK)                                                                  \
+    static inline vl_dsidx_t vl_SearchFinish##suffix(const T* base, vl_dsidx_t count, const T* key, K probe,       \
+                                                     vl_bool_t inclusive)                                          \
+    {                                                                                                              \
+        (void)probe;                                                                                               \
+        return vlSIMDFunctions.RANK(base, count, *key, inclusive);                                                 \
+    }
+
+/**
+ * \brief Defines the bound, batch and Eytzinger searches for one key representation.
+ *
+ * `T` is the stored key type and `K` the integer type its encoding compares
+ * as. `LINEAR` is the range length at which the bound search hands off to
+ * vl_SearchFinish, or 1 to run the binary search to the end.
+ * \private
+ */
+#define VL_SEARCH_DEFINE(suffix, T, K, ENCODE, LINEAR)                                                             \
+    static vl_dsidx_t vl_SearchBound##suffix(const void* keys, vl_dsidx_t numElements, const void* key,            \
+                                             vl_bool_t inclusive)                                                  \
+    {                                                                                                              \
+        const T* base = (const T*)keys;                                                                            \
+        T keyValue;                                                                                                \
+        memcpy(&keyValue, key, sizeof(T));                                                                         \
+        const K probe = ENCODE(&keyValue);                                                                         \
+        vl_dsidx_t length = numElements;                                                                           \
+                                                                                                                   \
+        while (length > (LINEAR))                                                                                  \
+        {                                                                                                          \
+            const vl_dsidx_t half = length / 2;                                                                    \
+            const K value = ENCODE(base + half);                                                                   \
+            base = (inclusive ? value <= probe : value < probe) ? base + half : base;                              \
+            length -= half;                                                                                        \
+        }                                                                                                          \
+                                                                                                                   \
+        return (vl_dsidx_t)(base - (const T*)keys) +                                                               \
+            vl_SearchFinish##suffix(base, length, &keyValue, probe, inclusive);                                    \
+    }                                                                                                              \
+                                                                                                                   \
+    static void vl_SearchBatch##suffix(const void* keys, vl_dsidx_t numElements, const void* queries,              \
+                                       vl_dsidx_t numQueries, vl_dsidx_t* results, vl_bool_t inclusive)            \
+    {                                                                                                              \
+        const T* array = (const T*)keys;                                                                           \
+        const T* query = (const T*)queries;                                                                        \
+        K probes[VL_SEARCH_BATCH];                                                                                 \
+        vl_dsidx_t bases[VL_SEARCH_BATCH];                                                                         \
+                                                                                                                   \
+        for (vl_dsidx_t first = 0; first < numQueries; first += VL_SEARCH_BATCH)                                   \
+        {                                                                                                          \
+            const vl_dsidx_t group = VL_MIN(VL_SEARCH_BATCH, numQueries - first);                                  \
+            for (vl_dsidx_t g = 0; g < group; g++)                                                                 \
+            {                                                                                                      \
+                probes[g] = ENCODE(query + first + g);                                                             \
+                bases[g] = 0;                                                                                      \
+            }                                                                                                      \
+                                                                                                                   \
+            /* The range length shrinks identically for every search, so the group stays in lockstep. */           \
+            vl_dsidx_t length = numElements;                                                                       \
+            while (length > 1)                                                                                     \
+            {                                                                                                      \
+                const vl_dsidx_t half = length / 2;                                                                \
+                const vl_dsidx_t nextHalf = (length - half) / 2;                                                   \
+                for (vl_dsidx_t g = 0; g < group; g++)                                                             \
+                {                                                                                                  \
+                    const K value = ENCODE(array + bases[g] + half);                                               \
+                    const vl_dsidx_t taken = (vl_dsidx_t)(inclusive ? value <= probes[g] : value < probes[g]);     \
+                    const vl_dsidx_t base = bases[g] + (half & (0u - taken)); /* Branch-free select. */            \
+                    VL_SEARCH_PREFETCH(array + base + nextHalf);                                                   \
+                    bases[g] = base;                                                                               \
+                }                                                                                                  \
+                length -= half;                                                                                    \
+            }                                                                                                      \
+                                                                                                                   \
+            for (vl_dsidx_t g = 0; g < group; g++)                                                                 \
+            {                                                                                                      \
+                vl_dsidx_t rank = bases[g];                                                                        \
+                if (length == 1)                                                                                   \
+                {                                                                                                  \
+                    const K value = ENCODE(array + rank);                                                          \
+                    rank += inclusive ? value <= probes[g] : value < probes[g];                                    \
+                }                                                                                                  \
+                results[first + g] = rank;                                                                         \
+            }                                                                                                      \
+        }                                                                                                          \
+    }                                                                                                              \
+                                                                                                                   \
+    static vl_dsidx_t vl_SearchEytzinger##suffix(const void* layout, vl_dsidx_t numElements, const void* key,      \
+                                                 vl_bool_t inclusive)                                              \
+    {                                                                                                              \
+        const T* tree = (const T*)layout;                                                                          \
+        const vl_dsidx_t stride = VL_SEARCH_CACHE_LINE / sizeof(T);                                                \
+        T keyValue;                                                                                                \
+        memcpy(&keyValue, key, sizeof(T));                                                                         \
+        const K probe = ENCODE(&keyValue);                                                                         \
+        vl_dsidx_t node = 1; /* One-based, so the children of node i are 2i and 2i + 1. */                         \
+                                                                                                                   \
+        while (node <= numElements)                                                                                \
+        {                                                                                                          \
+            /* Descendants `stride` levels down are contiguous; fetch them ahead of time. */                       \
+            if (node * stride <= numElements)                                                                      \
+                VL_SEARCH_PREFETCH(tree + node * stride - 1);                                                      \
+            const K value = ENCODE(tree + node - 1);                                                               \
+            node = 2 * node + (inclusive ? value <= probe : value < probe);                                        \
+        }                                                                                                          \
+                                                                                                                   \
+        /* Undo the trailing right turns; the node left of them is the answer. */                                  \
+        node >>= vlAlgoCTZ64(~(vl_uint64_t)node) + 1;                                                              \
+        return node == 0 ? numElements : node - 1;                                                                 \
+    }
+
+VL_SEARCH_FINISH_SCALAR(U8, vl_uint8_t, vl_uint8_t, VL_SEARCH_ENCODE_INT)
+VL_SEARCH_FINISH_SCALAR(U16, vl_uint16_t, vl_uint16_t, VL_SEARCH_ENCODE_INT)
+VL_SEARCH_FINISH_SIMD(U32, vl_uint32_t, vl_uint32_t, rank_u32)
+VL_SEARCH_FINISH_SCALAR(U64, vl_uint64_t, vl_uint64_t, VL_SEARCH_ENCODE_INT)
+VL_SEARCH_FINISH_SCALAR(I8, vl_int8_t, vl_int8_t, VL_SEARCH_ENCODE_INT)
+VL_SEARCH_FINISH_SCALAR(I16, vl_int16_t, vl_int16_t, VL_SEARCH_ENCODE_INT)
+VL_SEARCH_FINISH_SIMD(I32, vl_int32_t, vl_int32_t, rank_i32)
+VL_SEARCH_FINISH_SCALAR(I64, vl_int64_t, vl_int64_t, VL_SEARCH_ENCODE_INT)
+VL_SEARCH_FINISH_SIMD(F32, vl_float32_t, vl_int32_t, rank_f32)
+VL_SEARCH_FINISH_SCALAR(F64, vl_float64_t, vl_int64_t, vl_SearchEncodeF64)
+
+VL_SEARCH_DEFINE(U8, vl_uint8_t, vl_uint8_t, VL_SEARCH_ENCODE_INT, 1)
+VL_SEARCH_DEFINE(U16, vl_uint16_t, vl_uint16_t, VL_SEARCH_ENCODE_INT, 1)
+VL_SEARCH_DEFINE(U32, vl_uint32_t, vl_uint32_t, VL_SEARCH_ENCODE_INT, VL_SEARCH_LINEAR)
+VL_SEARCH_DEFINE(U64, vl_uint64_t, vl_uint64_t, VL_SEARCH_ENCODE_INT, 1)
+VL_SEARCH_DEFINE(I8, vl_int8_t, vl_int8_t, VL_SEARCH_ENCODE_INT, 1)
+VL_SEARCH_DEFINE(I16, vl_int16_t, vl_int16_t, VL_SEARCH_ENCODE_INT, 1)
+VL_SEARCH_DEFINE(I32, vl_int32_t, vl_int32_t, VL_SEARCH_ENCODE_INT, VL_SEARCH_LINEAR)
+VL_SEARCH_DEFINE(I64, vl_int64_t, vl_int64_t, VL_SEARCH_ENCODE_INT, 1)
+VL_SEARCH_DEFINE(F32, vl_float32_t, vl_int32_t, vl_SearchEncodeF32, VL_SEARCH_LINEAR)
+VL_SEARCH_DEFINE(F64, vl_float64_t, vl_int64_t, vl_SearchEncodeF64, 1)
+
+#define VL_SEARCH_KIND(suffix) {vl_SearchBound##suffix, vl_SearchBatch##suffix, vl_SearchEytzinger##suffix}
+
+static const vl_search_kind VL_SEARCH_KINDS[] = {
+    VL_SEARCH_KIND(U8), VL_SEARCH_KIND(U16), VL_SEARCH_KIND(U32), VL_SEARCH_KIND(U64), VL_SEARCH_KIND(I8),
+    VL_SEARCH_KIND(I16), VL_SEARCH_KIND(I32), VL_SEARCH_KIND(I64), VL_SEARCH_KIND(F32), VL_SEARCH_KIND(F64),
+};
+
+/**
+ * \brief Picks the search routines for a key type from its size, signedness and representation.
+ * \private
+ */
+static const vl_search_kind* vl_SearchKindOf(vl_numtype keyType)
+{
+    if ((vl_uint_t)keyType >= VL_NUMTYPE_MAX)
+        return NULL;
+
+    const vl_numtype_info* info = &VL_NUMTYPE_INFO[keyType];
+    vl_uint_t widthIndex;
+    switch (info->size)
+    {
+        case 1:
+            widthIndex = 0;
+            break;
+        case 2:
+            widthIndex = 1;
+            break;
+        case 4:
+            widthIndex = 2;
+            break;
+        case 8:
+            widthIndex = 3;
+            break;
+        default:
+            return NULL;
+    }
+
+    if (info->isFloating)
+        return widthIndex == 2 ? &VL_SEARCH_KINDS[8] : widthIndex == 3 ? &VL_SEARCH_KINDS[9] : NULL;
+    return &VL_SEARCH_KINDS[widthIndex + (info->isSigned ? 4 : 0)];
+}
+
+VL_API vl_dsidx_t vlSearchLowerBound(const void* keys, vl_dsidx_t numElements, vl_numtype keyType, const void* key)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    return kind ? kind->bound(keys, numElements, key, VL_FALSE) : VL_STRUCTURE_INDEX_MAX;
+}
+
+VL_API vl_dsidx_t vlSearchUpperBound(const void* keys, vl_dsidx_t numElements, vl_numtype keyType, const void* key)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    return kind ? kind->bound(keys, numElements, key, VL_TRUE) : VL_STRUCTURE_INDEX_MAX;
+}
+
+VL_API vl_dsidx_t vlSearchEqualRange(const void* keys, vl_dsidx_t numElements, vl_numtype keyType, const void* key,
+                                     vl_dsidx_t* first)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    if (kind == NULL)
+    {
+        *first = VL_STRUCTURE_INDEX_MAX;
+        return 0;
+    }
+
+    const vl_dsidx_t lower = kind->bound(keys, numElements, key, VL_FALSE);
+    const vl_memsize_t size = VL_NUMTYPE_INFO[keyType].size;
+    *first = lower;
+    return kind->bound((const vl_usmall_t*)keys + lower * size, numElements - lower, key, VL_TRUE);
+}
+
+VL_API vl_bool_t vlSearchLowerBoundBatch(const void* keys, vl_dsidx_t numElements, vl_numtype keyType,
+                                         const void* queries, vl_dsidx_t numQueries, vl_dsidx_t* results)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    if (kind == NULL)
+        return VL_FALSE;
+    kind->batch(keys, numElements, queries, numQueries, results, VL_FALSE);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlSearchUpperBoundBatch(const void* keys, vl_dsidx_t numElements, vl_numtype keyType,
+                                         const void* queries, vl_dsidx_t numQueries, vl_dsidx_t* results)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    if (kind == NULL)
+        return VL_FALSE;
+    kind->batch(keys, numElements, queries, numQueries, results, VL_TRUE);
+    return VL_TRUE;
+}
+
+/**
+ * \brief Fills the subtree rooted at one-based `node` by in-order traversal, consuming sorted keys from `next`.
+ *
+ * Recursion depth is the height of the tree, log2(n).
+ * \private
+ */
+static vl_dsidx_t vl_SearchEytzingerFill(const vl_usmall_t* sorted, vl_usmall_t* layout, vl_dsidx_t* order,
+                                         vl_memsize_t size, vl_dsidx_t numElements, vl_dsidx_t next, vl_dsidx_t node)
+{
+    if (node > numElements)
+        return next;
+
+    next = vl_SearchEytzingerFill(sorted, layout, order, size, numElements, next, 2 * node);
+    memcpy(layout + (node - 1) * size, sorted + next * size, size);
+    if (order)
+        order[node - 1] = next;
+    next++;
+    return vl_SearchEytzingerFill(sorted, layout, order, size, numElements, next, 2 * node + 1);
+}
+
+VL_API vl_bool_t vlSearchEytzingerBuild(const void* sorted, vl_dsidx_t numElements, vl_numtype keyType, void* layout,
+                                        vl_dsidx_t* order)
+{
+    if (vl_SearchKindOf(keyType) == NULL)
+        return VL_FALSE;
+
+    vl_SearchEytzingerFill((const vl_usmall_t*)sorted, (vl_usmall_t*)layout, order, VL_NUMTYPE_INFO[keyType].size,
+                           numElements, 0, 1);
+    return VL_TRUE;
+}
+
+VL_API vl_dsidx_t vlSearchEytzingerLowerBound(const void* layout, vl_dsidx_t numElements, vl_numtype keyType,
+                                              const void* key)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    return kind ? kind->eytzinger(layout, numElements, key, VL_FALSE) : VL_STRUCTURE_INDEX_MAX;
+}
+
+VL_API vl_dsidx_t vlSearchEytzingerUpperBound(const void* layout, vl_dsidx_t numElements, vl_numtype keyType,
+                                              const void* key)
+{
+    const vl_search_kind* kind = vl_SearchKindOf(keyType);
+    return kind ? kind->eytzinger(layout, numElements, key, VL_TRUE) : VL_STRUCTURE_INDEX_MAX;
+}
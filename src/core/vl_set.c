@@ -41,6 +41,9 @@ typedef struct vl_set_node
     vl_set_iter parent; /**< Parent node iterator or VL_SET_ITER_INVALID */
     vl_set_iter left; /**< Left child iterator or VL_SET_ITER_INVALID */
     vl_set_iter right; /**< Right child iterator or VL_SET_ITER_INVALID */
+#ifdef VL_SET_ORDER_STATISTICS
+    vl_dsidx_t size; /**< Number of nodes in the subtree rooted at this node, including itself */
+#endif
 } vl_set_node;
 
 /**
@@ -66,6 +69,31 @@ static inline vl_set_node* vl_SetGetNodeAt(vl_set* set, vl_set_iter iter)
     return (vl_set_node*)vlPoolSample(&set->nodePool, iter);
 }
 
+#ifdef VL_SET_ORDER_STATISTICS
+/**
+ * \brief Returns the subtree size of a node, or 0 for the null iterator.
+ * \private
+ */
+static inline vl_dsidx_t vl_SetSubtreeSize(vl_set* set, vl_set_iter iter)
+{
+    return iter == VL_SET_ITER_INVALID ? 0 : vl_SetGetNodeAt(set, iter)->size;
+}
+
+/**
+ * \brief Adds `delta` to the subtree size of a node and each of its ancestors.
+ * \private
+ */
+static void vl_SetAdjustSizes(vl_set* set, vl_set_iter iter, vl_dsidx_t delta)
+{
+    while (iter != VL_SET_ITER_INVALID)
+    {
+        vl_set_node* node = vl_SetGetNodeAt(set, iter);
+        node->size += delta;
+        iter = node->parent;
+    }
+}
+#endif
+
 vl_set_iter vlSetFront(vl_set* set)
 {
     if (!set || set->root == VL_SET_ITER_INVALID)
@@ -163,6 +191,12 @@ void vl_SetTreeRotateLeft(vl_set* set, vl_set_iter nodeXIter)
     }
     nodeY->left = nodeXIter; // Put x on y's left.
     nodeX->parent = nodeYIter;
+
+#ifdef VL_SET_ORDER_STATISTICS
+    // y now roots the subtree x used to; x keeps its left subtree and y's former left.
+    nodeY->size = nodeX->size;
+    nodeX->size = vl_SetSubtreeSize(set, nodeX->left) + vl_SetSubtreeSize(set, nodeX->right) + 1;
+#endif
 }
 
 /**
@@ -212,6 +246,11 @@ void vl_SetTreeRotateRight(vl_set* set, vl_set_iter nodeXIter)
     }
     nodeY->right = nodeXIter; // Put x on y's right.
     nodeX->parent = nodeYIter;
+
+#ifdef VL_SET_ORDER_STATISTICS
+    nodeY->size = nodeX->size;
+    nodeX->size = vl_SetSubtreeSize(set, nodeX->left) + vl_SetSubtreeSize(set, nodeX->right) + 1;
+#endif
 }
 
 /**
@@ -387,6 +426,9 @@ vl_set_iter vlSetInsert(vl_set* set, const void* elem)
         newNode->right = VL_SET_ITER_INVALID;
 
         newNode->color = vl_rbtree_color_black;
+#ifdef VL_SET_ORDER_STATISTICS
+        newNode->size = 1;
+#endif
 
         memcpy(newNode + 1, elem, set->elementSize);
 
@@ -400,8 +442,18 @@ vl_set_iter vlSetInsert(vl_set* set, const void* elem)
         int comp = set->comparator(curNode + 1, elem);
 
         if (comp == 0)
+        {
+#ifdef VL_SET_ORDER_STATISTICS
+            // Undo the counts added on the way down.
+            vl_SetAdjustSizes(set, curNode->parent, (vl_dsidx_t)-1);
+#endif
             return curIter; // Element already exists in the set...
+        }
 
+#ifdef VL_SET_ORDER_STATISTICS
+        // Count the new element in every node it descends through.
+        curNode->size++;
+#endif
         vl_set_iter* nextIter = comp > 0 ? &curNode->left : &curNode->right;
 
         if (*nextIter != VL_SET_ITER_INVALID)
@@ -418,6 +470,9 @@ vl_set_iter vlSetInsert(vl_set* set, const void* elem)
         newNode->right = VL_SET_ITER_INVALID;
 
         newNode->color = vl_rbtree_color_red;
+#ifdef VL_SET_ORDER_STATISTICS
+        newNode->size = 1;
+#endif
 
         set->totalElements++;
         memcpy(newNode + 1, elem, set->elementSize);
@@ -683,6 +738,11 @@ void vlSetRemove(vl_set* set, vl_set_iter nodeZIter)
     if (!nodeY)
         return;
 
+#ifdef VL_SET_ORDER_STATISTICS
+    // nodeY leaves the tree; uncount it from every ancestor, which includes nodeZ when the two differ.
+    vl_SetAdjustSizes(set, nodeY->parent, (vl_dsidx_t)-1);
+#endif
+
     // Find nodeY's only child (or VL_SET_ITER_INVALID if no children)
     vl_set_iter nodeXIter = (nodeY->left != VL_SET_ITER_INVALID) ? nodeY->left : nodeY->right;
 
@@ -716,6 +776,9 @@ void vlSetRemove(vl_set* set, vl_set_iter nodeZIter)
         nodeY->left = nodeZ->left;
         nodeY->right = nodeZ->right;
         nodeY->color = nodeZ->color;
+#ifdef VL_SET_ORDER_STATISTICS
+        nodeY->size = nodeZ->size;
+#endif
 
         // Update parent's child pointer
         if (nodeZ->parent == VL_SET_ITER_INVALID)
@@ -850,64 +913,236 @@ vl_set_iter vlSetFind(vl_set* set, const void* elem)
     return result;
 }
 
-vl_set* vlSetUnion(vl_set* a, vl_set* b, vl_set* dest)
+vl_dsidx_t vlSetRank(vl_set* set, const void* elem)
 {
-    // Validate inputs
-    if (!a || !b)
-        return NULL;
+    if (!set || !elem)
+        return 0;
 
-    if ((a->elementSize != b->elementSize) || (a->comparator != b->comparator))
-        // Mismatched input set properties.
-        return NULL;
+    vl_dsidx_t rank = 0;
+#ifdef VL_SET_ORDER_STATISTICS
+    vl_set_iter curIter = set->root;
+    while (curIter != VL_SET_ITER_INVALID)
+    {
+        vl_set_node* node = vl_SetGetNodeAt(set, curIter);
+        if (set->comparator(node + 1, elem) < 0)
+        {
+            // This node and its whole left subtree order before elem.
+            rank += vl_SetSubtreeSize(set, node->left) + 1;
+            curIter = node->right;
+        }
+        else
+            curIter = node->left;
+    }
+#else
+    VL_SET_FOREACH(set, curIter)
+    {
+        if (set->comparator(vlSetSample(set, curIter), elem) >= 0)
+            break;
+        rank++;
+    }
+#endif
+    return rank;
+}
 
-    if (dest == NULL)
-        dest = vlSetNew(a->elementSize, a->comparator);
-    else if (dest == a || dest == b)
-        // If dest is the same as one of the inputs, we need to make a temporary
-        // copy to avoid modifying the inputs during iteration
-        return vlSetUnion(a, b, vlSetNew(a->elementSize, a->comparator));
+vl_set_iter vlSetSelect(vl_set* set, vl_dsidx_t index)
+{
+    if (!set || index >= set->totalElements)
+        return VL_SET_ITER_INVALID;
 
-    // Insert all elements from set A
-    VL_SET_FOREACH(a, curIter) { vlSetInsert(dest, vlSetSample(a, curIter)); }
+#ifdef VL_SET_ORDER_STATISTICS
+    vl_set_iter curIter = set->root;
+    while (curIter != VL_SET_ITER_INVALID)
+    {
+        vl_set_node* node = vl_SetGetNodeAt(set, curIter);
+        const vl_dsidx_t leftSize = vl_SetSubtreeSize(set, node->left);
 
-    // Insert all elements from set B (duplicates are implicitly ignored)
-    VL_SET_FOREACH(b, curIter) { vlSetInsert(dest, vlSetSample(b, curIter)); }
+        if (index == leftSize)
+            break;
 
-    return dest;
+        if (index < leftSize)
+            curIter = node->left;
+        else
+        {
+            index -= leftSize + 1;
+            curIter = node->right;
+        }
+    }
+    return curIter;
+#else
+    vl_set_iter curIter = vlSetFront(set);
+    while (index-- > 0)
+        curIter = vlSetNext(set, curIter);
+    return curIter;
+#endif
 }
 
-vl_set* vlSetIntersection(vl_set* a, vl_set* b, vl_set* dest)
+vl_dsidx_t vlSetCountRange(vl_set* set, const void* low, const void* high)
 {
-    // Validate inputs
-    if (!a || !b)
-        return NULL;
+    if (!set)
+        return 0;
 
-    if ((a->elementSize != b->elementSize) || (a->comparator != b->comparator))
-        // Mismatched input set properties.
-        return NULL;
+    const vl_dsidx_t lowRank = low ? vlSetRank(set, low) : 0;
+    const vl_dsidx_t highRank = high ? vlSetRank(set, high) : set->totalElements;
+    return highRank > lowRank ? highRank - lowRank : 0;
+}
 
-    if (dest == NULL)
-        dest = vlSetNew(a->elementSize, a->comparator);
-    else if (dest == a || dest == b)
-        // If dest is the same as one of the inputs, we need to make a temporary
-        // copy to avoid modifying the inputs during iteration
-        return vlSetIntersection(a, b, vlSetNew(a->elementSize, a->comparator));
+/**
+ * \brief Source of elements for a bottom-up build, consumed in ascending order.
+ *
+ * Elements are read either from an array of element pointers, or from a
+ * contiguous array in which runs of equal elements are skipped.
+ * \private
+ */
+typedef struct vl_set_build_cursor_
+{
+    const void* const* pointers; /**< Element pointers, or NULL to read from `elements`. */
+    const vl_usmall_t* elements; /**< Contiguous elements, read when `pointers` is NULL. */
+    vl_dsidx_t index; /**< Index of the next element or pointer to read. */
+    vl_bool_t failed; /**< Set if a node could not be allocated. */
+} vl_set_build_cursor;
 
-    // Optimization: iterate through the smaller set
-    vl_set* smaller = a->totalElements <= b->totalElements ? a : b;
-    vl_set* larger = smaller == a ? b : a;
+/**
+ * \brief Returns the next element of a build cursor.
+ * \private
+ */
+static inline const void* vl_SetBuildNext(vl_set* set, vl_set_build_cursor* cursor)
+{
+    if (cursor->pointers)
+        return cursor->pointers[cursor->index++];
 
-    VL_SET_FOREACH(smaller, curIter)
+    const vl_usmall_t* elem = cursor->elements + cursor->index * set->elementSize;
+    while (cursor->index > 0 && set->comparator(elem - set->elementSize, elem) == 0)
     {
-        const void* const sample = vlSetSample(smaller, curIter);
-        if (vlSetFind(larger, sample) != VL_SET_ITER_INVALID)
-            vlSetInsert(dest, sample);
+        cursor->index++;
+        elem += set->elementSize;
     }
+    cursor->index++;
+    return elem;
+}
 
-    return dest;
+/**
+ * \brief Builds a balanced subtree of `count` elements read from the cursor.
+ *
+ * Nodes are taken in order, so an in-order walk of the finished tree visits
+ * the node pool sequentially. Left and right subtrees differ in size by at
+ * most one, so every level but the deepest is full; nodes on that level are
+ * colored red and all others black, which satisfies the red/black rules.
+ *
+ * \param set pointer
+ * \param cursor element source
+ * \param count number of elements in the subtree
+ * \param depth depth of the subtree root
+ * \param redDepth depth of the deepest, partially filled level
+ * \return iterator of the subtree root
+ * \private
+ */
+static vl_set_iter vl_SetBuildSubtree(vl_set* set, vl_set_build_cursor* cursor, vl_dsidx_t count, vl_uint_t depth,
+                                      vl_uint_t redDepth)
+{
+    if (count == 0 || cursor->failed)
+        return VL_SET_ITER_INVALID;
+
+    const vl_dsidx_t leftCount = count / 2;
+    const vl_set_iter left = vl_SetBuildSubtree(set, cursor, leftCount, depth + 1, redDepth);
+    const vl_set_iter self = vlPoolTake(&set->nodePool);
+    if (self == VL_POOL_INVALID_IDX || cursor->failed)
+    {
+        cursor->failed = VL_TRUE;
+        return VL_SET_ITER_INVALID;
+    }
+
+    vl_set_node* node = vl_SetGetNodeAt(set, self);
+    memcpy(node + 1, vl_SetBuildNext(set, cursor), set->elementSize);
+    node->color = depth == redDepth ? vl_rbtree_color_red : vl_rbtree_color_black;
+#ifdef VL_SET_ORDER_STATISTICS
+    node->size = count;
+#endif
+    node->parent = VL_SET_ITER_INVALID;
+    node->left = left;
+    if (left != VL_SET_ITER_INVALID)
+        vl_SetGetNodeAt(set, left)->parent = self;
+
+    const vl_set_iter right = vl_SetBuildSubtree(set, cursor, count - leftCount - 1, depth + 1, redDepth);
+    node = vl_SetGetNodeAt(set, self);
+    node->right = right;
+    if (right != VL_SET_ITER_INVALID)
+        vl_SetGetNodeAt(set, right)->parent = self;
+    return self;
 }
 
-vl_set* vlSetDifference(vl_set* a, vl_set* b, vl_set* dest)
+/**
+ * \brief Replaces the contents of a set with `count` elements read in ascending order from the cursor.
+ * \return VL_FALSE if allocation failed, in which case the set is left empty.
+ * \private
+ */
+static vl_bool_t vl_SetBuild(vl_set* set, vl_set_build_cursor* cursor, vl_dsidx_t count)
+{
+    vlSetClear(set);
+    if (count == 0)
+        return VL_TRUE;
+
+    // Every level shallower than floor(log2(count + 1)) is full.
+    vl_uint_t redDepth = 0;
+    while (((vl_dsidx_t)2 << redDepth) - 1 <= count)
+        redDepth++;
+
+    vlPoolReserve(&set->nodePool, count);
+    cursor->failed = VL_FALSE;
+    set->root = vl_SetBuildSubtree(set, cursor, count, 0, redDepth);
+    if (cursor->failed)
+    {
+        vlSetClear(set);
+        return VL_FALSE;
+    }
+    set->totalElements = count;
+    return VL_TRUE;
+}
+
+vl_bool_t vlSetBuildSorted(vl_set* set, const void* elements, vl_dsidx_t numElements)
+{
+    if (!set)
+        return VL_FALSE;
+
+    // Validate the order and count unique elements before touching the set.
+    const vl_usmall_t* elem = (const vl_usmall_t*)elements;
+    vl_dsidx_t unique = numElements > 0 ? 1 : 0;
+    for (vl_dsidx_t i = 1; i < numElements; i++)
+    {
+        const int comp = set->comparator(elem + (i - 1) * set->elementSize, elem + i * set->elementSize);
+        if (comp > 0)
+        {
+            vlSetClear(set);
+            return VL_FALSE;
+        }
+        unique += comp != 0;
+    }
+
+    vl_set_build_cursor cursor = {NULL, elem, 0, VL_FALSE};
+    return vl_SetBuild(set, &cursor, unique);
+}
+
+/**
+ * Set operations implemented by vl_SetMerge.
+ * \private
+ */
+typedef enum vl_set_merge_op_
+{
+    vl_set_merge_union,
+    vl_set_merge_intersection,
+    vl_set_merge_difference
+} vl_set_merge_op;
+
+/**
+ * \brief Computes a set operation by walking both inputs in order, then building the result bottom-up.
+ *
+ * Selected elements are gathered as pointers into the inputs, so no element is
+ * copied until the destination tree is built. If `dest` is one of the inputs,
+ * or already holds elements that must be kept, the result is built in a
+ * temporary set whose node pool then replaces that of `dest`.
+ *
+ * \private
+ */
+static vl_set* vl_SetMerge(vl_set* a, vl_set* b, vl_set* dest, vl_set_merge_op op)
 {
     // Validate inputs
     if (!a || !b)
@@ -917,28 +1152,141 @@ vl_set* vlSetDifference(vl_set* a, vl_set* b, vl_set* dest)
         // Mismatched input set properties.
         return NULL;
 
+    vl_bool_t created = VL_FALSE;
     if (dest == NULL)
+    {
         dest = vlSetNew(a->elementSize, a->comparator);
-    else if (dest == a || dest == b)
-        // If dest is the same as one of the inputs, we need to make a temporary
-        // copy to avoid modifying the inputs during iteration
-        return vlSetDifference(a, b, vlSetNew(a->elementSize, a->comparator));
+        created = VL_TRUE;
+    }
+    else if ((dest->elementSize != a->elementSize) || (dest->comparator != a->comparator))
+        return NULL;
+
+    // Elements already in dest are kept, unless dest is an input being overwritten.
+    const vl_bool_t aliased = dest == a || dest == b;
+    const vl_dsidx_t kept = aliased ? 0 : dest->totalElements;
+
+    vl_dsidx_t capacity = a->totalElements;
+    if (op == vl_set_merge_union)
+        capacity += b->totalElements;
+    else if (op == vl_set_merge_intersection && b->totalElements < capacity)
+        capacity = b->totalElements;
+
+    const void** selected = (const void**)vlMemAlloc(sizeof(const void*) * (capacity + kept + 1));
+    if (!selected)
+    {
+        if (created)
+            vlSetDelete(dest);
+        return NULL;
+    }
 
-    // Special case: if B is empty, copy all of A
-    if (b->totalElements == 0)
+    const vl_compare_function comparator = a->comparator;
+    vl_set_iter iterA = vlSetFront(a), iterB = vlSetFront(b);
+    vl_dsidx_t count = 0;
+    while (iterA != VL_SET_ITER_INVALID && iterB != VL_SET_ITER_INVALID)
     {
-        VL_SET_FOREACH(a, curIter) { vlSetInsert(dest, vlSetSample(a, curIter)); }
-        return dest;
+        const void* elemA = vlSetSample(a, iterA);
+        const void* elemB = vlSetSample(b, iterB);
+        const int comp = comparator(elemA, elemB);
+
+        if (comp < 0)
+        {
+            if (op != vl_set_merge_intersection)
+                selected[count++] = elemA;
+            iterA = vlSetNext(a, iterA);
+        }
+        else if (comp > 0)
+        {
+            if (op == vl_set_merge_union)
+                selected[count++] = elemB;
+            iterB = vlSetNext(b, iterB);
+        }
+        else
+        {
+            if (op != vl_set_merge_difference)
+                selected[count++] = elemA;
+            iterA = vlSetNext(a, iterA);
+            iterB = vlSetNext(b, iterB);
+        }
     }
 
-    // Standard case: elements in A but not in B
-    VL_SET_FOREACH(a, curIter)
+    // Drain whichever input remains.
+    for (; iterA != VL_SET_ITER_INVALID && op != vl_set_merge_intersection; iterA = vlSetNext(a, iterA))
+        selected[count++] = vlSetSample(a, iterA);
+    for (; iterB != VL_SET_ITER_INVALID && op == vl_set_merge_union; iterB = vlSetNext(b, iterB))
+        selected[count++] = vlSetSample(b, iterB);
+
+    const void** result = selected;
+    if (kept > 0)
     {
-        const void* const sample = vlSetSample(a, curIter);
+        // Merge the existing contents of dest with the selected elements.
+        result = (const void**)vlMemAlloc(sizeof(const void*) * (count + kept + 1));
+        if (!result)
+        {
+            vlMemFree((vl_memory*)selected);
+            return NULL;
+        }
+
+        vl_set_iter iterDest = vlSetFront(dest);
+        vl_dsidx_t total = 0, index = 0;
+        while (iterDest != VL_SET_ITER_INVALID || index < count)
+        {
+            const void* elemDest = iterDest != VL_SET_ITER_INVALID ? vlSetSample(dest, iterDest) : NULL;
+            const int comp = !elemDest ? 1 : index == count ? -1 : comparator(elemDest, selected[index]);
+
+            if (comp <= 0)
+            {
+                result[total++] = elemDest;
+                iterDest = vlSetNext(dest, iterDest);
+                index += comp == 0;
+            }
+            else
+                result[total++] = selected[index++];
+        }
+        count = total;
+    }
 
-        if (vlSetFind(b, sample) == VL_SET_ITER_INVALID)
-            vlSetInsert(dest, sample);
+    vl_bool_t built;
+    vl_set_build_cursor cursor = {result, NULL, 0, VL_FALSE};
+    if (aliased || kept > 0)
+    {
+        // The result refers to elements in dest; build elsewhere, then take over the new nodes.
+        vl_set temp;
+        vlSetInit(&temp, dest->elementSize, dest->comparator);
+        built = vl_SetBuild(&temp, &cursor, count);
+        if (built)
+        {
+            vlPoolFree(&dest->nodePool);
+            dest->nodePool = temp.nodePool;
+            dest->root = temp.root;
+            dest->totalElements = temp.totalElements;
+        }
+        else
+            vlSetFree(&temp);
     }
+    else
+        built = vl_SetBuild(dest, &cursor, count);
+
+    if (result != selected)
+        vlMemFree((vl_memory*)result);
+    vlMemFree((vl_memory*)selected);
 
+    if (!built)
+    {
+        if (created)
+            vlSetDelete(dest);
+        return NULL;
+    }
     return dest;
 }
+
+vl_set* vlSetUnion(vl_set* a, vl_set* b, vl_set* dest) { return vl_SetMerge(a, b, dest, vl_set_merge_union); }
+
+vl_set* vlSetIntersection(vl_set* a, vl_set* b, vl_set* dest)
+{
+    return vl_SetMerge(a, b, dest, vl_set_merge_intersection);
+}
+
+vl_set* vlSetDifference(vl_set* a, vl_set* b, vl_set* dest)
+{
+    return vl_SetMerge(a, b, dest, vl_set_merge_difference);
+}
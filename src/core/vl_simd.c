@@ -21,6 +21,9 @@ extern void vlSIMDInitSSE2(void);
 #ifdef VL_SIMD_AVX2_AVAILABLE
 extern void vlSIMDInitAVX2(void);
 #endif
+#ifdef VL_SIMD_AVX512_AVAILABLE
+extern void vlSIMDInitAVX512(void);
+#endif
 #ifdef VL_SIMD_NEON_AVAILABLE
 extern void vlSIMDInitNEON(void);
 #endif
@@ -72,6 +75,97 @@ vl_simd_functions_t vlSIMDFunctions = {
     .add_vec4i32 = vlSIMDAddVec4I32Portable,
     .mul_vec4i32 = vlSIMDMulVec4I32Portable,
 
+    /* 512-bit wide operations */
+    .load_vec16f32 = vlSIMDLoadVec16F32Portable,
+    .store_vec16f32 = vlSIMDStoreVec16F32Portable,
+    .splat_vec16f32 = vlSIMDSplatVec16F32Portable,
+    .add_vec16f32 = vlSIMDAddVec16F32Portable,
+    .sub_vec16f32 = vlSIMDSubVec16F32Portable,
+    .mul_vec16f32 = vlSIMDMulVec16F32Portable,
+    .fma_vec16f32 = vlSIMDFmaVec16F32Portable,
+    .hsum_vec16f32 = vlSIMDHsumVec16F32Portable,
+    .load_vec16i32 = vlSIMDLoadVec16I32Portable,
+    .store_vec16i32 = vlSIMDStoreVec16I32Portable,
+    .add_vec16i32 = vlSIMDAddVec16I32Portable,
+    .mul_vec16i32 = vlSIMDMulVec16I32Portable,
+    .load_vec64u8 = vlSIMDLoadVec64U8Portable,
+    .store_vec64u8 = vlSIMDStoreVec64U8Portable,
+    .eqmask_vec64u8 = vlSIMDEqMaskVec64U8Portable,
+
+    /* Sorting networks */
+    .sort_i32 = vlSIMDSortI32Portable,
+    .sort_u32 = vlSIMDSortU32Portable,
+    .sort_f32 = vlSIMDSortF32Portable,
+
+    /* Key ranking */
+    .rank_i32 = vlSIMDRankI32Portable,
+    .rank_u32 = vlSIMDRankU32Portable,
+    .rank_f32 = vlSIMDRankF32Portable,
+
+    /* Array kernels */
+    .sum_f32 = vlSIMDSumF32Portable,
+    .sum_i32 = vlSIMDSumI32Portable,
+    .sum_i16 = vlSIMDSumI16Portable,
+    .sum_u8 = vlSIMDSumU8Portable,
+    .dot_f32 = vlSIMDDotF32Portable,
+    .dot_i32 = vlSIMDDotI32Portable,
+    .dot_i16 = vlSIMDDotI16Portable,
+    .axpy_f32 = vlSIMDAxpyF32Portable,
+    .axpy_i32 = vlSIMDAxpyI32Portable,
+    .scale_f32 = vlSIMDScaleF32Portable,
+    .scale_i32 = vlSIMDScaleI32Portable,
+    .minmax_f32 = vlSIMDMinMaxF32Portable,
+    .minmax_i32 = vlSIMDMinMaxI32Portable,
+    .minmax_i16 = vlSIMDMinMaxI16Portable,
+    .minmax_u8 = vlSIMDMinMaxU8Portable,
+    .argmin_f32 = vlSIMDArgMinF32Portable,
+    .argmin_i32 = vlSIMDArgMinI32Portable,
+    .argmin_i16 = vlSIMDArgMinI16Portable,
+    .argmin_u8 = vlSIMDArgMinU8Portable,
+    .clamp_f32 = vlSIMDClampF32Portable,
+    .clamp_i32 = vlSIMDClampI32Portable,
+    .clamp_i16 = vlSIMDClampI16Portable,
+    .clamp_u8 = vlSIMDClampU8Portable,
+    .prefix_sum_f32 = vlSIMDPrefixSumF32Portable,
+    .prefix_sum_i32 = vlSIMDPrefixSumI32Portable,
+    .compare_f32 = vlSIMDCompareF32Portable,
+    .compare_i32 = vlSIMDCompareI32Portable,
+    .compare_i16 = vlSIMDCompareI16Portable,
+    .compare_u8 = vlSIMDCompareU8Portable,
+
+    /* Byte scanning */
+    .find_u8 = vlSIMDFindU8Portable,
+    .find_last_u8 = vlSIMDFindLastU8Portable,
+    .find_any_u8 = vlSIMDFindAnyU8Portable,
+    .count_u8 = vlSIMDCountU8Portable,
+    .equal_u8 = vlSIMDEqualU8Portable,
+
+    /* Half-precision conversion */
+    .convert_f32_to_half = vlSIMDConvertF32ToHalfPortable,
+    .convert_half_to_f32 = vlSIMDConvertHalfToF32Portable,
+
+    /* Numeric type conversion */
+    .convert_i32_to_f32 = vlSIMDConvertI32ToF32Portable,
+    .convert_f32_to_i32 = vlSIMDConvertF32ToI32Portable,
+    .convert_i16_to_f32 = vlSIMDConvertI16ToF32Portable,
+    .convert_u8_to_f32 = vlSIMDConvertU8ToF32Portable,
+    .convert_f32_to_f64 = vlSIMDConvertF32ToF64Portable,
+    .convert_f64_to_f32 = vlSIMDConvertF64ToF32Portable,
+    .convert_i16_to_i32 = vlSIMDConvertI16ToI32Portable,
+    .convert_i32_to_i16 = vlSIMDConvertI32ToI16Portable,
+
+    /* Byte swapping and gathers */
+    .byteswap_u16 = vlSIMDByteSwapU16Portable,
+    .byteswap_u32 = vlSIMDByteSwapU32Portable,
+    .byteswap_u64 = vlSIMDByteSwapU64Portable,
+    .gather_32 = vlSIMDGather32Portable,
+    .gather_64 = vlSIMDGather64Portable,
+
+    /* Random number generation */
+    .xoshiro_u64 = vlSIMDXoshiroU64Portable,
+    .xoshiro_f32 = vlSIMDXoshiroF32Portable,
+    .xoshiro_f64 = vlSIMDXoshiroF64Portable,
+
     /* Metadata */
     .backend_name = "Portable C (Uninitialized)"};
 
@@ -81,7 +175,7 @@ vl_simd_functions_t vlSIMDFunctions = {
  */
 
 // CPU feature detection (x86)
-#if defined(VL_SIMD_SSE2_AVAILABLE) || defined(VL_SIMD_AVX2_AVAILABLE)
+#if defined(VL_SIMD_SSE2_AVAILABLE) || defined(VL_SIMD_AVX2_AVAILABLE) || defined(VL_SIMD_AVX512_AVAILABLE)
 
 #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
 static inline void vlCPUID(int leaf, int subleaf, int* eax, int* ebx, int* ecx, int* edx)
@@ -97,14 +191,61 @@ static inline void vlCPUID(int leaf, int subleaf, int* eax, int* ebx, int* ecx,
     __cpuid_count(leaf, subleaf, *eax, *ebx, *ecx, *edx);
 #endif
 }
+
+/*
+ * Reads XCR0, the set of register states the OS saves on a context switch.
+ * A CPU can report AVX or AVX-512 while the OS leaves those registers
+ * unmanaged, so the wider backends check both. Returns 0 when XGETBV is not
+ * enabled (CPUID.1:ECX.OSXSAVE[bit 27] clear).
+ */
+static vl_uint64_t vlCPUReadXCR0(void)
+{
+    int eax, ebx, ecx, edx;
+    vlCPUID(1, 0, &eax, &ebx, &ecx, &edx);
+    if ((ecx & (1 << 27)) == 0)
+    {
+        return 0;
+    }
+#ifdef _MSC_VER
+    return (vl_uint64_t)_xgetbv(0);
+#else
+    vl_uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((vl_uint64_t)hi << 32) | lo;
+#endif
+}
 #endif
 
-#ifdef VL_SIMD_AVX2_AVAILABLE
+#if defined(VL_SIMD_AVX2_AVAILABLE) || defined(VL_SIMD_AVX512_AVAILABLE)
 static vl_bool_t vlCPUSupportsAVX2(void)
+{
+    int eax, ebx, ecx, edx;
+    vlCPUID(1, 0, &eax, &ebx, &ecx, &edx);
+    if ((ecx & (1 << 29)) == 0) // Bit 29 of ECX is F16C
+    {
+        return VL_FALSE;
+    }
+    vlCPUID(7, 0, &eax, &ebx, &ecx, &edx);
+    if ((ebx & (1 << 5)) == 0) // Bit 5 of EBX is AVX2
+    {
+        return VL_FALSE;
+    }
+    return (vlCPUReadXCR0() & 0x6) == 0x6; // SSE and AVX state
+}
+#endif
+
+#ifdef VL_SIMD_AVX512_AVAILABLE
+static vl_bool_t vlCPUSupportsAVX512(void)
 {
     int eax, ebx, ecx, edx;
     vlCPUID(7, 0, &eax, &ebx, &ecx, &edx);
-    return (ebx & (1 << 5)) != 0; // Bit 5 of EBX is AVX2
+    // EBX bits 16 (F), 17 (DQ), 30 (BW) and 31 (VL)
+    const vl_uint32_t required = (1u << 16) | (1u << 17) | (1u << 30) | (1u << 31);
+    if (((vl_uint32_t)ebx & required) != required || !vlCPUSupportsAVX2())
+    {
+        return VL_FALSE;
+    }
+    return (vlCPUReadXCR0() & 0xE6) == 0xE6; // SSE, AVX, opmask and both halves of ZMM state
 }
 #endif
 
@@ -113,7 +254,7 @@ static vl_bool_t vlCPUSupportsSSE2(void)
 {
     int eax, ebx, ecx, edx;
     vlCPUID(1, 0, &eax, &ebx, &ecx, &edx);
-    return (ecx & (1 << 26)) != 0; // Bit 26 of ECX is SSE2
+    return (edx & (1 << 26)) != 0; // Bit 26 of EDX is SSE2
 }
 #endif
 
@@ -132,19 +273,28 @@ static vl_bool_t vlCPUSupportsNEON(void)
  * ============================================================================
  */
 
+/* Set once a backend has been chosen, either automatically or through vlSIMDUseBackend. */
+static vl_bool_t vlSIMDInitialized = VL_FALSE;
+
 const char* vlSIMDInit(void)
 {
-    static vl_bool_t initialized = VL_FALSE;
-
-    if (initialized)
+    if (vlSIMDInitialized)
     {
         return vlSIMDFunctions.backend_name;
     }
 
-    initialized = VL_TRUE;
+    vlSIMDInitialized = VL_TRUE;
 
     // Try to initialize best available implementation
 #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#ifdef VL_SIMD_AVX512_AVAILABLE
+    if (vlCPUSupportsAVX512())
+    {
+        vlSIMDInitAVX512();
+        return vlSIMDFunctions.backend_name;
+    }
+#endif
+
 #ifdef VL_SIMD_AVX2_AVAILABLE
     if (vlCPUSupportsAVX2())
     {
@@ -178,3 +328,60 @@ const char* vlSIMDInit(void)
     vlSIMDInitPortable();
     return vlSIMDFunctions.backend_name;
 }
+
+vl_bool_t vlSIMDUseBackend(vl_simd_backend backend)
+{
+    switch (backend)
+    {
+    case VL_SIMD_BACKEND_PORTABLE:
+        vlSIMDInitPortable();
+        break;
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#ifdef VL_SIMD_SSE2_AVAILABLE
+    case VL_SIMD_BACKEND_SSE2:
+        if (!vlCPUSupportsSSE2())
+        {
+            return VL_FALSE;
+        }
+        vlSIMDInitSSE2();
+        break;
+#endif
+#ifdef VL_SIMD_AVX2_AVAILABLE
+    case VL_SIMD_BACKEND_AVX2:
+        if (!vlCPUSupportsAVX2())
+        {
+            return VL_FALSE;
+        }
+        vlSIMDInitAVX2();
+        break;
+#endif
+#ifdef VL_SIMD_AVX512_AVAILABLE
+    case VL_SIMD_BACKEND_AVX512:
+        if (!vlCPUSupportsAVX512())
+        {
+            return VL_FALSE;
+        }
+        vlSIMDInitAVX512();
+        break;
+#endif
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#ifdef VL_SIMD_NEON64_AVAILABLE
+    case VL_SIMD_BACKEND_NEON64:
+        vlSIMDInitNEON64();
+        break;
+#endif
+#elif defined(__arm__) || defined(_M_ARM)
+#ifdef VL_SIMD_NEON_AVAILABLE
+    case VL_SIMD_BACKEND_NEON:
+        vlSIMDInitNEON();
+        break;
+#endif
+#endif
+    default:
+        return VL_FALSE;
+    }
+
+    vlSIMDInitialized = VL_TRUE;
+    return VL_TRUE;
+}
@@ -0,0 +1,453 @@
+#include "vl_skiplist.h"
+#include "vl_thread.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Low bit of a forward pointer, set when the node owning the pointer has been
+ * removed at that level.
+ * \private
+ */
+#define VL_SKIPLIST_MARK ((vl_uintptr_t)1)
+
+/**
+ * Node pointer held by a forward pointer, without its mark.
+ * \private
+ */
+#define VL_SKIPLIST_PTR(link) ((vl_skiplist_node*)((link) & ~VL_SKIPLIST_MARK))
+
+/**
+ * Skiplist node header. The element follows the forward pointers.
+ * \private
+ */
+typedef struct vl_skiplist_node
+{
+    struct vl_skiplist_node* retired; // Next node on the retired stack.
+    vl_uint_t height; // Number of levels, and of forward pointers.
+    vl_atomic_uintptr_t next[]; // Forward pointers, one per level. Marked once the node is removed at that level.
+} vl_skiplist_node;
+
+/**
+ * Element stored in a node.
+ * \private
+ */
+#define VL_SKIPLIST_ELEMENT(node) ((void*)((node)->next + (node)->height))
+
+/**
+ * Per-thread state for choosing node heights.
+ * \private
+ */
+static VL_THREAD_LOCAL vl_uint64_t vl_skiplist_height_state = 0;
+
+/**
+ * \brief Picks the height of a new node.
+ *
+ * Each additional level is taken with probability 1/4, from a per-thread
+ * xorshift generator so that threads inserting concurrently share no state.
+ *
+ * \private
+ */
+static vl_uint_t vl_SkipListRandomHeight(void)
+{
+    vl_uint64_t x = vl_skiplist_height_state;
+    if (x == 0)
+        x = ((vl_uint64_t)(vl_uintptr_t)&vl_skiplist_height_state ^ vlThreadMonotonicNano()) | 1;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    vl_skiplist_height_state = x;
+
+    vl_uint64_t bits = (x * 0x2545F4914F6CDD1DULL) >> 32;
+    vl_uint_t height = 1;
+    while ((bits & 3) == 0 && height < VL_SKIPLIST_MAX_LEVEL)
+    {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+/**
+ * \brief Index of the node pool holding nodes of the given height.
+ * \private
+ */
+static inline vl_uint_t vl_SkipListPoolIndex(vl_uint_t height)
+{
+    vl_uint_t index = 0;
+    while ((1u << index) < height)
+        index++;
+    return index;
+}
+
+/**
+ * \brief Loads a forward pointer, synchronizing with the CAS that stored it.
+ * \private
+ */
+static inline vl_uintptr_t vl_SkipListLoad(vl_skiplist_node* node, vl_uint_t level)
+{
+    return vlAtomicLoadExplicit(&node->next[level], VL_MEMORY_ORDER_ACQUIRE);
+}
+
+/**
+ * \brief Takes a node of the given height from its pool, with all forward pointers cleared.
+ * \private
+ */
+static vl_skiplist_node* vl_SkipListTakeNode(vl_skiplist* list, vl_uint_t height)
+{
+    vl_skiplist_node* node = vlAsyncPoolTake(&list->nodes[vl_SkipListPoolIndex(height)]);
+    if (node == NULL)
+        return NULL;
+
+    node->retired = NULL;
+    node->height = height;
+    for (vl_uint_t level = 0; level < height; level++)
+        vlAtomicInit(&node->next[level], 0);
+    return node;
+}
+
+/**
+ * \brief Takes and links a fresh head node.
+ * \private
+ */
+static void vl_SkipListSetHead(vl_skiplist* list)
+{
+    list->head = vl_SkipListTakeNode(list, VL_SKIPLIST_MAX_LEVEL);
+    vlAtomicInit(&list->retired, 0);
+    vlAtomicInit(&list->size, 0);
+}
+
+/**
+ * \brief Locates the predecessors and successors of an element on every level.
+ *
+ * On each level, `preds` receives the last node ordering before `elem`, and
+ * `succs` the node following it. Marked nodes met along the way are unlinked;
+ * if an unlink fails because the predecessor changed, the search restarts.
+ *
+ * \return VL_TRUE if the bottom-level successor is equal to `elem`.
+ * \private
+ */
+static vl_bool_t vl_SkipListSearch(vl_skiplist* list, const void* elem, vl_skiplist_node** preds,
+                                   vl_skiplist_node** succs)
+{
+    vl_int_t comparison;
+
+retry:
+    comparison = 1;
+    vl_skiplist_node* pred = list->head;
+
+    for (vl_int_t level = VL_SKIPLIST_MAX_LEVEL - 1; level >= 0; level--)
+    {
+        vl_skiplist_node* curr = VL_SKIPLIST_PTR(vl_SkipListLoad(pred, level));
+        comparison = 1;
+
+        while (curr)
+        {
+            vl_uintptr_t succ = vl_SkipListLoad(curr, level);
+
+            while (succ & VL_SKIPLIST_MARK)
+            {
+                vl_uintptr_t expected = (vl_uintptr_t)curr;
+                if (!vlAtomicCompareExchangeStrong(&pred->next[level], &expected, succ & ~VL_SKIPLIST_MARK))
+                    goto retry;
+
+                curr = VL_SKIPLIST_PTR(succ);
+                if (curr == NULL)
+                    break;
+                succ = vl_SkipListLoad(curr, level);
+            }
+
+            if (curr == NULL)
+                break;
+
+            comparison = list->comparator(VL_SKIPLIST_ELEMENT(curr), elem);
+            if (comparison >= 0)
+                break;
+
+            pred = curr;
+            curr = VL_SKIPLIST_PTR(succ);
+        }
+
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+
+    return succs[0] != NULL && comparison == 0;
+}
+
+/**
+ * \brief Finds the first present node not ordering before `elem`, without writing to the list.
+ *
+ * Marked nodes are stepped over rather than unlinked, so the walk never
+ * restarts.
+ *
+ * \param comparison receives the comparison of the returned node against `elem`
+ * \private
+ */
+static vl_skiplist_node* vl_SkipListSeek(const vl_skiplist* list, const void* elem, vl_int_t* comparison)
+{
+    vl_skiplist_node* pred = list->head;
+    vl_skiplist_node* curr = NULL;
+
+    for (vl_int_t level = VL_SKIPLIST_MAX_LEVEL - 1; level >= 0; level--)
+    {
+        curr = VL_SKIPLIST_PTR(vl_SkipListLoad(pred, level));
+        *comparison = 1;
+
+        while (curr)
+        {
+            vl_uintptr_t succ = vl_SkipListLoad(curr, level);
+
+            while (succ & VL_SKIPLIST_MARK)
+            {
+                curr = VL_SKIPLIST_PTR(succ);
+                if (curr == NULL)
+                    break;
+                succ = vl_SkipListLoad(curr, level);
+            }
+
+            if (curr == NULL)
+                break;
+
+            *comparison = list->comparator(VL_SKIPLIST_ELEMENT(curr), elem);
+            if (*comparison >= 0)
+                break;
+
+            pred = curr;
+            curr = VL_SKIPLIST_PTR(succ);
+        }
+    }
+
+    return curr;
+}
+
+/**
+ * \brief Returns the first node after `node` on the bottom level that has not been removed.
+ * \private
+ */
+static vl_skiplist_node* vl_SkipListNextPresent(vl_skiplist_node* node)
+{
+    vl_skiplist_node* curr = VL_SKIPLIST_PTR(vl_SkipListLoad(node, 0));
+
+    while (curr && (vl_SkipListLoad(curr, 0) & VL_SKIPLIST_MARK))
+        curr = VL_SKIPLIST_PTR(vl_SkipListLoad(curr, 0));
+
+    return curr;
+}
+
+void vlSkipListInit(vl_skiplist* list, vl_uint16_t elementSize, vl_compare_function comparator)
+{
+    list->elementSize = elementSize;
+    list->comparator = comparator;
+
+    for (vl_uint_t i = 0; i < VL_SKIPLIST_POOL_COUNT; i++)
+    {
+        const vl_memsize_t nodeSize =
+            sizeof(vl_skiplist_node) + (sizeof(vl_atomic_uintptr_t) << i) + (vl_memsize_t)elementSize;
+        vlAsyncPoolInit(&list->nodes[i], (vl_uint16_t)nodeSize);
+    }
+
+    vl_SkipListSetHead(list);
+}
+
+void vlSkipListFree(vl_skiplist* list)
+{
+    for (vl_uint_t i = 0; i < VL_SKIPLIST_POOL_COUNT; i++)
+        vlAsyncPoolFree(&list->nodes[i]);
+    list->head = NULL;
+}
+
+vl_skiplist* vlSkipListNew(vl_uint16_t elementSize, vl_compare_function comparator)
+{
+    vl_skiplist* list = malloc(sizeof(vl_skiplist));
+    if (!list)
+        return NULL;
+    vlSkipListInit(list, elementSize, comparator);
+    return list;
+}
+
+void vlSkipListDelete(vl_skiplist* list)
+{
+    vlSkipListFree(list);
+    free(list);
+}
+
+void vlSkipListClear(vl_skiplist* list)
+{
+    for (vl_uint_t i = 0; i < VL_SKIPLIST_POOL_COUNT; i++)
+        vlAsyncPoolClear(&list->nodes[i]);
+    vl_SkipListSetHead(list);
+}
+
+vl_dsidx_t vlSkipListReclaim(vl_skiplist* list)
+{
+    vl_skiplist_node* head = list->head;
+
+    // Removals can race with insertions still linking upper levels, leaving marked nodes reachable.
+    for (vl_uint_t level = 0; level < VL_SKIPLIST_MAX_LEVEL; level++)
+    {
+        vl_skiplist_node* pred = head;
+        vl_uintptr_t link = vl_SkipListLoad(pred, level);
+
+        while (link)
+        {
+            vl_skiplist_node* curr = VL_SKIPLIST_PTR(link);
+            link = vl_SkipListLoad(curr, level);
+
+            if (link & VL_SKIPLIST_MARK)
+                vlAtomicStoreExplicit(&pred->next[level], link & ~VL_SKIPLIST_MARK, VL_MEMORY_ORDER_RELAXED);
+            else
+                pred = curr;
+
+            link &= ~VL_SKIPLIST_MARK;
+        }
+    }
+
+    vl_dsidx_t total = 0;
+    vl_skiplist_node* node = (vl_skiplist_node*)vlAtomicExchange(&list->retired, 0);
+    while (node)
+    {
+        vl_skiplist_node* next = node->retired;
+        vlAsyncPoolReturn(&list->nodes[vl_SkipListPoolIndex(node->height)], node);
+        node = next;
+        total++;
+    }
+
+    return total;
+}
+
+vl_bool_t vlSkipListInsert(vl_skiplist* list, const void* elem)
+{
+    vl_skiplist_node* preds[VL_SKIPLIST_MAX_LEVEL];
+    vl_skiplist_node* succs[VL_SKIPLIST_MAX_LEVEL];
+    vl_skiplist_node* node = NULL;
+    const vl_uint_t height = vl_SkipListRandomHeight();
+
+    while (VL_TRUE)
+    {
+        if (vl_SkipListSearch(list, elem, preds, succs))
+        {
+            // The node was never published, so it can go straight back to its pool.
+            if (node)
+                vlAsyncPoolReturn(&list->nodes[vl_SkipListPoolIndex(height)], node);
+            return VL_FALSE;
+        }
+
+        if (node == NULL)
+        {
+            node = vl_SkipListTakeNode(list, height);
+            if (node == NULL)
+                return VL_FALSE;
+            memcpy(VL_SKIPLIST_ELEMENT(node), elem, list->elementSize);
+        }
+
+        for (vl_uint_t level = 0; level < height; level++)
+            vlAtomicStoreExplicit(&node->next[level], (vl_uintptr_t)succs[level], VL_MEMORY_ORDER_RELAXED);
+
+        // Linking the bottom level publishes the node, along with its element and forward pointers.
+        vl_uintptr_t expected = (vl_uintptr_t)succs[0];
+        if (vlAtomicCompareExchangeStrong(&preds[0]->next[0], &expected, (vl_uintptr_t)node))
+            break;
+    }
+
+    vlAtomicFetchAddExplicit(&list->size, 1, VL_MEMORY_ORDER_RELAXED);
+
+    for (vl_uint_t level = 1; level < height; level++)
+    {
+        while (VL_TRUE)
+        {
+            vl_uintptr_t link = vl_SkipListLoad(node, level);
+            const vl_uintptr_t succ = (vl_uintptr_t)succs[level];
+
+            // Only a removal writes to a published node's forward pointers, so a failed CAS means it is going away.
+            if (link & VL_SKIPLIST_MARK)
+                return VL_TRUE;
+            if (link != succ && !vlAtomicCompareExchangeStrong(&node->next[level], &link, succ))
+                return VL_TRUE;
+
+            vl_uintptr_t expected = succ;
+            if (vlAtomicCompareExchangeStrong(&preds[level]->next[level], &expected, (vl_uintptr_t)node))
+                break;
+
+            vl_SkipListSearch(list, elem, preds, succs);
+            if (succs[0] != node)
+                return VL_TRUE;
+        }
+    }
+
+    return VL_TRUE;
+}
+
+vl_bool_t vlSkipListRemove(vl_skiplist* list, const void* elem, void* dest)
+{
+    vl_skiplist_node* preds[VL_SKIPLIST_MAX_LEVEL];
+    vl_skiplist_node* succs[VL_SKIPLIST_MAX_LEVEL];
+
+    if (!vl_SkipListSearch(list, elem, preds, succs))
+        return VL_FALSE;
+
+    vl_skiplist_node* node = succs[0];
+
+    for (vl_uint_t level = node->height - 1; level > 0; level--)
+    {
+        vl_uintptr_t link = vl_SkipListLoad(node, level);
+        while (!(link & VL_SKIPLIST_MARK))
+            vlAtomicCompareExchangeWeak(&node->next[level], &link, link | VL_SKIPLIST_MARK);
+    }
+
+    // Whichever thread marks the bottom level owns the removal.
+    vl_uintptr_t link = vl_SkipListLoad(node, 0);
+    while (VL_TRUE)
+    {
+        if (link & VL_SKIPLIST_MARK)
+            return VL_FALSE;
+        if (vlAtomicCompareExchangeWeak(&node->next[0], &link, link | VL_SKIPLIST_MARK))
+            break;
+    }
+
+    if (dest)
+        memcpy(dest, VL_SKIPLIST_ELEMENT(node), list->elementSize);
+    vlAtomicFetchSubExplicit(&list->size, 1, VL_MEMORY_ORDER_RELAXED);
+
+    // Unlink the node from every level, then retire it until the next reclaim.
+    vl_SkipListSearch(list, elem, preds, succs);
+
+    vl_uintptr_t top = vlAtomicLoadExplicit(&list->retired, VL_MEMORY_ORDER_RELAXED);
+    do
+    {
+        node->retired = (vl_skiplist_node*)top;
+    } while (!vlAtomicCompareExchangeWeak(&list->retired, &top, (vl_uintptr_t)node));
+
+    return VL_TRUE;
+}
+
+vl_skiplist_iter vlSkipListFind(const vl_skiplist* list, const void* elem)
+{
+    vl_int_t comparison;
+    vl_skiplist_node* node = vl_SkipListSeek(list, elem, &comparison);
+    return (node && comparison == 0) ? (vl_skiplist_iter)node : VL_SKIPLIST_ITER_INVALID;
+}
+
+vl_skiplist_iter vlSkipListLowerBound(const vl_skiplist* list, const void* elem)
+{
+    vl_int_t comparison;
+    return (vl_skiplist_iter)vl_SkipListSeek(list, elem, &comparison);
+}
+
+vl_skiplist_iter vlSkipListFront(const vl_skiplist* list)
+{
+    return (vl_skiplist_iter)vl_SkipListNextPresent(list->head);
+}
+
+vl_skiplist_iter vlSkipListNext(const vl_skiplist* list, vl_skiplist_iter iter)
+{
+    (void)list;
+    return (vl_skiplist_iter)vl_SkipListNextPresent((vl_skiplist_node*)iter);
+}
+
+void* vlSkipListSample(const vl_skiplist* list, vl_skiplist_iter iter)
+{
+    (void)list;
+    return VL_SKIPLIST_ELEMENT((vl_skiplist_node*)iter);
+}
@@ -0,0 +1,1427 @@
+#include "vl_sort.h"
+#include "vl_simd.h"
+
+#include <string.h>
+
+/**
+ * \brief Digit width for keys of 32 bits or more.
+ *
+ * 11-bit digits sort 32-bit keys in three passes and 64-bit keys in six,
+ * instead of four and eight, while a 2048-entry histogram still fits in L1.
+ * \private
+ */
+#define VL_SORT_RADIX_WIDE_BITS 11
+
+/**
+ * \brief Digit width for 8 and 16-bit keys.
+ * \private
+ */
+#define VL_SORT_RADIX_NARROW_BITS 8
+
+/**
+ * \brief Upper bound on the number of digits in any supported key.
+ * \private
+ */
+#define VL_SORT_RADIX_MAX_DIGITS 8
+
+/**
+ * \brief Smallest chunk handed to a single thread by vlSortRadixParallel.
+ *
+ * Below this, per-chunk histogram setup outweighs the scatter work it splits.
+ * \private
+ */
+#define VL_SORT_RADIX_CHUNK_MIN 32768
+
+/**
+ * \brief Describes where a record's key lives and how to make it sort as an unsigned integer.
+ * \private
+ */
+typedef struct
+{
+    vl_memsize_t elementSize;
+    vl_memsize_t keyOffset;
+    vl_uint_t width; // Key width in bytes.
+    vl_uint_t digitBits;
+    vl_uint_t digits;
+    vl_uint_t buckets; // 1 << digitBits
+    vl_ularge_t mask; // All ones across the key width.
+    vl_ularge_t signBit; // Most significant bit of the key; 0 for unsigned keys.
+    vl_bool_t isFloating;
+} vl_sort_radix_key;
+
+/**
+ * \brief Validates a key description and derives its transform.
+ * \private
+ */
+static vl_bool_t vl_SortRadixKeyInit(vl_sort_radix_key* key, vl_memsize_t elementSize, vl_numtype keyType,
+                                     vl_memsize_t keyOffset)
+{
+    if ((vl_uint_t)keyType >= VL_NUMTYPE_MAX)
+        return VL_FALSE;
+
+    const vl_numtype_info* info = &VL_NUMTYPE_INFO[keyType];
+    const vl_uint_t width = info->size;
+
+    if (width != 1 && width != 2 && width != 4 && width != 8)
+        return VL_FALSE;
+    if (width > sizeof(vl_ularge_t) || keyOffset > elementSize || elementSize - keyOffset < width)
+        return VL_FALSE;
+
+    const vl_uint_t bits = width * 8;
+
+    key->elementSize = elementSize;
+    key->keyOffset = keyOffset;
+    key->width = width;
+    key->digitBits = width >= 4 ? VL_SORT_RADIX_WIDE_BITS : VL_SORT_RADIX_NARROW_BITS;
+    key->digits = (bits + key->digitBits - 1) / key->digitBits;
+    key->buckets = 1u << key->digitBits;
+    key->mask = bits >= sizeof(vl_ularge_t) * 8 ? ~(vl_ularge_t)0 : (((vl_ularge_t)1 << bits) - 1);
+    key->signBit = (info->isSigned || info->isFloating) ? (vl_ularge_t)1 << (bits - 1) : 0;
+    key->isFloating = info->isFloating;
+    return VL_TRUE;
+}
+
+/**
+ * \brief Reads a key of the given width.
+ * \private
+ */
+static inline vl_ularge_t vl_SortRadixLoad(const vl_usmall_t* src, vl_uint_t width)
+{
+    switch (width)
+    {
+        case 1:
+            return *src;
+        case 2:
+        {
+            vl_uint16_t value;
+            memcpy(&value, src, sizeof(value));
+            return value;
+        }
+        case 4:
+        {
+            vl_uint32_t value;
+            memcpy(&value, src, sizeof(value));
+            return value;
+        }
+        default:
+        {
+            vl_ularge_t value;
+            memcpy(&value, src, sizeof(value));
+            return value;
+        }
+    }
+}
+
+/**
+ * \brief Writes a key of the given width.
+ * \private
+ */
+static inline void vl_SortRadixStore(vl_usmall_t* dst, vl_uint_t width, vl_ularge_t value)
+{
+    switch (width)
+    {
+        case 1:
+            *dst = (vl_usmall_t)value;
+            return;
+        case 2:
+        {
+            const vl_uint16_t narrow = (vl_uint16_t)value;
+            memcpy(dst, &narrow, sizeof(narrow));
+            return;
+        }
+        case 4:
+        {
+            const vl_uint32_t narrow = (vl_uint32_t)value;
+            memcpy(dst, &narrow, sizeof(narrow));
+            return;
+        }
+        default:
+            memcpy(dst, &value, sizeof(value));
+            return;
+    }
+}
+
+/**
+ * \brief Maps a key to an unsigned integer with the same ordering.
+ * \private
+ */
+static inline vl_ularge_t vl_SortRadixEncode(const vl_sort_radix_key* key, vl_ularge_t value)
+{
+    if (key->isFloating)
+        return (value & key->signBit) ? (~value & key->mask) : (value ^ key->signBit);
+    return value ^ key->signBit;
+}
+
+/**
+ * \brief Inverse of vl_SortRadixEncode.
+ * \private
+ */
+static inline vl_ularge_t vl_SortRadixDecode(const vl_sort_radix_key* key, vl_ularge_t value)
+{
+    if (key->isFloating)
+        return (value & key->signBit) ? (value ^ key->signBit) : (~value & key->mask);
+    return value ^ key->signBit;
+}
+
+/**
+ * \brief Returns true if keys must be rewritten to sort as unsigned integers.
+ * \private
+ */
+static inline vl_bool_t vl_SortRadixNeedsEncode(const vl_sort_radix_key* key)
+{
+    return key->isFloating || key->signBit != 0;
+}
+
+/**
+ * \brief Encodes keys in `[begin, end)` in place and counts every digit of every key in one pass.
+ *
+ * `counts` holds `digits` consecutive histograms, least significant digit first.
+ * \private
+ */
+static void vl_SortRadixEncodeCount(const vl_sort_radix_key* key, vl_usmall_t* base, vl_dsidx_t begin,
+                                    vl_dsidx_t end, vl_memsize_t* counts)
+{
+    const vl_memsize_t size = key->elementSize;
+    const vl_uint_t width = key->width;
+    const vl_uint_t digitBits = key->digitBits;
+    const vl_uint_t digits = key->digits;
+    const vl_uint_t buckets = key->buckets;
+    const vl_ularge_t digitMask = buckets - 1;
+    const vl_bool_t encode = vl_SortRadixNeedsEncode(key);
+    vl_usmall_t* keyPtr = base + (vl_memsize_t)begin * size + key->keyOffset;
+
+    memset(counts, 0, sizeof(vl_memsize_t) * buckets * digits);
+
+    for (vl_dsidx_t i = begin; i < end; i++, keyPtr += size)
+    {
+        vl_ularge_t value = vl_SortRadixLoad(keyPtr, width);
+        if (encode)
+        {
+            value = vl_SortRadixEncode(key, value);
+            vl_SortRadixStore(keyPtr, width, value);
+        }
+
+        for (vl_uint_t digit = 0; digit < digits; digit++)
+            counts[digit * buckets + ((value >> (digit * digitBits)) & digitMask)]++;
+    }
+}
+
+/**
+ * \brief Restores the original representation of keys in `[begin, end)`.
+ * \private
+ */
+static void vl_SortRadixDecodeRange(const vl_sort_radix_key* key, vl_usmall_t* base, vl_dsidx_t begin,
+                                    vl_dsidx_t end)
+{
+    const vl_memsize_t size = key->elementSize;
+    const vl_uint_t width = key->width;
+    vl_usmall_t* keyPtr = base + (vl_memsize_t)begin * size + key->keyOffset;
+
+    if (!vl_SortRadixNeedsEncode(key))
+        return;
+
+    for (vl_dsidx_t i = begin; i < end; i++, keyPtr += size)
+        vl_SortRadixStore(keyPtr, width, vl_SortRadixDecode(key, vl_SortRadixLoad(keyPtr, width)));
+}
+
+/**
+ * \brief Counts a single digit of the encoded keys in `[begin, end)`.
+ * \private
+ */
+static void vl_SortRadixCountDigit(const vl_sort_radix_key* key, const vl_usmall_t* base, vl_dsidx_t begin,
+                                   vl_dsidx_t end, vl_uint_t digit, vl_memsize_t* counts)
+{
+    const vl_memsize_t size = key->elementSize;
+    const vl_uint_t width = key->width;
+    const vl_uint_t shift = digit * key->digitBits;
+    const vl_ularge_t digitMask = key->buckets - 1;
+    const vl_usmall_t* keyPtr = base + (vl_memsize_t)begin * size + key->keyOffset;
+
+    memset(counts, 0, sizeof(vl_memsize_t) * key->buckets);
+
+    for (vl_dsidx_t i = begin; i < end; i++, keyPtr += size)
+        counts[(vl_SortRadixLoad(keyPtr, width) >> shift) & digitMask]++;
+}
+
+/**
+ * \brief Returns true if every key shares the same value for the digit described by `counts`.
+ * \private
+ */
+static vl_bool_t vl_SortRadixDigitTrivial(const vl_memsize_t* counts, vl_uint_t buckets, vl_dsidx_t numElements)
+{
+    for (vl_uint_t bucket = 0; bucket < buckets; bucket++)
+    {
+        if (counts[bucket] != 0)
+            return counts[bucket] == numElements;
+    }
+    return VL_TRUE;
+}
+
+/**
+ * \brief Scatters `[begin, end)` of `src` into `dst` by one digit.
+ *
+ * Always called with literal `size`, `keyOffset` and `width` where they are
+ * known, so each call site inlines into a loop specialized for that layout.
+ * \private
+ */
+static inline void vl_SortRadixScatterSized(const vl_usmall_t* src, vl_usmall_t* dst, vl_dsidx_t begin,
+                                            vl_dsidx_t end, vl_memsize_t size, vl_memsize_t keyOffset,
+                                            vl_uint_t width, vl_uint_t shift, vl_ularge_t digitMask,
+                                            vl_memsize_t* offsets)
+{
+    const vl_usmall_t* elem = src + (vl_memsize_t)begin * size;
+
+    for (vl_dsidx_t i = begin; i < end; i++, elem += size)
+    {
+        const vl_uint_t bucket = (vl_uint_t)((vl_SortRadixLoad(elem + keyOffset, width) >> shift) & digitMask);
+        memcpy(dst + offsets[bucket]++ * size, elem, size);
+    }
+}
+
+/**
+ * \brief Scatters `[begin, end)` of `src` into `dst` by one digit, dispatching to a layout-specialized loop.
+ * \private
+ */
+static void vl_SortRadixScatter(const vl_sort_radix_key* key, const vl_usmall_t* src, vl_usmall_t* dst,
+                                vl_dsidx_t begin, vl_dsidx_t end, vl_uint_t digit, vl_memsize_t* offsets)
+{
+    const vl_memsize_t size = key->elementSize;
+    const vl_uint_t shift = digit * key->digitBits;
+    const vl_ularge_t mask = key->buckets - 1;
+
+    if (size == key->width)
+    {
+        switch (size)
+        {
+            case 1:
+                vl_SortRadixScatterSized(src, dst, begin, end, 1, 0, 1, shift, mask, offsets);
+                return;
+            case 2:
+                vl_SortRadixScatterSized(src, dst, begin, end, 2, 0, 2, shift, mask, offsets);
+                return;
+            case 4:
+                vl_SortRadixScatterSized(src, dst, begin, end, 4, 0, 4, shift, mask, offsets);
+                return;
+            default:
+                vl_SortRadixScatterSized(src, dst, begin, end, 8, 0, 8, shift, mask, offsets);
+                return;
+        }
+    }
+
+    switch (size)
+    {
+        case 8:
+            vl_SortRadixScatterSized(src, dst, begin, end, 8, key->keyOffset, key->width, shift, mask, offsets);
+            return;
+        case 16:
+            vl_SortRadixScatterSized(src, dst, begin, end, 16, key->keyOffset, key->width, shift, mask, offsets);
+            return;
+        default:
+            vl_SortRadixScatterSized(src, dst, begin, end, size, key->keyOffset, key->width, shift, mask, offsets);
+            return;
+    }
+}
+
+/**
+ * \brief Converts a histogram into starting offsets in place.
+ * \private
+ */
+static void vl_SortRadixPrefix(vl_memsize_t* counts, vl_uint_t buckets)
+{
+    vl_memsize_t running = 0;
+    for (vl_uint_t bucket = 0; bucket < buckets; bucket++)
+    {
+        const vl_memsize_t count = counts[bucket];
+        counts[bucket] = running;
+        running += count;
+    }
+}
+
+VL_API vl_bool_t vlSortRadix(void* buffer, vl_memsize_t elementSize, vl_dsidx_t numElements, vl_numtype keyType,
+                             vl_memsize_t keyOffset)
+{
+    vl_sort_radix_key key;
+    if (!vl_SortRadixKeyInit(&key, elementSize, keyType, keyOffset))
+        return VL_FALSE;
+
+    if (numElements < 2)
+        return VL_TRUE;
+
+    const vl_memsize_t histogramBytes = sizeof(vl_memsize_t) * key.buckets * key.digits;
+    vl_usmall_t* const scratch = (vl_usmall_t*)vlMemAlloc(histogramBytes + elementSize * numElements);
+    if (scratch == NULL)
+        return VL_FALSE;
+
+    vl_memsize_t* const counts = (vl_memsize_t*)scratch;
+    vl_usmall_t* src = buffer;
+    vl_usmall_t* dst = scratch + histogramBytes;
+
+    vl_SortRadixEncodeCount(&key, src, 0, numElements, counts);
+
+    for (vl_uint_t digit = 0; digit < key.digits; digit++)
+    {
+        vl_memsize_t* const offsets = counts + digit * key.buckets;
+        if (vl_SortRadixDigitTrivial(offsets, key.buckets, numElements))
+            continue;
+
+        vl_SortRadixPrefix(offsets, key.buckets);
+        vl_SortRadixScatter(&key, src, dst, 0, numElements, digit, offsets);
+
+        vl_usmall_t* const swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != buffer)
+        memcpy(buffer, src, elementSize * numElements);
+
+    vl_SortRadixDecodeRange(&key, buffer, 0, numElements);
+
+    vlMemFree((vl_memory*)scratch);
+    return VL_TRUE;
+}
+
+/**
+ * \brief Step a vlSortRadixParallel job performs for each chunk.
+ * \private
+ */
+typedef enum
+{
+    VL_SORT_RADIX_PHASE_ENCODE,
+    VL_SORT_RADIX_PHASE_COUNT,
+    VL_SORT_RADIX_PHASE_SCATTER,
+    VL_SORT_RADIX_PHASE_COPY,
+    VL_SORT_RADIX_PHASE_DECODE
+} vl_sort_radix_phase;
+
+/**
+ * \brief Shared state of a parallel radix sort.
+ *
+ * `counts` holds `digits` histograms per chunk; chunk `c`, digit `d` lives at
+ * `counts + (c * digits + d) * buckets`.
+ * \private
+ */
+typedef struct
+{
+    const vl_sort_radix_key* key;
+    vl_usmall_t* buffer;
+    vl_usmall_t* src;
+    vl_usmall_t* dst;
+    vl_dsidx_t numElements;
+    vl_dsidx_t chunkLength;
+    vl_memsize_t* counts;
+    vl_uint_t digit;
+    vl_sort_radix_phase phase;
+} vl_sort_radix_job;
+
+/**
+ * \brief Returns the histogram of `digit` belonging to `chunk`.
+ * \private
+ */
+static inline vl_memsize_t* vl_SortRadixChunkCounts(const vl_sort_radix_job* job, vl_uint_t chunk, vl_uint_t digit)
+{
+    return job->counts + ((vl_memsize_t)chunk * job->key->digits + digit) * job->key->buckets;
+}
+
+/**
+ * \brief Runs the current phase over one chunk.
+ * \private
+ */
+static void vl_SortRadixChunk(void* user, vl_uint_t chunk)
+{
+    vl_sort_radix_job* job = user;
+    const vl_dsidx_t begin = (vl_dsidx_t)chunk * job->chunkLength;
+    const vl_dsidx_t end = job->numElements - begin < job->chunkLength ? job->numElements : begin + job->chunkLength;
+    const vl_memsize_t size = job->key->elementSize;
+
+    switch (job->phase)
+    {
+        case VL_SORT_RADIX_PHASE_ENCODE:
+            vl_SortRadixEncodeCount(job->key, job->src, begin, end, vl_SortRadixChunkCounts(job, chunk, 0));
+            break;
+        case VL_SORT_RADIX_PHASE_COUNT:
+            vl_SortRadixCountDigit(job->key, job->src, begin, end, job->digit,
+                                   vl_SortRadixChunkCounts(job, chunk, job->digit));
+            break;
+        case VL_SORT_RADIX_PHASE_SCATTER:
+            vl_SortRadixScatter(job->key, job->src, job->dst, begin, end, job->digit,
+                                vl_SortRadixChunkCounts(job, chunk, job->digit));
+            break;
+        case VL_SORT_RADIX_PHASE_COPY:
+            memcpy(job->buffer + (vl_memsize_t)begin * size, job->src + (vl_memsize_t)begin * size,
+                   (vl_memsize_t)(end - begin) * size);
+            break;
+        case VL_SORT_RADIX_PHASE_DECODE:
+            vl_SortRadixDecodeRange(job->key, job->buffer, begin, end);
+            break;
+    }
+}
+
+VL_API vl_bool_t vlSortRadixParallel(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                     vl_dsidx_t numElements, vl_numtype keyType, vl_memsize_t keyOffset)
+{
+    vl_sort_radix_key key;
+    if (!vl_SortRadixKeyInit(&key, elementSize, keyType, keyOffset))
+        return VL_FALSE;
+
+    vl_uint_t chunks = pool == NULL ? 1 : pool->workerCapacity + 1;
+    if (numElements / VL_SORT_RADIX_CHUNK_MIN < chunks)
+        chunks = (vl_uint_t)(numElements / VL_SORT_RADIX_CHUNK_MIN);
+
+    if (chunks < 2)
+        return vlSortRadix(buffer, elementSize, numElements, keyType, keyOffset);
+
+    const vl_memsize_t histogramBytes = sizeof(vl_memsize_t) * key.buckets * key.digits * chunks;
+    vl_usmall_t* const scratch = (vl_usmall_t*)vlMemAlloc(histogramBytes + elementSize * numElements);
+    if (scratch == NULL)
+        return VL_FALSE;
+
+    vl_sort_radix_job job;
+    job.key = &key;
+    job.buffer = buffer;
+    job.src = buffer;
+    job.dst = scratch + histogramBytes;
+    job.numElements = numElements;
+    job.chunkLength = (numElements + chunks - 1) / chunks;
+    job.counts = (vl_memsize_t*)scratch;
+    job.digit = 0;
+
+    // Rounding the chunk length up can leave the last chunks empty.
+    chunks = (vl_uint_t)((numElements + job.chunkLength - 1) / job.chunkLength);
+
+    job.phase = VL_SORT_RADIX_PHASE_ENCODE;
+    vlThreadPoolParallelFor(pool, chunks, vl_SortRadixChunk, &job);
+
+    // The key multiset never changes, so the first pass's totals decide which digits can be skipped.
+    vl_bool_t trivial[VL_SORT_RADIX_MAX_DIGITS];
+    for (vl_uint_t digit = 0; digit < key.digits; digit++)
+    {
+        trivial[digit] = VL_FALSE;
+        for (vl_uint_t bucket = 0; bucket < key.buckets; bucket++)
+        {
+            vl_memsize_t total = 0;
+            for (vl_uint_t chunk = 0; chunk < chunks; chunk++)
+                total += vl_SortRadixChunkCounts(&job, chunk, digit)[bucket];
+
+            if (total != 0)
+            {
+                trivial[digit] = total == numElements;
+                break;
+            }
+        }
+    }
+
+    vl_bool_t countsFresh = VL_TRUE;
+    for (vl_uint_t digit = 0; digit < key.digits; digit++)
+    {
+        if (trivial[digit])
+            continue;
+
+        job.digit = digit;
+
+        // Each scatter reorders chunk contents, invalidating per-chunk counts gathered before it.
+        if (!countsFresh)
+        {
+            job.phase = VL_SORT_RADIX_PHASE_COUNT;
+            vlThreadPoolParallelFor(pool, chunks, vl_SortRadixChunk, &job);
+        }
+
+        // Chunk c's elements in bucket b land after every earlier bucket and after chunks 0..c-1 of bucket b.
+        vl_memsize_t running = 0;
+        for (vl_uint_t bucket = 0; bucket < key.buckets; bucket++)
+        {
+            for (vl_uint_t chunk = 0; chunk < chunks; chunk++)
+            {
+                vl_memsize_t* const counts = vl_SortRadixChunkCounts(&job, chunk, digit);
+                const vl_memsize_t count = counts[bucket];
+                counts[bucket] = running;
+                running += count;
+            }
+        }
+
+        job.phase = VL_SORT_RADIX_PHASE_SCATTER;
+        vlThreadPoolParallelFor(pool, chunks, vl_SortRadixChunk, &job);
+
+        vl_usmall_t* const swap = job.src;
+        job.src = job.dst;
+        job.dst = swap;
+        countsFresh = VL_FALSE;
+    }
+
+    if (job.src != job.buffer)
+    {
+        job.phase = VL_SORT_RADIX_PHASE_COPY;
+        vlThreadPoolParallelFor(pool, chunks, vl_SortRadixChunk, &job);
+    }
+
+    job.phase = VL_SORT_RADIX_PHASE_DECODE;
+    vlThreadPoolParallelFor(pool, chunks, vl_SortRadixChunk, &job);
+
+    vlMemFree((vl_memory*)scratch);
+    return VL_TRUE;
+}
+
+/**
+ * \brief Runs shorter than this are sorted by insertion before merging begins.
+ * \private
+ */
+#define VL_SORT_MERGE_RUN 16
+
+/**
+ * \brief Smallest run handed to a single thread by the parallel comparator sorts.
+ * \private
+ */
+#define VL_SORT_PARALLEL_RUN_MIN 16384
+
+/**
+ * \brief Merge slices per pool thread in each merge round; extra slices smooth out uneven threads.
+ * \private
+ */
+#define VL_SORT_PARALLEL_SLICES 4
+
+/**
+ * \brief Copies one element, with fixed-width paths for 4, 8 and 16-byte types.
+ * \private
+ */
+static inline void vl_SortCopy(vl_usmall_t* dst, const vl_usmall_t* src, vl_memsize_t size)
+{
+    switch (size)
+    {
+        case 4:
+            memcpy(dst, src, 4);
+            return;
+        case 8:
+            memcpy(dst, src, 8);
+            return;
+        case 16:
+            memcpy(dst, src, 16);
+            return;
+        default:
+            memcpy(dst, src, size);
+            return;
+    }
+}
+
+/**
+ * \brief Swaps two elements in chunks that fit on the stack.
+ * \private
+ */
+static inline void vl_SortSwap(vl_usmall_t* a, vl_usmall_t* b, vl_memsize_t size)
+{
+    vl_usmall_t temp[64];
+    while (size > 0)
+    {
+        const vl_memsize_t step = size < sizeof(temp) ? size : sizeof(temp);
+        vl_SortCopy(temp, a, step);
+        vl_SortCopy(a, b, step);
+        vl_SortCopy(b, temp, step);
+        a += step;
+        b += step;
+        size -= step;
+    }
+}
+
+/**
+ * \brief Stable insertion sort by adjacent swaps; only used on runs of VL_SORT_MERGE_RUN elements.
+ * \private
+ */
+static void vl_SortInsertionStable(vl_usmall_t* base, vl_memsize_t count, vl_memsize_t size,
+                                   vl_compare_function compare)
+{
+    for (vl_memsize_t i = 1; i < count; i++)
+    {
+        for (vl_usmall_t* cur = base + i * size; cur > base && compare(cur, cur - size) < 0; cur -= size)
+            vl_SortSwap(cur, cur - size, size);
+    }
+}
+
+/**
+ * \brief Merges two sorted runs into `out`, taking from `a` on ties.
+ * \private
+ */
+static void vl_SortMerge(const vl_usmall_t* a, vl_memsize_t countA, const vl_usmall_t* b, vl_memsize_t countB,
+                         vl_usmall_t* out, vl_memsize_t size, vl_compare_function compare)
+{
+    while (countA > 0 && countB > 0)
+    {
+        if (compare(b, a) < 0)
+        {
+            vl_SortCopy(out, b, size);
+            b += size;
+            countB--;
+        }
+        else
+        {
+            vl_SortCopy(out, a, size);
+            a += size;
+            countA--;
+        }
+        out += size;
+    }
+
+    memcpy(out, a, countA * size);
+    memcpy(out + countA * size, b, countB * size);
+}
+
+/**
+ * \brief Stable bottom-up merge sort of `count` elements, using `scratch` of the same size.
+ * \private
+ */
+static void vl_SortMergeStable(vl_usmall_t* base, vl_usmall_t* scratch, vl_memsize_t count, vl_memsize_t size,
+                               vl_compare_function compare)
+{
+    for (vl_memsize_t lo = 0; lo < count; lo += VL_SORT_MERGE_RUN)
+    {
+        const vl_memsize_t run = count - lo < VL_SORT_MERGE_RUN ? count - lo : VL_SORT_MERGE_RUN;
+        vl_SortInsertionStable(base + lo * size, run, size, compare);
+    }
+
+    vl_usmall_t* src = base;
+    vl_usmall_t* dst = scratch;
+
+    for (vl_memsize_t width = VL_SORT_MERGE_RUN; width < count; width *= 2)
+    {
+        for (vl_memsize_t lo = 0; lo < count; lo += 2 * width)
+        {
+            const vl_memsize_t mid = count - lo < width ? count : lo + width;
+            const vl_memsize_t hi = count - mid < width ? count : mid + width;
+            vl_SortMerge(src + lo * size, mid - lo, src + mid * size, hi - mid, dst + lo * size, size, compare);
+        }
+
+        vl_usmall_t* const swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != base)
+        memcpy(base, src, count * size);
+}
+
+/**
+ * \brief Returns how many of the first `k` merged elements come from `a`.
+ *
+ * Binary search over the merge path, consistent with vl_SortMerge's tie rule:
+ * the split is valid when `a[i-1] <= b[j]` and `b[j-1] < a[i]`, for `j = k - i`.
+ * \private
+ */
+static vl_memsize_t vl_SortMergeSplit(const vl_usmall_t* a, vl_memsize_t countA, const vl_usmall_t* b,
+                                      vl_memsize_t countB, vl_memsize_t k, vl_memsize_t size,
+                                      vl_compare_function compare)
+{
+    vl_memsize_t lo = k > countB ? k - countB : 0;
+    vl_memsize_t hi = k < countA ? k : countA;
+
+    while (lo < hi)
+    {
+        const vl_memsize_t i = lo + (hi - lo) / 2;
+        const vl_memsize_t j = k - i;
+
+        // a[i] ties or beats b[j-1], so it belongs in the first k as well.
+        if (j > 0 && i < countA && compare(b + (j - 1) * size, a + i * size) >= 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+
+    return lo;
+}
+
+/**
+ * \brief One independent slice of a merge round: output positions `[outBegin, outEnd)` of merging runs A and B.
+ * \private
+ */
+typedef struct
+{
+    vl_memsize_t runA; // First element of run A; the merged output starts here too.
+    vl_memsize_t countA;
+    vl_memsize_t countB; // Run B starts right after run A.
+    vl_memsize_t outBegin; // Relative to runA.
+    vl_memsize_t outEnd;
+} vl_sort_merge_slice;
+
+/**
+ * \brief Shared state of a parallel comparator sort.
+ * \private
+ */
+typedef struct
+{
+    vl_memsize_t size;
+    vl_compare_function compare;
+    vl_bool_t stable;
+
+    vl_usmall_t* src;
+    vl_usmall_t* dst;
+
+    vl_memsize_t* runBounds; // runCount + 1 element offsets
+    vl_uint_t runCount;
+
+    vl_sort_merge_slice* slices;
+} vl_sort_parallel_job;
+
+/**
+ * \brief Sorts one initial run in place.
+ * \private
+ */
+static void vl_SortParallelRun(void* user, vl_uint_t run)
+{
+    vl_sort_parallel_job* job = user;
+    const vl_memsize_t begin = job->runBounds[run];
+    const vl_memsize_t count = job->runBounds[run + 1] - begin;
+
+    if (job->stable)
+        vl_SortMergeStable(job->src + begin * job->size, job->dst + begin * job->size, count, job->size,
+                           job->compare);
+    else
+        vlMemSort(job->src + begin * job->size, job->size, (vl_dsidx_t)count, job->compare);
+}
+
+/**
+ * \brief Produces one slice of a merge round.
+ * \private
+ */
+static void vl_SortParallelMergeSlice(void* user, vl_uint_t index)
+{
+    vl_sort_parallel_job* job = user;
+    const vl_sort_merge_slice* slice = &job->slices[index];
+    const vl_memsize_t size = job->size;
+
+    const vl_usmall_t* a = job->src + slice->runA * size;
+    const vl_usmall_t* b = a + slice->countA * size;
+
+    const vl_memsize_t aBegin =
+        vl_SortMergeSplit(a, slice->countA, b, slice->countB, slice->outBegin, size, job->compare);
+    const vl_memsize_t aEnd = vl_SortMergeSplit(a, slice->countA, b, slice->countB, slice->outEnd, size, job->compare);
+    const vl_memsize_t bBegin = slice->outBegin - aBegin;
+    const vl_memsize_t bEnd = slice->outEnd - aEnd;
+
+    vl_SortMerge(a + aBegin * size, aEnd - aBegin, b + bBegin * size, bEnd - bBegin,
+                 job->dst + (slice->runA + slice->outBegin) * size, size, job->compare);
+}
+
+/**
+ * \brief Shared implementation of vlMemSortParallel and vlMemSortParallelStable.
+ * \private
+ */
+static vl_bool_t vl_SortParallel(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                 vl_dsidx_t numElements, vl_compare_function comparator, vl_bool_t stable)
+{
+    const vl_uint_t threads = pool == NULL ? 1 : pool->workerCapacity + 1;
+    vl_uint_t runs = threads;
+    if (numElements / VL_SORT_PARALLEL_RUN_MIN < runs)
+        runs = (vl_uint_t)(numElements / VL_SORT_PARALLEL_RUN_MIN);
+
+    if (runs < 2 && !stable)
+    {
+        vlMemSort(buffer, elementSize, numElements, comparator);
+        return VL_TRUE;
+    }
+
+    if (numElements < 2)
+        return VL_TRUE;
+
+    vl_usmall_t* const scratch = (vl_usmall_t*)vlMemAlloc(elementSize * numElements);
+    if (scratch == NULL)
+        return VL_FALSE;
+
+    if (runs < 2)
+    {
+        vl_SortMergeStable(buffer, scratch, numElements, elementSize, comparator);
+        vlMemFree((vl_memory*)scratch);
+        return VL_TRUE;
+    }
+
+    // Every round has at most one slice per VL_SORT_PARALLEL_SLICES share of the data, plus one per pair.
+    const vl_uint_t sliceTarget = threads * VL_SORT_PARALLEL_SLICES;
+    vl_memory* const tables =
+        vlMemAlloc(sizeof(vl_memsize_t) * (runs + 1) + sizeof(vl_sort_merge_slice) * (sliceTarget + runs));
+    if (tables == NULL)
+    {
+        vlMemFree((vl_memory*)scratch);
+        return VL_FALSE;
+    }
+
+    vl_sort_parallel_job job;
+    job.size = elementSize;
+    job.compare = comparator;
+    job.stable = stable;
+    job.src = buffer;
+    job.dst = scratch;
+    job.runBounds = (vl_memsize_t*)tables;
+    job.runCount = runs;
+    job.slices = (vl_sort_merge_slice*)(job.runBounds + runs + 1);
+
+    for (vl_uint_t run = 0; run <= runs; run++)
+        job.runBounds[run] = (vl_memsize_t)numElements * run / runs;
+
+    vlThreadPoolParallelFor(pool, runs, vl_SortParallelRun, &job);
+
+    while (job.runCount > 1)
+    {
+        vl_uint_t sliceCount = 0;
+        vl_uint_t merged = 0;
+
+        for (vl_uint_t run = 0; run < job.runCount; run += 2)
+        {
+            const vl_memsize_t begin = job.runBounds[run];
+            const vl_memsize_t mid = job.runBounds[run + 1];
+            const vl_memsize_t end = run + 2 <= job.runCount ? job.runBounds[run + 2] : mid;
+            const vl_memsize_t length = end - begin;
+
+            // Pieces proportional to the pair's share of the data; an unpaired run is copied as one piece.
+            vl_memsize_t pieces = (length * sliceTarget + numElements - 1) / numElements;
+            if (pieces == 0)
+                pieces = 1;
+
+            for (vl_memsize_t piece = 0; piece < pieces; piece++)
+            {
+                vl_sort_merge_slice* slice = &job.slices[sliceCount++];
+                slice->runA = begin;
+                slice->countA = mid - begin;
+                slice->countB = end - mid;
+                slice->outBegin = length * piece / pieces;
+                slice->outEnd = length * (piece + 1) / pieces;
+            }
+
+            job.runBounds[merged++] = begin;
+        }
+
+        job.runBounds[merged] = numElements;
+        job.runCount = merged;
+
+        vlThreadPoolParallelFor(pool, sliceCount, vl_SortParallelMergeSlice, &job);
+
+        vl_usmall_t* const swap = job.src;
+        job.src = job.dst;
+        job.dst = swap;
+    }
+
+    if (job.src != (vl_usmall_t*)buffer)
+        memcpy(buffer, job.src, elementSize * numElements);
+
+    vlMemFree(tables);
+    vlMemFree((vl_memory*)scratch);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlMemSortParallel(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                   vl_dsidx_t numElements, vl_compare_function comparator)
+{
+    return vl_SortParallel(pool, buffer, elementSize, numElements, comparator, VL_FALSE);
+}
+
+VL_API vl_bool_t vlMemSortParallelStable(vl_thread_pool* pool, void* buffer, vl_memsize_t elementSize,
+                                         vl_dsidx_t numElements, vl_compare_function comparator)
+{
+    return vl_SortParallel(pool, buffer, elementSize, numElements, comparator, VL_TRUE);
+}
+
+/**
+ * \brief Largest partition vlSortNumeric hands to a sorting network kernel.
+ *
+ * Bitonic networks cost O(n log^2(n)), so past this size another round of
+ * partitioning is cheaper than a larger network.
+ * \private
+ */
+#define VL_SORT_NUMERIC_LEAF 128
+
+/**
+ * \brief Maps 32-bit keys to signed integers with the same ordering, or back again.
+ *
+ * `floatMask` is 0x7FFFFFFF for floats, which flips the magnitude bits of
+ * negative values, and `flip` is 0x80000000 for unsigned integers. The mapping
+ * is its own inverse.
+ * \private
+ */
+static void vl_SortNumericEncode32(vl_uint32_t* keys, vl_dsidx_t numElements, vl_uint32_t floatMask,
+                                   vl_uint32_t flip)
+{
+    for (vl_dsidx_t i = 0; i < numElements; i++)
+    {
+        const vl_uint32_t x = keys[i];
+        keys[i] = x ^ ((0u - (x >> 31)) & floatMask) ^ flip;
+    }
+}
+
+/**
+ * \brief Heap sort fallback for partitions that exceed the recursion budget.
+ * \private
+ */
+static void vl_SortNumericHeapI32(vl_int32_t* keys, vl_dsidx_t numElements)
+{
+    for (vl_dsidx_t end = numElements, start = numElements / 2; end > 1;)
+    {
+        vl_int32_t value;
+        vl_dsidx_t hole;
+        if (start > 0)
+        {
+            hole = --start;
+            value = keys[hole];
+        }
+        else
+        {
+            value = keys[--end];
+            keys[end] = keys[0];
+            hole = 0;
+        }
+
+        for (vl_dsidx_t child = hole * 2 + 1; child < end; child = hole * 2 + 1)
+        {
+            if (child + 1 < end && keys[child] < keys[child + 1])
+                child++;
+            if (keys[child] <= value)
+                break;
+            keys[hole] = keys[child];
+            hole = child;
+        }
+        keys[hole] = value;
+    }
+}
+
+/**
+ * \brief Moves the median of the first, middle and last keys to the front and returns it.
+ *
+ * The smaller of the other two is left in the middle and the larger at the
+ * end, so a Lomuto pass never scans past the range.
+ * \private
+ */
+static inline vl_int32_t vl_SortNumericPivotI32(vl_int32_t* keys, vl_dsidx_t numElements)
+{
+    const vl_dsidx_t mid = numElements / 2, last = numElements - 1;
+    vl_int32_t lo = keys[0], pivot = keys[mid], hi = keys[last];
+    if (pivot < lo)
+    {
+        const vl_int32_t t = lo;
+        lo = pivot;
+        pivot = t;
+    }
+    if (hi < pivot)
+    {
+        const vl_int32_t t = hi;
+        hi = pivot;
+        pivot = t < lo ? lo : t;
+        lo = t < lo ? t : lo;
+    }
+    keys[0] = pivot;
+    keys[mid] = lo;
+    keys[last] = hi;
+    return pivot;
+}
+
+/**
+ * \brief Branchless Lomuto pass moving every key no greater than the pivot at `keys[0]` to the front.
+ *
+ * Used when the pivot equals the key just left of the range. Returns the
+ * length of the equal run, which is then in its final position.
+ * \private
+ */
+static inline vl_dsidx_t vl_SortNumericPartitionEqualI32(vl_int32_t* keys, vl_dsidx_t numElements, vl_int32_t pivot)
+{
+    vl_dsidx_t store = 1;
+    for (vl_dsidx_t i = 1; i < numElements; i++)
+    {
+        const vl_int32_t value = keys[i];
+        keys[i] = keys[store];
+        keys[store] = value;
+        store += value <= pivot;
+    }
+    return store;
+}
+
+/**
+ * \brief Branchless Lomuto pass around the pivot at `keys[0]`; returns one past the pivot's final index.
+ * \private
+ */
+static inline vl_dsidx_t vl_SortNumericPartitionI32(vl_int32_t* keys, vl_dsidx_t numElements, vl_int32_t pivot)
+{
+    vl_dsidx_t store = 1;
+    for (vl_dsidx_t i = 1; i < numElements; i++)
+    {
+        const vl_int32_t value = keys[i];
+        keys[i] = keys[store];
+        keys[store] = value;
+        store += value < pivot;
+    }
+    keys[0] = keys[store - 1];
+    keys[store - 1] = pivot;
+    return store;
+}
+
+/**
+ * \brief Introsort over signed 32-bit keys, finishing each small partition with a sorting network.
+ *
+ * Partitioning is a branchless Lomuto pass around a median-of-three pivot, so
+ * random keys cost no mispredictions. As in vlMemSort, a pivot equal to the
+ * key just left of the range means every key equal to it can be set aside in
+ * one pass, which keeps heavily duplicated input O(n log(n)).
+ * \private
+ */
+static void vl_SortNumericLoopI32(vl_int32_t* keys, vl_dsidx_t numElements, vl_uint_t depth, vl_bool_t leftmost)
+{
+    while (numElements > VL_SORT_NUMERIC_LEAF)
+    {
+        if (depth-- == 0)
+        {
+            vl_SortNumericHeapI32(keys, numElements);
+            return;
+        }
+
+        const vl_int32_t pivot = vl_SortNumericPivotI32(keys, numElements);
+        if (!leftmost && !(keys[-1] < pivot))
+        {
+            const vl_dsidx_t equal = vl_SortNumericPartitionEqualI32(keys, numElements, pivot);
+            keys += equal;
+            numElements -= equal;
+            continue;
+        }
+
+        const vl_dsidx_t store = vl_SortNumericPartitionI32(keys, numElements, pivot);
+
+        // Recurse into the smaller side and loop on the larger to bound stack depth.
+        const vl_dsidx_t left = store - 1, right = numElements - store;
+        if (left < right)
+        {
+            vl_SortNumericLoopI32(keys, left, depth, leftmost);
+            keys += store;
+            numElements = right;
+            leftmost = VL_FALSE;
+        }
+        else
+        {
+            vl_SortNumericLoopI32(keys + store, right, depth, VL_FALSE);
+            numElements = left;
+        }
+    }
+
+    vlSIMDFunctions.sort_i32(keys, numElements);
+}
+
+/**
+ * \brief Introselect over signed 32-bit keys: places the key that belongs at `nth`.
+ *
+ * Shares the sort's pivots and partitions but keeps only the side holding
+ * `nth`; the final small partition is sorted by a network. A partition that
+ * exhausts `depth` is heapsorted.
+ * \private
+ */
+static void vl_SortNumericSelectI32(vl_int32_t* keys, vl_dsidx_t numElements, vl_dsidx_t nth, vl_uint_t depth)
+{
+    vl_bool_t leftmost = VL_TRUE;
+
+    while (numElements > VL_SORT_NUMERIC_LEAF)
+    {
+        if (depth-- == 0)
+        {
+            vl_SortNumericHeapI32(keys, numElements);
+            return;
+        }
+
+        const vl_int32_t pivot = vl_SortNumericPivotI32(keys, numElements);
+        if (!leftmost && !(keys[-1] < pivot))
+        {
+            const vl_dsidx_t equal = vl_SortNumericPartitionEqualI32(keys, numElements, pivot);
+            if (nth < equal)
+                return;
+            keys += equal;
+            numElements -= equal;
+            nth -= equal;
+            continue;
+        }
+
+        const vl_dsidx_t store = vl_SortNumericPartitionI32(keys, numElements, pivot);
+        if (nth == store - 1)
+            return;
+
+        if (nth < store - 1)
+        {
+            numElements = store - 1;
+        }
+        else
+        {
+            keys += store;
+            numElements -= store;
+            nth -= store;
+            leftmost = VL_FALSE;
+        }
+    }
+
+    vlSIMDFunctions.sort_i32(keys, numElements);
+}
+
+#define VL_SORT_NUMERIC_COMPARE(name, type)                                                                          \
+    static vl_int_t name(const void* a, const void* b)                                                               \
+    {                                                                                                                \
+        const type x = *(const type*)a, y = *(const type*)b;                                                         \
+        return (x > y) - (x < y);                                                                                    \
+    }
+
+VL_SORT_NUMERIC_COMPARE(vl_SortNumericCompareU8, vl_uint8_t)
+VL_SORT_NUMERIC_COMPARE(vl_SortNumericCompareU16, vl_uint16_t)
+VL_SORT_NUMERIC_COMPARE(vl_SortNumericCompareU64, vl_uint64_t)
+VL_SORT_NUMERIC_COMPARE(vl_SortNumericCompareI8, vl_int8_t)
+VL_SORT_NUMERIC_COMPARE(vl_SortNumericCompareI16, vl_int16_t)
+VL_SORT_NUMERIC_COMPARE(vl_SortNumericCompareI64, vl_int64_t)
+
+/**
+ * \brief Orders doubles by bit pattern, matching the total order used for 32-bit floats.
+ * \private
+ */
+static vl_int_t vl_SortNumericCompareF64(const void* a, const void* b)
+{
+    vl_uint64_t x, y;
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+    x ^= ((vl_uint64_t)0 - (x >> 63)) & 0x7FFFFFFFFFFFFFFFull;
+    y ^= ((vl_uint64_t)0 - (y >> 63)) & 0x7FFFFFFFFFFFFFFFull;
+    const vl_int64_t sx = (vl_int64_t)x, sy = (vl_int64_t)y;
+    return (sx > sy) - (sx < sy);
+}
+
+/**
+ * \brief Recursion budget for the 32-bit introsort and introselect: 2 log2(n).
+ * \private
+ */
+static vl_uint_t vl_SortNumericDepth(vl_dsidx_t numElements)
+{
+    vl_uint_t depth = 0;
+    for (vl_dsidx_t n = numElements; n > 1; n >>= 1)
+        depth += 2;
+    return depth;
+}
+
+/**
+ * \brief Returns the built-in comparator for a key type that is not 32 bits wide, or `NULL` if there is none.
+ * \private
+ */
+static vl_compare_function vl_SortNumericComparator(const vl_numtype_info* info)
+{
+    switch (info->size)
+    {
+        case 1:
+            return info->isSigned ? vl_SortNumericCompareI8 : vl_SortNumericCompareU8;
+        case 2:
+            return info->isSigned ? vl_SortNumericCompareI16 : vl_SortNumericCompareU16;
+        case 8:
+            return info->isFloating ? vl_SortNumericCompareF64
+                : info->isSigned    ? vl_SortNumericCompareI64
+                                    : vl_SortNumericCompareU64;
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * \brief Encodes 32-bit keys of the given type in place as order-preserving signed integers, or decodes them.
+ * \private
+ */
+static void vl_SortNumericCode32(void* keys, vl_dsidx_t numElements, const vl_numtype_info* info)
+{
+    const vl_uint32_t floatMask = info->isFloating ? 0x7FFFFFFFu : 0u;
+    const vl_uint32_t flip = (info->isSigned || info->isFloating) ? 0u : 0x80000000u;
+    if (floatMask | flip)
+        vl_SortNumericEncode32((vl_uint32_t*)keys, numElements, floatMask, flip);
+}
+
+VL_API vl_bool_t vlSortNumeric(void* keys, vl_dsidx_t numElements, vl_numtype keyType)
+{
+    if ((vl_uint_t)keyType >= VL_NUMTYPE_MAX)
+        return VL_FALSE;
+
+    const vl_numtype_info* info = &VL_NUMTYPE_INFO[keyType];
+    if (numElements < 2)
+        return VL_TRUE;
+
+    if (info->size == 4)
+    {
+        if (numElements <= VL_SIMD_SORT_NETWORK_MAX)
+        {
+            if (info->isFloating)
+                vlSIMDFunctions.sort_f32((vl_float32_t*)keys, numElements);
+            else if (info->isSigned)
+                vlSIMDFunctions.sort_i32((vl_int32_t*)keys, numElements);
+            else
+                vlSIMDFunctions.sort_u32((vl_uint32_t*)keys, numElements);
+            return VL_TRUE;
+        }
+
+        vl_SortNumericCode32(keys, numElements, info);
+        vl_SortNumericLoopI32((vl_int32_t*)keys, numElements, vl_SortNumericDepth(numElements), VL_TRUE);
+        vl_SortNumericCode32(keys, numElements, info);
+        return VL_TRUE;
+    }
+
+    const vl_compare_function comparator = vl_SortNumericComparator(info);
+    if (comparator == NULL)
+        return VL_FALSE;
+
+    vlMemSort(keys, info->size, numElements, comparator);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlSortNumericSelect(void* keys, vl_dsidx_t numElements, vl_numtype keyType, vl_dsidx_t nth)
+{
+    if ((vl_uint_t)keyType >= VL_NUMTYPE_MAX || nth >= numElements)
+        return VL_FALSE;
+
+    const vl_numtype_info* info = &VL_NUMTYPE_INFO[keyType];
+    if (info->size == 4)
+    {
+        vl_SortNumericCode32(keys, numElements, info);
+        vl_SortNumericSelectI32((vl_int32_t*)keys, numElements, nth, vl_SortNumericDepth(numElements));
+        vl_SortNumericCode32(keys, numElements, info);
+        return VL_TRUE;
+    }
+
+    const vl_compare_function comparator = vl_SortNumericComparator(info);
+    if (comparator == NULL)
+        return VL_FALSE;
+
+    vlMemSelect(keys, info->size, numElements, nth, comparator);
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlSortNumericPartial(void* keys, vl_dsidx_t numElements, vl_numtype keyType, vl_dsidx_t count)
+{
+    if ((vl_uint_t)keyType >= VL_NUMTYPE_MAX)
+        return VL_FALSE;
+    if (count >= numElements)
+        return vlSortNumeric(keys, numElements, keyType);
+    if (count == 0)
+        return VL_TRUE;
+
+    const vl_numtype_info* info = &VL_NUMTYPE_INFO[keyType];
+    if (info->size == 4)
+    {
+        const vl_uint_t depth = vl_SortNumericDepth(numElements);
+        vl_SortNumericCode32(keys, numElements, info);
+        vl_SortNumericSelectI32((vl_int32_t*)keys, numElements, count - 1, depth);
+        vl_SortNumericLoopI32((vl_int32_t*)keys, count - 1, depth, VL_TRUE);
+        vl_SortNumericCode32(keys, numElements, info);
+        return VL_TRUE;
+    }
+
+    const vl_compare_function comparator = vl_SortNumericComparator(info);
+    if (comparator == NULL)
+        return VL_FALSE;
+
+    vlMemPartialSort(keys, info->size, numElements, count, comparator);
+    return VL_TRUE;
+}
+
+/**
+ * \brief Address of the heap slot at `index`.
+ * \private
+ */
+static inline vl_usmall_t* vl_TopKSlot(vl_topk* topk, vl_dsidx_t index)
+{
+    return (vl_usmall_t*)topk->elements + (vl_memsize_t)index * topk->elementSize;
+}
+
+/**
+ * \brief Restores the heap property below `index`, where the heap keeps the element that orders last at the root.
+ * \private
+ */
+static void vl_TopKSiftDown(vl_topk* topk, vl_dsidx_t index)
+{
+    const vl_memsize_t size = topk->elementSize;
+    for (;;)
+    {
+        vl_dsidx_t child = 2 * index + 1;
+        if (child >= topk->count)
+            return;
+        if (child + 1 < topk->count && topk->comparator(vl_TopKSlot(topk, child), vl_TopKSlot(topk, child + 1)) < 0)
+            child++;
+        if (topk->comparator(vl_TopKSlot(topk, index), vl_TopKSlot(topk, child)) >= 0)
+            return;
+        vl_SortSwap(vl_TopKSlot(topk, index), vl_TopKSlot(topk, child), size);
+        index = child;
+    }
+}
+
+/**
+ * \brief Moves the element at `index` up until its parent orders no earlier than it.
+ * \private
+ */
+static void vl_TopKSiftUp(vl_topk* topk, vl_dsidx_t index)
+{
+    while (index > 0)
+    {
+        const vl_dsidx_t parent = (index - 1) / 2;
+        if (topk->comparator(vl_TopKSlot(topk, parent), vl_TopKSlot(topk, index)) >= 0)
+            return;
+        vl_SortSwap(vl_TopKSlot(topk, parent), vl_TopKSlot(topk, index), topk->elementSize);
+        index = parent;
+    }
+}
+
+VL_API void vlTopKInit(vl_topk* topk, vl_memsize_t elementSize, vl_dsidx_t k, vl_compare_function comparator)
+{
+    topk->elementSize = elementSize;
+    topk->capacity = k;
+    topk->count = 0;
+    topk->comparator = comparator;
+    topk->elements = k > 0 ? vlMemAlloc(elementSize * k) : NULL;
+    if (topk->elements == NULL)
+        topk->capacity = 0;
+}
+
+VL_API void vlTopKFree(vl_topk* topk)
+{
+    if (topk->elements != NULL)
+        vlMemFree(topk->elements);
+    topk->elements = NULL;
+    topk->capacity = 0;
+    topk->count = 0;
+}
+
+VL_API vl_topk* vlTopKNew(vl_memsize_t elementSize, vl_dsidx_t k, vl_compare_function comparator)
+{
+    vl_topk* topk = (vl_topk*)vlMemAlloc(sizeof(vl_topk));
+    if (topk == NULL)
+        return NULL;
+    vlTopKInit(topk, elementSize, k, comparator);
+    return topk;
+}
+
+VL_API void vlTopKDelete(vl_topk* topk)
+{
+    if (topk == NULL)
+        return;
+    vlTopKFree(topk);
+    vlMemFree((vl_memory*)topk);
+}
+
+VL_API void vlTopKClear(vl_topk* topk) { topk->count = 0; }
+
+VL_API vl_bool_t vlTopKPush(vl_topk* topk, const void* element)
+{
+    if (topk->count < topk->capacity)
+    {
+        vl_SortCopy(vl_TopKSlot(topk, topk->count), (const vl_usmall_t*)element, topk->elementSize);
+        vl_TopKSiftUp(topk, topk->count++);
+        return VL_TRUE;
+    }
+
+    // Full: the element must order before the current worst to displace it.
+    if (topk->capacity == 0 || topk->comparator(element, topk->elements) >= 0)
+        return VL_FALSE;
+
+    vl_SortCopy(topk->elements, (const vl_usmall_t*)element, topk->elementSize);
+    vl_TopKSiftDown(topk, 0);
+    return VL_TRUE;
+}
+
+VL_API void vlTopKPushArray(vl_topk* topk, const void* buffer, vl_dsidx_t numElements)
+{
+    const vl_usmall_t* element = (const vl_usmall_t*)buffer;
+    for (vl_dsidx_t i = 0; i < numElements; i++, element += topk->elementSize)
+        vlTopKPush(topk, element);
+}
+
+VL_API vl_dsidx_t vlTopKSort(const vl_topk* topk, void* dest)
+{
+    if (topk->count == 0)
+        return 0;
+    memcpy(dest, topk->elements, topk->elementSize * topk->count);
+    vlMemSort(dest, topk->elementSize, topk->count, topk->comparator);
+    return topk->count;
+}
@@ -3,15 +3,353 @@
 #include "vl_condition.h"
 #include "vl_memory.h"
 
+#include <string.h>
+
+/**
+ * \brief Live histogram written by a single worker.
+ *
+ * Each field is atomic so snapshots taken from other threads are well-defined,
+ * but only the owning worker ever writes, so updates are plain relaxed
+ * load/store pairs rather than read-modify-write operations.
+ * \private
+ */
+typedef struct
+{
+    VL_ATOMIC vl_ularge_t count;
+    VL_ATOMIC vl_ularge_t sum;
+    VL_ATOMIC vl_ularge_t min;
+    VL_ATOMIC vl_ularge_t max;
+    VL_ATOMIC vl_ularge_t buckets[VL_THREAD_POOL_HISTOGRAM_BUCKETS];
+} vl_thread_pool_histogram_live;
+
+/**
+ * \brief A task as stored in the work queues.
+ *
+ * `enqueuedAt` is zero unless instrumentation was enabled at enqueue time.
+ * \private
+ */
+typedef struct
+{
+    vl_thread_pool_task task;
+    vl_ularge_t enqueuedAt;
+} vl_thread_pool_entry;
+
+/**
+ * \brief Lifecycle of a worker slot.
+ * \private
+ */
+typedef enum
+{
+    VL_THREAD_POOL_SLOT_EMPTY = 0, /* Never used, or joined and reclaimed */
+    VL_THREAD_POOL_SLOT_LIVE = 1, /* Worker thread running */
+    VL_THREAD_POOL_SLOT_RETIRED = 2 /* Worker exited on keepalive; awaiting join */
+} vl_thread_pool_slot_status;
+
+/**
+ * \brief Per-worker state. Everything below `status` is written exclusively by
+ * the owning worker.
+ * \private
+ */
+struct vl_thread_pool_worker_
+{
+    vl_thread_pool* pool;
+    vl_thread thread;
+    VL_ATOMIC vl_uint_t status;
+
+    VL_ATOMIC vl_ularge_t tasksExecuted[VL_THREAD_POOL_PRIORITY_COUNT];
+    VL_ATOMIC vl_ularge_t tasksPromoted[VL_THREAD_POOL_PRIORITY_COUNT];
+    VL_ATOMIC vl_ularge_t steals;
+    VL_ATOMIC vl_ularge_t idles;
+    VL_ATOMIC vl_ularge_t parks;
+    VL_ATOMIC vl_ularge_t busyNanos;
+
+    vl_thread_pool_histogram_live waitHistograms[VL_THREAD_POOL_PRIORITY_COUNT];
+    vl_thread_pool_histogram_live execHistograms[VL_THREAD_POOL_PRIORITY_COUNT];
+
+    /* Weighted round-robin: tasks this worker may still take from each tier this cycle */
+    vl_uint_t credits[VL_THREAD_POOL_PRIORITY_COUNT];
+};
+
+/**
+ * \brief Adds to a counter that only the calling thread writes.
+ * \private
+ */
+static inline void vl_ThreadPoolCounterAdd(VL_ATOMIC vl_ularge_t* counter, vl_ularge_t amount)
+{
+    const vl_ularge_t current = vlAtomicLoadExplicit(counter, VL_MEMORY_ORDER_RELAXED);
+    vlAtomicStoreExplicit(counter, current + amount, VL_MEMORY_ORDER_RELAXED);
+}
+
+/**
+ * \brief Reads a counter for a snapshot.
+ * \private
+ */
+static inline vl_ularge_t vl_ThreadPoolCounterRead(VL_ATOMIC vl_ularge_t* counter)
+{
+    return vlAtomicLoadExplicit(counter, VL_MEMORY_ORDER_RELAXED);
+}
+
+/**
+ * \brief Index of the most significant set bit. Value must be non-zero.
+ * \private
+ */
+static inline vl_uint_t vl_ThreadPoolLog2(vl_ularge_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (vl_uint_t)(63 - __builtin_clzll((unsigned long long)value));
+#else
+    vl_uint_t result = 0;
+    while (value >>= 1)
+    {
+        result++;
+    }
+    return result;
+#endif
+}
+
+/**
+ * \brief Records a sample into a live histogram owned by the calling thread.
+ * \private
+ */
+static void vl_ThreadPoolHistogramRecord(vl_thread_pool_histogram_live* hist, vl_ularge_t value)
+{
+    const vl_ularge_t count = vl_ThreadPoolCounterRead(&hist->count);
+    if (count == 0 || value < vl_ThreadPoolCounterRead(&hist->min))
+    {
+        vlAtomicStoreExplicit(&hist->min, value, VL_MEMORY_ORDER_RELAXED);
+    }
+    if (value > vl_ThreadPoolCounterRead(&hist->max))
+    {
+        vlAtomicStoreExplicit(&hist->max, value, VL_MEMORY_ORDER_RELAXED);
+    }
+
+    vl_ThreadPoolCounterAdd(&hist->buckets[vlThreadPoolHistogramBucketIndex(value)], 1);
+    vl_ThreadPoolCounterAdd(&hist->sum, value);
+    vlAtomicStoreExplicit(&hist->count, count + 1, VL_MEMORY_ORDER_RELAXED);
+}
+
+/**
+ * \brief Accumulates a live histogram into a snapshot.
+ * \private
+ */
+static void vl_ThreadPoolHistogramCollect(vl_thread_pool_histogram* dest, vl_thread_pool_histogram_live* src)
+{
+    vl_thread_pool_histogram snapshot;
+    snapshot.count = vl_ThreadPoolCounterRead(&src->count);
+    snapshot.sum = vl_ThreadPoolCounterRead(&src->sum);
+    snapshot.min = vl_ThreadPoolCounterRead(&src->min);
+    snapshot.max = vl_ThreadPoolCounterRead(&src->max);
+
+    for (vl_uint_t i = 0; i < VL_THREAD_POOL_HISTOGRAM_BUCKETS; i++)
+    {
+        snapshot.buckets[i] = vl_ThreadPoolCounterRead(&src->buckets[i]);
+    }
+
+    vlThreadPoolHistogramMerge(dest, &snapshot);
+}
+
+/**
+ * \brief Initializes every counter of a worker slot to zero.
+ * \private
+ */
+static void vl_ThreadPoolWorkerInit(vl_thread_pool_worker* worker, vl_thread_pool* pool)
+{
+    worker->pool = pool;
+    worker->thread = VL_THREAD_NULL;
+    vlAtomicInit(&worker->status, VL_THREAD_POOL_SLOT_EMPTY);
+
+    vlAtomicInit(&worker->steals, 0);
+    vlAtomicInit(&worker->idles, 0);
+    vlAtomicInit(&worker->parks, 0);
+    vlAtomicInit(&worker->busyNanos, 0);
+
+    for (vl_int_t pri = 0; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+    {
+        vlAtomicInit(&worker->tasksExecuted[pri], 0);
+        vlAtomicInit(&worker->tasksPromoted[pri], 0);
+        worker->credits[pri] = 0;
+
+        vl_thread_pool_histogram_live* hists[2] = {&worker->waitHistograms[pri], &worker->execHistograms[pri]};
+        for (vl_int_t h = 0; h < 2; h++)
+        {
+            vlAtomicInit(&hists[h]->count, 0);
+            vlAtomicInit(&hists[h]->sum, 0);
+            vlAtomicInit(&hists[h]->min, 0);
+            vlAtomicInit(&hists[h]->max, 0);
+            for (vl_uint_t i = 0; i < VL_THREAD_POOL_HISTOGRAM_BUCKETS; i++)
+            {
+                vlAtomicInit(&hists[h]->buckets[i], 0);
+            }
+        }
+    }
+}
+
+static void vl_ThreadPoolMaybeGrow(vl_thread_pool* pool);
+
+/**
+ * \brief Raises a tier's queue-depth high-water mark to at least `depth`.
+ * \private
+ */
+static inline void vl_ThreadPoolTrackPeak(vl_thread_pool* pool, vl_int_t priority, vl_uint32_t depth)
+{
+    vl_uint32_t peak = vlAtomicLoadExplicit(&pool->queuePeak[priority], VL_MEMORY_ORDER_RELAXED);
+    while (depth > peak)
+    {
+        if (vlAtomicCompareExchangeWeak(&pool->queuePeak[priority], &peak, depth))
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * \brief Releases the slot a dequeued task held in a bounded tier, waking any
+ * producers blocked on capacity.
+ *
+ * The fetch-sub and the waiter check pair with the producer's increment of
+ * `blockedProducers` followed by its re-check under `spaceLock`, so a wakeup
+ * cannot be lost.
+ * \private
+ */
+static inline void vl_ThreadPoolReleaseSlot(vl_thread_pool* pool, vl_int_t priority)
+{
+    if (pool->queueCapacity[priority] == 0)
+    {
+        return;
+    }
+
+    vlAtomicFetchSub(&pool->queueReserved[priority], 1);
+
+    if (vlAtomicLoad(&pool->blockedProducers) > 0)
+    {
+        vlMutexObtain(pool->spaceLock);
+        vlConditionBroadcast(pool->spaceAvailable);
+        vlMutexRelease(pool->spaceLock);
+    }
+}
+
+/**
+ * \brief Attempts to retire a worker whose keepalive expired.
+ *
+ * Succeeds only while the live count stays at or above the minimum. The
+ * retired worker remains counted as idle, which is what it was when parked.
+ * \private
+ */
+static vl_bool_t vl_ThreadPoolRetire(vl_thread_pool_worker* worker)
+{
+    vl_thread_pool* pool = worker->pool;
+    vl_uint_t live = vlAtomicLoad(&pool->workerCount);
+
+    while (live > pool->minWorkers)
+    {
+        if (vlAtomicCompareExchangeWeak(&pool->workerCount, &live, live - 1))
+        {
+            vlAtomicFetchAdd(&pool->workersRetired, 1);
+            vlAtomicStore(&worker->status, VL_THREAD_POOL_SLOT_RETIRED);
+            return VL_TRUE;
+        }
+    }
+
+    return VL_FALSE;
+}
+
+/**
+ * \brief Pops the next task according to the pool's scheduling policy.
+ *
+ * Returns the tier the task came from, or -1 if every tier is empty.
+ * \private
+ */
+static vl_int_t vl_ThreadPoolPop(vl_thread_pool* pool, vl_thread_pool_worker* worker, vl_thread_pool_entry* entry)
+{
+    switch (pool->schedulePolicy)
+    {
+        case VL_THREAD_POOL_SCHEDULE_WEIGHTED:
+            /* A second pass after refilling keeps the policy work-conserving. */
+            for (vl_int_t pass = 0; pass < 2; pass++)
+            {
+                for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_HIGH; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+                {
+                    if (worker->credits[pri] > 0 && vlAsyncQueuePopFront(pool->workQueues[pri], entry))
+                    {
+                        worker->credits[pri]--;
+                        return pri;
+                    }
+                }
+
+                for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_HIGH; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+                {
+                    worker->credits[pri] = pool->tierWeights[pri];
+                }
+            }
+            return -1;
+
+        case VL_THREAD_POOL_SCHEDULE_AGING:
+        {
+            const vl_ularge_t now = vlThreadMonotonicNano();
+
+            /* The lowest overdue tier has been starved the longest relative to its threshold. */
+            for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_COUNT - 1; pri > VL_THREAD_POOL_PRIORITY_HIGH; pri--)
+            {
+                const vl_ularge_t threshold = pool->agingNanos[pri];
+                if (threshold == 0 || vlAsyncQueueSize(pool->workQueues[pri]) == 0)
+                {
+                    continue;
+                }
+
+                const vl_ularge_t servedAt = vlAtomicLoadExplicit(&pool->tierServedAt[pri], VL_MEMORY_ORDER_RELAXED);
+                /* `now` predates the loop, so a concurrent pop may already have stamped a later time. */
+                if (now > servedAt && now - servedAt >= threshold &&
+                    vlAsyncQueuePopFront(pool->workQueues[pri], entry))
+                {
+                    vlAtomicStoreExplicit(&pool->tierServedAt[pri], now, VL_MEMORY_ORDER_RELAXED);
+                    vl_ThreadPoolCounterAdd(&worker->tasksPromoted[pri], 1);
+                    return pri;
+                }
+            }
+
+            for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_HIGH; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+            {
+                if (vlAsyncQueuePopFront(pool->workQueues[pri], entry))
+                {
+                    vlAtomicStoreExplicit(&pool->tierServedAt[pri], now, VL_MEMORY_ORDER_RELAXED);
+                    if (pri != VL_THREAD_POOL_PRIORITY_HIGH)
+                    {
+                        vl_ThreadPoolCounterAdd(&worker->steals, 1);
+                    }
+                    return pri;
+                }
+            }
+            return -1;
+        }
+
+        default:
+            /* Work-stealing loop: HIGH → MEDIUM → LOW */
+            for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_HIGH; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+            {
+                if (vlAsyncQueuePopFront(pool->workQueues[pri], entry))
+                {
+                    if (pri != VL_THREAD_POOL_PRIORITY_HIGH)
+                    {
+                        vl_ThreadPoolCounterAdd(&worker->steals, 1);
+                    }
+                    return pri;
+                }
+            }
+            return -1;
+    }
+}
+
 /**
  * \brief Main worker thread loop with work-stealing strategy.
  *
  * Strategy:
- * 1. Attempt non-blocking pop from HIGH priority queue
- * 2. If empty, attempt MEDIUM priority queue
- * 3. If empty, attempt LOW priority queue
- * 4. If all empty and RUNNING, mark idle and block on semaphore
- * 5. On wakeup or work found, execute and repeat
+ * 1. Attempt a non-blocking pop according to the scheduling policy; by
+ *    default HIGH, then MEDIUM, then LOW
+ * 2. If all empty and RUNNING, mark idle and park on the work semaphore
+ * 3. On wakeup or work found, execute and repeat
+ *
+ * Workers above the pool minimum park with a keepalive timeout and exit if it
+ * expires without work arriving.
  *
  * On shutdown (SHUTTING_DOWN state):
  * - Continue processing remaining work in all tiers
@@ -19,29 +357,40 @@
  */
 static void vl_thread_pool_worker_proc(void* user_arg)
 {
-    vl_thread_pool* pool = (vl_thread_pool*)user_arg;
-    vl_thread_pool_task task;
+    vl_thread_pool_worker* worker = (vl_thread_pool_worker*)user_arg;
+    vl_thread_pool* pool = worker->pool;
+    vl_thread_pool_entry entry;
     vl_thread_pool_state state;
 
     while (VL_TRUE)
     {
-        /* Work-stealing loop: HIGH → MEDIUM → LOW */
-        vl_bool_t found_work = VL_FALSE;
+        const vl_int_t found_pri = vl_ThreadPoolPop(pool, worker, &entry);
 
-        for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_HIGH; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+        if (found_pri >= 0)
         {
-            if (vlAsyncQueuePopFront(pool->workQueues[pri], &task))
+            vl_ThreadPoolReleaseSlot(pool, found_pri);
+
+            /* Execute work and update statistics */
+            if (entry.enqueuedAt != 0)
             {
-                found_work = VL_TRUE;
-                break;
+                const vl_ularge_t start = vlThreadMonotonicNano();
+                entry.task.proc(entry.task.user_data);
+                const vl_ularge_t end = vlThreadMonotonicNano();
+
+                vl_ThreadPoolHistogramRecord(&worker->waitHistograms[found_pri], start - entry.enqueuedAt);
+                vl_ThreadPoolHistogramRecord(&worker->execHistograms[found_pri], end - start);
+                vl_ThreadPoolCounterAdd(&worker->busyNanos, end - start);
+            }
+            else
+            {
+                entry.task.proc(entry.task.user_data);
             }
-        }
 
-        if (found_work)
-        {
-            /* Execute work and update statistics */
-            task.proc(task.user_data);
+            vl_ThreadPoolCounterAdd(&worker->tasksExecuted[found_pri], 1);
             vlAtomicFetchAdd(&pool->tasksCompleted, 1);
+
+            /* A backlog enqueued in one burst must still scale once the delay elapses */
+            vl_ThreadPoolMaybeGrow(pool);
             continue;
         }
 
@@ -54,6 +403,7 @@ static void vl_thread_pool_worker_proc(void* user_arg)
         }
 
         /* Mark worker as idle */
+        vl_ThreadPoolCounterAdd(&worker->idles, 1);
         vlAtomicFetchSub(&pool->active_workers, 1);
 
         /* Signal all waiters if all workers are now idle */
@@ -64,26 +414,290 @@ static void vl_thread_pool_worker_proc(void* user_arg)
         }
         vlMutexRelease(pool->idle_lock);
 
-        /* Try non-blocking wait on each semaphore in order of priority */
-        vl_bool_t got_signal = VL_FALSE;
-        for (vl_int_t pri = VL_THREAD_POOL_PRIORITY_HIGH; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
-        {
-            if (vlSemaphoreTryWait(pool->semaphores[pri]))
-            {
-                got_signal = VL_TRUE;
-                break;
-            }
-        }
+        /* Consume a pending signal if one exists, otherwise park until work arrives */
+        if (!vlSemaphoreTryWait(pool->workAvailable))
+        {
+            vl_ThreadPoolCounterAdd(&worker->parks, 1);
+
+            if (pool->keepaliveMs > 0 && vlAtomicLoad(&pool->workerCount) > pool->minWorkers)
+            {
+                if (!vlSemaphoreWait(pool->workAvailable, pool->keepaliveMs) && vl_ThreadPoolRetire(worker))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                vlSemaphoreWait(pool->workAvailable, 0);
+            }
+        }
+
+        /* Mark worker as active again */
+        vlAtomicFetchAdd(&pool->active_workers, 1);
+    }
+}
+
+/**
+ * \brief Starts a worker in the first free slot. Requires `scaleLock`, or
+ * exclusive access during construction.
+ *
+ * A retired slot is reclaimed by joining its exited thread first.
+ * \private
+ */
+static vl_bool_t vl_ThreadPoolSpawnWorker(vl_thread_pool* pool)
+{
+    for (vl_uint_t i = 0; i < pool->workerCapacity; i++)
+    {
+        vl_thread_pool_worker* worker = &pool->workers[i];
+        const vl_uint_t status = vlAtomicLoad(&worker->status);
+
+        if (status == VL_THREAD_POOL_SLOT_LIVE)
+        {
+            continue;
+        }
+
+        if (status == VL_THREAD_POOL_SLOT_RETIRED)
+        {
+            vlThreadJoin(worker->thread);
+            vlThreadDelete(worker->thread);
+            worker->thread = VL_THREAD_NULL;
+            vlAtomicStore(&worker->status, VL_THREAD_POOL_SLOT_EMPTY);
+        }
+
+        /* Account for the worker before it runs so it can never look idle-and-uncounted. */
+        vlAtomicStore(&worker->status, VL_THREAD_POOL_SLOT_LIVE);
+        vlAtomicFetchAdd(&pool->workerCount, 1);
+        vlAtomicFetchAdd(&pool->active_workers, 1);
+
+        worker->thread = vlThreadNew(vl_thread_pool_worker_proc, (void*)worker);
+        if (worker->thread == VL_THREAD_NULL)
+        {
+            vlAtomicFetchSub(&pool->active_workers, 1);
+            vlAtomicFetchSub(&pool->workerCount, 1);
+            vlAtomicStore(&worker->status, VL_THREAD_POOL_SLOT_EMPTY);
+            return VL_FALSE;
+        }
+
+        vlAtomicFetchAdd(&pool->workersSpawned, 1);
+        return VL_TRUE;
+    }
+
+    return VL_FALSE;
+}
+
+/**
+ * \brief Scaling check, run after each enqueue and after each executed task.
+ *
+ * Cheap when it matters: fixed-size pools return immediately, and the clock is
+ * only read once every live worker is busy and a backlog exists.
+ * \private
+ */
+static void vl_ThreadPoolMaybeGrow(vl_thread_pool* pool)
+{
+    if (pool->minWorkers == pool->workerCapacity)
+    {
+        return;
+    }
+
+    const vl_uint_t live = vlAtomicLoad(&pool->workerCount);
+    if (live >= pool->workerCapacity)
+    {
+        return;
+    }
+
+    vl_uint_t backlog = 0;
+    for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
+    {
+        backlog += vlAsyncQueueSize(pool->workQueues[i]);
+    }
+
+    /* An idle worker will pick the work up; no backlog means no pressure. */
+    if (vlAtomicLoad(&pool->active_workers) < live || backlog < pool->scaleBacklog)
+    {
+        if (vlAtomicLoadExplicit(&pool->pressureSince, VL_MEMORY_ORDER_RELAXED) != 0)
+        {
+            vlAtomicStoreExplicit(&pool->pressureSince, 0, VL_MEMORY_ORDER_RELAXED);
+        }
+        return;
+    }
+
+    const vl_ularge_t now = vlThreadMonotonicNano();
+    vl_ularge_t since = vlAtomicLoadExplicit(&pool->pressureSince, VL_MEMORY_ORDER_RELAXED);
+
+    if (since == 0)
+    {
+        /* First observation of sustained pressure; start the clock. */
+        vlAtomicCompareExchangeStrong(&pool->pressureSince, &since, now);
+        if (pool->scaleDelayNanos > 0)
+        {
+            return;
+        }
+        since = now;
+    }
+
+    if (now - since < pool->scaleDelayNanos)
+    {
+        return;
+    }
+
+    /* Never block a producer on scaling; whoever holds the lock is already spawning. */
+    if (!vlMutexTryObtain(pool->scaleLock))
+    {
+        return;
+    }
+
+    if (vlAtomicLoad(&pool->state) == VL_THREAD_POOL_RUNNING && vlAtomicLoad(&pool->workerCount) < pool->workerCapacity)
+    {
+        vl_ThreadPoolSpawnWorker(pool);
+    }
+
+    /* Restart the delay so growth is limited to one worker per interval. */
+    vlAtomicStoreExplicit(&pool->pressureSince, now, VL_MEMORY_ORDER_RELAXED);
+    vlMutexRelease(pool->scaleLock);
+}
+
+/**
+ * \brief Claims a slot in a bounded tier without waiting.
+ * \private
+ */
+static vl_bool_t vl_ThreadPoolTryReserve(vl_thread_pool* pool, vl_thread_pool_priority priority)
+{
+    const vl_uint_t capacity = pool->queueCapacity[priority];
+    vl_uint32_t depth = vlAtomicLoad(&pool->queueReserved[priority]);
+
+    while (depth < capacity)
+    {
+        if (vlAtomicCompareExchangeWeak(&pool->queueReserved[priority], &depth, depth + 1))
+        {
+            vl_ThreadPoolTrackPeak(pool, priority, depth + 1);
+            return VL_TRUE;
+        }
+    }
+
+    return VL_FALSE;
+}
+
+/**
+ * \brief Claims a queue slot for one task, applying the blocking policy if the
+ * tier is full. Unbounded tiers always succeed.
+ * \private
+ */
+static vl_bool_t vl_ThreadPoolReserve(vl_thread_pool* pool, vl_thread_pool_priority priority)
+{
+    if (pool->queueCapacity[priority] == 0 || vl_ThreadPoolTryReserve(pool, priority))
+    {
+        return VL_TRUE;
+    }
+
+    if (pool->overflowPolicy != VL_THREAD_POOL_OVERFLOW_BLOCK)
+    {
+        return VL_FALSE;
+    }
+
+    const vl_ularge_t deadline = vlThreadMonotonicNano() + (vl_ularge_t)pool->blockTimeoutMs * 1000000ull;
+    vl_bool_t reserved;
+
+    vlAtomicFetchAdd(&pool->blockedProducers, 1);
+    vlMutexObtain(pool->spaceLock);
+
+    while (!(reserved = vl_ThreadPoolTryReserve(pool, priority)))
+    {
+        if (vlAtomicLoad(&pool->state) != VL_THREAD_POOL_RUNNING)
+        {
+            break;
+        }
+
+        if (pool->blockTimeoutMs == 0)
+        {
+            vlConditionWait(pool->spaceAvailable, pool->spaceLock);
+            continue;
+        }
+
+        const vl_ularge_t now = vlThreadMonotonicNano();
+        if (now >= deadline)
+        {
+            break;
+        }
+
+        /* Round up so a sub-millisecond remainder still waits. */
+        vlConditionWaitTimeout(pool->spaceAvailable, pool->spaceLock, (deadline - now + 999999ull) / 1000000ull);
+    }
+
+    vlMutexRelease(pool->spaceLock);
+    vlAtomicFetchSub(&pool->blockedProducers, 1);
+
+    return reserved;
+}
+
+/**
+ * \brief Stamps and pushes one task, then signals a worker.
+ * \private
+ */
+static inline void vl_ThreadPoolPush(vl_thread_pool* pool, vl_thread_pool_priority priority,
+                                     const vl_thread_pool_task* task, vl_ularge_t enqueuedAt)
+{
+    vl_thread_pool_entry entry;
+    entry.task = *task;
+    entry.enqueuedAt = enqueuedAt;
+
+    vlAsyncQueuePushBack(pool->workQueues[priority], (const void*)&entry);
+    vlSemaphorePost(pool->workAvailable);
+
+    const vl_uint32_t depth = vlAsyncQueueSize(pool->workQueues[priority]);
+
+    /* Bounded tiers track their peak when reserving. */
+    if (pool->queueCapacity[priority] == 0)
+    {
+        vl_ThreadPoolTrackPeak(pool, priority, depth);
+    }
+
+    /* Aging measures starvation from the moment a tier becomes non-empty, not from its last service. */
+    if (pool->schedulePolicy == VL_THREAD_POOL_SCHEDULE_AGING && depth == 1)
+    {
+        vlAtomicStoreExplicit(&pool->tierServedAt[priority], vlThreadMonotonicNano(), VL_MEMORY_ORDER_RELAXED);
+    }
+}
+
+/**
+ * \brief Admits one task: reserves a slot and queues it, or applies the
+ * overflow policy. Returns whether the task was queued or executed.
+ * \private
+ */
+static vl_bool_t vl_ThreadPoolSubmit(vl_thread_pool* pool, vl_thread_pool_priority priority,
+                                     const vl_thread_pool_task* task, vl_ularge_t enqueuedAt)
+{
+    if (vl_ThreadPoolReserve(pool, priority))
+    {
+        vl_ThreadPoolPush(pool, priority, task, enqueuedAt);
+        return VL_TRUE;
+    }
+
+    if (pool->overflowPolicy == VL_THREAD_POOL_OVERFLOW_CALLER_RUNS &&
+        vlAtomicLoad(&pool->state) == VL_THREAD_POOL_RUNNING)
+    {
+        task->proc(task->user_data);
+        vlAtomicFetchAdd(&pool->tasksCallerRan, 1);
+        return VL_TRUE;
+    }
 
-        /* If no immediate signal, block on HIGH priority semaphore */
-        if (!got_signal)
-        {
-            vlSemaphoreWait(pool->semaphores[VL_THREAD_POOL_PRIORITY_HIGH], 0);
-        }
+    vlAtomicFetchAdd(&pool->tasksRejected, 1);
+    return VL_FALSE;
+}
 
-        /* Mark worker as active again */
-        vlAtomicFetchAdd(&pool->active_workers, 1);
+/**
+ * \brief Returns the enqueue timestamp for new tasks, or 0 if not instrumenting.
+ * \private
+ */
+static inline vl_ularge_t vl_ThreadPoolEnqueueStamp(vl_thread_pool* pool)
+{
+    if (!vlAtomicLoadExplicit(&pool->instrumented, VL_MEMORY_ORDER_RELAXED))
+    {
+        return 0;
     }
+
+    /* Zero is reserved for "not instrumented". */
+    const vl_ularge_t now = vlThreadMonotonicNano();
+    return now == 0 ? 1 : now;
 }
 
 /* ============================================================================
@@ -91,13 +705,50 @@ static void vl_thread_pool_worker_proc(void* user_arg)
  * ============================================================================
  */
 
+VL_API void vlThreadPoolConfigDefault(vl_thread_pool_config* config)
+{
+    config->min_workers = 1;
+    config->max_workers = 1;
+    config->scale_up_backlog = 2;
+    config->scale_up_delay_ms = 1;
+    config->keepalive_ms = 1000;
+
+    for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
+    {
+        config->queue_capacity[i] = 0;
+    }
+
+    config->overflow_policy = VL_THREAD_POOL_OVERFLOW_BLOCK;
+    config->block_timeout_ms = 0;
+
+    config->schedule_policy = VL_THREAD_POOL_SCHEDULE_STRICT;
+    config->tier_weights[VL_THREAD_POOL_PRIORITY_HIGH] = 4;
+    config->tier_weights[VL_THREAD_POOL_PRIORITY_MEDIUM] = 2;
+    config->tier_weights[VL_THREAD_POOL_PRIORITY_LOW] = 1;
+    config->aging_threshold_ms[VL_THREAD_POOL_PRIORITY_HIGH] = 0;
+    config->aging_threshold_ms[VL_THREAD_POOL_PRIORITY_MEDIUM] = 20;
+    config->aging_threshold_ms[VL_THREAD_POOL_PRIORITY_LOW] = 100;
+}
+
 VL_API vl_thread_pool* vlThreadPoolNew(vl_uint_t worker_count)
 {
-    if (worker_count == 0)
+    vl_thread_pool_config config;
+    vlThreadPoolConfigDefault(&config);
+    config.min_workers = worker_count;
+    config.max_workers = worker_count;
+    return vlThreadPoolNewConfig(&config);
+}
+
+VL_API vl_thread_pool* vlThreadPoolNewConfig(const vl_thread_pool_config* config)
+{
+    if (config == NULL || config->min_workers == 0)
     {
         return NULL;
     }
 
+    const vl_uint_t min_workers = config->min_workers;
+    const vl_uint_t max_workers = config->max_workers > min_workers ? config->max_workers : min_workers;
+
     /* Allocate pool structure */
     vl_thread_pool* pool = vlMemAllocType(vl_thread_pool);
     if (pool == NULL)
@@ -105,10 +756,10 @@ VL_API vl_thread_pool* vlThreadPoolNew(vl_uint_t worker_count)
         return NULL;
     }
 
-    /* Initialize all queues and semaphores */
+    /* Initialize all queues */
     for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
     {
-        pool->workQueues[i] = vlAsyncQueueNew(sizeof(vl_thread_pool_task));
+        pool->workQueues[i] = vlAsyncQueueNew(sizeof(vl_thread_pool_entry));
         if (pool->workQueues[i] == NULL)
         {
             /* Cleanup on failure */
@@ -119,23 +770,18 @@ VL_API vl_thread_pool* vlThreadPoolNew(vl_uint_t worker_count)
             vlMemFree((vl_memory*)pool);
             return NULL;
         }
+    }
 
-        /* Initialize semaphore with count 0 (no work initially) */
-        pool->semaphores[i] = vlSemaphoreNew(0);
-        if (pool->semaphores[i] == NULL)
+    /* Initialize semaphore with count 0 (no work initially) */
+    pool->workAvailable = vlSemaphoreNew(0);
+    if (pool->workAvailable == NULL)
+    {
+        for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
         {
-            /* Cleanup on failure */
-            for (vl_int_t j = 0; j <= i; j++)
-            {
-                vlAsyncQueueDelete(pool->workQueues[j]);
-                if (j < i)
-                {
-                    vlSemaphoreDelete(pool->semaphores[j]);
-                }
-            }
-            vlMemFree((vl_memory*)pool);
-            return NULL;
+            vlAsyncQueueDelete(pool->workQueues[i]);
         }
+        vlMemFree((vl_memory*)pool);
+        return NULL;
     }
 
     /* Initialize synchronization primitives for waiting */
@@ -145,8 +791,8 @@ VL_API vl_thread_pool* vlThreadPoolNew(vl_uint_t worker_count)
         for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
         {
             vlAsyncQueueDelete(pool->workQueues[i]);
-            vlSemaphoreDelete(pool->semaphores[i]);
         }
+        vlSemaphoreDelete(pool->workAvailable);
         vlMemFree((vl_memory*)pool);
         return NULL;
     }
@@ -158,69 +804,115 @@ VL_API vl_thread_pool* vlThreadPoolNew(vl_uint_t worker_count)
         for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
         {
             vlAsyncQueueDelete(pool->workQueues[i]);
-            vlSemaphoreDelete(pool->semaphores[i]);
         }
+        vlSemaphoreDelete(pool->workAvailable);
+        vlMemFree((vl_memory*)pool);
+        return NULL;
+    }
+
+    pool->scaleLock = vlMutexNew();
+    if (pool->scaleLock == NULL)
+    {
+        vlConditionDelete(pool->all_idle);
+        vlMutexDelete(pool->idle_lock);
+        for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
+        {
+            vlAsyncQueueDelete(pool->workQueues[i]);
+        }
+        vlSemaphoreDelete(pool->workAvailable);
+        vlMemFree((vl_memory*)pool);
+        return NULL;
+    }
+
+    pool->spaceLock = vlMutexNew();
+    pool->spaceAvailable = vlConditionNew();
+    if (pool->spaceLock == NULL || pool->spaceAvailable == NULL)
+    {
+        if (pool->spaceLock != NULL)
+        {
+            vlMutexDelete(pool->spaceLock);
+        }
+        if (pool->spaceAvailable != NULL)
+        {
+            vlConditionDelete(pool->spaceAvailable);
+        }
+        vlConditionDelete(pool->all_idle);
+        vlMutexDelete(pool->idle_lock);
+        vlMutexDelete(pool->scaleLock);
+        for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
+        {
+            vlAsyncQueueDelete(pool->workQueues[i]);
+        }
+        vlSemaphoreDelete(pool->workAvailable);
         vlMemFree((vl_memory*)pool);
         return NULL;
     }
 
-    /* Allocate worker thread array */
-    pool->workers = vlMemAllocTypeArray(vl_thread, worker_count);
+    /* Allocate one worker slot per potential worker */
+    pool->workers = vlMemAllocTypeArray(vl_thread_pool_worker, max_workers);
     if (pool->workers == NULL)
     {
         vlConditionDelete(pool->all_idle);
         vlMutexDelete(pool->idle_lock);
+        vlMutexDelete(pool->scaleLock);
+        vlMutexDelete(pool->spaceLock);
+        vlConditionDelete(pool->spaceAvailable);
         for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
         {
             vlAsyncQueueDelete(pool->workQueues[i]);
-            vlSemaphoreDelete(pool->semaphores[i]);
         }
+        vlSemaphoreDelete(pool->workAvailable);
         vlMemFree((vl_memory*)pool);
         return NULL;
     }
 
-    pool->workerCount = worker_count;
+    pool->workerCapacity = max_workers;
+    pool->minWorkers = min_workers;
+    pool->scaleBacklog = config->scale_up_backlog;
+    pool->scaleDelayNanos = (vl_ularge_t)config->scale_up_delay_ms * 1000000ull;
+    pool->keepaliveMs = config->keepalive_ms;
+    pool->overflowPolicy = config->overflow_policy;
+    pool->blockTimeoutMs = config->block_timeout_ms;
+    pool->schedulePolicy = config->schedule_policy;
+
+    const vl_ularge_t now = vlThreadMonotonicNano();
+    for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
+    {
+        pool->queueCapacity[i] = config->queue_capacity[i];
+        vlAtomicInit(&pool->queueReserved[i], 0);
+        vlAtomicInit(&pool->queuePeak[i], 0);
+
+        pool->tierWeights[i] = config->tier_weights[i] == 0 ? 1 : config->tier_weights[i];
+        pool->agingNanos[i] =
+            i == VL_THREAD_POOL_PRIORITY_HIGH ? 0 : (vl_ularge_t)config->aging_threshold_ms[i] * 1000000ull;
+        vlAtomicInit(&pool->tierServedAt[i], now);
+    }
+
+    for (vl_uint_t i = 0; i < max_workers; i++)
+    {
+        vl_ThreadPoolWorkerInit(&pool->workers[i], pool);
+    }
 
     /* Initialize atomic state */
     vlAtomicInit(&pool->state, VL_THREAD_POOL_RUNNING);
     vlAtomicInit(&pool->tasksCompleted, 0);
-    vlAtomicInit(&pool->active_workers, worker_count);
+    vlAtomicInit(&pool->instrumented, VL_FALSE);
+    vlAtomicInit(&pool->workerCount, 0);
+    vlAtomicInit(&pool->active_workers, 0);
+    vlAtomicInit(&pool->pressureSince, 0);
+    vlAtomicInit(&pool->workersSpawned, 0);
+    vlAtomicInit(&pool->workersRetired, 0);
+    vlAtomicInit(&pool->blockedProducers, 0);
+    vlAtomicInit(&pool->tasksRejected, 0);
+    vlAtomicInit(&pool->tasksCallerRan, 0);
 
-    /* Create worker threads */
-    for (vl_uint_t i = 0; i < worker_count; i++)
+    /* Create the minimum set of worker threads */
+    for (vl_uint_t i = 0; i < min_workers; i++)
     {
-        pool->workers[i] = vlThreadNew(vl_thread_pool_worker_proc, (void*)pool);
-        if (pool->workers[i] == VL_THREAD_NULL)
+        if (!vl_ThreadPoolSpawnWorker(pool))
         {
-            /* Cleanup: shutdown existing threads */
-            vlAtomicStore(&pool->state, VL_THREAD_POOL_SHUTTING_DOWN);
-
-            /* Signal all semaphores to wake threads */
-            for (vl_int_t j = 0; j < VL_THREAD_POOL_PRIORITY_COUNT; j++)
-            {
-                for (vl_uint_t k = 0; k < i; k++)
-                {
-                    vlSemaphorePost(pool->semaphores[j]);
-                }
-            }
-
-            /* Join created threads */
-            for (vl_uint_t j = 0; j < i; j++)
-            {
-                vlThreadJoin(pool->workers[j]);
-                vlThreadDelete(pool->workers[j]);
-            }
-
-            /* Free resources */
-            vlMemFree((vl_memory*)pool->workers);
-            vlConditionDelete(pool->all_idle);
-            vlMutexDelete(pool->idle_lock);
-            for (vl_int_t j = 0; j < VL_THREAD_POOL_PRIORITY_COUNT; j++)
-            {
-                vlAsyncQueueDelete(pool->workQueues[j]);
-                vlSemaphoreDelete(pool->semaphores[j]);
-            }
-            vlMemFree((vl_memory*)pool);
+            /* Cleanup: delete joins whatever was started */
+            vlThreadPoolDelete(pool);
             return NULL;
         }
     }
@@ -238,26 +930,41 @@ VL_API void vlThreadPoolDelete(vl_thread_pool* pool)
     /* Ensure shutdown is initiated */
     vlThreadPoolShutdown(pool);
 
-    /* Join all worker threads */
-    for (vl_uint_t i = 0; i < pool->workerCount; i++)
+    /*
+     * Hold the scaling lock while joining so no worker can spawn into a slot
+     * the loop has already passed. Workers only ever try-obtain it, so this
+     * cannot deadlock against a worker that is being joined.
+     */
+    vlMutexObtain(pool->scaleLock);
+
+    /* Join every worker thread, live or retired */
+    for (vl_uint_t i = 0; i < pool->workerCapacity; i++)
     {
-        vlThreadJoin(pool->workers[i]);
-        vlThreadDelete(pool->workers[i]);
+        if (vlAtomicLoad(&pool->workers[i].status) != VL_THREAD_POOL_SLOT_EMPTY)
+        {
+            vlThreadJoin(pool->workers[i].thread);
+            vlThreadDelete(pool->workers[i].thread);
+        }
     }
 
+    vlMutexRelease(pool->scaleLock);
+
     /* Free worker array */
     vlMemFree((vl_memory*)pool->workers);
 
     /* Free synchronization primitives */
     vlConditionDelete(pool->all_idle);
     vlMutexDelete(pool->idle_lock);
+    vlMutexDelete(pool->scaleLock);
+    vlMutexDelete(pool->spaceLock);
+    vlConditionDelete(pool->spaceAvailable);
 
-    /* Free queues and semaphores */
+    /* Free queues and semaphore */
     for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
     {
         vlAsyncQueueDelete(pool->workQueues[i]);
-        vlSemaphoreDelete(pool->semaphores[i]);
     }
+    vlSemaphoreDelete(pool->workAvailable);
 
     /* Free pool structure */
     vlMemFree((vl_memory*)pool);
@@ -278,12 +985,13 @@ VL_API vl_bool_t vlThreadPoolEnqueuePriority(vl_thread_pool* pool, vl_thread_poo
         return VL_FALSE;
     }
 
-    /* Enqueue task to appropriate priority queue (lock-free) */
-    vlAsyncQueuePushBack(pool->workQueues[priority], (const void*)task);
-
-    /* Signal a waiting worker at this priority tier */
-    vlSemaphorePost(pool->semaphores[priority]);
+    /* Enqueue task to appropriate priority queue (lock-free) and signal a worker */
+    if (!vl_ThreadPoolSubmit(pool, priority, task, vl_ThreadPoolEnqueueStamp(pool)))
+    {
+        return VL_FALSE;
+    }
 
+    vl_ThreadPoolMaybeGrow(pool);
     return VL_TRUE;
 }
 
@@ -302,16 +1010,22 @@ VL_API vl_uint_t vlThreadPoolEnqueueBatchPriority(vl_thread_pool* pool, vl_threa
         return 0;
     }
 
+    /* One timestamp covers the whole batch */
+    const vl_ularge_t enqueuedAt = vl_ThreadPoolEnqueueStamp(pool);
+
     /* Enqueue all tasks */
     vl_uint_t enqueued = 0;
     for (vl_uint_t i = 0; i < count; i++)
     {
-        vlAsyncQueuePushBack(pool->workQueues[priority], (const void*)&tasks[i]);
+        if (!vl_ThreadPoolSubmit(pool, priority, &tasks[i], enqueuedAt))
+        {
+            break;
+        }
         enqueued++;
-
-        vlSemaphorePost(pool->semaphores[priority]);
     }
 
+    vl_ThreadPoolMaybeGrow(pool);
+
     return enqueued;
 }
 
@@ -372,6 +1086,135 @@ VL_API vl_bool_t vlThreadPoolWait(vl_thread_pool* pool, vl_uint_t timeout_ms)
     return result;
 }
 
+/**
+ * \brief Shared state of one vlThreadPoolParallelFor call.
+ *
+ * Helper tasks may still be queued after the caller returns, so the job is
+ * reference counted and freed by whichever participant leaves last.
+ * \private
+ */
+typedef struct
+{
+    vl_thread_pool_for_proc proc;
+    void* userData;
+    vl_uint_t count;
+    VL_ATOMIC vl_uint_t next;
+    VL_ATOMIC vl_uint_t finished;
+    VL_ATOMIC vl_uint_t refs;
+} vl_thread_pool_for_job;
+
+/**
+ * \brief Claims and runs iterations until none remain.
+ * \private
+ */
+static void vl_ThreadPoolForRun(vl_thread_pool_for_job* job)
+{
+    while (VL_TRUE)
+    {
+        const vl_uint_t index = vlAtomicFetchAddExplicit(&job->next, 1, VL_MEMORY_ORDER_RELAXED);
+        if (index >= job->count)
+        {
+            return;
+        }
+
+        job->proc(job->userData, index);
+        vlAtomicFetchAddExplicit(&job->finished, 1, VL_MEMORY_ORDER_RELEASE);
+    }
+}
+
+/**
+ * \brief Drops one reference to a parallel-for job.
+ * \private
+ */
+static void vl_ThreadPoolForRelease(vl_thread_pool_for_job* job)
+{
+    if (vlAtomicFetchSubExplicit(&job->refs, 1, VL_MEMORY_ORDER_ACQ_REL) == 1)
+    {
+        vlMemFree((vl_memory*)job);
+    }
+}
+
+/**
+ * \brief Helper task enqueued by vlThreadPoolParallelFor.
+ * \private
+ */
+static void vl_ThreadPoolForTask(void* arg)
+{
+    vl_thread_pool_for_job* job = arg;
+    vl_ThreadPoolForRun(job);
+    vl_ThreadPoolForRelease(job);
+}
+
+VL_API void vlThreadPoolParallelFor(vl_thread_pool* pool, vl_uint_t count, vl_thread_pool_for_proc proc,
+                                    void* user_data)
+{
+    vl_thread_pool_for_job* job = NULL;
+    if (pool != NULL && count > 1)
+    {
+        job = (vl_thread_pool_for_job*)vlMemAlloc(sizeof(vl_thread_pool_for_job));
+    }
+
+    if (job == NULL)
+    {
+        for (vl_uint_t i = 0; i < count; i++)
+        {
+            proc(user_data, i);
+        }
+        return;
+    }
+
+    /* The caller takes a share too, so one helper fewer than iterations suffices. */
+    vl_uint_t helpers = count - 1;
+    if (helpers > pool->workerCapacity)
+    {
+        helpers = pool->workerCapacity;
+    }
+
+    job->proc = proc;
+    job->userData = user_data;
+    job->count = count;
+    vlAtomicInit(&job->next, 0);
+    vlAtomicInit(&job->finished, 0);
+    vlAtomicInit(&job->refs, helpers + 1);
+
+    /*
+     * Helpers only take free slots and bypass the overflow policy: blocking
+     * for space from inside a task could wait on the very worker running it.
+     * Iterations no helper picks up are run by the caller below.
+     */
+    const vl_thread_pool_task task = {.proc = vl_ThreadPoolForTask, .user_data = job};
+    const vl_thread_pool_priority priority = VL_THREAD_POOL_PRIORITY_MEDIUM;
+    const vl_ularge_t enqueuedAt = vl_ThreadPoolEnqueueStamp(pool);
+    vl_uint_t queued = 0;
+
+    while (queued < helpers && vlAtomicLoad(&pool->state) == VL_THREAD_POOL_RUNNING &&
+           (pool->queueCapacity[priority] == 0 || vl_ThreadPoolTryReserve(pool, priority)))
+    {
+        vl_ThreadPoolPush(pool, priority, &task, enqueuedAt);
+        queued++;
+    }
+
+    if (queued < helpers)
+    {
+        vlAtomicFetchSubExplicit(&job->refs, helpers - queued, VL_MEMORY_ORDER_RELAXED);
+    }
+
+    if (queued > 0)
+    {
+        vl_ThreadPoolMaybeGrow(pool);
+    }
+
+    vl_ThreadPoolForRun(job);
+
+    /* Remaining iterations are already running on workers; wait for them to land. */
+    while (vlAtomicLoadExplicit(&job->finished, VL_MEMORY_ORDER_ACQUIRE) < count)
+    {
+        vlThreadYield();
+    }
+
+    vl_ThreadPoolForRelease(job);
+}
+
 VL_API void vlThreadPoolShutdown(vl_thread_pool* pool)
 {
     if (pool == NULL)
@@ -388,13 +1231,19 @@ VL_API void vlThreadPoolShutdown(vl_thread_pool* pool)
         return;
     }
 
-    /* Wake all workers by posting to all semaphores */
-    for (vl_uint_t i = 0; i < pool->workerCount; i++)
+    /* Serialize with any in-flight spawn so every started worker gets a wakeup */
+    vlMutexObtain(pool->scaleLock);
+    vlMutexRelease(pool->scaleLock);
+
+    /* Release producers blocked on a full tier; they observe the state change and give up */
+    vlMutexObtain(pool->spaceLock);
+    vlConditionBroadcast(pool->spaceAvailable);
+    vlMutexRelease(pool->spaceLock);
+
+    /* Wake all workers by posting once per slot */
+    for (vl_uint_t i = 0; i < pool->workerCapacity; i++)
     {
-        for (vl_int_t pri = 0; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
-        {
-            vlSemaphorePost(pool->semaphores[pri]);
-        }
+        vlSemaphorePost(pool->workAvailable);
     }
 }
 
@@ -406,10 +1255,175 @@ VL_API void vlThreadPoolGetStats(vl_thread_pool* pool, vl_thread_pool_stats* out
     }
 
     out_stats->tasks_completed = vlAtomicLoad(&pool->tasksCompleted);
-    out_stats->worker_count = pool->workerCount;
+    out_stats->worker_count = vlAtomicLoad(&pool->workerCount);
+    out_stats->workers_spawned = vlAtomicLoad(&pool->workersSpawned);
+    out_stats->workers_retired = vlAtomicLoad(&pool->workersRetired);
+    out_stats->tasks_rejected = vlAtomicLoad(&pool->tasksRejected);
+    out_stats->tasks_caller_ran = vlAtomicLoad(&pool->tasksCallerRan);
 
     for (vl_int_t i = 0; i < VL_THREAD_POOL_PRIORITY_COUNT; i++)
     {
         out_stats->tasksPending[i] = vlAsyncQueueSize(pool->workQueues[i]);
+        out_stats->tasks_pending_peak[i] = vlAtomicLoad(&pool->queuePeak[i]);
+    }
+}
+
+VL_API void vlThreadPoolSetInstrumentation(vl_thread_pool* pool, vl_bool_t enabled)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    vlAtomicStore(&pool->instrumented, enabled ? VL_TRUE : VL_FALSE);
+}
+
+VL_API vl_bool_t vlThreadPoolGetWorkerStats(vl_thread_pool* pool, vl_uint_t worker_index,
+                                            vl_thread_pool_worker_stats* out_stats)
+{
+    if (pool == NULL || out_stats == NULL || worker_index >= pool->workerCapacity)
+    {
+        return VL_FALSE;
+    }
+
+    vl_thread_pool_worker* worker = &pool->workers[worker_index];
+    memset(out_stats, 0, sizeof(vl_thread_pool_worker_stats));
+
+    out_stats->steals = vl_ThreadPoolCounterRead(&worker->steals);
+    out_stats->idles = vl_ThreadPoolCounterRead(&worker->idles);
+    out_stats->parks = vl_ThreadPoolCounterRead(&worker->parks);
+    out_stats->busy_ns = vl_ThreadPoolCounterRead(&worker->busyNanos);
+
+    for (vl_int_t pri = 0; pri < VL_THREAD_POOL_PRIORITY_COUNT; pri++)
+    {
+        out_stats->tasks_executed += vl_ThreadPoolCounterRead(&worker->tasksExecuted[pri]);
+        vl_ThreadPoolHistogramCollect(&out_stats->wait_histogram, &worker->waitHistograms[pri]);
+        vl_ThreadPoolHistogramCollect(&out_stats->exec_histogram, &worker->execHistograms[pri]);
+    }
+
+    return VL_TRUE;
+}
+
+VL_API vl_bool_t vlThreadPoolGetPriorityStats(vl_thread_pool* pool, vl_thread_pool_priority priority,
+                                              vl_thread_pool_priority_stats* out_stats)
+{
+    if (pool == NULL || out_stats == NULL || priority < 0 || priority >= VL_THREAD_POOL_PRIORITY_COUNT)
+    {
+        return VL_FALSE;
+    }
+
+    memset(out_stats, 0, sizeof(vl_thread_pool_priority_stats));
+
+    for (vl_uint_t i = 0; i < pool->workerCapacity; i++)
+    {
+        vl_thread_pool_worker* worker = &pool->workers[i];
+        out_stats->tasks_executed += vl_ThreadPoolCounterRead(&worker->tasksExecuted[priority]);
+        out_stats->tasks_promoted += vl_ThreadPoolCounterRead(&worker->tasksPromoted[priority]);
+        vl_ThreadPoolHistogramCollect(&out_stats->wait_histogram, &worker->waitHistograms[priority]);
+        vl_ThreadPoolHistogramCollect(&out_stats->exec_histogram, &worker->execHistograms[priority]);
+    }
+
+    return VL_TRUE;
+}
+
+VL_API vl_uint_t vlThreadPoolHistogramBucketIndex(vl_ularge_t value)
+{
+    const vl_uint_t subBits = VL_THREAD_POOL_HISTOGRAM_SUB_BITS;
+    const vl_ularge_t subCount = (vl_ularge_t)1 << subBits;
+
+    /* Linear region: one bucket per value. */
+    if (value < subCount)
+    {
+        return (vl_uint_t)value;
+    }
+
+    const vl_uint_t msb = vl_ThreadPoolLog2(value);
+    if (msb > VL_THREAD_POOL_HISTOGRAM_MAX_EXP)
+    {
+        return VL_THREAD_POOL_HISTOGRAM_BUCKETS - 1;
+    }
+
+    const vl_uint_t sub = (vl_uint_t)((value >> (msb - subBits)) & (subCount - 1));
+    return ((msb - subBits + 1) << subBits) + sub;
+}
+
+VL_API vl_ularge_t vlThreadPoolHistogramBucketLowerBound(vl_uint_t bucket)
+{
+    const vl_uint_t subBits = VL_THREAD_POOL_HISTOGRAM_SUB_BITS;
+    const vl_uint_t subCount = 1u << subBits;
+
+    if (bucket < subCount)
+    {
+        return bucket;
+    }
+
+    const vl_uint_t msb = (bucket >> subBits) + subBits - 1;
+    const vl_ularge_t sub = bucket & (subCount - 1);
+    return ((vl_ularge_t)1 << msb) + (sub << (msb - subBits));
+}
+
+VL_API vl_ularge_t vlThreadPoolHistogramPercentile(const vl_thread_pool_histogram* hist, vl_float32_t percentile)
+{
+    if (hist == NULL || hist->count == 0)
+    {
+        return 0;
+    }
+
+    if (percentile <= 0.0f)
+    {
+        return hist->min;
+    }
+
+    if (percentile >= 100.0f)
+    {
+        return hist->max;
+    }
+
+    /* Rank of the requested sample, 1-based, rounded up. */
+    const vl_float_highp_t exactRank = (vl_float_highp_t)hist->count * percentile / 100.0;
+    vl_ularge_t rank = (vl_ularge_t)exactRank;
+    if ((vl_float_highp_t)rank < exactRank || rank == 0)
+    {
+        rank++;
+    }
+
+    vl_ularge_t seen = 0;
+    for (vl_uint_t i = 0; i < VL_THREAD_POOL_HISTOGRAM_BUCKETS; i++)
+    {
+        seen += hist->buckets[i];
+        if (seen >= rank)
+        {
+            const vl_ularge_t upper = (i + 1 < VL_THREAD_POOL_HISTOGRAM_BUCKETS)
+                ? vlThreadPoolHistogramBucketLowerBound(i + 1) - 1
+                : hist->max;
+            return upper < hist->max ? upper : hist->max;
+        }
+    }
+
+    return hist->max;
+}
+
+VL_API void vlThreadPoolHistogramMerge(vl_thread_pool_histogram* dest, const vl_thread_pool_histogram* src)
+{
+    if (dest == NULL || src == NULL || src->count == 0)
+    {
+        return;
+    }
+
+    if (dest->count == 0 || src->min < dest->min)
+    {
+        dest->min = src->min;
+    }
+    if (src->max > dest->max)
+    {
+        dest->max = src->max;
+    }
+
+    dest->count += src->count;
+    dest->sum += src->sum;
+
+    for (vl_uint_t i = 0; i < VL_THREAD_POOL_HISTOGRAM_BUCKETS; i++)
+    {
+        dest->buckets[i] += src->buckets[i];
     }
 }
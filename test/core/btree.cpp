@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/btree.h"
+}
+
+TEST(btree, insert_find) {
+    EXPECT_TRUE(vlTestBTreeInsertFind());
+}
+
+TEST(btree, remove) {
+    EXPECT_TRUE(vlTestBTreeRemove());
+}
+
+TEST(btree, bounds) {
+    EXPECT_TRUE(vlTestBTreeBounds());
+}
+
+TEST(btree, build_sorted) {
+    EXPECT_TRUE(vlTestBTreeBuildSorted());
+}
+
+TEST(btree, benchmark) {
+    EXPECT_TRUE(vlTestBTreeBenchmark());
+}
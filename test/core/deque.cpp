@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/deque.h"
+}
+
+TEST(deque, model) {
+    EXPECT_TRUE(vlTestDequeModel());
+}
+
+TEST(deque, bulk) {
+    EXPECT_TRUE(vlTestDequeBulk());
+}
+
+TEST(deque, clone_reserve) {
+    EXPECT_TRUE(vlTestDequeCloneReserve());
+}
+
+TEST(deque, benchmark) {
+    EXPECT_TRUE(vlTestDequeBenchmark());
+}
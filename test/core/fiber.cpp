@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/fiber.h"
+}
+
+TEST(fiber, basic) {
+    EXPECT_TRUE(vlTestFiberBasic());
+}
+
+TEST(fiber, event) {
+    EXPECT_TRUE(vlTestFiberEvent());
+}
+
+TEST(fiber, sleep) {
+    EXPECT_TRUE(vlTestFiberSleep());
+}
+
+TEST(fiber, blocking) {
+    EXPECT_TRUE(vlTestFiberBlocking());
+}
+
+TEST(fiber, rejected) {
+    EXPECT_TRUE(vlTestFiberRejected());
+}
+
+TEST(fiber, benchmark) {
+    EXPECT_TRUE(vlTestFiberBenchmark());
+}
@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/heap.h"
+}
+
+TEST(heap, order) {
+    EXPECT_TRUE(vlTestHeapOrder());
+}
+
+TEST(heap, numeric_types) {
+    EXPECT_TRUE(vlTestHeapNumericTypes());
+}
+
+TEST(heap, build_batch) {
+    EXPECT_TRUE(vlTestHeapBuildBatch());
+}
+
+TEST(heap, handles) {
+    EXPECT_TRUE(vlTestHeapHandles());
+}
+
+TEST(heap, clone) {
+    EXPECT_TRUE(vlTestHeapClone());
+}
+
+TEST(heap, benchmark) {
+    EXPECT_TRUE(vlTestHeapBenchmark());
+}
@@ -0,0 +1,382 @@
+#include "btree.h"
+#include <vl/vl_btree.h>
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_set.h>
+#include <vl/vl_thread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_BTREE_KEYS 4096
+#define VL_TEST_BTREE_STEPS 60000
+#define VL_TEST_BTREE_BENCH_MAX 1000000
+#define VL_TEST_BTREE_SCAN_LENGTH 64
+
+typedef struct {
+    vl_uint64_t key;
+    vl_uint32_t payload;
+} vl_test_btree_record;
+
+static vl_int_t vlTestBTreeCompareU64(const void *a, const void *b) {
+    const vl_uint64_t ka = *(const vl_uint64_t *) a, kb = *(const vl_uint64_t *) b;
+    return (ka > kb) - (ka < kb);
+}
+
+static vl_int_t vlTestBTreeCompareRecord(const void *a, const void *b) {
+    const vl_test_btree_record *ra = (const vl_test_btree_record *) a, *rb = (const vl_test_btree_record *) b;
+    return (ra->key > rb->key) - (ra->key < rb->key);
+}
+
+/**
+ * Walks a tree of u64 keys forwards and backwards; verifies it holds exactly the keys set in `present`.
+ */
+static vl_bool_t vlTestBTreeMatches(const vl_btree *tree, const vl_bool_t *present, vl_uint64_t numKeys) {
+    vl_dsidx_t count = 0;
+    for (vl_uint64_t k = 0; k < numKeys; k++)
+        count += present[k] ? 1 : 0;
+    vl_bool_t result = vlBTreeSize(tree) == count;
+
+    vl_uint64_t k = 0;
+    VL_BTREE_FOREACH(tree, iter) {
+        const vl_uint64_t key = *(const vl_uint64_t *) vlBTreeSample(tree, iter);
+        while (k < numKeys && !present[k])
+            k++;
+        result = result && key == k;
+        k++;
+        count--;
+    }
+    result = result && count == 0;
+
+    k = numKeys;
+    for (vl_btree_iter iter = vlBTreeBack(tree); vlBTreeIterValid(iter) && result; iter = vlBTreePrev(tree, iter)) {
+        const vl_uint64_t key = *(const vl_uint64_t *) vlBTreeSample(tree, iter);
+        do
+            k--;
+        while (k > 0 && !present[k]);
+        result = key == k && present[k];
+        count++;
+    }
+    return result && count == vlBTreeSize(tree);
+}
+
+vl_bool_t vlTestBTreeInsertFind() {
+    const vl_uint_t nodeSizes[] = {0, 1, 128, 4096};
+    vl_bool_t *present = (vl_bool_t *) vlMemAlloc(sizeof(vl_bool_t) * VL_TEST_BTREE_KEYS);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (size_t n = 0; n < sizeof(nodeSizes) / sizeof(nodeSizes[0]) && result; n++) {
+        vl_btree *tree = vlBTreeNew(sizeof(vl_uint64_t), nodeSizes[n], vlTestBTreeCompareU64);
+        result = tree->leafCapacity >= 4 && tree->branchCapacity >= 4 && tree->nodeSize % VL_BTREE_NODE_ALIGN == 0;
+        result = result && !vlBTreeIterValid(vlBTreeFront(tree)) && !vlBTreeIterValid(vlBTreeBack(tree));
+        memset(present, 0, sizeof(vl_bool_t) * VL_TEST_BTREE_KEYS);
+
+        //Keys are drawn from a narrow range, so roughly half of the insertions are duplicates.
+        for (vl_uint_t i = 0; i < VL_TEST_BTREE_KEYS * 2 && result; i++) {
+            const vl_uint64_t key = vlRandUInt64(&rand) % VL_TEST_BTREE_KEYS;
+            const vl_dsidx_t before = vlBTreeSize(tree);
+            const vl_btree_iter iter = vlBTreeInsert(tree, &key);
+            result = vlBTreeIterValid(iter) && *(const vl_uint64_t *) vlBTreeSample(tree, iter) == key;
+            result = result && vlBTreeSize(tree) == before + (present[key] ? 0 : 1);
+            present[key] = VL_TRUE;
+        }
+
+        for (vl_uint64_t k = 0; k < VL_TEST_BTREE_KEYS && result; k++) {
+            const vl_btree_iter iter = vlBTreeFind(tree, &k);
+            result = vlBTreeIterValid(iter) == present[k];
+            result = result && (!present[k] || *(const vl_uint64_t *) vlBTreeSample(tree, iter) == k);
+        }
+        result = result && vlTestBTreeMatches(tree, present, VL_TEST_BTREE_KEYS);
+
+        vlBTreeClear(tree);
+        result = result && vlBTreeSize(tree) == 0 && tree->totalNodes == 0 && tree->height == 0;
+        vlBTreeDelete(tree);
+    }
+
+    //Ascending insertion packs leaves full, so the tree stays close to the bulk-loaded size.
+    vl_btree ascending;
+    vlBTreeInit(&ascending, sizeof(vl_uint64_t), 0, vlTestBTreeCompareU64);
+    for (vl_uint64_t k = 0; k < VL_TEST_BTREE_KEYS && result; k++)
+        result = vlBTreeIterValid(vlBTreeInsert(&ascending, &k));
+    const vl_dsidx_t minLeaves = (VL_TEST_BTREE_KEYS + ascending.leafCapacity - 1) / ascending.leafCapacity;
+    result = result && ascending.totalNodes <= minLeaves + minLeaves / 2 + 2;
+    vlBTreeFree(&ascending);
+
+    //Records carry a payload beside the key; a duplicate insertion keeps the original record.
+    vl_btree records;
+    vlBTreeInit(&records, sizeof(vl_test_btree_record), 96, vlTestBTreeCompareRecord);
+    for (vl_uint32_t i = 0; i < VL_TEST_BTREE_KEYS && result; i++) {
+        const vl_test_btree_record record = {(vl_uint64_t) (i * 7919u) % VL_TEST_BTREE_KEYS, i};
+        result = vlBTreeIterValid(vlBTreeInsert(&records, &record));
+    }
+    for (vl_uint32_t i = 0; i < VL_TEST_BTREE_KEYS && result; i++) {
+        const vl_test_btree_record probe = {(vl_uint64_t) (i * 7919u) % VL_TEST_BTREE_KEYS, 0xFFFFFFFFu};
+        const vl_btree_iter iter = vlBTreeInsert(&records, &probe);
+        result = ((const vl_test_btree_record *) vlBTreeSample(&records, iter))->payload == i;
+    }
+    result = result && vlBTreeSize(&records) == VL_TEST_BTREE_KEYS;
+    vlBTreeFree(&records);
+
+    vlMemFree((vl_memory *) present);
+    return result;
+}
+
+vl_bool_t vlTestBTreeRemove() {
+    const vl_uint_t nodeSizes[] = {1, 160, 0};
+    vl_bool_t *present = (vl_bool_t *) vlMemAlloc(sizeof(vl_bool_t) * VL_TEST_BTREE_KEYS);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (size_t n = 0; n < sizeof(nodeSizes) / sizeof(nodeSizes[0]) && result; n++) {
+        vl_btree tree;
+        vlBTreeInit(&tree, sizeof(vl_uint64_t), nodeSizes[n], vlTestBTreeCompareU64);
+        memset(present, 0, sizeof(vl_bool_t) * VL_TEST_BTREE_KEYS);
+
+        for (vl_uint_t step = 0; step < VL_TEST_BTREE_STEPS && result; step++) {
+            //Bias toward insertion for the first third, toward removal for the last, so the tree grows and shrinks.
+            const vl_uint_t phase = step * 3 / VL_TEST_BTREE_STEPS;
+            const vl_uint_t roll = vlRandUInt32(&rand) % 4;
+            const vl_bool_t insert = phase == 0 ? roll != 0 : phase == 1 ? roll < 2 : roll == 0;
+            const vl_uint64_t key = vlRandUInt64(&rand) % VL_TEST_BTREE_KEYS;
+
+            if (insert) {
+                result = vlBTreeIterValid(vlBTreeInsert(&tree, &key));
+                present[key] = VL_TRUE;
+            } else {
+                vl_uint64_t removed = ~(vl_uint64_t) 0;
+                result = vlBTreeRemove(&tree, &key, &removed) == present[key];
+                result = result && (!present[key] || removed == key);
+                present[key] = VL_FALSE;
+            }
+
+            if (step % 4096 == 0)
+                result = result && vlTestBTreeMatches(&tree, present, VL_TEST_BTREE_KEYS);
+        }
+        result = result && vlTestBTreeMatches(&tree, present, VL_TEST_BTREE_KEYS);
+
+        //Removing everything collapses the tree back to nothing.
+        for (vl_uint64_t k = 0; k < VL_TEST_BTREE_KEYS && result; k++)
+            result = vlBTreeRemove(&tree, &k, NULL) == present[k];
+        result = result && vlBTreeSize(&tree) == 0 && tree.totalNodes == 0 && tree.root == NULL && tree.height == 0;
+        result = result && !vlBTreeIterValid(vlBTreeFront(&tree));
+
+        const vl_uint64_t key = 1;
+        result = result && !vlBTreeRemove(&tree, &key, NULL);
+        vlBTreeFree(&tree);
+    }
+
+    vlMemFree((vl_memory *) present);
+    return result;
+}
+
+vl_bool_t vlTestBTreeBounds() {
+    const vl_uint64_t span = VL_TEST_BTREE_KEYS * 4;
+    vl_bool_t *present = (vl_bool_t *) vlMemAlloc(sizeof(vl_bool_t) * span);
+    vl_uint64_t *copied = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * span);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vl_btree tree;
+    vlBTreeInit(&tree, sizeof(vl_uint64_t), 1, vlTestBTreeCompareU64);
+    memset(present, 0, sizeof(vl_bool_t) * span);
+
+    //Only odd keys are stored, so every even probe falls between elements.
+    for (vl_uint_t i = 0; i < VL_TEST_BTREE_KEYS; i++) {
+        const vl_uint64_t key = (vlRandUInt64(&rand) % (span / 2)) * 2 + 1;
+        vlBTreeInsert(&tree, &key);
+        present[key] = VL_TRUE;
+    }
+
+    for (vl_uint64_t probe = 0; probe <= span && result; probe++) {
+        vl_uint64_t lower = probe, upper = probe + 1;
+        while (lower < span && !present[lower])
+            lower++;
+        while (upper < span && !present[upper])
+            upper++;
+
+        const vl_btree_iter lowerIter = vlBTreeLowerBound(&tree, &probe);
+        const vl_btree_iter upperIter = vlBTreeUpperBound(&tree, &probe);
+        result = vlBTreeIterValid(lowerIter) == (lower < span);
+        result = result && (lower >= span || *(const vl_uint64_t *) vlBTreeSample(&tree, lowerIter) == lower);
+        result = result && vlBTreeIterValid(upperIter) == (upper < span);
+        result = result && (upper >= span || *(const vl_uint64_t *) vlBTreeSample(&tree, upperIter) == upper);
+    }
+
+    for (vl_uint_t i = 0; i < 2000 && result; i++) {
+        vl_uint64_t low = vlRandUInt64(&rand) % (span + 1), high = vlRandUInt64(&rand) % (span + 1);
+        const vl_dsidx_t limit = (i % 3 == 0) ? (vl_dsidx_t) (vlRandUInt32(&rand) % 64) : (vl_dsidx_t) span;
+        const vl_bool_t openLow = i % 7 == 0, openHigh = i % 11 == 0;
+
+        const vl_dsidx_t count =
+            vlBTreeCopyRange(&tree, openLow ? NULL : &low, openHigh ? NULL : &high, copied, limit);
+        if (openLow)
+            low = 0;
+        if (openHigh)
+            high = span;
+
+        vl_dsidx_t expected = 0;
+        for (vl_uint64_t k = low; k < high && expected < limit && result; k++) {
+            if (!present[k])
+                continue;
+            result = expected < count && copied[expected] == k;
+            expected++;
+        }
+        result = result && count == expected;
+    }
+
+    vlBTreeFree(&tree);
+    vlMemFree((vl_memory *) copied);
+    vlMemFree((vl_memory *) present);
+    return result;
+}
+
+vl_bool_t vlTestBTreeBuildSorted() {
+    const vl_dsidx_t counts[] = {0, 1, 3, 50, 257, 1000, 40000};
+    const vl_dsidx_t maxCount = 40000;
+    vl_uint64_t *keys = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * maxCount);
+    vl_bool_t *present = (vl_bool_t *) vlMemAlloc(sizeof(vl_bool_t) * maxCount * 2);
+    vl_bool_t result = VL_TRUE;
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]) && result; c++) {
+        const vl_dsidx_t count = counts[c];
+        vl_btree tree;
+        vlBTreeInit(&tree, sizeof(vl_uint64_t), c % 2 ? 1 : 0, vlTestBTreeCompareU64);
+
+        //Every fifth key repeats its predecessor; the repeat is dropped.
+        memset(present, 0, sizeof(vl_bool_t) * maxCount * 2);
+        for (vl_dsidx_t i = 0; i < count; i++) {
+            keys[i] = (i % 5 == 4) ? keys[i - 1] : (vl_uint64_t) i * 2;
+            present[keys[i]] = VL_TRUE;
+        }
+        result = vlBTreeBuildSorted(&tree, keys, count);
+        result = result && vlTestBTreeMatches(&tree, present, maxCount * 2);
+        result = result && tree.height <= 1 + (count > tree.leafCapacity ? 4 : 0);
+
+        //A loaded tree behaves like any other: insert the odd keys, then remove the even ones.
+        for (vl_uint64_t k = 1; k < (vl_uint64_t) count * 2 && result; k += 2) {
+            result = vlBTreeIterValid(vlBTreeInsert(&tree, &k));
+            present[k] = VL_TRUE;
+        }
+        for (vl_uint64_t k = 0; k < (vl_uint64_t) count * 2 && result; k += 2) {
+            result = vlBTreeRemove(&tree, &k, NULL) == present[k];
+            present[k] = VL_FALSE;
+        }
+        result = result && vlTestBTreeMatches(&tree, present, maxCount * 2);
+
+        //The clone is rebuilt packed, and independent of the source.
+        vl_btree *clone = vlBTreeClone(&tree, NULL);
+        result = result && clone != NULL && vlTestBTreeMatches(clone, present, maxCount * 2);
+        result = result && clone->totalNodes <= tree.totalNodes;
+        vlBTreeClear(&tree);
+        result = result && vlTestBTreeMatches(clone, present, maxCount * 2);
+        result = result && vlBTreeClone(clone, &tree) == &tree && vlTestBTreeMatches(&tree, present, maxCount * 2);
+        result = result && vlBTreeClone(clone, clone) == clone && vlTestBTreeMatches(clone, present, maxCount * 2);
+        vlBTreeDelete(clone);
+
+        //Unsorted input is rejected and leaves the tree empty.
+        if (count > 2) {
+            keys[count / 2] = keys[count - 1] + 1;
+            result = result && !vlBTreeBuildSorted(&tree, keys, count);
+            result = result && vlBTreeSize(&tree) == 0 && tree.totalNodes == 0 && tree.root == NULL;
+        }
+        vlBTreeFree(&tree);
+    }
+
+    vlMemFree((vl_memory *) present);
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+/**
+ * Returns the bytes held by a set's node pool.
+ */
+static vl_memsize_t vlTestBTreeSetBytes(const vl_set *set) {
+    vl_memsize_t bytes = 0;
+    for (vl_dsidx_t i = 0; i < set->nodePool.lookupTotal; i++)
+        bytes += (vl_memsize_t) set->nodePool.lookupTable[i]->blockSize * set->nodePool.elementSize;
+    return bytes;
+}
+
+vl_bool_t vlTestBTreeBenchmark() {
+    vl_uint64_t *keys = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_BTREE_BENCH_MAX);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlRandFill(&rand, keys, sizeof(vl_uint64_t) * VL_TEST_BTREE_BENCH_MAX);
+
+    printf("u64 ordered set, ns per element (scan: %d-element range per lookup), bytes per element:\n",
+           VL_TEST_BTREE_SCAN_LENGTH);
+    printf("  %9s %8s %8s %8s %8s %8s %8s %8s %8s %8s\n", "elements", "set ins", "set find", "set scan", "set mem",
+           "bt ins", "bt find", "bt scan", "bt mem", "bt load");
+
+    for (vl_dsidx_t count = 1000; count <= VL_TEST_BTREE_BENCH_MAX && result; count *= 10) {
+        const vl_dsidx_t scans = count / VL_TEST_BTREE_SCAN_LENGTH + 1;
+        vl_uint64_t sum = 0, btreeSum = 0;
+
+        vl_set *set = vlSetNew(sizeof(vl_uint64_t), vlTestBTreeCompareU64);
+        vl_ularge_t start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            vlSetInsert(set, keys + i);
+        const vl_ularge_t setInsert = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            sum += vlSetFind(set, keys + i) != VL_SET_ITER_INVALID;
+        const vl_ularge_t setFind = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < scans; i++) {
+            vl_set_iter iter = vlSetFind(set, keys + i);
+            for (int s = 0; s < VL_TEST_BTREE_SCAN_LENGTH && iter != VL_SET_ITER_INVALID; s++) {
+                sum += *(const vl_uint64_t *) vlSetSample(set, iter);
+                iter = vlSetNext(set, iter);
+            }
+        }
+        const vl_ularge_t setScan = vlThreadMonotonicNano() - start;
+        const double setBytes = (double) vlTestBTreeSetBytes(set) / count;
+        vlSetDelete(set);
+
+        vl_btree *tree = vlBTreeNew(sizeof(vl_uint64_t), 0, vlTestBTreeCompareU64);
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            vlBTreeInsert(tree, keys + i);
+        const vl_ularge_t btreeInsert = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            btreeSum += vlBTreeIterValid(vlBTreeFind(tree, keys + i));
+        const vl_ularge_t btreeFind = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < scans; i++) {
+            vl_btree_iter iter = vlBTreeFind(tree, keys + i);
+            for (int s = 0; s < VL_TEST_BTREE_SCAN_LENGTH && vlBTreeIterValid(iter); s++) {
+                btreeSum += *(const vl_uint64_t *) vlBTreeSample(tree, iter);
+                iter = vlBTreeNext(tree, iter);
+            }
+        }
+        const vl_ularge_t btreeScan = vlThreadMonotonicNano() - start;
+        const double btreeBytes = (double) tree->totalNodes * tree->nodeSize / count;
+
+        //Bulk-load from the tree's own sorted contents.
+        vl_uint64_t *sorted = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * vlBTreeSize(tree));
+        const vl_dsidx_t total = vlBTreeCopyRange(tree, NULL, NULL, sorted, vlBTreeSize(tree));
+        start = vlThreadMonotonicNano();
+        result = total == vlBTreeSize(tree) && vlBTreeBuildSorted(tree, sorted, total);
+        const vl_ularge_t btreeLoad = vlThreadMonotonicNano() - start;
+        vlMemFree((vl_memory *) sorted);
+        vlBTreeDelete(tree);
+
+        printf("  %9d %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f\n", (int) count,
+               (double) setInsert / count, (double) setFind / count,
+               (double) setScan / (scans * VL_TEST_BTREE_SCAN_LENGTH), setBytes, (double) btreeInsert / count,
+               (double) btreeFind / count, (double) btreeScan / (scans * VL_TEST_BTREE_SCAN_LENGTH), btreeBytes,
+               (double) btreeLoad / count);
+
+        result = result && sum == btreeSum && btreeBytes < setBytes;
+    }
+
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
@@ -0,0 +1,27 @@
+#ifndef VL_TEST_BTREE_H
+#define VL_TEST_BTREE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Insert random keys and records across node sizes; verify lookups, duplicates and iteration in both directions.
+VL_TEST_API vl_bool_t vlTestBTreeInsertFind();
+
+//Mix insertions and removals over small nodes so splits, borrows and merges all run; check against a model.
+VL_TEST_API vl_bool_t vlTestBTreeRemove();
+
+//Query lower and upper bounds and copy ranges, including open and empty ranges; check against a model.
+VL_TEST_API vl_bool_t vlTestBTreeBounds();
+
+//Bulk-load sorted input with duplicates, reject unsorted input, then modify and clone the loaded tree.
+VL_TEST_API vl_bool_t vlTestBTreeBuildSorted();
+
+//Time insert, find and range scan against vl_set, and report memory per element, from 1K to 1M elements.
+VL_TEST_API vl_bool_t vlTestBTreeBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_BTREE_H
@@ -0,0 +1,308 @@
+#include "deque.h"
+#include <vl/vl_deque.h>
+#include <vl/vl_pool.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_thread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_DEQUE_STEPS 200000
+#define VL_TEST_DEQUE_MODEL_MAX 4096
+#define VL_TEST_DEQUE_BULK_MAX 700
+#define VL_TEST_DEQUE_BENCH_MAX 1000000
+#define VL_TEST_DEQUE_BENCH_CHUNK 256
+
+/**
+ * Verifies that a deque of ints holds exactly the `count` values starting at `model[first]`, in order,
+ * where `model` is itself a ring of VL_TEST_DEQUE_MODEL_MAX slots.
+ */
+static vl_bool_t vlTestDequeMatches(vl_deque *deq, const int *model, vl_dsidx_t first, vl_dsidx_t count) {
+    vl_bool_t result = vlDequeSize(deq) == count;
+    for (vl_dsidx_t i = 0; i < count && result; i++)
+        result = *(const int *) vlDequeSample(deq, i) == model[(first + i) % VL_TEST_DEQUE_MODEL_MAX];
+    return result;
+}
+
+vl_bool_t vlTestDequeModel() {
+    static int model[VL_TEST_DEQUE_MODEL_MAX];
+    vl_dsidx_t first = 0, count = 0;
+    vl_rand rand = vlRandInit();
+    vl_deque deq;
+    vl_bool_t result = VL_TRUE;
+
+    vlDequeInit(&deq, sizeof(int));
+    result = vlDequePopFront(&deq, NULL) == 0 && vlDequePopBack(&deq, NULL) == 0;
+
+    for (int step = 0; step < VL_TEST_DEQUE_STEPS && result; step++) {
+        const int value = (int) vlRandBoundedU32(&rand, 1000000);
+        int popped = -1;
+
+        // Bias towards growth until the deque is large, then towards shrinking, so it wraps and grows repeatedly.
+        const vl_uint32_t growBias = count < VL_TEST_DEQUE_MODEL_MAX / 2 ? 6 : 4;
+        switch (vlRandBoundedU32(&rand, 10) < growBias ? vlRandBoundedU32(&rand, 2) : 2 + vlRandBoundedU32(&rand, 2)) {
+            case 0:
+                if (count == VL_TEST_DEQUE_MODEL_MAX)
+                    break;
+                vlDequePushFront(&deq, &value);
+                first = (first + VL_TEST_DEQUE_MODEL_MAX - 1) % VL_TEST_DEQUE_MODEL_MAX;
+                model[first] = value;
+                count++;
+                break;
+            case 1:
+                if (count == VL_TEST_DEQUE_MODEL_MAX)
+                    break;
+                vlDequePushBack(&deq, &value);
+                model[(first + count) % VL_TEST_DEQUE_MODEL_MAX] = value;
+                count++;
+                break;
+            case 2:
+                result = vlDequePopFront(&deq, &popped) == (count > 0);
+                if (count > 0) {
+                    result = result && popped == model[first];
+                    first = (first + 1) % VL_TEST_DEQUE_MODEL_MAX;
+                    count--;
+                }
+                break;
+            default:
+                result = vlDequePopBack(&deq, &popped) == (count > 0);
+                if (count > 0) {
+                    count--;
+                    result = result && popped == model[(first + count) % VL_TEST_DEQUE_MODEL_MAX];
+                }
+                break;
+        }
+
+        if (step % 997 == 0)
+            result = result && vlTestDequeMatches(&deq, model, first, count);
+    }
+    result = result && vlTestDequeMatches(&deq, model, first, count);
+
+    // Popping a single element without a destination.
+    if (count > 0) {
+        result = result && vlDequePopFront(&deq, NULL) == 1 && vlDequePopBack(&deq, NULL) == (count > 1);
+        first = (first + 1) % VL_TEST_DEQUE_MODEL_MAX;
+        count -= count > 1 ? 2 : 1;
+        result = result && vlTestDequeMatches(&deq, model, first, count);
+    }
+
+    vlDequeClear(&deq);
+    result = result && vlDequeSize(&deq) == 0 && vlDequePopFront(&deq, NULL) == 0;
+
+    vlDequeFree(&deq);
+    return result;
+}
+
+vl_bool_t vlTestDequeBulk() {
+    static int model[VL_TEST_DEQUE_MODEL_MAX], scratch[VL_TEST_DEQUE_BULK_MAX];
+    vl_dsidx_t first = 0, count = 0;
+    vl_rand rand = vlRandInit();
+    vl_deque deq;
+    int next = 0;
+    vl_bool_t result = VL_TRUE;
+
+    vlDequeInit(&deq, sizeof(int));
+
+    for (int step = 0; step < VL_TEST_DEQUE_STEPS / 100 && result; step++) {
+        const vl_dsidx_t n = vlRandBoundedU32(&rand, VL_TEST_DEQUE_BULK_MAX);
+
+        if (vlRandBoundedU32(&rand, 2) == 0 && count + n <= VL_TEST_DEQUE_MODEL_MAX) {
+            for (vl_dsidx_t i = 0; i < n; i++) {
+                scratch[i] = next++;
+                model[(first + count + i) % VL_TEST_DEQUE_MODEL_MAX] = scratch[i];
+            }
+            vlDequePushBackN(&deq, scratch, n);
+            count += n;
+        } else {
+            const vl_dsidx_t expected = n < count ? n : count;
+            result = vlDequePopFrontN(&deq, scratch, n) == expected;
+            for (vl_dsidx_t i = 0; i < expected && result; i++)
+                result = scratch[i] == model[(first + i) % VL_TEST_DEQUE_MODEL_MAX];
+            first = (first + expected) % VL_TEST_DEQUE_MODEL_MAX;
+            count -= expected;
+        }
+
+        // Single pushes at the front interleave with bulk operations at the back.
+        if (step % 7 == 0 && count < VL_TEST_DEQUE_MODEL_MAX) {
+            const int value = next++;
+            vlDequePushFront(&deq, &value);
+            first = (first + VL_TEST_DEQUE_MODEL_MAX - 1) % VL_TEST_DEQUE_MODEL_MAX;
+            model[first] = value;
+            count++;
+        }
+
+        result = result && vlTestDequeMatches(&deq, model, first, count);
+    }
+
+    // Discarding pops, and pops from an empty deque.
+    result = result && vlDequePopFrontN(&deq, NULL, count / 2) == count / 2;
+    first = (first + count / 2) % VL_TEST_DEQUE_MODEL_MAX;
+    count -= count / 2;
+    result = result && vlTestDequeMatches(&deq, model, first, count);
+    result = result && vlDequePopFrontN(&deq, NULL, count + 10) == count && vlDequePopFrontN(&deq, scratch, 1) == 0;
+
+    vlDequeFree(&deq);
+    return result;
+}
+
+vl_bool_t vlTestDequeCloneReserve() {
+    vl_deque *deq = vlDequeNew(sizeof(int));
+    vl_bool_t result = VL_TRUE;
+
+    vlDequeReserve(deq, 100);
+    result = deq->capacity == 128 && vlDequeSize(deq) == 0;
+
+    // Wrap the contents around the end of the buffer, then clone.
+    for (int i = 0; i < 100; i++)
+        vlDequePushBack(deq, &i);
+    result = result && vlDequePopFrontN(deq, NULL, 90) == 90;
+    for (int i = 100; i < 200; i++)
+        vlDequePushBack(deq, &i);
+    result = result && deq->capacity == 128 && vlDequeSize(deq) == 110;
+
+    vl_deque *clone = vlDequeClone(deq, NULL);
+    vl_deque other;
+    vlDequeInit(&other, sizeof(vl_uint64_t));
+    const vl_uint64_t junk = 7;
+    vlDequePushBack(&other, &junk);
+    result = result && vlDequeClone(deq, &other) == &other;
+
+    for (int i = 0; i < 110 && result; i++)
+        result = *(int *) vlDequeSample(clone, i) == 90 + i && *(int *) vlDequeSample(&other, i) == 90 + i &&
+                 *(int *) vlDequeSample(deq, i) == 90 + i;
+    result = result && vlDequeSize(clone) == 110 && vlDequeSize(&other) == 110;
+
+    // Growing a wrapped deque keeps the order.
+    vlDequeReserve(deq, 1000);
+    result = result && deq->capacity == 1024;
+    for (int i = 0; i < 110 && result; i++)
+        result = *(int *) vlDequeSample(deq, i) == 90 + i;
+
+    // Cloning onto itself leaves the deque untouched.
+    result = result && vlDequeClone(deq, deq) == deq && vlDequeSize(deq) == 110;
+    for (int i = 0; i < 110 && result; i++)
+        result = *(int *) vlDequeSample(deq, i) == 90 + i;
+
+    vlDequeFree(&other);
+    vlDequeDelete(clone);
+    vlDequeDelete(deq);
+    return result;
+}
+
+/**
+ * Pool-linked deque with the node layout vl_deque used before it became a ring buffer; the benchmark baseline.
+ */
+typedef struct {
+    vl_pool nodes;
+    vl_pool_idx head, tail;
+    vl_uint16_t elementSize;
+} vl_test_linked_deque;
+
+typedef struct {
+    vl_pool_idx prev, next;
+} vl_test_linked_node;
+
+static void vlTestLinkedPushBack(vl_test_linked_deque *deq, const void *val) {
+    const vl_pool_idx idx = vlPoolTake(&deq->nodes);
+    vl_test_linked_node *node = (vl_test_linked_node *) vlPoolSample(&deq->nodes, idx);
+    memcpy(node + 1, val, deq->elementSize);
+    node->prev = deq->tail;
+    node->next = VL_POOL_INVALID_IDX;
+
+    if (deq->tail != VL_POOL_INVALID_IDX)
+        ((vl_test_linked_node *) vlPoolSample(&deq->nodes, deq->tail))->next = idx;
+    else
+        deq->head = idx;
+    deq->tail = idx;
+}
+
+static int vlTestLinkedPopFront(vl_test_linked_deque *deq, void *val) {
+    if (deq->head == VL_POOL_INVALID_IDX)
+        return 0;
+
+    const vl_pool_idx idx = deq->head;
+    vl_test_linked_node *node = (vl_test_linked_node *) vlPoolSample(&deq->nodes, idx);
+    memcpy(val, node + 1, deq->elementSize);
+
+    deq->head = node->next;
+    if (deq->head != VL_POOL_INVALID_IDX)
+        ((vl_test_linked_node *) vlPoolSample(&deq->nodes, deq->head))->prev = VL_POOL_INVALID_IDX;
+    else
+        deq->tail = VL_POOL_INVALID_IDX;
+
+    vlPoolReturn(&deq->nodes, idx);
+    return 1;
+}
+
+/**
+ * Bytes held by the blocks of a pool.
+ */
+static vl_memsize_t vlTestPoolBytes(const vl_pool *pool) {
+    vl_memsize_t total = 0;
+    for (vl_dsidx_t i = 0; i < pool->lookupTotal; i++)
+        if (pool->lookupTable[i])
+            total += sizeof(vl_pool_node) + (vl_memsize_t) pool->lookupTable[i]->blockSize * pool->elementSize;
+    return total;
+}
+
+vl_bool_t vlTestDequeBenchmark() {
+    static vl_uint64_t chunk[VL_TEST_DEQUE_BENCH_CHUNK];
+    double linkedBytes = 0, ringBytes = 0;
+    vl_bool_t result = VL_TRUE;
+
+    printf("u64 FIFO, push all then pop all, ns per element and bytes per element at peak:\n");
+    printf("  %9s %12s %12s %12s %12s %12s\n", "elements", "pool-linked", "ring", "ring bulk", "linked B", "ring B");
+
+    for (vl_dsidx_t count = 1000; count <= VL_TEST_DEQUE_BENCH_MAX && result; count *= 10) {
+        vl_uint64_t value, sum = 0, linkedSum = 0, ringSum = 0, bulkSum = 0;
+
+        vl_test_linked_deque linked;
+        vlPoolInit(&linked.nodes, sizeof(vl_test_linked_node) + sizeof(vl_uint64_t));
+        linked.head = linked.tail = VL_POOL_INVALID_IDX;
+        linked.elementSize = sizeof(vl_uint64_t);
+
+        vl_ularge_t start = vlThreadMonotonicNano();
+        for (vl_uint64_t i = 0; i < count; i++)
+            vlTestLinkedPushBack(&linked, &i);
+        linkedBytes = (double) vlTestPoolBytes(&linked.nodes) / count;
+        while (vlTestLinkedPopFront(&linked, &value))
+            linkedSum += value;
+        const vl_ularge_t linkedNanos = vlThreadMonotonicNano() - start;
+        vlPoolFree(&linked.nodes);
+
+        vl_deque ring;
+        vlDequeInit(&ring, sizeof(vl_uint64_t));
+        start = vlThreadMonotonicNano();
+        for (vl_uint64_t i = 0; i < count; i++)
+            vlDequePushBack(&ring, &i);
+        ringBytes = (double) ring.capacity * ring.elementSize / count;
+        while (vlDequePopFront(&ring, &value))
+            ringSum += value;
+        const vl_ularge_t ringNanos = vlThreadMonotonicNano() - start;
+        vlDequeFree(&ring);
+
+        vlDequeInit(&ring, sizeof(vl_uint64_t));
+        start = vlThreadMonotonicNano();
+        for (vl_uint64_t i = 0; i < count;) {
+            vl_dsidx_t n = 0;
+            for (; n < VL_TEST_DEQUE_BENCH_CHUNK && i < count; n++, i++)
+                chunk[n] = i;
+            vlDequePushBackN(&ring, chunk, n);
+        }
+        vl_dsidx_t popped;
+        while ((popped = vlDequePopFrontN(&ring, chunk, VL_TEST_DEQUE_BENCH_CHUNK)) > 0)
+            for (vl_dsidx_t n = 0; n < popped; n++)
+                bulkSum += chunk[n];
+        const vl_ularge_t bulkNanos = vlThreadMonotonicNano() - start;
+        vlDequeFree(&ring);
+
+        for (vl_uint64_t i = 0; i < count; i++)
+            sum += i;
+        result = linkedSum == sum && ringSum == sum && bulkSum == sum;
+
+        printf("  %9d %12.2f %12.2f %12.2f %12.1f %12.1f\n", (int) count, (double) linkedNanos / count,
+               (double) ringNanos / count, (double) bulkNanos / count, linkedBytes, ringBytes);
+    }
+
+    // Timings are only reported; memory is compared at the largest size, where the pool's overhead is settled.
+    return result && ringBytes < linkedBytes;
+}
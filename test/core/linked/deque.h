@@ -0,0 +1,24 @@
+#ifndef VL_TEST_DEQUE_H
+#define VL_TEST_DEQUE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Push and pop at both ends at random so the ring wraps and grows; check every element by index against a model.
+VL_TEST_API vl_bool_t vlTestDequeModel();
+
+//Mix bulk pushes and pops of random lengths with single pushes at the front; check against a model.
+VL_TEST_API vl_bool_t vlTestDequeBulk();
+
+//Reserve, clone a wrapped deque into new and existing deques and onto itself, then grow it; check order survives.
+VL_TEST_API vl_bool_t vlTestDequeCloneReserve();
+
+//Time FIFO push and pop against the pool-linked layout, and report memory per element, from 1K to 1M elements.
+VL_TEST_API vl_bool_t vlTestDequeBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_DEQUE_H
@@ -0,0 +1,426 @@
+#include "fiber.h"
+#include <vl/vl_fiber.h>
+#include <vl/vl_semaphore.h>
+#include <stdio.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#define VL_TEST_FIBER_COUNT 1000
+#define VL_TEST_FIBER_YIELDS 3
+
+static void vlTestFiberYielder(void *arg) {
+    for (int i = 0; i < VL_TEST_FIBER_YIELDS; i++) {
+        vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+        vlFiberYield();
+    }
+}
+
+vl_bool_t vlTestFiberBasic() {
+    vl_fiber_scheduler_config config;
+    vlFiberSchedulerConfigDefault(&config);
+
+    vl_fiber_scheduler *scheduler = vlFiberSchedulerNew(&config);
+    if (scheduler == NULL)
+        return VL_FALSE;
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+
+    vl_bool_t result = VL_TRUE;
+    vl_fiber_scheduler_stats stats;
+    vl_uint_t firstWaveStacks = 0;
+
+    for (int wave = 0; wave < 2; wave++) {
+        for (int i = 0; i < VL_TEST_FIBER_COUNT; i++)
+            result = result && vlFiberSpawn(scheduler, vlTestFiberYielder, &counter);
+
+        result = result && vlFiberSchedulerWait(scheduler, 10000);
+        vlFiberSchedulerGetStats(scheduler, &stats);
+
+        if (wave == 0)
+            firstWaveStacks = stats.stacks_allocated;
+    }
+
+    result = result && (vlAtomicLoad(&counter) == 2 * VL_TEST_FIBER_COUNT * VL_TEST_FIBER_YIELDS);
+    result = result && (stats.fibers_spawned == 2 * VL_TEST_FIBER_COUNT);
+    result = result && (stats.fibers_completed == 2 * VL_TEST_FIBER_COUNT);
+    result = result && (stats.fibers_live == 0);
+    //Stacks are only created when none are pooled, so both waves together never need more than one wave's worth.
+    result = result && (firstWaveStacks > 0 && stats.stacks_allocated <= VL_TEST_FIBER_COUNT);
+    result = result && (vlFiberCurrentScheduler() == NULL);
+
+    vlFiberSchedulerDelete(scheduler);
+    return result;
+}
+
+typedef struct {
+    vl_fiber_event gate;
+    vl_fiber_event never;
+    vl_fiber_event done;
+    vl_atomic_uint32_t released;
+    vl_atomic_uint32_t timedOut;
+} vl_test_fiber_event_state;
+
+static void vlTestFiberGateWaiter(void *arg) {
+    vl_test_fiber_event_state *state = (vl_test_fiber_event_state *) arg;
+    if (vlFiberEventWait(state->gate, 0))
+        vlAtomicFetchAdd(&state->released, 1);
+}
+
+static void vlTestFiberTimeoutWaiter(void *arg) {
+    vl_test_fiber_event_state *state = (vl_test_fiber_event_state *) arg;
+    if (!vlFiberEventWait(state->never, 5))
+        vlAtomicFetchAdd(&state->timedOut, 1);
+}
+
+static void vlTestFiberSetter(void *arg) {
+    vl_test_fiber_event_state *state = (vl_test_fiber_event_state *) arg;
+    vlFiberSleep(2);
+    vlFiberEventSet(state->done);
+}
+
+vl_bool_t vlTestFiberEvent() {
+    vl_fiber_scheduler_config config;
+    vlFiberSchedulerConfigDefault(&config);
+    config.workers = 2;
+
+    vl_fiber_scheduler *scheduler = vlFiberSchedulerNew(&config);
+    if (scheduler == NULL)
+        return VL_FALSE;
+
+    vl_test_fiber_event_state state;
+    state.gate = vlFiberEventNew();
+    state.never = vlFiberEventNew();
+    state.done = vlFiberEventNew();
+    vlAtomicInit(&state.released, 0);
+    vlAtomicInit(&state.timedOut, 0);
+
+    vl_bool_t result = VL_TRUE;
+
+    for (int i = 0; i < 100; i++) {
+        result = result && vlFiberSpawn(scheduler, vlTestFiberGateWaiter, &state);
+        result = result && vlFiberSpawn(scheduler, vlTestFiberTimeoutWaiter, &state);
+    }
+
+    //Parked fibers must not be released early.
+    vlThreadSleep(20);
+    result = result && (vlAtomicLoad(&state.released) == 0);
+    result = result && !vlFiberEventIsSet(state.gate);
+
+    vlFiberEventSet(state.gate);
+    result = result && vlFiberSchedulerWait(scheduler, 10000);
+    result = result && (vlAtomicLoad(&state.released) == 100);
+    result = result && (vlAtomicLoad(&state.timedOut) == 100);
+
+    //A plain thread can wait on an event set by a fiber.
+    result = result && !vlFiberEventWait(state.done, 1);
+    result = result && vlFiberSpawn(scheduler, vlTestFiberSetter, &state);
+    result = result && vlFiberEventWait(state.done, 10000);
+    result = result && vlFiberSchedulerWait(scheduler, 10000);
+
+    //Reset events park waiters again.
+    vlFiberEventReset(state.gate);
+    result = result && !vlFiberEventIsSet(state.gate);
+    result = result && vlFiberSpawn(scheduler, vlTestFiberGateWaiter, &state);
+    result = result && !vlFiberSchedulerWait(scheduler, 10);
+    vlFiberEventSet(state.gate);
+    result = result && vlFiberSchedulerWait(scheduler, 10000);
+    result = result && (vlAtomicLoad(&state.released) == 101);
+
+    vlFiberSchedulerDelete(scheduler);
+    vlFiberEventDelete(state.gate);
+    vlFiberEventDelete(state.never);
+    vlFiberEventDelete(state.done);
+    return result;
+}
+
+typedef struct {
+    vl_ularge_t slept;
+    vl_atomic_uint32_t ticks;
+} vl_test_fiber_sleep_state;
+
+static void vlTestFiberSleeper(void *arg) {
+    vl_test_fiber_sleep_state *state = (vl_test_fiber_sleep_state *) arg;
+    const vl_ularge_t start = vlThreadMonotonicNano();
+    vlFiberSleep(20);
+    state->slept = vlThreadMonotonicNano() - start;
+}
+
+static void vlTestFiberTicker(void *arg) {
+    vlAtomicFetchAdd(&((vl_test_fiber_sleep_state *) arg)->ticks, 1);
+}
+
+vl_bool_t vlTestFiberSleep() {
+    vl_fiber_scheduler_config config;
+    vlFiberSchedulerConfigDefault(&config);
+    config.workers = 1;
+
+    vl_fiber_scheduler *scheduler = vlFiberSchedulerNew(&config);
+    if (scheduler == NULL)
+        return VL_FALSE;
+
+    vl_test_fiber_sleep_state state;
+    state.slept = 0;
+    vlAtomicInit(&state.ticks, 0);
+
+    vl_bool_t result = vlFiberSpawn(scheduler, vlTestFiberSleeper, &state);
+
+    //The single worker must stay available while the sleeper is parked.
+    vlThreadSleep(5);
+    for (int i = 0; i < 10; i++)
+        result = result && vlFiberSpawn(scheduler, vlTestFiberTicker, &state);
+
+    result = result && vlFiberSchedulerWait(scheduler, 10000);
+    result = result && (state.slept >= 20000000ull);
+    result = result && (vlAtomicLoad(&state.ticks) == 10);
+
+    vlFiberSchedulerDelete(scheduler);
+    return result;
+}
+
+#define VL_TEST_FIBER_BLOCKING_COUNT 8
+#define VL_TEST_FIBER_BLOCKING_MS 30
+
+static void vlTestFiberBlockingCall(void *arg) {
+    (void) arg;
+    vlThreadSleep(VL_TEST_FIBER_BLOCKING_MS);
+}
+
+static void vlTestFiberBlockingFiber(void *arg) {
+    vlFiberBlocking(vlTestFiberBlockingCall, NULL);
+    vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+}
+
+vl_bool_t vlTestFiberBlocking() {
+    vl_fiber_scheduler_config config;
+    vlFiberSchedulerConfigDefault(&config);
+    config.workers = 1;
+    config.blocking_workers = VL_TEST_FIBER_BLOCKING_COUNT;
+
+    vl_fiber_scheduler *scheduler = vlFiberSchedulerNew(&config);
+    if (scheduler == NULL)
+        return VL_FALSE;
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+
+    const vl_ularge_t start = vlThreadMonotonicNano();
+    vl_bool_t result = VL_TRUE;
+    for (int i = 0; i < VL_TEST_FIBER_BLOCKING_COUNT; i++)
+        result = result && vlFiberSpawn(scheduler, vlTestFiberBlockingFiber, &counter);
+
+    result = result && vlFiberSchedulerWait(scheduler, 10000);
+    const vl_ularge_t elapsedMs = (vlThreadMonotonicNano() - start) / 1000000ull;
+
+    printf("%d blocking calls of %dms on 1 worker: %llums\n", VL_TEST_FIBER_BLOCKING_COUNT,
+           VL_TEST_FIBER_BLOCKING_MS, (unsigned long long) elapsedMs);
+
+    //Serialized on the single worker, the calls would take the sum of their durations.
+    result = result && (vlAtomicLoad(&counter) == VL_TEST_FIBER_BLOCKING_COUNT);
+    result = result && (elapsedMs < (VL_TEST_FIBER_BLOCKING_COUNT * VL_TEST_FIBER_BLOCKING_MS) / 2);
+
+    vlFiberSchedulerDelete(scheduler);
+    return result;
+}
+
+#define VL_TEST_FIBER_REJECT_COUNT 16
+
+static void vlTestFiberNapper(void *arg) {
+    (void) arg;
+    vlFiberSleep(100);
+}
+
+vl_bool_t vlTestFiberRejected() {
+    vl_fiber_scheduler_config config;
+    vlFiberSchedulerConfigDefault(&config);
+
+    //A bounded tier could reject or inline a resumption, so the scheduler refuses it.
+    vl_thread_pool_config poolConfig;
+    vlThreadPoolConfigDefault(&poolConfig);
+    poolConfig.queue_capacity[config.priority] = 64;
+    vl_thread_pool *bounded = vlThreadPoolNewConfig(&poolConfig);
+    config.pool = bounded;
+    vl_bool_t result = bounded != NULL && vlFiberSchedulerNew(&config) == NULL;
+    vlThreadPoolShutdown(bounded);
+    vlThreadPoolDelete(bounded);
+
+    vl_thread_pool *pool = vlThreadPoolNew(1);
+    config.pool = pool;
+    vl_fiber_scheduler *scheduler = vlFiberSchedulerNew(&config);
+    if (pool == NULL || scheduler == NULL) {
+        vlFiberSchedulerDelete(scheduler);
+        vlThreadPoolDelete(pool);
+        return VL_FALSE;
+    }
+
+    for (int i = 0; i < VL_TEST_FIBER_REJECT_COUNT; i++)
+        result = result && vlFiberSpawn(scheduler, vlTestFiberNapper, NULL);
+
+    //Shut the pool down while the fibers sleep; their wakeups are rejected and must not hang the waiter.
+    vlThreadSleep(5);
+    vlThreadPoolShutdown(pool);
+    result = result && vlFiberSchedulerWait(scheduler, 10000);
+
+    vl_fiber_scheduler_stats stats;
+    vlFiberSchedulerGetStats(scheduler, &stats);
+    result = result && (stats.fibers_live == 0);
+    result = result && (stats.fibers_completed + stats.fibers_failed == VL_TEST_FIBER_REJECT_COUNT);
+    result = result && (stats.fibers_failed > 0);
+
+    //New fibers are refused outright, as are new schedulers on the stopped pool.
+    result = result && !vlFiberSpawn(scheduler, vlTestFiberNapper, NULL);
+    vlFiberSchedulerGetStats(scheduler, &stats);
+    result = result && (stats.fibers_spawned == VL_TEST_FIBER_REJECT_COUNT && stats.fibers_live == 0);
+    result = result && vlFiberSchedulerNew(&config) == NULL;
+
+    vlFiberSchedulerDelete(scheduler);
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+//Raise to 100000 for the full-scale comparison; the default keeps resident memory modest in CI.
+#ifndef VL_TEST_FIBER_BENCH_FIBERS
+#define VL_TEST_FIBER_BENCH_FIBERS 10000
+#endif
+#define VL_TEST_FIBER_BENCH_YIELDS 10
+#define VL_TEST_FIBER_BENCH_THREADS 64
+#define VL_TEST_FIBER_BENCH_PINGPONGS 20000
+
+static vl_ularge_t vlTestFiberResidentBytes(void) {
+#ifdef __linux__
+    unsigned long long size = 0, resident = 0;
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (statm == NULL)
+        return 0;
+    if (fscanf(statm, "%llu %llu", &size, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return (vl_ularge_t) resident * (vl_ularge_t) sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+typedef struct {
+    vl_fiber_event gate;
+    vl_atomic_uint32_t parked;
+} vl_test_fiber_bench_state;
+
+static void vlTestFiberBenchFiber(void *arg) {
+    vl_test_fiber_bench_state *state = (vl_test_fiber_bench_state *) arg;
+    vlAtomicFetchAdd(&state->parked, 1);
+    vlFiberEventWait(state->gate, 0);
+    for (int i = 0; i < VL_TEST_FIBER_BENCH_YIELDS; i++)
+        vlFiberYield();
+}
+
+static void vlTestFiberBenchThread(void *arg) {
+    vl_test_fiber_bench_state *state = (vl_test_fiber_bench_state *) arg;
+    vlAtomicFetchAdd(&state->parked, 1);
+    vlFiberEventWait(state->gate, 0);
+}
+
+typedef struct {
+    vl_semaphore ping, pong;
+} vl_test_fiber_pingpong;
+
+static void vlTestFiberPongThread(void *arg) {
+    vl_test_fiber_pingpong *pp = (vl_test_fiber_pingpong *) arg;
+    for (int i = 0; i < VL_TEST_FIBER_BENCH_PINGPONGS; i++) {
+        vlSemaphoreWait(pp->ping, 0);
+        vlSemaphorePost(pp->pong);
+    }
+}
+
+vl_bool_t vlTestFiberBenchmark() {
+    vl_bool_t result = VL_TRUE;
+
+    //Fibers: park N concurrent fibers, then release them to yield repeatedly.
+    vl_fiber_scheduler_config config;
+    vlFiberSchedulerConfigDefault(&config);
+    config.workers = 1;
+    config.stack_size = VL_FIBER_MIN_STACK_SIZE;
+    //Guarded stacks take two kernel mappings each, which caps them well below 100k fibers.
+    config.guard_pages = VL_FALSE;
+
+    vl_fiber_scheduler *scheduler = vlFiberSchedulerNew(&config);
+    if (scheduler == NULL)
+        return VL_FALSE;
+
+    vl_test_fiber_bench_state state;
+    state.gate = vlFiberEventNew();
+    vlAtomicInit(&state.parked, 0);
+
+    const vl_ularge_t fiberBaseRss = vlTestFiberResidentBytes();
+    vl_uint_t spawned = 0;
+    for (int i = 0; i < VL_TEST_FIBER_BENCH_FIBERS; i++)
+        spawned += vlFiberSpawn(scheduler, vlTestFiberBenchFiber, &state) ? 1 : 0;
+    result = result && (spawned == VL_TEST_FIBER_BENCH_FIBERS);
+    while (vlAtomicLoad(&state.parked) < spawned)
+        vlThreadSleep(1);
+    const vl_ularge_t fiberRss = vlTestFiberResidentBytes() - fiberBaseRss;
+
+    const vl_ularge_t fiberStart = vlThreadMonotonicNano();
+    vlFiberEventSet(state.gate);
+    result = result && vlFiberSchedulerWait(scheduler, 60000);
+    const vl_ularge_t fiberNanos = vlThreadMonotonicNano() - fiberStart;
+
+    vl_fiber_scheduler_stats stats;
+    vlFiberSchedulerGetStats(scheduler, &stats);
+    result = result && (stats.fibers_completed == spawned);
+
+    vlFiberSchedulerDelete(scheduler);
+    vlFiberEventDelete(state.gate);
+
+    //Threads: resident cost of parked threads, and switch cost of a semaphore ping-pong.
+    state.gate = vlFiberEventNew();
+    vlAtomicInit(&state.parked, 0);
+
+    vl_thread threads[VL_TEST_FIBER_BENCH_THREADS];
+    const vl_ularge_t threadBaseRss = vlTestFiberResidentBytes();
+    for (int i = 0; i < VL_TEST_FIBER_BENCH_THREADS; i++)
+        threads[i] = vlThreadNew(vlTestFiberBenchThread, &state);
+    while (vlAtomicLoad(&state.parked) < VL_TEST_FIBER_BENCH_THREADS)
+        vlThreadSleep(1);
+    const vl_ularge_t threadRss = vlTestFiberResidentBytes() - threadBaseRss;
+
+    vlFiberEventSet(state.gate);
+    for (int i = 0; i < VL_TEST_FIBER_BENCH_THREADS; i++) {
+        vlThreadJoin(threads[i]);
+        vlThreadDelete(threads[i]);
+    }
+    vlFiberEventDelete(state.gate);
+
+    vl_test_fiber_pingpong pp;
+    pp.ping = vlSemaphoreNew(0);
+    pp.pong = vlSemaphoreNew(0);
+    vl_thread pong = vlThreadNew(vlTestFiberPongThread, &pp);
+
+    const vl_ularge_t threadStart = vlThreadMonotonicNano();
+    for (int i = 0; i < VL_TEST_FIBER_BENCH_PINGPONGS; i++) {
+        vlSemaphorePost(pp.ping);
+        vlSemaphoreWait(pp.pong, 0);
+    }
+    const vl_ularge_t threadNanos = vlThreadMonotonicNano() - threadStart;
+
+    vlThreadJoin(pong);
+    vlThreadDelete(pong);
+    vlSemaphoreDelete(pp.ping);
+    vlSemaphoreDelete(pp.pong);
+
+    //Each yield is a switch out plus a switch back in; each ping-pong is two thread handoffs.
+    const vl_ularge_t fiberSwitches = (vl_ularge_t) VL_TEST_FIBER_BENCH_FIBERS * VL_TEST_FIBER_BENCH_YIELDS * 2;
+    const vl_ularge_t threadSwitches = (vl_ularge_t) VL_TEST_FIBER_BENCH_PINGPONGS * 2;
+
+    printf("fibers:  %6d concurrent, %5llu ns/switch, %6llu bytes resident each (%llu stacks of %llu bytes)\n",
+           VL_TEST_FIBER_BENCH_FIBERS, (unsigned long long) (fiberNanos / fiberSwitches),
+           (unsigned long long) (fiberRss / VL_TEST_FIBER_BENCH_FIBERS),
+           (unsigned long long) stats.stacks_allocated, (unsigned long long) stats.stack_size);
+    printf("threads: %6d concurrent, %5llu ns/switch, %6llu bytes resident each\n",
+           VL_TEST_FIBER_BENCH_THREADS, (unsigned long long) (threadNanos / threadSwitches),
+           (unsigned long long) (threadRss / VL_TEST_FIBER_BENCH_THREADS));
+
+    return result;
+}
@@ -0,0 +1,30 @@
+#ifndef VL_TEST_FIBER_H
+#define VL_TEST_FIBER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Spawn yielding fibers in two waves; verify all complete and the second wave reuses pooled stacks.
+VL_TEST_API vl_bool_t vlTestFiberBasic();
+
+//Verify event wakeups, wait timeouts, and fiber/thread interoperation on events.
+VL_TEST_API vl_bool_t vlTestFiberEvent();
+
+//Verify a sleeping fiber wakes after its deadline without holding its worker.
+VL_TEST_API vl_bool_t vlTestFiberSleep();
+
+//Verify blocking calls are offloaded so parked fibers do not hold the only worker.
+VL_TEST_API vl_bool_t vlTestFiberBlocking();
+
+//Verify bounded or stopped pools are refused and fibers rejected by a shut-down pool are counted out.
+VL_TEST_API vl_bool_t vlTestFiberRejected();
+
+//Compare fiber and thread context-switch cost and per-context memory.
+VL_TEST_API vl_bool_t vlTestFiberBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_FIBER_H
@@ -0,0 +1,441 @@
+#include "heap.h"
+#include <vl/vl_heap.h>
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_set.h>
+#include <vl/vl_thread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_HEAP_ORDER_COUNT 20000
+#define VL_TEST_HEAP_RECORD_SIZE 16
+#define VL_TEST_HEAP_RECORD_KEY_OFFSET 3
+#define VL_TEST_HEAP_MODEL_IDS 512
+#define VL_TEST_HEAP_MODEL_STEPS 60000
+
+//Raise to 10000000 for the full-scale sweep; the default keeps the test quick in CI.
+#ifndef VL_TEST_HEAP_BENCH_MAX
+#define VL_TEST_HEAP_BENCH_MAX 100000
+#endif
+
+typedef struct {
+    vl_int64_t key;
+    vl_uint32_t id;
+} vl_test_heap_entry;
+
+static vl_int_t vlTestHeapCompareEntry(const void *a, const void *b) {
+    const vl_test_heap_entry *ea = (const vl_test_heap_entry *) a, *eb = (const vl_test_heap_entry *) b;
+    return (ea->key > eb->key) - (ea->key < eb->key);
+}
+
+static vl_int_t vlTestHeapCompareU64(const void *a, const void *b) {
+    const vl_uint64_t ka = *(const vl_uint64_t *) a, kb = *(const vl_uint64_t *) b;
+    return (ka > kb) - (ka < kb);
+}
+
+static vl_int_t vlTestHeapCompareBytes(const void *a, const void *b) {
+    return (vl_int_t) memcmp(a, b, VL_TEST_HEAP_RECORD_SIZE);
+}
+
+/**
+ * Pops every element of a heap of u64 keys and checks them against `sorted`.
+ */
+static vl_bool_t vlTestHeapDrainU64(vl_heap *heap, const vl_uint64_t *sorted, vl_dsidx_t count) {
+    vl_bool_t result = vlHeapSize(heap) == count;
+    vl_uint64_t value;
+    for (vl_dsidx_t i = 0; i < count && result; i++) {
+        result = *(const vl_uint64_t *) vlHeapPeek(heap) == sorted[i];
+        result = result && vlHeapPop(heap, &value) != VL_HEAP_HANDLE_INVALID && value == sorted[i];
+    }
+    return result && vlHeapSize(heap) == 0 && vlHeapPeek(heap) == NULL &&
+           vlHeapPop(heap, &value) == VL_HEAP_HANDLE_INVALID;
+}
+
+vl_bool_t vlTestHeapOrder() {
+    const vl_dsidx_t arities[] = {0, 2, 3, 4, 8, 16};
+    vl_uint64_t *keys = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_HEAP_ORDER_COUNT);
+    vl_uint64_t *sorted = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_HEAP_ORDER_COUNT);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (size_t a = 0; a < sizeof(arities) / sizeof(arities[0]) && result; a++) {
+        for (vl_dsidx_t count = 1; count <= VL_TEST_HEAP_ORDER_COUNT && result; count *= 7) {
+            //Narrow keys half of the time, so there are plenty of duplicates.
+            for (vl_dsidx_t i = 0; i < count; i++)
+                keys[i] = (count & 1) ? vlRandUInt64(&rand) % 64 : vlRandUInt64(&rand);
+            memcpy(sorted, keys, sizeof(vl_uint64_t) * count);
+            vlMemSort(sorted, sizeof(vl_uint64_t), count, vlTestHeapCompareU64);
+
+            vl_heap *heap = vlHeapNew(sizeof(vl_uint64_t), arities[a], vlTestHeapCompareU64);
+            for (vl_dsidx_t i = 0; i < count; i++)
+                vlHeapPush(heap, keys + i);
+            result = heap->arity == (arities[a] ? arities[a] : VL_HEAP_DEFAULT_ARITY);
+            result = result && vlTestHeapDrainU64(heap, sorted, count);
+            vlHeapDelete(heap);
+
+            vl_heap numeric;
+            result = result && vlHeapInitNumeric(&numeric, sizeof(vl_uint64_t), arities[a], VL_NUMTYPE_UINT64, 0);
+            for (vl_dsidx_t i = 0; i < count && result; i++)
+                vlHeapPush(&numeric, keys + i);
+            result = result && vlTestHeapDrainU64(&numeric, sorted, count);
+            vlHeapFree(&numeric);
+        }
+    }
+
+    //Out-of-range types and keys that overrun the element are rejected.
+    vl_heap rejected;
+    result = result && !vlHeapInitNumeric(&rejected, 8, 0, VL_NUMTYPE_MAX, 0);
+    result = result && !vlHeapInitNumeric(&rejected, 8, 0, VL_NUMTYPE_UINT32, 5);
+
+    vlMemFree((vl_memory *) sorted);
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+/**
+ * Compares the keys of two records of the given type, read without casts so every bit of the key counts.
+ */
+static vl_int_t vlTestHeapCompareKeys(const vl_uint8_t *a, const vl_uint8_t *b, vl_numtype type) {
+    const vl_numtype_info *info = &VL_NUMTYPE_INFO[type];
+#define VL_TEST_HEAP_COMPARE_AS(T)                                                                                     \
+    do {                                                                                                               \
+        T ka, kb;                                                                                                      \
+        memcpy(&ka, a, sizeof(T));                                                                                     \
+        memcpy(&kb, b, sizeof(T));                                                                                     \
+        return (ka > kb) - (ka < kb);                                                                                  \
+    } while (0)
+    if (info->isFloating) {
+        if (info->size == 4)
+            VL_TEST_HEAP_COMPARE_AS(vl_float32_t);
+        VL_TEST_HEAP_COMPARE_AS(vl_float64_t);
+    }
+    switch (info->size) {
+        case 1:
+            if (info->isSigned)
+                VL_TEST_HEAP_COMPARE_AS(vl_int8_t);
+            VL_TEST_HEAP_COMPARE_AS(vl_uint8_t);
+        case 2:
+            if (info->isSigned)
+                VL_TEST_HEAP_COMPARE_AS(vl_int16_t);
+            VL_TEST_HEAP_COMPARE_AS(vl_uint16_t);
+        case 4:
+            if (info->isSigned)
+                VL_TEST_HEAP_COMPARE_AS(vl_int32_t);
+            VL_TEST_HEAP_COMPARE_AS(vl_uint32_t);
+        default:
+            if (info->isSigned)
+                VL_TEST_HEAP_COMPARE_AS(vl_int64_t);
+            VL_TEST_HEAP_COMPARE_AS(vl_uint64_t);
+    }
+#undef VL_TEST_HEAP_COMPARE_AS
+}
+
+vl_bool_t vlTestHeapNumericTypes() {
+    const vl_dsidx_t count = 5000;
+    const vl_memsize_t bytes = VL_TEST_HEAP_RECORD_SIZE * count;
+    vl_uint8_t *records = (vl_uint8_t *) vlMemAlloc(bytes);
+    vl_uint8_t *popped = (vl_uint8_t *) vlMemAlloc(bytes);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (vl_uint_t type = 0; type < VL_NUMTYPE_MAX && result; type++) {
+        const vl_numtype_info *info = &VL_NUMTYPE_INFO[type];
+        vlRandFill(&rand, records, bytes);
+        if (info->isFloating) {
+            //Random bits would include NaNs; use finite values of both signs with some repeats instead.
+            for (vl_dsidx_t i = 0; i < count; i++) {
+                const vl_float64_t value = (vl_float64_t) (vl_int32_t) (vlRandUInt32(&rand) % 2001) - 1000.0;
+                const vl_float32_t narrow = (vl_float32_t) value;
+                memcpy(records + i * VL_TEST_HEAP_RECORD_SIZE + VL_TEST_HEAP_RECORD_KEY_OFFSET,
+                       info->size == 4 ? (const void *) &narrow : (const void *) &value, info->size);
+            }
+        }
+
+        vl_heap heap;
+        result = vlHeapInitNumeric(&heap, VL_TEST_HEAP_RECORD_SIZE, 0, (vl_numtype) type,
+                                   VL_TEST_HEAP_RECORD_KEY_OFFSET);
+        result = result && vlHeapPushArray(&heap, records, count / 2, NULL);
+        for (vl_dsidx_t i = count / 2; i < count && result; i++)
+            result = vlHeapPush(&heap, records + i * VL_TEST_HEAP_RECORD_SIZE) != VL_HEAP_HANDLE_INVALID;
+        result = result && vlHeapPopArray(&heap, popped, count + 1) == count && vlHeapSize(&heap) == 0;
+        vlHeapFree(&heap);
+
+        for (vl_dsidx_t i = 1; i < count && result; i++)
+            result = vlTestHeapCompareKeys(popped + (i - 1) * VL_TEST_HEAP_RECORD_SIZE + VL_TEST_HEAP_RECORD_KEY_OFFSET,
+                                           popped + i * VL_TEST_HEAP_RECORD_SIZE + VL_TEST_HEAP_RECORD_KEY_OFFSET,
+                                           (vl_numtype) type) <= 0;
+
+        //Same multiset of records in, and out.
+        vlMemSort(records, VL_TEST_HEAP_RECORD_SIZE, count, vlTestHeapCompareBytes);
+        vlMemSort(popped, VL_TEST_HEAP_RECORD_SIZE, count, vlTestHeapCompareBytes);
+        result = result && memcmp(records, popped, bytes) == 0;
+    }
+
+    vlMemFree((vl_memory *) popped);
+    vlMemFree((vl_memory *) records);
+    return result;
+}
+
+vl_bool_t vlTestHeapBuildBatch() {
+    const vl_dsidx_t count = 3000;
+    vl_test_heap_entry *entries = (vl_test_heap_entry *) vlMemAlloc(sizeof(vl_test_heap_entry) * count);
+    vl_test_heap_entry *sorted = (vl_test_heap_entry *) vlMemAlloc(sizeof(vl_test_heap_entry) * count);
+    vl_test_heap_entry *popped = (vl_test_heap_entry *) vlMemAlloc(sizeof(vl_test_heap_entry) * count);
+    vl_heap_handle *handles = (vl_heap_handle *) vlMemAlloc(sizeof(vl_heap_handle) * count);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        entries[i].key = (vl_int64_t) (vlRandUInt32(&rand) % 1000) - 500;
+        entries[i].id = (vl_uint32_t) i;
+    }
+
+    vl_heap heap;
+    vlHeapInit(&heap, sizeof(vl_test_heap_entry), 3, vlTestHeapCompareEntry);
+
+    //Built heaps name each element by its index in the source array.
+    result = vlHeapBuild(&heap, entries, count) && vlHeapSize(&heap) == count;
+    for (vl_dsidx_t i = 0; i < count && result; i++)
+        result = ((vl_test_heap_entry *) vlHeapSample(&heap, i))->id == i;
+
+    //Building again replaces the contents, including building from nothing.
+    result = result && vlHeapBuild(&heap, entries + 100, 50) && vlHeapSize(&heap) == 50;
+    result = result && vlHeapBuild(&heap, NULL, 0) && vlHeapSize(&heap) == 0 && vlHeapPeek(&heap) == NULL;
+
+    //A batch larger than the heap takes the append-and-rebuild path, a smaller one the per-element path.
+    const vl_dsidx_t split[] = {0, 10, 2000, count};
+    for (size_t s = 0; s + 1 < sizeof(split) / sizeof(split[0]) && result; s++) {
+        result = vlHeapPushArray(&heap, entries + split[s], split[s + 1] - split[s], handles + split[s]);
+        for (vl_dsidx_t i = split[s]; i < split[s + 1] && result; i++)
+            result = ((vl_test_heap_entry *) vlHeapSample(&heap, handles[i]))->id == i;
+    }
+    result = result && vlHeapPushArray(&heap, NULL, 0, NULL);
+
+    memcpy(sorted, entries, sizeof(vl_test_heap_entry) * count);
+    vlMemSort(sorted, sizeof(vl_test_heap_entry), count, vlTestHeapCompareEntry);
+
+    //Pop in uneven batches; keys must come out in order, and every id exactly once.
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t batch = 1; total < count && result; batch = batch * 3 + 1)
+        total += vlHeapPopArray(&heap, popped + total, batch);
+    result = result && total == count && vlHeapPopArray(&heap, popped, 5) == 0;
+    vl_dsidx_t idSum = 0;
+    for (vl_dsidx_t i = 0; i < count && result; i++) {
+        result = popped[i].key == sorted[i].key;
+        idSum += popped[i].id;
+    }
+    result = result && idSum == count * (count - 1) / 2;
+
+    vlHeapFree(&heap);
+    vlMemFree((vl_memory *) handles);
+    vlMemFree((vl_memory *) popped);
+    vlMemFree((vl_memory *) sorted);
+    vlMemFree((vl_memory *) entries);
+    return result;
+}
+
+/**
+ * Runs the randomized model check on one heap. Entry ids index the model arrays.
+ */
+static vl_bool_t vlTestHeapModel(vl_heap *heap, vl_rand *rand) {
+    vl_int64_t keys[VL_TEST_HEAP_MODEL_IDS];
+    vl_heap_handle handles[VL_TEST_HEAP_MODEL_IDS];
+    vl_bool_t live[VL_TEST_HEAP_MODEL_IDS];
+    vl_dsidx_t liveCount = 0;
+    vl_bool_t result = VL_TRUE;
+
+    memset(live, 0, sizeof(live));
+
+    for (vl_uint_t step = 0; step < VL_TEST_HEAP_MODEL_STEPS && result; step++) {
+        const vl_uint32_t id = vlRandUInt32(rand) % VL_TEST_HEAP_MODEL_IDS;
+        const vl_uint32_t op = vlRandUInt32(rand) % 8;
+        vl_test_heap_entry entry = {(vl_int64_t) (vlRandUInt32(rand) % 4096) - 2048, id};
+
+        if (!live[id]) {
+            //Absent ids are pushed; their key wins nothing special.
+            handles[id] = vlHeapPush(heap, &entry);
+            keys[id] = entry.key;
+            live[id] = VL_TRUE;
+            liveCount++;
+            result = handles[id] != VL_HEAP_HANDLE_INVALID;
+        } else if (op < 2) {
+            //Decrease-key, written in place through the sampled pointer.
+            ((vl_test_heap_entry *) vlHeapSample(heap, handles[id]))->key -= 1 + vlRandUInt32(rand) % 512;
+            keys[id] = ((vl_test_heap_entry *) vlHeapSample(heap, handles[id]))->key;
+            result = vlHeapUpdate(heap, handles[id], NULL);
+        } else if (op < 4) {
+            //Arbitrary re-key, passed by value.
+            keys[id] = entry.key;
+            result = vlHeapUpdate(heap, handles[id], &entry);
+        } else if (op < 5) {
+            vl_test_heap_entry removed;
+            result = vlHeapRemove(heap, handles[id], &removed) && removed.id == id && removed.key == keys[id];
+            result = result && !vlHeapContains(heap, handles[id]) && !vlHeapRemove(heap, handles[id], NULL);
+            result = result && !vlHeapUpdate(heap, handles[id], &entry);
+            live[id] = VL_FALSE;
+            liveCount--;
+        } else if (op < 7) {
+            //Pop: the root must hold the smallest live key.
+            vl_test_heap_entry root;
+            const vl_heap_handle rootHandle = vlHeapPeekHandle(heap);
+            const vl_heap_handle popHandle = vlHeapPop(heap, &root);
+            result = popHandle == rootHandle && root.id < VL_TEST_HEAP_MODEL_IDS && live[root.id];
+            result = result && handles[root.id] == popHandle && keys[root.id] == root.key;
+            for (vl_uint_t i = 0; i < VL_TEST_HEAP_MODEL_IDS && result; i++)
+                result = !live[i] || keys[i] >= root.key;
+            live[root.id] = VL_FALSE;
+            liveCount--;
+        }
+
+        //Every live id is reachable through its handle with its current key.
+        if (result && (step % 97) == 0) {
+            result = vlHeapSize(heap) == liveCount;
+            for (vl_uint_t i = 0; i < VL_TEST_HEAP_MODEL_IDS && result; i++) {
+                if (!live[i])
+                    continue;
+                const vl_test_heap_entry *sampled = (const vl_test_heap_entry *) vlHeapSample(heap, handles[i]);
+                result = vlHeapContains(heap, handles[i]) && sampled->id == i && sampled->key == keys[i];
+            }
+        }
+    }
+
+    vl_int64_t previous = INT64_MIN;
+    vl_test_heap_entry out;
+    while (result && vlHeapPop(heap, &out) != VL_HEAP_HANDLE_INVALID) {
+        result = live[out.id] && out.key == keys[out.id] && out.key >= previous;
+        live[out.id] = VL_FALSE;
+        previous = out.key;
+    }
+    return result && vlHeapSize(heap) == 0;
+}
+
+vl_bool_t vlTestHeapHandles() {
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (vl_dsidx_t arity = 2; arity <= 5 && result; arity++) {
+        vl_heap heap;
+        vlHeapInit(&heap, sizeof(vl_test_heap_entry), arity, vlTestHeapCompareEntry);
+        result = vlTestHeapModel(&heap, &rand);
+        vlHeapFree(&heap);
+
+        result = result && vlHeapInitNumeric(&heap, sizeof(vl_test_heap_entry), arity, VL_NUMTYPE_INT64,
+                                             offsetof(vl_test_heap_entry, key));
+        result = result && vlTestHeapModel(&heap, &rand);
+        vlHeapFree(&heap);
+    }
+
+    return result;
+}
+
+vl_bool_t vlTestHeapClone() {
+    vl_heap *heap = vlHeapNew(sizeof(vl_test_heap_entry), 0, vlTestHeapCompareEntry);
+    vl_heap_handle handles[200];
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (vl_uint32_t i = 0; i < 200; i++) {
+        const vl_test_heap_entry entry = {(vl_int64_t) (vlRandUInt32(&rand) % 100), i};
+        handles[i] = vlHeapPush(heap, &entry);
+    }
+    for (vl_uint32_t i = 0; i < 200; i += 3)
+        vlHeapRemove(heap, handles[i], NULL);
+
+    //Clone into a new heap and into an existing one with a different element size.
+    vl_heap *clone = vlHeapClone(heap, NULL);
+    vl_heap existing;
+    vlHeapInitNumeric(&existing, 4, 2, VL_NUMTYPE_INT32, 0);
+    vl_int32_t filler = 7;
+    vlHeapPush(&existing, &filler);
+    result = clone != NULL && vlHeapClone(heap, &existing) == &existing;
+    //Cloning onto itself leaves the heap untouched.
+    result = result && vlHeapClone(heap, heap) == heap && vlHeapSize(heap) == vlHeapSize(clone);
+
+    for (vl_uint32_t i = 0; i < 200 && result; i++) {
+        result = vlHeapContains(clone, handles[i]) == (i % 3 != 0);
+        result = result && vlHeapContains(&existing, handles[i]) == (i % 3 != 0);
+        if (result && i % 3 != 0)
+            result = ((vl_test_heap_entry *) vlHeapSample(clone, handles[i]))->id == i &&
+                     ((vl_test_heap_entry *) vlHeapSample(&existing, handles[i]))->id == i;
+    }
+
+    //The clone is independent, and freed handles are reused the same way in both.
+    const vl_test_heap_entry extra = {-1, 999};
+    result = result && vlHeapPush(heap, &extra) == vlHeapPush(clone, &extra);
+    result = result && vlHeapPush(&existing, &extra) == vlHeapPeekHandle(heap);
+
+    vl_test_heap_entry a, b, c;
+    while (result && vlHeapSize(heap) > 0) {
+        result = vlHeapPop(heap, &a) == vlHeapPop(clone, &b) && vlHeapPop(&existing, &c) != VL_HEAP_HANDLE_INVALID;
+        result = result && memcmp(&a, &b, sizeof(a)) == 0 && memcmp(&a, &c, sizeof(a)) == 0;
+    }
+    result = result && vlHeapSize(clone) == 0 && vlHeapSize(&existing) == 0;
+
+    vlHeapFree(&existing);
+    vlHeapDelete(clone);
+    vlHeapDelete(heap);
+    return result;
+}
+
+vl_bool_t vlTestHeapBenchmark() {
+    vl_uint64_t *keys = (vl_uint64_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_HEAP_BENCH_MAX);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlRandFill(&rand, keys, sizeof(vl_uint64_t) * VL_TEST_HEAP_BENCH_MAX);
+
+    printf("u64 priority queue, push all then pop all, ns per element:\n");
+    printf("  %9s %16s %16s %16s %16s\n", "elements", "vl_set", "vl_heap cmp", "vl_heap u64", "vl_heap build");
+
+    for (vl_dsidx_t count = 1000; count <= VL_TEST_HEAP_BENCH_MAX && result; count *= 10) {
+        vl_uint64_t value, previous;
+
+        vl_set *set = vlSetNew(sizeof(vl_uint64_t), vlTestHeapCompareU64);
+        vl_ularge_t start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            vlSetInsert(set, keys + i);
+        for (vl_set_iter it = vlSetFront(set); it != VL_SET_ITER_INVALID; it = vlSetFront(set))
+            vlSetRemove(set, it);
+        const vl_ularge_t setNanos = vlThreadMonotonicNano() - start;
+        vlSetDelete(set);
+
+        vl_heap *heap = vlHeapNew(sizeof(vl_uint64_t), 0, vlTestHeapCompareU64);
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            vlHeapPush(heap, keys + i);
+        previous = 0;
+        while (vlHeapPop(heap, &value) != VL_HEAP_HANDLE_INVALID) {
+            result = result && value >= previous;
+            previous = value;
+        }
+        const vl_ularge_t heapNanos = vlThreadMonotonicNano() - start;
+        vlHeapDelete(heap);
+
+        vl_heap numeric;
+        vlHeapInitNumeric(&numeric, sizeof(vl_uint64_t), 0, VL_NUMTYPE_UINT64, 0);
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t i = 0; i < count; i++)
+            vlHeapPush(&numeric, keys + i);
+        while (vlHeapPop(&numeric, &value) != VL_HEAP_HANDLE_INVALID)
+            ;
+        const vl_ularge_t numericNanos = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        vlHeapBuild(&numeric, keys, count);
+        previous = 0;
+        while (result && vlHeapPop(&numeric, &value) != VL_HEAP_HANDLE_INVALID) {
+            result = value >= previous;
+            previous = value;
+        }
+        const vl_ularge_t buildNanos = vlThreadMonotonicNano() - start;
+        vlHeapFree(&numeric);
+
+        printf("  %9d %16.1f %16.1f %16.1f %16.1f\n", (int) count, (double) setNanos / count,
+               (double) heapNanos / count, (double) numericNanos / count, (double) buildNanos / count);
+    }
+
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
@@ -0,0 +1,30 @@
+#ifndef VL_TEST_HEAP_H
+#define VL_TEST_HEAP_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Push random keys into comparator and numeric heaps of several arities; verify they pop in sorted order.
+VL_TEST_API vl_bool_t vlTestHeapOrder();
+
+//Pop records keyed by every numeric type at an unaligned offset; verify key order and that no record is lost.
+VL_TEST_API vl_bool_t vlTestHeapNumericTypes();
+
+//Build heaps from arrays and push batches on both the append and per-element paths; verify handles and order.
+VL_TEST_API vl_bool_t vlTestHeapBuildBatch();
+
+//Mix pushes, pops, updates and removals by handle; check every step against a brute-force model.
+VL_TEST_API vl_bool_t vlTestHeapHandles();
+
+//Clone a heap with live and freed handles; verify the clone pops the same sequence and keeps handle identity.
+VL_TEST_API vl_bool_t vlTestHeapClone();
+
+//Time push and pop-all against vl_set used as a priority queue, from 1K to 10M elements.
+VL_TEST_API vl_bool_t vlTestHeapBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_HEAP_H
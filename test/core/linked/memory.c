@@ -2,6 +2,10 @@
 #include <vl/vl_memory.h>
 #include <vl/vl_numtypes.h>
 #include <vl/vl_rand.h>
+#include <vl/vl_simd.h>
+#include <vl/vl_thread.h>
+#include <stdio.h>
+#include <string.h>
 
 vl_bool_t vlTestMemReverse() {
     vl_bool_t result = VL_TRUE;
@@ -52,3 +56,396 @@ vl_bool_t vlTestMemSort(vl_int_t numArrayLen) {
 
     return result;
 }
+
+static vl_int32_t vlTestMemSortKey(vl_test_sort_pattern pattern, vl_dsidx_t i, vl_dsidx_t n, vl_rand *rand) {
+    switch (pattern) {
+        case VL_TEST_SORT_SORTED:
+            return (vl_int32_t) i;
+        case VL_TEST_SORT_REVERSED:
+            return (vl_int32_t) (n - i);
+        case VL_TEST_SORT_FEW_UNIQUE:
+            return (vl_int32_t) (vlRandUInt32(rand) % 8);
+        case VL_TEST_SORT_ORGAN_PIPE:
+            return (vl_int32_t) (i < n / 2 ? i : n - i);
+        default:
+            return (vl_int32_t) vlRandUInt32(rand);
+    }
+}
+
+static vl_int_t vlTestMemSortCompareKey(const void *a, const void *b) {
+    vl_int32_t ka, kb;
+    memcpy(&ka, a, sizeof(ka));
+    memcpy(&kb, b, sizeof(kb));
+    return (ka > kb) - (ka < kb);
+}
+
+/**
+ * Fills records whose first four bytes are the key; every remaining byte is derived from it so a torn move is
+ * detectable. Returns the sum of the keys.
+ */
+static vl_ularge_t vlTestMemSortFill(vl_usmall_t *mem, vl_test_sort_pattern pattern, vl_memsize_t elementSize,
+                                     vl_dsidx_t numElements) {
+    vl_rand rand = vlRandInit();
+    vl_ularge_t keySum = 0;
+
+    for (vl_dsidx_t i = 0; i < numElements; i++) {
+        vl_usmall_t *elem = mem + i * elementSize;
+        const vl_int32_t key = vlTestMemSortKey(pattern, i, numElements, &rand);
+        memcpy(elem, &key, sizeof(key));
+        for (vl_memsize_t b = sizeof(key); b < elementSize; b++)
+            elem[b] = (vl_usmall_t) (key * 31 + b);
+        keySum += (vl_uint32_t) key;
+    }
+    return keySum;
+}
+
+/**
+ * Reads a record's key, clearing `intact` if its payload no longer matches.
+ */
+static vl_int32_t vlTestMemSortRecordKey(const vl_usmall_t *elem, vl_memsize_t elementSize, vl_bool_t *intact) {
+    vl_int32_t key;
+    memcpy(&key, elem, sizeof(key));
+    for (vl_memsize_t b = sizeof(key); b < elementSize; b++)
+        *intact = *intact && (elem[b] == (vl_usmall_t) (key * 31 + b));
+    return key;
+}
+
+vl_bool_t vlTestMemSortPattern(vl_test_sort_pattern pattern, vl_memsize_t elementSize, vl_dsidx_t numElements) {
+    vl_usmall_t *const mem = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    vl_ularge_t keySum = vlTestMemSortFill(mem, pattern, elementSize, numElements);
+    vl_bool_t result = VL_TRUE;
+
+    vlMemSort(mem, elementSize, numElements, vlTestMemSortCompareKey);
+
+    vl_int32_t prev = 0;
+    for (vl_dsidx_t i = 0; i < numElements && result; i++) {
+        const vl_usmall_t *elem = mem + i * elementSize;
+        vl_int32_t key;
+        memcpy(&key, elem, sizeof(key));
+
+        result = result && (i == 0 || key >= prev);
+        for (vl_memsize_t b = sizeof(key); b < elementSize && result; b++)
+            result = result && (elem[b] == (vl_usmall_t) (key * 31 + b));
+
+        keySum -= (vl_uint32_t) key;
+        prev = key;
+    }
+
+    vlMemFree((vl_memory *) mem);
+    return result && (keySum == 0);
+}
+
+vl_bool_t vlTestMemSelectPattern(vl_test_sort_pattern pattern, vl_memsize_t elementSize, vl_dsidx_t numElements) {
+    vl_usmall_t *const mem = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    vl_usmall_t *const sorted = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    vl_usmall_t *const original = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    const vl_dsidx_t targets[] = {0, numElements / 3, numElements / 2, numElements - 1};
+    vl_bool_t result = VL_TRUE;
+
+    vlTestMemSortFill(original, pattern, elementSize, numElements);
+    memcpy(sorted, original, elementSize * numElements);
+    vlMemSort(sorted, elementSize, numElements, vlTestMemSortCompareKey);
+
+    for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]) && result; t++) {
+        const vl_dsidx_t nth = targets[t];
+        memcpy(mem, original, elementSize * numElements);
+        vlMemSelect(mem, elementSize, numElements, nth, vlTestMemSortCompareKey);
+
+        //The selected key matches a full sort, with nothing greater before it and nothing smaller after.
+        const vl_int32_t expected = vlTestMemSortRecordKey(sorted + nth * elementSize, elementSize, &result);
+        for (vl_dsidx_t i = 0; i < numElements && result; i++) {
+            const vl_int32_t key = vlTestMemSortRecordKey(mem + i * elementSize, elementSize, &result);
+            result = result && (i < nth ? key <= expected : i > nth ? key >= expected : key == expected);
+        }
+    }
+
+    vlMemFree((vl_memory *) original);
+    vlMemFree((vl_memory *) sorted);
+    vlMemFree((vl_memory *) mem);
+    return result;
+}
+
+vl_bool_t vlTestMemPartialSortPattern(vl_test_sort_pattern pattern, vl_memsize_t elementSize,
+                                      vl_dsidx_t numElements) {
+    vl_usmall_t *const mem = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    vl_usmall_t *const sorted = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    vl_usmall_t *const original = (vl_usmall_t *) vlMemAlloc(elementSize * numElements);
+    const vl_dsidx_t counts[] = {1, 10, numElements / 2, numElements};
+    vl_bool_t result = VL_TRUE;
+
+    const vl_ularge_t keySum = vlTestMemSortFill(original, pattern, elementSize, numElements);
+    memcpy(sorted, original, elementSize * numElements);
+    vlMemSort(sorted, elementSize, numElements, vlTestMemSortCompareKey);
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]) && result; c++) {
+        const vl_dsidx_t count = counts[c];
+        vl_ularge_t remaining = keySum;
+        memcpy(mem, original, elementSize * numElements);
+        vlMemPartialSort(mem, elementSize, numElements, count, vlTestMemSortCompareKey);
+
+        //The prefix matches a full sort key for key; everything after it orders no earlier than its last key.
+        const vl_int32_t last = vlTestMemSortRecordKey(sorted + (count - 1) * elementSize, elementSize, &result);
+        for (vl_dsidx_t i = 0; i < numElements && result; i++) {
+            const vl_int32_t key = vlTestMemSortRecordKey(mem + i * elementSize, elementSize, &result);
+            if (i < count)
+                result = result && key == vlTestMemSortRecordKey(sorted + i * elementSize, elementSize, &result);
+            else
+                result = result && key >= last;
+            remaining -= (vl_uint32_t) key;
+        }
+        result = result && remaining == 0;
+    }
+
+    vlMemFree((vl_memory *) original);
+    vlMemFree((vl_memory *) sorted);
+    vlMemFree((vl_memory *) mem);
+    return result;
+}
+
+#define VL_TEST_MEM_STRIDE_MAX_SIZE 17
+#define VL_TEST_MEM_STRIDE_MAX_COUNT 67
+#define VL_TEST_MEM_STRIDE_BENCH_COUNT (1 << 20)
+#define VL_TEST_MEM_STRIDE_BENCH_REPEAT 8
+
+/**
+ * Hands the SIMD table back to the best backend after a test walked through all of them.
+ */
+static void vlTestMemRestoreBackend(void) {
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+}
+
+/**
+ * Compares one strided copy against a byte-by-byte loop, including the padding between destination elements.
+ */
+static vl_bool_t vlTestMemCopyStrideCase(const vl_usmall_t *src, vl_usmall_t *dst, vl_usmall_t *expected,
+                                         vl_memsize_t size, vl_dsoffs_t srcStride, vl_dsoffs_t dstStride,
+                                         vl_dsidx_t count) {
+    const vl_memsize_t dstBytes = dstStride * VL_TEST_MEM_STRIDE_MAX_COUNT + size;
+    memset(dst, 0xA5, dstBytes);
+    memset(expected, 0xA5, dstBytes);
+
+    for (vl_dsidx_t i = 0; i < count; i++)
+        for (vl_memsize_t b = 0; b < size; b++)
+            expected[i * dstStride + b] = src[i * srcStride + b];
+
+    vlMemCopyStride(src, srcStride, dst, dstStride, size, count);
+    return memcmp(dst, expected, dstBytes) == 0;
+}
+
+/**
+ * Gathers eight 4- and 8-byte elements walking backwards, with a short stride
+ * and with one whose last-lane offset overflows a signed 32-bit lane. Only the
+ * pages holding the elements are touched, so the span costs address space
+ * rather than memory.
+ */
+static vl_bool_t vlTestMemCopyStrideBackward(void) {
+    if (sizeof(void *) < 8)
+        return VL_TRUE;
+
+    const vl_ilarge_t strides[] = {-24, -(vl_ilarge_t) (0x7FFFFFFF / 7 + 4096)};
+    const vl_dsidx_t count = 8;
+    const vl_memsize_t span = (vl_memsize_t) (-strides[1]) * (count - 1) + 8;
+    vl_usmall_t *buffer = (vl_usmall_t *) vlMemAlloc(span);
+    //Skipped where the platform will not reserve the span.
+    if (buffer == NULL)
+        return VL_TRUE;
+
+    vl_usmall_t *last = buffer + span - 8;
+    vl_bool_t result = VL_TRUE;
+    for (int s = 0; s < 2 && result; s++) {
+        const vl_dsoffs_t stride = (vl_dsoffs_t) strides[s];
+        vl_uint64_t expected[8], gathered[8];
+        vl_uint32_t gathered32[8];
+
+        for (vl_dsidx_t i = 0; i < count; i++) {
+            expected[i] = (0x0101010101010101ull * (i + 1)) ^ (0x8040201008040201ull << s);
+            memcpy(last + (vl_ilarge_t) i * strides[s], expected + i, 8);
+        }
+
+        for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+            if (!vlSIMDUseBackend((vl_simd_backend) backend))
+                continue;
+
+            memset(gathered, 0, sizeof(gathered));
+            vlMemCopyStride(last, stride, gathered, 8, 8, count);
+            result = memcmp(gathered, expected, sizeof(expected)) == 0;
+
+            vlMemCopyStride(last, stride, gathered32, 4, 4, count);
+            for (vl_dsidx_t i = 0; i < count && result; i++)
+                result = memcmp(gathered32 + i, expected + i, 4) == 0;
+
+            if (!result)
+                printf("vlMemCopyStride stride %lld mismatch on backend %s\n", (long long) strides[s],
+                       vlSIMDFunctions.backend_name);
+        }
+    }
+    vlTestMemRestoreBackend();
+
+    vlMemFree((vl_memory *) buffer);
+    return result;
+}
+
+vl_bool_t vlTestMemCopyStride(void) {
+    const vl_memsize_t bufferSize = 4 * VL_TEST_MEM_STRIDE_MAX_SIZE * (VL_TEST_MEM_STRIDE_MAX_COUNT + 1);
+    vl_usmall_t *src = (vl_usmall_t *) vlMemAlloc(bufferSize);
+    vl_usmall_t *dst = (vl_usmall_t *) vlMemAlloc(bufferSize);
+    vl_usmall_t *expected = (vl_usmall_t *) vlMemAlloc(bufferSize);
+    vl_rand rand = vlRandInit();
+    vlRandFill(&rand, src, bufferSize);
+
+    vl_bool_t result = VL_TRUE;
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+
+        for (vl_memsize_t size = 1; size <= VL_TEST_MEM_STRIDE_MAX_SIZE && result; size++) {
+            //Packed, padded and widely spaced strides on each side; the +1 source offset misaligns every element.
+            const vl_dsoffs_t strides[] = {size, size + 1, size * 3};
+            for (int s = 0; s < 3 && result; s++)
+                for (int d = 0; d < 3 && result; d++)
+                    for (vl_dsidx_t count = 0; count <= VL_TEST_MEM_STRIDE_MAX_COUNT && result; count++)
+                        result = vlTestMemCopyStrideCase(src + (count & 1u), dst, expected, size, strides[s],
+                                                         strides[d], count);
+        }
+
+        if (!result)
+            printf("vlMemCopyStride mismatch on backend %s\n", vlSIMDFunctions.backend_name);
+    }
+    vlTestMemRestoreBackend();
+
+    vlMemFree((vl_memory *) expected);
+    vlMemFree((vl_memory *) dst);
+    vlMemFree((vl_memory *) src);
+    return result && vlTestMemCopyStrideBackward();
+}
+
+vl_bool_t vlTestMemReverseStride(void) {
+    const vl_memsize_t bufferSize = 2 * VL_TEST_MEM_STRIDE_MAX_SIZE * (VL_TEST_MEM_STRIDE_MAX_COUNT + 1) + 8;
+    vl_usmall_t *original = (vl_usmall_t *) vlMemAlloc(bufferSize);
+    vl_usmall_t *mem = (vl_usmall_t *) vlMemAlloc(bufferSize);
+    vl_usmall_t *expected = (vl_usmall_t *) vlMemAlloc(bufferSize);
+    vl_rand rand = vlRandInit();
+    vlRandFill(&rand, original, bufferSize);
+
+    vl_bool_t result = VL_TRUE;
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+
+        for (vl_memsize_t size = 1; size <= VL_TEST_MEM_STRIDE_MAX_SIZE && result; size++) {
+            //Packed and padded strides, each from an aligned start and from one that misaligns every element.
+            for (vl_dsoffs_t stride = size; stride <= size * 2 && result; stride += size)
+                for (vl_memsize_t offset = 0; offset < 2 && result; offset++)
+                    for (vl_dsidx_t count = 0; count <= VL_TEST_MEM_STRIDE_MAX_COUNT && result; count++) {
+                        memcpy(mem, original, bufferSize);
+                        memcpy(expected, original, bufferSize);
+                        for (vl_dsidx_t i = 0; i < count; i++)
+                            for (vl_memsize_t b = 0; b < size; b++)
+                                expected[offset + i * stride + b] = original[offset + i * stride + size - 1 - b];
+
+                        vlMemReverseSubArraysStride(mem + offset, stride, size, count);
+                        result = memcmp(mem, expected, bufferSize) == 0;
+                    }
+        }
+
+        if (!result)
+            printf("vlMemReverseSubArraysStride mismatch on backend %s\n", vlSIMDFunctions.backend_name);
+    }
+    vlTestMemRestoreBackend();
+
+    vlMemFree((vl_memory *) expected);
+    vlMemFree((vl_memory *) mem);
+    vlMemFree((vl_memory *) original);
+    return result;
+}
+
+/**
+ * The per-element byte loops vlMemCopyStride and vlMemReverseSubArraysStride used before dispatching to fixed sizes.
+ */
+static void vlTestMemCopyStrideBytes(const void *src, vl_dsoffs_t srcStride, void *dst, vl_dsoffs_t dstStride,
+                                     vl_memsize_t size, vl_dsidx_t count) {
+    const vl_usmall_t *srcPtr = src;
+    vl_usmall_t *dstPtr = dst;
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        memcpy(dstPtr, srcPtr, size);
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+}
+
+static void vlTestMemReverseStrideBytes(void *src, vl_dsoffs_t srcStride, vl_memsize_t size, vl_dsidx_t count) {
+    vl_usmall_t *elem = src;
+    for (vl_dsidx_t i = 0; i < count; i++, elem += srcStride)
+        for (vl_memsize_t b = 0; b < size / 2; b++) {
+            const vl_usmall_t temp = elem[b];
+            elem[b] = elem[size - 1 - b];
+            elem[size - 1 - b] = temp;
+        }
+}
+
+typedef struct {
+    const char *name;
+    vl_memsize_t size;
+    vl_dsoffs_t srcStride; //0 marks an in-place byte swap over a packed array.
+    vl_dsoffs_t dstStride;
+} vl_test_mem_stride_bench;
+
+vl_bool_t vlTestMemStrideBenchmark(void) {
+    static const vl_test_mem_stride_bench benches[] = {
+        {"Gather32", 4, 16, 4},
+        {"Gather64", 8, 32, 8},
+        {"Scatter32", 4, 4, 16},
+        {"Strided16", 16, 48, 32},
+        {"BSwap16", 2, 0, 0},
+        {"BSwap32", 4, 0, 0},
+        {"BSwap64", 8, 0, 0},
+    };
+    const vl_dsidx_t n = VL_TEST_MEM_STRIDE_BENCH_COUNT;
+    vl_usmall_t *src = (vl_usmall_t *) vlMemAlloc(48 * (vl_memsize_t) n);
+    vl_usmall_t *dst = (vl_usmall_t *) vlMemAlloc(32 * (vl_memsize_t) n);
+    vl_rand rand = vlRandInit();
+    vlRandFill(&rand, src, 48 * (vl_memsize_t) n);
+
+    vl_bool_t available[VL_SIMD_BACKEND_COUNT];
+    printf("Strided copies over %d elements, GB/s of element data:\n%-12s%10s", (int) n, "", "ByteLoop");
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT; backend++)
+        if ((available[backend] = vlSIMDUseBackend((vl_simd_backend) backend)))
+            printf("%12s", vlSIMDFunctions.backend_name);
+    printf("\n");
+
+    for (vl_dsidx_t k = 0; k < sizeof(benches) / sizeof(benches[0]); k++) {
+        const vl_test_mem_stride_bench *bench = &benches[k];
+        const double bytes = (double) bench->size * n * VL_TEST_MEM_STRIDE_BENCH_REPEAT;
+        printf("%-12s", bench->name);
+
+        //Column -1 is the old per-element byte loop; the rest run the dispatching functions on each backend.
+        for (int backend = -1; backend < VL_SIMD_BACKEND_COUNT; backend++) {
+            if (backend >= 0 && !available[backend])
+                continue;
+            if (backend >= 0)
+                vlSIMDUseBackend((vl_simd_backend) backend);
+
+            const vl_ularge_t start = vlThreadMonotonicNano();
+            for (int r = 0; r < VL_TEST_MEM_STRIDE_BENCH_REPEAT; r++) {
+                if (bench->srcStride == 0 && backend < 0)
+                    vlTestMemReverseStrideBytes(src, bench->size, bench->size, n);
+                else if (bench->srcStride == 0)
+                    vlMemReverseSubArraysStride(src, bench->size, bench->size, n);
+                else if (backend < 0)
+                    vlTestMemCopyStrideBytes(src, bench->srcStride, dst, bench->dstStride, bench->size, n);
+                else
+                    vlMemCopyStride(src, bench->srcStride, dst, bench->dstStride, bench->size, n);
+            }
+            const vl_ularge_t nanos = vlThreadMonotonicNano() - start;
+            printf("%12.2f", bytes / (double) (nanos ? nanos : 1));
+        }
+        printf("\n");
+    }
+    vlTestMemRestoreBackend();
+
+    vlMemFree((vl_memory *) dst);
+    vlMemFree((vl_memory *) src);
+    return VL_TRUE;
+}
@@ -6,11 +6,42 @@ extern "C" {
 #endif
 
 #include <vl/vl_numtypes.h>
+#include <vl/vl_memory.h>
 
 vl_bool_t vlTestMemReverse(void);
 vl_bool_t vlTestMemAlign(vl_int_t alignment);
 vl_bool_t vlTestMemSort(vl_int_t numArrayLen);
 
+/**
+ * Input shapes that defeat naive quicksort pivots.
+ */
+typedef enum {
+    VL_TEST_SORT_RANDOM,
+    VL_TEST_SORT_SORTED,
+    VL_TEST_SORT_REVERSED,
+    VL_TEST_SORT_FEW_UNIQUE,
+    VL_TEST_SORT_ORGAN_PIPE,
+    VL_TEST_SORT_PATTERN_COUNT
+} vl_test_sort_pattern;
+
+//Sort records of elementSize bytes laid out in the given pattern; verify order and that payloads moved with keys.
+vl_bool_t vlTestMemSortPattern(vl_test_sort_pattern pattern, vl_memsize_t elementSize, vl_dsidx_t numElements);
+
+//Select several ranks from records in the given pattern; verify each against a full sort and that payloads moved intact.
+vl_bool_t vlTestMemSelectPattern(vl_test_sort_pattern pattern, vl_memsize_t elementSize, vl_dsidx_t numElements);
+
+//Partially sort records in the given pattern for several prefix lengths; verify each prefix against a full sort.
+vl_bool_t vlTestMemPartialSortPattern(vl_test_sort_pattern pattern, vl_memsize_t elementSize, vl_dsidx_t numElements);
+
+//Copy elements of 1 to 17 bytes between packed, padded and misaligned strides, plus negative ones; check bytes.
+vl_bool_t vlTestMemCopyStride(void);
+
+//Byte-swap elements of 1 to 17 bytes, packed, padded and misaligned, on every backend; compare with a byte loop.
+vl_bool_t vlTestMemReverseStride(void);
+
+//Time strided gathers, scatters and byte swaps on every available backend next to the old per-element byte loops.
+vl_bool_t vlTestMemStrideBenchmark(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,178 @@
+#include "numtypes.h"
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_simd.h>
+#include <vl/vl_thread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_NUMTYPES_MAX_COUNT 1000
+#define VL_TEST_NUMTYPES_MAX_STRIDE 3
+#define VL_TEST_NUMTYPES_BENCH_COUNT 4096
+#define VL_TEST_NUMTYPES_BENCH_REPEAT 256
+
+static const char *const vlTestNumTypeNames[VL_NUMTYPE_MAX] = {
+    [VL_NUMTYPE_DSOFFS] = "DSOFFS", [VL_NUMTYPE_DSIDX] = "DSIDX",
+    [VL_NUMTYPE_UINT8] = "U8", [VL_NUMTYPE_UINT16] = "U16", [VL_NUMTYPE_UINT32] = "U32", [VL_NUMTYPE_UINT64] = "U64",
+    [VL_NUMTYPE_INT8] = "I8", [VL_NUMTYPE_INT16] = "I16", [VL_NUMTYPE_INT32] = "I32", [VL_NUMTYPE_INT64] = "I64",
+    [VL_NUMTYPE_FLOAT32] = "F32", [VL_NUMTYPE_FLOAT64] = "F64"
+};
+
+/**
+ * Fills `count` source elements, `stride` bytes apart, with values every destination type can represent once cast.
+ * Integers get random bits, since integer casts wrap. Floats headed for an integer type stay within the range of
+ * signed and unsigned bytes and keep a fractional part, to exercise truncation; floats headed for a float type are
+ * random values of varied magnitude.
+ */
+static void vlTestNumTypeFill(void *src, vl_numtype srcType, vl_dsoffs_t stride, vl_numtype dstType, vl_dsidx_t count,
+                              vl_rand *rand) {
+    const vl_numtype_info *info = &VL_NUMTYPE_INFO[srcType];
+    const vl_bool_t toFloat = VL_NUMTYPE_INFO[dstType].isFloating;
+    const vl_bool_t toSigned = VL_NUMTYPE_INFO[dstType].isSigned;
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        vl_usmall_t *elem = (vl_usmall_t *) src + i * stride;
+        const vl_uint64_t bits = vlRandUInt64(rand);
+        double value = (double) (bits % 240) * 0.75 - (toSigned ? 90.0 : 0.0);
+        if (toFloat)
+            value = ((double) (vl_int32_t) (bits >> 32) / 3.0) * (double) (1u << (bits % 24));
+        if (srcType == VL_NUMTYPE_FLOAT32) {
+            const vl_float32_t f = (vl_float32_t) value;
+            memcpy(elem, &f, sizeof(f));
+        } else if (srcType == VL_NUMTYPE_FLOAT64)
+            memcpy(elem, &value, sizeof(value));
+        else
+            memcpy(elem, &bits, info->size);
+    }
+}
+
+/**
+ * Converts one array and compares every destination element against vlNumTypeCast. Bytes between strided
+ * destination elements must be left alone.
+ */
+static vl_bool_t vlTestNumTypeCastAt(vl_numtype srcType, vl_numtype dstType, vl_dsidx_t count, vl_dsidx_t srcSpread,
+                                     vl_dsidx_t dstSpread, vl_usmall_t *src, vl_usmall_t *dst, vl_usmall_t *ref,
+                                     vl_rand *rand) {
+    const vl_uint16_t srcSize = vlNumTypeSizeof(srcType), dstSize = vlNumTypeSizeof(dstType);
+    const vl_dsoffs_t srcStride = (vl_dsoffs_t) srcSize * srcSpread, dstStride = (vl_dsoffs_t) dstSize * dstSpread;
+    const vl_memsize_t dstBytes = (vl_memsize_t) dstStride * count;
+
+    vlTestNumTypeFill(src, srcType, srcStride, dstType, count, rand);
+    memset(dst, 0xA5, dstBytes);
+    memset(ref, 0xA5, dstBytes);
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        if (srcType == dstType)
+            memcpy(ref + i * dstStride, src + i * srcStride, srcSize);
+        else
+            vlNumTypeCast(src + i * srcStride, srcType, ref + i * dstStride, dstType);
+    }
+
+    //Packed arrays also go through the stride-0 shorthand.
+    const vl_bool_t packed = srcSpread == 1 && dstSpread == 1;
+    vlNumTypeCastArray(src, srcType, packed && (count % 2) ? 0 : srcStride, dst, dstType,
+                       packed && (count % 2) ? 0 : dstStride, count);
+    if (memcmp(dst, ref, dstBytes) != 0) {
+        printf("vlNumTypeCastArray mismatch: %s to %s, %d elements, spread %d/%d\n", vlTestNumTypeNames[srcType],
+               vlTestNumTypeNames[dstType], (int) count, (int) srcSpread, (int) dstSpread);
+        return VL_FALSE;
+    }
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestNumTypeCastArray() {
+    static const vl_dsidx_t counts[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 100, VL_TEST_NUMTYPES_MAX_COUNT};
+    const vl_memsize_t bytes = (vl_memsize_t) sizeof(vl_float64_t) * VL_TEST_NUMTYPES_MAX_STRIDE *
+                               VL_TEST_NUMTYPES_MAX_COUNT;
+    vl_usmall_t *src = (vl_usmall_t *) vlMemAlloc(bytes);
+    vl_usmall_t *dst = (vl_usmall_t *) vlMemAlloc(bytes);
+    vl_usmall_t *ref = (vl_usmall_t *) vlMemAlloc(bytes);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+        for (int s = 0; s < VL_NUMTYPE_MAX && result; s++)
+            for (int d = 0; d < VL_NUMTYPE_MAX && result; d++)
+                for (vl_dsidx_t c = 0; c < sizeof(counts) / sizeof(counts[0]) && result; c++) {
+                    result = vlTestNumTypeCastAt((vl_numtype) s, (vl_numtype) d, counts[c], 1, 1, src, dst, ref, &rand);
+                    //Strided views: a sparse source, a sparse destination, and both.
+                    if (result && backend == 0)
+                        result = vlTestNumTypeCastAt((vl_numtype) s, (vl_numtype) d, counts[c], 2, 1, src, dst, ref,
+                                                     &rand) &&
+                                 vlTestNumTypeCastAt((vl_numtype) s, (vl_numtype) d, counts[c], 1, 3, src, dst, ref,
+                                                     &rand) &&
+                                 vlTestNumTypeCastAt((vl_numtype) s, (vl_numtype) d, counts[c], 3, 2, src, dst, ref,
+                                                     &rand);
+                }
+    }
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+
+    vlMemFree((vl_memory *) ref);
+    vlMemFree((vl_memory *) dst);
+    vlMemFree((vl_memory *) src);
+    return result;
+}
+
+static volatile vl_uint64_t vlTestNumTypeBenchSink;
+
+/**
+ * Times `repeat` runs of one conversion and returns millions of elements per second. With `perElement` set,
+ * converts through vlNumTypeCast one element at a time, as callers did before vlNumTypeCastArray.
+ */
+static double vlTestNumTypeBenchPair(vl_numtype srcType, vl_numtype dstType, const vl_usmall_t *src, vl_usmall_t *dst,
+                                     vl_bool_t perElement) {
+    const vl_dsidx_t n = VL_TEST_NUMTYPES_BENCH_COUNT;
+    const vl_uint16_t srcSize = vlNumTypeSizeof(srcType), dstSize = vlNumTypeSizeof(dstType);
+    const vl_ularge_t start = vlThreadMonotonicNano();
+    for (int r = 0; r < VL_TEST_NUMTYPES_BENCH_REPEAT; r++) {
+        if (!perElement)
+            vlNumTypeCastArray(src, srcType, 0, dst, dstType, 0, n);
+        else if (srcType == dstType)
+            memcpy(dst, src, (vl_memsize_t) srcSize * n);
+        else
+            for (vl_dsidx_t i = 0; i < n; i++)
+                vlNumTypeCast(src + i * srcSize, srcType, dst + i * dstSize, dstType);
+        vlTestNumTypeBenchSink += dst[r % n];
+    }
+    const vl_ularge_t nanos = vlThreadMonotonicNano() - start;
+    return (double) n * VL_TEST_NUMTYPES_BENCH_REPEAT * 1000.0 / (double) (nanos ? nanos : 1);
+}
+
+vl_bool_t vlTestNumTypeCastArrayBenchmark() {
+    const vl_memsize_t bytes = sizeof(vl_float64_t) * VL_TEST_NUMTYPES_BENCH_COUNT;
+    vl_usmall_t *src = (vl_usmall_t *) vlMemAlloc(bytes);
+    vl_usmall_t *dst = (vl_usmall_t *) vlMemAlloc(bytes);
+    vl_rand rand = vlRandInit();
+    static double rates[VL_NUMTYPE_MAX][VL_NUMTYPE_MAX][2];
+
+    vlSIMDInit();
+    for (int s = 0; s < VL_NUMTYPE_MAX; s++)
+        for (int d = 0; d < VL_NUMTYPE_MAX; d++) {
+            vlTestNumTypeFill(src, (vl_numtype) s, vlNumTypeSizeof((vl_numtype) s), (vl_numtype) d,
+                              VL_TEST_NUMTYPES_BENCH_COUNT, &rand);
+            for (int perElement = 0; perElement < 2; perElement++)
+                rates[s][d][perElement] =
+                    vlTestNumTypeBenchPair((vl_numtype) s, (vl_numtype) d, src, dst, (vl_bool_t) perElement);
+        }
+
+    const char *const titles[2] = {"vlNumTypeCastArray", "vlNumTypeCast per element"};
+    for (int perElement = 0; perElement < 2; perElement++) {
+        printf("%s over %d elements, million elements/s (%s backend; rows are source types):\n%-7s",
+               titles[perElement], VL_TEST_NUMTYPES_BENCH_COUNT, vlSIMDFunctions.backend_name, "");
+        for (int d = 0; d < VL_NUMTYPE_MAX; d++)
+            printf("%7s", vlTestNumTypeNames[d]);
+        printf("\n");
+        for (int s = 0; s < VL_NUMTYPE_MAX; s++) {
+            printf("%-7s", vlTestNumTypeNames[s]);
+            for (int d = 0; d < VL_NUMTYPE_MAX; d++)
+                printf("%7.0f", rates[s][d][perElement]);
+            printf("\n");
+        }
+    }
+
+    vlMemFree((vl_memory *) dst);
+    vlMemFree((vl_memory *) src);
+    return VL_TRUE;
+}
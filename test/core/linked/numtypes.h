@@ -0,0 +1,18 @@
+#ifndef VL_TEST_NUMTYPES_H
+#define VL_TEST_NUMTYPES_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Convert packed and strided arrays between every pair of types on every SIMD backend; compare with vlNumTypeCast.
+VL_TEST_API vl_bool_t vlTestNumTypeCastArray();
+
+//Time vlNumTypeCastArray against a vlNumTypeCast loop for every pair of types; print both as a matrix.
+VL_TEST_API vl_bool_t vlTestNumTypeCastArrayBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_NUMTYPES_H
@@ -77,3 +77,34 @@ vl_bool_t vlTestQueueClone() {
 
     return result;
 }
+
+vl_bool_t vlTestQueueBulk() {
+    int values[300];
+    vl_queue *queue = vlQueueNew(sizeof(int));
+    vl_bool_t result = VL_TRUE;
+    int next = 0, expected = 0;
+
+    // Push and pop in uneven batches so the contents wrap around the ring and force it to grow.
+    for (int round = 0; round < 50 && result; round++) {
+        for (int i = 0; i < 300; i++)
+            values[i] = next++;
+        vlQueuePushBackN(queue, values, 300);
+
+        result = vlQueueSize(queue) == (vl_dsidx_t) (next - expected);
+        for (vl_dsidx_t i = 0; i < vlQueueSize(queue) && result; i++)
+            result = *(int *) vlQueueSample(queue, i) == expected + (int) i;
+
+        const vl_dsidx_t popped = vlQueuePopFrontN(queue, values, 170 + round);
+        result = result && popped == (vl_dsidx_t) (170 + round);
+        for (vl_dsidx_t i = 0; i < popped && result; i++)
+            result = values[i] == expected++;
+    }
+
+    int value;
+    while (result && vlQueuePopFront(queue, &value))
+        result = value == expected++;
+    result = result && expected == next && vlQueueSize(queue) == 0;
+
+    vlQueueDelete(queue);
+    return result;
+}
@@ -10,6 +10,7 @@ extern "C" {
 vl_bool_t vlTestQueueGrowth(void);
 vl_bool_t vlTestQueueFIFO(void);
 vl_bool_t vlTestQueueClone(void);
+vl_bool_t vlTestQueueBulk(void);
 
 #ifdef __cplusplus
 }
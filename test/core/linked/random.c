@@ -1,6 +1,11 @@
 #include "random.h"
 #include <vl/vl_memory.h>
 #include <vl/vl_rand.h>
+#include <vl/vl_simd.h>
+#include <vl/vl_thread.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 vl_bool_t vlTestRandomVec4f() {
@@ -33,3 +38,631 @@ vl_bool_t vlTestRandomFill(vl_memsize_t regionSize) {
     vlMemFree(blank);
     return result;
 }
+
+#define VL_TEST_XOSHIRO_WORDS (4 * VL_RAND_XOSHIRO_LANES)
+#define VL_TEST_XOSHIRO_REF_BLOCKS 37
+#define VL_TEST_XOSHIRO_QUALITY_BYTES VL_MB(16)
+#define VL_TEST_XOSHIRO_BENCH_BYTES VL_MB(64)
+#define VL_TEST_XOSHIRO_BENCH_REPEAT 4
+
+/**
+ * Textbook single-lane xoshiro256++, written independently of the library's kernels.
+ */
+static vl_uint64_t vlTestXoshiroNext(vl_uint64_t *s) {
+    const vl_uint64_t sum = s[0] + s[3];
+    const vl_uint64_t result = ((sum << 23) | (sum >> 41)) + s[0];
+    const vl_uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return result;
+}
+
+static void vlTestXoshiroLane(const vl_rand_xoshiro *rand, int lane, vl_uint64_t *s) {
+    for (int w = 0; w < 4; w++)
+        s[w] = rand->state[w * VL_RAND_XOSHIRO_LANES + lane];
+}
+
+/**
+ * Hands the SIMD table back to the best backend after a test walked through all of them.
+ */
+static void vlTestXoshiroRestoreBackend(void) {
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+}
+
+/**
+ * Generates the interleaved output of `blocks` steps with the reference generator, advancing `rand`.
+ */
+static void vlTestXoshiroReference(vl_rand_xoshiro *rand, vl_uint64_t *out, vl_dsidx_t blocks) {
+    for (int lane = 0; lane < VL_RAND_XOSHIRO_LANES; lane++) {
+        vl_uint64_t s[4];
+        vlTestXoshiroLane(rand, lane, s);
+        for (vl_dsidx_t b = 0; b < blocks; b++)
+            out[b * VL_RAND_XOSHIRO_LANES + lane] = vlTestXoshiroNext(s);
+        for (int w = 0; w < 4; w++)
+            rand->state[w * VL_RAND_XOSHIRO_LANES + lane] = s[w];
+    }
+}
+
+vl_bool_t vlTestRandomXoshiroReference(void) {
+    const vl_dsidx_t words = VL_TEST_XOSHIRO_REF_BLOCKS * VL_RAND_XOSHIRO_LANES;
+    vl_uint64_t expected[VL_TEST_XOSHIRO_REF_BLOCKS * VL_RAND_XOSHIRO_LANES];
+    vl_uint64_t bytes[VL_TEST_XOSHIRO_REF_BLOCKS * VL_RAND_XOSHIRO_LANES + 1];
+    vl_float32_t floats[VL_TEST_XOSHIRO_REF_BLOCKS * VL_RAND_XOSHIRO_LANES * 2];
+    vl_float64_t doubles[VL_TEST_XOSHIRO_REF_BLOCKS * VL_RAND_XOSHIRO_LANES];
+
+    vl_rand_xoshiro seeded, reference;
+    vlRandXoshiroInit(&seeded, 12345);
+    reference = seeded;
+    vlTestXoshiroReference(&reference, expected, VL_TEST_XOSHIRO_REF_BLOCKS);
+
+    vl_bool_t result = VL_TRUE;
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+
+        //Bytes at every length up to the full run, written one byte past alignment; the state must match afterward.
+        for (vl_dsidx_t len = 0; len <= words * 8 && result; len += (len < 200 ? 1 : 61)) {
+            vl_rand_xoshiro rand = seeded;
+            memset(bytes, 0, sizeof(bytes));
+            vlRandXoshiroFill(&rand, ((vl_usmall_t *) bytes) + 1, len);
+            result = memcmp(((vl_usmall_t *) bytes) + 1, expected, len) == 0;
+
+            const vl_dsidx_t consumed = (len + 63) / 64;
+            vl_rand_xoshiro stepped = seeded;
+            vl_uint64_t discard[VL_TEST_XOSHIRO_REF_BLOCKS * VL_RAND_XOSHIRO_LANES];
+            vlTestXoshiroReference(&stepped, discard, consumed);
+            result = result && memcmp(&stepped, &rand, sizeof(rand)) == 0;
+        }
+
+        //Floats and doubles, including counts that end partway through a block.
+        for (vl_dsidx_t count = 0; count <= words && result; count += 3) {
+            vl_rand_xoshiro rand = seeded;
+            vlRandXoshiroFillF(&rand, floats, count * 2);
+            for (vl_dsidx_t i = 0; i < count * 2 && result; i++) {
+                const vl_uint32_t half = (vl_uint32_t) (expected[i / 2] >> (i % 2 ? 32 : 0));
+                result = floats[i] == (vl_float32_t) (half >> 9) / (vl_float32_t) (1u << 23);
+            }
+
+            rand = seeded;
+            vlRandXoshiroFillD(&rand, doubles, count);
+            for (vl_dsidx_t i = 0; i < count && result; i++)
+                result = doubles[i] == (vl_float64_t) (expected[i] >> 12) / 4503599627370496.0;
+        }
+
+        if (!result)
+            printf("xoshiro output mismatch on backend %s\n", vlSIMDFunctions.backend_name);
+    }
+    vlTestXoshiroRestoreBackend();
+    return result;
+}
+
+/**
+ * A linear map on the 256-bit state, stored as the images of each unit vector.
+ */
+typedef struct {
+    vl_uint64_t column[256][4];
+} vl_test_xoshiro_matrix;
+
+static void vlTestXoshiroApply(const vl_test_xoshiro_matrix *m, const vl_uint64_t *v, vl_uint64_t *out) {
+    vl_uint64_t acc[4] = {0, 0, 0, 0};
+    for (int bit = 0; bit < 256; bit++)
+        if ((v[bit / 64] >> (bit % 64)) & 1u)
+            for (int w = 0; w < 4; w++)
+                acc[w] ^= m->column[bit][w];
+    memcpy(out, acc, sizeof(acc));
+}
+
+/**
+ * Builds the matrix for 2^power steps by squaring the one-step matrix `power` times.
+ */
+static void vlTestXoshiroJumpMatrix(vl_test_xoshiro_matrix *m, int power) {
+    for (int bit = 0; bit < 256; bit++) {
+        vl_uint64_t *s = m->column[bit];
+        memset(s, 0, sizeof(m->column[bit]));
+        s[bit / 64] = (vl_uint64_t) 1 << (bit % 64);
+        vlTestXoshiroNext(s);
+    }
+
+    vl_test_xoshiro_matrix *square = (vl_test_xoshiro_matrix *) vlMemAlloc(sizeof(vl_test_xoshiro_matrix));
+    for (int p = 0; p < power; p++) {
+        for (int bit = 0; bit < 256; bit++)
+            vlTestXoshiroApply(m, m->column[bit], square->column[bit]);
+        memcpy(m, square, sizeof(*m));
+    }
+    vlMemFree((vl_memory *) square);
+}
+
+vl_bool_t vlTestRandomXoshiroJump(void) {
+    vl_test_xoshiro_matrix *jump = (vl_test_xoshiro_matrix *) vlMemAlloc(sizeof(vl_test_xoshiro_matrix));
+    vl_test_xoshiro_matrix *longJump = (vl_test_xoshiro_matrix *) vlMemAlloc(sizeof(vl_test_xoshiro_matrix));
+    vlTestXoshiroJumpMatrix(jump, 128);
+    vlTestXoshiroJumpMatrix(longJump, 192);
+
+    vl_rand_xoshiro rand, stream;
+    vlRandXoshiroInit(&rand, 0);
+
+    //Each lane starts exactly 2^128 steps after the one before it.
+    vl_bool_t result = VL_TRUE;
+    for (int lane = 0; lane + 1 < VL_RAND_XOSHIRO_LANES && result; lane++) {
+        vl_uint64_t s[4], next[4], expected[4];
+        vlTestXoshiroLane(&rand, lane, s);
+        vlTestXoshiroLane(&rand, lane + 1, next);
+        vlTestXoshiroApply(jump, s, expected);
+        result = memcmp(next, expected, sizeof(next)) == 0;
+    }
+
+    //Splitting hands out the current state and moves every lane 2^192 steps ahead, twice in a row.
+    for (int split = 0; split < 2 && result; split++) {
+        const vl_rand_xoshiro before = rand;
+        vlRandXoshiroSplit(&rand, &stream);
+        result = memcmp(&stream, &before, sizeof(before)) == 0;
+        for (int lane = 0; lane < VL_RAND_XOSHIRO_LANES && result; lane++) {
+            vl_uint64_t s[4], jumped[4], expected[4];
+            vlTestXoshiroLane(&before, lane, s);
+            vlTestXoshiroLane(&rand, lane, jumped);
+            vlTestXoshiroApply(longJump, s, expected);
+            result = memcmp(jumped, expected, sizeof(jumped)) == 0;
+        }
+    }
+
+    vlMemFree((vl_memory *) longJump);
+    vlMemFree((vl_memory *) jump);
+    return result;
+}
+
+vl_bool_t vlTestRandomXoshiroQuality(void) {
+    const vl_memsize_t len = VL_TEST_XOSHIRO_QUALITY_BYTES;
+    vl_usmall_t *bytes = (vl_usmall_t *) vlMemAlloc(len);
+    vl_rand_xoshiro rand, other;
+    vlRandXoshiroInit(&rand, 42);
+    vlRandXoshiroFill(&rand, bytes, len);
+
+    //Chi-square over single bytes and over adjacent byte pairs; bounds are about six standard deviations out.
+    vl_uint32_t *counts = (vl_uint32_t *) vlMemAlloc(sizeof(vl_uint32_t) * 65536);
+    memset(counts, 0, sizeof(vl_uint32_t) * 256);
+    for (vl_memsize_t i = 0; i < len; i++)
+        counts[bytes[i]]++;
+    double chi = 0.0, expected = (double) len / 256.0;
+    for (int i = 0; i < 256; i++)
+        chi += ((double) counts[i] - expected) * ((double) counts[i] - expected) / expected;
+    vl_bool_t result = chi < 255.0 + 6.0 * sqrt(2.0 * 255.0);
+
+    memset(counts, 0, sizeof(vl_uint32_t) * 65536);
+    for (vl_memsize_t i = 0; i + 1 < len; i += 2)
+        counts[bytes[i] | (bytes[i + 1] << 8)]++;
+    chi = 0.0;
+    expected = (double) (len / 2) / 65536.0;
+    for (int i = 0; i < 65536; i++)
+        chi += ((double) counts[i] - expected) * ((double) counts[i] - expected) / expected;
+    result = result && chi < 65535.0 + 6.0 * sqrt(2.0 * 65535.0);
+
+    //Every bit position of the 64-bit outputs is set about half the time.
+    const vl_memsize_t words = len / 8;
+    for (int bit = 0; bit < 64 && result; bit++) {
+        vl_memsize_t ones = 0;
+        for (vl_memsize_t i = 0; i < words; i++) {
+            vl_uint64_t w;
+            memcpy(&w, bytes + i * 8, sizeof(w));
+            ones += (w >> bit) & 1u;
+        }
+        result = fabs((double) ones - (double) words / 2.0) < 6.0 * sqrt((double) words) / 2.0;
+    }
+
+    //Doubles from two split streams: uniform mean and variance, and no correlation between the streams.
+    vl_float64_t *a = (vl_float64_t *) bytes;
+    vl_float64_t *b = (vl_float64_t *) vlMemAlloc(len);
+    const vl_dsidx_t n = (vl_dsidx_t) (len / sizeof(vl_float64_t));
+    vlRandXoshiroSplit(&rand, &other);
+    vlRandXoshiroFillD(&rand, a, n);
+    vlRandXoshiroFillD(&other, b, n);
+    double sumA = 0.0, sumSqA = 0.0, sumB = 0.0, sumSqB = 0.0, sumAB = 0.0;
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        result = result && a[i] >= 0.0 && a[i] < 1.0;
+        sumA += a[i];
+        sumSqA += a[i] * a[i];
+        sumB += b[i];
+        sumSqB += b[i] * b[i];
+        sumAB += a[i] * b[i];
+    }
+    const double meanA = sumA / n, meanB = sumB / n;
+    const double varA = sumSqA / n - meanA * meanA, varB = sumSqB / n - meanB * meanB;
+    const double correlation = (sumAB / n - meanA * meanB) / sqrt(varA * varB);
+    result = result && fabs(meanA - 0.5) < 6.0 * sqrt(1.0 / 12.0 / n);
+    result = result && fabs(varA - 1.0 / 12.0) < 0.001;
+    result = result && fabs(correlation) < 6.0 / sqrt((double) n);
+
+    //Floats stay in [0, 1) and fill all 23 bits of their fraction.
+    vl_float32_t *f = (vl_float32_t *) b;
+    vlRandXoshiroFillF(&rand, f, n);
+    vl_uint32_t fractionBits = 0;
+    for (vl_dsidx_t i = 0; i < n && result; i++) {
+        result = f[i] >= 0.0f && f[i] < 1.0f;
+        fractionBits |= (vl_uint32_t) (f[i] * (vl_float32_t) (1u << 23));
+    }
+    result = result && fractionBits == 0x7FFFFFu;
+
+    vlMemFree((vl_memory *) b);
+    vlMemFree((vl_memory *) counts);
+    vlMemFree((vl_memory *) bytes);
+    return result;
+}
+
+vl_bool_t vlTestRandomXoshiroBenchmark(void) {
+    const vl_memsize_t len = VL_TEST_XOSHIRO_BENCH_BYTES;
+    void *mem = vlMemAlloc(len);
+    vl_rand splitmix = vlRandInit();
+    vl_rand_xoshiro rand;
+    vlRandXoshiroInit(&rand, splitmix);
+
+    //vlRandFill is a single splitmix64 stream and does not depend on the SIMD backend.
+    const double totalBytes = (double) len * VL_TEST_XOSHIRO_BENCH_REPEAT;
+    vl_ularge_t start = vlThreadMonotonicNano();
+    for (int r = 0; r < VL_TEST_XOSHIRO_BENCH_REPEAT; r++)
+        vlRandFill(&splitmix, mem, len);
+    vl_ularge_t nanos = vlThreadMonotonicNano() - start;
+    printf("vlRandFill (splitmix64): %.2f GB/s\n", totalBytes / (double) (nanos ? nanos : 1));
+
+    printf("vlRandXoshiro over %d MB, GB/s:\n%-10s%12s%12s%12s\n", (int) (len / VL_MB(1)), "", "Bytes", "Floats",
+           "Doubles");
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+        printf("%-10s", vlSIMDFunctions.backend_name);
+
+        for (int kind = 0; kind < 3; kind++) {
+            start = vlThreadMonotonicNano();
+            for (int r = 0; r < VL_TEST_XOSHIRO_BENCH_REPEAT; r++) {
+                if (kind == 0)
+                    vlRandXoshiroFill(&rand, mem, len);
+                else if (kind == 1)
+                    vlRandXoshiroFillF(&rand, (vl_float32_t *) mem, (vl_dsidx_t) (len / sizeof(vl_float32_t)));
+                else
+                    vlRandXoshiroFillD(&rand, (vl_float64_t *) mem, (vl_dsidx_t) (len / sizeof(vl_float64_t)));
+            }
+            nanos = vlThreadMonotonicNano() - start;
+            printf("%12.2f", totalBytes / (double) (nanos ? nanos : 1));
+        }
+        printf("\n");
+    }
+    vlTestXoshiroRestoreBackend();
+
+    vlMemFree((vl_memory *) mem);
+    return VL_TRUE;
+}
+
+#define VL_TEST_DIST_SAMPLES 1000000
+#define VL_TEST_DIST_BENCH_SAMPLES (1 << 22)
+
+vl_bool_t vlTestRandomBounded(void) {
+    vl_rand rand = 7;
+    vl_bool_t result = vlRandBoundedU32(&rand, 0) == 0 && vlRandBoundedU64(&rand, 0) == 0;
+
+    //Every value stays below its bound, including bounds at the edges of the range.
+    const vl_uint32_t bounds32[] = {1, 2, 3, 7, 1000, 0x80000001u, 0xFFFFFFFFu};
+    for (int b = 0; b < 7 && result; b++)
+        for (int i = 0; i < 10000 && result; i++)
+            result = vlRandBoundedU32(&rand, bounds32[b]) < bounds32[b];
+    const vl_uint64_t bounds64[] = {1, 3, 0x100000001ull, 0x8000000000000001ull, 0xFFFFFFFFFFFFFFFFull};
+    for (int b = 0; b < 5 && result; b++)
+        for (int i = 0; i < 10000 && result; i++)
+            result = vlRandBoundedU64(&rand, bounds64[b]) < bounds64[b];
+
+    //With bound 3 * 2^30, modulo reduction would pick values below 2^30 half the time; unbiased gives one third.
+    vl_uint32_t *values = (vl_uint32_t *) vlMemAlloc(sizeof(vl_uint32_t) * VL_TEST_DIST_SAMPLES);
+    vlRandBoundedFillU32(&rand, values, VL_TEST_DIST_SAMPLES, 3u << 30);
+    vl_dsidx_t low = 0;
+    for (vl_dsidx_t i = 0; i < VL_TEST_DIST_SAMPLES; i++)
+        low += values[i] < (1u << 30);
+    result = result && fabs((double) low / VL_TEST_DIST_SAMPLES - 1.0 / 3.0) < 0.003;
+
+    //Chi-square over a small bound, with an odd count so the single trailing value is covered.
+    vl_dsidx_t counts[6] = {0};
+    vlRandBoundedFillU32(&rand, values, VL_TEST_DIST_SAMPLES - 1, 6);
+    for (vl_dsidx_t i = 0; i < VL_TEST_DIST_SAMPLES - 1; i++)
+        counts[values[i]]++;
+    double chi = 0.0;
+    const double expected = (VL_TEST_DIST_SAMPLES - 1) / 6.0;
+    for (int i = 0; i < 6; i++)
+        chi += ((double) counts[i] - expected) * ((double) counts[i] - expected) / expected;
+    result = result && chi < 30.0;
+
+    vlMemFree((vl_memory *) values);
+    return result;
+}
+
+static int vlTestRandomCompareF64(const void *a, const void *b) {
+    const vl_float64_t x = *(const vl_float64_t *) a, y = *(const vl_float64_t *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Kolmogorov-Smirnov statistic of sorted samples against a CDF, scaled by sqrt(n).
+ */
+static double vlTestRandomKS(vl_float64_t *samples, vl_dsidx_t n, double (*cdf)(double)) {
+    qsort(samples, n, sizeof(vl_float64_t), vlTestRandomCompareF64);
+    double d = 0.0;
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        const double f = cdf(samples[i]);
+        d = fmax(d, fmax(fabs(f - (double) i / n), fabs((double) (i + 1) / n - f)));
+    }
+    return d * sqrt((double) n);
+}
+
+static double vlTestRandomNormalCDF(double x) { return 0.5 * erfc(-x / sqrt(2.0)); }
+
+static double vlTestRandomExponentialCDF(double x) { return x < 0.0 ? 0.0 : 1.0 - exp(-x); }
+
+vl_bool_t vlTestRandomNormalExponential(void) {
+    vl_float64_t *samples = (vl_float64_t *) vlMemAlloc(sizeof(vl_float64_t) * VL_TEST_DIST_SAMPLES);
+    vl_rand rand = 99;
+    const vl_dsidx_t n = VL_TEST_DIST_SAMPLES;
+
+    //Normal: moments, the mass beyond the tail start (reached only via the tail path), and a KS test; 1.95 is p=0.001.
+    vlRandNormalFill(&rand, samples, n, 0.0, 1.0);
+    double sum = 0.0, sumSq = 0.0;
+    vl_dsidx_t beyond = 0;
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        sum += samples[i];
+        sumSq += samples[i] * samples[i];
+        beyond += fabs(samples[i]) > 3.442619855899;
+    }
+    vl_bool_t result = fabs(sum / n) < 0.006 && fabs(sumSq / n - 1.0) < 0.01;
+    const double tailMass = erfc(3.442619855899 / sqrt(2.0));
+    result = result && fabs((double) beyond - tailMass * n) < 6.0 * sqrt(tailMass * n);
+    result = result && vlTestRandomKS(samples, n, vlTestRandomNormalCDF) < 1.95;
+
+    //Shifted and scaled fill.
+    vlRandNormalFill(&rand, samples, n, 10.0, 2.0);
+    sum = sumSq = 0.0;
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        sum += samples[i];
+        sumSq += (samples[i] - 10.0) * (samples[i] - 10.0);
+    }
+    result = result && fabs(sum / n - 10.0) < 0.012 && fabs(sumSq / n - 4.0) < 0.04;
+
+    //Exponential: mean, tail mass beyond the ziggurat's tail start, and KS against rate 1; then a rate-4 fill.
+    vlRandExponentialFill(&rand, samples, n, 1.0);
+    sum = 0.0;
+    beyond = 0;
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        result = result && samples[i] >= 0.0;
+        sum += samples[i];
+        beyond += samples[i] > 5.0;
+    }
+    result = result && fabs(sum / n - 1.0) < 0.006;
+    result = result && fabs((double) beyond - exp(-5.0) * n) < 6.0 * sqrt(exp(-5.0) * n);
+    result = result && vlTestRandomKS(samples, n, vlTestRandomExponentialCDF) < 1.95;
+
+    vlRandExponentialFill(&rand, samples, n, 4.0);
+    sum = 0.0;
+    for (vl_dsidx_t i = 0; i < n; i++)
+        sum += samples[i];
+    result = result && fabs(sum / n - 0.25) < 0.0015;
+
+    vlMemFree((vl_memory *) samples);
+    return result;
+}
+
+vl_bool_t vlTestRandomShuffle(void) {
+    vl_rand rand = 3;
+
+    //Shuffling keeps every element, for sizes that exercise the swap buffer's chunking.
+    vl_bool_t result = VL_TRUE;
+    const vl_memsize_t sizes[] = {1, 4, 8, 100};
+    for (int s = 0; s < 4 && result; s++) {
+        const vl_dsidx_t count = 250;
+        vl_usmall_t *data = (vl_usmall_t *) vlMemAlloc(sizes[s] * count);
+        for (vl_dsidx_t i = 0; i < count; i++)
+            memset(data + i * sizes[s], (int) i, sizes[s]);
+        vlRandShuffle(&rand, data, sizes[s], count);
+
+        vl_dsidx_t seen[250] = {0};
+        for (vl_dsidx_t i = 0; i < count && result; i++) {
+            const vl_usmall_t *elem = data + i * sizes[s];
+            for (vl_memsize_t b = 1; b < sizes[s] && result; b++)
+                result = elem[b] == elem[0];
+            seen[elem[0]]++;
+        }
+        for (vl_dsidx_t i = 0; i < count && result; i++)
+            result = seen[i] == 1;
+        vlMemFree((vl_memory *) data);
+    }
+
+    //All 24 orders of four elements come up equally often.
+    vl_dsidx_t perms[256] = {0};
+    const int trials = 240000;
+    for (int t = 0; t < trials; t++) {
+        vl_uint8_t v[4] = {0, 1, 2, 3};
+        vlRandShuffle(&rand, v, 1, 4);
+        perms[v[0] | (v[1] << 2) | (v[2] << 4) | (v[3] << 6)]++;
+    }
+    double chi = 0.0;
+    int distinct = 0;
+    for (int i = 0; i < 256; i++) {
+        if (perms[i] == 0)
+            continue;
+        distinct++;
+        chi += ((double) perms[i] - trials / 24.0) * ((double) perms[i] - trials / 24.0) / (trials / 24.0);
+    }
+    vlRandShuffle(&rand, NULL, 4, 0);
+    return result && distinct == 24 && chi < 60.0;
+}
+
+vl_bool_t vlTestRandomReservoir(void) {
+    vl_rand rand = 11;
+    vl_uint32_t src[1000], dst[1000];
+    for (vl_uint32_t i = 0; i < 1000; i++)
+        src[i] = i;
+
+    //Small or empty requests copy what exists.
+    vl_bool_t result = vlRandReservoir(&rand, src, sizeof(vl_uint32_t), 10, dst, 20) == 10;
+    result = result && memcmp(src, dst, sizeof(vl_uint32_t) * 10) == 0;
+    result = result && vlRandReservoir(&rand, src, sizeof(vl_uint32_t), 10, dst, 0) == 0;
+
+    //Each element of 1000 is picked in about k/n of the trials, and samples never repeat an element.
+    const vl_dsidx_t k = 50;
+    const int trials = 20000;
+    vl_dsidx_t *hits = (vl_dsidx_t *) vlMemAlloc(sizeof(vl_dsidx_t) * 1000);
+    memset(hits, 0, sizeof(vl_dsidx_t) * 1000);
+    for (int t = 0; t < trials && result; t++) {
+        result = vlRandReservoir(&rand, src, sizeof(vl_uint32_t), 1000, dst, k) == k;
+        vl_uint8_t picked[1000] = {0};
+        for (vl_dsidx_t i = 0; i < k && result; i++) {
+            result = dst[i] < 1000 && !picked[dst[i]];
+            picked[dst[i]] = 1;
+            hits[dst[i]]++;
+        }
+    }
+    const double expected = (double) trials * k / 1000.0;
+    double chi = 0.0;
+    for (int i = 0; i < 1000; i++)
+        chi += ((double) hits[i] - expected) * ((double) hits[i] - expected) / expected;
+    result = result && chi < 999.0 + 6.0 * sqrt(2.0 * 999.0);
+
+    vlMemFree((vl_memory *) hits);
+    return result;
+}
+
+vl_bool_t vlTestRandomAlias(void) {
+    vl_rand rand = 5;
+    vl_rand_alias table;
+
+    //Invalid weights are rejected and leave a table that is safe to free.
+    const vl_float64_t negative[] = {1.0, -1.0};
+    const vl_float64_t zeros[] = {0.0, 0.0};
+    const vl_float64_t infinite[] = {1.0, HUGE_VAL};
+    vl_bool_t result = !vlRandAliasInit(&table, negative, 2);
+    result = result && !vlRandAliasInit(&table, zeros, 2);
+    result = result && !vlRandAliasInit(&table, infinite, 2);
+    result = result && !vlRandAliasInit(&table, NULL, 0);
+    vlRandAliasFree(&table);
+
+    //Sampled frequencies follow the weights; zero weights are never drawn.
+    const vl_float64_t weights[] = {1.0, 0.0, 2.0, 3.0, 4.0, 0.0, 0.5, 9.5};
+    const vl_dsidx_t count = 8;
+    const double total = 20.0;
+    result = result && vlRandAliasInit(&table, weights, count);
+
+    vl_dsidx_t *samples = (vl_dsidx_t *) vlMemAlloc(sizeof(vl_dsidx_t) * VL_TEST_DIST_SAMPLES);
+    vlRandAliasFill(&table, &rand, samples, VL_TEST_DIST_SAMPLES);
+    vl_dsidx_t hits[8] = {0};
+    for (vl_dsidx_t i = 0; i < VL_TEST_DIST_SAMPLES && result; i++) {
+        result = samples[i] < count;
+        hits[samples[i]]++;
+    }
+    for (vl_dsidx_t i = 0; i < count && result; i++) {
+        const double p = weights[i] / total;
+        const double sigma = sqrt(VL_TEST_DIST_SAMPLES * p * (1.0 - p));
+        result = weights[i] == 0.0 ? hits[i] == 0 : fabs(hits[i] - VL_TEST_DIST_SAMPLES * p) < 6.0 * sigma;
+    }
+
+    //A single weight always yields index 0.
+    vlRandAliasFree(&table);
+    result = result && vlRandAliasInit(&table, weights + 2, 1) && vlRandAliasSample(&table, &rand) == 0;
+    vlRandAliasFree(&table);
+
+    vlMemFree((vl_memory *) samples);
+    return result;
+}
+
+/**
+ * Prints millions of samples per second for `run`, which generates `n` samples.
+ */
+static void vlTestRandomBenchRow(const char *name, void (*run)(vl_rand *, void *, vl_dsidx_t), void *buffer) {
+    vl_rand rand = 1;
+    const vl_dsidx_t n = VL_TEST_DIST_BENCH_SAMPLES;
+    run(&rand, buffer, n / 16);
+    const vl_ularge_t start = vlThreadMonotonicNano();
+    run(&rand, buffer, n);
+    const vl_ularge_t nanos = vlThreadMonotonicNano() - start;
+    printf("%-24s%10.1f\n", name, (double) n * 1000.0 / (double) (nanos ? nanos : 1));
+}
+
+static void vlTestRandomBenchModulo(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vl_uint32_t *dst = (vl_uint32_t *) buffer;
+    for (vl_dsidx_t i = 0; i < n; i++)
+        dst[i] = vlRandUInt32(rand) % 1000003u;
+}
+
+static void vlTestRandomBenchBounded(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vl_uint32_t *dst = (vl_uint32_t *) buffer;
+    for (vl_dsidx_t i = 0; i < n; i++)
+        dst[i] = vlRandBoundedU32(rand, 1000003u);
+}
+
+static void vlTestRandomBenchBoundedFill(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vlRandBoundedFillU32(rand, (vl_uint32_t *) buffer, n, 1000003u);
+}
+
+static void vlTestRandomBenchBoxMuller(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vl_float64_t *dst = (vl_float64_t *) buffer;
+    for (vl_dsidx_t i = 0; i + 1 < n; i += 2) {
+        const double u1 = 1.0 - vlRandD(rand), u2 = vlRandD(rand);
+        const double r = sqrt(-2.0 * log(u1));
+        dst[i] = r * cos(6.283185307179586 * u2);
+        dst[i + 1] = r * sin(6.283185307179586 * u2);
+    }
+}
+
+static void vlTestRandomBenchNormal(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vlRandNormalFill(rand, (vl_float64_t *) buffer, n, 0.0, 1.0);
+}
+
+static void vlTestRandomBenchNegLog(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vl_float64_t *dst = (vl_float64_t *) buffer;
+    for (vl_dsidx_t i = 0; i < n; i++)
+        dst[i] = -log(1.0 - vlRandD(rand));
+}
+
+static void vlTestRandomBenchExponential(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vlRandExponentialFill(rand, (vl_float64_t *) buffer, n, 1.0);
+}
+
+static void vlTestRandomBenchShuffle(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vlRandShuffle(rand, buffer, sizeof(vl_uint32_t), n);
+}
+
+static void vlTestRandomBenchReservoir(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    //Draw 1000 of n elements; the rate counts source elements covered.
+    vl_uint32_t sample[1000];
+    vlRandReservoir(rand, buffer, sizeof(vl_uint32_t), n, sample, 1000);
+}
+
+static vl_rand_alias vlTestRandomBenchAliasTable;
+
+static void vlTestRandomBenchAlias(vl_rand *rand, void *buffer, vl_dsidx_t n) {
+    vlRandAliasFill(&vlTestRandomBenchAliasTable, rand, (vl_dsidx_t *) buffer, n);
+}
+
+vl_bool_t vlTestRandomDistributionBenchmark(void) {
+    void *buffer = vlMemAlloc(sizeof(vl_float64_t) * VL_TEST_DIST_BENCH_SAMPLES);
+    memset(buffer, 0, sizeof(vl_float64_t) * VL_TEST_DIST_BENCH_SAMPLES);
+
+    vl_float64_t weights[1000];
+    vl_rand rand = 2;
+    for (int i = 0; i < 1000; i++)
+        weights[i] = vlRandD(&rand);
+    vlRandAliasInit(&vlTestRandomBenchAliasTable, weights, 1000);
+
+    printf("Distribution sampling, millions of samples per second:\n");
+    vlTestRandomBenchRow("Modulo (biased)", vlTestRandomBenchModulo, buffer);
+    vlTestRandomBenchRow("vlRandBoundedU32", vlTestRandomBenchBounded, buffer);
+    vlTestRandomBenchRow("vlRandBoundedFillU32", vlTestRandomBenchBoundedFill, buffer);
+    vlTestRandomBenchRow("Box-Muller", vlTestRandomBenchBoxMuller, buffer);
+    vlTestRandomBenchRow("vlRandNormalFill", vlTestRandomBenchNormal, buffer);
+    vlTestRandomBenchRow("-log(1 - U)", vlTestRandomBenchNegLog, buffer);
+    vlTestRandomBenchRow("vlRandExponentialFill", vlTestRandomBenchExponential, buffer);
+    vlTestRandomBenchRow("vlRandShuffle", vlTestRandomBenchShuffle, buffer);
+    vlTestRandomBenchRow("vlRandReservoir", vlTestRandomBenchReservoir, buffer);
+    vlTestRandomBenchRow("vlRandAliasFill (1000)", vlTestRandomBenchAlias, buffer);
+
+    vlRandAliasFree(&vlTestRandomBenchAliasTable);
+    vlMemFree((vl_memory *) buffer);
+    return VL_TRUE;
+}
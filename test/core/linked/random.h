@@ -11,6 +11,36 @@ extern "C" {
 vl_bool_t vlTestRandomVec4f(void);
 vl_bool_t vlTestRandomFill(vl_memsize_t size);
 
+//Fill bytes, floats and doubles from the multi-lane xoshiro state on every backend; compare with a scalar reference.
+vl_bool_t vlTestRandomXoshiroReference(void);
+
+//Check lane spacing and stream splits against jump matrices built by repeated squaring of the one-step map.
+vl_bool_t vlTestRandomXoshiroJump(void);
+
+//Byte and byte-pair chi-square, per-bit balance, moments and cross-stream correlation of 16MB of xoshiro output.
+vl_bool_t vlTestRandomXoshiroQuality(void);
+
+//Time bulk bytes, floats and doubles on every available backend next to vlRandFill.
+vl_bool_t vlTestRandomXoshiroBenchmark(void);
+
+//Check bounded integers stay in range, avoid modulo bias at a large bound and pass chi-square at a small one.
+vl_bool_t vlTestRandomBounded(void);
+
+//Moments, tail mass and Kolmogorov-Smirnov tests for the ziggurat normal and exponential samplers.
+vl_bool_t vlTestRandomNormalExponential(void);
+
+//Shuffle arrays of several element sizes and check nothing is lost; check all orders of four come up evenly.
+vl_bool_t vlTestRandomShuffle(void);
+
+//Reservoir-sample 50 of 1000 many times; check sizes, no repeats and even inclusion rates.
+vl_bool_t vlTestRandomReservoir(void);
+
+//Reject invalid weights, then check alias-table sample frequencies against the weights.
+vl_bool_t vlTestRandomAlias(void);
+
+//Time each sampler next to the naive method it replaces.
+vl_bool_t vlTestRandomDistributionBenchmark(void);
+
 #ifdef __cplusplus
 }
 #endif
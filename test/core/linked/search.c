@@ -0,0 +1,261 @@
+#include "search.h"
+#include <vl/vl_search.h>
+#include <vl/vl_set.h>
+#include <vl/vl_sort.h>
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_simd.h>
+#include <vl/vl_thread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_SEARCH_MAX_COUNT 5000
+#define VL_TEST_SEARCH_BATCH_COUNT 1000
+#define VL_TEST_SEARCH_PROBES 256
+#define VL_TEST_SEARCH_BENCH_MAX (1 << 20)
+#define VL_TEST_SEARCH_BENCH_QUERIES (1 << 18)
+
+/**
+ * Maps a key to an unsigned integer with the same total order, independently of the library's encoding.
+ */
+static vl_uint64_t vlTestSearchOrderKey(const void *key, vl_numtype type) {
+    const vl_uint16_t size = vlNumTypeSizeof(type);
+    const vl_uint64_t top = (vl_uint64_t) 1 << (size * 8 - 1);
+    const vl_uint64_t mask = top | (top - 1);
+    vl_uint64_t bits = 0;
+
+    switch (size) {
+        case 1: { vl_uint8_t v; memcpy(&v, key, 1); bits = v; break; }
+        case 2: { vl_uint16_t v; memcpy(&v, key, 2); bits = v; break; }
+        case 4: { vl_uint32_t v; memcpy(&v, key, 4); bits = v; break; }
+        default: memcpy(&bits, key, 8); break;
+    }
+
+    if (VL_NUMTYPE_INFO[type].isFloating)
+        return (bits & top) ? (~bits & mask) : (bits | top);
+    if (VL_NUMTYPE_INFO[type].isSigned)
+        return bits ^ top;
+    return bits;
+}
+
+static vl_dsidx_t vlTestSearchReference(const void *keys, vl_dsidx_t count, vl_numtype type, const void *key,
+                                        vl_bool_t inclusive) {
+    const vl_uint16_t size = vlNumTypeSizeof(type);
+    const vl_uint64_t probe = vlTestSearchOrderKey(key, type);
+    vl_dsidx_t rank = 0;
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        const vl_uint64_t value = vlTestSearchOrderKey((const vl_usmall_t *) keys + i * size, type);
+        rank += inclusive ? value <= probe : value < probe;
+    }
+    return rank;
+}
+
+/**
+ * Fills sorted random keys. With `duplicates` set, every key is copied from one of the first five.
+ */
+static void vlTestSearchFill(void *keys, vl_dsidx_t count, vl_numtype type, vl_bool_t duplicates, vl_rand *rand) {
+    const vl_uint16_t size = vlNumTypeSizeof(type);
+    vlRandFill(rand, keys, (vl_ularge_t) size * count);
+    if (duplicates && count > 5)
+        for (vl_dsidx_t i = 5; i < count; i++)
+            memcpy((vl_usmall_t *) keys + i * size, (vl_usmall_t *) keys + (vlRandUInt32(rand) % 5) * size, size);
+    vlSortRadixKeys(keys, count, type);
+}
+
+static vl_bool_t vlTestSearchBoundsPass(vl_rand *rand) {
+    const vl_dsidx_t sizes[] = {0, 1, 2, 3, 15, 16, 17, 31, 33, 100, 1000, VL_TEST_SEARCH_MAX_COUNT};
+    vl_usmall_t *keys = (vl_usmall_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_SEARCH_MAX_COUNT);
+    vl_bool_t result = VL_TRUE;
+
+    for (int type = VL_NUMTYPE_UINT8; type <= VL_NUMTYPE_FLOAT64 && result; type++) {
+        const vl_uint16_t size = vlNumTypeSizeof((vl_numtype) type);
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            for (int duplicates = 0; duplicates < 2 && result; duplicates++) {
+                const vl_dsidx_t count = sizes[s];
+                vlTestSearchFill(keys, count, (vl_numtype) type, (vl_bool_t) duplicates, rand);
+
+                //Alternate between stored keys and random ones.
+                for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_PROBES && result; q++) {
+                    vl_uint64_t probe = vlRandNext(rand);
+                    if (count > 0 && (q & 1))
+                        memcpy(&probe, keys + (vlRandUInt32(rand) % count) * size, size);
+
+                    const vl_dsidx_t lower = vlTestSearchReference(keys, count, (vl_numtype) type, &probe, VL_FALSE);
+                    const vl_dsidx_t upper = vlTestSearchReference(keys, count, (vl_numtype) type, &probe, VL_TRUE);
+                    vl_dsidx_t first;
+
+                    result = vlSearchLowerBound(keys, count, (vl_numtype) type, &probe) == lower &&
+                             vlSearchUpperBound(keys, count, (vl_numtype) type, &probe) == upper &&
+                             vlSearchEqualRange(keys, count, (vl_numtype) type, &probe, &first) == upper - lower &&
+                             first == lower;
+                }
+            }
+        }
+    }
+
+    vl_dsidx_t first = 0;
+    result = result && vlSearchLowerBound(keys, 1, VL_NUMTYPE_MAX, keys) == VL_STRUCTURE_INDEX_MAX &&
+             vlSearchEqualRange(keys, 1, VL_NUMTYPE_MAX, keys, &first) == 0 && first == VL_STRUCTURE_INDEX_MAX;
+
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+vl_bool_t vlTestSearchBounds() {
+    vl_rand rand = vlRandInit();
+    //First with whatever backend is active, then the best one, so both the portable and SIMD rank kernels run.
+    vl_bool_t result = vlTestSearchBoundsPass(&rand);
+    vlSIMDInit();
+    return result && vlTestSearchBoundsPass(&rand);
+}
+
+vl_bool_t vlTestSearchBatch() {
+    const vl_dsidx_t sizes[] = {0, 1, 2, 17, 1000, VL_TEST_SEARCH_MAX_COUNT};
+    const vl_dsidx_t queryCounts[] = {0, 1, 15, 16, 17, VL_TEST_SEARCH_BATCH_COUNT};
+    vl_usmall_t *keys = (vl_usmall_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_SEARCH_MAX_COUNT);
+    vl_usmall_t *queries = (vl_usmall_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_SEARCH_BATCH_COUNT);
+    vl_dsidx_t *results = (vl_dsidx_t *) vlMemAlloc(sizeof(vl_dsidx_t) * VL_TEST_SEARCH_BATCH_COUNT);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (int type = VL_NUMTYPE_UINT8; type <= VL_NUMTYPE_FLOAT64 && result; type++) {
+        const vl_uint16_t size = vlNumTypeSizeof((vl_numtype) type);
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            vlTestSearchFill(keys, sizes[s], (vl_numtype) type, (vl_bool_t) (s & 1), &rand);
+            for (size_t c = 0; c < sizeof(queryCounts) / sizeof(queryCounts[0]) && result; c++) {
+                const vl_dsidx_t numQueries = queryCounts[c];
+                vlRandFill(&rand, queries, (vl_ularge_t) size * numQueries);
+                for (vl_dsidx_t q = 0; q < numQueries && sizes[s] > 0; q += 2)
+                    memcpy(queries + q * size, keys + (vlRandUInt32(&rand) % sizes[s]) * size, size);
+
+                result = vlSearchLowerBoundBatch(keys, sizes[s], (vl_numtype) type, queries, numQueries, results);
+                for (vl_dsidx_t q = 0; q < numQueries && result; q++)
+                    result = results[q] == vlSearchLowerBound(keys, sizes[s], (vl_numtype) type, queries + q * size);
+
+                result = result &&
+                         vlSearchUpperBoundBatch(keys, sizes[s], (vl_numtype) type, queries, numQueries, results);
+                for (vl_dsidx_t q = 0; q < numQueries && result; q++)
+                    result = results[q] == vlSearchUpperBound(keys, sizes[s], (vl_numtype) type, queries + q * size);
+            }
+        }
+    }
+
+    result = result && !vlSearchLowerBoundBatch(keys, 1, VL_NUMTYPE_MAX, queries, 1, results);
+
+    vlMemFree((vl_memory *) results);
+    vlMemFree((vl_memory *) queries);
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+vl_bool_t vlTestSearchEytzinger() {
+    const vl_dsidx_t sizes[] = {0, 1, 2, 3, 7, 8, 100, 1023, 1024, VL_TEST_SEARCH_MAX_COUNT};
+    vl_usmall_t *keys = (vl_usmall_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_SEARCH_MAX_COUNT);
+    vl_usmall_t *layout = (vl_usmall_t *) vlMemAlloc(sizeof(vl_uint64_t) * VL_TEST_SEARCH_MAX_COUNT);
+    vl_dsidx_t *order = (vl_dsidx_t *) vlMemAlloc(sizeof(vl_dsidx_t) * VL_TEST_SEARCH_MAX_COUNT);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (int type = VL_NUMTYPE_UINT8; type <= VL_NUMTYPE_FLOAT64 && result; type++) {
+        const vl_uint16_t size = vlNumTypeSizeof((vl_numtype) type);
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            const vl_dsidx_t count = sizes[s];
+            vlTestSearchFill(keys, count, (vl_numtype) type, (vl_bool_t) (s & 1), &rand);
+            result = vlSearchEytzingerBuild(keys, count, (vl_numtype) type, layout, order);
+
+            //Every slot holds the key it claims to, and each sorted index appears exactly once.
+            vl_dsidx_t indexSum = 0;
+            for (vl_dsidx_t slot = 0; slot < count && result; slot++) {
+                result = order[slot] < count && memcmp(layout + slot * size, keys + order[slot] * size, size) == 0;
+                indexSum += order[slot];
+            }
+            result = result && indexSum == (count ? count * (count - 1) / 2 : 0);
+
+            for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_PROBES && result; q++) {
+                vl_uint64_t probe = vlRandNext(&rand);
+                if (count > 0 && (q & 1))
+                    memcpy(&probe, keys + (vlRandUInt32(&rand) % count) * size, size);
+
+                const vl_dsidx_t lower = vlSearchLowerBound(keys, count, (vl_numtype) type, &probe);
+                const vl_dsidx_t upper = vlSearchUpperBound(keys, count, (vl_numtype) type, &probe);
+                const vl_dsidx_t lowerSlot = vlSearchEytzingerLowerBound(layout, count, (vl_numtype) type, &probe);
+                const vl_dsidx_t upperSlot = vlSearchEytzingerUpperBound(layout, count, (vl_numtype) type, &probe);
+
+                result = (lowerSlot == count ? lower == count : order[lowerSlot] == lower) &&
+                         (upperSlot == count ? upper == count : order[upperSlot] == upper);
+            }
+        }
+    }
+
+    result = result && !vlSearchEytzingerBuild(keys, 1, VL_NUMTYPE_MAX, layout, NULL);
+
+    vlMemFree((vl_memory *) order);
+    vlMemFree((vl_memory *) layout);
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+static vl_int_t vlTestSearchCompareU32(const void *a, const void *b) {
+    const vl_uint32_t va = *(const vl_uint32_t *) a, vb = *(const vl_uint32_t *) b;
+    return (va > vb) - (va < vb);
+}
+
+vl_bool_t vlTestSearchBenchmark() {
+    vl_uint32_t *keys = (vl_uint32_t *) vlMemAlloc(sizeof(vl_uint32_t) * VL_TEST_SEARCH_BENCH_MAX);
+    vl_uint32_t *layout = (vl_uint32_t *) vlMemAlloc(sizeof(vl_uint32_t) * VL_TEST_SEARCH_BENCH_MAX);
+    vl_uint32_t *queries = (vl_uint32_t *) vlMemAlloc(sizeof(vl_uint32_t) * VL_TEST_SEARCH_BENCH_QUERIES);
+    vl_dsidx_t *results = (vl_dsidx_t *) vlMemAlloc(sizeof(vl_dsidx_t) * VL_TEST_SEARCH_BENCH_QUERIES);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    printf("u32 lookups (%s), ns per query: vl_set, lower bound, batched, Eytzinger\n", vlSIMDInit());
+
+    for (vl_dsidx_t count = 1000; count <= VL_TEST_SEARCH_BENCH_MAX && result; count *= 10) {
+        vl_set *set = vlSetNew(sizeof(vl_uint32_t), vlTestSearchCompareU32);
+        vlRandFill(&rand, keys, sizeof(vl_uint32_t) * count);
+        for (vl_dsidx_t i = 0; i < count; i++)
+            vlSetInsert(set, keys + i);
+        vlSortNumeric(keys, count, VL_NUMTYPE_UINT32);
+        vlSearchEytzingerBuild(keys, count, VL_NUMTYPE_UINT32, layout, NULL);
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES; q++)
+            queries[q] = keys[vlRandUInt32(&rand) % count];
+
+        vl_ularge_t start = vlThreadMonotonicNano();
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES; q++)
+            result &= vlSetFind(set, queries + q) != VL_SET_ITER_INVALID;
+        const vl_ularge_t setNanos = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES; q++)
+            results[q] = vlSearchLowerBound(keys, count, VL_NUMTYPE_UINT32, queries + q);
+        const vl_ularge_t boundNanos = vlThreadMonotonicNano() - start;
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES && result; q++)
+            result = keys[results[q]] == queries[q];
+
+        start = vlThreadMonotonicNano();
+        vlSearchLowerBoundBatch(keys, count, VL_NUMTYPE_UINT32, queries, VL_TEST_SEARCH_BENCH_QUERIES, results);
+        const vl_ularge_t batchNanos = vlThreadMonotonicNano() - start;
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES && result; q++)
+            result = keys[results[q]] == queries[q];
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES; q++)
+            results[q] = vlSearchEytzingerLowerBound(layout, count, VL_NUMTYPE_UINT32, queries + q);
+        const vl_ularge_t eytzingerNanos = vlThreadMonotonicNano() - start;
+        for (vl_dsidx_t q = 0; q < VL_TEST_SEARCH_BENCH_QUERIES && result; q++)
+            result = layout[results[q]] == queries[q];
+
+        printf("  %8d: %7.1f %7.1f %7.1f %7.1f\n", (int) count,
+               (double) setNanos / VL_TEST_SEARCH_BENCH_QUERIES, (double) boundNanos / VL_TEST_SEARCH_BENCH_QUERIES,
+               (double) batchNanos / VL_TEST_SEARCH_BENCH_QUERIES,
+               (double) eytzingerNanos / VL_TEST_SEARCH_BENCH_QUERIES);
+
+        vlSetDelete(set);
+    }
+
+    vlMemFree((vl_memory *) results);
+    vlMemFree((vl_memory *) queries);
+    vlMemFree((vl_memory *) layout);
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
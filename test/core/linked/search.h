@@ -0,0 +1,24 @@
+#ifndef VL_TEST_SEARCH_H
+#define VL_TEST_SEARCH_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Search sorted keys of every type and many lengths, before and after vlSIMDInit; verify bounds against a linear scan.
+VL_TEST_API vl_bool_t vlTestSearchBounds();
+
+//Verify batched lower and upper bounds match one-at-a-time searches, including partial final groups.
+VL_TEST_API vl_bool_t vlTestSearchBatch();
+
+//Build Eytzinger layouts of every type; verify slot order and that bounds map back to the sorted-array bounds.
+VL_TEST_API vl_bool_t vlTestSearchEytzinger();
+
+//Time vlSetFind against sorted-array, batched and Eytzinger lookups on 32-bit keys from 1K keys upward.
+VL_TEST_API vl_bool_t vlTestSearchBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_SEARCH_H
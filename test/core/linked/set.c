@@ -1,5 +1,10 @@
 #include "set.h"
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
 #include <vl/vl_set.h>
+#include <vl/vl_thread.h>
+#include <stdio.h>
+#include <string.h>
 
 vl_bool_t vlTestSetGrowth() {
     const int set_size = 1024;
@@ -74,3 +79,366 @@ vl_bool_t vlTestSetIterate(vl_bool_t reverse) {
 
     return result;
 }
+
+#define VL_TEST_SET_MODEL_SPAN 4096
+
+//The merge/insert gap widens with size; 5000000 shows it clearly but is slow for a default run.
+#ifndef VL_TEST_SET_BENCH_SIZE
+#define VL_TEST_SET_BENCH_SIZE 100000
+#endif
+
+/**
+ * Verifies a set of ints holds exactly the values flagged in `present`, in order, in both directions.
+ */
+static vl_bool_t vlTestSetMatches(vl_set *set, const vl_bool_t *present, int span) {
+    int expected = 0, total = 0;
+    vl_bool_t result = VL_TRUE;
+
+    VL_SET_FOREACH(set, curIter) {
+        const int value = *((int *) vlSetSample(set, curIter));
+        while (expected < span && !present[expected])
+            expected++;
+        result = result && value == expected;
+        expected++;
+        total++;
+    }
+
+    VL_SET_FOREACH_REVERSE(set, curIter) {
+        const int value = *((int *) vlSetSample(set, curIter));
+        result = result && present[value];
+        total--;
+    }
+
+    for (int i = 0; i < span; i++)
+        total -= present[i] ? 1 : 0;
+    return result && total == -(int) set->totalElements;
+}
+
+vl_bool_t vlTestSetBuildSorted() {
+    int *values = (int *) vlMemAlloc(sizeof(int) * VL_TEST_SET_MODEL_SPAN);
+    vl_bool_t *present = (vl_bool_t *) vlMemAlloc(sizeof(vl_bool_t) * VL_TEST_SET_MODEL_SPAN);
+    vl_bool_t result = VL_TRUE;
+
+    vl_set *set = vlSetNew(sizeof(int), vlCompareInt);
+    for (int count = 0; count <= VL_TEST_SET_MODEL_SPAN / 2 && result; count = count * 2 + 1) {
+        //Every third value repeats its predecessor; the repeat is dropped.
+        memset(present, 0, sizeof(vl_bool_t) * VL_TEST_SET_MODEL_SPAN);
+        for (int i = 0; i < count; i++) {
+            values[i] = (i % 3 == 2) ? values[i - 1] : i * 2;
+            present[values[i]] = VL_TRUE;
+        }
+
+        result = vlSetBuildSorted(set, values, count) && vlTestSetMatches(set, present, VL_TEST_SET_MODEL_SPAN);
+        for (int i = 0; i < count && result; i++)
+            result = vlSetFind(set, values + i) != VL_SET_ITER_INVALID;
+
+        //The built tree must stay valid under the usual insert and remove paths.
+        for (int v = 1; v < count * 2 && result; v += 2) {
+            vlSetInsert(set, &v);
+            present[v] = VL_TRUE;
+        }
+        for (int v = 0; v < count * 2 && result; v += 4) {
+            vlSetRemoveElem(set, &v);
+            present[v] = VL_FALSE;
+        }
+        result = result && vlTestSetMatches(set, present, VL_TEST_SET_MODEL_SPAN);
+
+        //Unsorted input is rejected and leaves the set empty.
+        if (count > 2) {
+            values[count / 2] = values[count - 1] + 1;
+            result = result && !vlSetBuildSorted(set, values, count) && set->totalElements == 0;
+            result = result && vlSetFront(set) == VL_SET_ITER_INVALID;
+        }
+    }
+    vlSetDelete(set);
+
+    vlMemFree((vl_memory *) present);
+    vlMemFree((vl_memory *) values);
+    return result;
+}
+
+vl_bool_t vlTestSetAlgebra() {
+    vl_bool_t inA[VL_TEST_SET_MODEL_SPAN], inB[VL_TEST_SET_MODEL_SPAN], expected[VL_TEST_SET_MODEL_SPAN];
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (int round = 0; round < 24 && result; round++) {
+        //Vary the densities, including empty inputs, so every merge branch and drain runs.
+        const vl_uint32_t densityA = round % 4 == 0 ? 0 : vlRandUInt32(&rand) % 100;
+        const vl_uint32_t densityB = round % 5 == 0 ? 0 : vlRandUInt32(&rand) % 100;
+
+        vl_set *a = vlSetNew(sizeof(int), vlCompareInt);
+        vl_set *b = vlSetNew(sizeof(int), vlCompareInt);
+        for (int i = 0; i < VL_TEST_SET_MODEL_SPAN; i++) {
+            inA[i] = vlRandUInt32(&rand) % 100 < densityA;
+            inB[i] = vlRandUInt32(&rand) % 100 < densityB;
+            if (inA[i])
+                vlSetInsert(a, &i);
+            if (inB[i])
+                vlSetInsert(b, &i);
+        }
+
+        for (int op = 0; op < 3 && result; op++) {
+            for (int i = 0; i < VL_TEST_SET_MODEL_SPAN; i++)
+                expected[i] = op == 0 ? inA[i] || inB[i] : op == 1 ? inA[i] && inB[i] : inA[i] && !inB[i];
+
+            vl_set *(*const operation)(vl_set *, vl_set *, vl_set *) =
+                op == 0 ? vlSetUnion : op == 1 ? vlSetIntersection : vlSetDifference;
+
+            //Into a new set.
+            vl_set *dest = operation(a, b, NULL);
+            result = dest != NULL && vlTestSetMatches(dest, expected, VL_TEST_SET_MODEL_SPAN);
+
+            //Into a set that already holds elements, which are kept.
+            vlSetClear(dest);
+            for (int i = round; i < VL_TEST_SET_MODEL_SPAN; i += 97) {
+                vlSetInsert(dest, &i);
+                expected[i] = VL_TRUE;
+            }
+            result = result && operation(a, b, dest) == dest;
+            result = result && vlTestSetMatches(dest, expected, VL_TEST_SET_MODEL_SPAN);
+            vlSetDelete(dest);
+
+            //Into one of the inputs, which is overwritten.
+            vl_set *copy = vlSetClone(a, NULL);
+            for (int i = 0; i < VL_TEST_SET_MODEL_SPAN; i++)
+                expected[i] = op == 0 ? inA[i] || inB[i] : op == 1 ? inA[i] && inB[i] : inA[i] && !inB[i];
+            result = result && operation(copy, b, copy) == copy;
+            result = result && vlTestSetMatches(copy, expected, VL_TEST_SET_MODEL_SPAN);
+            vlSetDelete(copy);
+        }
+
+        vlSetDelete(b);
+        vlSetDelete(a);
+    }
+
+    //Mismatched element sizes are rejected.
+    vl_set *ints = vlSetNew(sizeof(int), vlCompareInt);
+    vl_set *longs = vlSetNew(sizeof(long), vlCompareInt);
+    result = result && vlSetUnion(ints, longs, NULL) == NULL && vlSetUnion(ints, ints, longs) == NULL;
+    vlSetDelete(longs);
+    vlSetDelete(ints);
+    return result;
+}
+
+vl_bool_t vlTestSetAlgebraBenchmark() {
+    const vl_dsidx_t count = VL_TEST_SET_BENCH_SIZE;
+    int *values = (int *) vlMemAlloc(sizeof(int) * count);
+    vl_bool_t result = VL_TRUE;
+
+    //A holds multiples of 2 and B multiples of 3, so a third of B is shared with A.
+    vl_set *a = vlSetNew(sizeof(int), vlCompareInt);
+    vl_set *b = vlSetNew(sizeof(int), vlCompareInt);
+    for (vl_dsidx_t i = 0; i < count; i++)
+        values[i] = (int) i * 2;
+    vlSetBuildSorted(a, values, count);
+    for (vl_dsidx_t i = 0; i < count; i++)
+        values[i] = (int) i * 3;
+    vlSetBuildSorted(b, values, count);
+
+    vl_ularge_t start = vlThreadMonotonicNano();
+    vl_set *merged = vlSetNew(sizeof(int), vlCompareInt);
+    VL_SET_FOREACH(a, curIter) { vlSetInsert(merged, vlSetSample(a, curIter)); }
+    VL_SET_FOREACH(b, curIter) { vlSetInsert(merged, vlSetSample(b, curIter)); }
+    const vl_ularge_t insertUnion = vlThreadMonotonicNano() - start;
+
+    start = vlThreadMonotonicNano();
+    vl_set *unionSet = vlSetUnion(a, b, NULL);
+    const vl_ularge_t mergeUnion = vlThreadMonotonicNano() - start;
+    result = unionSet != NULL && unionSet->totalElements == merged->totalElements;
+    vlSetDelete(merged);
+    vlSetDelete(unionSet);
+
+    start = vlThreadMonotonicNano();
+    vl_set *found = vlSetNew(sizeof(int), vlCompareInt);
+    VL_SET_FOREACH(a, curIter) {
+        const void *sample = vlSetSample(a, curIter);
+        if (vlSetFind(b, sample) != VL_SET_ITER_INVALID)
+            vlSetInsert(found, sample);
+    }
+    const vl_ularge_t insertIntersection = vlThreadMonotonicNano() - start;
+
+    start = vlThreadMonotonicNano();
+    vl_set *intersection = vlSetIntersection(a, b, NULL);
+    const vl_ularge_t mergeIntersection = vlThreadMonotonicNano() - start;
+    result = result && intersection != NULL && intersection->totalElements == found->totalElements;
+    vlSetDelete(found);
+    vlSetDelete(intersection);
+
+    start = vlThreadMonotonicNano();
+    vlSetBuildSorted(a, values, count);
+    const vl_ularge_t build = vlThreadMonotonicNano() - start;
+
+    printf("set algebra on two %d-element sets, ms:\n", (int) count);
+    printf("  %14s %14s %14s\n", "operation", "insert-based", "merge-based");
+    printf("  %14s %14.1f %14.1f\n", "union", insertUnion / 1e6, mergeUnion / 1e6);
+    printf("  %14s %14.1f %14.1f\n", "intersection", insertIntersection / 1e6, mergeIntersection / 1e6);
+    printf("  %14s %14s %14.1f\n", "build sorted", "", build / 1e6);
+
+    vlSetDelete(b);
+    vlSetDelete(a);
+    vlMemFree((vl_memory *) values);
+    return result;
+}
+
+//Define as 10000000 for the deep-tree measurement; the queries reuse the value buffer, so keep it >= 100000.
+#ifndef VL_TEST_SET_RANK_BENCH_SIZE
+#define VL_TEST_SET_RANK_BENCH_SIZE 100000
+#endif
+#ifdef VL_SET_ORDER_STATISTICS
+#define VL_TEST_SET_RANK_BENCH_QUERIES 100000
+#else
+//Without subtree sizes every query scans the set, so only a few are timed.
+#define VL_TEST_SET_RANK_BENCH_QUERIES 16
+#endif
+
+/**
+ * Checks rank, select and range counts of a set of ints against the values flagged in `present`.
+ */
+static vl_bool_t vlTestSetMatchesRanks(vl_set *set, const vl_bool_t *present, int span) {
+    int *prefix = (int *) vlMemAlloc(sizeof(int) * (span + 1));
+    vl_bool_t result = VL_TRUE;
+
+    //prefix[v] counts the flagged values below v, which is the rank of v.
+    prefix[0] = 0;
+    for (int v = 0; v < span; v++)
+        prefix[v + 1] = prefix[v] + (present[v] ? 1 : 0);
+
+    for (int v = 0; v <= span && result; v++) {
+        result = vlSetRank(set, &v) == (vl_dsidx_t) prefix[v];
+        if (v < span && present[v]) {
+            const vl_set_iter iter = vlSetSelect(set, prefix[v]);
+            result = result && iter != VL_SET_ITER_INVALID && *(int *) vlSetSample(set, iter) == v;
+        }
+    }
+    result = result && vlSetSelect(set, prefix[span]) == VL_SET_ITER_INVALID;
+
+    for (int low = 0; low <= span && result; low += 61) {
+        for (int high = 0; high <= span && result; high += 67) {
+            const vl_dsidx_t expected = high > low ? prefix[high] - prefix[low] : 0;
+            result = vlSetCountRange(set, &low, &high) == expected;
+        }
+        result = result && vlSetCountRange(set, &low, NULL) == (vl_dsidx_t) (prefix[span] - prefix[low]);
+        result = result && vlSetCountRange(set, NULL, &low) == (vl_dsidx_t) prefix[low];
+    }
+    result = result && vlSetCountRange(set, NULL, NULL) == set->totalElements;
+
+    vlMemFree((vl_memory *) prefix);
+    return result;
+}
+
+vl_bool_t vlTestSetOrderStatistics() {
+    vl_bool_t *present = (vl_bool_t *) vlMemAlloc(sizeof(vl_bool_t) * VL_TEST_SET_MODEL_SPAN);
+    int *values = (int *) vlMemAlloc(sizeof(int) * VL_TEST_SET_MODEL_SPAN);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    memset(present, 0, sizeof(vl_bool_t) * VL_TEST_SET_MODEL_SPAN);
+    vl_set *set = vlSetNew(sizeof(int), vlCompareInt);
+    result = vlTestSetMatchesRanks(set, present, VL_TEST_SET_MODEL_SPAN);
+
+    //Grow, churn, then shrink the set, so every rotation and removal case updates the sizes.
+    for (int step = 0; step < 30000 && result; step++) {
+        const int phase = step / 10000;
+        const vl_uint32_t roll = vlRandUInt32(&rand) % 4;
+        const vl_bool_t insert = phase == 0 ? roll != 0 : phase == 1 ? roll < 2 : roll == 0;
+        const int value = (int) (vlRandUInt32(&rand) % VL_TEST_SET_MODEL_SPAN);
+
+        if (insert)
+            vlSetInsert(set, &value);
+        else
+            vlSetRemoveElem(set, &value);
+        present[value] = insert;
+
+        if (step % 2500 == 0)
+            result = vlTestSetMatchesRanks(set, present, VL_TEST_SET_MODEL_SPAN);
+    }
+    result = result && vlTestSetMatchesRanks(set, present, VL_TEST_SET_MODEL_SPAN);
+
+    //Sets built in bulk and by merging track sizes too.
+    int count = 0;
+    for (int v = 0; v < VL_TEST_SET_MODEL_SPAN; v++)
+        if (present[v])
+            values[count++] = v;
+    vl_set *built = vlSetNew(sizeof(int), vlCompareInt);
+    result = result && vlSetBuildSorted(built, values, count);
+    result = result && vlTestSetMatchesRanks(built, present, VL_TEST_SET_MODEL_SPAN);
+
+    for (int v = 0; v < VL_TEST_SET_MODEL_SPAN; v += 3) {
+        vlSetInsert(built, &v);
+        present[v] = VL_TRUE;
+    }
+    vl_set *merged = vlSetUnion(set, built, NULL);
+    result = result && merged != NULL && vlTestSetMatchesRanks(merged, present, VL_TEST_SET_MODEL_SPAN);
+
+    vlSetDelete(merged);
+    vlSetDelete(built);
+    vlSetDelete(set);
+    vlMemFree((vl_memory *) values);
+    vlMemFree((vl_memory *) present);
+    return result;
+}
+
+vl_bool_t vlTestSetRankBenchmark() {
+    const vl_dsidx_t count = VL_TEST_SET_RANK_BENCH_SIZE;
+    int *values = (int *) vlMemAlloc(sizeof(int) * count);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (vl_dsidx_t i = 0; i < count; i++)
+        values[i] = (int) i * 2;
+    vl_set *set = vlSetNew(sizeof(int), vlCompareInt);
+    vlSetBuildSorted(set, values, count);
+
+    //Probes fall both on and between elements.
+    for (vl_dsidx_t i = 0; i < VL_TEST_SET_RANK_BENCH_QUERIES; i++)
+        values[i] = (int) (vlRandUInt32(&rand) % (count * 2));
+
+    vl_dsidx_t checksum = 0;
+    vl_ularge_t start = vlThreadMonotonicNano();
+    for (vl_dsidx_t i = 0; i < VL_TEST_SET_RANK_BENCH_QUERIES; i++)
+        checksum += vlSetRank(set, values + i);
+    const vl_ularge_t rankNanos = vlThreadMonotonicNano() - start;
+
+    start = vlThreadMonotonicNano();
+    for (vl_dsidx_t i = 0; i < VL_TEST_SET_RANK_BENCH_QUERIES; i++)
+        checksum -= *(int *) vlSetSample(set, vlSetSelect(set, (vl_dsidx_t) values[i] / 2)) / 2;
+    const vl_ularge_t selectNanos = vlThreadMonotonicNano() - start;
+
+    start = vlThreadMonotonicNano();
+    for (vl_dsidx_t i = 0; i + 1 < VL_TEST_SET_RANK_BENCH_QUERIES; i += 2)
+        checksum += vlSetCountRange(set, values + i, values + i + 1);
+    const vl_ularge_t rangeNanos = vlThreadMonotonicNano() - start;
+
+    //The iterating baseline is orders of magnitude slower, so it only runs a handful of queries.
+    const vl_dsidx_t scans = 8;
+    vl_dsidx_t scanned = 0;
+    start = vlThreadMonotonicNano();
+    for (vl_dsidx_t i = 0; i < scans; i++) {
+        VL_SET_FOREACH(set, curIter) {
+            if (*(int *) vlSetSample(set, curIter) >= values[i])
+                break;
+            scanned++;
+        }
+    }
+    const vl_ularge_t scanNanos = vlThreadMonotonicNano() - start;
+
+    //Rank and select undo each other; each rank equals half its probe, rounded up.
+    for (vl_dsidx_t i = 0; i < scans && result; i++)
+        result = vlSetRank(set, values + i) == (vl_dsidx_t) (values[i] + 1) / 2;
+    vl_dsidx_t expectedScanned = 0;
+    for (vl_dsidx_t i = 0; i < scans; i++)
+        expectedScanned += (vl_dsidx_t) (values[i] + 1) / 2;
+    result = result && scanned == expectedScanned;
+
+    printf("order statistics on a %d-element set, ns per query:\n", (int) count);
+    printf("  %12s %12s %12s %16s\n", "rank", "select", "count range", "rank by scan");
+    printf("  %12.1f %12.1f %12.1f %16.1f\n", (double) rankNanos / VL_TEST_SET_RANK_BENCH_QUERIES,
+           (double) selectNanos / VL_TEST_SET_RANK_BENCH_QUERIES,
+           (double) rangeNanos / (VL_TEST_SET_RANK_BENCH_QUERIES / 2), (double) scanNanos / scans);
+    printf("  (checksum %llu)\n", (unsigned long long) checksum);
+
+    vlSetDelete(set);
+    vlMemFree((vl_memory *) values);
+    return result;
+}
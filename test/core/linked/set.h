@@ -10,6 +10,11 @@ extern "C" {
 vl_bool_t vlTestSetGrowth(void);
 vl_bool_t vlTestSetOrder(void);
 vl_bool_t vlTestSetIterate(vl_bool_t reverse);
+vl_bool_t vlTestSetBuildSorted(void);
+vl_bool_t vlTestSetAlgebra(void);
+vl_bool_t vlTestSetAlgebraBenchmark(void);
+vl_bool_t vlTestSetOrderStatistics(void);
+vl_bool_t vlTestSetRankBenchmark(void);
 
 #ifdef __cplusplus
 }
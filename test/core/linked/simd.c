@@ -0,0 +1,800 @@
+#include "simd.h"
+#include <vl/vl_simd.h>
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_thread.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_SIMD_SHORT_MAX 70
+#define VL_TEST_SIMD_MAX_COUNT 4099
+#define VL_TEST_SIMD_BENCH_COUNT (1 << 22)
+#define VL_TEST_SIMD_BENCH_REPEAT 4
+#define VL_TEST_SIMD_BENCH_SMALL_COUNT 4096
+#define VL_TEST_SIMD_BENCH_SMALL_REPEAT 4096
+
+static const char *const vlTestSIMDBackendNames[VL_SIMD_BACKEND_COUNT] = {
+    "Portable", "SSE2", "AVX2", "NEON", "NEON64", "AVX-512"
+};
+
+/**
+ * Buffers shared by the kernel checks. Every array holds one element of slack
+ * so kernels can also run on a misaligned view starting at index 1.
+ */
+typedef struct {
+    vl_float32_t *f32A, *f32B, *f32Out;
+    vl_int32_t *i32A, *i32B, *i32Out;
+    vl_int16_t *i16A, *i16B, *i16Out;
+    vl_uint8_t *u8A, *u8Out, *u8Ref;
+    vl_uint8_t *mask;
+    vl_rand rand;
+} vl_test_simd_buffers;
+
+static void vlTestSIMDBuffersInit(vl_test_simd_buffers *b) {
+    const vl_dsidx_t n = VL_TEST_SIMD_MAX_COUNT + 1;
+    b->f32A = (vl_float32_t *) vlMemAlloc(sizeof(vl_float32_t) * n);
+    b->f32B = (vl_float32_t *) vlMemAlloc(sizeof(vl_float32_t) * n);
+    b->f32Out = (vl_float32_t *) vlMemAlloc(sizeof(vl_float32_t) * n);
+    b->i32A = (vl_int32_t *) vlMemAlloc(sizeof(vl_int32_t) * n);
+    b->i32B = (vl_int32_t *) vlMemAlloc(sizeof(vl_int32_t) * n);
+    b->i32Out = (vl_int32_t *) vlMemAlloc(sizeof(vl_int32_t) * n);
+    b->i16A = (vl_int16_t *) vlMemAlloc(sizeof(vl_int16_t) * n);
+    b->i16B = (vl_int16_t *) vlMemAlloc(sizeof(vl_int16_t) * n);
+    b->i16Out = (vl_int16_t *) vlMemAlloc(sizeof(vl_int16_t) * n);
+    b->u8A = (vl_uint8_t *) vlMemAlloc(n);
+    b->u8Out = (vl_uint8_t *) vlMemAlloc(n);
+    b->u8Ref = (vl_uint8_t *) vlMemAlloc(n);
+    b->mask = (vl_uint8_t *) vlMemAlloc(n / 8 + 2);
+    b->rand = vlRandInit();
+}
+
+static void vlTestSIMDBuffersFree(vl_test_simd_buffers *b) {
+    vlMemFree((vl_memory *) b->f32A);
+    vlMemFree((vl_memory *) b->f32B);
+    vlMemFree((vl_memory *) b->f32Out);
+    vlMemFree((vl_memory *) b->i32A);
+    vlMemFree((vl_memory *) b->i32B);
+    vlMemFree((vl_memory *) b->i32Out);
+    vlMemFree((vl_memory *) b->i16A);
+    vlMemFree((vl_memory *) b->i16B);
+    vlMemFree((vl_memory *) b->i16Out);
+    vlMemFree((vl_memory *) b->u8A);
+    vlMemFree((vl_memory *) b->u8Out);
+    vlMemFree((vl_memory *) b->u8Ref);
+    vlMemFree((vl_memory *) b->mask);
+}
+
+/**
+ * Fills every input array. Floats are small integers so that sums, dot
+ * products and scans are exact in any order. With `narrow` set, integers come
+ * from small ranges (many repeated minima) and the 16-bit inputs hold runs of
+ * -32768, the one case where a pairwise 16-bit multiply-add overflows.
+ */
+static void vlTestSIMDFill(vl_test_simd_buffers *b, vl_bool_t narrow) {
+    const vl_dsidx_t n = VL_TEST_SIMD_MAX_COUNT + 1;
+    vlRandFill(&b->rand, b->i32A, sizeof(vl_int32_t) * n);
+    vlRandFill(&b->rand, b->i32B, sizeof(vl_int32_t) * n);
+    vlRandFill(&b->rand, b->i16A, sizeof(vl_int16_t) * n);
+    vlRandFill(&b->rand, b->i16B, sizeof(vl_int16_t) * n);
+    vlRandFill(&b->rand, b->u8A, n);
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        b->f32A[i] = (vl_float32_t) ((vl_int32_t) (vlRandUInt32(&b->rand) % 129) - 64);
+        b->f32B[i] = (vl_float32_t) ((vl_int32_t) (vlRandUInt32(&b->rand) % 129) - 64);
+        if (narrow) {
+            b->i32A[i] %= 100;
+            b->i16A[i] = (i % 4 < 2) ? (vl_int16_t) -32768 : (vl_int16_t) (b->i16A[i] % 50);
+            b->i16B[i] = (i % 4 < 2) ? (vl_int16_t) -32768 : b->i16B[i];
+            b->u8A[i] = (vl_uint8_t) (40 + b->u8A[i] % 20);
+        }
+    }
+}
+
+/**
+ * Runs `check` on each backend the build and CPU support, then hands the table
+ * back to the best backend so later tests see the usual selection.
+ */
+static vl_bool_t vlTestSIMDEachBackend(vl_bool_t (*check)(vl_test_simd_buffers *), vl_test_simd_buffers *b) {
+    vl_bool_t result = VL_TRUE;
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+        for (int narrow = 0; narrow < 2 && result; narrow++) {
+            vlTestSIMDFill(b, (vl_bool_t) narrow);
+            result = check(b);
+        }
+        if (!result)
+            printf("SIMD kernel mismatch on backend %s\n", vlSIMDFunctions.backend_name);
+    }
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+    return result;
+}
+
+/**
+ * Lengths around every vector width and unroll factor, plus a few long ones.
+ */
+static vl_dsidx_t vlTestSIMDNextCount(vl_dsidx_t count) {
+    if (count < VL_TEST_SIMD_SHORT_MAX)
+        return count + 1;
+    if (count == VL_TEST_SIMD_SHORT_MAX)
+        return 257;
+    if (count == 257)
+        return 1000;
+    if (count == 1000)
+        return VL_TEST_SIMD_MAX_COUNT;
+    return VL_TEST_SIMD_MAX_COUNT + 1;
+}
+
+static vl_bool_t vlTestSIMDReductionsAt(vl_test_simd_buffers *b, vl_dsidx_t offset, vl_dsidx_t n) {
+    const vl_float32_t *f32A = b->f32A + offset, *f32B = b->f32B + offset;
+    const vl_int32_t *i32A = b->i32A + offset, *i32B = b->i32B + offset;
+    const vl_int16_t *i16A = b->i16A + offset, *i16B = b->i16B + offset;
+    const vl_uint8_t *u8A = b->u8A + offset;
+    vl_float32_t sumF32 = 0.0f, dotF32 = 0.0f;
+    vl_uint64_t sumI32 = 0, sumI16 = 0, sumU8 = 0, dotI32 = 0, dotI16 = 0;
+    vl_dsidx_t minF32 = 0, maxF32 = 0, minI32 = 0, maxI32 = 0, minI16 = 0, maxI16 = 0, minU8 = 0, maxU8 = 0;
+
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        sumF32 += f32A[i];
+        dotF32 += f32A[i] * f32B[i];
+        sumI32 += (vl_uint64_t) (vl_int64_t) i32A[i];
+        sumI16 += (vl_uint64_t) (vl_int64_t) i16A[i];
+        sumU8 += u8A[i];
+        dotI32 += (vl_uint64_t) ((vl_int64_t) i32A[i] * i32B[i]);
+        dotI16 += (vl_uint64_t) ((vl_int64_t) i16A[i] * i16B[i]);
+        minF32 = f32A[i] < f32A[minF32] ? i : minF32;
+        maxF32 = f32A[i] > f32A[maxF32] ? i : maxF32;
+        minI32 = i32A[i] < i32A[minI32] ? i : minI32;
+        maxI32 = i32A[i] > i32A[maxI32] ? i : maxI32;
+        minI16 = i16A[i] < i16A[minI16] ? i : minI16;
+        maxI16 = i16A[i] > i16A[maxI16] ? i : maxI16;
+        minU8 = u8A[i] < u8A[minU8] ? i : minU8;
+        maxU8 = u8A[i] > u8A[maxU8] ? i : maxU8;
+    }
+
+    if (vlSIMDSumF32(f32A, n) != sumF32 || vlSIMDDotF32(f32A, f32B, n) != dotF32)
+        return VL_FALSE;
+    if (vlSIMDSumI32(i32A, n) != (vl_int64_t) sumI32 || vlSIMDSumI16(i16A, n) != (vl_int64_t) sumI16 ||
+        vlSIMDSumU8(u8A, n) != sumU8)
+        return VL_FALSE;
+    if (vlSIMDDotI32(i32A, i32B, n) != (vl_int64_t) dotI32 || vlSIMDDotI16(i16A, i16B, n) != (vl_int64_t) dotI16)
+        return VL_FALSE;
+
+    if (n == 0) {
+        return !vlSIMDMinMaxF32(f32A, n, NULL, NULL) && !vlSIMDMinMaxI32(i32A, n, NULL, NULL) &&
+               !vlSIMDMinMaxI16(i16A, n, NULL, NULL) && !vlSIMDMinMaxU8(u8A, n, NULL, NULL) &&
+               vlSIMDArgMinF32(f32A, n) == VL_STRUCTURE_INDEX_MAX &&
+               vlSIMDArgMinI32(i32A, n) == VL_STRUCTURE_INDEX_MAX &&
+               vlSIMDArgMinI16(i16A, n) == VL_STRUCTURE_INDEX_MAX && vlSIMDArgMinU8(u8A, n) == VL_STRUCTURE_INDEX_MAX;
+    }
+
+    vl_float32_t loF32, hiF32;
+    vl_int32_t loI32, hiI32;
+    vl_int16_t loI16, hiI16;
+    vl_uint8_t loU8, hiU8;
+    if (!vlSIMDMinMaxF32(f32A, n, &loF32, &hiF32) || loF32 != f32A[minF32] || hiF32 != f32A[maxF32])
+        return VL_FALSE;
+    if (!vlSIMDMinMaxI32(i32A, n, &loI32, &hiI32) || loI32 != i32A[minI32] || hiI32 != i32A[maxI32])
+        return VL_FALSE;
+    if (!vlSIMDMinMaxI16(i16A, n, &loI16, &hiI16) || loI16 != i16A[minI16] || hiI16 != i16A[maxI16])
+        return VL_FALSE;
+    if (!vlSIMDMinMaxU8(u8A, n, &loU8, &hiU8) || loU8 != u8A[minU8] || hiU8 != u8A[maxU8])
+        return VL_FALSE;
+    if (!vlSIMDMinMaxI32(i32A, n, NULL, &hiI32) || hiI32 != i32A[maxI32])
+        return VL_FALSE;
+
+    return vlSIMDArgMinF32(f32A, n) == minF32 && vlSIMDArgMinI32(i32A, n) == minI32 &&
+           vlSIMDArgMinI16(i16A, n) == minI16 && vlSIMDArgMinU8(u8A, n) == minU8;
+}
+
+static vl_bool_t vlTestSIMDReductionsCheck(vl_test_simd_buffers *b) {
+    for (vl_dsidx_t n = 0; n <= VL_TEST_SIMD_MAX_COUNT; n = vlTestSIMDNextCount(n))
+        for (vl_dsidx_t offset = 0; offset < 2; offset++)
+            if (!vlTestSIMDReductionsAt(b, offset, n))
+                return VL_FALSE;
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestSIMDReductions() {
+    vl_test_simd_buffers buffers;
+    vlTestSIMDBuffersInit(&buffers);
+    const vl_bool_t result = vlTestSIMDEachBackend(vlTestSIMDReductionsCheck, &buffers);
+    vlTestSIMDBuffersFree(&buffers);
+    return result;
+}
+
+static vl_bool_t vlTestSIMDTransformsAt(vl_test_simd_buffers *b, vl_dsidx_t offset, vl_dsidx_t n) {
+    const vl_float32_t *f32A = b->f32A + offset, *f32B = b->f32B + offset;
+    const vl_int32_t *i32A = b->i32A + offset, *i32B = b->i32B + offset;
+    const vl_int16_t *i16A = b->i16A + offset;
+    const vl_uint8_t *u8A = b->u8A + offset;
+    vl_float32_t *f32Out = b->f32Out + offset;
+    vl_int32_t *i32Out = b->i32Out + offset;
+    vl_int16_t *i16Out = b->i16Out + offset;
+    vl_uint8_t *u8Out = b->u8Out + offset;
+    const vl_int32_t alphaI32 = (vl_int32_t) vlRandUInt32(&b->rand);
+    const vl_float32_t alphaF32 = (vl_float32_t) ((vl_int32_t) (vlRandUInt32(&b->rand) % 9) - 4);
+
+    //axpy, updating a copy of the second input in place.
+    memcpy(f32Out, f32B, sizeof(vl_float32_t) * n);
+    memcpy(i32Out, i32B, sizeof(vl_int32_t) * n);
+    vlSIMDAxpyF32(f32A, f32Out, n, alphaF32);
+    vlSIMDAxpyI32(i32A, i32Out, n, alphaI32);
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        if (f32Out[i] != f32B[i] + alphaF32 * f32A[i])
+            return VL_FALSE;
+        if (i32Out[i] != (vl_int32_t) ((vl_uint32_t) i32B[i] + (vl_uint32_t) alphaI32 * (vl_uint32_t) i32A[i]))
+            return VL_FALSE;
+    }
+
+    //scale, out of place.
+    vlSIMDScaleF32(f32A, f32Out, n, alphaF32);
+    vlSIMDScaleI32(i32A, i32Out, n, alphaI32);
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        if (f32Out[i] != alphaF32 * f32A[i])
+            return VL_FALSE;
+        if (i32Out[i] != (vl_int32_t) ((vl_uint32_t) alphaI32 * (vl_uint32_t) i32A[i]))
+            return VL_FALSE;
+    }
+
+    //clamp, out of place, to bounds taken from the data itself.
+    const vl_float32_t loF32 = -16.0f, hiF32 = 20.0f;
+    const vl_int32_t loI32 = n ? (i32A[0] < i32A[n - 1] ? i32A[0] : i32A[n - 1]) : 0;
+    const vl_int32_t hiI32 = n ? (i32A[0] < i32A[n - 1] ? i32A[n - 1] : i32A[0]) : 0;
+    const vl_int16_t loI16 = -1000, hiI16 = 30;
+    const vl_uint8_t loU8 = 45, hiU8 = 200;
+    vlSIMDClampF32(f32A, f32Out, n, loF32, hiF32);
+    vlSIMDClampI32(i32A, i32Out, n, loI32, hiI32);
+    vlSIMDClampI16(i16A, i16Out, n, loI16, hiI16);
+    vlSIMDClampU8(u8A, u8Out, n, loU8, hiU8);
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        if (f32Out[i] != (f32A[i] < loF32 ? loF32 : f32A[i] > hiF32 ? hiF32 : f32A[i]))
+            return VL_FALSE;
+        if (i32Out[i] != (i32A[i] < loI32 ? loI32 : i32A[i] > hiI32 ? hiI32 : i32A[i]))
+            return VL_FALSE;
+        if (i16Out[i] != (i16A[i] < loI16 ? loI16 : i16A[i] > hiI16 ? hiI16 : i16A[i]))
+            return VL_FALSE;
+        if (u8Out[i] != (u8A[i] < loU8 ? loU8 : u8A[i] > hiU8 ? hiU8 : u8A[i]))
+            return VL_FALSE;
+    }
+
+    //Prefix sums, out of place, then in place over the output.
+    vlSIMDPrefixSumF32(f32A, f32Out, n);
+    vlSIMDPrefixSumI32(i32A, i32Out, n);
+    vl_float32_t totalF32 = 0.0f;
+    vl_uint32_t totalI32 = 0;
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        totalF32 += f32A[i];
+        totalI32 += (vl_uint32_t) i32A[i];
+        if (f32Out[i] != totalF32 || i32Out[i] != (vl_int32_t) totalI32)
+            return VL_FALSE;
+    }
+
+    memcpy(f32Out, f32A, sizeof(vl_float32_t) * n);
+    vlSIMDPrefixSumF32(f32Out, f32Out, n);
+    return n == 0 || f32Out[n - 1] == totalF32;
+}
+
+static vl_bool_t vlTestSIMDTransformsCheck(vl_test_simd_buffers *b) {
+    for (vl_dsidx_t n = 0; n <= VL_TEST_SIMD_MAX_COUNT; n = vlTestSIMDNextCount(n))
+        for (vl_dsidx_t offset = 0; offset < 2; offset++)
+            if (!vlTestSIMDTransformsAt(b, offset, n))
+                return VL_FALSE;
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestSIMDTransforms() {
+    vl_test_simd_buffers buffers;
+    vlTestSIMDBuffersInit(&buffers);
+    const vl_bool_t result = vlTestSIMDEachBackend(vlTestSIMDTransformsCheck, &buffers);
+    vlTestSIMDBuffersFree(&buffers);
+    return result;
+}
+
+/**
+ * Checks a mask against per-element results held as 0/1 bytes in `expected`,
+ * and that the byte following the mask was left alone.
+ */
+static vl_bool_t vlTestSIMDCheckMask(const vl_uint8_t *mask, const vl_uint8_t *expected, vl_dsidx_t n,
+                                     vl_dsidx_t hits) {
+    vl_dsidx_t total = 0;
+    for (vl_dsidx_t i = 0; i < (n + 7) / 8 * 8; i++) {
+        const vl_uint8_t bit = (mask[i / 8] >> (i % 8)) & 1;
+        if (bit != (i < n ? expected[i] : 0))
+            return VL_FALSE;
+        total += bit;
+    }
+    return total == hits && mask[(n + 7) / 8] == 0xA5;
+}
+
+#define VL_TEST_SIMD_COMPARE_CASE(FN, DATA, VALUE)                                                                     \
+    do {                                                                                                               \
+        vl_dsidx_t hits = 0;                                                                                           \
+        for (vl_dsidx_t i = 0; i < n; i++) {                                                                           \
+            const int lt = DATA[i] < VALUE, eq = DATA[i] == VALUE, gt = DATA[i] > VALUE;                               \
+            const int results[6] = {lt, lt || eq, eq, !eq, gt || eq, gt};                                              \
+            expected[i] = (vl_uint8_t) results[op];                                                                    \
+            hits += expected[i];                                                                                       \
+        }                                                                                                              \
+        memset(b->mask, 0xA5, (n + 7) / 8 + 1);                                                                        \
+        if (FN(DATA, n, VALUE, (vl_simd_cmp_op) op, b->mask) != hits ||                                                \
+            !vlTestSIMDCheckMask(b->mask, expected, n, hits))                                                          \
+            return VL_FALSE;                                                                                           \
+    } while (0)
+
+static vl_bool_t vlTestSIMDCompareAt(vl_test_simd_buffers *b, vl_dsidx_t offset, vl_dsidx_t n) {
+    vl_float32_t *f32A = b->f32Out + offset;
+    const vl_int32_t *i32A = b->i32A + offset;
+    const vl_int16_t *i16A = b->i16A + offset;
+    const vl_uint8_t *u8A = b->u8A + offset;
+    vl_uint8_t *expected = b->u8Ref;
+
+    //Floats get a NaN every 13 elements, which satisfies only NE.
+    memcpy(f32A, b->f32A + offset, sizeof(vl_float32_t) * n);
+    for (vl_dsidx_t i = 5; i < n; i += 13)
+        f32A[i] = NAN;
+
+    //Probe with a value that occurs in the data, so that equality hits too.
+    const vl_float32_t valueF32 = n ? b->f32A[offset + n / 2] : 1.0f;
+    const vl_int32_t valueI32 = n ? i32A[n / 3] : 0;
+    const vl_int16_t valueI16 = n ? i16A[n / 3] : 0;
+    const vl_uint8_t valueU8 = n ? u8A[n / 3] : 0;
+
+    for (int op = VL_SIMD_CMP_LT; op <= VL_SIMD_CMP_GT; op++) {
+        VL_TEST_SIMD_COMPARE_CASE(vlSIMDCompareF32, f32A, valueF32);
+        VL_TEST_SIMD_COMPARE_CASE(vlSIMDCompareI32, i32A, valueI32);
+        VL_TEST_SIMD_COMPARE_CASE(vlSIMDCompareI16, i16A, valueI16);
+        VL_TEST_SIMD_COMPARE_CASE(vlSIMDCompareU8, u8A, valueU8);
+    }
+    return VL_TRUE;
+}
+
+static vl_bool_t vlTestSIMDCompareCheck(vl_test_simd_buffers *b) {
+    for (vl_dsidx_t n = 0; n <= VL_TEST_SIMD_MAX_COUNT; n = vlTestSIMDNextCount(n))
+        for (vl_dsidx_t offset = 0; offset < 2; offset++)
+            if (!vlTestSIMDCompareAt(b, offset, n))
+                return VL_FALSE;
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestSIMDCompare() {
+    vl_test_simd_buffers buffers;
+    vlTestSIMDBuffersInit(&buffers);
+    const vl_bool_t result = vlTestSIMDEachBackend(vlTestSIMDCompareCheck, &buffers);
+    vlTestSIMDBuffersFree(&buffers);
+    return result;
+}
+
+/**
+ * Runs the 16-lane and 64-byte operations over the start of the buffers, one
+ * vector at a time, and compares every lane with plain arithmetic.
+ */
+static vl_bool_t vlTestSIMDWideCheck(vl_test_simd_buffers *b) {
+    for (vl_dsidx_t i = 0; i + 64 <= VL_TEST_SIMD_MAX_COUNT; i += 64) {
+        const vl_simd_vec16_f32 fa = vlSIMDLoadVec16F32(b->f32A + i);
+        const vl_simd_vec16_f32 fb = vlSIMDLoadVec16F32(b->f32B + i);
+        const vl_simd_vec16_f32 fc = vlSIMDSplatVec16F32(3.0f);
+        const vl_simd_vec16_f32 sum = vlSIMDAddVec16F32(fa, fb);
+        const vl_simd_vec16_f32 diff = vlSIMDSubVec16F32(fa, fb);
+        const vl_simd_vec16_f32 prod = vlSIMDMulVec16F32(fa, fb);
+        vlSIMDStoreVec16F32(b->f32Out + i, vlSIMDFmaVec16F32(fa, fb, fc));
+        vl_float32_t total = 0.0f;
+        for (int k = 0; k < 16; k++) {
+            const vl_float32_t x = b->f32A[i + k], y = b->f32B[i + k];
+            if (sum.components[k] != x + y || diff.components[k] != x - y || prod.components[k] != x * y)
+                return VL_FALSE;
+            if (b->f32Out[i + k] != x * y + 3.0f)
+                return VL_FALSE;
+            total += x;
+        }
+        if (vlSIMDHsumVec16F32(fa) != total)
+            return VL_FALSE;
+
+        const vl_simd_vec16_i32 ia = vlSIMDLoadVec16I32(b->i32A + i);
+        const vl_simd_vec16_i32 ib = vlSIMDLoadVec16I32(b->i32B + i);
+        const vl_simd_vec16_i32 isum = vlSIMDAddVec16I32(ia, ib);
+        vlSIMDStoreVec16I32(b->i32Out + i, vlSIMDMulVec16I32(ia, ib));
+        for (int k = 0; k < 16; k++) {
+            const vl_uint32_t x = (vl_uint32_t) b->i32A[i + k], y = (vl_uint32_t) b->i32B[i + k];
+            if ((vl_uint32_t) isum.components[k] != x + y || (vl_uint32_t) b->i32Out[i + k] != x * y)
+                return VL_FALSE;
+        }
+
+        const vl_simd_vec64_u8 bytes = vlSIMDLoadVec64U8(b->u8A + i);
+        vlSIMDStoreVec64U8(b->u8Out + i, bytes);
+        const vl_uint8_t needle = b->u8A[i + (i / 64) % 64];
+        const vl_uint64_t hits = vlSIMDEqMaskVec64U8(bytes, needle);
+        for (int k = 0; k < 64; k++) {
+            if (b->u8Out[i + k] != b->u8A[i + k])
+                return VL_FALSE;
+            if (((hits >> k) & 1u) != (vl_uint64_t) (b->u8A[i + k] == needle))
+                return VL_FALSE;
+        }
+    }
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestSIMDWideVectors() {
+    vl_test_simd_buffers buffers;
+    vlTestSIMDBuffersInit(&buffers);
+    const vl_bool_t result = vlTestSIMDEachBackend(vlTestSIMDWideCheck, &buffers);
+    vlTestSIMDBuffersFree(&buffers);
+    return result;
+}
+
+/**
+ * Checks find, find-last, find-any, count and equality at one length against
+ * plain loops. Needles are taken from the array's first, middle and last
+ * bytes, plus one byte that narrow fills never contain.
+ */
+static vl_bool_t vlTestSIMDByteScanAt(vl_test_simd_buffers *b, vl_dsidx_t offset, vl_dsidx_t n) {
+    const vl_uint8_t *data = b->u8A + offset;
+    const vl_uint8_t needles[4] = {n ? data[0] : 0, n ? data[n / 2] : 0, n ? data[n - 1] : 0, 0xFF};
+
+    for (int k = 0; k < 4; k++) {
+        vl_dsidx_t first = n, last = n, count = 0;
+        for (vl_dsidx_t i = 0; i < n; i++) {
+            if (data[i] == needles[k]) {
+                first = first == n ? i : first;
+                last = i;
+                count++;
+            }
+        }
+        if (vlSIMDFindU8(data, n, needles[k]) != first || vlSIMDFindLastU8(data, n, needles[k]) != last)
+            return VL_FALSE;
+        if (vlSIMDCountU8(data, n, needles[k]) != count)
+            return VL_FALSE;
+    }
+
+    //Sets of 0, 1, 3 and 16 bytes take the vector path; 17 bytes use the lookup table.
+    vl_uint8_t set[17];
+    for (int k = 0; k < 17; k++)
+        set[k] = (vl_uint8_t) (0xFF - k * 7);
+    set[2] = needles[1];
+    const vl_dsidx_t setCounts[5] = {0, 1, 3, 16, 17};
+    for (int s = 0; s < 5; s++) {
+        vl_dsidx_t first = n;
+        for (vl_dsidx_t i = 0; i < n && first == n; i++)
+            for (vl_dsidx_t k = 0; k < setCounts[s]; k++)
+                if (data[i] == set[k])
+                    first = i;
+        if (vlSIMDFindAnyU8(data, n, set, setCounts[s]) != first)
+            return VL_FALSE;
+    }
+
+    memcpy(b->u8Out, data, n);
+    if (!vlSIMDEqualU8(data, b->u8Out, n))
+        return VL_FALSE;
+    if (n > 0) {
+        const vl_dsidx_t flips[3] = {0, vlRandUInt32(&b->rand) % n, n - 1};
+        for (int k = 0; k < 3; k++) {
+            b->u8Out[flips[k]] ^= 0x10;
+            const vl_bool_t equal = vlSIMDEqualU8(data, b->u8Out, n);
+            b->u8Out[flips[k]] ^= 0x10;
+            if (equal)
+                return VL_FALSE;
+        }
+    }
+    return VL_TRUE;
+}
+
+static vl_bool_t vlTestSIMDByteScanCheck(vl_test_simd_buffers *b) {
+    for (vl_dsidx_t n = 0; n <= VL_TEST_SIMD_MAX_COUNT; n = vlTestSIMDNextCount(n))
+        for (vl_dsidx_t offset = 0; offset < 2; offset++)
+            if (!vlTestSIMDByteScanAt(b, offset, n))
+                return VL_FALSE;
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestSIMDByteScan() {
+    vl_test_simd_buffers buffers;
+    vlTestSIMDBuffersInit(&buffers);
+    const vl_bool_t result = vlTestSIMDEachBackend(vlTestSIMDByteScanCheck, &buffers);
+    vlTestSIMDBuffersFree(&buffers);
+    return result;
+}
+
+#define VL_TEST_SIMD_HALF_COUNT 65536
+
+static vl_uint32_t vlTestSIMDFloatBits(vl_float32_t f) {
+    vl_uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static vl_float32_t vlTestSIMDBitsFloat(vl_uint32_t u) {
+    vl_float32_t f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+/**
+ * Converts `n` elements starting at `offset` in both directions and compares
+ * every result bit for bit against the scalar conversions in vl_half.h.
+ */
+static vl_bool_t vlTestSIMDHalfAt(const vl_half_t *halves, const vl_float32_t *floats, vl_half_t *halfOut,
+                                  vl_float32_t *floatOut, vl_dsidx_t offset, vl_dsidx_t n) {
+    vlSIMDConvertHalfToF32(halves + offset, floatOut, n);
+    vlSIMDConvertF32ToHalf(floats + offset, halfOut, n);
+    for (vl_dsidx_t i = 0; i < n; i++) {
+        if (vlTestSIMDFloatBits(floatOut[i]) != vlTestSIMDFloatBits(vlHalfToFloat(halves[offset + i])))
+            return VL_FALSE;
+        if (halfOut[i] != vlHalfFromFloat(floats[offset + i]))
+            return VL_FALSE;
+    }
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestSIMDHalf() {
+    //Scalar spot checks: the smallest normal and subnormal boundaries, ties, overflow and NaN payloads.
+    if (vlHalfFromFloat(vlTestSIMDBitsFloat(0x38000000)) != 0x0200 || //2^-15, a subnormal half
+        vlHalfFromFloat(vlTestSIMDBitsFloat(0x33000001)) != 0x0001 || //Just above 2^-25 rounds up
+        vlHalfFromFloat(vlTestSIMDBitsFloat(0x33000000)) != 0x0000 || //2^-25 ties to even (zero)
+        vlHalfFromFloat(vlTestSIMDBitsFloat(0x38800000)) != 0x0400 || //2^-14, the smallest normal
+        vlHalfFromFloat(65520.0f) != 0x7C00 || vlHalfFromFloat(-65504.0f) != 0xFBFF ||
+        vlHalfFromFloat(vlTestSIMDBitsFloat(0x7FC12345)) != 0x7E09)
+        return VL_FALSE;
+    if (vlTestSIMDFloatBits(vlHalfToFloat(0x0001)) != 0x33800000 ||
+        vlTestSIMDFloatBits(vlHalfToFloat(0x7C01)) != 0x7FC02000 ||
+        vlTestSIMDFloatBits(vlHalfToFloat(0x8000)) != 0x80000000)
+        return VL_FALSE;
+
+    const vl_dsidx_t n = VL_TEST_SIMD_HALF_COUNT;
+    vl_half_t *halves = (vl_half_t *) vlMemAlloc(sizeof(vl_half_t) * (n + 1));
+    vl_half_t *halfOut = (vl_half_t *) vlMemAlloc(sizeof(vl_half_t) * (n + 1));
+    vl_float32_t *floats = (vl_float32_t *) vlMemAlloc(sizeof(vl_float32_t) * (n + 1));
+    vl_float32_t *floatOut = (vl_float32_t *) vlMemAlloc(sizeof(vl_float32_t) * (n + 1));
+    vl_rand rand = vlRandInit();
+
+    //Every half; floats alternate between random bit patterns and the midpoint of two adjacent finite halves,
+    //nudged one float step either way or left as an exact tie.
+    for (vl_dsidx_t i = 0; i <= n; i++) {
+        halves[i] = (vl_half_t) i;
+        const vl_half_t h = (vl_half_t) ((vlRandUInt32(&rand) % 0x7BFF) | (vlRandUInt32(&rand) & 0x8000));
+        const double mid = ((double) vlHalfToFloat(h) + (double) vlHalfToFloat((vl_half_t) (h + 1))) / 2.0;
+        const vl_uint32_t nudge = (vl_uint32_t) (vlRandUInt32(&rand) % 3) - 1;
+        floats[i] = vlTestSIMDBitsFloat(i % 2 ? vlRandUInt32(&rand) : vlTestSIMDFloatBits((vl_float32_t) mid) + nudge);
+    }
+
+    vl_bool_t result = VL_TRUE;
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT && result; backend++) {
+        if (!vlSIMDUseBackend((vl_simd_backend) backend))
+            continue;
+        for (vl_dsidx_t count = 0; count <= VL_TEST_SIMD_MAX_COUNT && result; count = vlTestSIMDNextCount(count))
+            result = vlTestSIMDHalfAt(halves, floats, halfOut, floatOut, 1, count);
+        result = result && vlTestSIMDHalfAt(halves, floats, halfOut, floatOut, 0, n);
+        if (!result)
+            printf("SIMD half conversion mismatch on backend %s\n", vlSIMDFunctions.backend_name);
+    }
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+
+    vlMemFree((vl_memory *) floatOut);
+    vlMemFree((vl_memory *) floats);
+    vlMemFree((vl_memory *) halfOut);
+    vlMemFree((vl_memory *) halves);
+    return result;
+}
+
+/**
+ * One benchmark row: runs a kernel once over `n` elements of the given arrays.
+ * `bytes` is the memory traffic per element, counting reads and writes.
+ */
+typedef struct {
+    const char *name;
+    vl_dsidx_t bytes;
+    void (*run)(void *a, void *b, vl_dsidx_t n);
+} vl_test_simd_bench;
+
+static volatile vl_uint64_t vlTestSIMDBenchSink;
+
+static void vlTestSIMDBenchSumF32(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += (vl_uint64_t) vlSIMDSumF32((const vl_float32_t *) a, n);
+}
+
+static void vlTestSIMDBenchSumU8(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += vlSIMDSumU8((const vl_uint8_t *) a, n);
+}
+
+static void vlTestSIMDBenchDotF32(void *a, void *b, vl_dsidx_t n) {
+    vlTestSIMDBenchSink += (vl_uint64_t) vlSIMDDotF32((const vl_float32_t *) a, (const vl_float32_t *) b, n);
+}
+
+static void vlTestSIMDBenchDotI16(void *a, void *b, vl_dsidx_t n) {
+    vlTestSIMDBenchSink += (vl_uint64_t) vlSIMDDotI16((const vl_int16_t *) a, (const vl_int16_t *) b, n);
+}
+
+static void vlTestSIMDBenchAxpyF32(void *a, void *b, vl_dsidx_t n) {
+    vlSIMDAxpyF32((const vl_float32_t *) a, (vl_float32_t *) b, n, 0.5f);
+}
+
+static void vlTestSIMDBenchMinMaxI32(void *a, void *b, vl_dsidx_t n) {
+    vl_int32_t lo, hi;
+    (void) b;
+    vlSIMDMinMaxI32((const vl_int32_t *) a, n, &lo, &hi);
+    vlTestSIMDBenchSink += (vl_uint64_t) (lo ^ hi);
+}
+
+static void vlTestSIMDBenchArgMinF32(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += vlSIMDArgMinF32((const vl_float32_t *) a, n);
+}
+
+static void vlTestSIMDBenchClampU8(void *a, void *b, vl_dsidx_t n) {
+    vlSIMDClampU8((const vl_uint8_t *) a, (vl_uint8_t *) b, n, 16, 240);
+}
+
+static void vlTestSIMDBenchPrefixSumI32(void *a, void *b, vl_dsidx_t n) {
+    vlSIMDPrefixSumI32((const vl_int32_t *) a, (vl_int32_t *) b, n);
+}
+
+static void vlTestSIMDBenchCompareI32(void *a, void *b, vl_dsidx_t n) {
+    vlTestSIMDBenchSink += vlSIMDCompareI32((const vl_int32_t *) a, n, 0, VL_SIMD_CMP_LT, (vl_uint8_t *) b);
+}
+
+static void vlTestSIMDBenchHalfFromF32(void *a, void *b, vl_dsidx_t n) {
+    vlSIMDConvertF32ToHalf((const vl_float32_t *) a, (vl_half_t *) b, n);
+}
+
+static void vlTestSIMDBenchHalfToF32(void *a, void *b, vl_dsidx_t n) {
+    vlSIMDConvertHalfToF32((const vl_half_t *) a, (vl_float32_t *) b, n);
+}
+
+/**
+ * Prints one throughput table: a row per kernel, a column per available backend.
+ */
+static void vlTestSIMDBenchTable(const vl_test_simd_bench *benches, vl_dsidx_t benchCount, const vl_bool_t *available,
+                                 void *a, void *b, vl_dsidx_t n, int repeat) {
+    printf("Array kernels over %d elements, GB/s:\n%-14s", (int) n, "");
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT; backend++)
+        if (available[backend])
+            printf("%10s", vlTestSIMDBackendNames[backend]);
+    printf("\n");
+
+    for (vl_dsidx_t k = 0; k < benchCount; k++) {
+        printf("%-14s", benches[k].name);
+        for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT; backend++) {
+            if (!available[backend])
+                continue;
+            vlSIMDUseBackend((vl_simd_backend) backend);
+            benches[k].run(a, b, n);
+
+            const vl_ularge_t start = vlThreadMonotonicNano();
+            for (int r = 0; r < repeat; r++)
+                benches[k].run(a, b, n);
+            const vl_ularge_t nanos = vlThreadMonotonicNano() - start;
+
+            const double bytes = (double) benches[k].bytes * (double) n * repeat;
+            printf("%10.2f", bytes / (double) (nanos ? nanos : 1));
+        }
+        printf("\n");
+    }
+}
+
+vl_bool_t vlTestSIMDBenchmark() {
+    static const vl_test_simd_bench benches[] = {
+        {"SumF32", 4, vlTestSIMDBenchSumF32},
+        {"SumU8", 1, vlTestSIMDBenchSumU8},
+        {"DotF32", 8, vlTestSIMDBenchDotF32},
+        {"DotI16", 4, vlTestSIMDBenchDotI16},
+        {"AxpyF32", 12, vlTestSIMDBenchAxpyF32},
+        {"MinMaxI32", 4, vlTestSIMDBenchMinMaxI32},
+        {"ArgMinF32", 4, vlTestSIMDBenchArgMinF32},
+        {"ClampU8", 2, vlTestSIMDBenchClampU8},
+        {"PrefixSumI32", 8, vlTestSIMDBenchPrefixSumI32},
+        {"CompareI32", 4, vlTestSIMDBenchCompareI32},
+        {"HalfFromF32", 6, vlTestSIMDBenchHalfFromF32},
+        {"HalfToF32", 6, vlTestSIMDBenchHalfToF32},
+    };
+    const vl_dsidx_t benchCount = sizeof(benches) / sizeof(benches[0]);
+    void *a = vlMemAlloc(sizeof(vl_float32_t) * VL_TEST_SIMD_BENCH_COUNT);
+    void *b = vlMemAlloc(sizeof(vl_float32_t) * VL_TEST_SIMD_BENCH_COUNT);
+    vl_rand rand = vlRandInit();
+    vlRandFill(&rand, a, sizeof(vl_float32_t) * VL_TEST_SIMD_BENCH_COUNT);
+
+    //Random bits include NaNs; small integers keep the float kernels on their usual path.
+    vl_float32_t *floats = (vl_float32_t *) a;
+    for (vl_dsidx_t i = 0; i < VL_TEST_SIMD_BENCH_COUNT; i++)
+        floats[i] = (vl_float32_t) (vlRandUInt32(&rand) % 1000);
+    memcpy(b, a, sizeof(vl_float32_t) * VL_TEST_SIMD_BENCH_COUNT);
+
+    vl_bool_t available[VL_SIMD_BACKEND_COUNT];
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT; backend++)
+        available[backend] = vlSIMDUseBackend((vl_simd_backend) backend);
+
+    //Once streaming from memory, then repeatedly over a block that stays in L1/L2 cache.
+    vlTestSIMDBenchTable(benches, benchCount, available, a, b, VL_TEST_SIMD_BENCH_COUNT, VL_TEST_SIMD_BENCH_REPEAT);
+    vlTestSIMDBenchTable(benches, benchCount, available, a, b, VL_TEST_SIMD_BENCH_SMALL_COUNT,
+                         VL_TEST_SIMD_BENCH_SMALL_REPEAT);
+
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (available[backend] && vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+
+    vlMemFree((vl_memory *) b);
+    vlMemFree((vl_memory *) a);
+    return VL_TRUE;
+}
+
+#define VL_TEST_SIMD_SCAN_MAX (1 << 20)
+#define VL_TEST_SIMD_SCAN_BYTES (1 << 22)
+
+static void vlTestSIMDBenchFindU8(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += vlSIMDFindU8((const vl_uint8_t *) a, n, 0);
+}
+
+static void vlTestSIMDBenchFindLastU8(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += vlSIMDFindLastU8((const vl_uint8_t *) a, n, 0);
+}
+
+static void vlTestSIMDBenchFindAnyU8(void *a, void *b, vl_dsidx_t n) {
+    static const vl_uint8_t set[3] = {0, 1, 2};
+    (void) b;
+    vlTestSIMDBenchSink += vlSIMDFindAnyU8((const vl_uint8_t *) a, n, set, 3);
+}
+
+static void vlTestSIMDBenchCountU8(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += vlSIMDCountU8((const vl_uint8_t *) a, n, 'e');
+}
+
+static void vlTestSIMDBenchEqualU8(void *a, void *b, vl_dsidx_t n) {
+    vlTestSIMDBenchSink += vlSIMDEqualU8((const vl_uint8_t *) a, (const vl_uint8_t *) b, n);
+}
+
+static void vlTestSIMDBenchMemchr(void *a, void *b, vl_dsidx_t n) {
+    (void) b;
+    vlTestSIMDBenchSink += (vl_uint64_t) (memchr(a, 0, n) != NULL);
+}
+
+static void vlTestSIMDBenchMemcmp(void *a, void *b, vl_dsidx_t n) {
+    vlTestSIMDBenchSink += (vl_uint64_t) (memcmp(a, b, n) == 0);
+}
+
+vl_bool_t vlTestSIMDByteScanBenchmark() {
+    //memchr and memcmp do not depend on the backend; they are the baseline for each column.
+    static const vl_test_simd_bench benches[] = {
+        {"FindU8", 1, vlTestSIMDBenchFindU8},
+        {"FindLastU8", 1, vlTestSIMDBenchFindLastU8},
+        {"FindAnyU8", 1, vlTestSIMDBenchFindAnyU8},
+        {"CountU8", 1, vlTestSIMDBenchCountU8},
+        {"EqualU8", 2, vlTestSIMDBenchEqualU8},
+        {"memchr", 1, vlTestSIMDBenchMemchr},
+        {"memcmp", 2, vlTestSIMDBenchMemcmp},
+    };
+    const vl_dsidx_t benchCount = sizeof(benches) / sizeof(benches[0]);
+    vl_uint8_t *a = (vl_uint8_t *) vlMemAlloc(VL_TEST_SIMD_SCAN_MAX);
+    vl_uint8_t *b = (vl_uint8_t *) vlMemAlloc(VL_TEST_SIMD_SCAN_MAX);
+    vl_rand rand = vlRandInit();
+    vlRandFill(&rand, a, VL_TEST_SIMD_SCAN_MAX);
+
+    //No bytes below 3, so every find scans the whole length, and the arrays compare equal.
+    for (vl_dsidx_t i = 0; i < VL_TEST_SIMD_SCAN_MAX; i++)
+        a[i] = a[i] < 3 ? (vl_uint8_t) (a[i] + 3) : a[i];
+    memcpy(b, a, VL_TEST_SIMD_SCAN_MAX);
+
+    vl_bool_t available[VL_SIMD_BACKEND_COUNT];
+    for (int backend = 0; backend < VL_SIMD_BACKEND_COUNT; backend++)
+        available[backend] = vlSIMDUseBackend((vl_simd_backend) backend);
+
+    //Every length scans about the same number of bytes in total.
+    for (vl_dsidx_t n = 1; n <= VL_TEST_SIMD_SCAN_MAX; n *= 16) {
+        const int repeat = (int) (VL_TEST_SIMD_SCAN_BYTES / n);
+        vlTestSIMDBenchTable(benches, benchCount, available, a, b, n, repeat);
+    }
+
+    for (int backend = VL_SIMD_BACKEND_COUNT - 1; backend >= 0; backend--)
+        if (available[backend] && vlSIMDUseBackend((vl_simd_backend) backend))
+            break;
+
+    vlMemFree((vl_memory *) b);
+    vlMemFree((vl_memory *) a);
+    return VL_TRUE;
+}
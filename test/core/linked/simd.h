@@ -0,0 +1,36 @@
+#ifndef VL_TEST_SIMD_H
+#define VL_TEST_SIMD_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Run sum, dot, min/max and arg-min on every available backend and many lengths; compare against plain loops.
+VL_TEST_API vl_bool_t vlTestSIMDReductions();
+
+//Run axpy, scale, clamp and prefix sums on every available backend, in place and out of place; compare outputs.
+VL_TEST_API vl_bool_t vlTestSIMDTransforms();
+
+//Build compare masks for every operator, type and backend, including NaN; verify bits, counts and the final byte.
+VL_TEST_API vl_bool_t vlTestSIMDCompare();
+
+//Run the 16-lane float/int and 64-byte operations on every available backend; compare each lane with plain math.
+VL_TEST_API vl_bool_t vlTestSIMDWideVectors();
+
+//Run find, find-last, find-any, count and equality on every available backend and many lengths; compare with loops.
+VL_TEST_API vl_bool_t vlTestSIMDByteScan();
+
+//Convert every half and a mix of random and rounding-tie floats on every backend; compare bits with vl_half.h.
+VL_TEST_API vl_bool_t vlTestSIMDHalf();
+
+//Time the array kernels on every available backend and report throughput in GB/s.
+VL_TEST_API vl_bool_t vlTestSIMDBenchmark();
+
+//Time the byte-scanning kernels at lengths from 1 byte to 1MB on every available backend, next to memchr and memcmp.
+VL_TEST_API vl_bool_t vlTestSIMDByteScanBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_SIMD_H
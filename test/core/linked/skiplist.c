@@ -0,0 +1,409 @@
+#include "skiplist.h"
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_set.h>
+#include <vl/vl_skiplist.h>
+#include <vl/vl_srwlock.h>
+#include <vl/vl_thread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_SKIPLIST_KEYS 4096
+#define VL_TEST_SKIPLIST_STEPS 60000
+#define VL_TEST_SKIPLIST_THREADS 8
+#define VL_TEST_SKIPLIST_PER_THREAD 20000
+#define VL_TEST_SKIPLIST_CONTENDED_KEYS 64
+#define VL_TEST_SKIPLIST_CONTENDED_STEPS 50000
+#define VL_TEST_SKIPLIST_BENCH_KEYS 200000
+#define VL_TEST_SKIPLIST_BENCH_OPS 250000
+
+typedef struct {
+    vl_uint64_t key;
+    vl_uint32_t payload;
+} vl_test_skiplist_record;
+
+static vl_int_t vlTestSkipListCompareU64(const void *a, const void *b) {
+    const vl_uint64_t ka = *(const vl_uint64_t *) a, kb = *(const vl_uint64_t *) b;
+    return (ka > kb) - (ka < kb);
+}
+
+static vl_int_t vlTestSkipListCompareRecord(const void *a, const void *b) {
+    const vl_test_skiplist_record *ra = (const vl_test_skiplist_record *) a, *rb = (const vl_test_skiplist_record *) b;
+    return (ra->key > rb->key) - (ra->key < rb->key);
+}
+
+/**
+ * Walks a skiplist of records; verifies it holds exactly the keys set in `present`, with payloads derived from keys.
+ */
+static vl_bool_t vlTestSkipListMatches(const vl_skiplist *list, const vl_bool_t *present, vl_uint64_t numKeys) {
+    vl_dsidx_t count = 0;
+    for (vl_uint64_t k = 0; k < numKeys; k++)
+        count += present[k] ? 1 : 0;
+    vl_bool_t result = vlSkipListSize(list) == count;
+
+    vl_uint64_t k = 0;
+    VL_SKIPLIST_FOREACH(list, iter) {
+        const vl_test_skiplist_record *record = (const vl_test_skiplist_record *) vlSkipListSample(list, iter);
+        while (k < numKeys && !present[k])
+            k++;
+        result = result && record->key == k && record->payload == (vl_uint32_t) (k * 7);
+        k++;
+        count--;
+    }
+    return result && count == 0;
+}
+
+vl_bool_t vlTestSkipListBasic() {
+    vl_bool_t present[VL_TEST_SKIPLIST_KEYS] = {VL_FALSE};
+    vl_skiplist list;
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlSkipListInit(&list, sizeof(vl_test_skiplist_record), vlTestSkipListCompareRecord);
+    result = vlSkipListSize(&list) == 0 && vlSkipListFront(&list) == VL_SKIPLIST_ITER_INVALID;
+
+    vl_dsidx_t removals = 0;
+    for (int step = 0; step < VL_TEST_SKIPLIST_STEPS && result; step++) {
+        vl_test_skiplist_record record = {vlRandBoundedU64(&rand, VL_TEST_SKIPLIST_KEYS), 0}, removed;
+        record.payload = (vl_uint32_t) (record.key * 7);
+
+        if (vlRandBoundedU32(&rand, 3) != 0) {
+            result = vlSkipListInsert(&list, &record) == !present[record.key];
+            present[record.key] = VL_TRUE;
+        } else {
+            result = vlSkipListRemove(&list, &record, &removed) == present[record.key];
+            if (result && present[record.key]) {
+                result = removed.key == record.key && removed.payload == record.payload;
+                removals++;
+            }
+            present[record.key] = VL_FALSE;
+        }
+
+        const vl_skiplist_iter found = vlSkipListFind(&list, &record);
+        result = result && (found != VL_SKIPLIST_ITER_INVALID) == present[record.key];
+    }
+    result = result && vlTestSkipListMatches(&list, present, VL_TEST_SKIPLIST_KEYS);
+
+    // Lower bounds, including past the last key.
+    for (vl_uint64_t k = 0; k <= VL_TEST_SKIPLIST_KEYS && result; k++) {
+        const vl_test_skiplist_record probe = {k, 0};
+        const vl_skiplist_iter iter = vlSkipListLowerBound(&list, &probe);
+        vl_uint64_t expected = k;
+        while (expected < VL_TEST_SKIPLIST_KEYS && !present[expected])
+            expected++;
+
+        if (expected == VL_TEST_SKIPLIST_KEYS)
+            result = iter == VL_SKIPLIST_ITER_INVALID;
+        else
+            result = iter != VL_SKIPLIST_ITER_INVALID &&
+                     ((const vl_test_skiplist_record *) vlSkipListSample(&list, iter))->key == expected;
+    }
+
+    // Removed nodes are recycled by the next insertions without disturbing the present ones.
+    result = result && vlSkipListReclaim(&list) == removals && vlSkipListReclaim(&list) == 0;
+    for (vl_uint64_t k = 0; k < VL_TEST_SKIPLIST_KEYS && result; k++) {
+        const vl_test_skiplist_record record = {k, (vl_uint32_t) (k * 7)};
+        result = vlSkipListInsert(&list, &record) == !present[k];
+        present[k] = VL_TRUE;
+    }
+    result = result && vlTestSkipListMatches(&list, present, VL_TEST_SKIPLIST_KEYS);
+
+    vlSkipListClear(&list);
+    memset(present, 0, sizeof(present));
+    result = result && vlTestSkipListMatches(&list, present, VL_TEST_SKIPLIST_KEYS);
+
+    const vl_test_skiplist_record last = {VL_TEST_SKIPLIST_KEYS - 1, (vl_uint32_t) ((VL_TEST_SKIPLIST_KEYS - 1) * 7)};
+    result = result && vlSkipListInsert(&list, &last) && !vlSkipListInsert(&list, &last);
+    present[last.key] = VL_TRUE;
+    result = result && vlTestSkipListMatches(&list, present, VL_TEST_SKIPLIST_KEYS);
+
+    vlSkipListFree(&list);
+    return result;
+}
+
+typedef struct {
+    vl_skiplist *list;
+    vl_uint64_t first; // First key owned by a writer.
+    vl_atomic_bool_t *writing; // Cleared once every writer has finished.
+    vl_bool_t result;
+} vl_test_skiplist_worker;
+
+/**
+ * Inserts every key of the worker's stride, then removes those inserted at odd steps.
+ */
+static void vlTestSkipListWriter(void *usr) {
+    vl_test_skiplist_worker *worker = (vl_test_skiplist_worker *) usr;
+    worker->result = VL_TRUE;
+
+    for (vl_uint64_t i = 0; i < VL_TEST_SKIPLIST_PER_THREAD; i++) {
+        const vl_uint64_t key = worker->first + i * VL_TEST_SKIPLIST_THREADS;
+        worker->result = worker->result && vlSkipListInsert(worker->list, &key);
+    }
+    for (vl_uint64_t i = 1; i < VL_TEST_SKIPLIST_PER_THREAD; i += 2) {
+        const vl_uint64_t key = worker->first + i * VL_TEST_SKIPLIST_THREADS;
+        const vl_uint64_t missing = key + (vl_uint64_t) VL_TEST_SKIPLIST_PER_THREAD * VL_TEST_SKIPLIST_THREADS;
+        vl_uint64_t removed = 0;
+        worker->result = worker->result && vlSkipListRemove(worker->list, &key, &removed) && removed == key;
+        worker->result = worker->result && !vlSkipListRemove(worker->list, &missing, NULL);
+    }
+}
+
+/**
+ * Scans the list repeatedly while writers run; every scan must be strictly ascending.
+ */
+static void vlTestSkipListReader(void *usr) {
+    vl_test_skiplist_worker *worker = (vl_test_skiplist_worker *) usr;
+    worker->result = VL_TRUE;
+
+    while (worker->result && vlAtomicLoad(worker->writing)) {
+        vl_uint64_t previous = 0;
+        vl_bool_t first = VL_TRUE;
+
+        VL_SKIPLIST_FOREACH(worker->list, iter) {
+            const vl_uint64_t key = *(const vl_uint64_t *) vlSkipListSample(worker->list, iter);
+            worker->result = worker->result && (first || key > previous);
+            previous = key;
+            first = VL_FALSE;
+        }
+
+        const vl_uint64_t probe = worker->first;
+        const vl_skiplist_iter bound = vlSkipListLowerBound(worker->list, &probe);
+        if (bound != VL_SKIPLIST_ITER_INVALID)
+            worker->result = worker->result && *(const vl_uint64_t *) vlSkipListSample(worker->list, bound) >= probe;
+    }
+}
+
+vl_bool_t vlTestSkipListConcurrent() {
+    vl_skiplist *list = vlSkipListNew(sizeof(vl_uint64_t), vlTestSkipListCompareU64);
+    vl_atomic_bool_t writing;
+    vl_test_skiplist_worker writers[VL_TEST_SKIPLIST_THREADS], readers[2];
+    vl_thread writerThreads[VL_TEST_SKIPLIST_THREADS], readerThreads[2];
+    vl_bool_t result = VL_TRUE;
+
+    vlAtomicInit(&writing, VL_TRUE);
+
+    for (int i = 0; i < 2; i++) {
+        readers[i].list = list;
+        readers[i].first = (vl_uint64_t) i * VL_TEST_SKIPLIST_PER_THREAD * VL_TEST_SKIPLIST_THREADS / 2;
+        readers[i].writing = &writing;
+        readerThreads[i] = vlThreadNew(vlTestSkipListReader, &readers[i]);
+    }
+
+    // Writers interleave their keys so that they contend for the same predecessors.
+    for (int i = 0; i < VL_TEST_SKIPLIST_THREADS; i++) {
+        writers[i].list = list;
+        writers[i].first = (vl_uint64_t) i;
+        writers[i].writing = &writing;
+        writerThreads[i] = vlThreadNew(vlTestSkipListWriter, &writers[i]);
+    }
+
+    for (int i = 0; i < VL_TEST_SKIPLIST_THREADS; i++) {
+        vlThreadJoin(writerThreads[i]);
+        vlThreadDelete(writerThreads[i]);
+        result = result && writers[i].result;
+    }
+    vlAtomicStore(&writing, VL_FALSE);
+    for (int i = 0; i < 2; i++) {
+        vlThreadJoin(readerThreads[i]);
+        vlThreadDelete(readerThreads[i]);
+        result = result && readers[i].result;
+    }
+
+    // Exactly the keys each writer inserted at an even step remain, in order.
+    const vl_uint64_t totalKeys = (vl_uint64_t) VL_TEST_SKIPLIST_PER_THREAD * VL_TEST_SKIPLIST_THREADS;
+    vl_uint64_t expected = 0;
+    VL_SKIPLIST_FOREACH(list, iter) {
+        result = result && *(const vl_uint64_t *) vlSkipListSample(list, iter) == expected;
+        expected++;
+        if (expected % VL_TEST_SKIPLIST_THREADS == 0)
+            expected += VL_TEST_SKIPLIST_THREADS;
+    }
+    result = result && expected == totalKeys && vlSkipListSize(list) == totalKeys / 2;
+    result = result && vlSkipListReclaim(list) == totalKeys / 2;
+
+    for (vl_uint64_t key = 0; key < totalKeys && result; key++)
+        result = (vlSkipListFind(list, &key) != VL_SKIPLIST_ITER_INVALID) ==
+                 ((key / VL_TEST_SKIPLIST_THREADS) % 2 == 0);
+
+    vlSkipListDelete(list);
+    return result;
+}
+
+typedef struct {
+    vl_skiplist *list;
+    vl_uint64_t seed;
+    vl_int64_t balance[VL_TEST_SKIPLIST_CONTENDED_KEYS]; // Successful insertions minus successful removals.
+} vl_test_skiplist_contender;
+
+/**
+ * Inserts and removes keys from a small shared range, recording which operations succeeded.
+ */
+static void vlTestSkipListContend(void *usr) {
+    vl_test_skiplist_contender *contender = (vl_test_skiplist_contender *) usr;
+    vl_rand rand = contender->seed;
+
+    for (int step = 0; step < VL_TEST_SKIPLIST_CONTENDED_STEPS; step++) {
+        const vl_uint64_t key = vlRandBoundedU64(&rand, VL_TEST_SKIPLIST_CONTENDED_KEYS);
+        if (vlRandBoundedU32(&rand, 2) == 0)
+            contender->balance[key] += vlSkipListInsert(contender->list, &key) ? 1 : 0;
+        else
+            contender->balance[key] -= vlSkipListRemove(contender->list, &key, NULL) ? 1 : 0;
+    }
+}
+
+vl_bool_t vlTestSkipListContended() {
+    vl_skiplist list;
+    vl_test_skiplist_contender contenders[VL_TEST_SKIPLIST_THREADS];
+    vl_thread threads[VL_TEST_SKIPLIST_THREADS];
+    vl_bool_t result = VL_TRUE;
+
+    vlSkipListInit(&list, sizeof(vl_uint64_t), vlTestSkipListCompareU64);
+
+    for (int i = 0; i < VL_TEST_SKIPLIST_THREADS; i++) {
+        memset(&contenders[i], 0, sizeof(contenders[i]));
+        contenders[i].list = &list;
+        contenders[i].seed = (vl_uint64_t) i * 0x9E3779B97F4A7C15ULL + 1;
+        threads[i] = vlThreadNew(vlTestSkipListContend, &contenders[i]);
+    }
+    for (int i = 0; i < VL_TEST_SKIPLIST_THREADS; i++) {
+        vlThreadJoin(threads[i]);
+        vlThreadDelete(threads[i]);
+    }
+
+    // Every key was inserted at most once more than it was removed, and is present exactly when it was.
+    vl_dsidx_t count = 0;
+    for (vl_uint64_t key = 0; key < VL_TEST_SKIPLIST_CONTENDED_KEYS && result; key++) {
+        vl_int64_t balance = 0;
+        for (int i = 0; i < VL_TEST_SKIPLIST_THREADS; i++)
+            balance += contenders[i].balance[key];
+
+        result = (balance == 0 || balance == 1) &&
+                 (vlSkipListFind(&list, &key) != VL_SKIPLIST_ITER_INVALID) == (balance == 1);
+        count += (vl_dsidx_t) balance;
+    }
+    result = result && vlSkipListSize(&list) == count;
+
+    vlSkipListReclaim(&list);
+    vl_uint64_t previous = 0;
+    VL_SKIPLIST_FOREACH(&list, iter) {
+        const vl_uint64_t key = *(const vl_uint64_t *) vlSkipListSample(&list, iter);
+        result = result && key >= previous && count > 0;
+        previous = key + 1;
+        count--;
+    }
+    result = result && count == 0;
+
+    vlSkipListFree(&list);
+    return result;
+}
+
+typedef struct {
+    vl_skiplist *list; // Either list, or set and lock, are used.
+    vl_set *set;
+    vl_srwlock lock;
+    vl_uint64_t seed;
+} vl_test_skiplist_bench;
+
+/**
+ * Runs a mix of 80% lookups, 10% insertions and 10% removals over random keys.
+ */
+static void vlTestSkipListBenchWorker(void *usr) {
+    vl_test_skiplist_bench *bench = (vl_test_skiplist_bench *) usr;
+    vl_rand rand = bench->seed;
+    vl_dsidx_t found = 0;
+
+    for (int op = 0; op < VL_TEST_SKIPLIST_BENCH_OPS; op++) {
+        const vl_uint64_t roll = vlRandBoundedU64(&rand, 10 * VL_TEST_SKIPLIST_BENCH_KEYS * 2);
+        const vl_uint64_t key = roll / 10, kind = roll % 10;
+
+        if (bench->list) {
+            if (kind == 0)
+                vlSkipListInsert(bench->list, &key);
+            else if (kind == 1)
+                vlSkipListRemove(bench->list, &key, NULL);
+            else
+                found += vlSkipListFind(bench->list, &key) != VL_SKIPLIST_ITER_INVALID;
+        } else if (kind <= 1) {
+            vlSRWLockObtainExclusive(bench->lock);
+            if (kind == 0)
+                vlSetInsert(bench->set, &key);
+            else
+                vlSetRemoveElem(bench->set, &key);
+            vlSRWLockReleaseExclusive(bench->lock);
+        } else {
+            vlSRWLockObtainShared(bench->lock);
+            found += vlSetFind(bench->set, &key) != VL_SET_ITER_INVALID;
+            vlSRWLockReleaseShared(bench->lock);
+        }
+    }
+    (void) found;
+}
+
+/**
+ * Runs the benchmark workers against one structure, returning the wall time in nanoseconds.
+ */
+static vl_ularge_t vlTestSkipListBenchRun(vl_test_skiplist_bench *benches, int numThreads) {
+    vl_thread threads[VL_TEST_SKIPLIST_THREADS];
+    const vl_ularge_t start = vlThreadMonotonicNano();
+
+    for (int i = 0; i < numThreads; i++)
+        threads[i] = vlThreadNew(vlTestSkipListBenchWorker, &benches[i]);
+    for (int i = 0; i < numThreads; i++) {
+        vlThreadJoin(threads[i]);
+        vlThreadDelete(threads[i]);
+    }
+
+    return vlThreadMonotonicNano() - start;
+}
+
+vl_bool_t vlTestSkipListBenchmark() {
+    vl_test_skiplist_bench benches[VL_TEST_SKIPLIST_THREADS];
+    vl_bool_t result = VL_TRUE;
+
+    printf("80%% find, 10%% insert, 10%% remove over %d keys, half present; %d ops per thread, ns per op:\n",
+           VL_TEST_SKIPLIST_BENCH_KEYS * 2, VL_TEST_SKIPLIST_BENCH_OPS);
+    printf("  %7s %20s %16s\n", "threads", "vl_set + srwlock", "vl_skiplist");
+
+    for (int numThreads = 1; numThreads <= VL_TEST_SKIPLIST_THREADS && result; numThreads *= 2) {
+        vl_skiplist *list = vlSkipListNew(sizeof(vl_uint64_t), vlTestSkipListCompareU64);
+        vl_set *set = vlSetNew(sizeof(vl_uint64_t), vlTestSkipListCompareU64);
+        vl_srwlock lock = vlSRWLockNew();
+
+        for (vl_uint64_t key = 0; key < VL_TEST_SKIPLIST_BENCH_KEYS * 2; key += 2) {
+            vlSkipListInsert(list, &key);
+            vlSetInsert(set, &key);
+        }
+
+        for (int i = 0; i < numThreads; i++) {
+            benches[i].list = NULL;
+            benches[i].set = set;
+            benches[i].lock = lock;
+            benches[i].seed = (vl_uint64_t) i * 0x9E3779B97F4A7C15ULL + 7;
+        }
+        const vl_ularge_t setNanos = vlTestSkipListBenchRun(benches, numThreads);
+
+        for (int i = 0; i < numThreads; i++)
+            benches[i].list = list;
+        const vl_ularge_t listNanos = vlTestSkipListBenchRun(benches, numThreads);
+
+        // Both structures saw the same operations in different interleavings, so only sanity is checked.
+        vl_dsidx_t listCount = 0;
+        vl_uint64_t previous = 0;
+        VL_SKIPLIST_FOREACH(list, iter) {
+            const vl_uint64_t key = *(const vl_uint64_t *) vlSkipListSample(list, iter);
+            result = result && (listCount == 0 || key > previous);
+            previous = key;
+            listCount++;
+        }
+        result = result && listCount == vlSkipListSize(list);
+
+        const double ops = (double) numThreads * VL_TEST_SKIPLIST_BENCH_OPS;
+        printf("  %7d %20.1f %16.1f\n", numThreads, (double) setNanos / ops, (double) listNanos / ops);
+
+        vlSRWLockDelete(lock);
+        vlSetDelete(set);
+        vlSkipListDelete(list);
+    }
+
+    return result;
+}
@@ -0,0 +1,24 @@
+#ifndef VL_TEST_SKIPLIST_H
+#define VL_TEST_SKIPLIST_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Mix random insertions and removals of records on one thread; check lookups, bounds, reclamation and clearing.
+VL_TEST_API vl_bool_t vlTestSkipListBasic();
+
+//Writers insert and remove interleaved keys while readers scan; check every scan is ordered and the final contents.
+VL_TEST_API vl_bool_t vlTestSkipListConcurrent();
+
+//Many threads race to insert and remove a few keys; each key must have been inserted at most once more than removed.
+VL_TEST_API vl_bool_t vlTestSkipListContended();
+
+//Time a find-heavy mixed workload against a vl_set guarded by a vl_srwlock, from 1 to 8 threads.
+VL_TEST_API vl_bool_t vlTestSkipListBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_SKIPLIST_H
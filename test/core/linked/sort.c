@@ -0,0 +1,626 @@
+#include "sort.h"
+#include <vl/vl_sort.h>
+#include <vl/vl_memory.h>
+#include <vl/vl_rand.h>
+#include <vl/vl_simd.h>
+#include <vl/vl_thread.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VL_TEST_RADIX_COUNT 50000
+#define VL_TEST_RADIX_PARALLEL_COUNT 1000000
+#define VL_TEST_RADIX_BENCH_COUNT 2000000
+#define VL_TEST_RADIX_WORKERS 4
+#define VL_TEST_PARALLEL_SORT_SCALE_COUNT 1000000
+#define VL_TEST_NUMERIC_BENCH_KEYS (1 << 20)
+#define VL_TEST_TOPK_BENCH_K 100
+
+//Define as 10000000 to reproduce the full-size comparison.
+#ifndef VL_TEST_TOPK_BENCH_COUNT
+#define VL_TEST_TOPK_BENCH_COUNT 1000000
+#endif
+
+#define VL_TEST_RADIX_COMPARATOR(name, type)                                                                        \
+    static vl_int_t name(const void *a, const void *b) {                                                           \
+        type va, vb;                                                                                               \
+        memcpy(&va, a, sizeof(type));                                                                              \
+        memcpy(&vb, b, sizeof(type));                                                                              \
+        return (va > vb) - (va < vb);                                                                              \
+    }
+
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareU8, vl_uint8_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareU16, vl_uint16_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareU32, vl_uint32_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareU64, vl_uint64_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareI8, vl_int8_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareI16, vl_int16_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareI32, vl_int32_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareI64, vl_int64_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareF32, vl_float32_t)
+VL_TEST_RADIX_COMPARATOR(vlTestRadixCompareF64, vl_float64_t)
+
+/**
+ * Fills keys with random values. Floats span many magnitudes and include signed zeros and infinities.
+ */
+static void vlTestRadixFill(void *keys, vl_numtype type, vl_dsidx_t count, vl_rand *rand) {
+    const vl_memsize_t size = vlNumTypeSizeof(type);
+    vl_uint8_t *bytes = (vl_uint8_t *) keys;
+
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        if (type == VL_NUMTYPE_FLOAT32 || type == VL_NUMTYPE_FLOAT64) {
+            const vl_int32_t mantissa = (vl_int32_t) vlRandUInt32(rand);
+            const int exponent = (int) (vlRandUInt32(rand) % 80) - 40;
+            vl_float64_t value = ldexp((vl_float64_t) mantissa, exponent);
+
+            switch (i % 1000) {
+                case 0: value = -0.0; break;
+                case 1: value = 0.0; break;
+                case 2: value = INFINITY; break;
+                case 3: value = -INFINITY; break;
+                default: break;
+            }
+
+            if (type == VL_NUMTYPE_FLOAT32) {
+                const vl_float32_t narrow = (vl_float32_t) value;
+                memcpy(bytes + i * size, &narrow, size);
+            } else {
+                memcpy(bytes + i * size, &value, size);
+            }
+        } else {
+            const vl_uint64_t value = vlRandUInt64(rand);
+            memcpy(bytes + i * size, &value, size);
+        }
+    }
+}
+
+vl_bool_t vlTestSortRadixTypes() {
+    const struct {
+        vl_numtype type;
+        vl_compare_function compare;
+    } cases[] = {
+        {VL_NUMTYPE_UINT8, vlTestRadixCompareU8},   {VL_NUMTYPE_UINT16, vlTestRadixCompareU16},
+        {VL_NUMTYPE_UINT32, vlTestRadixCompareU32}, {VL_NUMTYPE_UINT64, vlTestRadixCompareU64},
+        {VL_NUMTYPE_INT8, vlTestRadixCompareI8},    {VL_NUMTYPE_INT16, vlTestRadixCompareI16},
+        {VL_NUMTYPE_INT32, vlTestRadixCompareI32},  {VL_NUMTYPE_INT64, vlTestRadixCompareI64},
+        {VL_NUMTYPE_FLOAT32, vlTestRadixCompareF32}, {VL_NUMTYPE_FLOAT64, vlTestRadixCompareF64},
+    };
+
+    vl_bool_t result = VL_TRUE;
+    vl_rand rand = vlRandInit();
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]) && result; c++) {
+        const vl_memsize_t size = vlNumTypeSizeof(cases[c].type);
+        vl_uint8_t *keys = (vl_uint8_t *) vlMemAlloc(size * VL_TEST_RADIX_COUNT);
+        vl_uint8_t *expected = (vl_uint8_t *) vlMemAlloc(size * VL_TEST_RADIX_COUNT);
+
+        vlTestRadixFill(keys, cases[c].type, VL_TEST_RADIX_COUNT, &rand);
+        memcpy(expected, keys, size * VL_TEST_RADIX_COUNT);
+
+        result = result && vlSortRadixKeys(keys, VL_TEST_RADIX_COUNT, cases[c].type);
+        vlMemSort(expected, size, VL_TEST_RADIX_COUNT, cases[c].compare);
+
+        //Compare by value rather than bytes; the comparator sort may order -0.0 and +0.0 either way.
+        for (vl_dsidx_t i = 0; i < VL_TEST_RADIX_COUNT && result; i++)
+            result = cases[c].compare(keys + i * size, expected + i * size) == 0;
+
+        vlMemFree((vl_memory *) expected);
+        vlMemFree((vl_memory *) keys);
+    }
+
+    //Invalid key descriptions are rejected without touching the buffer.
+    vl_uint32_t small[4] = {4, 3, 2, 1};
+    result = result && !vlSortRadix(small, sizeof(vl_uint32_t), 4, VL_NUMTYPE_UINT64, 0);
+    result = result && !vlSortRadix(small, sizeof(small), 1, VL_NUMTYPE_UINT32, sizeof(small) - 2);
+    result = result && !vlSortRadix(small, sizeof(vl_uint32_t), 4, VL_NUMTYPE_MAX, 0);
+    result = result && (small[0] == 4 && small[3] == 1);
+
+    return result;
+}
+
+typedef struct {
+    vl_uint32_t sequence;
+    vl_uint32_t pad;
+    vl_int64_t key;
+    vl_uint8_t tail[4];
+} vl_test_radix_record;
+
+vl_bool_t vlTestSortRadixStable(vl_bool_t parallel) {
+    const vl_dsidx_t count = parallel ? VL_TEST_RADIX_PARALLEL_COUNT : VL_TEST_RADIX_COUNT;
+    vl_test_radix_record *records = (vl_test_radix_record *) vlMemAlloc(sizeof(vl_test_radix_record) * count);
+    vl_thread_pool *pool = parallel ? vlThreadPoolNew(VL_TEST_RADIX_WORKERS) : NULL;
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    //Few distinct keys spread across the sign boundary, so every pass sees long runs of equal digits.
+    for (vl_dsidx_t i = 0; i < count; i++) {
+        records[i].sequence = (vl_uint32_t) i;
+        records[i].key = ((vl_int64_t) (vlRandUInt32(&rand) % 16) - 8) * 0x10000001ll;
+        records[i].tail[0] = (vl_uint8_t) records[i].key;
+    }
+
+    result = result && vlSortRadixParallel(pool, records, sizeof(vl_test_radix_record), count, VL_NUMTYPE_INT64,
+                                           offsetof(vl_test_radix_record, key));
+
+    for (vl_dsidx_t i = 1; i < count && result; i++) {
+        const vl_test_radix_record *prev = records + i - 1, *cur = records + i;
+        result = result && (prev->key <= cur->key);
+        result = result && (prev->key != cur->key || prev->sequence < cur->sequence);
+        result = result && (cur->tail[0] == (vl_uint8_t) cur->key);
+    }
+
+    vlThreadPoolDelete(pool);
+    vlMemFree((vl_memory *) records);
+    return result;
+}
+
+vl_bool_t vlTestSortRadixParallel() {
+    const vl_numtype types[] = {VL_NUMTYPE_UINT32, VL_NUMTYPE_INT64, VL_NUMTYPE_FLOAT64};
+    vl_thread_pool *pool = vlThreadPoolNew(VL_TEST_RADIX_WORKERS);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = pool != NULL;
+
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]) && result; t++) {
+        const vl_memsize_t bytes = vlNumTypeSizeof(types[t]) * VL_TEST_RADIX_PARALLEL_COUNT;
+        vl_memory *serial = vlMemAlloc(bytes);
+        vlTestRadixFill(serial, types[t], VL_TEST_RADIX_PARALLEL_COUNT, &rand);
+        vl_memory *parallel = vlMemClone(serial);
+
+        result = result && vlSortRadixKeys(serial, VL_TEST_RADIX_PARALLEL_COUNT, types[t]);
+        result = result && vlSortRadixParallel(pool, parallel, vlNumTypeSizeof(types[t]),
+                                               VL_TEST_RADIX_PARALLEL_COUNT, types[t], 0);
+        result = result && memcmp(serial, parallel, bytes) == 0;
+
+        vlMemFree(parallel);
+        vlMemFree(serial);
+    }
+
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+vl_bool_t vlTestSortRadixBenchmark() {
+    const vl_memsize_t bytes = sizeof(vl_uint64_t) * VL_TEST_RADIX_BENCH_COUNT;
+    vl_memory *original = vlMemAlloc(bytes);
+    vl_memory *work = vlMemAlloc(bytes);
+    vl_thread_pool *pool = vlThreadPoolNew(VL_TEST_RADIX_WORKERS);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlRandFill(&rand, original, bytes);
+
+    memcpy(work, original, bytes);
+    vl_ularge_t start = vlThreadMonotonicNano();
+    vlMemSort(work, sizeof(vl_uint64_t), VL_TEST_RADIX_BENCH_COUNT, vlTestRadixCompareU64);
+    const vl_ularge_t comparatorNanos = vlThreadMonotonicNano() - start;
+    vl_memory *expected = vlMemClone(work);
+
+    memcpy(work, original, bytes);
+    start = vlThreadMonotonicNano();
+    result = result && vlSortRadixKeys(work, VL_TEST_RADIX_BENCH_COUNT, VL_NUMTYPE_UINT64);
+    const vl_ularge_t radixNanos = vlThreadMonotonicNano() - start;
+    result = result && memcmp(work, expected, bytes) == 0;
+
+    memcpy(work, original, bytes);
+    start = vlThreadMonotonicNano();
+    result = result && vlSortRadixParallel(pool, work, sizeof(vl_uint64_t), VL_TEST_RADIX_BENCH_COUNT,
+                                           VL_NUMTYPE_UINT64, 0);
+    const vl_ularge_t parallelNanos = vlThreadMonotonicNano() - start;
+    result = result && memcmp(work, expected, bytes) == 0;
+
+    printf("%d u64 keys: vlMemSort %.1fms, radix %.1fms (%.1fx), radix x%d workers %.1fms (%.1fx)\n",
+           VL_TEST_RADIX_BENCH_COUNT, comparatorNanos / 1e6, radixNanos / 1e6,
+           (double) comparatorNanos / (double) radixNanos, VL_TEST_RADIX_WORKERS, parallelNanos / 1e6,
+           (double) comparatorNanos / (double) parallelNanos);
+
+    vlThreadPoolDelete(pool);
+    vlMemFree(expected);
+    vlMemFree(work);
+    vlMemFree(original);
+    return result;
+}
+
+/**
+ * Sorts a copy of keys with vlSortNumeric and another with vlSortRadixKeys; both order floats by bit pattern.
+ */
+static vl_bool_t vlTestSortNumericMatches(const void *keys, vl_dsidx_t count, vl_numtype type) {
+    const vl_memsize_t bytes = vlNumTypeSizeof(type) * (count ? count : 1);
+    void *actual = vlMemAlloc(bytes);
+    void *expected = vlMemAlloc(bytes);
+    vl_bool_t result;
+
+    memcpy(actual, keys, bytes);
+    memcpy(expected, keys, bytes);
+    result = vlSortNumeric(actual, count, type) && vlSortRadixKeys(expected, count, type);
+    result = result && memcmp(actual, expected, vlNumTypeSizeof(type) * count) == 0;
+
+    vlMemFree((vl_memory *) expected);
+    vlMemFree((vl_memory *) actual);
+    return result;
+}
+
+static vl_bool_t vlTestSortNumericPass(vl_rand *rand) {
+    const vl_dsidx_t sizes[] = {0, 1, 2, 3, 7, 8, 9, 16, 31, 64, 65, 100, 255, 256, 257, 1000, 4097, 100000};
+    const vl_dsidx_t maxCount = 100000;
+    vl_int32_t *keys = (vl_int32_t *) vlMemAlloc(sizeof(vl_uint64_t) * maxCount);
+    vl_bool_t result = VL_TRUE;
+
+    for (int type = VL_NUMTYPE_UINT8; type <= VL_NUMTYPE_FLOAT64 && result; type++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            vlTestRadixFill(keys, (vl_numtype) type, sizes[s], rand);
+            result = vlTestSortNumericMatches(keys, sizes[s], (vl_numtype) type);
+        }
+    }
+
+    //Ordered, reversed and duplicate-heavy 32-bit input exercises the partitioning paths.
+    for (int pattern = 0; pattern < 4 && result; pattern++) {
+        for (vl_dsidx_t i = 0; i < maxCount; i++) {
+            switch (pattern) {
+                case 0: keys[i] = (vl_int32_t) i - 50000; break;
+                case 1: keys[i] = 50000 - (vl_int32_t) i; break;
+                case 2: keys[i] = 7; break;
+                default: keys[i] = (vl_int32_t) (vlRandUInt32(rand) % 3) - 1; break;
+            }
+        }
+        result = vlTestSortNumericMatches(keys, maxCount, VL_NUMTYPE_INT32) &&
+                 vlTestSortNumericMatches(keys, 200, VL_NUMTYPE_UINT32);
+    }
+
+    //NaNs of both signs land at the ends, matching vlSortRadix.
+    const vl_uint32_t nanBits[] = {0x7FC00000u, 0xFFC00000u, 0x3F800000u, 0x80000000u, 0x00000000u, 0xFF800000u};
+    result = result && vlTestSortNumericMatches(nanBits, 6, VL_NUMTYPE_FLOAT32);
+
+    vl_uint32_t untouched[3] = {3, 2, 1};
+    result = result && !vlSortNumeric(untouched, 3, VL_NUMTYPE_MAX) && untouched[0] == 3;
+
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+vl_bool_t vlTestSortNumeric() {
+    vl_rand rand = vlRandInit();
+    //First with whatever backend is active (portable unless another test initialized SIMD), then the best one.
+    vl_bool_t result = vlTestSortNumericPass(&rand);
+    vlSIMDInit();
+    return result && vlTestSortNumericPass(&rand);
+}
+
+vl_bool_t vlTestSortNumericBenchmark() {
+    vl_int32_t *original = (vl_int32_t *) vlMemAlloc(sizeof(vl_int32_t) * 4096);
+    vl_int32_t *work = (vl_int32_t *) vlMemAlloc(sizeof(vl_int32_t) * 4096);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    printf("vlSortNumeric (%s) vs vlMemSort, i32, ns per key:\n", vlSIMDInit());
+
+    for (vl_dsidx_t size = 8; size <= 4096; size <<= 1) {
+        const vl_dsidx_t reps = VL_TEST_NUMERIC_BENCH_KEYS / size;
+        vlRandFill(&rand, original, sizeof(vl_int32_t) * size);
+
+        vl_ularge_t start = vlThreadMonotonicNano();
+        for (vl_dsidx_t r = 0; r < reps; r++) {
+            memcpy(work, original, sizeof(vl_int32_t) * size);
+            vlMemSort(work, sizeof(vl_int32_t), size, vlTestRadixCompareI32);
+        }
+        const vl_ularge_t comparatorNanos = vlThreadMonotonicNano() - start;
+
+        start = vlThreadMonotonicNano();
+        for (vl_dsidx_t r = 0; r < reps; r++) {
+            memcpy(work, original, sizeof(vl_int32_t) * size);
+            vlSortNumeric(work, size, VL_NUMTYPE_INT32);
+        }
+        const vl_ularge_t numericNanos = vlThreadMonotonicNano() - start;
+
+        for (vl_dsidx_t i = 1; i < size && result; i++)
+            result = work[i - 1] <= work[i];
+
+        printf("  %5d: vlMemSort %6.2f, vlSortNumeric %6.2f (%.2fx)\n", (int) size,
+               (double) comparatorNanos / VL_TEST_NUMERIC_BENCH_KEYS, (double) numericNanos / VL_TEST_NUMERIC_BENCH_KEYS,
+               (double) comparatorNanos / (double) numericNanos);
+    }
+
+    vlMemFree((vl_memory *) work);
+    vlMemFree((vl_memory *) original);
+    return result;
+}
+
+static vl_int_t vlTestSortRecordCompare(const void *a, const void *b) {
+    const vl_test_radix_record *ra = (const vl_test_radix_record *) a, *rb = (const vl_test_radix_record *) b;
+    return (ra->key > rb->key) - (ra->key < rb->key);
+}
+
+vl_bool_t vlTestSortParallel() {
+    const vl_dsidx_t sizes[] = {0, 1, 1000, 40000, 333333};
+    const vl_uint_t workers[] = {1, 3, 8};
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (size_t w = 0; w < sizeof(workers) / sizeof(workers[0]) && result; w++) {
+        vl_thread_pool *pool = vlThreadPoolNew(workers[w]);
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            const vl_dsidx_t count = sizes[s];
+            const vl_memsize_t bytes = sizeof(vl_int64_t) * (count ? count : 1);
+            vl_int64_t *parallel = (vl_int64_t *) vlMemAlloc(bytes);
+            vlRandFill(&rand, parallel, bytes);
+            vl_int64_t *serial = (vl_int64_t *) vlMemClone((vl_memory *) parallel);
+
+            result = result && vlMemSortParallel(pool, parallel, sizeof(vl_int64_t), count, vlTestRadixCompareI64);
+            vlMemSort(serial, sizeof(vl_int64_t), count, vlTestRadixCompareI64);
+            result = result && (count == 0 || memcmp(serial, parallel, sizeof(vl_int64_t) * count) == 0);
+
+            vlMemFree((vl_memory *) serial);
+            vlMemFree((vl_memory *) parallel);
+        }
+
+        vlThreadPoolDelete(pool);
+    }
+
+    return result;
+}
+
+vl_bool_t vlTestSortParallelStable() {
+    const vl_dsidx_t sizes[] = {1000, 100000, 250001};
+    vl_thread_pool *pools[] = {NULL, vlThreadPoolNew(4)};
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    for (size_t p = 0; p < 2; p++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            const vl_dsidx_t count = sizes[s];
+            vl_test_radix_record *records =
+                (vl_test_radix_record *) vlMemAlloc(sizeof(vl_test_radix_record) * count);
+
+            for (vl_dsidx_t i = 0; i < count; i++) {
+                records[i].sequence = (vl_uint32_t) i;
+                records[i].key = (vl_int64_t) (vlRandUInt32(&rand) % 64) - 32;
+            }
+
+            result = result && vlMemSortParallelStable(pools[p], records, sizeof(vl_test_radix_record), count,
+                                                       vlTestSortRecordCompare);
+
+            for (vl_dsidx_t i = 1; i < count && result; i++) {
+                const vl_test_radix_record *prev = records + i - 1, *cur = records + i;
+                result = prev->key < cur->key || (prev->key == cur->key && prev->sequence < cur->sequence);
+            }
+
+            vlMemFree((vl_memory *) records);
+        }
+    }
+
+    vlThreadPoolDelete(pools[1]);
+    return result;
+}
+
+vl_bool_t vlTestSortParallelScaling() {
+    const vl_uint_t workers[] = {1, 2, 4, 8, 16, 32};
+    const vl_memsize_t bytes = sizeof(vl_int64_t) * VL_TEST_PARALLEL_SORT_SCALE_COUNT;
+    vl_memory *original = vlMemAlloc(bytes);
+    vl_memory *work = vlMemAlloc(bytes);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlRandFill(&rand, original, bytes);
+
+    memcpy(work, original, bytes);
+    vl_ularge_t start = vlThreadMonotonicNano();
+    vlMemSort(work, sizeof(vl_int64_t), VL_TEST_PARALLEL_SORT_SCALE_COUNT, vlTestRadixCompareI64);
+    const vl_ularge_t serialNanos = vlThreadMonotonicNano() - start;
+    printf("%d i64: vlMemSort %.1fms\n", VL_TEST_PARALLEL_SORT_SCALE_COUNT, serialNanos / 1e6);
+
+    for (size_t w = 0; w < sizeof(workers) / sizeof(workers[0]) && result; w++) {
+        vl_thread_pool *pool = vlThreadPoolNew(workers[w]);
+
+        memcpy(work, original, bytes);
+        start = vlThreadMonotonicNano();
+        result = result && vlMemSortParallel(pool, work, sizeof(vl_int64_t), VL_TEST_PARALLEL_SORT_SCALE_COUNT,
+                                             vlTestRadixCompareI64);
+        const vl_ularge_t unstableNanos = vlThreadMonotonicNano() - start;
+
+        memcpy(work, original, bytes);
+        start = vlThreadMonotonicNano();
+        result = result && vlMemSortParallelStable(pool, work, sizeof(vl_int64_t),
+                                                   VL_TEST_PARALLEL_SORT_SCALE_COUNT, vlTestRadixCompareI64);
+        const vl_ularge_t stableNanos = vlThreadMonotonicNano() - start;
+
+        printf("  %2u workers: parallel %.1fms (%.2fx), stable %.1fms (%.2fx)\n", (unsigned) workers[w],
+               unstableNanos / 1e6, (double) serialNanos / (double) unstableNanos, stableNanos / 1e6,
+               (double) serialNanos / (double) stableNanos);
+
+        vlThreadPoolDelete(pool);
+    }
+
+    vlMemFree(work);
+    vlMemFree(original);
+    return result;
+}
+
+/**
+ * Selects `nth` with vlSortNumericSelect, then radix-sorts each side; the result must equal a full sort.
+ */
+static vl_bool_t vlTestSortSelectMatches(const void *keys, vl_dsidx_t count, vl_numtype type, vl_dsidx_t nth) {
+    const vl_memsize_t size = vlNumTypeSizeof(type);
+    vl_usmall_t *actual = (vl_usmall_t *) vlMemAlloc(size * count);
+    vl_usmall_t *expected = (vl_usmall_t *) vlMemAlloc(size * count);
+    vl_bool_t result;
+
+    memcpy(actual, keys, size * count);
+    memcpy(expected, keys, size * count);
+    result = vlSortNumericSelect(actual, count, type, nth) && vlSortRadixKeys(expected, count, type);
+    result = result && vlSortRadixKeys(actual, nth, type) &&
+             vlSortRadixKeys(actual + (nth + 1) * size, count - nth - 1, type);
+    result = result && memcmp(actual, expected, size * count) == 0;
+
+    vlMemFree((vl_memory *) expected);
+    vlMemFree((vl_memory *) actual);
+    return result;
+}
+
+/**
+ * Partially sorts `prefix` keys with vlSortNumericPartial; the prefix must equal a full sort's and the rest must be a
+ * permutation of the remainder.
+ */
+static vl_bool_t vlTestSortPartialMatches(const void *keys, vl_dsidx_t count, vl_numtype type, vl_dsidx_t prefix) {
+    const vl_memsize_t size = vlNumTypeSizeof(type);
+    vl_usmall_t *actual = (vl_usmall_t *) vlMemAlloc(size * count);
+    vl_usmall_t *expected = (vl_usmall_t *) vlMemAlloc(size * count);
+    vl_bool_t result;
+
+    memcpy(actual, keys, size * count);
+    memcpy(expected, keys, size * count);
+    result = vlSortNumericPartial(actual, count, type, prefix) && vlSortRadixKeys(expected, count, type);
+    result = result && memcmp(actual, expected, size * (prefix < count ? prefix : count)) == 0;
+    result = result && vlSortRadixKeys(actual, count, type) && memcmp(actual, expected, size * count) == 0;
+
+    vlMemFree((vl_memory *) expected);
+    vlMemFree((vl_memory *) actual);
+    return result;
+}
+
+vl_bool_t vlTestSortNumericSelect() {
+    const vl_dsidx_t sizes[] = {1, 2, 3, 100, 129, 1000, 100000};
+    const vl_dsidx_t maxCount = 100000;
+    vl_int32_t *keys = (vl_int32_t *) vlMemAlloc(sizeof(vl_uint64_t) * maxCount);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlSIMDInit();
+
+    for (int type = VL_NUMTYPE_UINT8; type <= VL_NUMTYPE_FLOAT64 && result; type++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && result; s++) {
+            const vl_dsidx_t count = sizes[s];
+            const vl_dsidx_t ranks[] = {0, count / 2, count - 1, vlRandUInt32(&rand) % count};
+            vlTestRadixFill(keys, (vl_numtype) type, count, &rand);
+            for (size_t r = 0; r < sizeof(ranks) / sizeof(ranks[0]) && result; r++)
+                result = vlTestSortSelectMatches(keys, count, (vl_numtype) type, ranks[r]) &&
+                         vlTestSortPartialMatches(keys, count, (vl_numtype) type, ranks[r] + 1);
+        }
+    }
+
+    //Ordered, reversed and duplicate-heavy 32-bit input exercises the partitioning paths.
+    for (int pattern = 0; pattern < 4 && result; pattern++) {
+        for (vl_dsidx_t i = 0; i < maxCount; i++) {
+            switch (pattern) {
+                case 0: keys[i] = (vl_int32_t) i - 50000; break;
+                case 1: keys[i] = 50000 - (vl_int32_t) i; break;
+                case 2: keys[i] = 7; break;
+                default: keys[i] = (vl_int32_t) (vlRandUInt32(&rand) % 3) - 1; break;
+            }
+        }
+        result = vlTestSortSelectMatches(keys, maxCount, VL_NUMTYPE_INT32, maxCount / 3) &&
+                 vlTestSortPartialMatches(keys, maxCount, VL_NUMTYPE_INT32, 100) &&
+                 vlTestSortSelectMatches(keys, maxCount, VL_NUMTYPE_UINT32, 17);
+    }
+
+    vl_uint32_t untouched[3] = {3, 2, 1};
+    result = result && !vlSortNumericSelect(untouched, 3, VL_NUMTYPE_MAX, 0) &&
+             !vlSortNumericSelect(untouched, 3, VL_NUMTYPE_UINT32, 3) && untouched[0] == 3 &&
+             !vlSortNumericPartial(untouched, 3, VL_NUMTYPE_MAX, 1) && untouched[0] == 3;
+
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+static vl_int_t vlTestSortCompareI64Descending(const void *a, const void *b) {
+    return vlTestRadixCompareI64(b, a);
+}
+
+vl_bool_t vlTestSortTopK() {
+    const vl_dsidx_t count = 100000;
+    const vl_dsidx_t ks[] = {0, 1, 100, count, count + 10};
+    vl_int64_t *keys = (vl_int64_t *) vlMemAlloc(sizeof(vl_int64_t) * count);
+    vl_int64_t *sorted = (vl_int64_t *) vlMemAlloc(sizeof(vl_int64_t) * count);
+    vl_int64_t *best = (vl_int64_t *) vlMemAlloc(sizeof(vl_int64_t) * count);
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    //Few distinct values, so ties at the cutoff are common.
+    for (vl_dsidx_t i = 0; i < count; i++)
+        keys[i] = (vl_int64_t) (vlRandUInt32(&rand) % 5000) - 2500;
+    memcpy(sorted, keys, sizeof(vl_int64_t) * count);
+    vlMemSort(sorted, sizeof(vl_int64_t), count, vlTestSortCompareI64Descending);
+
+    for (size_t k = 0; k < sizeof(ks) / sizeof(ks[0]) && result; k++) {
+        vl_topk *topk = vlTopKNew(sizeof(vl_int64_t), ks[k], vlTestSortCompareI64Descending);
+        const vl_dsidx_t expected = ks[k] < count ? ks[k] : count;
+
+        //Stream the first half one at a time and the rest as an array.
+        for (vl_dsidx_t i = 0; i < count / 2; i++)
+            vlTopKPush(topk, keys + i);
+        vlTopKPushArray(topk, keys + count / 2, count - count / 2);
+
+        result = vlTopKSize(topk) == expected && vlTopKSort(topk, best) == expected;
+        result = result && memcmp(best, sorted, sizeof(vl_int64_t) * expected) == 0;
+
+        //Clearing keeps the capacity; a new stream starts from scratch.
+        vlTopKClear(topk);
+        const vl_int64_t one = 1;
+        result = result && vlTopKSize(topk) == 0 && vlTopKPush(topk, &one) == (expected > 0);
+
+        vlTopKDelete(topk);
+    }
+
+    vlMemFree((vl_memory *) best);
+    vlMemFree((vl_memory *) sorted);
+    vlMemFree((vl_memory *) keys);
+    return result;
+}
+
+static vl_int_t vlTestSortCompareI32Descending(const void *a, const void *b) {
+    const vl_int32_t x = *(const vl_int32_t *) a, y = *(const vl_int32_t *) b;
+    return (x < y) - (x > y);
+}
+
+vl_bool_t vlTestSortTopKBenchmark() {
+    const vl_memsize_t bytes = sizeof(vl_int32_t) * VL_TEST_TOPK_BENCH_COUNT;
+    vl_int32_t *original = (vl_int32_t *) vlMemAlloc(bytes);
+    vl_int32_t *work = (vl_int32_t *) vlMemAlloc(bytes);
+    vl_int32_t expected[VL_TEST_TOPK_BENCH_K], streamed[VL_TEST_TOPK_BENCH_K];
+    vl_rand rand = vlRandInit();
+    vl_bool_t result = VL_TRUE;
+
+    vlSIMDInit();
+    vlRandFill(&rand, original, bytes);
+
+    memcpy(work, original, bytes);
+    vl_ularge_t start = vlThreadMonotonicNano();
+    vlMemSort(work, sizeof(vl_int32_t), VL_TEST_TOPK_BENCH_COUNT, vlTestSortCompareI32Descending);
+    const vl_ularge_t sortNanos = vlThreadMonotonicNano() - start;
+    memcpy(expected, work, sizeof(expected));
+
+    memcpy(work, original, bytes);
+    start = vlThreadMonotonicNano();
+    vlMemPartialSort(work, sizeof(vl_int32_t), VL_TEST_TOPK_BENCH_COUNT, VL_TEST_TOPK_BENCH_K,
+                     vlTestSortCompareI32Descending);
+    const vl_ularge_t partialNanos = vlThreadMonotonicNano() - start;
+    result = result && memcmp(work, expected, sizeof(expected)) == 0;
+
+    //The numeric path selects the smallest keys, so negate to select the largest.
+    for (vl_dsidx_t i = 0; i < VL_TEST_TOPK_BENCH_COUNT; i++)
+        work[i] = ~original[i];
+    start = vlThreadMonotonicNano();
+    result = result && vlSortNumericPartial(work, VL_TEST_TOPK_BENCH_COUNT, VL_NUMTYPE_INT32, VL_TEST_TOPK_BENCH_K);
+    const vl_ularge_t numericNanos = vlThreadMonotonicNano() - start;
+    for (vl_dsidx_t i = 0; i < VL_TEST_TOPK_BENCH_K && result; i++)
+        result = ~work[i] == expected[i];
+
+    vl_topk topk;
+    vlTopKInit(&topk, sizeof(vl_int32_t), VL_TEST_TOPK_BENCH_K, vlTestSortCompareI32Descending);
+    start = vlThreadMonotonicNano();
+    vlTopKPushArray(&topk, original, VL_TEST_TOPK_BENCH_COUNT);
+    vlTopKSort(&topk, streamed);
+    const vl_ularge_t topkNanos = vlThreadMonotonicNano() - start;
+    result = result && memcmp(streamed, expected, sizeof(expected)) == 0;
+    vlTopKFree(&topk);
+
+    printf("top %d of %d i32: vlMemSort %.1fms, vlMemPartialSort %.1fms (%.1fx), vlSortNumericPartial %.1fms (%.1fx), "
+           "vl_topk %.1fms (%.1fx)\n",
+           VL_TEST_TOPK_BENCH_K, VL_TEST_TOPK_BENCH_COUNT, sortNanos / 1e6, partialNanos / 1e6,
+           (double) sortNanos / (double) partialNanos, numericNanos / 1e6, (double) sortNanos / (double) numericNanos,
+           topkNanos / 1e6, (double) sortNanos / (double) topkNanos);
+
+    vlMemFree((vl_memory *) work);
+    vlMemFree((vl_memory *) original);
+    return result;
+}
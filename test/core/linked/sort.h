@@ -0,0 +1,48 @@
+#ifndef VL_TEST_SORT_H
+#define VL_TEST_SORT_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Radix-sort random keys of every integer and float type; verify they match a comparator sort.
+VL_TEST_API vl_bool_t vlTestSortRadixTypes();
+
+//Radix-sort records by a key field with few distinct values; verify equal keys keep their input order.
+VL_TEST_API vl_bool_t vlTestSortRadixStable(vl_bool_t parallel);
+
+//Verify the parallel radix sort produces byte-identical output to the serial one.
+VL_TEST_API vl_bool_t vlTestSortRadixParallel();
+
+//Compare radix sort, parallel radix sort and vlMemSort on 64-bit keys.
+VL_TEST_API vl_bool_t vlTestSortRadixBenchmark();
+
+//Sort numeric keys of every type and many lengths with vlSortNumeric, before and after vlSIMDInit; verify against vlSortRadixKeys.
+VL_TEST_API vl_bool_t vlTestSortNumeric();
+
+//Time vlSortNumeric against vlMemSort on 32-bit keys for array sizes 8 through 4096.
+VL_TEST_API vl_bool_t vlTestSortNumericBenchmark();
+
+//Sort random records in parallel at several sizes and pool widths; verify order matches vlMemSort.
+VL_TEST_API vl_bool_t vlTestSortParallel();
+
+//Sort records with many equal keys using the stable parallel sort; verify equal keys keep their input order.
+VL_TEST_API vl_bool_t vlTestSortParallelStable();
+
+//Time the parallel comparator sort with 1 to 32 workers.
+VL_TEST_API vl_bool_t vlTestSortParallelScaling();
+
+//Select ranks and partially sort keys of every type and several input shapes; verify against vlSortRadixKeys.
+VL_TEST_API vl_bool_t vlTestSortNumericSelect();
+
+//Stream duplicate-heavy keys through vl_topk for several k; verify the retained keys match a full sort's prefix.
+VL_TEST_API vl_bool_t vlTestSortTopK();
+
+//Time selecting the top 100 keys with vlMemSort, vlMemPartialSort, vlSortNumericPartial and vl_topk.
+VL_TEST_API vl_bool_t vlTestSortTopKBenchmark();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_SORT_H
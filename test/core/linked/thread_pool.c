@@ -0,0 +1,564 @@
+#include "thread_pool.h"
+#include <vl/vl_thread_pool.h>
+#include <vl/vl_memory.h>
+#include <string.h>
+#include <stdio.h>
+
+#define VL_TEST_POOL_WORKERS 4
+#define VL_TEST_POOL_TASKS 3000
+
+static void vlTestThreadPoolIncrement(void *arg) {
+    vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+}
+
+static void vlTestThreadPoolSleepTask(void *arg) {
+    vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+    vlThreadSleepNano(20000);
+}
+
+vl_bool_t vlTestThreadPoolBasic() {
+    vl_thread_pool *pool = vlThreadPoolNew(VL_TEST_POOL_WORKERS);
+    if (pool == NULL)
+        return VL_FALSE;
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+
+    vl_thread_pool_task task = {.proc = vlTestThreadPoolIncrement, .user_data = &counter};
+
+    //Spread tasks across every tier, giving workers a chance to park in between.
+    for (int i = 0; i < VL_TEST_POOL_TASKS; i++) {
+        vlThreadPoolEnqueuePriority(pool, (vl_thread_pool_priority) (i % VL_THREAD_POOL_PRIORITY_COUNT), &task);
+        if (i % 500 == 0)
+            vlThreadSleep(1);
+    }
+
+    vl_bool_t result = vlThreadPoolWait(pool, 10000);
+
+    vl_thread_pool_stats stats;
+    vlThreadPoolGetStats(pool, &stats);
+
+    result = result && (vlAtomicLoad(&counter) == VL_TEST_POOL_TASKS);
+    result = result && (stats.tasks_completed == VL_TEST_POOL_TASKS);
+    result = result && (vlThreadPoolQueueDepth(pool) == 0);
+
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+vl_bool_t vlTestThreadPoolHistogram() {
+    vl_bool_t result = VL_TRUE;
+
+    //Bucket bounds must be strictly increasing and round-trip through the index mapping.
+    for (vl_uint_t i = 0; i < VL_THREAD_POOL_HISTOGRAM_BUCKETS && result; i++) {
+        const vl_ularge_t lower = vlThreadPoolHistogramBucketLowerBound(i);
+        result = result && (vlThreadPoolHistogramBucketIndex(lower) == i);
+        if (i > 0)
+            result = result && (vlThreadPoolHistogramBucketLowerBound(i - 1) < lower);
+    }
+
+    //Huge values saturate into the final bucket.
+    result = result && (vlThreadPoolHistogramBucketIndex(~(vl_ularge_t) 0) == VL_THREAD_POOL_HISTOGRAM_BUCKETS - 1);
+
+    //Samples 1..1000 ns: the median and p99 estimates must be within one bucket width (12.5%).
+    vl_thread_pool_histogram *hist = vlMemAllocType(vl_thread_pool_histogram);
+    vl_thread_pool_histogram *merged = vlMemAllocType(vl_thread_pool_histogram);
+    memset(hist, 0, sizeof(vl_thread_pool_histogram));
+    memset(merged, 0, sizeof(vl_thread_pool_histogram));
+
+    for (vl_ularge_t v = 1; v <= 1000; v++) {
+        hist->buckets[vlThreadPoolHistogramBucketIndex(v)]++;
+        hist->sum += v;
+    }
+    hist->count = 1000;
+    hist->min = 1;
+    hist->max = 1000;
+
+    const vl_ularge_t p50 = vlThreadPoolHistogramPercentile(hist, 50.0f);
+    const vl_ularge_t p99 = vlThreadPoolHistogramPercentile(hist, 99.0f);
+    result = result && (p50 >= 500 && p50 <= 563);
+    result = result && (p99 >= 990 && p99 <= 1000);
+    result = result && (vlThreadPoolHistogramPercentile(hist, 100.0f) == 1000);
+    result = result && (vlThreadPoolHistogramPercentile(hist, 0.0f) == 1);
+
+    vlThreadPoolHistogramMerge(merged, hist);
+    vlThreadPoolHistogramMerge(merged, hist);
+    result = result && (merged->count == 2000 && merged->min == 1 && merged->max == 1000);
+    result = result && (vlThreadPoolHistogramPercentile(merged, 50.0f) == p50);
+
+    vlMemFree((vl_memory *) hist);
+    vlMemFree((vl_memory *) merged);
+    return result;
+}
+
+vl_bool_t vlTestThreadPoolInstrumentation() {
+    vl_thread_pool *pool = vlThreadPoolNew(VL_TEST_POOL_WORKERS);
+    if (pool == NULL)
+        return VL_FALSE;
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+
+    vl_thread_pool_task task = {.proc = vlTestThreadPoolSleepTask, .user_data = &counter};
+
+    //Untimed tasks are counted but never reach the histograms.
+    for (int i = 0; i < 64; i++)
+        vlThreadPoolEnqueuePriority(pool, VL_THREAD_POOL_PRIORITY_HIGH, &task);
+    vl_bool_t result = vlThreadPoolWait(pool, 10000);
+
+    vlThreadPoolSetInstrumentation(pool, VL_TRUE);
+    for (int i = 0; i < 64; i++)
+        vlThreadPoolEnqueuePriority(pool, VL_THREAD_POOL_PRIORITY_LOW, &task);
+    result = result && vlThreadPoolWait(pool, 10000);
+
+    vl_thread_pool_priority_stats *priStats = vlMemAllocType(vl_thread_pool_priority_stats);
+    vl_thread_pool_worker_stats *workerStats = vlMemAllocType(vl_thread_pool_worker_stats);
+
+    result = result && vlThreadPoolGetPriorityStats(pool, VL_THREAD_POOL_PRIORITY_HIGH, priStats);
+    result = result && (priStats->tasks_executed == 64 && priStats->exec_histogram.count == 0);
+
+    result = result && vlThreadPoolGetPriorityStats(pool, VL_THREAD_POOL_PRIORITY_LOW, priStats);
+    result = result && (priStats->tasks_executed == 64);
+    result = result && (priStats->exec_histogram.count == 64 && priStats->wait_histogram.count == 64);
+
+    //Every task sleeps for at least 20us.
+    result = result && (priStats->exec_histogram.min >= 20000);
+    result = result && (vlThreadPoolHistogramPercentile(&priStats->exec_histogram, 50.0f) >= 20000);
+
+    vl_ularge_t totalTasks = 0, totalSteals = 0, totalTimed = 0;
+    for (vl_uint_t i = 0; i < VL_TEST_POOL_WORKERS && result; i++) {
+        result = result && vlThreadPoolGetWorkerStats(pool, i, workerStats);
+        result = result && (workerStats->idles >= workerStats->parks);
+        totalTasks += workerStats->tasks_executed;
+        totalSteals += workerStats->steals;
+        totalTimed += workerStats->exec_histogram.count;
+    }
+
+    result = result && (totalTasks == 128 && totalSteals == 64 && totalTimed == 64);
+    result = result && !vlThreadPoolGetWorkerStats(pool, VL_TEST_POOL_WORKERS, workerStats);
+
+    vlMemFree((vl_memory *) priStats);
+    vlMemFree((vl_memory *) workerStats);
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+#define VL_TEST_ELASTIC_BURSTS 4
+#define VL_TEST_ELASTIC_BURST_TASKS 400
+#define VL_TEST_ELASTIC_QUIET_MS 60
+#define VL_TEST_ELASTIC_SAMPLE_MS 5
+
+static void vlTestThreadPoolElasticTask(void *arg) {
+    vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+    vlThreadSleepNano(100000);
+}
+
+static void vlTestThreadPoolElasticSample(vl_thread_pool *pool, vl_ularge_t origin, vl_uint_t *peakWorkers) {
+    vl_thread_pool_stats stats;
+    vl_thread_pool_priority_stats *priStats = vlMemAllocType(vl_thread_pool_priority_stats);
+
+    vlThreadPoolGetStats(pool, &stats);
+    vlThreadPoolGetPriorityStats(pool, VL_THREAD_POOL_PRIORITY_MEDIUM, priStats);
+
+    if (stats.worker_count > *peakWorkers)
+        *peakWorkers = stats.worker_count;
+
+    printf("t=%4llums workers=%2u pending=%4u done=%6llu wait_p50=%8lluns wait_p99=%8lluns\n",
+           (unsigned long long) ((vlThreadMonotonicNano() - origin) / 1000000ull),
+           (unsigned) stats.worker_count,
+           (unsigned) (stats.tasksPending[0] + stats.tasksPending[1] + stats.tasksPending[2]),
+           (unsigned long long) stats.tasks_completed,
+           (unsigned long long) vlThreadPoolHistogramPercentile(&priStats->wait_histogram, 50.0f),
+           (unsigned long long) vlThreadPoolHistogramPercentile(&priStats->wait_histogram, 99.0f));
+
+    vlMemFree((vl_memory *) priStats);
+}
+
+vl_bool_t vlTestThreadPoolElastic() {
+    vl_thread_pool_config config;
+    vlThreadPoolConfigDefault(&config);
+    config.min_workers = 1;
+    config.max_workers = 8;
+    config.scale_up_backlog = 4;
+    config.scale_up_delay_ms = 1;
+    config.keepalive_ms = 20;
+
+    vl_thread_pool *pool = vlThreadPoolNewConfig(&config);
+    if (pool == NULL)
+        return VL_FALSE;
+    vlThreadPoolSetInstrumentation(pool, VL_TRUE);
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+    vl_thread_pool_task task = {.proc = vlTestThreadPoolElasticTask, .user_data = &counter};
+
+    vl_uint_t peakWorkers = 0;
+    const vl_ularge_t origin = vlThreadMonotonicNano();
+
+    //Trace: a burst of back-to-back arrivals, followed by a quiet period sampled at a fixed interval.
+    for (int burst = 0; burst < VL_TEST_ELASTIC_BURSTS; burst++) {
+        for (int i = 0; i < VL_TEST_ELASTIC_BURST_TASKS; i++) {
+            vlThreadPoolEnqueue(pool, &task);
+            if (i % 50 == 0)
+                vlTestThreadPoolElasticSample(pool, origin, &peakWorkers);
+        }
+
+        for (int t = 0; t < VL_TEST_ELASTIC_QUIET_MS; t += VL_TEST_ELASTIC_SAMPLE_MS) {
+            vlThreadSleep(VL_TEST_ELASTIC_SAMPLE_MS);
+            vlTestThreadPoolElasticSample(pool, origin, &peakWorkers);
+        }
+    }
+
+    vl_bool_t result = vlThreadPoolWait(pool, 10000);
+    result = result && (vlAtomicLoad(&counter) == VL_TEST_ELASTIC_BURSTS * VL_TEST_ELASTIC_BURST_TASKS);
+    result = result && (peakWorkers > config.min_workers && peakWorkers <= config.max_workers);
+
+    //Once idle, surplus workers must retire back down to the minimum.
+    vl_thread_pool_stats stats;
+    for (int i = 0; i < 200; i++) {
+        vlThreadPoolGetStats(pool, &stats);
+        if (stats.worker_count == config.min_workers)
+            break;
+        vlThreadSleep(10);
+    }
+    vlTestThreadPoolElasticSample(pool, origin, &peakWorkers);
+
+    result = result && (stats.worker_count == config.min_workers);
+    result = result && (stats.workers_retired > 0);
+    result = result && (stats.workers_spawned == stats.workers_retired + stats.worker_count);
+
+    //The pool must still accept and run work after shrinking.
+    vlThreadPoolEnqueue(pool, &task);
+    result = result && vlThreadPoolWait(pool, 10000);
+
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+#define VL_TEST_BACKPRESSURE_TASKS 5000
+#define VL_TEST_BACKPRESSURE_CAPACITY 64
+
+static void vlTestThreadPoolSpinTask(void *arg) {
+    vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+    const vl_ularge_t until = vlThreadMonotonicNano() + 2000;
+    while (vlThreadMonotonicNano() < until);
+}
+
+static void vlTestThreadPoolStallTask(void *arg) {
+    vlAtomicFetchAdd((vl_atomic_uint32_t *) arg, 1);
+    vlThreadSleep(20);
+}
+
+//Floods a single-worker pool far faster than it drains and reports how deep the queue got.
+static vl_bool_t vlTestThreadPoolFlood(vl_uint_t capacity, vl_thread_pool_overflow_policy policy, const char *label) {
+    vl_thread_pool_config config;
+    vlThreadPoolConfigDefault(&config);
+    config.queue_capacity[VL_THREAD_POOL_PRIORITY_MEDIUM] = capacity;
+    config.overflow_policy = policy;
+
+    vl_thread_pool *pool = vlThreadPoolNewConfig(&config);
+    if (pool == NULL)
+        return VL_FALSE;
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+    vl_thread_pool_task task = {.proc = vlTestThreadPoolSpinTask, .user_data = &counter};
+
+    vl_uint_t accepted = 0;
+    for (int i = 0; i < VL_TEST_BACKPRESSURE_TASKS; i++) {
+        if (vlThreadPoolEnqueue(pool, &task))
+            accepted++;
+    }
+
+    vl_bool_t result = vlThreadPoolWait(pool, 10000);
+
+    vl_thread_pool_stats stats;
+    vlThreadPoolGetStats(pool, &stats);
+    const vl_uint32_t peak = stats.tasks_pending_peak[VL_THREAD_POOL_PRIORITY_MEDIUM];
+    const vl_uint16_t blocks = vlAtomicLoad(&pool->workQueues[VL_THREAD_POOL_PRIORITY_MEDIUM]->elements.totalBlocks);
+
+    printf("%-12s accepted=%5u rejected=%5llu caller_ran=%5llu peak_depth=%5u pool_blocks=%2u\n",
+           label, (unsigned) accepted,
+           (unsigned long long) stats.tasks_rejected,
+           (unsigned long long) stats.tasks_caller_ran,
+           (unsigned) peak, (unsigned) blocks);
+
+    result = result && (vlAtomicLoad(&counter) == accepted);
+    result = result && (accepted + stats.tasks_rejected == VL_TEST_BACKPRESSURE_TASKS);
+
+    if (capacity > 0) {
+        result = result && (peak <= capacity);
+        //A bounded tier never needs more than a few geometrically-grown pool blocks.
+        result = result && (blocks <= 4);
+    }
+
+    switch (policy) {
+        case VL_THREAD_POOL_OVERFLOW_BLOCK:
+            result = result && (accepted == VL_TEST_BACKPRESSURE_TASKS);
+            break;
+        case VL_THREAD_POOL_OVERFLOW_CALLER_RUNS:
+            result = result && (accepted == VL_TEST_BACKPRESSURE_TASKS);
+            result = result && (capacity == 0 || stats.tasks_caller_ran > 0);
+            break;
+        default:
+            break;
+    }
+
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+vl_bool_t vlTestThreadPoolBackpressure() {
+    vl_bool_t result = VL_TRUE;
+
+    //Unbounded baseline for comparison; the queue absorbs the whole flood.
+    result = result && vlTestThreadPoolFlood(0, VL_THREAD_POOL_OVERFLOW_BLOCK, "unbounded");
+    result = result && vlTestThreadPoolFlood(VL_TEST_BACKPRESSURE_CAPACITY, VL_THREAD_POOL_OVERFLOW_FAIL, "fail");
+    result = result && vlTestThreadPoolFlood(VL_TEST_BACKPRESSURE_CAPACITY, VL_THREAD_POOL_OVERFLOW_BLOCK, "block");
+    result = result && vlTestThreadPoolFlood(VL_TEST_BACKPRESSURE_CAPACITY, VL_THREAD_POOL_OVERFLOW_CALLER_RUNS,
+                                             "caller_runs");
+
+    //A blocking producer with a timeout gives up rather than waiting forever on a stalled tier.
+    vl_thread_pool_config config;
+    vlThreadPoolConfigDefault(&config);
+    config.queue_capacity[VL_THREAD_POOL_PRIORITY_MEDIUM] = 1;
+    config.block_timeout_ms = 5;
+
+    vl_thread_pool *pool = vlThreadPoolNewConfig(&config);
+    if (pool == NULL)
+        return VL_FALSE;
+
+    vl_atomic_uint32_t counter;
+    vlAtomicInit(&counter, 0);
+    vl_thread_pool_task slow = {.proc = vlTestThreadPoolStallTask, .user_data = &counter};
+
+    //Occupy the worker and the single slot, then time out on the third.
+    vl_uint_t accepted = 0;
+    for (int i = 0; i < 8; i++) {
+        if (vlThreadPoolEnqueue(pool, &slow))
+            accepted++;
+    }
+    result = result && vlThreadPoolWait(pool, 10000);
+
+    vl_thread_pool_stats stats;
+    vlThreadPoolGetStats(pool, &stats);
+    result = result && (vlAtomicLoad(&counter) == accepted);
+    result = result && (accepted + stats.tasks_rejected == 8);
+    result = result && (stats.tasks_rejected > 0);
+
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+#define VL_TEST_SCHEDULE_HIGH 70
+#define VL_TEST_SCHEDULE_LOW 10
+#define VL_TEST_SCHEDULE_TOTAL (VL_TEST_SCHEDULE_HIGH + VL_TEST_SCHEDULE_LOW)
+
+typedef struct {
+    vl_atomic_uint32_t next;
+    vl_atomic_bool_t started;
+    vl_atomic_bool_t open;
+    vl_int_t order[VL_TEST_SCHEDULE_TOTAL];
+} vl_test_schedule_trace;
+
+typedef struct {
+    vl_test_schedule_trace *trace;
+    vl_int_t priority;
+} vl_test_schedule_item;
+
+static void vlTestThreadPoolGateTask(void *arg) {
+    vl_test_schedule_trace *trace = (vl_test_schedule_trace *) arg;
+    vlAtomicStore(&trace->started, VL_TRUE);
+    while (!vlAtomicLoad(&trace->open))
+        vlThreadSleepNano(100000);
+}
+
+static void vlTestThreadPoolTraceTask(void *arg) {
+    vl_test_schedule_item *item = (vl_test_schedule_item *) arg;
+    const vl_uint32_t slot = vlAtomicFetchAdd(&item->trace->next, 1);
+    item->trace->order[slot] = item->priority;
+    vlThreadSleepNano(1000000);
+}
+
+/**
+ * Runs the HIGH/LOW trace through a single-worker pool under `policy` and reports where LOW work landed.
+ */
+static vl_bool_t vlTestThreadPoolScheduleRun(vl_thread_pool_schedule_policy policy, const char *label,
+                                             vl_int_t *firstLow, vl_int_t *lastLow, vl_ularge_t *promoted,
+                                             vl_ularge_t *steals) {
+    vl_thread_pool_config config;
+    vlThreadPoolConfigDefault(&config);
+    config.min_workers = 1;
+    config.max_workers = 1;
+    config.schedule_policy = policy;
+    config.aging_threshold_ms[VL_THREAD_POOL_PRIORITY_LOW] = 5;
+
+    vl_thread_pool *pool = vlThreadPoolNewConfig(&config);
+    if (pool == NULL)
+        return VL_FALSE;
+
+    vl_test_schedule_trace trace;
+    vlAtomicInit(&trace.next, 0);
+    vlAtomicInit(&trace.started, VL_FALSE);
+    vlAtomicInit(&trace.open, VL_FALSE);
+    vlThreadPoolSetInstrumentation(pool, VL_TRUE);
+
+    vl_test_schedule_item high = {.trace = &trace, .priority = VL_THREAD_POOL_PRIORITY_HIGH};
+    vl_test_schedule_item low = {.trace = &trace, .priority = VL_THREAD_POOL_PRIORITY_LOW};
+
+    //Hold the only worker so the whole trace is queued before any of it is scheduled.
+    vl_thread_pool_task gate = {.proc = vlTestThreadPoolGateTask, .user_data = &trace};
+    vl_bool_t result = vlThreadPoolEnqueuePriority(pool, VL_THREAD_POOL_PRIORITY_MEDIUM, &gate);
+    while (result && !vlAtomicLoad(&trace.started))
+        vlThreadSleepNano(100000);
+
+    vl_thread_pool_task highTask = {.proc = vlTestThreadPoolTraceTask, .user_data = &high};
+    vl_thread_pool_task lowTask = {.proc = vlTestThreadPoolTraceTask, .user_data = &low};
+    for (int i = 0; i < VL_TEST_SCHEDULE_HIGH; i++)
+        result = result && vlThreadPoolEnqueuePriority(pool, VL_THREAD_POOL_PRIORITY_HIGH, &highTask);
+    for (int i = 0; i < VL_TEST_SCHEDULE_LOW; i++)
+        result = result && vlThreadPoolEnqueuePriority(pool, VL_THREAD_POOL_PRIORITY_LOW, &lowTask);
+
+    vlAtomicStore(&trace.open, VL_TRUE);
+    result = result && vlThreadPoolWait(pool, 10000);
+    result = result && (vlAtomicLoad(&trace.next) == VL_TEST_SCHEDULE_TOTAL);
+
+    *firstLow = -1;
+    *lastLow = -1;
+    for (vl_int_t i = 0; result && i < VL_TEST_SCHEDULE_TOTAL; i++) {
+        if (trace.order[i] != VL_THREAD_POOL_PRIORITY_LOW)
+            continue;
+        if (*firstLow < 0)
+            *firstLow = i;
+        *lastLow = i;
+    }
+
+    vl_thread_pool_priority_stats stats;
+    vlThreadPoolGetPriorityStats(pool, VL_THREAD_POOL_PRIORITY_LOW, &stats);
+    *promoted = stats.tasks_promoted;
+
+    vl_thread_pool_worker_stats workerStats;
+    vlThreadPoolGetWorkerStats(pool, 0, &workerStats);
+    *steals = workerStats.steals;
+
+    printf("%-9s first_low=%2d last_low=%2d promoted=%2llu low_wait_p99=%lluns\n", label, (int) *firstLow,
+           (int) *lastLow, (unsigned long long) stats.tasks_promoted,
+           (unsigned long long) vlThreadPoolHistogramPercentile(&stats.wait_histogram, 99.0f));
+
+    vlThreadPoolDelete(pool);
+    return result;
+}
+
+vl_bool_t vlTestThreadPoolScheduling() {
+    vl_int_t firstLow, lastLow;
+    vl_ularge_t promoted, steals;
+    vl_bool_t result = VL_TRUE;
+
+    //Strict priority starves LOW until the HIGH flood drains.
+    result = result && vlTestThreadPoolScheduleRun(VL_THREAD_POOL_SCHEDULE_STRICT, "strict", &firstLow, &lastLow,
+                                                   &promoted, &steals);
+    //Every LOW task and the MEDIUM gate fell through the cascade.
+    result = result && (firstLow == VL_TEST_SCHEDULE_HIGH) && (promoted == 0) && (steals == VL_TEST_SCHEDULE_LOW + 1);
+
+    //4:2:1 weights interleave one LOW per four HIGH.
+    result = result && vlTestThreadPoolScheduleRun(VL_THREAD_POOL_SCHEDULE_WEIGHTED, "weighted", &firstLow, &lastLow,
+                                                   &promoted, &steals);
+    result = result && (firstLow >= 0) && (lastLow < 60) && (steals == 0);
+
+    //Aging promotes LOW once it has waited past its threshold.
+    result = result && vlTestThreadPoolScheduleRun(VL_THREAD_POOL_SCHEDULE_AGING, "aging", &firstLow, &lastLow,
+                                                   &promoted, &steals);
+    //Promoted LOW tasks are not steals.
+    result = result && (firstLow >= 0) && (firstLow < 20) && (promoted > 0) &&
+             (steals + promoted <= VL_TEST_SCHEDULE_LOW + 1);
+
+    return result;
+}
+
+#define VL_TEST_PARALLEL_FOR_COUNT 1000
+
+typedef struct {
+    vl_thread_pool *pool;
+    vl_atomic_uint32_t hits[VL_TEST_PARALLEL_FOR_COUNT];
+    vl_atomic_bool_t nestedDone;
+    vl_atomic_bool_t tierFull;
+} vl_test_parallel_for;
+
+static void vlTestThreadPoolForBody(void *arg, vl_uint_t index) {
+    vl_test_parallel_for *state = (vl_test_parallel_for *) arg;
+    vlAtomicFetchAdd(&state->hits[index], 1);
+}
+
+static void vlTestThreadPoolForNested(void *arg) {
+    vl_test_parallel_for *state = (vl_test_parallel_for *) arg;
+    vlThreadPoolParallelFor(state->pool, VL_TEST_PARALLEL_FOR_COUNT, vlTestThreadPoolForBody, state);
+    vlAtomicStore(&state->nestedDone, VL_TRUE);
+}
+
+static void vlTestThreadPoolForGated(void *arg) {
+    vl_test_parallel_for *state = (vl_test_parallel_for *) arg;
+    while (!vlAtomicLoad(&state->tierFull))
+        vlThreadYield();
+    vlTestThreadPoolForNested(arg);
+}
+
+static void vlTestThreadPoolForFiller(void *arg) {
+    (void) arg;
+}
+
+static vl_bool_t vlTestThreadPoolForCheck(vl_test_parallel_for *state, vl_uint32_t expected) {
+    for (int i = 0; i < VL_TEST_PARALLEL_FOR_COUNT; i++) {
+        if (vlAtomicLoad(&state->hits[i]) != expected)
+            return VL_FALSE;
+    }
+    return VL_TRUE;
+}
+
+vl_bool_t vlTestThreadPoolParallelFor() {
+    vl_test_parallel_for *state = (vl_test_parallel_for *) vlMemAlloc(sizeof(vl_test_parallel_for));
+    for (int i = 0; i < VL_TEST_PARALLEL_FOR_COUNT; i++)
+        vlAtomicInit(&state->hits[i], 0);
+    vlAtomicInit(&state->nestedDone, VL_FALSE);
+    vlAtomicInit(&state->tierFull, VL_FALSE);
+
+    vl_bool_t result = VL_TRUE;
+
+    //No pool runs everything on the caller.
+    vlThreadPoolParallelFor(NULL, VL_TEST_PARALLEL_FOR_COUNT, vlTestThreadPoolForBody, state);
+    result = result && vlTestThreadPoolForCheck(state, 1);
+
+    state->pool = vlThreadPoolNew(VL_TEST_POOL_WORKERS);
+    vlThreadPoolParallelFor(state->pool, VL_TEST_PARALLEL_FOR_COUNT, vlTestThreadPoolForBody, state);
+    result = result && vlTestThreadPoolForCheck(state, 2);
+    vlThreadPoolDelete(state->pool);
+
+    //A loop started from the only worker must not wait on helpers that can never be scheduled.
+    state->pool = vlThreadPoolNew(1);
+    vl_thread_pool_task nested = {.proc = vlTestThreadPoolForNested, .user_data = state};
+    result = result && vlThreadPoolEnqueue(state->pool, &nested);
+    result = result && vlThreadPoolWait(state->pool, 10000);
+    result = result && vlAtomicLoad(&state->nestedDone) && vlTestThreadPoolForCheck(state, 3);
+    vlThreadPoolDelete(state->pool);
+
+    //Nor may it block for space in a full tier whose only consumer is the thread making the call.
+    vl_thread_pool_config config;
+    vlThreadPoolConfigDefault(&config);
+    config.queue_capacity[VL_THREAD_POOL_PRIORITY_MEDIUM] = 1;
+    config.overflow_policy = VL_THREAD_POOL_OVERFLOW_BLOCK;
+    config.block_timeout_ms = 0;
+    state->pool = vlThreadPoolNewConfig(&config);
+    vlAtomicStore(&state->nestedDone, VL_FALSE);
+
+    vl_thread_pool_task gated = {.proc = vlTestThreadPoolForGated, .user_data = state};
+    vl_thread_pool_task filler = {.proc = vlTestThreadPoolForFiller, .user_data = NULL};
+    result = result && vlThreadPoolEnqueue(state->pool, &gated);
+    //Fits once the worker has taken the gated task, leaving the tier full while that task runs the loop.
+    result = result && vlThreadPoolEnqueue(state->pool, &filler);
+    vlAtomicStore(&state->tierFull, VL_TRUE);
+    result = result && vlThreadPoolWait(state->pool, 10000);
+    result = result && vlAtomicLoad(&state->nestedDone) && vlTestThreadPoolForCheck(state, 4);
+    vlThreadPoolDelete(state->pool);
+
+    vlMemFree((vl_memory *) state);
+    return result;
+}
@@ -0,0 +1,33 @@
+#ifndef VL_TEST_THREAD_POOL_H
+#define VL_TEST_THREAD_POOL_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <vl/vl_numtypes.h>
+
+//Enqueue work on every priority tier and verify each task runs exactly once.
+VL_TEST_API vl_bool_t vlTestThreadPoolBasic();
+
+//Verify histogram bucket mapping and percentile estimation on known samples.
+VL_TEST_API vl_bool_t vlTestThreadPoolHistogram();
+
+//Verify per-worker counters and per-priority timing histograms are populated.
+VL_TEST_API vl_bool_t vlTestThreadPoolInstrumentation();
+
+//Replay a bursty arrival trace against an elastic pool; verify it grows under load and retires when idle.
+VL_TEST_API vl_bool_t vlTestThreadPoolElastic();
+
+//Flood bounded tiers under each overflow policy; verify depth stays bounded and every task is accounted for.
+VL_TEST_API vl_bool_t vlTestThreadPoolBackpressure();
+
+//Queue a HIGH flood ahead of a few LOW tasks; verify strict, weighted, and aging policies order them as documented.
+VL_TEST_API vl_bool_t vlTestThreadPoolScheduling();
+
+//Run parallel loops from outside and inside a single-worker pool, including a full bounded one; verify each index once.
+VL_TEST_API vl_bool_t vlTestThreadPoolParallelFor();
+
+#ifdef __cplusplus
+}
+#endif
+#endif //VL_TEST_THREAD_POOL_H
@@ -28,4 +28,44 @@ INSTANTIATE_TEST_SUITE_P(
 
 TEST(memory, reverse) {
     ASSERT_TRUE(vlTestMemReverse());
-}
\ No newline at end of file
+}
+
+TEST(memory, copy_stride) {
+    ASSERT_TRUE(vlTestMemCopyStride());
+}
+
+TEST(memory, reverse_stride) {
+    ASSERT_TRUE(vlTestMemReverseStride());
+}
+
+TEST(memory, stride_benchmark) {
+    ASSERT_TRUE(vlTestMemStrideBenchmark());
+}
+class MemorySortPatternTest : public testing::TestWithParam<std::tuple<vl_test_sort_pattern, vl_memsize_t>> {};
+
+TEST_P(MemorySortPatternTest, sort) {
+    const auto [pattern, elementSize] = GetParam();
+    ASSERT_TRUE(vlTestMemSortPattern(pattern, elementSize, 10000));
+    ASSERT_TRUE(vlTestMemSortPattern(pattern, elementSize, 100));
+}
+
+TEST_P(MemorySortPatternTest, select) {
+    const auto [pattern, elementSize] = GetParam();
+    ASSERT_TRUE(vlTestMemSelectPattern(pattern, elementSize, 10000));
+    ASSERT_TRUE(vlTestMemSelectPattern(pattern, elementSize, 100));
+}
+
+TEST_P(MemorySortPatternTest, partial_sort) {
+    const auto [pattern, elementSize] = GetParam();
+    ASSERT_TRUE(vlTestMemPartialSortPattern(pattern, elementSize, 10000));
+    ASSERT_TRUE(vlTestMemPartialSortPattern(pattern, elementSize, 100));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    memory, MemorySortPatternTest,
+    testing::Combine(
+        testing::Values(VL_TEST_SORT_RANDOM, VL_TEST_SORT_SORTED, VL_TEST_SORT_REVERSED,
+                        VL_TEST_SORT_FEW_UNIQUE, VL_TEST_SORT_ORGAN_PIPE),
+        testing::Values(4, 8, 12, 16, 100)
+    )
+);
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/numtypes.h"
+}
+
+TEST(numtypes, cast_array) {
+    EXPECT_TRUE(vlTestNumTypeCastArray());
+}
+
+TEST(numtypes, cast_array_benchmark) {
+    EXPECT_TRUE(vlTestNumTypeCastArrayBenchmark());
+}
@@ -14,4 +14,8 @@ TEST(queue, fifo) {
 
 TEST(queue, clone) {
     EXPECT_TRUE(vlTestQueueClone());
+}
+
+TEST(queue, bulk) {
+    EXPECT_TRUE(vlTestQueueBulk());
 }
\ No newline at end of file
@@ -9,6 +9,46 @@ TEST(random, rand_vec4f) {
     EXPECT_TRUE(vlTestRandomVec4f());
 }
 
+TEST(random, xoshiro_reference) {
+    EXPECT_TRUE(vlTestRandomXoshiroReference());
+}
+
+TEST(random, xoshiro_jump) {
+    EXPECT_TRUE(vlTestRandomXoshiroJump());
+}
+
+TEST(random, xoshiro_quality) {
+    EXPECT_TRUE(vlTestRandomXoshiroQuality());
+}
+
+TEST(random, xoshiro_benchmark) {
+    EXPECT_TRUE(vlTestRandomXoshiroBenchmark());
+}
+
+TEST(random, bounded) {
+    EXPECT_TRUE(vlTestRandomBounded());
+}
+
+TEST(random, normal_exponential) {
+    EXPECT_TRUE(vlTestRandomNormalExponential());
+}
+
+TEST(random, shuffle) {
+    EXPECT_TRUE(vlTestRandomShuffle());
+}
+
+TEST(random, reservoir) {
+    EXPECT_TRUE(vlTestRandomReservoir());
+}
+
+TEST(random, alias) {
+    EXPECT_TRUE(vlTestRandomAlias());
+}
+
+TEST(random, distribution_benchmark) {
+    EXPECT_TRUE(vlTestRandomDistributionBenchmark());
+}
+
 class RandomFillTest : public testing::TestWithParam<vl_memsize_t> {};
 
 TEST_P(RandomFillTest, fill) {
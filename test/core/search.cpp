@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/search.h"
+}
+
+TEST(search, bounds) {
+    EXPECT_TRUE(vlTestSearchBounds());
+}
+
+TEST(search, batch) {
+    EXPECT_TRUE(vlTestSearchBatch());
+}
+
+TEST(search, eytzinger) {
+    EXPECT_TRUE(vlTestSearchEytzinger());
+}
+
+TEST(search, benchmark) {
+    EXPECT_TRUE(vlTestSearchBenchmark());
+}
@@ -12,6 +12,26 @@ TEST(set, order) {
     EXPECT_TRUE(vlTestSetOrder());
 }
 
+TEST(set, build_sorted) {
+    EXPECT_TRUE(vlTestSetBuildSorted());
+}
+
+TEST(set, algebra) {
+    EXPECT_TRUE(vlTestSetAlgebra());
+}
+
+TEST(set, algebra_benchmark) {
+    EXPECT_TRUE(vlTestSetAlgebraBenchmark());
+}
+
+TEST(set, order_statistics) {
+    EXPECT_TRUE(vlTestSetOrderStatistics());
+}
+
+TEST(set, rank_benchmark) {
+    EXPECT_TRUE(vlTestSetRankBenchmark());
+}
+
 class SetIterateTest : public testing::TestWithParam<vl_bool_t> {};
 
 TEST_P(SetIterateTest, iterate) {
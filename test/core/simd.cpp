@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/simd.h"
+}
+
+TEST(simd, reductions) {
+    EXPECT_TRUE(vlTestSIMDReductions());
+}
+
+TEST(simd, transforms) {
+    EXPECT_TRUE(vlTestSIMDTransforms());
+}
+
+TEST(simd, compare) {
+    EXPECT_TRUE(vlTestSIMDCompare());
+}
+
+TEST(simd, wide_vectors) {
+    EXPECT_TRUE(vlTestSIMDWideVectors());
+}
+
+TEST(simd, byte_scan) {
+    EXPECT_TRUE(vlTestSIMDByteScan());
+}
+
+TEST(simd, half) {
+    EXPECT_TRUE(vlTestSIMDHalf());
+}
+
+TEST(simd, benchmark) {
+    EXPECT_TRUE(vlTestSIMDBenchmark());
+}
+
+TEST(simd, byte_scan_benchmark) {
+    EXPECT_TRUE(vlTestSIMDByteScanBenchmark());
+}
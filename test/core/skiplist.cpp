@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/skiplist.h"
+}
+
+TEST(skiplist, basic) {
+    EXPECT_TRUE(vlTestSkipListBasic());
+}
+
+TEST(skiplist, concurrent) {
+    EXPECT_TRUE(vlTestSkipListConcurrent());
+}
+
+TEST(skiplist, contended) {
+    EXPECT_TRUE(vlTestSkipListContended());
+}
+
+TEST(skiplist, benchmark) {
+    EXPECT_TRUE(vlTestSkipListBenchmark());
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/sort.h"
+}
+
+TEST(sort, radix_types) {
+    EXPECT_TRUE(vlTestSortRadixTypes());
+}
+
+TEST(sort, radix_stable) {
+    EXPECT_TRUE(vlTestSortRadixStable(VL_FALSE));
+    EXPECT_TRUE(vlTestSortRadixStable(VL_TRUE));
+}
+
+TEST(sort, radix_parallel) {
+    EXPECT_TRUE(vlTestSortRadixParallel());
+}
+
+TEST(sort, radix_benchmark) {
+    EXPECT_TRUE(vlTestSortRadixBenchmark());
+}
+
+TEST(sort, numeric) {
+    EXPECT_TRUE(vlTestSortNumeric());
+}
+
+TEST(sort, numeric_benchmark) {
+    EXPECT_TRUE(vlTestSortNumericBenchmark());
+}
+
+TEST(sort, parallel) {
+    EXPECT_TRUE(vlTestSortParallel());
+}
+
+TEST(sort, parallel_stable) {
+    EXPECT_TRUE(vlTestSortParallelStable());
+}
+
+TEST(sort, parallel_scaling) {
+    EXPECT_TRUE(vlTestSortParallelScaling());
+}
+
+TEST(sort, numeric_select) {
+    EXPECT_TRUE(vlTestSortNumericSelect());
+}
+
+TEST(sort, topk) {
+    EXPECT_TRUE(vlTestSortTopK());
+}
+
+TEST(sort, topk_benchmark) {
+    EXPECT_TRUE(vlTestSortTopKBenchmark());
+}
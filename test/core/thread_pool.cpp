@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "linked/thread_pool.h"
+}
+
+TEST(thread_pool, basic) {
+    EXPECT_TRUE(vlTestThreadPoolBasic());
+}
+
+TEST(thread_pool, histogram) {
+    EXPECT_TRUE(vlTestThreadPoolHistogram());
+}
+
+TEST(thread_pool, instrumentation) {
+    EXPECT_TRUE(vlTestThreadPoolInstrumentation());
+}
+
+TEST(thread_pool, elastic) {
+    EXPECT_TRUE(vlTestThreadPoolElastic());
+}
+
+TEST(thread_pool, backpressure) {
+    EXPECT_TRUE(vlTestThreadPoolBackpressure());
+}
+
+TEST(thread_pool, scheduling) {
+    EXPECT_TRUE(vlTestThreadPoolScheduling());
+}
+
+TEST(thread_pool, parallel_for) {
+    EXPECT_TRUE(vlTestThreadPoolParallelFor());
+}